@@ -23,6 +23,7 @@
 #include "AstVisitor.h"
 #include "build.h"
 #include "codegen.h"
+#include "driver.h"
 #include "ForLoop.h"
 
 #include <algorithm>
@@ -76,10 +77,11 @@ CForLoop* CForLoop::buildWithBodyFrom(ForLoop* forLoop)
   SymbolMap map;
   CForLoop* retval = new CForLoop();
 
-  retval->astloc         = forLoop->astloc;
-  retval->blockTag       = forLoop->blockTag;
-  retval->mBreakLabel    = forLoop->breakLabelGet();
-  retval->mContinueLabel = forLoop->continueLabelGet();
+  retval->astloc            = forLoop->astloc;
+  retval->blockTag          = forLoop->blockTag;
+  retval->mBreakLabel       = forLoop->breakLabelGet();
+  retval->mContinueLabel    = forLoop->continueLabelGet();
+  retval->mOrderIndependent = forLoop->isOrderIndependent();
 
   for_alist(expr, forLoop->body)
     retval->insertAtTail(expr->copy(&map, true));
@@ -112,6 +114,7 @@ CForLoop::CForLoop() : LoopStmt(0)
   mInitClause = 0;
   mTestClause = 0;
   mIncrClause = 0;
+  mCountable  = true;
 }
 
 CForLoop::CForLoop(BlockStmt* initBody) : LoopStmt(initBody)
@@ -119,6 +122,7 @@ CForLoop::CForLoop(BlockStmt* initBody) : LoopStmt(initBody)
   mInitClause = 0;
   mTestClause = 0;
   mIncrClause = 0;
+  mCountable  = true;
 }
 
 CForLoop::~CForLoop()
@@ -135,8 +139,10 @@ CForLoop* CForLoop::copy(SymbolMap* mapRef, bool internal)
   retval->astloc         = astloc;
   retval->blockTag       = blockTag;
 
-  retval->mBreakLabel    = mBreakLabel;
-  retval->mContinueLabel = mContinueLabel;
+  retval->mBreakLabel       = mBreakLabel;
+  retval->mContinueLabel    = mContinueLabel;
+  retval->mOrderIndependent = mOrderIndependent;
+  retval->mCountable        = mCountable;
 
   if (initBlockGet() != 0 && testBlockGet() != 0 && incrBlockGet() != 0)
     retval->loopHeaderSet(initBlockGet()->copy(map, true),
@@ -188,6 +194,16 @@ BlockStmt* CForLoop::incrBlockGet() const
   return mIncrClause;
 }
 
+bool CForLoop::isCountable() const
+{
+  return mCountable;
+}
+
+void CForLoop::countableSet(bool countable)
+{
+  mCountable = countable;
+}
+
 CallExpr* CForLoop::blockInfoGet() const
 {
   printf("Migration: CForLoop  %12d Unexpected call to blockInfoGet()\n", id);
@@ -250,6 +266,80 @@ void CForLoop::verify()
     INT_FATAL(this, "CForLoop::verify. byrefVars is not NULL");
 }
 
+// Should this loop be marked as free of loop-carried dependences?  The
+// iterations of an order independent loop may run in any order, so the
+// back-end compiler may vectorize it as if they were independent.
+static bool vectorizationHintWanted(CForLoop* loop)
+{
+  bool retval = (fNoVectorize                == false &&
+                 loop->isOrderIndependent() == true  &&
+                 loop->isCountable()        == true);
+
+  if (retval == true && fReportVectorizedLoops == true)
+  {
+    ModuleSymbol* mod = loop->getModule();
+
+    if (developer == true ||
+        (mod->modTag != MOD_INTERNAL && mod->modTag != MOD_STANDARD))
+      printf("Vectorization hint for loop in %s (%s:%d)\n",
+             loop->getFunction()->name, loop->fname(), loop->linenum());
+  }
+
+  return retval;
+}
+
+#ifdef HAVE_LLVM
+// The LLVM form of the hint: give the loop an identifying llvm.loop node
+// that enables vectorization, and tag every load and store in it with
+// llvm.mem.parallel_loop_access, which tells the vectorizer they carry
+// no dependences across iterations.  The blocks of the loop are those
+// from its first body block to the one holding its back edge.
+static void addParallelLoopMetadata(llvm::Function*   func,
+                                    llvm::BasicBlock* first,
+                                    llvm::BranchInst* backEdge)
+{
+  llvm::LLVMContext& ctx         = gGenInfo->module->getContext();
+  llvm::MDNode*      tmp         = llvm::MDNode::getTemporary(ctx,
+                                                llvm::ArrayRef<llvm::Value*>());
+  llvm::Value*       enable[2]   = {
+    llvm::MDString::get(ctx, "llvm.vectorizer.enable"),
+    llvm::ConstantInt::get(llvm::Type::getInt1Ty(ctx), 1)
+  };
+  llvm::Value*       loopArgs[2] = { tmp, llvm::MDNode::get(ctx, enable) };
+  llvm::MDNode*      loopID      = llvm::MDNode::get(ctx, loopArgs);
+
+  // The loop ID refers to itself, so that it is distinct from any other.
+  loopID->replaceOperandWith(0, loopID);
+  llvm::MDNode::deleteTemporary(tmp);
+
+  backEdge->setMetadata("llvm.loop", loopID);
+
+  bool inLoop = false;
+
+  for (llvm::Function::iterator bb = func->begin(); bb != func->end(); ++bb)
+  {
+    if (&*bb == first)
+      inLoop = true;
+
+    if (inLoop == true)
+    {
+      for (llvm::BasicBlock::iterator inst = bb->begin(); inst != bb->end(); ++inst)
+      {
+        // Accesses in a nested loop keep that loop's tag, because the
+        // innermost loop is the one the vectorizer works on.
+        if ((llvm::isa<llvm::LoadInst>(inst)  ||
+             llvm::isa<llvm::StoreInst>(inst)) &&
+            inst->getMetadata("llvm.mem.parallel_loop_access") == NULL)
+          inst->setMetadata("llvm.mem.parallel_loop_access", loopID);
+      }
+
+      if (&*bb == backEdge->getParent())
+        break;
+    }
+  }
+}
+#endif
+
 GenRet CForLoop::codegen()
 {
   GenInfo* info    = gGenInfo;
@@ -277,6 +367,9 @@ GenRet CForLoop::codegen()
     std::string incr      = codegenCForLoopHeader(incrBlock->copy());
     std::string hdr       = "for (" + init + "; " + test + "; " + incr + ") ";
 
+    if (vectorizationHintWanted(this))
+      info->cStatements.push_back("CHPL_PRAGMA_IVDEP\n");
+
     info->cStatements.push_back(hdr);
 
     if (this != getFunction()->body)
@@ -369,7 +462,12 @@ GenRet CForLoop::codegen()
                                                FNAME("condition"));
 
     // Create the conditional branch
-    info->builder->CreateCondBr(condValue1, blockStmtBody, blockStmtEnd);
+    llvm::BranchInst* backEdge = info->builder->CreateCondBr(condValue1,
+                                                             blockStmtBody,
+                                                             blockStmtEnd);
+
+    if (vectorizationHintWanted(this))
+      addParallelLoopMetadata(func, blockStmtBody, backEdge);
 
     func->getBasicBlockList().push_back(blockStmtEnd);
 
@@ -124,8 +124,9 @@ ForLoop* ForLoop::copy(SymbolMap* mapRef, bool internal)
   retval->astloc         = astloc;
   retval->blockTag       = blockTag;
 
-  retval->mBreakLabel    = mBreakLabel;
-  retval->mContinueLabel = mContinueLabel;
+  retval->mBreakLabel       = mBreakLabel;
+  retval->mContinueLabel    = mContinueLabel;
+  retval->mOrderIndependent = mOrderIndependent;
 
   retval->mIndex         = mIndex->copy(map, true),
   retval->mIterator      = mIterator->copy(map, true);
@@ -21,8 +21,9 @@
 
 LoopStmt::LoopStmt(BlockStmt* initBody) : BlockStmt(initBody)
 {
-  mBreakLabel    = 0;
-  mContinueLabel = 0;
+  mBreakLabel       = 0;
+  mContinueLabel    = 0;
+  mOrderIndependent = false;
 }
 
 LoopStmt::~LoopStmt()
@@ -55,3 +56,12 @@ void LoopStmt::continueLabelSet(LabelSymbol* sym)
   mContinueLabel = sym;
 }
 
+bool LoopStmt::isOrderIndependent() const
+{
+  return mOrderIndependent;
+}
+
+void LoopStmt::orderIndependentSet(bool orderIndependent)
+{
+  mOrderIndependent = orderIndependent;
+}
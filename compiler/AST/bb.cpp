@@ -29,6 +29,8 @@
 #include "view.h"
 #include "WhileDoStmt.h"
 
+#include <algorithm>
+
 int                                          BasicBlock::nextID     = 0;
 BasicBlock*                                  BasicBlock::basicBlock = NULL;
 Map<LabelSymbol*, std::vector<BasicBlock*>*> BasicBlock::gotoMaps;
@@ -364,44 +366,143 @@ void BasicBlock::buildLocalsVectorMap(FnSymbol*          fn,
 
 
 //#define DEBUG_FLOW
+
+//
+// Compute a reverse postorder of the blocks reachable from the entry
+// block (block 0).  In this order every block comes before its successors
+// except along back edges, so a forward analysis that visits the blocks
+// in this order sees most of its inputs already computed.  The walk is
+// iterative so that very large functions cannot overflow the stack.
+//
+void BasicBlock::reversePostorder(std::vector<BasicBlock*>& blocks,
+                                  std::vector<int>&         order) {
+  size_t                                   nbbs = blocks.size();
+  std::vector<bool>                        visited(nbbs, false);
+  std::vector<std::pair<BasicBlock*, int> > stack;
+
+  order.clear();
+
+  if (nbbs == 0)
+    return;
+
+  visited[blocks[0]->id] = true;
+  stack.push_back(std::make_pair(blocks[0], 0));
+
+  while (stack.empty() == false) {
+    BasicBlock* bb   = stack.back().first;
+    size_t      next = stack.back().second;
+
+    if (next < bb->outs.size()) {
+      BasicBlock* out = bb->outs[next];
+
+      stack.back().second++;
+
+      if (visited[out->id] == false) {
+        visited[out->id] = true;
+        stack.push_back(std::make_pair(out, 0));
+      }
+
+    } else {
+      order.push_back(bb->id);
+      stack.pop_back();
+    }
+  }
+
+  std::reverse(order.begin(), order.end());
+}
+
+//
+// The order in which the flow analyses visit the blocks: reverse
+// postorder for a forward analysis, postorder for a backward one.
+// Blocks that cannot be reached from the entry block still take part in
+// the analysis, after the others in their original order.  position[i]
+// is the place of block i in the order.
+//
+static void flowOrder(std::vector<BasicBlock*>& blocks,
+                      bool                      forward,
+                      std::vector<int>&         order,
+                      std::vector<int>&         position) {
+  size_t nbbs = blocks.size();
+
+  BasicBlock::reversePostorder(blocks, order);
+
+  if (forward == false)
+    std::reverse(order.begin(), order.end());
+
+  position.assign(nbbs, -1);
+
+  for (size_t i = 0; i < order.size(); i++)
+    position[order[i]] = i;
+
+  for (size_t i = 0; i < nbbs; i++) {
+    if (position[i] == -1) {
+      position[i] = order.size();
+      order.push_back(i);
+    }
+  }
+}
+
+//
+// Both analyses keep a worklist of the blocks whose inputs have changed,
+// as a bit vector indexed by position in the flow order.  Each sweep
+// takes the pending blocks in that order, and only the neighbors of a
+// block whose result changed are queued again, so an acyclic region
+// settles in a single sweep and a loop costs about one extra sweep per
+// level of nesting.
+//
 void BasicBlock::backwardFlowAnalysis(FnSymbol*             fn,
                                       std::vector<BitVec*>& GEN,
                                       std::vector<BitVec*>& KILL,
                                       std::vector<BitVec*>& IN,
                                       std::vector<BitVec*>& OUT) {
-  bool iterate = true;
+  std::vector<BasicBlock*>& blocks = *fn->basicBlocks;
+  std::vector<int>          order;
+  std::vector<int>          position;
+  BitVec                    pending(blocks.size());
 
-  while (iterate) {
-    int i = 0;
+  flowOrder(blocks, false, order, position);
 
-    iterate = false;
+  pending.set();
 
-    for_vector(BasicBlock, bb, *fn->basicBlocks) {
-      for (int j = 0; j < IN[i]->ndata; j++) {
-        unsigned int new_in  = (OUT[i]->data[j] & ~KILL[i]->data[j]) | GEN[i]->data[j];
-        unsigned int new_out = 0;
+  for (int pos = pending.nextSet(0); pos != -1; ) {
+    int         i      = order[pos];
+    BasicBlock* bb     = blocks[i];
+    bool        change = false;
 
-        if (new_in != IN[i]->data[j]) {
-          IN[i]->data[j] = new_in;
-          iterate = true;
-        }
+    pending.unset(pos);
 
-        for_vector(BasicBlock, bbout, bb->outs) {
-          new_out = new_out | IN[bbout->id]->data[j];
-        }
+    for (int j = 0; j < IN[i]->ndata; j++) {
+      uint64_t new_out = 0;
 
-        if (new_out != OUT[i]->data[j]) {
-          OUT[i]->data[j] = new_out;
-          iterate = true;
-        }
+      for_vector(BasicBlock, bbout, bb->outs) {
+        new_out |= IN[bbout->id]->data[j];
       }
 
-      i++;
+      OUT[i]->data[j] = new_out;
+
+      uint64_t new_in = (new_out & ~KILL[i]->data[j]) | GEN[i]->data[j];
+
+      if (new_in != IN[i]->data[j]) {
+        IN[i]->data[j] = new_in;
+        change         = true;
+      }
     }
+
+    if (change) {
+      for_vector(BasicBlock, bbin, bb->ins) {
+        pending.set(position[bbin->id]);
+      }
+    }
+
+    pos = pending.nextSet(pos + 1);
+
+    if (pos == -1) {
 #ifdef DEBUG_FLOW
-    printf("IN\n");  printBitVectorSets(IN);
-    printf("OUT\n"); printBitVectorSets(OUT);
+      printf("IN\n");  printBitVectorSets(IN);
+      printf("OUT\n"); printBitVectorSets(OUT);
 #endif
+      pos = pending.nextSet(0);
+    }
   }
 }
 
@@ -412,37 +513,25 @@ void BasicBlock::forwardFlowAnalysis(FnSymbol*             fn,
                                      std::vector<BitVec*>& IN,
                                      std::vector<BitVec*>& OUT,
                                      bool                  intersect) {
-  size_t           nbbq = fn->basicBlocks->size(); // size of bb queue
-  std::vector<int> bbq;
-  BitVec           bbs(nbbq);
-  int              iq = -1;
-  int              nq = nbbq - 1;
-
-  for (size_t i = 0; i < nbbq; i++) {
-    bbq.push_back(i);
-    bbs.set(i);
-  }
+  std::vector<BasicBlock*>& blocks = *fn->basicBlocks;
+  std::vector<int>          order;
+  std::vector<int>          position;
+  BitVec                    pending(blocks.size());
 
-  while (iq != nq) {
-    iq = (iq + 1) % nbbq;
+  flowOrder(blocks, true, order, position);
 
-    int i = bbq[iq];
-
-    bbs.unset(i);
-
-#ifdef DEBUG_FLOW
-    if (iq == 0) {
-      printf("IN\n");  printBitVectorSets(IN);
-      printf("OUT\n"); printBitVectorSets(OUT);
-    }
-#endif
+  pending.set();
 
-    BasicBlock* bb     = (*fn->basicBlocks)[i];
+  for (int pos = pending.nextSet(0); pos != -1; ) {
+    int         i      = order[pos];
+    BasicBlock* bb     = blocks[i];
     bool        change = false;
 
+    pending.unset(pos);
+
     for (int j = 0; j < IN[i]->ndata; j++) {
       if (bb->ins.size() > 0) {
-        unsigned int new_in = (intersect) ? (unsigned int) (-1) : 0;
+        uint64_t new_in = (intersect) ? ~(uint64_t) 0 : 0;
 
         for_vector(BasicBlock, bbin, bb->ins) {
           if (intersect)
@@ -451,13 +540,10 @@ void BasicBlock::forwardFlowAnalysis(FnSymbol*             fn,
             new_in |= OUT[bbin->id]->data[j];
         }
 
-        if (new_in != IN[i]->data[j]) {
-          IN[i]->data[j] = new_in;
-          change         = true;
-        }
+        IN[i]->data[j] = new_in;
       }
 
-      unsigned int new_out = (IN[i]->data[j] & ~KILL[i]->data[j]) | GEN[i]->data[j];
+      uint64_t new_out = (IN[i]->data[j] & ~KILL[i]->data[j]) | GEN[i]->data[j];
 
       if (new_out != OUT[i]->data[j]) {
         OUT[i]->data[j] = new_out;
@@ -467,14 +553,18 @@ void BasicBlock::forwardFlowAnalysis(FnSymbol*             fn,
 
     if (change) {
       for_vector(BasicBlock, bbout, bb->outs) {
-        if (!bbs.get(bbout->id)) {
-          nq      = (nq + 1) % nbbq;
+        pending.set(position[bbout->id]);
+      }
+    }
 
-          bbs.set(bbout->id);
+    pos = pending.nextSet(pos + 1);
 
-          bbq[nq] = bbout->id;
-        }
-      }
+    if (pos == -1) {
+#ifdef DEBUG_FLOW
+      printf("IN\n");  printBitVectorSets(IN);
+      printf("OUT\n"); printBitVectorSets(OUT);
+#endif
+      pos = pending.nextSet(0);
     }
   }
 }
@@ -892,6 +892,9 @@ buildFollowLoop(VarSymbol* iter,
   BlockStmt* followBlock = new BlockStmt();
   ForLoop*   followBody  = new ForLoop(followIdx, followIter, loopBody);
 
+  // The iterations of a forall may run in any order
+  followBody->orderIndependentSet(true);
+
   destructureIndices(followBody, indices, new SymExpr(followIdx), false);
 
   followBlock->insertAtTail(new DefExpr(followIter));
@@ -1209,7 +1212,8 @@ BlockStmt* buildCoforallLoopStmt(Expr* indices,
     BlockStmt* block = ForLoop::buildForLoop(indices, iterator, body, true, zippered);
     block->insertAtHead(new CallExpr(PRIM_MOVE, coforallCount, new CallExpr("_endCountAlloc")));
     block->insertAtHead(new DefExpr(coforallCount));
-    body->insertAtHead(new CallExpr("_upEndCount", coforallCount));
+    body->insertAtHead(new CallExpr("_upEndCountDeferred", coforallCount));
+    block->insertAtTail(new CallExpr("_upEndCountFlush", coforallCount));
     block->insertAtTail(new CallExpr("_waitEndCount", coforallCount));
     block->insertAtTail(new CallExpr("_endCountFree", coforallCount));
     onBlock->blockInfoGet()->primitive = primitives[PRIM_BLOCK_COFORALL_ON];
@@ -1231,8 +1235,9 @@ BlockStmt* buildCoforallLoopStmt(Expr* indices,
     BlockStmt* block = ForLoop::buildForLoop(indices, iterator, beginBlk, true, zippered);
     block->insertAtHead(new CallExpr(PRIM_MOVE, coforallCount, new CallExpr("_endCountAlloc")));
     block->insertAtHead(new DefExpr(coforallCount));
+    block->insertAtTail(new CallExpr("_upEndCountFlush", coforallCount));
     block->insertAtTail(new CallExpr(PRIM_PROCESS_TASK_LIST, coforallCount));
-    beginBlk->insertBefore(new CallExpr("_upEndCount", coforallCount));
+    beginBlk->insertBefore(new CallExpr("_upEndCountDeferred", coforallCount));
     block->insertAtTail(new CallExpr("_waitEndCount", coforallCount));
     block->insertAtTail(new CallExpr("_endCountFree", coforallCount));
     return block;
@@ -2050,9 +2055,11 @@ buildCobeginStmt(CallExpr* byref_vars, BlockStmt* block) {
     stmt->insertBefore(beginBlk);
     beginBlk->insertAtHead(stmt->remove());
     beginBlk->insertAtTail(new CallExpr("_downEndCount", cobeginCount));
-    block->insertAtHead(new CallExpr("_upEndCount", cobeginCount));
   }
 
+  // count all of the tasks in one step
+  block->insertAtHead(new CallExpr("_upEndCount", cobeginCount,
+                                   new_IntSymbol(block->length())));
   block->insertAtHead(new CallExpr(PRIM_MOVE, cobeginCount, new CallExpr("_endCountAlloc")));
   block->insertAtHead(new DefExpr(cobeginCount));
   block->insertAtTail(new CallExpr(PRIM_PROCESS_TASK_LIST, cobeginCount));
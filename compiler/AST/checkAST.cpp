@@ -190,6 +190,13 @@ void checkPrimitives()
      case PRIM_PROCESS_TASK_LIST:
      case PRIM_EXECUTE_TASKS_IN_LIST:
      case PRIM_FREE_TASK_LIST:
+     case PRIM_TASK_ARGS_ALLOC:
+     case PRIM_TASK_ARGS_FREE:
+     case PRIM_ON_BATCH_CREATE:
+     case PRIM_ON_BATCH_ADD:
+     case PRIM_ON_BATCH_FINISH:
+     case PRIM_ON_BATCH_RUN:
+     case PRIM_CALL_PROFILE_COUNT:
      case PRIM_GET_SERIAL:              // get serial state
      case PRIM_SET_SERIAL:              // set serial state to true or false
      case PRIM_SIZEOF:
@@ -209,6 +216,8 @@ void checkPrimitives()
      case PRIM_CHPL_COMM_REMOTE_PREFETCH:
      case PRIM_CHPL_COMM_GET_STRD:      // Direct calls to the Chapel comm layer for strided comm
      case PRIM_CHPL_COMM_PUT_STRD:      //  may eventually add others (e.g.: non-blocking)
+     case PRIM_CHPL_COMM_GET_FIELDS:
+     case PRIM_CHPL_COMM_PUT_FIELDS:
      case PRIM_ARRAY_ALLOC:
      case PRIM_ARRAY_FREE:
      case PRIM_ARRAY_FREE_ELTS:
@@ -4924,6 +4924,61 @@ GenRet CallExpr::codegen() {
       codegenCall("chpl_taskListFree", get(1), get(2), get(3));
       break;
     }
+    case PRIM_TASK_ARGS_ALLOC:
+    {
+      // args are: size, memory descriptor, line, file
+      GenRet md = codegenAdd(get(2), codegenCallExpr("chpl_memhook_md_num"));
+      ret = codegenCallExpr("chpl_mem_allocPooled",
+                            codegenValue(get(1)), md, get(3), get(4));
+      break;
+    }
+    case PRIM_TASK_ARGS_FREE:
+    {
+      if (fNoMemoryFrees)
+        break;
+      codegenCall("chpl_mem_freePooled",
+                  codegenCastToVoidStar(codegenValue(get(1))),
+                  get(2), get(3));
+      break;
+    }
+    case PRIM_ON_BATCH_CREATE:
+    {
+      // args are: batch runner
+      FnSymbol* runner = toFnSymbol(toSymExpr(get(1))->var);
+      ret = codegenCallExpr("chpl_comm_on_batch_create",
+                            new_IntSymbol(ftableMap.get(runner), INT_SIZE_32),
+                            linenum(), fname());
+      break;
+    }
+    case PRIM_ON_BATCH_ADD:
+    {
+      // args are: batch, on-body wrapper, locale, argument bundle
+      FnSymbol* onFn = toFnSymbol(toSymExpr(get(2))->var);
+      AggregateType* ct = toAggregateType(get(4)->typeInfo());
+      INT_ASSERT(onFn && ct);
+
+      std::vector<GenRet> args(7);
+      args[0] = get(1);
+      args[1] = codegenLocalAddrOf(get(3));
+      args[2] = new_IntSymbol(ftableMap.get(onFn), INT_SIZE_32);
+      args[3] = codegenCastToVoidStar(codegenValue(get(4)));
+      args[4] = codegenSizeof(ct->classStructName(true));
+      args[5] = onFn->linenum();
+      args[6] = onFn->fname();
+
+      genComment(onFn->cname, true);
+      codegenCall("chpl_comm_on_batch_add", args);
+      break;
+    }
+    case PRIM_ON_BATCH_FINISH:
+      codegenCall("chpl_comm_on_batch_finish", get(1), linenum(), fname());
+      break;
+    case PRIM_ON_BATCH_RUN:
+      codegenCall("chpl_comm_on_batch_run", get(1));
+      break;
+    case PRIM_CALL_PROFILE_COUNT:
+      codegenCall("chpl_call_prof_count", get(1));
+      break;
     case PRIM_GET_SERIAL:
       ret = codegenCallExpr("chpl_task_getSerial");
       break;
@@ -5012,6 +5067,64 @@ GenRet CallExpr::codegen() {
       }
       break;
     }
+    case PRIM_CHPL_COMM_GET_FIELDS:
+    case PRIM_CHPL_COMM_PUT_FIELDS: {
+      // args are:
+      //   wide base, (field, local temp)*, line, file
+      // The fields are in declaration order.  The span from the first
+      // to the last one is moved with a single get or put through a
+      // local copy of the object.  Only generated for the C backend
+      // (see coalesceWideAccesses).
+      INT_ASSERT(info->cfile);
+      bool isGet = (primitive->tag == PRIM_CHPL_COMM_GET_FIELDS);
+      int numFields = (numActuals() - 3) / 2;
+
+      Type* baseType = get(1)->typeInfo();
+      AggregateType* ct =
+        toAggregateType(baseType->getField("addr")->typeInfo()->getValType());
+      INT_ASSERT(ct);
+
+      GenRet copy;
+      if (isClass(ct)) {
+        copy = createTempVar(ct->classStructName(true));
+        copy = codegenCast(ct, codegenAddrOf(copy));
+      } else {
+        copy = createTempVar(ct);
+        copy.chplType = ct;
+      }
+
+      Symbol* firstField = toSymExpr(get(2))->var;
+      Symbol* lastField = toSymExpr(get(2*numFields))->var;
+      GenRet localFirst = codegenFieldPtr(copy, firstField);
+      GenRet localLast = codegenFieldPtr(copy, lastField);
+      GenRet remote = codegenFieldPtr(get(1), firstField);
+      GenRet len = codegenAdd(codegenSub(codegenCastToCharStar(localLast),
+                                         codegenCastToCharStar(localFirst)),
+                              codegenSizeof(lastField->typeInfo()));
+      TypeSymbol* byteType = dtUInt[INT_SIZE_8]->symbol;
+
+      if (!isGet) {
+        for (int i = 0; i < numFields; i++) {
+          codegenAssign(codegenFieldPtr(copy, get(2*i+2)), get(2*i+3));
+        }
+      }
+
+      codegenCall(isGet ? "chpl_gen_comm_get" : "chpl_gen_comm_put",
+                  codegenCastToVoidStar(localFirst),
+                  codegenRnode(remote),
+                  codegenRaddr(remote),
+                  codegenSizeof(byteType->typeInfo()),
+                  genTypeStructureIndex(byteType),
+                  len,
+                  get(numActuals()-1), get(numActuals()));
+
+      if (isGet) {
+        for (int i = 0; i < numFields; i++) {
+          codegenAssign(get(2*i+3), codegenFieldPtr(copy, get(2*i+2)));
+        }
+      }
+      break;
+    }
     case PRIM_CHPL_COMM_REMOTE_PREFETCH: {
       // args are:
       //   locale, remote addr, (eltSize), get(3)==length, line, file
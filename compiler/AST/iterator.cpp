@@ -56,7 +56,8 @@ IteratorInfo::IteratorInfo() :
   hasMore(NULL),
   getValue(NULL),
   init(NULL),
-  incr(NULL)
+  incr(NULL),
+  cforLoop(false)
 {}
 
 
@@ -1224,6 +1225,8 @@ void lowerIterator(FnSymbol* fn) {
     buildGetValue(ii);
     buildInit(ii, singleLoop);
     buildIncr(ii, singleLoop);
+
+    ii->cforLoop = (singleLoop != NULL && singleLoop->isCForLoop() == true);
   }
   rebuildIterator(ii, local2rfield, locals);
   rebuildGetIterator(ii);
@@ -485,6 +485,16 @@ initPrimitive() {
   prim_def(PRIM_EXECUTE_TASKS_IN_LIST, "execute tasks in list", returnInfoVoid, true, true);
   prim_def(PRIM_FREE_TASK_LIST, "free task list", returnInfoVoid, true, true);
 
+  prim_def(PRIM_TASK_ARGS_ALLOC, "task args alloc", returnInfoOpaque, true, true);
+  prim_def(PRIM_TASK_ARGS_FREE, "task args free", returnInfoVoid, true, true);
+
+  prim_def(PRIM_ON_BATCH_CREATE, "on batch create", returnInfoOpaque, true);
+  prim_def(PRIM_ON_BATCH_ADD, "on batch add", returnInfoVoid, true);
+  prim_def(PRIM_ON_BATCH_FINISH, "on batch finish", returnInfoVoid, true);
+  prim_def(PRIM_ON_BATCH_RUN, "on batch run", returnInfoVoid, true);
+
+  prim_def(PRIM_CALL_PROFILE_COUNT, "call profile count", returnInfoVoid, true);
+
   // task primitives
   prim_def(PRIM_GET_SERIAL, "task_get_serial", returnInfoBool);
   prim_def(PRIM_SET_SERIAL, "task_set_serial", returnInfoVoid, true);
@@ -509,6 +519,8 @@ initPrimitive() {
   prim_def(PRIM_CHPL_COMM_REMOTE_PREFETCH, "chpl_comm_remote_prefetch", returnInfoVoid, true, true);
   prim_def(PRIM_CHPL_COMM_GET_STRD, "chpl_comm_get_strd", returnInfoVoid, true, true);
   prim_def(PRIM_CHPL_COMM_PUT_STRD, "chpl_comm_put_strd", returnInfoVoid, true, true);
+  prim_def(PRIM_CHPL_COMM_GET_FIELDS, "chpl_comm_get_fields", returnInfoVoid, true, true);
+  prim_def(PRIM_CHPL_COMM_PUT_FIELDS, "chpl_comm_put_fields", returnInfoVoid, true, true);
 
   prim_def(PRIM_ARRAY_SHIFT_BASE_POINTER, "shift_base_pointer", returnInfoVoid, true, true);
   prim_def(PRIM_ARRAY_ALLOC, "array_alloc", returnInfoVoid, true, true);
@@ -20,7 +20,7 @@
 #include "chpl.h"
 #include "bitVec.h"
 
-#define TYPE unsigned
+#define TYPE uint64_t
 
 BitVec::BitVec(int in_size) {
   if (in_size == 0) {
@@ -49,14 +49,14 @@ void BitVec::clear() {
 bool BitVec::get(int i) {
   int j = i / (sizeof(TYPE)<<3);
   int k = i - j*(sizeof(TYPE)<<3);
-  return data[j] & (1 << k);
+  return (data[j] & ((TYPE)1 << k)) != 0;
 }
 
 
 void BitVec::unset(int i) {
   int j = i / (sizeof(TYPE)<<3);
   int k = i - j*(sizeof(TYPE)<<3);
-  data[j] &= ((TYPE)-1) - (1 << k);
+  data[j] &= ~((TYPE)1 << k);
 }
 
 
@@ -72,6 +72,44 @@ void BitVec::intersection(BitVec& other) {
 }
 
 
+//
+// Set bits lo through hi-1, filling whole words where possible.
+//
+void BitVec::setRange(int lo, int hi) {
+  const int bits = sizeof(TYPE)<<3;
+  while (lo < hi && lo % bits != 0)
+    set(lo++);
+  while (hi - lo >= bits) {
+    data[lo / bits] = ~(TYPE)0;
+    lo += bits;
+  }
+  while (lo < hi)
+    set(lo++);
+}
+
+
+//
+// Return the index of the first set bit at or after i, or -1 if there
+// is none.  Words that are all zero are skipped whole, so walking the
+// set bits of a sparse vector costs little more than a pass over its
+// words.
+//
+int BitVec::nextSet(int i) {
+  const int bits = sizeof(TYPE)<<3;
+  if (i >= in_size)
+    return -1;
+  int  j = i / bits;
+  TYPE w = data[j] & (~(TYPE)0 << (i - j*bits));
+  while (w == 0) {
+    if (++j == ndata)
+      return -1;
+    w = data[j];
+  }
+  int next = j*bits + __builtin_ctzll(w);
+  return next < in_size ? next : -1;
+}
+
+
 
 
 /*
@@ -101,7 +139,7 @@ void BitVec::set() {
 void BitVec::set(int i) {
   int j = i / (sizeof(TYPE)<<3);
   int k = i - j*(sizeof(TYPE)<<3);
-  data[j] |= 1 << k;
+  data[j] |= (TYPE)1 << k;
 }
 
 
@@ -114,7 +152,7 @@ void BitVec::reset() {
 void BitVec::reset(int i) {
   int j = i / (sizeof(TYPE)<<3);
   int k = i - j*(sizeof(TYPE)<<3);
-  data[j] &= ((int)-1) - (1 << k);
+  data[j] &= ~((TYPE)1 << k);
 }
 
 
@@ -127,7 +165,7 @@ void BitVec::flip() {
 void BitVec::flip(int i) {
   int j = i / (sizeof(TYPE)<<3);
   int k = i - j*(sizeof(TYPE)<<3);
-  data[j] ^= 1 << k;
+  data[j] ^= (TYPE)1 << k;
 }
 
 
@@ -142,7 +180,7 @@ int BitVec::count() {
   int count = 0;
   for (int i = 0; i < ndata; i++) {
     int localCount ;
-    int x = data[i]; 
+    TYPE x = data[i]; 
     for (localCount=0; x; localCount++) {
       x &= x-1;
     }
@@ -160,7 +198,7 @@ int BitVec::size() {
 bool BitVec::test(int i) {
   int j = i / (sizeof(TYPE)<<3);
   int k = i - j*(sizeof(TYPE)<<3);
-  return data[j] & (1 << k);
+  return data[j] & ((TYPE)1 << k);
 }
 
 
@@ -64,6 +64,9 @@ public:
   BlockStmt*             testBlockGet()                               const;
   BlockStmt*             incrBlockGet()                               const;
 
+  bool                   isCountable()                                const;
+  void                   countableSet(bool countable);
+
   virtual CallExpr*      blockInfoGet()                               const;
   virtual CallExpr*      blockInfoSet(CallExpr* expr);
 
@@ -78,6 +81,10 @@ private:
   BlockStmt*             mInitClause;
   BlockStmt*             mTestClause;
   BlockStmt*             mIncrClause;
+
+  // False if the loop is stepped by statements in its body rather than
+  // by its increment clause, e.g. through an iterator class's advance()
+  bool                   mCountable;
 };
 
 #endif
@@ -33,12 +33,18 @@ public:
   LabelSymbol*           continueLabelGet()                           const;
   void                   continueLabelSet(LabelSymbol* sym);
 
+  // True for loops whose iterations may be run in any order, e.g. the
+  // loops of a forall follower.  Used for vectorization hints.
+  bool                   isOrderIndependent()                         const;
+  void                   orderIndependentSet(bool orderIndependent);
+
 protected:
                          LoopStmt(BlockStmt* initBody);
   virtual               ~LoopStmt();
 
   LabelSymbol*           mBreakLabel;
   LabelSymbol*           mContinueLabel;
+  bool                   mOrderIndependent;
 
 private:
                          LoopStmt();
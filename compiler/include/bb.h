@@ -46,6 +46,9 @@ public:
 
   static void               printBasicBlocks(FnSymbol* fn);
 
+  static void               reversePostorder(std::vector<BasicBlock*>& blocks,
+                                             std::vector<int>&         order);
+
   static void               buildLocalsVectorMap(FnSymbol*             fn,
                                                  Vec<Symbol*>&         locals,
                                                  Map<Symbol*,int>&     localMap);
@@ -20,9 +20,15 @@
 #ifndef _CHPL_BIT_VEC_H_
 #define _CHPL_BIT_VEC_H_
 
+#include <stdint.h>
+
+//
+// A fixed-size set of bits stored in 64-bit words.  The dataflow
+// analyses operate on the words directly, a whole word at a time.
+//
 class BitVec {
  public:
-  unsigned* data;
+  uint64_t* data;
   int in_size;
   int ndata;
 
@@ -33,6 +39,8 @@ class BitVec {
   void unset(int i);
   void disjunction(BitVec& other);
   void intersection(BitVec& other);
+  void setRange(int lo, int hi);
+  int nextSet(int i);
   
   
   // Added functionality to make this compatible with std::bitset and thus 
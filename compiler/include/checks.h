@@ -60,9 +60,12 @@ void check_prune2();
 void check_returnStarTuplesByRefArgs();
 void check_insertWideReferences();
 void check_narrowWideReferences();
+void check_coalesceWideAccesses();
+void check_insertCommPrefetches();
 void check_optimizeOnClauses();
 void check_addInitCalls();
 void check_insertLineNumbers();
+void check_batchOnClauses();
 void check_codegen();
 void check_makeBinary();
 
@@ -20,15 +20,27 @@
 #ifndef _CHPL_DOMINATOR_H
 #define _CHPL_DOMINATOR_H
 
-#include "astutil.h"
 #include "bb.h"
-#include "bitVec.h"
-#include <set>
 
-void computeDominators(std::vector<BitVec*>& dominators, std::vector<BasicBlock*>& basicBlocks);
-bool dominates(unsigned a, unsigned b, std::vector<BitVec*> & dominators);
-bool strictlyDominates(unsigned a, unsigned b, std::vector<BitVec*> & dominators);
+#include <vector>
 
-void computeImmediateDominators(std::vector<unsigned>& immediateDominators, std::vector<BitVec*>& dominators);
+//
+// The dominator tree of a function's basic blocks, indexed by block id.
+// Blocks that cannot be reached from the entry block neither dominate nor
+// are dominated by any block, including themselves.
+//
+class DominatorTree {
+public:
+  DominatorTree(std::vector<BasicBlock*>& basicBlocks);
+
+  bool             dominates(int a, int b)         const;
+  bool             strictlyDominates(int a, int b) const;
+  int              immediateDominator(int b)       const;
+
+private:
+  std::vector<int> idoms;
+  std::vector<int> preorder;
+  std::vector<int> postorder;
+};
 
 #endif
@@ -49,11 +49,13 @@ extern int  instantiation_limit;
 extern bool fFastFlag;
 extern int  fConditionalDynamicDispatchLimit;
 extern bool fNoBoundsChecks;
+extern bool fNoCoalesceWideAccesses;
 extern bool fNoCopyPropagation;
 extern bool fNoDeadCodeElimination;
 extern bool fNoGlobalConstOpt;
 extern bool fNoFastFollowers;
 extern bool fNoInlineIterators;
+extern bool fNoVectorize;
 extern bool fNoloopInvariantCodeMotion;
 extern bool fNoInline;
 extern bool fNoLiveAnalysis;
@@ -70,8 +72,12 @@ extern bool fNoTupleCopyOpt;
 extern bool fNoOptimizeLoopIterators;
 extern bool fNoPrivatization;
 extern bool fNoOptimizeOnClauses;
+extern bool fNoBatchOnClauses;
 extern bool fNoRemoveEmptyRecords;
 extern int  optimize_on_clause_limit;
+extern int  comm_prefetch_distance;
+extern bool fProfileGenerate;
+extern char profileUsePrefix[FILENAME_MAX+1];
 extern int  scalar_replace_limit;
 extern int  tuple_copy_limit;
 
@@ -175,8 +181,16 @@ extern bool fReportOptimizedLoopIterators;
 extern bool fReportOptimizedOn;
 extern bool fReportPromotion;
 extern bool fReportScalarReplace;
+extern bool fReportUnscalarizedTuples;
+extern bool fReportUninlinedIterators;
 extern bool fReportDeadBlocks;
 extern bool fReportDeadModules;
+extern bool fReportHeapPromotion;
+extern bool fReportVectorizedLoops;
+extern bool fReportCoalescedWideAccesses;
+extern bool fReportCommPrefetch;
+extern bool fReportBatchedOnClauses;
+extern bool fReportProfileInlining;
 
 extern bool debugCCode, optimizeCCode, specializeCCode;
 
@@ -189,6 +203,7 @@ extern Timer timer5;
 
 extern bool fNoMemoryFrees;
 extern int numGlobalsOnHeap;
+extern Vec<const char*> profiledCallSites;
 extern bool preserveInlinedLineNumbers;
 
 extern int breakOnID;
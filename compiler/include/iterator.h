@@ -48,6 +48,10 @@ public:
   FnSymbol*      getValue;
   FnSymbol*      init;
   FnSymbol*      incr;
+
+  // True if init and incr step the iterator's single C for loop.  The
+  // other iterators are stepped by advance().
+  bool           cforLoop;
 };
 
 void lowerIterator(FnSymbol* fn);
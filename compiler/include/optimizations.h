@@ -41,6 +41,7 @@ class BlockStmt;
 class FnSymbol;
 class Symbol;
 class SymExpr;
+class Type;
 
 void removeUnnecessaryGotos(FnSymbol* fn);
 void removeUnusedLabels(FnSymbol* fn);
@@ -54,6 +55,8 @@ void deadVariableElimination(FnSymbol* fn);
 void deadExpressionElimination(FnSymbol* fn);
 void deadCodeElimination(FnSymbol* fn);
 
+bool isSmallPODAggregate(Type* type);
+
 void liveVariableAnalysis(FnSymbol* fn,
                           Vec<Symbol*>& locals,
                           Map<Symbol*,int>& localID,
@@ -32,6 +32,7 @@ extern bool intentsResolved;
 // prototypes of functions that are called as passes (alphabetical)
 //
 void addInitCalls();
+void batchOnClauses();
 void buildDefaultFunctions();
 void bulkCopyRecords();
 void callDestructors();
@@ -39,6 +40,7 @@ void checkNormalized();
 void checkParsed();
 void checkResolved();
 void cleanup();
+void coalesceWideAccesses();
 void codegen();
 void complex2record();
 void copyPropagation();
@@ -50,6 +52,7 @@ void expandExternArrayCalls();
 void flattenClasses();
 void flattenFunctions();
 void inlineFunctions();
+void insertCommPrefetches();
 void insertLineNumbers();
 void insertWideReferences();
 void narrowWideReferences();
@@ -132,6 +132,16 @@ enum PrimitiveTag {
   PRIM_EXECUTE_TASKS_IN_LIST,
   PRIM_FREE_TASK_LIST,
 
+  PRIM_TASK_ARGS_ALLOC,         // allocate/free a task argument bundle
+  PRIM_TASK_ARGS_FREE,
+
+  PRIM_ON_BATCH_CREATE,         // batch the forks of a loop's fast "on"s
+  PRIM_ON_BATCH_ADD,
+  PRIM_ON_BATCH_FINISH,
+  PRIM_ON_BATCH_RUN,            // body of the batch runner
+
+  PRIM_CALL_PROFILE_COUNT,      // count a profiled call site
+
   PRIM_GET_SERIAL,              // get serial state
   PRIM_SET_SERIAL,              // set serial state to true or false
 
@@ -154,6 +164,8 @@ enum PrimitiveTag {
   PRIM_CHPL_COMM_REMOTE_PREFETCH,
   PRIM_CHPL_COMM_GET_STRD,      // Direct calls to the Chapel comm layer for strided comm
   PRIM_CHPL_COMM_PUT_STRD,      //  may eventually add others (e.g., non-blocking)
+  PRIM_CHPL_COMM_GET_FIELDS,    // Bulk get/put of a span of fields of a
+  PRIM_CHPL_COMM_PUT_FIELDS,    //  remote object via local temps
 
   PRIM_ARRAY_ALLOC,
   PRIM_ARRAY_FREE,
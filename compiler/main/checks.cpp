@@ -349,6 +349,20 @@ void check_narrowWideReferences()
   check_afterCallDestructors();
 }
 
+void check_coalesceWideAccesses()
+{
+  check_afterEveryPass();
+  check_afterNormalization();
+  check_afterCallDestructors();
+}
+
+void check_insertCommPrefetches()
+{
+  check_afterEveryPass();
+  check_afterNormalization();
+  check_afterCallDestructors();
+}
+
 void check_optimizeOnClauses()
 {
   check_afterEveryPass();
@@ -373,6 +387,14 @@ void check_insertLineNumbers()
   check_afterLowerIterators();
 }
 
+void check_batchOnClauses()
+{
+  check_afterEveryPass();
+  check_afterNormalization();
+  check_afterCallDestructors();
+  check_afterLowerIterators();
+}
+
 void check_codegen()
 {
   // This pass should not change the AST, so no checks are required.
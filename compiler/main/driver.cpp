@@ -102,6 +102,7 @@ static bool fBaseline = false;
 bool fCacheRemote = false;
 bool fFastFlag = false;
 int fConditionalDynamicDispatchLimit = 0;
+bool fNoCoalesceWideAccesses = false;
 bool fNoCopyPropagation = false;
 bool fNoDeadCodeElimination = false;
 bool fNoScalarReplacement = false;
@@ -112,6 +113,7 @@ bool fNoOptimizeLoopIterators = false;
 bool fNoGlobalConstOpt = false;
 bool fNoFastFollowers = false;
 bool fNoInlineIterators = false;
+bool fNoVectorize = true;
 bool fNoLiveAnalysis = false;
 bool fNoBoundsChecks = false;
 bool fNoLocalChecks = false;
@@ -136,9 +138,13 @@ bool fNoChecks = false;
 bool fNoInline = false;
 bool fNoPrivatization = false;
 bool fNoOptimizeOnClauses = false;
+bool fNoBatchOnClauses = false;
 bool fNoRemoveEmptyRecords = true;
 bool fMinimalModules = false;
 int optimize_on_clause_limit = 20;
+int comm_prefetch_distance = 0;
+bool fProfileGenerate = false;
+char profileUsePrefix[FILENAME_MAX+1] = "";
 int scalar_replace_limit = 8;
 int tuple_copy_limit = scalar_replace_limit;
 bool fGenIDS = false;
@@ -162,8 +168,16 @@ bool fReportOptimizedLoopIterators = false;
 bool fReportOptimizedOn = false;
 bool fReportPromotion = false;
 bool fReportScalarReplace = false;
+bool fReportUnscalarizedTuples = false;
+bool fReportUninlinedIterators = false;
 bool fReportDeadBlocks = false;
 bool fReportDeadModules = false;
+bool fReportHeapPromotion = false;
+bool fReportVectorizedLoops = false;
+bool fReportCoalescedWideAccesses = false;
+bool fReportCommPrefetch = false;
+bool fReportBatchedOnClauses = false;
+bool fReportProfileInlining = false;
 bool printCppLineno = false;
 bool userSetCppLineno = false;
 int num_constants_per_variable = 1;
@@ -198,6 +212,7 @@ Timer timer5;
 
 bool fNoMemoryFrees = false;
 int numGlobalsOnHeap = 0;
+Vec<const char*> profiledCallSites;
 bool preserveInlinedLineNumbers = false;
 
 const char* compileCommand = NULL;
@@ -588,6 +603,7 @@ static void setFastFlag(const ArgumentState* state, const char* unused) {
   //
   fBaseline = false;
   fieeefloat = false;
+  fNoCoalesceWideAccesses = false;
   fNoCopyPropagation = false;
   fNoDeadCodeElimination = false;
   fNoFastFollowers = false;
@@ -601,12 +617,14 @@ static void setFastFlag(const ArgumentState* state, const char* unused) {
   fNoScalarReplacement = false;
   fNoTupleCopyOpt = false;
   fNoPrivatization = false;
+  fNoVectorize = false;
   fNoChecks = true;
   fNoBoundsChecks = true;
   fNoLocalChecks = true;
   fNoNilChecks = true;
   fNoStackChecks = true;
   fNoOptimizeOnClauses = false;
+  fNoBatchOnClauses = false;
   optimizeCCode = true;
   specializeCCode = true;
 }
@@ -616,6 +634,7 @@ static void setBaselineFlag(const ArgumentState* state, const char* unused) {
   // disable all chapel compiler optimizations
   //
   fBaseline = true;
+  fNoCoalesceWideAccesses = true;
   fNoCopyPropagation = true;
   fNoDeadCodeElimination = true;
   fNoFastFollowers = true;
@@ -630,6 +649,8 @@ static void setBaselineFlag(const ArgumentState* state, const char* unused) {
   fNoTupleCopyOpt = true;
   fNoPrivatization = true;
   fNoOptimizeOnClauses = true;
+  fNoBatchOnClauses = true;
+  fNoVectorize = true;
   fConditionalDynamicDispatchLimit = 0;
 }
 
@@ -710,7 +731,9 @@ static ArgumentDescription arg_desc[] = {
 
  {"", ' ', NULL, "Optimization Control Options", NULL, NULL, NULL, NULL},
  {"baseline", ' ', NULL, "Disable all Chapel optimizations", "F", &fBaseline, "CHPL_BASELINE", setBaselineFlag},
+ {"batch-on-clauses", ' ', NULL, "Enable [disable] batching of fast on clauses in forall loops", "n", &fNoBatchOnClauses, "CHPL_DISABLE_BATCH_ON_CLAUSES", NULL},
  {"cache-remote", ' ', NULL, "Enable cache for remote data (must be enabled specifically)", "F", &fCacheRemote, "CHPL_CACHE_REMOTE", setCacheEnable},
+ {"comm-prefetch-distance", ' ', "<distance>", "Prefetch remote array reads in loops <distance> iterations ahead", "I", &comm_prefetch_distance, "CHPL_COMM_PREFETCH_DISTANCE", NULL},
  {"conditional-dynamic-dispatch-limit", ' ', "<limit>", "Set limit on # of inline conditionals used for dynamic dispatch", "I", &fConditionalDynamicDispatchLimit, "CHPL_CONDITIONAL_DYNAMIC_DISPATCH_LIMIT", NULL},
  {"copy-propagation", ' ', NULL, "Enable [disable] copy propagation", "n", &fNoCopyPropagation, "CHPL_DISABLE_COPY_PROPAGATION", NULL},
  {"dead-code-elimination", ' ', NULL, "Enable [disable] dead code elimination", "n", &fNoDeadCodeElimination, "CHPL_DISABLE_DEAD_CODE_ELIMINATION", NULL},
@@ -725,12 +748,15 @@ static ArgumentDescription arg_desc[] = {
  {"optimize-on-clauses", ' ', NULL, "Enable [disable] optimization of on clauses", "n", &fNoOptimizeOnClauses, "CHPL_DISABLE_OPTIMIZE_ON_CLAUSES", NULL},
  {"optimize-on-clause-limit", ' ', "<limit>", "Limit recursion depth of on clause optimization search", "I", &optimize_on_clause_limit, "CHPL_OPTIMIZE_ON_CLAUSE_LIMIT", NULL},
  {"privatization", ' ', NULL, "Enable [disable] privatization of distributed arrays and domains", "n", &fNoPrivatization, "CHPL_DISABLE_PRIVATIZATION", NULL},
+ {"profile-generate", ' ', NULL, "Count how often each call site runs, for --profile-use", "F", &fProfileGenerate, "CHPL_PROFILE_GENERATE", NULL},
+ {"profile-use", ' ', "<prefix>", "Inline hot call sites using the counts in <prefix>.<locale>", "P", profileUsePrefix, "CHPL_PROFILE_USE", NULL},
  {"remove-copy-calls", ' ', NULL, "Enable [disable] remove copy calls", "n", &fNoRemoveCopyCalls, "CHPL_DISABLE_REMOVE_COPY_CALLS", NULL},
  {"remote-value-forwarding", ' ', NULL, "Enable [disable] remote value forwarding", "n", &fNoRemoteValueForwarding, "CHPL_DISABLE_REMOTE_VALUE_FORWARDING", NULL},
  {"scalar-replacement", ' ', NULL, "Enable [disable] scalar replacement", "n", &fNoScalarReplacement, "CHPL_DISABLE_SCALAR_REPLACEMENT", NULL},
  {"scalar-replace-limit", ' ', "<limit>", "Limit on the size of tuples being replaced during scalar replacement", "I", &scalar_replace_limit, "CHPL_SCALAR_REPLACE_TUPLE_LIMIT", NULL},
  {"tuple-copy-opt", ' ', NULL, "Enable [disable] tuple (memcpy) optimization", "n", &fNoTupleCopyOpt, "CHPL_DISABLE_TUPLE_COPY_OPT", NULL},
  {"tuple-copy-limit", ' ', "<limit>", "Limit on the size of tuples considered for optimization", "I", &tuple_copy_limit, "CHPL_TUPLE_COPY_LIMIT", NULL},
+ {"vectorize", ' ', NULL, "Enable [disable] vectorization hints on order-independent loops", "n", &fNoVectorize, "CHPL_DISABLE_VECTORIZATION", NULL},
  
  {"", ' ', NULL, "Run-time Semantic Check Options", NULL, NULL, NULL, NULL},
  {"no-checks", ' ', NULL, "Disable all following run-time checks", "F", &fNoChecks, "CHPL_NO_CHECKS", turnOffChecks},
@@ -823,17 +849,26 @@ static ArgumentDescription arg_desc[] = {
  {"print-dispatch", ' ', NULL, "Print dynamic dispatch table", "F", &fPrintDispatch, NULL, NULL},
  {"print-statistics", ' ', "[n|k|t]", "Print AST statistics", "S256", fPrintStatistics, NULL, NULL},
  {"report-inlining", ' ', NULL, "Print inlined functions", "F", &report_inlining, NULL, NULL},
+ {"report-batched-on-clauses", ' ', NULL, "Print forall loops whose fast on clauses are forked in batches", "F", &fReportBatchedOnClauses, NULL, NULL},
+ {"report-coalesced-wide-accesses", ' ', NULL, "Print runs of remote field accesses merged into one transfer", "F", &fReportCoalescedWideAccesses, NULL, NULL},
+ {"report-comm-prefetch", ' ', NULL, "Print loops with remote array reads prefetched ahead", "F", &fReportCommPrefetch, NULL, NULL},
  {"report-dead-blocks", ' ', NULL, "Print dead block removal stats", "F", &fReportDeadBlocks, NULL, NULL},
  {"report-dead-modules", ' ', NULL, "Print dead module removal stats", "F", &fReportDeadModules, NULL, NULL},
+ {"report-heap-promotion", ' ', NULL, "Print variables moved to the heap so tasks can share them, and why", "F", &fReportHeapPromotion, NULL, NULL},
  {"report-optimized-loop-iterators", ' ', NULL, "Print stats on optimized single loop iterators", "F", &fReportOptimizedLoopIterators, NULL, NULL},
  {"report-optimized-on", ' ', NULL, "Print information about on clauses that have been optimized for potential fast remote fork operation", "F", &fReportOptimizedOn, NULL, NULL},
+ {"report-profile-inlining", ' ', NULL, "Print call sites inlined because the profile found them hot", "F", &fReportProfileInlining, NULL, NULL},
  {"report-promotion", ' ', NULL, "Print information about scalar promotion", "F", &fReportPromotion, NULL, NULL},
  {"report-scalar-replace", ' ', NULL, "Print scalar replacement stats", "F", &fReportScalarReplace, NULL, NULL},
+ {"report-uninlined-iterators", ' ', NULL, "Print loops whose iterators are not inlined, and why", "F", &fReportUninlinedIterators, NULL, NULL},
+ {"report-unscalarized-tuples", ' ', NULL, "Print tuples that scalar replacement could not break up, and why", "F", &fReportUnscalarizedTuples, NULL, NULL},
+ {"report-vectorized-loops", ' ', NULL, "Print loops given vectorization hints", "F", &fReportVectorizedLoops, NULL, NULL},
 
  {"", ' ', NULL, "Developer Flags -- Miscellaneous", NULL, NULL, NULL, NULL},
  {"break-on-id", ' ', NULL, "Break when AST id is created", "I", &breakOnID, "CHPL_BREAK_ON_ID", NULL},
  {"break-on-delete-id", ' ', NULL, "Break when AST id is deleted", "I", &breakOnDeleteID, "CHPL_BREAK_ON_DELETE_ID", NULL},
  {"break-on-codegen", ' ', NULL, "Break when function cname is code generated", "S256", &breakOnCodegenCname, "CHPL_BREAK_ON_CODEGEN", NULL},
+ {"coalesce-wide-accesses", ' ', NULL, "Enable [disable] coalescing of remote field accesses", "n", &fNoCoalesceWideAccesses, "CHPL_DISABLE_COALESCE_WIDE_ACCESSES", NULL},
  {"default-dist", ' ', "<distribution>", "Change the default distribution", "S256", defaultDist, "CHPL_DEFAULT_DIST", NULL},
  {"explain-call-id", ' ', "<call-id>", "Explain resolution of call by ID", "I", &explainCallID, NULL, NULL},
  {"gdb", ' ', NULL, "Run compiler in gdb", "F", &rungdb, NULL, NULL},
@@ -75,9 +75,12 @@ struct PassInfo {
 #define LOG_returnStarTuplesByRefArgs          's'
 #define LOG_insertWideReferences               'W'
 #define LOG_narrowWideReferences               'a'
+#define LOG_coalesceWideAccesses               'k'
+#define LOG_insertCommPrefetches               'h'
 #define LOG_optimizeOnClauses                  'o'
 #define LOG_addInitCalls                       'M'
 #define LOG_insertLineNumbers                  'n'
+#define LOG_batchOnClauses                     'f'
 #define LOG_codegen                            'E'
 #define LOG_makeBinary                         NUL
 
@@ -145,11 +148,14 @@ static PassInfo sPassList[] = {
 
   RUN(insertWideReferences),    // inserts wide references for on clauses
   RUN(narrowWideReferences),    // narrows wide references where possible
+  RUN(coalesceWideAccesses),    // merge runs of remote field accesses
+  RUN(insertCommPrefetches),    // prefetch remote array reads in loops
   RUN(optimizeOnClauses),       // Optimize on clauses
   RUN(addInitCalls),            // Add module init calls and guards.
 
   // AST to C or LLVM
   RUN(insertLineNumbers),       // insert line numbers for error messages
+  RUN(batchOnClauses),          // batch the forks of fast on clauses in loops
   RUN(codegen),                 // generate C code
   RUN(makeBinary)               // invoke underlying C compiler
 };
@@ -0,0 +1,309 @@
+/*
+ * Copyright 2004-2014 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// batchOnClauses
+//
+// A forall whose body is an "on" statement forks once per iteration,
+// and for a small on-body the cost of the fork dominates.  When the on
+// has been found to be fast (see optimizeOnClauses) and is the last
+// thing an iteration does, nothing in the loop waits for it, so it may
+// be deferred until the loop ends.  This pass turns
+//
+//   for ... {                            // order independent
+//     ...
+//     wrapon_fn(loc, args)
+//     TASK_ARGS_FREE args
+//   }
+//
+// into
+//
+//   batch = ON_BATCH_CREATE chpl_on_batch_runner
+//   for ... {
+//     ...
+//     ON_BATCH_ADD batch wrapon_fn loc args
+//     TASK_ARGS_FREE args
+//   }
+//   ON_BATCH_FINISH batch
+//
+// The runtime (chpl-comm-on-batch.h) copies the argument bundles of
+// consecutive iterations that target the same locale into one buffer
+// and forks chpl_on_batch_runner once to run all of them there.
+//
+// Only the order independent loops that iterator lowering builds for
+// forall followers are batched, since the on-bodies of a serial loop
+// must complete in order.  This pass runs after insertLineNumbers,
+// which rewrites the calls of on-body wrappers.
+//
+
+#include "astutil.h"
+#include "CForLoop.h"
+#include "driver.h"
+#include "expr.h"
+#include "passes.h"
+#include "stmt.h"
+#include "symbol.h"
+
+#include <vector>
+
+
+static FnSymbol* batchRunner = NULL;
+
+
+//
+// Is 'stmt' a blocking call of a fast on-body wrapper?
+//
+static CallExpr*
+isFastOnCall(Expr* stmt) {
+  CallExpr* call = toCallExpr(stmt);
+
+  if (call == NULL)
+    return NULL;
+
+  FnSymbol* fn = call->isResolved();
+
+  if (fn == NULL || !fn->hasFlag(FLAG_ON_BLOCK) ||
+      !fn->hasFlag(FLAG_FAST_ON) || fn->hasFlag(FLAG_NON_BLOCKING))
+    return NULL;
+
+  return call;
+}
+
+
+//
+// May 'stmt' follow the on in the same iteration?  Freeing the argument
+// bundle and stepping the iterator do not look at what the on did.
+//
+static bool
+isIgnorableAfterOn(Expr* stmt, Symbol* bundle) {
+  if (DefExpr* def = toDefExpr(stmt))
+    return isLabelSymbol(def->sym);
+
+  if (BlockStmt* block = toBlockStmt(stmt))
+    return block->body.length == 0 && block->blockInfoGet() == NULL;
+
+  if (CallExpr* call = toCallExpr(stmt)) {
+    if (call->isPrimitive(PRIM_TASK_ARGS_FREE)) {
+      SymExpr* se = toSymExpr(call->get(1));
+      return se && se->var == bundle;
+    }
+
+    if (FnSymbol* fn = call->isResolved())
+      return fn->hasFlag(FLAG_AUTO_II) && !strcmp(fn->name, "advance");
+  }
+
+  return false;
+}
+
+
+static bool
+isInLoop(CForLoop* loop, Expr* expr) {
+  for (Expr* parent = expr->parentExpr; parent; parent = parent->parentExpr)
+    if (parent == loop)
+      return true;
+
+  return false;
+}
+
+
+//
+// Could the bundle of a deferred on point at a variable of the
+// iteration that filled it?  References stored in the bundle must be
+// to variables declared outside the loop.
+//
+static bool
+hasLoopLocalRef(CForLoop* loop, CallExpr* onCall, Symbol* bundle) {
+  for (Expr* stmt = onCall->prev; stmt; stmt = stmt->prev) {
+    CallExpr* call = toCallExpr(stmt);
+
+    if (call == NULL || !call->isPrimitive(PRIM_SET_MEMBER))
+      continue;
+
+    SymExpr* base = toSymExpr(call->get(1));
+    SymExpr* value = toSymExpr(call->get(3));
+
+    if (base == NULL || base->var != bundle)
+      continue;
+
+    if (value == NULL)
+      return true;
+
+    Type* type = value->var->type;
+
+    if ((type->symbol->hasFlag(FLAG_REF) ||
+         type->symbol->hasFlag(FLAG_WIDE_REF)) &&
+        isInLoop(loop, value->var->defPoint))
+      return true;
+  }
+
+  return false;
+}
+
+
+//
+// Does any goto in the loop leave it?  The batch must be finished on
+// every way out.
+//
+static bool
+hasGotoOut(CForLoop* loop) {
+  std::vector<GotoStmt*> gotos;
+
+  collectGotoStmtsSTL(loop, gotos);
+
+  for (size_t i = 0; i < gotos.size(); i++) {
+    SymExpr* label = toSymExpr(gotos[i]->label);
+
+    if (label == NULL || !isInLoop(loop, label->var->defPoint))
+      return true;
+  }
+
+  return false;
+}
+
+
+//
+// Return the on-body call that may be batched in 'loop', or NULL.
+//
+static CallExpr*
+findBatchableOn(CForLoop* loop) {
+  if (!loop->isOrderIndependent())
+    return NULL;
+
+  CallExpr* onCall = NULL;
+
+  for_alist(stmt, loop->body) {
+    if (CallExpr* call = isFastOnCall(stmt)) {
+      if (onCall != NULL)
+        return NULL;
+      onCall = call;
+    }
+  }
+
+  if (onCall == NULL)
+    return NULL;
+
+  SymExpr* bundle = toSymExpr(onCall->get(2));
+
+  if (bundle == NULL)
+    return NULL;
+
+  for (Expr* stmt = onCall->next; stmt; stmt = stmt->next)
+    if (!isIgnorableAfterOn(stmt, bundle->var))
+      return NULL;
+
+  if (hasLoopLocalRef(loop, onCall, bundle->var) || hasGotoOut(loop))
+    return NULL;
+
+  return onCall;
+}
+
+
+//
+// The target of every batched fork.  Like an on-body wrapper, it takes
+// a locale argument that is not code generated, so it gets a place in
+// the function table.
+//
+static FnSymbol*
+getBatchRunner() {
+  if (batchRunner != NULL)
+    return batchRunner;
+
+  SET_LINENO(theProgram);
+
+  batchRunner = new FnSymbol("chpl_on_batch_runner");
+  batchRunner->addFlag(FLAG_ON_BLOCK);
+  batchRunner->addFlag(FLAG_FAST_ON);
+  batchRunner->addFlag(FLAG_COMPILER_GENERATED);
+  batchRunner->retType = dtVoid;
+
+  ArgSymbol* locale = new ArgSymbol(INTENT_CONST_IN, "dummy_locale_arg",
+                                    dtLocaleID);
+  ArgSymbol* buf = new ArgSymbol(INTENT_CONST_IN, "buf", dtOpaque);
+  batchRunner->insertFormalAtTail(locale);
+  batchRunner->insertFormalAtTail(buf);
+
+  batchRunner->insertAtTail(new CallExpr(PRIM_ON_BATCH_RUN, buf));
+  batchRunner->insertAtTail(new CallExpr(PRIM_RETURN, gVoid));
+
+  theProgram->block->insertAtTail(new DefExpr(batchRunner));
+
+  return batchRunner;
+}
+
+
+static void
+reportBatchedOn(CForLoop* loop) {
+  FnSymbol* fn = toFnSymbol(loop->parentSymbol);
+  ModuleSymbol* mod = fn->getModule();
+
+  if (!developer && (mod->modTag == MOD_INTERNAL ||
+                     mod->modTag == MOD_STANDARD))
+    return;
+
+  printf("Batching on clause forks of loop in %s (%s:%d)\n",
+         fn->name, loop->fname(), loop->linenum());
+}
+
+
+static void
+batchLoopOnClauses(CForLoop* loop, CallExpr* onCall) {
+  SET_LINENO(loop);
+
+  FnSymbol* onFn = onCall->isResolved();
+  VarSymbol* batch = newTemp("on_batch", dtOpaque);
+
+  loop->insertBefore(new DefExpr(batch));
+  loop->insertBefore(new CallExpr(PRIM_MOVE, batch,
+                       new CallExpr(PRIM_ON_BATCH_CREATE, getBatchRunner())));
+
+  Expr* locale = onCall->get(1)->remove();
+  Expr* bundle = onCall->get(1)->remove();
+  onCall->replace(new CallExpr(PRIM_ON_BATCH_ADD, batch, onFn,
+                               locale, bundle));
+
+  loop->insertAfter(new CallExpr(PRIM_ON_BATCH_FINISH, batch));
+
+  if (fReportBatchedOnClauses)
+    reportBatchedOn(loop);
+}
+
+
+void
+batchOnClauses() {
+  if (!requireWideReferences() || fNoBatchOnClauses)
+    return;
+
+  // Find the loops first, since the batch runner adds blocks.
+  std::vector<CForLoop*> loops;
+  std::vector<CallExpr*> onCalls;
+
+  forv_Vec(BlockStmt, block, gBlockStmts) {
+    if (block->parentSymbol && block->isCForLoop()) {
+      CForLoop* loop = toCForLoop(block);
+
+      if (CallExpr* onCall = findBatchableOn(loop)) {
+        loops.push_back(loop);
+        onCalls.push_back(onCall);
+      }
+    }
+  }
+
+  for (size_t i = 0; i < loops.size(); i++)
+    batchLoopOnClauses(loops[i], onCalls[i]);
+}
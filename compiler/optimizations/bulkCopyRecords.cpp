@@ -24,6 +24,7 @@
 //
 #include "passes.h" // For global declaration of the main routine.
 
+#include "optimizations.h"
 #include "stmt.h"
 #include "astutil.h"
 #include "stlUtil.h"
@@ -150,6 +151,9 @@ static bool isTrivialAssignment(FnSymbol* fn, FnSet& visited)
 // (PRIM_ASSIGN) operation.  In the generated code, PRIM_ASSIGN on a type that
 // is represented by a C struct will be rendered as a struct assignment, which
 // the C compiler can implement as a memcpy.
+// For the small POD records that scalarReplace splits into their fields, the
+// replaced function is also marked for inlining; a call to it would otherwise
+// take the record's address and keep it from being split.
 static void replaceSimpleAssignment(FnSymbol* fn)
 {
   SET_LINENO(fn);
@@ -159,6 +163,9 @@ static void replaceSimpleAssignment(FnSymbol* fn)
   block->insertAtTail(new CallExpr(PRIM_ASSIGN, lhs, rhs));
   block->insertAtTail(new CallExpr(PRIM_RETURN, gVoid));
   fn->body->replace(block);
+  if (!fNoScalarReplacement &&
+      isSmallPODAggregate(fn->getFormal(1)->type->getValType()))
+    fn->addFlag(FLAG_INLINE);
 }
 
 
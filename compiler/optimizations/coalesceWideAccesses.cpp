@@ -0,0 +1,572 @@
+/*
+ * Copyright 2004-2014 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// coalesceWideAccesses
+//
+// The C backend turns every read or write of a field through a wide
+// class or wide record reference into its own chpl_comm_get or
+// chpl_comm_put.  This pass finds runs of such accesses to a single
+// remote object within a block and replaces each run with one bulk
+// transfer of the span of fields it touches, moving the values through
+// local temporaries.  (With --llvm-wide-opt, the LLVM backend merges
+// these accesses itself in llvmAggregateGlobalOps.)
+//
+// A read run may be interleaved with statements that do not write
+// memory visible to other statements in the run (local moves,
+// arithmetic, address computations, other reads); the reads are all
+// satisfied by a single GET issued where the first one was.  A write
+// run may additionally be interleaved with reads of fields of other
+// types; the writes are buffered in temporaries and issued as a single
+// PUT where the last one was.
+//
+
+#include "astutil.h"
+#include "driver.h"
+#include "expr.h"
+#include "optimizations.h"
+#include "passes.h"
+#include "stmt.h"
+#include "stringutil.h"
+#include "symbol.h"
+
+#include <vector>
+
+//
+// A single field access through a wide base.  For reads, 'value' is
+// the symbol the field is moved into; for writes, it is the value
+// stored.  The key identifies the remote object: it is the base
+// itself, or, when the base is a local loaded from keySym.keyField,
+// that field access, so that repeated loads of the same object into
+// fresh temps compare equal.
+//
+struct WideAccess {
+  CallExpr*      stmt;
+  bool           isWrite;
+  Symbol*        base;
+  Symbol*        ref;     // for writes through a field reference
+  AggregateType* ct;
+  Symbol*        field;
+  Symbol*        value;
+  Symbol*        keySym;
+  Symbol*        keyField;
+  PrimitiveTag   keyTag;
+};
+
+typedef Map<Symbol*,Vec<SymExpr*>*> SymbolToVecSymExprMap;
+
+static SymbolToVecSymExprMap defMap;
+static SymbolToVecSymExprMap useMap;
+
+
+//
+// Return the one move that defines the local sym, or NULL if sym is
+// otherwise defined.  Assignments through a reference do not rebind it.
+//
+static CallExpr*
+findSingleMoveDef(Symbol* sym) {
+  CallExpr* ret = NULL;
+  if (!isVarSymbol(sym) || !isFnSymbol(sym->defPoint->parentSymbol))
+    return NULL;
+  for_defs(se, defMap, sym) {
+    CallExpr* call = toCallExpr(se->parentExpr);
+    if (call && call->isPrimitive(PRIM_MOVE)) {
+      if (ret)
+        return NULL;
+      ret = call;
+    } else if (!call || !call->isPrimitive(PRIM_ASSIGN) ||
+               !sym->type->symbol->hasEitherFlag(FLAG_REF, FLAG_WIDE_REF)) {
+      return NULL;
+    }
+  }
+  return ret;
+}
+
+
+//
+// Return the class or record whose fields are accessed through base,
+// or NULL if base is not a wide class or a wide reference to a record
+// that this pass handles.
+//
+static AggregateType*
+getWideBaseType(Symbol* base) {
+  Type* type = base->type;
+  AggregateType* ct = NULL;
+
+  if (isWideString(type))
+    return NULL;
+
+  if (type->symbol->hasFlag(FLAG_WIDE_CLASS)) {
+    ct = toAggregateType(type->getField("addr")->type);
+  } else if (type->symbol->hasFlag(FLAG_WIDE_REF)) {
+    ct = toAggregateType(type->getField("addr")->type->getValType());
+    if (ct && (!isRecord(ct) ||
+               isWideString(ct) ||
+               ct->symbol->hasEitherFlag(FLAG_WIDE_CLASS, FLAG_WIDE_REF)))
+      return NULL;
+  }
+
+  if (!ct ||
+      isUnion(ct) ||
+      ct->symbol->hasFlag(FLAG_EXTERN) ||
+      ct->symbol->hasFlag(FLAG_DATA_CLASS))
+    return NULL;
+
+  return ct;
+}
+
+
+static bool
+isCoalescableField(AggregateType* ct, Symbol* field) {
+  return field->defPoint->parentSymbol == ct->symbol &&
+         !field->hasFlag(FLAG_SUPER_CLASS) &&
+         !isWideString(field->type);
+}
+
+
+static int
+getFieldIndex(AggregateType* ct, Symbol* field) {
+  int i = 0;
+  for_fields(fld, ct) {
+    if (fld == field)
+      return i;
+    i++;
+  }
+  INT_FATAL(field, "field not found in coalesceWideAccesses");
+  return -1;
+}
+
+
+static void
+computeKey(WideAccess& access) {
+  access.keySym = access.base;
+  access.keyField = NULL;
+  access.keyTag = PRIM_UNKNOWN;
+
+  if (CallExpr* move = findSingleMoveDef(access.base)) {
+    CallExpr* rhs = toCallExpr(move->get(2));
+    if (rhs && (rhs->isPrimitive(PRIM_GET_MEMBER) ||
+                rhs->isPrimitive(PRIM_GET_MEMBER_VALUE))) {
+      SymExpr* obj = toSymExpr(rhs->get(1));
+      SymExpr* field = toSymExpr(rhs->get(2));
+      if (obj && field) {
+        access.keySym = obj->var;
+        access.keyField = field->var;
+        access.keyTag = rhs->primitive->tag;
+      }
+    }
+  }
+}
+
+
+//
+// Recognize the three forms of remote field access left after
+// insertWideReferences:
+//
+//   move value (GET_MEMBER_VALUE base field)
+//   SET_MEMBER base field value
+//   ASSIGN ref value, where ref is defined by (GET_MEMBER base field)
+//
+static bool
+isWideAccess(Expr* stmt, WideAccess& access) {
+  CallExpr* call = toCallExpr(stmt);
+  SymExpr* base = NULL;
+  SymExpr* field = NULL;
+  SymExpr* value = NULL;
+
+  if (!call)
+    return false;
+
+  access.stmt = call;
+  access.ref = NULL;
+
+  if (call->isPrimitive(PRIM_MOVE)) {
+    CallExpr* rhs = toCallExpr(call->get(2));
+    if (!rhs || !rhs->isPrimitive(PRIM_GET_MEMBER_VALUE))
+      return false;
+    access.isWrite = false;
+    value = toSymExpr(call->get(1));
+    base = toSymExpr(rhs->get(1));
+    field = toSymExpr(rhs->get(2));
+  } else if (call->isPrimitive(PRIM_SET_MEMBER)) {
+    access.isWrite = true;
+    base = toSymExpr(call->get(1));
+    field = toSymExpr(call->get(2));
+    value = toSymExpr(call->get(3));
+  } else if (call->isPrimitive(PRIM_ASSIGN)) {
+    SymExpr* ref = toSymExpr(call->get(1));
+    if (!ref || !ref->var->type->symbol->hasFlag(FLAG_WIDE_REF))
+      return false;
+    CallExpr* move = findSingleMoveDef(ref->var);
+    if (!move)
+      return false;
+    CallExpr* rhs = toCallExpr(move->get(2));
+    if (!rhs || !rhs->isPrimitive(PRIM_GET_MEMBER))
+      return false;
+    access.isWrite = true;
+    access.ref = ref->var;
+    base = toSymExpr(rhs->get(1));
+    field = toSymExpr(rhs->get(2));
+    value = toSymExpr(call->get(2));
+  } else {
+    return false;
+  }
+
+  if (!base || !field || !value)
+    return false;
+
+  access.base = base->var;
+  access.field = field->var;
+  access.value = value->var;
+
+  access.ct = getWideBaseType(access.base);
+  if (!access.ct || !isCoalescableField(access.ct, access.field))
+    return false;
+
+  if (access.value->type != access.field->type)
+    return false;
+
+  computeKey(access);
+  return true;
+}
+
+
+static bool
+isSameObject(WideAccess& a, WideAccess& b) {
+  return a.ct == b.ct &&
+         a.keySym == b.keySym &&
+         a.keyField == b.keyField &&
+         a.keyTag == b.keyTag;
+}
+
+
+//
+// Can stmt be moved across by the accesses in run?  It must not call
+// anything, store through a reference, or redefine the symbol the
+// run's object is reached from.  Within a write run, it also must not
+// read any field of the type being written.
+//
+static bool
+isNeutralStmt(Expr* stmt, WideAccess& first) {
+  if (isDefExpr(stmt))
+    return true;
+
+  CallExpr* call = toCallExpr(stmt);
+  if (!call)
+    return false;
+
+  if (call->isPrimitive(PRIM_CHECK_NIL))
+    return true;
+
+  if (!call->isPrimitive(PRIM_MOVE))
+    return false;
+
+  SymExpr* lhs = toSymExpr(call->get(1));
+  if (!lhs || lhs->var == first.keySym)
+    return false;
+
+  bool lhsIsRef = lhs->var->type->symbol->hasEitherFlag(FLAG_REF,
+                                                        FLAG_WIDE_REF);
+
+  if (SymExpr* rhs = toSymExpr(call->get(2)))
+    return !lhsIsRef || rhs->var->type == lhs->var->type;
+
+  CallExpr* rhs = toCallExpr(call->get(2));
+  if (!rhs || !rhs->primitive)
+    return false;
+
+  switch (rhs->primitive->tag) {
+  case PRIM_GET_MEMBER:
+  case PRIM_GET_SVEC_MEMBER:
+  case PRIM_ADDR_OF:
+    // address computations only
+    return true;
+
+  case PRIM_GET_MEMBER_VALUE:
+    if (first.isWrite) {
+      //
+      // Only scalar fields of a class object can be read; the buffered
+      // writes may not alias them unless the field is of the type
+      // being written.
+      //
+      Type* baseType = rhs->get(1)->typeInfo();
+      SymExpr* field = toSymExpr(rhs->get(2));
+      if (!field ||
+          !(isClass(baseType) || baseType->symbol->hasFlag(FLAG_WIDE_CLASS)) ||
+          field->var->defPoint->parentSymbol == first.ct->symbol ||
+          (isRecord(field->var->type) &&
+           !field->var->type->symbol->hasFlag(FLAG_WIDE_CLASS)) ||
+          isUnion(field->var->type))
+        return false;
+    }
+    return !lhsIsRef;
+
+  case PRIM_GET_SVEC_MEMBER_VALUE:
+  case PRIM_DEREF:
+    return !first.isWrite && !lhsIsRef;
+
+  case PRIM_UNARY_MINUS:
+  case PRIM_UNARY_PLUS:
+  case PRIM_UNARY_NOT:
+  case PRIM_UNARY_LNOT:
+  case PRIM_ADD:
+  case PRIM_SUBTRACT:
+  case PRIM_MULT:
+  case PRIM_DIV:
+  case PRIM_MOD:
+  case PRIM_LSH:
+  case PRIM_RSH:
+  case PRIM_EQUAL:
+  case PRIM_NOTEQUAL:
+  case PRIM_LESSOREQUAL:
+  case PRIM_GREATEROREQUAL:
+  case PRIM_LESS:
+  case PRIM_GREATER:
+  case PRIM_AND:
+  case PRIM_OR:
+  case PRIM_XOR:
+  case PRIM_POW:
+  case PRIM_MIN:
+  case PRIM_MAX:
+  case PRIM_CAST:
+    return !lhsIsRef;
+
+  default:
+    return false;
+  }
+}
+
+
+//
+// Remove the definition of a local whose only uses were rewritten
+// away.  The bulk transfer's base is never passed here since its use
+// is not in useMap.
+//
+static void
+removeDeadLocal(Symbol* sym) {
+  if (!isVarSymbol(sym) ||
+      !sym->defPoint->parentSymbol ||
+      !isFnSymbol(sym->defPoint->parentSymbol))
+    return;
+
+  for_uses(se, useMap, sym) {
+    if (se->parentSymbol)
+      return;
+  }
+
+  CallExpr* move = NULL;
+  for_defs(se, defMap, sym) {
+    if (se->parentSymbol) {
+      CallExpr* call = toCallExpr(se->parentExpr);
+      if (move || !call || !call->isPrimitive(PRIM_MOVE))
+        return;
+      move = call;
+    }
+  }
+
+  if (move) {
+    CallExpr* rhs = toCallExpr(move->get(2));
+    if (!rhs || !(rhs->isPrimitive(PRIM_GET_MEMBER) ||
+                  rhs->isPrimitive(PRIM_GET_MEMBER_VALUE)))
+      return;
+    move->remove();
+  }
+  sym->defPoint->remove();
+}
+
+
+static void
+reportCoalesced(std::vector<WideAccess>& run, Vec<Symbol*>& fields) {
+  WideAccess& first = run.front();
+  FnSymbol* fn = toFnSymbol(first.stmt->parentSymbol);
+  ModuleSymbol* mod = fn->getModule();
+
+  if (!developer && (mod->modTag == MOD_INTERNAL ||
+                     mod->modTag == MOD_STANDARD))
+    return;
+
+  const char* names = "";
+  forv_Vec(Symbol, field, fields) {
+    names = astr(names, " ", field->name);
+  }
+  printf("Coalesced %d remote %s of %s in %s (%s:%d):%s\n",
+         (int)run.size(), first.isWrite ? "writes" : "reads",
+         first.ct->symbol->name, fn->name,
+         first.stmt->fname(), first.stmt->linenum(), names);
+}
+
+
+static void
+coalesceRun(std::vector<WideAccess>& run) {
+  if (run.size() < 2)
+    return;
+
+  WideAccess& first = run.front();
+  WideAccess& last = run.back();
+  AggregateType* ct = first.ct;
+
+  //
+  // Collect the distinct fields touched, in declaration order.
+  //
+  int minIndex = -1, maxIndex = -1;
+  Vec<Symbol*> fieldSet;
+  for (size_t i = 0; i < run.size(); i++) {
+    int index = getFieldIndex(ct, run[i].field);
+    if (minIndex == -1 || index < minIndex) minIndex = index;
+    if (maxIndex == -1 || index > maxIndex) maxIndex = index;
+    fieldSet.set_add(run[i].field);
+  }
+  Vec<Symbol*> fields;
+  for_fields(field, ct) {
+    if (fieldSet.set_in(field))
+      fields.add(field);
+  }
+  int span = maxIndex - minIndex + 1;
+
+  if (first.isWrite) {
+    //
+    // Only the written fields may be stored, so they must be adjacent.
+    // Writing the field the object was loaded from could change the
+    // object the later writes refer to.
+    //
+    if (span != fields.n)
+      return;
+    if (first.keyField && first.keyField->defPoint->parentSymbol == ct->symbol)
+      return;
+  } else {
+    //
+    // Don't drag in a large object to read a few fields from its ends.
+    //
+    if (span > 2 * fields.n)
+      return;
+  }
+
+  if (fReportCoalescedWideAccesses)
+    reportCoalesced(run, fields);
+
+  SET_LINENO(first.stmt);
+
+  Map<Symbol*,Symbol*> tmpMap;
+  forv_Vec(Symbol, field, fields) {
+    VarSymbol* tmp = newTemp(astr("coalesce_", field->name), field->type);
+    first.stmt->insertBefore(new DefExpr(tmp));
+    tmpMap.put(field, tmp);
+  }
+
+  CallExpr* bulk = new CallExpr(first.isWrite ?
+                                PRIM_CHPL_COMM_PUT_FIELDS :
+                                PRIM_CHPL_COMM_GET_FIELDS,
+                                first.isWrite ? last.base : first.base);
+  forv_Vec(Symbol, field, fields) {
+    bulk->insertAtTail(field);
+    bulk->insertAtTail(tmpMap.get(field));
+  }
+
+  if (first.isWrite)
+    last.stmt->insertAfter(bulk);
+  else
+    first.stmt->insertBefore(bulk);
+
+  Symbol* bulkBase = toSymExpr(bulk->get(1))->var;
+  for (size_t i = 0; i < run.size(); i++) {
+    WideAccess& access = run[i];
+    Symbol* tmp = tmpMap.get(access.field);
+    SET_LINENO(access.stmt);
+    if (access.isWrite) {
+      Expr* value = (access.ref ? access.stmt->get(2) : access.stmt->get(3));
+      access.stmt->replace(new CallExpr(PRIM_MOVE, tmp, value->remove()));
+    } else {
+      access.stmt->get(2)->replace(new SymExpr(tmp));
+    }
+  }
+
+  for (size_t i = 0; i < run.size(); i++) {
+    if (run[i].ref)
+      removeDeadLocal(run[i].ref);
+  }
+  for (size_t i = 0; i < run.size(); i++) {
+    if (run[i].base != bulkBase)
+      removeDeadLocal(run[i].base);
+  }
+}
+
+
+static void
+coalesceBlock(BlockStmt* block) {
+  std::vector<WideAccess> run;
+
+  for_alist(stmt, block->body) {
+    WideAccess access;
+    bool isAccess = isWideAccess(stmt, access);
+
+    if (!run.empty()) {
+      WideAccess& first = run.front();
+      if (isAccess &&
+          access.isWrite == first.isWrite &&
+          isSameObject(access, first)) {
+        // extends the run
+      } else if (isNeutralStmt(stmt, first)) {
+        //
+        // Step over anything that doesn't interfere with the run,
+        // including accesses to other objects, such as the loads of
+        // the object itself.
+        //
+        continue;
+      } else {
+        coalesceRun(run);
+        run.clear();
+      }
+    }
+
+    if (isAccess) {
+      run.push_back(access);
+      //
+      // A read into the symbol the object was reached from ends the
+      // run; the next access refers to a different object.
+      //
+      if (!access.isWrite && access.value == access.keySym) {
+        coalesceRun(run);
+        run.clear();
+      }
+    }
+  }
+  coalesceRun(run);
+}
+
+
+void
+coalesceWideAccesses() {
+  if (!requireWideReferences() ||
+      fNoCoalesceWideAccesses ||
+      llvmCodegen)
+    return;
+
+  forv_Vec(FnSymbol, fn, gFnSymbols) {
+    buildDefUseMaps(fn, defMap, useMap);
+
+    Vec<Expr*> stmts;
+    collect_stmts(fn->body, stmts);
+    forv_Vec(Expr, stmt, stmts) {
+      if (BlockStmt* block = toBlockStmt(stmt))
+        coalesceBlock(block);
+    }
+
+    freeDefUseMaps(defMap, useMap);
+  }
+}
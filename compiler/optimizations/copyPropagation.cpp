@@ -159,6 +159,10 @@ typedef RefMap::value_type RefMapElem;
 typedef std::map<Symbol*, std::vector<Symbol*> > ReverseAvailableMap;
 typedef ReverseAvailableMap::mapped_type ReverseMapList;
 
+// PairIndexMap: symbol --> indices of the available pairs that mention it
+// Used in global copy propagation to find the pairs a definition kills.
+typedef std::map<Symbol*, std::vector<int> > PairIndexMap;
+
 
 #if DEBUG_CP
 // Set nonzero to enable verbose output.
@@ -915,6 +919,16 @@ static void computeKillSets(FnSymbol* fn,
                             std::vector<AvailablePair>& availablePairs,
                             std::vector<BitVec*>& KILL)
 {
+  // Index the pairs by the symbols they mention, so that each killed
+  // symbol visits only its own pairs rather than the whole set.
+  PairIndexMap pairsOf;
+  for (size_t j = 0; j < availablePairs.size(); ++j)
+  {
+    pairsOf[availablePairs[j].first].push_back(j);
+    if (availablePairs[j].second != availablePairs[j].first)
+      pairsOf[availablePairs[j].second].push_back(j);
+  }
+
   size_t nbbs = fn->basicBlocks->size();
   for (size_t i = 0; i < nbbs; ++i)
   {
@@ -954,10 +968,15 @@ static void computeKillSets(FnSymbol* fn,
     // Use killSet to initialize the KILL set for this block.
     // It's OK if we include the pairs from this block in KILL[i] because we
     // put them back when we add in the COPY set.
-    for (int j = 0; j < KILL[i]->size(); ++j)
-      if (killSet.find(availablePairs[j].first) != killSet.end() ||
-          killSet.find(availablePairs[j].second) != killSet.end())
-        KILL[i]->set(j);
+    for (std::set<Symbol*>::iterator sym = killSet.begin();
+         sym != killSet.end();
+         ++sym)
+    {
+      PairIndexMap::iterator pairs = pairsOf.find(*sym);
+      if (pairs != pairsOf.end())
+        for (size_t j = 0; j < pairs->second.size(); ++j)
+          KILL[i]->set(pairs->second[j]);
+    }
   }
 }
 
@@ -976,8 +995,8 @@ static void initCopySets(std::vector<BitVec*>& COPY, std::vector<size_t>& ends,
   {
     // Initialize each copy set: Just set the string of bits corresponding to
     // the pairs generated in block i.
-    while (j < ends[i])
-      COPY[i]->set(j++);
+    COPY[i]->setRange(j, ends[i]);
+    j = ends[i];
   }
 }
 
@@ -1109,18 +1128,15 @@ size_t globalCopyPropagation(FnSymbol* fn) {
     AvailableMap available;
     ReverseAvailableMap ravailable;
 
-    for (size_t j = 0; j < availablePairs.size(); ++j)
+    for (int j = IN[i]->nextSet(0); j != -1; j = IN[i]->nextSet(j + 1))
     {
-      if (IN[i]->get(j))
-      {
-        AvailablePair& ap = availablePairs[j];
-        // Two available pairs at the start of a basic block should not have
-        // the same LHS, because one should kill the other.
-        // Also, this makes arbitrary the choice of which one survives.
-        INT_ASSERT(available.find(ap.first) == available.end());
-        available.insert(ap);
-        ravailable[ap.second].push_back(ap.first);
-      }
+      AvailablePair& ap = availablePairs[j];
+      // Two available pairs at the start of a basic block should not have
+      // the same LHS, because one should kill the other.
+      // Also, this makes arbitrary the choice of which one survives.
+      INT_ASSERT(available.find(ap.first) == available.end());
+      available.insert(ap);
+      ravailable[ap.second].push_back(ap.first);
     }
 
     if (available.size() > 0)
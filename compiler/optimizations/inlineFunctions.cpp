@@ -21,13 +21,27 @@
 
 #include "astutil.h"
 #include "expr.h"
+#include "misc.h"
 #include "passes.h"
 #include "stlUtil.h"
 #include "stmt.h"
 #include "stringutil.h"
 
+#include <cerrno>
+#include <cstring>
 #include <vector>
 
+//
+// A call site is hot when it ran at least 1/profileHotFraction as often
+// as the hottest site, and is inlined if its callee makes no more than
+// profileInlineMaxSize calls, primitives included.  Calls are counted
+// rather than expressions because by then the inline operators and
+// accessors the callee uses have been inlined into it, and leave behind
+// far more temporaries, blocks, and symbol references than work.
+//
+static const unsigned long long profileHotFraction = 100;
+static const size_t profileInlineMaxSize = 128;
+
 static bool canRemoveRefTemps(FnSymbol* fn);
 static CallExpr* findRefTempInit(SymExpr* se);
 
@@ -206,6 +220,261 @@ inlineFunction(FnSymbol* fn, Vec<FnSymbol*>& inlinedSet, Vec<FnSymbol*>& canRemo
 }
 
 
+//
+// Can 'call' be counted by --profile-generate and inlined by
+// --profile-use?  The sites are numbered in the order of gCallExprs, so
+// this must give the same answer for the same program in both modes.
+//
+static bool
+isProfiledCall(CallExpr* call) {
+  FnSymbol* fn = call->isResolved();
+
+  if (fn == NULL || call->parentSymbol == NULL)
+    return false;
+
+  FnSymbol* caller = toFnSymbol(call->parentSymbol);
+
+  if (caller == NULL || caller == fn ||
+      (!fNoInline && caller->hasFlag(FLAG_INLINE)))
+    return false;
+
+  if (fn->hasFlag(FLAG_EXTERN) ||
+      fn->hasFlag(FLAG_INLINE) ||
+      fn->hasFlag(FLAG_VIRTUAL) ||
+      fn->hasFlag(FLAG_NO_CODEGEN) ||
+      fn->hasFlag(FLAG_ON_BLOCK) ||
+      fn->hasFlag(FLAG_BEGIN_BLOCK) ||
+      fn->hasFlag(FLAG_COBEGIN_OR_COFORALL_BLOCK) ||
+      fn->hasFlag(FLAG_ITERATOR_FN))
+    return false;
+
+  // scalarReplace() expects a class's allocation and free to be next
+  // to the statements that use them, so leave them uncounted.
+  if (fn->hasFlag(FLAG_ALLOCATOR) || fn->hasFlag(FLAG_LOCALE_MODEL_FREE))
+    return false;
+
+  //
+  // The call must be a statement of a block, or the value moved by one,
+  // so that the callee body can be inserted just before it.
+  //
+  Expr* stmt = call->getStmtExpr();
+
+  if (stmt != call) {
+    CallExpr* move = toCallExpr(stmt);
+
+    if (move == NULL || !move->isPrimitive(PRIM_MOVE) || move->get(2) != call)
+      return false;
+  }
+
+  BlockStmt* block = toBlockStmt(stmt->parentExpr);
+
+  if (block == NULL || stmt->list != &block->body ||
+      block->blockTag == BLOCK_C_FOR_LOOP)
+    return false;
+
+  for_actuals(actual, call) {
+    if (!isSymExpr(actual))
+      return false;
+  }
+
+  return true;
+}
+
+
+//
+// The profile records this for each site, so that a profile written by
+// a different version of the program is caught instead of misapplied.
+// Module paths are relative to $CHPL_HOME so the profile survives a
+// move of the installation.
+//
+static const char*
+callSiteFingerprint(CallExpr* call) {
+  return astr(call->isResolved()->name, " ",
+              cleanFilename(call->fname()), ":", istr(call->linenum()));
+}
+
+
+static void
+collectProfiledCalls(std::vector<CallExpr*>& sites) {
+  forv_Vec(CallExpr, call, gCallExprs) {
+    if (isProfiledCall(call))
+      sites.push_back(call);
+  }
+}
+
+
+//
+// --profile-generate: count each site just before the call is made.
+//
+static void
+instrumentCallSites(std::vector<CallExpr*>& sites) {
+  for (size_t i = 0; i < sites.size(); i++) {
+    SET_LINENO(sites[i]);
+
+    Expr* stmt = sites[i]->getStmtExpr();
+    stmt->insertBefore(new CallExpr(PRIM_CALL_PROFILE_COUNT,
+                                    new_IntSymbol(i, INT_SIZE_32)));
+    profiledCallSites.add(callSiteFingerprint(sites[i]));
+  }
+}
+
+
+//
+// Add the counts in one locale's profile (see chpl-call-prof.h) to
+// 'counts'.  Warn and return false if the profile was not written for
+// 'sites': it has a different number of sites, or a site that ran has
+// a different fingerprint because the program changed since.
+//
+static bool
+readCallProfile(FILE* file, const char* name,
+                std::vector<CallExpr*>& sites,
+                std::vector<unsigned long long>& counts) {
+  char line[FILENAME_MAX + 256];
+  bool sawSites = false;
+
+  while (fgets(line, sizeof(line), file)) {
+    size_t len = strlen(line);
+    unsigned long site, n;
+    unsigned long long count;
+    int fingerprint = 0;
+
+    if (len == 0 || line[len-1] != '\n')
+      USR_FATAL("malformed call profile '%s'", name);
+    line[len-1] = '\0';
+
+    if (line[0] == '#') {
+      continue;
+    } else if (sscanf(line, "sites %lu", &n) == 1) {
+      if (n != sites.size())
+        break;
+      sawSites = true;
+    } else if (sawSites &&
+               sscanf(line, "%lu %llu %n", &site, &count, &fingerprint) == 2 &&
+               site < sites.size()) {
+      const char* current = callSiteFingerprint(sites[site]);
+
+      if (strcmp(line + fingerprint, current) != 0) {
+        USR_WARN("call profile '%s' is out of date: site %lu was '%s' and "
+                 "is now '%s', ignoring the profile",
+                 name, site, line + fingerprint, current);
+        return false;
+      }
+      counts[site] += count;
+    } else {
+      USR_FATAL("malformed call profile '%s'", name);
+    }
+  }
+
+  if (!sawSites)
+    USR_WARN("call profile '%s' was generated for a different program, "
+             "ignoring it", name);
+  return sawSites;
+}
+
+
+//
+// localizeGlobals() copies the global constants a function reads into
+// locals at its top.  Inlined into a function that initializes modules,
+// 'fn' would read those copies before the globals were set.
+//
+static bool
+readsGlobalConst(FnSymbol* fn) {
+  std::vector<SymExpr*> symExprs;
+
+  collectSymExprsSTL(fn->body, symExprs);
+
+  for_vector(SymExpr, se, symExprs) {
+    Symbol* var = se->var;
+
+    if (var->hasFlag(FLAG_CONST) &&
+        isModuleSymbol(var->defPoint->parentSymbol) &&
+        var->defPoint->parentSymbol != rootModule)
+      return true;
+  }
+
+  return false;
+}
+
+
+static void
+reportProfileInlining(FnSymbol* fn, CallExpr* call, unsigned long long count) {
+  FnSymbol* caller = toFnSymbol(call->parentSymbol);
+  ModuleSymbol* mod = caller->getModule();
+
+  if (!developer && (mod->modTag == MOD_INTERNAL ||
+                     mod->modTag == MOD_STANDARD))
+    return;
+
+  printf("Inlining hot call of %s in %s (%s:%d), %llu calls\n",
+         fn->name, caller->name, call->fname(), call->linenum(), count);
+}
+
+
+//
+// --profile-use: inline the small functions called from hot sites.
+// The profile is written as <prefix>.<locale id> by each locale.
+//
+static void
+inlineHotCallSites(std::vector<CallExpr*>& sites) {
+  std::vector<unsigned long long> counts(sites.size(), 0);
+
+  for (int id = 0; ; id++) {
+    const char* name = astr(profileUsePrefix, ".", istr(id));
+    FILE* file = fopen(name, "r");
+
+    if (file == NULL) {
+      if (id == 0)
+        USR_FATAL("cannot open call profile '%s': %s", name, strerror(errno));
+      break;
+    }
+
+    bool matches = readCallProfile(file, name, sites, counts);
+
+    fclose(file);
+
+    if (!matches)
+      return;
+  }
+
+  unsigned long long maxCount = 0;
+
+  for (size_t i = 0; i < counts.size(); i++) {
+    if (counts[i] > maxCount)
+      maxCount = counts[i];
+  }
+
+  Vec<FnSymbol*> noRefTempRemoval;
+
+  for (size_t i = 0; i < sites.size(); i++) {
+    CallExpr* call = sites[i];
+    FnSymbol* fn = call->isResolved();
+
+    if (counts[i] == 0 || counts[i] * profileHotFraction < maxCount)
+      continue;
+
+    std::vector<CallExpr*> calls;
+    collectCallExprsSTL(fn->body, calls);
+
+    CallExpr* ret = toCallExpr(fn->body->body.last());
+
+    if (calls.size() > profileInlineMaxSize ||
+        ret == NULL || !ret->isPrimitive(PRIM_RETURN))
+      continue;
+
+    FnSymbol* caller = toFnSymbol(call->parentSymbol);
+
+    if ((caller == chpl_gen_main || caller->hasFlag(FLAG_MODULE_INIT)) &&
+        readsGlobalConst(fn))
+      continue;
+
+    if (fReportProfileInlining)
+      reportProfileInlining(fn, call, counts[i]);
+
+    inlineCall(fn, call, noRefTempRemoval);
+  }
+}
+
+
 //
 // inline all functions with the inline flag
 // remove unnecessary block statements and gotos
@@ -228,6 +497,22 @@ inlineFunctions() {
       if (fn->hasFlag(FLAG_INLINE) && !inlinedSet.set_in(fn))
         inlineFunction(fn, inlinedSet, canRemoveRefTempSet);
     }
+
+    if (profileUsePrefix[0] != '\0' && !fProfileGenerate) {
+      std::vector<CallExpr*> sites;
+
+      collectProfiledCalls(sites);
+      inlineHotCallSites(sites);
+    }
+  } else if (profileUsePrefix[0] != '\0' && !fProfileGenerate) {
+    USR_WARN("--profile-use has no effect with --no-inline");
+  }
+
+  if (fProfileGenerate) {
+    std::vector<CallExpr*> sites;
+
+    collectProfiledCalls(sites);
+    instrumentCallSites(sites);
   }
 
   forv_Vec(FnSymbol, fn, gFnSymbols) {
@@ -0,0 +1,687 @@
+/*
+ * Copyright 2004-2014 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// insertCommPrefetches
+//
+// A C for-loop that reads a possibly remote array element on every
+// iteration pays the full latency of a GET each time around.  When the
+// element index is an affine function of the loop index, this pass
+// inserts a prefetch of the element that will be read comm-prefetch-
+// distance iterations later, guarded by the loop test so that it never
+// touches an element the loop would not have read.  The test only says
+// that much if the loop cannot stop any other way, so loops with a goto
+// out, a return or a halt (such as a bounds check) are left alone:
+//
+//   move ref (ARRAY_GET data idx)
+//
+// becomes
+//
+//   if (prefetch_ok) {                   // test(i + distance * step)
+//     prefetch_idx = idx + coeff * (distance * step)
+//     move prefetch_ref (ARRAY_GET data prefetch_idx)
+//     CHPL_COMM_REMOTE_PREFETCH (WIDE_GET_NODE prefetch_ref) prefetch_ref 1
+//   }
+//   move ref (ARRAY_GET data idx)
+//
+// where coeff is the rate at which idx changes with the loop index.  A
+// local element is prefetched into the processor cache; a remote one is
+// fetched into the remote data cache by a non-blocking GET, so the read
+// distance iterations later waits only if it has not arrived.  Without
+// the cache (--cache-remote) a remote prefetch would be a blocking GET
+// of its own, so the pass does nothing then.
+//
+// The pass only looks at reads at the top level of a loop body, and
+// only follows index computations made of moves, +, -, *, casts and the
+// compound assignments of these, over symbols that do not change within
+// the loop.  Reads through an index array (gathers) are not prefetched.
+//
+
+#include "astutil.h"
+#include "CForLoop.h"
+#include "driver.h"
+#include "expr.h"
+#include "passes.h"
+#include "stlUtil.h"
+#include "stmt.h"
+#include "symbol.h"
+
+#include <map>
+#include <vector>
+
+//
+// The rate of change of a value with the loop index, as a sum of
+// products.  Each term is a constant scale times a list of loop-
+// invariant symbols; no terms means the value does not depend on the
+// loop index.
+//
+struct AffineTerm {
+  int64_t              scale;
+  std::vector<Symbol*> factors;
+};
+
+typedef std::vector<AffineTerm> Coefficient;
+
+
+struct PrefetchLoop {
+  CForLoop*                                loop;
+  Symbol*                                  index;
+  Symbol*                                  step;
+  bool                                     stepDown;
+  std::map<Expr*, int>                     position;
+  std::map<Symbol*, std::vector<SymExpr*> > defs;
+};
+
+
+static const int maxAffineDepth = 16;
+
+static bool computeCoefficient(PrefetchLoop& info, Symbol* sym, Expr* pos,
+                               Coefficient& coeff, int depth);
+static bool computeExprCoefficient(PrefetchLoop& info, Expr* expr, Expr* pos,
+                                   Coefficient& coeff, int depth);
+
+
+static void
+collectLoopDefs(PrefetchLoop& info) {
+  Vec<SymExpr*> symExprs;
+  collectSymExprs(info.loop, symExprs);
+  forv_Vec(SymExpr, se, symExprs) {
+    CallExpr* call = toCallExpr(se->parentExpr);
+    if (call && call->baseExpr == se)
+      continue;
+    //
+    // Taking the address of a symbol may lead to a write through the
+    // reference; treat it as an unanalyzable definition.
+    //
+    if ((isDefAndOrUse(se) & 1) ||
+        (call && call->isPrimitive(PRIM_ADDR_OF)) ||
+        (call && (call->isPrimitive(PRIM_SET_MEMBER) ||
+                  call->isPrimitive(PRIM_SET_SVEC_MEMBER)) &&
+         call->get(1) == se))
+      info.defs[se->var].push_back(se);
+  }
+
+  int i = 0;
+  for_alist(stmt, info.loop->body) {
+    info.position[stmt] = i++;
+  }
+}
+
+
+//
+// Is stmt a top-level statement of the loop body that precedes pos?
+//
+static bool
+isEarlierBodyStmt(PrefetchLoop& info, Expr* stmt, Expr* pos) {
+  if (stmt->parentExpr != info.loop || pos->parentExpr != info.loop)
+    return false;
+  return info.position[stmt] < info.position[pos];
+}
+
+
+//
+// Does sym hold the same value at pos and at every later top-level
+// statement of the loop body?  It may not change within the loop, or it
+// may be set by a single move earlier in the body.
+//
+static bool
+isStableAt(PrefetchLoop& info, Symbol* sym, Expr* pos) {
+  if (sym->isImmediate())
+    return true;
+
+  if (info.defs.count(sym) == 0)
+    return isVarSymbol(sym) || isArgSymbol(sym);
+
+  std::vector<SymExpr*>& defs = info.defs[sym];
+  if (defs.size() != 1)
+    return false;
+
+  CallExpr* def = toCallExpr(defs[0]->parentExpr);
+  return def && def->isPrimitive(PRIM_MOVE) &&
+         isEarlierBodyStmt(info, def, pos);
+}
+
+
+static void
+addCoefficient(Coefficient& coeff, Coefficient& other, int64_t sign) {
+  for (size_t i = 0; i < other.size(); i++) {
+    AffineTerm scaled = other[i];
+    scaled.scale *= sign;
+    coeff.push_back(scaled);
+  }
+}
+
+
+static bool
+getIntValue(Symbol* sym, int64_t* value) {
+  VarSymbol* var = toVarSymbol(sym);
+  if (var && var->immediate &&
+      var->immediate->const_kind == NUM_KIND_INT) {
+    *value = var->immediate->int_value();
+    return true;
+  }
+  return false;
+}
+
+
+static void
+scaleCoefficient(Coefficient& coeff, Symbol* factor) {
+  int64_t value;
+  bool isConstant = getIntValue(factor, &value);
+
+  for (size_t i = 0; i < coeff.size(); i++) {
+    if (isConstant)
+      coeff[i].scale *= value;
+    else
+      coeff[i].factors.push_back(factor);
+  }
+}
+
+
+//
+// Is get a read of a field of a local record or tuple that the loop
+// body stores to?
+//
+static bool
+isStoredMember(PrefetchLoop& info, CallExpr* get) {
+  SymExpr* base = toSymExpr(get->get(1));
+  if (!base || info.defs.count(base->var) == 0 ||
+      !(get->isPrimitive(PRIM_GET_MEMBER_VALUE) ||
+        get->isPrimitive(PRIM_GET_SVEC_MEMBER_VALUE)))
+    return false;
+
+  for_vector(SymExpr, se, info.defs[base->var]) {
+    CallExpr* def = toCallExpr(se->parentExpr);
+    if (def && (def->isPrimitive(PRIM_SET_MEMBER) ||
+                def->isPrimitive(PRIM_SET_SVEC_MEMBER)))
+      return true;
+  }
+  return false;
+}
+
+
+//
+// Compute the coefficient of a field of a local record or tuple that
+// the loop body fills in, such as the index tuple of a multidimensional
+// access, from the last store to that field before pos.
+//
+static bool
+computeMemberCoefficient(PrefetchLoop& info, CallExpr* get, Expr* pos,
+                         Coefficient& coeff, int depth) {
+  Symbol* base = toSymExpr(get->get(1))->var;
+  PrimitiveTag setTag = get->isPrimitive(PRIM_GET_MEMBER_VALUE) ?
+                        PRIM_SET_MEMBER : PRIM_SET_SVEC_MEMBER;
+  SymExpr* field = toSymExpr(get->get(2));
+  CallExpr* store = NULL;
+
+  if (!field)
+    return false;
+
+  for_vector(SymExpr, se, info.defs[base]) {
+    CallExpr* def = toCallExpr(se->parentExpr);
+    if (!def || !def->isPrimitive(setTag) ||
+        !isEarlierBodyStmt(info, def, pos))
+      return false;
+    SymExpr* defField = toSymExpr(def->get(2));
+    if (defField && defField->var == field->var)
+      store = def;
+  }
+
+  if (!store)
+    return false;
+
+  return computeExprCoefficient(info, store->get(3), store, coeff, depth + 1);
+}
+
+
+//
+// Compute the coefficient of expr, evaluated at the statement pos.
+//
+static bool
+computeExprCoefficient(PrefetchLoop& info, Expr* expr, Expr* pos,
+                       Coefficient& coeff, int depth) {
+  if (SymExpr* se = toSymExpr(expr))
+    return computeCoefficient(info, se->var, pos, coeff, depth);
+
+  CallExpr* call = toCallExpr(expr);
+  if (!call || !call->primitive)
+    return false;
+
+  switch (call->primitive->tag) {
+  case PRIM_ADD:
+  case PRIM_SUBTRACT: {
+    Coefficient lhs, rhs;
+    if (!computeExprCoefficient(info, call->get(1), pos, lhs, depth) ||
+        !computeExprCoefficient(info, call->get(2), pos, rhs, depth))
+      return false;
+    addCoefficient(coeff, lhs, 1);
+    addCoefficient(coeff, rhs, call->isPrimitive(PRIM_ADD) ? 1 : -1);
+    return true;
+  }
+  case PRIM_UNARY_MINUS: {
+    Coefficient operand;
+    if (!computeExprCoefficient(info, call->get(1), pos, operand, depth))
+      return false;
+    addCoefficient(coeff, operand, -1);
+    return true;
+  }
+  case PRIM_MULT: {
+    Coefficient lhs, rhs;
+    if (!computeExprCoefficient(info, call->get(1), pos, lhs, depth) ||
+        !computeExprCoefficient(info, call->get(2), pos, rhs, depth))
+      return false;
+    if (!lhs.empty() && !rhs.empty())
+      return false;
+    if (lhs.empty() && rhs.empty())
+      return true;
+
+    // The invariant operand must be available where the prefetch goes.
+    Expr* factor = lhs.empty() ? call->get(1) : call->get(2);
+    SymExpr* factorSe = toSymExpr(factor);
+    if (!factorSe || !isStableAt(info, factorSe->var, pos))
+      return false;
+
+    coeff = lhs.empty() ? rhs : lhs;
+    scaleCoefficient(coeff, factorSe->var);
+    return true;
+  }
+  case PRIM_CAST:
+    if (!is_int_type(call->typeInfo()) && !is_uint_type(call->typeInfo()))
+      return false;
+    return computeExprCoefficient(info, call->get(2), pos, coeff, depth);
+  case PRIM_GET_MEMBER:
+  case PRIM_GET_MEMBER_VALUE:
+  case PRIM_GET_SVEC_MEMBER:
+  case PRIM_GET_SVEC_MEMBER_VALUE:
+  case PRIM_DEREF: {
+    if (isStoredMember(info, call))
+      return computeMemberCoefficient(info, call, pos, coeff, depth);
+
+    //
+    // A load through a base that does not depend on the loop index is
+    // assumed not to either; the guess only affects which element is
+    // prefetched, never what the loop computes.
+    //
+    Coefficient baseCoeff;
+    if (!computeExprCoefficient(info, call->get(1), pos, baseCoeff, depth))
+      return false;
+    return baseCoeff.empty();
+  }
+  default:
+    return false;
+  }
+}
+
+
+//
+// Compute the coefficient of sym, evaluated at the statement pos, by
+// folding over its definitions earlier in the loop body.
+//
+static bool
+computeCoefficient(PrefetchLoop& info, Symbol* sym, Expr* pos,
+                   Coefficient& coeff, int depth) {
+  if (depth > maxAffineDepth)
+    return false;
+
+  coeff.clear();
+
+  if (sym == info.index) {
+    AffineTerm term;
+    term.scale = 1;
+    coeff.push_back(term);
+    return true;
+  }
+
+  if (sym->isImmediate() || info.defs.count(sym) == 0)
+    return isVarSymbol(sym) || isArgSymbol(sym);
+
+  for_vector(SymExpr, se, info.defs[sym]) {
+    CallExpr* def = toCallExpr(se->parentExpr);
+    if (!def || def->get(1) != se || !isEarlierBodyStmt(info, def, pos))
+      return false;
+
+    Coefficient rhs;
+    if (!computeExprCoefficient(info, def->get(2), def, rhs, depth + 1))
+      return false;
+
+    if (def->isPrimitive(PRIM_MOVE)) {
+      coeff = rhs;
+    } else if (def->isPrimitive(PRIM_ADD_ASSIGN)) {
+      addCoefficient(coeff, rhs, 1);
+    } else if (def->isPrimitive(PRIM_SUBTRACT_ASSIGN)) {
+      addCoefficient(coeff, rhs, -1);
+    } else if (def->isPrimitive(PRIM_MULT_ASSIGN)) {
+      SymExpr* factor = toSymExpr(def->get(2));
+      if (!rhs.empty() || !factor || !isStableAt(info, factor->var, def))
+        return false;
+      scaleCoefficient(coeff, factor->var);
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+static bool
+isInLoop(CForLoop* loop, Expr* expr) {
+  for (Expr* parent = expr->parentExpr; parent; parent = parent->parentExpr)
+    if (parent == loop)
+      return true;
+
+  return false;
+}
+
+
+//
+// Can the loop stop before its test fails?  Then the test does not
+// tell whether the loop will run another distance iterations.
+//
+static bool
+hasEarlyExit(CForLoop* loop) {
+  std::vector<GotoStmt*> gotos;
+
+  collectGotoStmtsSTL(loop, gotos);
+
+  for_vector(GotoStmt, gotoStmt, gotos) {
+    SymExpr* label = toSymExpr(gotoStmt->label);
+
+    if (label == NULL || !isInLoop(loop, label->var->defPoint))
+      return true;
+  }
+
+  std::vector<CallExpr*> calls;
+
+  collectCallExprsSTL(loop, calls);
+
+  for_vector(CallExpr, call, calls) {
+    if (call->isPrimitive(PRIM_RETURN) ||
+        call->isPrimitive(PRIM_RT_ERROR) ||
+        call->isNamed("halt"))
+      return true;
+  }
+
+  return false;
+}
+
+
+//
+// Recognize a loop stepped by 'i += step' or 'i -= step' whose test
+// depends only on i and on symbols the body does not change, and which
+// only ends when its test fails.
+//
+static bool
+isPrefetchLoop(PrefetchLoop& info) {
+  BlockStmt* testBlock = info.loop->testBlockGet();
+  BlockStmt* incrBlock = info.loop->incrBlockGet();
+
+  if (!testBlock || !incrBlock ||
+      testBlock->body.length != 1 || incrBlock->body.length != 1)
+    return false;
+
+  CallExpr* incr = toCallExpr(incrBlock->body.head);
+  if (!incr || !(incr->isPrimitive(PRIM_ADD_ASSIGN) ||
+                 incr->isPrimitive(PRIM_SUBTRACT_ASSIGN)))
+    return false;
+
+  SymExpr* index = toSymExpr(incr->get(1));
+  SymExpr* step = toSymExpr(incr->get(2));
+  if (!index || !step || !is_int_type(index->var->type))
+    return false;
+
+  if (hasEarlyExit(info.loop))
+    return false;
+
+  info.index = index->var;
+  info.step = step->var;
+  info.stepDown = incr->isPrimitive(PRIM_SUBTRACT_ASSIGN);
+
+  collectLoopDefs(info);
+
+  // The index may only be changed by the loop header.
+  for_vector(SymExpr, se, info.defs[info.index]) {
+    Expr* stmt = se->getStmtExpr();
+    if (stmt->parentExpr != info.loop->initBlockGet() &&
+        stmt->parentExpr != incrBlock)
+      return false;
+  }
+
+  if (!step->var->isImmediate() && info.defs.count(step->var) != 0)
+    return false;
+
+  //
+  // The test must be monotonic in the index, so that the loop reaches
+  // index + distance only if it runs for another distance iterations.
+  //
+  CallExpr* test = toCallExpr(testBlock->body.head);
+  if (!test || !(test->isPrimitive(PRIM_LESS) ||
+                 test->isPrimitive(PRIM_LESSOREQUAL) ||
+                 test->isPrimitive(PRIM_GREATER) ||
+                 test->isPrimitive(PRIM_GREATEROREQUAL)))
+    return false;
+
+  Vec<SymExpr*> symExprs;
+  collectSymExprs(testBlock, symExprs);
+  forv_Vec(SymExpr, se, symExprs) {
+    if (se->var != info.index && info.defs.count(se->var) != 0)
+      return false;
+  }
+
+  return true;
+}
+
+
+//
+// Recognize 'move ref (ARRAY_GET data idx)' through a wide _ddata,
+// with data stable in the body, where the next statement reads the
+// element through ref.
+//
+static bool
+isPrefetchableRead(PrefetchLoop& info, Expr* stmt, Coefficient& coeff) {
+  CallExpr* move = toCallExpr(stmt);
+  if (!move || !move->isPrimitive(PRIM_MOVE))
+    return false;
+
+  CallExpr* get = toCallExpr(move->get(2));
+  if (!get || !get->isPrimitive(PRIM_ARRAY_GET) ||
+      !move->get(1)->typeInfo()->symbol->hasFlag(FLAG_WIDE_REF))
+    return false;
+
+  CallExpr* read = toCallExpr(stmt->next);
+  CallExpr* deref = read && read->isPrimitive(PRIM_MOVE) ?
+                    toCallExpr(read->get(2)) : NULL;
+  if (!deref || !deref->isPrimitive(PRIM_DEREF) ||
+      toSymExpr(deref->get(1))->var != toSymExpr(move->get(1))->var)
+    return false;
+
+  SymExpr* data = toSymExpr(get->get(1));
+  SymExpr* idx = toSymExpr(get->get(2));
+  if (!data || !idx ||
+      !data->var->type->symbol->hasFlag(FLAG_WIDE_CLASS) ||
+      !isStableAt(info, data->var, stmt))
+    return false;
+
+  Coefficient dataCoeff;
+  if (!computeCoefficient(info, data->var, stmt, dataCoeff, 0) ||
+      !dataCoeff.empty())
+    return false;
+
+  if (!computeCoefficient(info, idx->var, stmt, coeff, 0))
+    return false;
+
+  return !coeff.empty();
+}
+
+
+static Symbol*
+insertArith(Expr* anchor, PrimitiveTag tag, Symbol* lhs, Symbol* rhs) {
+  VarSymbol* tmp = newTemp("prefetch_tmp", lhs->type);
+  anchor->insertBefore(new DefExpr(tmp));
+  anchor->insertBefore(new CallExpr(PRIM_MOVE, tmp,
+                                    new CallExpr(tag, lhs, rhs)));
+  return tmp;
+}
+
+
+//
+// Insert the guarded prefetch for the read at stmt.  The offset from
+// the index read this iteration is coeff times delta, the distance the
+// loop index moves in comm_prefetch_distance iterations.
+//
+static void
+insertPrefetch(Expr* stmt, Coefficient& coeff,
+               Symbol* delta, Symbol* prefetchOk) {
+  SET_LINENO(stmt);
+
+  CallExpr* get = toCallExpr(toCallExpr(stmt)->get(2));
+  Symbol* data = toSymExpr(get->get(1))->var;
+  Symbol* idx = toSymExpr(get->get(2))->var;
+  Type* idxType = idx->type;
+
+  BlockStmt* thenBlock = new BlockStmt();
+  CallExpr* anchor = new CallExpr(PRIM_NOOP);
+  thenBlock->insertAtTail(anchor);
+
+  Symbol* offset = NULL;
+  for (size_t i = 0; i < coeff.size(); i++) {
+    std::vector<Symbol*>& factors = coeff[i].factors;
+    Symbol* product = NULL;
+    if (coeff[i].scale != 1 || factors.empty())
+      product = new_IntSymbol(coeff[i].scale);
+    for_vector(Symbol, factor, factors) {
+      product = product ? insertArith(anchor, PRIM_MULT, product, factor)
+                        : factor;
+    }
+    offset = offset ? insertArith(anchor, PRIM_ADD, offset, product)
+                    : product;
+  }
+  offset = insertArith(anchor, PRIM_MULT, offset, delta);
+
+  VarSymbol* prefetchIdx = newTemp("prefetch_idx", idxType);
+  anchor->insertBefore(new DefExpr(prefetchIdx));
+  anchor->insertBefore(new CallExpr(PRIM_MOVE, prefetchIdx,
+                                    new CallExpr(PRIM_ADD, idx, offset)));
+
+  Symbol* ref = toSymExpr(toCallExpr(stmt)->get(1))->var;
+  VarSymbol* prefetchRef = newTemp("prefetch_ref", ref->type);
+  anchor->insertBefore(new DefExpr(prefetchRef));
+  anchor->insertBefore(new CallExpr(PRIM_MOVE, prefetchRef,
+                         new CallExpr(PRIM_ARRAY_GET, data, prefetchIdx)));
+
+  VarSymbol* node = newTemp("prefetch_node", NODE_ID_TYPE);
+  anchor->insertBefore(new DefExpr(node));
+  anchor->insertBefore(new CallExpr(PRIM_MOVE, node,
+                         new CallExpr(PRIM_WIDE_GET_NODE, prefetchRef)));
+  anchor->insertBefore(new CallExpr(PRIM_CHPL_COMM_REMOTE_PREFETCH,
+                                    node, prefetchRef, new_IntSymbol(1)));
+  anchor->remove();
+
+  stmt->insertBefore(new CondStmt(new SymExpr(prefetchOk), thenBlock));
+}
+
+
+static void
+reportPrefetches(PrefetchLoop& info, int numReads) {
+  FnSymbol* fn = toFnSymbol(info.loop->parentSymbol);
+  ModuleSymbol* mod = fn->getModule();
+
+  if (!developer && (mod->modTag == MOD_INTERNAL ||
+                     mod->modTag == MOD_STANDARD))
+    return;
+
+  printf("Prefetching %d remote %s %d iterations ahead in %s (%s:%d)\n",
+         numReads, numReads == 1 ? "read" : "reads",
+         comm_prefetch_distance, fn->name,
+         info.loop->fname(), info.loop->linenum());
+}
+
+
+static void
+insertLoopPrefetches(CForLoop* loop) {
+  PrefetchLoop info;
+  info.loop = loop;
+
+  if (!isPrefetchLoop(info))
+    return;
+
+  std::vector<Expr*> reads;
+  std::vector<Coefficient> coeffs;
+  for_alist(stmt, loop->body) {
+    Coefficient coeff;
+    if (isPrefetchableRead(info, stmt, coeff)) {
+      reads.push_back(stmt);
+      coeffs.push_back(coeff);
+    }
+  }
+
+  if (reads.empty())
+    return;
+
+  //
+  // At the top of the body, compute the index comm_prefetch_distance
+  // iterations ahead and whether the loop would reach it.
+  //
+  Expr* first = loop->body.head;
+  SET_LINENO(first);
+
+  int64_t distance = info.stepDown ? -comm_prefetch_distance
+                                    : comm_prefetch_distance;
+  int64_t step;
+  Symbol* delta = NULL;
+  if (getIntValue(info.step, &step))
+    delta = new_IntSymbol(distance * step);
+  else
+    delta = insertArith(first, PRIM_MULT, info.step,
+                        new_IntSymbol(distance));
+
+  VarSymbol* prefetchIndex = newTemp("prefetch_index", info.index->type);
+  first->insertBefore(new DefExpr(prefetchIndex));
+  first->insertBefore(new CallExpr(PRIM_MOVE, prefetchIndex,
+                        new CallExpr(PRIM_ADD, info.index, delta)));
+
+  SymbolMap map;
+  map.put(info.index, prefetchIndex);
+  VarSymbol* prefetchOk = newTemp("prefetch_ok", dtBool);
+  first->insertBefore(new DefExpr(prefetchOk));
+  first->insertBefore(new CallExpr(PRIM_MOVE, prefetchOk,
+                        loop->testBlockGet()->body.head->copy(&map)));
+
+  for (size_t i = 0; i < reads.size(); i++)
+    insertPrefetch(reads[i], coeffs[i], delta, prefetchOk);
+
+  if (fReportCommPrefetch)
+    reportPrefetches(info, (int)reads.size());
+}
+
+
+void
+insertCommPrefetches() {
+  if (!requireWideReferences() || comm_prefetch_distance <= 0)
+    return;
+
+  if (!fCacheRemote) {
+    USR_WARN("--comm-prefetch-distance has no effect without --cache-remote");
+    return;
+  }
+
+  forv_Vec(BlockStmt, block, gBlockStmts) {
+    if (block->parentSymbol && block->isCForLoop())
+      insertLoopPrefetches(toCForLoop(block));
+  }
+}
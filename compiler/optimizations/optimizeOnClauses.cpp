@@ -108,6 +108,7 @@ isFastPrimitive(CallExpr *call, bool isLocal) {
   case PRIM_C_STRING_FROM_STRING:
   case PRIM_CAST_TO_VOID_STAR:
   case PRIM_SIZEOF:
+  case PRIM_CALL_PROFILE_COUNT:
 
   case PRIM_GET_USER_LINE:
   case PRIM_GET_USER_FILE:
@@ -195,6 +196,10 @@ isFastPrimitive(CallExpr *call, bool isLocal) {
   case PRIM_CHPL_COMM_REMOTE_PREFETCH:
   case PRIM_CHPL_COMM_GET_STRD:
   case PRIM_CHPL_COMM_PUT_STRD:
+  case PRIM_CHPL_COMM_GET_FIELDS:
+  case PRIM_CHPL_COMM_PUT_FIELDS:
+  case PRIM_ON_BATCH_ADD:
+  case PRIM_ON_BATCH_FINISH:
     // These may involve communication, so are deemed slow.
     return false;
 
@@ -291,6 +296,10 @@ isFastPrimitive(CallExpr *call, bool isLocal) {
     // call so we don't consider them eligible.
     //
   case PRIM_FREE_TASK_LIST:
+  case PRIM_TASK_ARGS_ALLOC:
+  case PRIM_TASK_ARGS_FREE:
+  case PRIM_ON_BATCH_CREATE:
+  case PRIM_ON_BATCH_RUN:
   case PRIM_ARRAY_ALLOC:
   case PRIM_ARRAY_FREE:
   case PRIM_ARRAY_FREE_ELTS:
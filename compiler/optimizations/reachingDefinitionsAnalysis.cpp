@@ -71,6 +71,15 @@ reachingDefinitionsAnalysis(FnSymbol* fn,
     }
   }
 
+  //
+  // localDefs[i] is now the end of the run of defs of local i; record
+  // where each run begins so that a block's KILL set can be filled in a
+  // run at a time
+  //
+  std::vector<int> localDefsBegin(locals.n);
+  for (int i = 0; i < locals.n; i++)
+    localDefsBegin[i] = (i == 0) ? 0 : localDefs[i-1];
+
   std::vector<BitVec*> KILL;
   std::vector<BitVec*> GEN;
   std::vector<BitVec*> OUT;
@@ -94,9 +103,11 @@ reachingDefinitionsAnalysis(FnSymbol* fn,
         }
       }
     }
-    for (int i = 0; i < defs.n; i++) {
-      if (bbDefSet.set_in(defs.v[i]->var))
-        kill->set(i);
+    forv_Vec(Symbol, sym, bbDefSet) {
+      if (sym) {
+        int i = localMap.get(sym);
+        kill->setRange(localDefsBegin[i], localDefs[i]);
+      }
     }
     KILL.push_back(kill);
     GEN.push_back(gen);
@@ -27,11 +27,15 @@
 #include "expr.h"
 #include "optimizations.h"
 #include "passes.h"
+#include "stlUtil.h"
 #include "stmt.h"
 #include "stringutil.h"
 #include "symbol.h"
 #include "view.h"
 
+#include <set>
+#include <vector>
+
 static const bool debugScalarReplacement = false;
 
 // statistics
@@ -59,6 +63,8 @@ static Map<Symbol*,Vec<SymExpr*>*> useMap;
 typedef Map<AggregateType*,Vec<Symbol*>*> AggregateTypeToVecSymbolMap;
 typedef MapElem<AggregateType*,Vec<Symbol*>*> AggregateTypeToVecSymbolMapElem;
 
+typedef std::set<ArgSymbol*> ArgSet;
+
 //
 // compute topological order for types; this functions assumes that
 // there are no cycles and that the typeOrder map is initialized to -1
@@ -334,6 +340,53 @@ scalarReplaceClass(AggregateType* ct, Symbol* sym) {
   return true;
 }
 
+//
+// a whole-record assignment between two values of type ct can be
+// rewritten field by field, the same as a move
+//
+static bool
+isScalarReplaceableAssign(AggregateType* ct, CallExpr* call) {
+  return (call->isPrimitive(PRIM_ASSIGN) &&
+          isSymExpr(call->get(1)) && call->get(1)->typeInfo() == ct &&
+          isSymExpr(call->get(2)) && call->get(2)->typeInfo() == ct);
+}
+
+//
+// report why a tuple could not be scalar replaced; blocker is the def
+// or use of sym that scalarReplaceRecord could not handle
+//
+static void
+reportUnscalarizedTuple(Symbol* sym, SymExpr* blocker) {
+  if (!sym->type->symbol->hasFlag(FLAG_TUPLE))
+    return;
+
+  ModuleSymbol* mod = sym->defPoint->getModule();
+  if (!developer && (mod->modTag == MOD_INTERNAL ||
+                     mod->modTag == MOD_STANDARD))
+    return;
+
+  const char* reason = "used outside a call";
+  if (CallExpr* call = toCallExpr(blocker->parentExpr)) {
+    if (FnSymbol* fn = call->isResolved())
+      reason = astr("passed to ", fn->name);
+    else if (call->primitive) {
+      CallExpr* rhs = NULL;
+      if (call->isPrimitive(PRIM_MOVE))
+        rhs = toCallExpr(call->get(2));
+      if (rhs && rhs->isResolved())
+        reason = astr("result of ", rhs->isResolved()->name);
+      else if (rhs && rhs->primitive)
+        reason = astr("result of primitive ", rhs->primitive->name);
+      else
+        reason = astr("used by primitive ", call->primitive->name);
+    }
+  }
+
+  printf("Tuple %s not scalar replaced in %s (%s:%d): %s\n",
+         sym->name, toFnSymbol(sym->defPoint->parentSymbol)->name,
+         sym->defPoint->fname(), sym->defPoint->linenum(), reason);
+}
+
 static bool
 scalarReplaceRecord(AggregateType* ct, Symbol* sym) {
 
@@ -345,10 +398,11 @@ scalarReplaceRecord(AggregateType* ct, Symbol* sym) {
     if (se->parentSymbol) {
       CallExpr* call = toCallExpr(se->parentExpr);
       if (!call ||
-          !call->isPrimitive(PRIM_MOVE) ||
-          // Do we need to add PRIM_ASSIGN here?
-          !(isSymExpr(call->get(2)) ||
-            toCallExpr(call->get(2))->isPrimitive(PRIM_GET_MEMBER_VALUE))) {
+          !((call->isPrimitive(PRIM_MOVE) &&
+             (isSymExpr(call->get(2)) ||
+              toCallExpr(call->get(2))->isPrimitive(PRIM_GET_MEMBER_VALUE))) ||
+            isScalarReplaceableAssign(ct, call))) {
+        if (fReportUnscalarizedTuples) reportUnscalarizedTuple(sym, se);
         return false;
       }
     }
@@ -364,9 +418,11 @@ scalarReplaceRecord(AggregateType* ct, Symbol* sym) {
           !((call->isPrimitive(PRIM_SET_MEMBER) && call->get(1) == se) ||
             call->isPrimitive(PRIM_GET_MEMBER) ||
             call->isPrimitive(PRIM_GET_MEMBER_VALUE) ||
-            call->isPrimitive(PRIM_MOVE)))
-        // Do we need to add PRIM_ASSIGN here?
+            call->isPrimitive(PRIM_MOVE) ||
+            isScalarReplaceableAssign(ct, call))) {
+        if (fReportUnscalarizedTuples) reportUnscalarizedTuple(sym, se);
         return false;
+      }
     }
   }
 
@@ -396,7 +452,8 @@ scalarReplaceRecord(AggregateType* ct, Symbol* sym) {
     if (CallExpr* call = toCallExpr(se->parentExpr)) {
       if (call) {
         SET_LINENO(sym);
-        INT_ASSERT(call->isPrimitive(PRIM_MOVE));
+        INT_ASSERT(call->isPrimitive(PRIM_MOVE) ||
+                   call->isPrimitive(PRIM_ASSIGN));
         Symbol *rhs;
         if (isSymExpr(call->get(2))) {
           rhs = toSymExpr(call->get(2))->var;
@@ -451,8 +508,7 @@ scalarReplaceRecord(AggregateType* ct, Symbol* sym) {
   for_uses(se, useMap, sym) {
     if (CallExpr* call = toCallExpr(se->parentExpr)) {
       SET_LINENO(sym);
-      // Do we need to add a case for PRIM_ASSIGN?
-      if (call->isPrimitive(PRIM_MOVE)) {
+      if (call->isPrimitive(PRIM_MOVE) || call->isPrimitive(PRIM_ASSIGN)) {
         SymExpr* lhs = toSymExpr(call->get(1));
         for_fields(field, ct) {
           SymExpr* lhsCopy = lhs->copy();
@@ -518,10 +574,496 @@ debugScalarReplacementFailure(Symbol* var) {
 }
 
 
+//
+// a small POD aggregate is a record or tuple of at most
+// scalar_replace_limit fields, all of them scalars; these are passed to
+// and returned from functions field by field
+//
+bool
+isSmallPODAggregate(Type* type) {
+  AggregateType* ct = toAggregateType(type);
+  if (!ct || !isRecord(ct))
+    return false;
+  if (ct->symbol->hasFlag(FLAG_EXTERN) ||
+      ct->symbol->hasFlag(FLAG_REF) ||
+      ct->symbol->hasFlag(FLAG_WIDE_CLASS) ||
+      ct->symbol->hasFlag(FLAG_ITERATOR_RECORD) ||
+      ct->symbol->hasFlag(FLAG_SYNC) ||
+      ct->symbol->hasFlag(FLAG_ATOMIC_TYPE))
+    return false;
+  if (ct->fields.length == 0 || ct->fields.length > scalar_replace_limit)
+    return false;
+  for_fields(field, ct) {
+    Type* ft = field->type;
+    if (!is_arithmetic_type(ft) && !is_bool_type(ft) && !is_enum_type(ft))
+      return false;
+    if (!ft->refType)
+      return false;
+  }
+  return true;
+}
+
+//
+// the arguments of call are split in the statement that holds it, so
+// the call must be a statement or the right-hand side of a move, and
+// that statement must not be in the clauses of a C for loop
+//
+static bool
+isSplittableCallSite(CallExpr* call) {
+  if (!isFnSymbol(call->parentSymbol))
+    return false;
+  Expr* stmt = call;
+  if (CallExpr* move = toCallExpr(call->parentExpr))
+    if (move->isPrimitive(PRIM_MOVE) && move->get(2) == call)
+      stmt = move;
+  BlockStmt* block = toBlockStmt(stmt->parentExpr);
+  return (block && stmt->list == &block->body &&
+          block->blockTag != BLOCK_C_FOR_LOOP);
+}
+
+//
+// can the aggregate arguments and return value of fn be split into
+// their fields?  None of its calls may be added after this pass.
+//
+static bool
+canSplitAggregateArgs(FnSymbol* fn) {
+  if (fn->hasFlag(FLAG_EXTERN) ||
+      fn->hasFlag(FLAG_EXPORT) ||
+      fn->hasFlag(FLAG_VIRTUAL) ||
+      fn->hasFlag(FLAG_NO_CODEGEN) ||
+      fn->hasFlag(FLAG_BEGIN) ||
+      fn->hasFlag(FLAG_COBEGIN_OR_COFORALL) ||
+      fn->hasFlag(FLAG_ON) ||
+      fn->hasFlag(FLAG_AUTO_COPY_FN) ||
+      fn->hasFlag(FLAG_AUTO_DESTROY_FN) ||
+      fn->hasFlag(FLAG_INIT_COPY_FN) ||
+      fn->hasFlag(FLAG_DESTRUCTOR))
+    return false;
+  CallExpr* ret = toCallExpr(fn->body->body.last());
+  return ret && ret->isPrimitive(PRIM_RETURN);
+}
+
+//
+// is formal the reference through which fn returns a record?  See
+// changeRetToArgAndClone in callDestructors.
+//
+static bool
+isRetArg(FnSymbol* fn, ArgSymbol* formal) {
+  return (formal == toDefExpr(fn->formals.tail)->sym &&
+          !strcmp(formal->name, "_retArg") &&
+          isSmallPODAggregate(formal->type->getValType()));
+}
+
+//
+// does fn only store to, and read from, the record that retArg refers
+// to?  Then the record can be built in a local variable and returned
+// field by field.
+//
+static bool
+isSplittableRetArg(FnSymbol* fn, ArgSymbol* retArg) {
+  Type* type = retArg->type->getValType();
+  std::vector<SymExpr*> symExprs;
+  collectSymExprsSTL(fn->body, symExprs);
+  for_vector(SymExpr, se, symExprs) {
+    if (se->var != retArg)
+      continue;
+    CallExpr* call = toCallExpr(se->parentExpr);
+    if (!call || call->get(1) != se)
+      return false;
+    if (call->isPrimitive(PRIM_MOVE)) {
+      if (call->get(2)->typeInfo() != type)
+        return false;
+    } else if (!call->isPrimitive(PRIM_SET_MEMBER) &&
+               !call->isPrimitive(PRIM_GET_MEMBER) &&
+               !call->isPrimitive(PRIM_GET_MEMBER_VALUE) &&
+               !call->isPrimitive(PRIM_DEREF))
+      return false;
+  }
+  return true;
+}
+
+//
+// can formal be passed field by field?  A value or const ref is passed
+// as the values of its fields, and a returned record as a reference to
+// each field.
+//
+static bool
+isSplittableFormal(FnSymbol* fn, ArgSymbol* formal) {
+  if (fn->_this == formal)
+    return false;
+  if (isRetArg(fn, formal))
+    return isSplittableRetArg(fn, formal);
+  return ((formal->intent == INTENT_CONST_REF ||
+           !(formal->intent & INTENT_REF)) &&
+          isSmallPODAggregate(formal->type));
+}
+
+//
+// can the value of sym change while it is passed by const ref?  Not if
+// it is a local variable whose address is never taken, or a formal
+// that is itself passed by value or split.
+//
+static bool
+isStableActual(Symbol* sym, Vec<Symbol*>& addrTaken,
+               ArgSet& splitSet) {
+  if (ArgSymbol* arg = toArgSymbol(sym))
+    return !(arg->intent & INTENT_REF) || splitSet.count(arg);
+  return isFnSymbol(sym->defPoint->parentSymbol) && !addrTaken.set_in(sym);
+}
+
+//
+// is move the initialization of a reference to a local variable?
+//
+static bool
+isRetRef(CallExpr* move) {
+  if (!move || !move->isPrimitive(PRIM_MOVE))
+    return false;
+  CallExpr* addrOf = toCallExpr(move->get(2));
+  if (!addrOf || !addrOf->isPrimitive(PRIM_ADDR_OF))
+    return false;
+  SymExpr* lhs = toSymExpr(move->get(1));
+  return lhs && isVarSymbol(lhs->var) &&
+         isFnSymbol(lhs->var->defPoint->parentSymbol);
+}
+
+//
+// is sym passed as the referent of another actual of call?
+//
+static bool
+isAliasedInCall(CallExpr* call, Symbol* sym, SymbolMap& retRefMap) {
+  for_actuals(actual, call) {
+    if (SymExpr* se = toSymExpr(actual))
+      if (retRefMap.get(se->var) == sym)
+        return true;
+  }
+  return false;
+}
+
+//
+// can every call of fn pass the fields of formal in its place?
+//
+static bool
+canSplitActuals(FnSymbol* fn, ArgSymbol* formal, Vec<Symbol*>& addrTaken,
+                SymbolMap& retRefMap, ArgSet& splitSet) {
+  forv_Vec(CallExpr, call, *fn->calledBy) {
+    for_formals_actuals(arg, actual, call) {
+      if (arg != formal)
+        continue;
+      SymExpr* se = toSymExpr(actual);
+      if (!se || se->var->type != formal->type)
+        return false;
+      if (formal->intent == INTENT_CONST_REF &&
+          (!isStableActual(se->var, addrTaken, splitSet) ||
+           isAliasedInCall(call, se->var, retRefMap)))
+        return false;
+    }
+  }
+  return true;
+}
+
+static bool
+isSplittableReturn(FnSymbol* fn) {
+  if (fn->retTag != RET_VALUE || !isSmallPODAggregate(fn->retType))
+    return false;
+  Symbol* ret = fn->getReturnSymbol();
+  if (!ret || ret->type != fn->retType)
+    return false;
+  forv_Vec(CallExpr, call, *fn->calledBy) {
+    if (CallExpr* move = toCallExpr(call->parentExpr)) {
+      if (!move->isPrimitive(PRIM_MOVE) || move->get(2) != call)
+        return false;
+      SymExpr* lhs = toSymExpr(move->get(1));
+      if (!lhs || lhs->var->type != fn->retType)
+        return false;
+    }
+  }
+  return true;
+}
+
+//
+// find the formals and return values that can be split.  Every
+// reference to their function must be the base of a splittable call,
+// so that all of its callers are known.
+//
+static void
+findSplits(ArgSet& splitSet, Vec<FnSymbol*>& argFns,
+           Vec<FnSymbol*>& retFns) {
+  Vec<FnSymbol*> escaped;
+  Vec<Symbol*> addrTaken;
+  SymbolMap retRefMap;
+
+  forv_Vec(SymExpr, se, gSymExprs) {
+    if (!se->parentSymbol)
+      continue;
+    CallExpr* call = toCallExpr(se->parentExpr);
+    if (FnSymbol* fn = toFnSymbol(se->var)) {
+      if (!call || call->baseExpr != se || !isSplittableCallSite(call))
+        escaped.set_add(fn);
+    } else if (call && (call->isPrimitive(PRIM_ADDR_OF) ||
+                        call->isPrimitive(PRIM_GET_MEMBER))) {
+      if (call->get(1) == se) {
+        CallExpr* move = toCallExpr(call->parentExpr);
+        Symbol* ref = isRetRef(move) ? toSymExpr(move->get(1))->var : NULL;
+        if (call->isPrimitive(PRIM_ADDR_OF) && ref &&
+            (!retRefMap.get(ref) || retRefMap.get(ref) == se->var))
+          retRefMap.put(ref, se->var);
+        else
+          addrTaken.set_add(se->var);
+      }
+    } else if (call && call->isResolved()) {
+      ArgSymbol* formal = actual_to_formal(se);
+      if (formal->intent == INTENT_REF && formal->type == se->var->type)
+        addrTaken.set_add(se->var);
+    }
+  }
+
+  //
+  // the address of a variable that is only passed on as the reference
+  // through which a record is returned is not kept past those calls
+  //
+  forv_Vec(SymExpr, se, gSymExprs) {
+    if (!se->parentSymbol)
+      continue;
+    if (Symbol* sym = retRefMap.get(se->var)) {
+      CallExpr* call = toCallExpr(se->parentExpr);
+      if (isRetRef(call) && call->get(1) == se)
+        continue;
+      if (call && call->isResolved()) {
+        FnSymbol* fn = call->isResolved();
+        ArgSymbol* formal = actual_to_formal(se);
+        if (formal == toDefExpr(fn->formals.tail)->sym &&
+            !strcmp(formal->name, "_retArg"))
+          continue;
+      }
+      addrTaken.set_add(sym);
+    }
+  }
+
+  compute_call_sites();
+
+  Vec<FnSymbol*> fns;
+  forv_Vec(FnSymbol, fn, gFnSymbols) {
+    if (!fn->defPoint->parentSymbol || escaped.set_in(fn) ||
+        fn->calledBy->n == 0 || !canSplitAggregateArgs(fn))
+      continue;
+    fns.add(fn);
+    for_formals(formal, fn) {
+      if (isSplittableFormal(fn, formal))
+        splitSet.insert(formal);
+    }
+    if (isSplittableReturn(fn))
+      retFns.add(fn);
+  }
+
+  //
+  // a const ref formal passed on by const ref is only split if the
+  // formal it is passed from is, so drop formals until none changes
+  //
+  bool change = true;
+  while (change) {
+    change = false;
+    forv_Vec(FnSymbol, fn, fns) {
+      for_formals(formal, fn) {
+        if (splitSet.count(formal) &&
+            !canSplitActuals(fn, formal, addrTaken, retRefMap,
+                             splitSet)) {
+          splitSet.erase(formal);
+          change = true;
+        }
+      }
+    }
+  }
+
+  forv_Vec(FnSymbol, fn, fns) {
+    for_formals(formal, fn) {
+      if (splitSet.count(formal)) {
+        argFns.add(fn);
+        break;
+      }
+    }
+  }
+}
+
+//
+// pass the fields of each split actual of call in place of the actual;
+// for a returned record, pass references to temporaries and copy them
+// into the record after the call
+//
+static void
+splitActuals(FnSymbol* fn, CallExpr* call, ArgSet& splitSet) {
+  SET_LINENO(call);
+  Expr* stmt = call->getStmtExpr();
+  Vec<SymExpr*> actuals;
+
+  for_formals_actuals(formal, actual, call) {
+    if (splitSet.count(formal))
+      actuals.add(toSymExpr(actual));
+  }
+
+  forv_Vec(SymExpr, actual, actuals) {
+    Symbol* sym = actual->var;
+    AggregateType* ct = toAggregateType(sym->type->getValType());
+    Expr* last = stmt;
+    for_fields(field, ct) {
+      VarSymbol* tmp = newTemp(astr(sym->name, "_", field->name),
+                               field->type);
+      stmt->insertBefore(new DefExpr(tmp));
+      if (sym->type == ct) {
+        stmt->insertBefore(new CallExpr(PRIM_MOVE, tmp,
+                             new CallExpr(PRIM_GET_MEMBER_VALUE, sym, field)));
+        actual->insertBefore(new SymExpr(tmp));
+      } else {
+        VarSymbol* ref = newTemp(astr(sym->name, "_", field->name),
+                                 field->type->refType);
+        stmt->insertBefore(new DefExpr(ref));
+        stmt->insertBefore(new CallExpr(PRIM_MOVE, ref,
+                             new CallExpr(PRIM_ADDR_OF, tmp)));
+        actual->insertBefore(new SymExpr(ref));
+        last->insertAfter(new CallExpr(PRIM_SET_MEMBER, sym, field, tmp));
+        last = last->next;
+      }
+    }
+    actual->remove();
+  }
+}
+
+//
+// replace each split formal of fn by one formal per field, and rebuild
+// the aggregate from them on entry, or for a returned record, copy it
+// out through them on return
+//
+static void
+splitFormals(FnSymbol* fn, ArgSet& splitSet) {
+  SET_LINENO(fn);
+  std::vector<SymExpr*> symExprs;
+  collectSymExprsSTL(fn->body, symExprs);
+
+  for_formals(formal, fn) {
+    if (!splitSet.count(formal))
+      continue;
+    AggregateType* ct = toAggregateType(formal->type->getValType());
+    bool isRet = formal->type != ct;
+    VarSymbol* var = new VarSymbol(isRet ? "ret" : formal->name, ct);
+    Expr* last = new DefExpr(var);
+    fn->insertAtHead(last);
+    for_fields(field, ct) {
+      if (isRet) {
+        ArgSymbol* arg = new ArgSymbol(INTENT_REF,
+                                       astr("_ret_", field->name),
+                                       field->type->refType);
+        VarSymbol* tmp = newTemp(astr("ret_", field->name), field->type);
+        formal->defPoint->insertBefore(new DefExpr(arg));
+        fn->insertBeforeReturnAfterLabel(new DefExpr(tmp));
+        fn->insertBeforeReturnAfterLabel(
+          new CallExpr(PRIM_MOVE, tmp,
+                       new CallExpr(PRIM_GET_MEMBER_VALUE, var, field)));
+        fn->insertBeforeReturnAfterLabel(new CallExpr(PRIM_MOVE, arg, tmp));
+      } else {
+        ArgSymbol* arg = new ArgSymbol(formal->intent == INTENT_CONST_REF ?
+                                       INTENT_CONST_IN : formal->intent,
+                                       astr(formal->name, "_", field->name),
+                                       field->type);
+        formal->defPoint->insertBefore(new DefExpr(arg));
+        last->insertAfter(new CallExpr(PRIM_SET_MEMBER, var, field, arg));
+        last = last->next;
+      }
+    }
+    for_vector(SymExpr, se, symExprs) {
+      if (se->var == formal) {
+        CallExpr* call = toCallExpr(se->parentExpr);
+        if (isRet && call->isPrimitive(PRIM_DEREF))
+          call->replace(new SymExpr(var));
+        else
+          se->var = var;
+      }
+    }
+    formal->defPoint->remove();
+  }
+}
+
+//
+// return the value of fn through one reference formal per field, and
+// assign them to the left-hand side of each call after it
+//
+static void
+splitReturn(FnSymbol* fn) {
+  SET_LINENO(fn);
+  AggregateType* ct = toAggregateType(fn->retType);
+  Symbol* ret = fn->getReturnSymbol();
+
+  for_fields(field, ct) {
+    ArgSymbol* arg = new ArgSymbol(INTENT_REF, astr("_ret_", field->name),
+                                   field->type->refType);
+    VarSymbol* tmp = newTemp(astr(ret->name, "_", field->name), field->type);
+    fn->insertFormalAtTail(arg);
+    fn->insertBeforeReturnAfterLabel(new DefExpr(tmp));
+    fn->insertBeforeReturnAfterLabel(
+      new CallExpr(PRIM_MOVE, tmp,
+                   new CallExpr(PRIM_GET_MEMBER_VALUE, ret, field)));
+    fn->insertBeforeReturnAfterLabel(new CallExpr(PRIM_MOVE, arg, tmp));
+  }
+  fn->retType = dtVoid;
+  CallExpr* retStmt = toCallExpr(fn->body->body.tail);
+  retStmt->get(1)->replace(new SymExpr(gVoid));
+
+  forv_Vec(CallExpr, call, *fn->calledBy) {
+    SET_LINENO(call);
+    CallExpr* move = toCallExpr(call->parentExpr);
+    Symbol* lhs = NULL;
+    if (move) {
+      lhs = toSymExpr(move->get(1))->var;
+      move->replace(call->remove());
+    }
+    Expr* last = call;
+    for_fields(field, ct) {
+      VarSymbol* tmp = newTemp(astr("call_", field->name), field->type);
+      VarSymbol* ref = newTemp(astr("call_", field->name),
+                               field->type->refType);
+      call->insertBefore(new DefExpr(tmp));
+      call->insertBefore(new DefExpr(ref));
+      call->insertBefore(new CallExpr(PRIM_MOVE, ref,
+                           new CallExpr(PRIM_ADDR_OF, tmp)));
+      call->insertAtTail(ref);
+      if (lhs) {
+        last->insertAfter(new CallExpr(PRIM_SET_MEMBER, lhs, field, tmp));
+        last = last->next;
+      }
+    }
+  }
+}
+
+//
+// split the small POD aggregates passed to and returned from functions
+// whose callers are all known into their fields, so that they can be
+// scalar replaced on both sides of the call
+//
+static void
+splitAggregateArgs() {
+  ArgSet splitSet;
+  Vec<FnSymbol*> argFns;
+  Vec<FnSymbol*> retFns;
+
+  findSplits(splitSet, argFns, retFns);
+
+  forv_Vec(FnSymbol, fn, argFns) {
+    forv_Vec(CallExpr, call, *fn->calledBy) {
+      splitActuals(fn, call, splitSet);
+    }
+  }
+  forv_Vec(FnSymbol, fn, argFns) {
+    splitFormals(fn, splitSet);
+  }
+  forv_Vec(FnSymbol, fn, retFns) {
+    splitReturn(fn);
+  }
+}
+
 void
 scalarReplace() {
   if (!fNoScalarReplacement) {
 
+    splitAggregateArgs();
+
     //
     // initialize typeOrder map and identify types that are candidates
     // for scalar replacement
@@ -533,7 +1075,8 @@ scalarReplace() {
         if (ts->hasFlag(FLAG_ITERATOR_CLASS) ||
             ts->hasFlag(FLAG_ITERATOR_RECORD) ||
             (ts->hasFlag(FLAG_TUPLE) &&
-             (ct->fields.length<=scalar_replace_limit))) {
+             (ct->fields.length<=scalar_replace_limit)) ||
+            isSmallPODAggregate(ct)) {
           typeVec.add(ct);
           typeVarMap.put(ct, new Vec<Symbol*>());
           if (AggregateType* rct = toAggregateType(ct->refType))
@@ -0,0 +1,342 @@
+// Hand-written stand-in for the flex-generated scanner (local build only).
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "lexyacc.h"
+#include "chapel.tab.h"
+
+FILE* yyin = NULL;
+static std::vector<char> yytextbuf(1, '\0');
+char* yytext = &yytextbuf[0];
+
+static std::string lexbuf;
+static size_t lexpos = 0;
+static bool needReload = true;
+static bool stringMode = false;
+static int yy_start_state = 0;
+
+#define INITIAL 0
+#define externmode 1
+#define BEGIN(s) yy_start_state = (s)
+#define YY_NEW_FILE yy_new_file()
+
+static void setText(size_t start, size_t len) {
+  yytextbuf.assign(lexbuf.begin() + start, lexbuf.begin() + start + len);
+  yytextbuf.push_back('\0');
+  yytext = &yytextbuf[0];
+}
+
+static void yy_new_file() {
+  stringMode = false;
+  needReload = true;
+}
+
+static void yy_scan_string(const char* s) {
+  lexbuf = s;
+  lexpos = 0;
+  stringMode = true;
+  needReload = false;
+}
+
+static void reload() {
+  lexbuf.clear();
+  lexpos = 0;
+  if (yyin) {
+    char tmp[65536];
+    size_t n;
+    while ((n = fread(tmp, 1, sizeof(tmp), yyin)) > 0)
+      lexbuf.append(tmp, n);
+  }
+  needReload = false;
+}
+
+static int yyinput() {
+  if (lexpos >= lexbuf.size()) return EOF;
+  return (unsigned char)lexbuf[lexpos++];
+}
+
+#define processToken(t)                         \
+  countToken(yytext);                           \
+  if (captureTokens) {                          \
+    if (t == TASSIGN ||                         \
+        t == TDOTDOTDOT)                        \
+      strcat(captureString, " ");               \
+    if (t != TLCBR)                             \
+      strcat(captureString, yytext);            \
+    if (t == TCOMMA ||                          \
+        t == TPARAM ||                          \
+        t == TZIP  ||                           \
+        t == TTYPE ||                           \
+        t == TCONST ||                          \
+        t == TIN ||                             \
+        t == TINOUT ||                          \
+        t == TOUT ||                            \
+        t == TREF ||                            \
+        t == TCOLON ||                          \
+        t == TASSIGN ||                         \
+        t == TRSBR)                             \
+      strcat(captureString, " ");               \
+  }                                             \
+  BEGIN(INITIAL);                               \
+  return(t)
+
+#define processStringLiteral(q)            \
+  yylval.pch = eatStringLiteral(q);        \
+  countToken(astr(q, yylval.pch, q)); \
+  if (captureTokens) {                     \
+    strcat(captureString, yytext);         \
+    strcat(captureString, yylval.pch);     \
+    strcat(captureString, yytext);         \
+  }                                        \
+  BEGIN(INITIAL);                          \
+  return(STRINGLITERAL)
+
+#define processExtern()                    \
+  countToken(yytext);                      \
+  if (captureTokens) {                     \
+    strcat(captureString, yytext);         \
+  }                                        \
+  BEGIN(externmode);                       \
+  return TEXTERN;
+
+#define processExternCode()                \
+  yylval.pch = eatExternCode();            \
+  countToken(astr(yylval.pch));            \
+  if (captureTokens) {                     \
+    strcat(captureString, yylval.pch);     \
+  }                                        \
+  BEGIN(INITIAL);                          \
+  return(EXTERNCODE)
+
+struct KW { const char* s; int t; };
+static const KW keywords[] = {
+  {"align", TALIGN}, {"atomic", TATOMIC}, {"begin", TBEGIN},
+  {"break", TBREAK}, {"by", TBY}, {"class", TCLASS},
+  {"cobegin", TCOBEGIN}, {"coforall", TCOFORALL}, {"config", TCONFIG},
+  {"const", TCONST}, {"continue", TCONTINUE}, {"delete", TDELETE},
+  {"dmapped", TDMAPPED}, {"do", TDO}, {"domain", TDOMAIN},
+  {"else", TELSE}, {"enum", TENUM}, {"export", TEXPORT},
+  {"extern", TEXTERN}, {"for", TFOR}, {"forall", TFORALL}, {"if", TIF},
+  {"in", TIN}, {"index", TINDEX}, {"inline", TINLINE}, {"inout", TINOUT},
+  {"iter", TITER}, {"label", TLABEL}, {"lambda", TLAMBDA}, {"let", TLET},
+  {"local", TLOCAL}, {"module", TMODULE}, {"new", TNEW}, {"nil", TNIL},
+  {"noinit", TNOINIT}, {"on", TON}, {"otherwise", TOTHERWISE},
+  {"out", TOUT}, {"param", TPARAM}, {"zip", TZIP}, {"pragma", TPRAGMA},
+  {"__primitive", TPRIMITIVE}, {"proc", TPROC}, {"record", TRECORD},
+  {"reduce", TREDUCE}, {"ref", TREF}, {"return", TRETURN},
+  {"scan", TSCAN}, {"select", TSELECT}, {"serial", TSERIAL},
+  {"single", TSINGLE}, {"sparse", TSPARSE}, {"subdomain", TSUBDOMAIN},
+  {"sync", TSYNC}, {"then", TTHEN}, {"type", TTYPE}, {"union", TUNION},
+  {"use", TUSE}, {"var", TVAR}, {"when", TWHEN}, {"where", TWHERE},
+  {"while", TWHILE}, {"with", TWITH}, {"yield", TYIELD},
+  {"_", TUNDERSCORE}, {NULL, 0}
+};
+
+static const KW ops[] = {
+  {"<=>", TSWAP}, {"<~>", TIO}, {"**=", TASSIGNEXP}, {"&&=", TASSIGNLAND},
+  {"||=", TASSIGNLOR}, {"<<=", TASSIGNSL}, {">>=", TASSIGNSR},
+  {"...", TDOTDOTDOT},
+  {"+=", TASSIGNPLUS}, {"-=", TASSIGNMINUS}, {"*=", TASSIGNMULTIPLY},
+  {"/=", TASSIGNDIVIDE}, {"%=", TASSIGNMOD}, {"&=", TASSIGNBAND},
+  {"|=", TASSIGNBOR}, {"^=", TASSIGNBXOR}, {"=>", TALIAS},
+  {"..", TDOTDOT}, {"&&", TAND}, {"||", TOR}, {"<<", TSHIFTLEFT},
+  {">>", TSHIFTRIGHT}, {"==", TEQUAL}, {"!=", TNOTEQUAL},
+  {"<=", TLESSEQUAL}, {">=", TGREATEREQUAL}, {"--", TMINUSMINUS},
+  {"++", TPLUSPLUS}, {"**", TEXP},
+  {"=", TASSIGN}, {"#", THASH}, {"!", TNOT}, {"&", TBAND}, {"|", TBOR},
+  {"^", TBXOR}, {"~", TBNOT}, {"<", TLESS}, {">", TGREATER},
+  {"+", TPLUS}, {"-", TMINUS}, {"*", TSTAR}, {"/", TDIVIDE},
+  {"%", TMOD}, {":", TCOLON}, {";", TSEMI}, {",", TCOMMA}, {".", TDOT},
+  {"(", TLP}, {")", TRP}, {"[", TLSBR}, {"]", TRSBR}, {"}", TRCBR},
+  {"?", TQUESTION}, {NULL, 0}
+};
+
+static inline bool isDigit(char c) { return c >= '0' && c <= '9'; }
+static inline bool isLetter(char c) {
+  return c == '_' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+static inline bool isHex(char c) {
+  return isDigit(c) || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+static inline char at(size_t p) {
+  return p < lexbuf.size() ? lexbuf[p] : '\0';
+}
+
+static size_t matchExponent(size_t p) {
+  if (at(p) != 'e' && at(p) != 'E') return 0;
+  size_t q = p + 1;
+  if (at(q) == '+' || at(q) == '-') q++;
+  if (!isDigit(at(q))) return 0;
+  while (isDigit(at(q))) q++;
+  return q - p;
+}
+
+static size_t matchFloat(size_t p) {
+  size_t best = 0;
+  // {digit}*"."{digit}+({exponent})?
+  size_t q = p;
+  while (isDigit(at(q))) q++;
+  size_t digits = q - p;
+  if (at(q) == '.' && isDigit(at(q+1))) {
+    size_t r = q + 1;
+    while (isDigit(at(r))) r++;
+    r += matchExponent(r);
+    if (r - p > best) best = r - p;
+  }
+  if (digits > 0) {
+    // {digit}+"."{exponent}
+    if (at(q) == '.') {
+      size_t e = matchExponent(q + 1);
+      if (e && q + 1 + e - p > best) best = q + 1 + e - p;
+    }
+    // {digit}+{exponent}
+    size_t e = matchExponent(q);
+    if (e && q + e - p > best) best = q + e - p;
+  }
+  return best;
+}
+
+static size_t matchInt(size_t p) {
+  size_t best = 0;
+  size_t q = p;
+  while (isDigit(at(q))) q++;
+  best = q - p;
+  if (at(p) == '0') {
+    char c = at(p+1);
+    q = p + 2;
+    if (c == 'b' || c == 'B') {
+      while (at(q) == '0' || at(q) == '1') q++;
+    } else if (c == 'o' || c == 'O') {
+      while (at(q) >= '0' && at(q) <= '7') q++;
+    } else if (c == 'x' || c == 'X') {
+      while (isHex(at(q))) q++;
+    }
+    if (q > p + 2 && q - p > best) best = q - p;
+  }
+  return best;
+}
+
+int yylex(void) {
+  if (needReload && !stringMode) reload();
+  for (;;) {
+    if (lexpos >= lexbuf.size()) {
+      needReload = !stringMode;
+      yytextbuf.assign(1, '\0');
+      yytext = &yytextbuf[0];
+      return 0;
+    }
+    size_t p = lexpos;
+    char c = lexbuf[p];
+
+    if (isLetter(c)) {
+      size_t q = p;
+      while (isLetter(at(q)) || isDigit(at(q)) || at(q) == '$') q++;
+      lexpos = q;
+      setText(p, q - p);
+      for (int i = 0; keywords[i].s; i++) {
+        if (!strcmp(keywords[i].s, yytext)) {
+          if (keywords[i].t == TEXTERN) {
+            processExtern();
+          }
+          int t = keywords[i].t;
+          processToken(t);
+        }
+      }
+      processToken(TIDENT);
+    }
+
+    if (isDigit(c) || (c == '.' && isDigit(at(p+1)))) {
+      size_t fl = matchFloat(p);
+      size_t il = isDigit(c) ? matchInt(p) : 0;
+      size_t len = fl > il ? fl : il;
+      int tok = fl > il ? REALLITERAL : INTLITERAL;
+      size_t imag = 0;
+      if (fl && at(p + fl) == 'i') imag = fl + 1;
+      if (il && at(p + il) == 'i' && il + 1 > imag) imag = il + 1;
+      if (imag > len) { len = imag; tok = IMAGLITERAL; }
+      lexpos = p + len;
+      setText(p, len);
+      processToken(tok);
+    }
+
+    if (c == '"' || c == '\'') {
+      lexpos = p + 1;
+      setText(p, 1);
+      if (c == '"') {
+        processStringLiteral("\"");
+      } else {
+        processStringLiteral("\'");
+      }
+    }
+    if (c == ' ' || c == '\t' || c == '\r') {
+      lexpos = p + 1;
+      setText(p, 1);
+      processWhitespace(yytext);
+      continue;
+    }
+    if (c == '\n') {
+      lexpos = p + 1;
+      setText(p, 1);
+      processNewline();
+      continue;
+    }
+    if (c == '/' && at(p+1) == '/') {
+      lexpos = p + 2;
+      setText(p, 2);
+      processSingleLineComment();
+      continue;
+    }
+    if (c == '/' && at(p+1) == '*') {
+      lexpos = p + 2;
+      setText(p, 2);
+      processMultiLineComment();
+      continue;
+    }
+    if (c == '{') {
+      lexpos = p + 1;
+      setText(p, 1);
+      if (yy_start_state == externmode) {
+        processExternCode();
+      }
+      processToken(TLCBR);
+    }
+    for (int i = 0; ops[i].s; i++) {
+      size_t n = strlen(ops[i].s);
+      if (!lexbuf.compare(p, n, ops[i].s)) {
+        lexpos = p + n;
+        setText(p, n);
+        int t = ops[i].t;
+        processToken(t);
+      }
+    }
+    lexpos = p + 1;
+    setText(p, 1);
+    processInvalidToken();
+  }
+}
+
+int getNextYYChar() {
+  int retval = yyinput();
+  if (retval == EOF) {
+    retval = 0;
+  }
+  return retval;
+}
+
+bool chplParseString;
+const char *chplParseStringMsg = NULL;
+BlockStmt*
+parseString(const char* string, const char* filename, const char* msg) {
+  yyblock = NULL;
+  yyfilename = filename;
+  chplParseString = true;
+  chplParseStringMsg = msg;
+  yy_scan_string(string);
+  yyparse();
+  chplParseString = false;
+  chplParseStringMsg = NULL;
+  YY_NEW_FILE;
+  return yyblock;
+}
@@ -244,6 +244,72 @@ genFtable(Vec<FnSymbol*> & fSymbols) {
   }
 }
 
+//
+// Write 'str' as a C string literal.  String immediates are already
+// stored with C escapes, but the fingerprints below are raw text.
+//
+static void
+fprintCString(FILE* outfile, const char* str) {
+  fputc('"', outfile);
+  for (const char* c = str; *c != '\0'; c++) {
+    if (*c == '"' || *c == '\\')
+      fprintf(outfile, "\\%c", *c);
+    else if (!isprint((unsigned char) *c))
+      fprintf(outfile, "\\%03o", (unsigned char) *c);
+    else
+      fputc(*c, outfile);
+  }
+  fputc('"', outfile);
+}
+
+//
+// The fingerprint of each call site counted by --profile-generate, for
+// the profile to record so that --profile-use can tell if it is stale.
+//
+static void
+genCallSiteTable(Vec<const char*>& sites) {
+  GenInfo* info = gGenInfo;
+  const char* table_name = "chpl_callSiteNames";
+  if( info->cfile ) {
+    FILE* hdrfile = info->cfile;
+    fprintf(hdrfile, "const char* %s[] = {\n", table_name);
+    bool first = true;
+    forv_Vec(const char*, site, sites) {
+      if (!first)
+        fprintf(hdrfile, ",\n");
+      fprintCString(hdrfile, site);
+      first = false;
+    }
+
+    if (sites.n == 0)
+      fprintf(hdrfile, "(const char*)0");
+    fprintf(hdrfile, "\n};\n");
+  } else {
+#ifdef HAVE_LLVM
+    llvm::Type *strType =
+      llvm::IntegerType::getInt8PtrTy(info->module->getContext());
+    std::vector<llvm::Constant *> table ((sites.n == 0) ? 1 : sites.n);
+
+    int siteID = 0;
+    forv_Vec(const char*, site, sites) {
+      table[siteID++] = llvm::cast<llvm::Constant>(
+          info->builder->CreateGlobalStringPtr(site));
+    }
+    if (sites.n == 0) {
+      table[0] = llvm::Constant::getNullValue(strType);
+    }
+
+    llvm::ArrayType *tableType = llvm::ArrayType::get(strType, table.size());
+
+    llvm::GlobalVariable *siteTable = llvm::cast<llvm::GlobalVariable>(
+        info->module->getOrInsertGlobal(table_name, tableType));
+    siteTable->setInitializer(llvm::ConstantArray::get(tableType, table));
+    siteTable->setConstant(true);
+    info->lvt->addGlobalValue(table_name, siteTable, GEN_PTR, true);
+#endif
+  }
+}
+
 static void
 genVirtualMethodTable(Vec<TypeSymbol*>& types) {
   GenInfo* info = gGenInfo;
@@ -804,6 +870,8 @@ static void codegen_header() {
   flushStatements();
 
   genGlobalInt("chpl_numGlobalsOnHeap", numGlobalsOnHeap);
+  genGlobalInt("chpl_numCallSites", profiledCallSites.n);
+  genCallSiteTable(profiledCallSites);
   int globals_registry_static_size = (numGlobalsOnHeap ? numGlobalsOnHeap : 1);
   if( hdrfile ) {
     fprintf(hdrfile, "\nptr_wide_ptr_t chpl_globals_registry[%d];\n",
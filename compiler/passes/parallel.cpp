@@ -34,6 +34,8 @@
 #include "stringutil.h"
 #include "symbol.h"
 
+#include <map>
+
 // Notes on
 //   makeHeapAllocations()    //invoked from parallel()
 //   insertWideReferences()
@@ -108,6 +110,7 @@ static void create_block_fn_wrapper(FnSymbol* fn, CallExpr* fcall, BundleArgsFnD
 static void call_block_fn_wrapper(FnSymbol* fn, CallExpr* fcall, VarSymbol* tempc, FnSymbol *wrap_fn);
 static void findBlockRefActuals(Vec<Symbol*>& refSet, Vec<Symbol*>& refVec);
 static void findHeapVarsAndRefs(Map<Symbol*,Vec<SymExpr*>*>& defMap,
+                                Map<Symbol*,Vec<SymExpr*>*>& useMap,
                                 Vec<Symbol*>& refSet, Vec<Symbol*>& refVec,
                                 Vec<Symbol*>& varSet, Vec<Symbol*>& varVec);
 
@@ -288,6 +291,28 @@ static Symbol* insertAutoCopyDestroyForTaskArg
 }
 
 
+// Allocate the bundle 'tempc' from the runtime's per-thread pool
+// rather than with chpl_here_alloc().  A bundle is built for every
+// task and every 'on', and freed as soon as the body starts running
+// (or, for an 'on', as soon as the fork returns), so the block a task
+// frees is usually reused by the next spawn on that thread.
+static void insertTaskArgsAlloc(CallExpr* fcall, VarSymbol* tempc,
+                                AggregateType* ctype) {
+  VarSymbol* sizeTmp = newTemp("_args_size", SIZE_TYPE);
+  VarSymbol* allocTmp = newTemp("_args_alloc", dtOpaque);
+  fcall->insertBefore(new DefExpr(sizeTmp));
+  fcall->insertBefore(new DefExpr(allocTmp));
+  fcall->insertBefore(new CallExpr(PRIM_MOVE, sizeTmp,
+                                   new CallExpr(PRIM_SIZEOF, ctype->symbol)));
+  fcall->insertBefore(new CallExpr(PRIM_MOVE, allocTmp,
+                                   new CallExpr(PRIM_TASK_ARGS_ALLOC, sizeTmp,
+                                                newMemDesc("bundled args"))));
+  fcall->insertBefore(new CallExpr(PRIM_MOVE, tempc,
+                                   new CallExpr(PRIM_CAST, ctype->symbol,
+                                                allocTmp)));
+}
+
+
 static void
 bundleArgs(CallExpr* fcall, BundleArgsFnData &baData) {
   SET_LINENO(fcall);
@@ -302,8 +327,7 @@ bundleArgs(CallExpr* fcall, BundleArgsFnData &baData) {
   // create the class variable instance and allocate space for it
   VarSymbol *tempc = newTemp(astr("_args_for", fn->name), ctype);
   fcall->insertBefore( new DefExpr( tempc));
-  insertChplHereAlloc(fcall, false /*insertAfter*/, tempc,
-                      ctype, newMemDesc("bundled args"));
+  insertTaskArgsAlloc(fcall, tempc, ctype);
 
   // set the references in the class instance
   int i = 1;
@@ -408,7 +432,7 @@ static void create_block_fn_wrapper(FnSymbol* fn, CallExpr* fcall, BundleArgsFnD
   if (fn->hasFlag(FLAG_ON))
     ; // the caller will free the actual
   else
-    wrap_fn->insertAtTail(callChplHereFree(wrap_c));
+    wrap_fn->insertAtTail(new CallExpr(PRIM_TASK_ARGS_FREE, wrap_c));
 
   wrap_fn->insertAtTail(new CallExpr(PRIM_RETURN, gVoid));
 
@@ -433,7 +457,7 @@ static void call_block_fn_wrapper(FnSymbol* fn, CallExpr* fcall, VarSymbol* temp
     fcall->insertBefore(new CallExpr(wrap_fn, tempc));
 
   if (fn->hasFlag(FLAG_ON))
-    fcall->insertAfter(callChplHereFree(tempc));
+    fcall->insertAfter(new CallExpr(PRIM_TASK_ARGS_FREE, tempc));
   else
     ; // wrap_fn will free the formal
 
@@ -547,10 +571,10 @@ buildHeapType(Type* type) {
 }
 
 
+// Collect the functions created from begin, cobegin, and coforall
+// statements along with every function that (transitively) calls one.
 static void
-freeHeapAllocatedVars(Vec<Symbol*> heapAllocatedVars) {
-  Vec<FnSymbol*> fnsContainingTaskll;
-
+findFnsContainingTasks(Vec<FnSymbol*>& fnsContainingTaskll) {
   // start with the functions created from begin, cobegin, and coforall statements
   forv_Vec(FnSymbol, fn, gFnSymbols) {
     if (fn->hasFlag(FLAG_BEGIN) || fn->hasFlag(FLAG_COBEGIN_OR_COFORALL) ||
@@ -567,6 +591,13 @@ freeHeapAllocatedVars(Vec<Symbol*> heapAllocatedVars) {
       }
     }
   }
+}
+
+
+static void
+freeHeapAllocatedVars(Vec<Symbol*> heapAllocatedVars) {
+  Vec<FnSymbol*> fnsContainingTaskll;
+  findFnsContainingTasks(fnsContainingTaskll);
 
   Vec<Symbol*> symSet;
   Vec<BaseAST*> asts;
@@ -701,6 +732,91 @@ needHeapVars() {
 //   refSet, refVec - symbols whose referencees need to be heap-allocated
 //   varSet, varVec - symbols that themselves need to be heap-allocated
 //
+// heapReason records why each symbol was added to one of the sets, for
+// --report-heap-promotion.  Symbols added because of a reference
+// inherit the reason of that reference.
+//
+static std::map<Symbol*, const char*> heapReason;
+
+static void
+addHeapSym(Symbol* sym, Vec<Symbol*>& set, Vec<Symbol*>& vec,
+           const char* reason) {
+  if (!set.set_in(sym)) {
+    set.set_add(sym);
+    vec.add(sym);
+    if (heapReason.find(sym) == heapReason.end())
+      heapReason[sym] = reason;
+  }
+}
+
+static bool
+shouldReportHeapPromotion(Symbol* sym) {
+  if (!fReportHeapPromotion || !sym->defPoint)
+    return false;
+  ModuleSymbol* mod = sym->getModule();
+  return developer ||
+    (mod && mod->modTag != MOD_INTERNAL && mod->modTag != MOD_STANDARD);
+}
+
+//
+// Returns true if the address of coforall index variable 'var' can
+// reach a task.  The index variable is redefined on every iteration
+// of the loop that launches the tasks, so it only needs to be on the
+// heap if a task could still be looking at it after the iteration
+// ends.  Since the task bodies have been flattened, the only way for
+// that to happen is for 'var', or a reference derived from it, to be
+// passed to a function that creates tasks or to be stored somewhere
+// that outlives this statement.  Values copied out of 'var', such as
+// the components of a tuple index passed to the task by value, do not
+// count.
+//
+static bool
+coforallIndexReachesTask(Symbol* var,
+                         Map<Symbol*,Vec<SymExpr*>*>& useMap,
+                         Vec<FnSymbol*>& fnsContainingTaskll) {
+  Vec<Symbol*> aliases;
+  aliases.add(var);
+  forv_Vec(Symbol, v, aliases) {
+    for_uses(se, useMap, v) {
+      CallExpr* call = toCallExpr(se->parentExpr);
+      if (!call)
+        return true;
+      if (call->isPrimitive(PRIM_ADDR_OF) ||
+          call->isPrimitive(PRIM_GET_MEMBER) ||
+          call->isPrimitive(PRIM_GET_SVEC_MEMBER)) {
+        // a reference into 'v'; follow it if it is saved in a temp
+        CallExpr* move = toCallExpr(call->parentExpr);
+        if (!move || !move->isPrimitive(PRIM_MOVE))
+          return true;
+        aliases.add_exclusive(toSymExpr(move->get(1))->var);
+      } else if (call->isPrimitive(PRIM_MOVE) ||
+                 call->isPrimitive(PRIM_ASSIGN)) {
+        // copying a reference makes another alias; copying a value
+        // does not
+        if (call->get(2) == se &&
+            call->get(1)->typeInfo()->symbol->hasFlag(FLAG_REF))
+          aliases.add_exclusive(toSymExpr(call->get(1))->var);
+      } else if (call->isPrimitive(PRIM_SET_MEMBER) ||
+                 call->isPrimitive(PRIM_SET_SVEC_MEMBER) ||
+                 call->isPrimitive(PRIM_RETURN) ||
+                 call->isPrimitive(PRIM_YIELD)) {
+        // stored or returned; only safe if it is a copied value
+        if (call->get(1) != se && v->type->symbol->hasFlag(FLAG_REF))
+          return true;
+      } else if (FnSymbol* fn = call->isResolved()) {
+        if (fnsContainingTaskll.in(fn))
+          return true;
+        // a reference returned from a call may point into 'v'
+        if (fn->retType->symbol->hasFlag(FLAG_REF)) {
+          CallExpr* move = toCallExpr(call->parentExpr);
+          if (move && move->isPrimitive(PRIM_MOVE))
+            aliases.add_exclusive(toSymExpr(move->get(1))->var);
+        }
+      }
+    }
+  }
+  return false;
+}
 
 // Traverses all 'begin' or 'on' task functions flagged as needing heap
 // allocation (for its formals) or flagged as nonblockikng.
@@ -712,10 +828,12 @@ static void findBlockRefActuals(Vec<Symbol*>& refSet, Vec<Symbol*>& refVec)
     if (fn->hasFlag(FLAG_BEGIN) ||
         (fn->hasFlag(FLAG_ON) &&
          (needHeapVars() || fn->hasFlag(FLAG_NON_BLOCKING)))) {
+      const char* reason = fn->hasFlag(FLAG_BEGIN) ?
+        "shared by reference with a begin" :
+        "shared by reference with an on";
       for_formals(formal, fn) {
         if (formal->type->symbol->hasFlag(FLAG_REF)) {
-          refSet.set_add(formal);
-          refVec.add(formal);
+          addHeapSym(formal, refSet, refVec, reason);
         }
       }
     }
@@ -728,6 +846,7 @@ static void findBlockRefActuals(Vec<Symbol*>& refSet, Vec<Symbol*>& refVec)
 //   If it is of reference type,
 //    Add it to refSet and refVec.
 //   Otherwise, if it is not of primitive type or other undesired cases,
+//    and its address can reach one of the tasks,
 //    Add it to varSet and varVec.
 //  Otherwise, select module-level vars that are not private or extern.
 //   If the var is const and has value semantics except record-wrapped types,
@@ -736,19 +855,30 @@ static void findBlockRefActuals(Vec<Symbol*>& refSet, Vec<Symbol*>& refVec)
 //   Otherwise,
 //    Add it to varSet and varVec, so it will be put on the heap.
 static void findHeapVarsAndRefs(Map<Symbol*,Vec<SymExpr*>*>& defMap,
+                                Map<Symbol*,Vec<SymExpr*>*>& useMap,
                                 Vec<Symbol*>& refSet, Vec<Symbol*>& refVec,
                                 Vec<Symbol*>& varSet, Vec<Symbol*>& varVec)
 {
+  Vec<FnSymbol*> fnsContainingTaskll;
+  findFnsContainingTasks(fnsContainingTaskll);
+
   forv_Vec(DefExpr, def, gDefExprs) {
     SET_LINENO(def);
     if (def->sym->hasFlag(FLAG_COFORALL_INDEX_VAR)) {
       if (def->sym->type->symbol->hasFlag(FLAG_REF)) {
-        refSet.set_add(def->sym);
-        refVec.add(def->sym);
-      } else if (!isPrimitiveType(def->sym->type) ||
-                 toFnSymbol(def->parentSymbol)->retTag==RET_REF) {
-        varSet.set_add(def->sym);
-        varVec.add(def->sym);
+        addHeapSym(def->sym, refSet, refVec,
+                   "coforall index passed by reference to its task");
+      } else if (toFnSymbol(def->parentSymbol)->retTag==RET_REF) {
+        addHeapSym(def->sym, varSet, varVec,
+                   "coforall index in a function returning by reference");
+      } else if (!isPrimitiveType(def->sym->type)) {
+        if (coforallIndexReachesTask(def->sym, useMap, fnsContainingTaskll)) {
+          addHeapSym(def->sym, varSet, varVec,
+                     "coforall index passed by reference to its task");
+        } else if (shouldReportHeapPromotion(def->sym)) {
+          printf("Kept coforall index %s on the stack (%s:%d)\n",
+                 def->sym->name, def->fname(), def->linenum());
+        }
       }
     } else if (!fLocal &&
                isModuleSymbol(def->parentSymbol) &&
@@ -778,8 +908,8 @@ static void findHeapVarsAndRefs(Map<Symbol*,Vec<SymExpr*>*>& defMap,
         replicateGlobalRecordWrappedVars(def);
       } else {
         // put other global constants and all global variables on the heap
-        varSet.set_add(def->sym);
-        varVec.add(def->sym);
+        addHeapSym(def->sym, varSet, varVec,
+                   "module-level variable accessed remotely");
       }
     }
   }
@@ -797,10 +927,12 @@ makeHeapAllocations() {
   Map<Symbol*,Vec<SymExpr*>*> useMap;
   buildDefUseMaps(defMap, useMap);
 
+  heapReason.clear();
   findBlockRefActuals(refSet, refVec);
-  findHeapVarsAndRefs(defMap, refSet, refVec, varSet, varVec);
+  findHeapVarsAndRefs(defMap, useMap, refSet, refVec, varSet, varVec);
 
   forv_Vec(Symbol, ref, refVec) {
+    const char* reason = heapReason[ref];
     if (ArgSymbol* arg = toArgSymbol(ref)) {
       FnSymbol* fn = toFnSymbol(arg->defPoint->parentSymbol);
       forv_Vec(CallExpr, call, *fn->calledBy) {
@@ -810,10 +942,7 @@ makeHeapAllocations() {
             se = toSymExpr(actual);
         }
         INT_ASSERT(se->var->type->symbol->hasFlag(FLAG_REF));
-        if (!refSet.set_in(se->var)) {
-          refSet.set_add(se->var);
-          refVec.add(se->var);
-        }
+        addHeapSym(se->var, refSet, refVec, reason);
       }
     } else if (VarSymbol* var = toVarSymbol(ref)) {
       //      INT_ASSERT(defMap.get(var)->n == 1);
@@ -825,10 +954,7 @@ makeHeapAllocations() {
               if (rhs->isPrimitive(PRIM_ADDR_OF)) {
                 SymExpr* se = toSymExpr(rhs->get(1));
                 INT_ASSERT(se);
-                if (!varSet.set_in(se->var)) {
-                  varSet.set_add(se->var);
-                  varVec.add(se->var);
-                }
+                addHeapSym(se->var, varSet, varVec, reason);
               } else if (rhs->isPrimitive(PRIM_GET_MEMBER) ||
                          rhs->isPrimitive(PRIM_GET_MEMBER_VALUE) ||
                          rhs->isPrimitive(PRIM_GET_SVEC_MEMBER) ||
@@ -836,13 +962,9 @@ makeHeapAllocations() {
                 SymExpr* se = toSymExpr(rhs->get(1));
                 INT_ASSERT(se);
                 if (se->var->type->symbol->hasFlag(FLAG_REF)) {
-                  if (!refSet.set_in(se->var)) {
-                    refSet.set_add(se->var);
-                    refVec.add(se->var);
-                  }
-                } else if (!varSet.set_in(se->var)) {
-                  varSet.set_add(se->var);
-                  varVec.add(se->var);
+                  addHeapSym(se->var, refSet, refVec, reason);
+                } else {
+                  addHeapSym(se->var, varSet, varVec, reason);
                 }
               }
               //
@@ -863,10 +985,7 @@ makeHeapAllocations() {
               //
             } else if (SymExpr* rhs = toSymExpr(call->get(2))) {
               INT_ASSERT(rhs->var->type->symbol->hasFlag(FLAG_REF));
-              if (!refSet.set_in(rhs->var)) {
-                refSet.set_add(rhs->var);
-                refVec.add(rhs->var);
-              }
+              addHeapSym(rhs->var, refSet, refVec, reason);
             } else
               INT_FATAL(ref, "unexpected case");
           } else { // !call->isPrimitive(PRIM_MOVE)
@@ -917,8 +1036,7 @@ makeHeapAllocations() {
 
     if (ArgSymbol* arg = toArgSymbol(var)) {
       VarSymbol* tmp = newTemp(var->type);
-      varSet.set_add(tmp);
-      varVec.add(tmp);
+      addHeapSym(tmp, varSet, varVec, heapReason[var]);
       SymExpr* firstDef = new SymExpr(tmp);
       arg->getFunction()->insertAtHead(new CallExpr(PRIM_MOVE, firstDef, arg));
       addDef(defMap, firstDef);
@@ -947,6 +1065,11 @@ makeHeapAllocations() {
                           true /*insertAfter*/,var, heapType,
                           newMemDesc("local heap-converted data"));
       heapAllocatedVars.add(var);
+      if (shouldReportHeapPromotion(var)) {
+        printf("Moved %s to the heap: %s (%s:%d)\n", var->name,
+               heapReason[var] ? heapReason[var] : "shared with a task",
+               var->defPoint->fname(), var->defPoint->linenum());
+      }
     }
 
     for_defs(def, defMap, var) {
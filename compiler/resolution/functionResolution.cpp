@@ -725,7 +725,16 @@ protoIteratorClass(FnSymbol* fn) {
     rts->addFlag(FLAG_REF_ITERATOR_CLASS);
   fn->defPoint->insertBefore(new DefExpr(rts));
 
+  // An instantiated leader or follower has its iterKind tag among its
+  // substitutions.
   ii->tag = it_iterator;
+  form_Map(SymbolMapElem, e, fn->substitutions) {
+    if (e->value == gLeaderTag)
+      ii->tag = it_leader;
+    else if (e->value == gFollowerTag)
+      ii->tag = it_follower;
+  }
+
   ii->advance = protoIteratorMethod(ii, "advance", dtVoid);
   ii->zip1 = protoIteratorMethod(ii, "zip1", dtVoid);
   ii->zip2 = protoIteratorMethod(ii, "zip2", dtVoid);
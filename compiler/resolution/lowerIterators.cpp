@@ -27,10 +27,26 @@
 #include "passes.h"
 #include "resolution.h"
 #include "resolveIntents.h"
+#include "stlUtil.h"
 #include "stmt.h"
 #include "stringutil.h"
 #include "symbol.h"
 
+#include <map>
+#include <vector>
+
+// An iterator with several yields is inlined only if the copies of the
+// loop body, one per yield, hold no more than this many expressions.
+static const size_t iteratorInlineBudget = 512;
+
+// The extra copies are also counted against the function the loop is in,
+// which may grow by no more than this many expressions in all.  Without
+// this, loops nested in a copied body are themselves copied for each of
+// their yields, and the growth is exponential in the depth of the nest.
+static const size_t iteratorInlineGrowthBudget = 2 * iteratorInlineBudget;
+
+static std::map<Symbol*, size_t> iteratorInlineGrowth;
+
 
 // This consistency check should probably be moved earlier in the compilation.
 // It needs to be after resolution because it sets FLAG_INLINE_ITERATOR.
@@ -1149,7 +1165,62 @@ expandBodyForIteratorInline(ForLoop*       forLoop,
                             bool           removeReturn,
                             TaskFnCopyMap& taskFnCopies);
 
+static void
+inlineIteratorBody(ForLoop* forLoop, Symbol* ic, Symbol* index);
+
+static void
+reportUninlinedIterator(ForLoop* forLoop, Symbol* ic, const char* reason);
+
 /// \param call A for loop block primitive.
+//
+// Can the loops around the yields of 'iterator' run in any order when
+// the loop that invokes it can?  Only if nothing but the invoking loop's
+// body is carried from one yield to the next, which is known for the
+// followers of the internal and standard modules and of promotion, and
+// for the serial iterators these followers loop over.  A user's
+// follower may keep state of its own across yields.
+//
+static bool
+isOrderIndependentIterator(FnSymbol* iterator) {
+  ModuleSymbol* mod = iterator->getModule();
+
+  if (iterator->iteratorInfo->tag == it_leader)
+    return false;
+
+  return iterator->hasFlag(FLAG_COMPILER_GENERATED) == true ||
+         iterator->hasFlag(FLAG_PROMOTION_WRAPPER)  == true ||
+         mod->modTag == MOD_INTERNAL                      ||
+         mod->modTag == MOD_STANDARD;
+}
+
+//
+// The innermost loop of an inlined iterator around a yield runs the
+// copy of the invoking loop's body that replaces the yield once per
+// iteration.  When that body may run in any order (a forall follower),
+// so may that loop.  A marked ForLoop passes this on to the iterator
+// inlined into it, so the innermost loop of a nest gets the mark and
+// the loops around it, which step the outer dimensions, do not.
+//
+static void
+markOrderIndependentLoops(BlockStmt* ibody) {
+  Vec<CallExpr*> calls;
+
+  collectCallExprs(ibody, calls);
+
+  forv_Vec(CallExpr, call, calls) {
+    if (call->isPrimitive(PRIM_YIELD)) {
+      for (Expr* expr = call->parentExpr;
+           expr != NULL && expr != ibody;
+           expr = expr->parentExpr) {
+        if (LoopStmt* loop = toLoopStmt(expr)) {
+          loop->orderIndependentSet(true);
+          break;
+        }
+      }
+    }
+  }
+}
+
 static void
 expandIteratorInline(ForLoop* forLoop) {
   Symbol*   ic       = forLoop->iteratorGet()->var;
@@ -1168,32 +1239,112 @@ expandIteratorInline(ForLoop* forLoop) {
     } else if (taskFunInRecursiveIteratorSet.set_in(forLoop->parentSymbol)) {
 
     } else {
+      if (fReportUninlinedIterators)
+        reportUninlinedIterator(forLoop, ic, "it is recursive");
+
       expandRecursiveIteratorInline(forLoop);
     }
 
   } else {
     SET_LINENO(forLoop);
 
-    Symbol*       index = forLoop->indexGet()->var;
-    BlockStmt*    ibody = iterator->body->copy();
-    Vec<BaseAST*> asts;
+    inlineIteratorBody(forLoop, ic, forLoop->indexGet()->var);
+  }
+}
 
-    if (preserveInlinedLineNumbers == false) {
-      reset_ast_loc(ibody, forLoop);
-    }
+//
+// Replace 'forLoop' by the body of the iterator of 'ic', with each
+// yield replaced by a copy of the loop body that reads the yielded
+// value as 'index'.
+//
+static void
+inlineIteratorBody(ForLoop* forLoop, Symbol* ic, Symbol* index) {
+  FnSymbol*      iterator = ic->type->defaultInitializer->getFormal(1)->type->defaultInitializer;
+  BlockStmt*     ibody    = iterator->body->copy();
+  Vec<BaseAST*>  asts;
+  Vec<CallExpr*> calls;
+  size_t         yields   = 0;
 
-    // and the entire for loop block is replaced by the iterator body.
-    forLoop->replace(ibody);
+  if (preserveInlinedLineNumbers == false) {
+    reset_ast_loc(ibody, forLoop);
+  }
 
-    // Replace yield statements in the inlined iterator body with copies
-    // of the body of the For Loop that invoked the iterator, substituting
-    // the yielded index for the iterator formal.
-    expandBodyForIteratorInline(forLoop, ibody, index);
+  // Charge the extra copies of the loop body to the enclosing function.
+  collectCallExprs(ibody, calls);
 
-    collect_asts(ibody, asts);
+  forv_Vec(CallExpr, call, calls) {
+    if (call->isPrimitive(PRIM_YIELD))
+      yields++;
+  }
+
+  if (yields > 1) {
+    std::vector<Expr*> exprs;
+
+    collectExprs(forLoop, exprs);
 
-    replaceIteratorFormalsWithIteratorFields(iterator, ic, asts);
+    iteratorInlineGrowth[forLoop->parentSymbol] += (yields - 1) * exprs.size();
   }
+
+  // and the entire for loop block is replaced by the iterator body.
+  forLoop->replace(ibody);
+
+  if (forLoop->isOrderIndependent() && isOrderIndependentIterator(iterator))
+    markOrderIndependentLoops(ibody);
+
+  // Replace yield statements in the inlined iterator body with copies
+  // of the body of the For Loop that invoked the iterator, substituting
+  // the yielded index for the iterator formal.
+  expandBodyForIteratorInline(forLoop, ibody, index);
+
+  collect_asts(ibody, asts);
+
+  replaceIteratorFormalsWithIteratorFields(iterator, ic, asts);
+}
+
+//
+// Is 'sym' only set just before each yield of it?  Then the move into
+// it can set the yielded index instead.  A variable of the iterator that
+// is yielded may be read or set elsewhere, for instance between two
+// yields, so the index gets a copy of it.
+//
+static bool
+isYieldTemp(Symbol* sym, BlockStmt* ibody) {
+  std::vector<SymExpr*> symExprs;
+
+  collectSymExprsSTL(ibody, symExprs);
+
+  for_vector(SymExpr, se, symExprs) {
+    if (se->var != sym)
+      continue;
+
+    CallExpr* call = toCallExpr(se->parentExpr);
+
+    if (call == NULL)
+      return false;
+
+    if (call->isPrimitive(PRIM_MOVE) && call->get(1) == se) {
+      CallExpr* next = toCallExpr(call->next);
+
+      if (next == NULL || !next->isPrimitive(PRIM_YIELD))
+        return false;
+
+    } else if (call->isPrimitive(PRIM_YIELD)) {
+      CallExpr* prev = toCallExpr(call->prev);
+
+      if (prev == NULL || !prev->isPrimitive(PRIM_MOVE))
+        return false;
+
+      SymExpr* lhs = toSymExpr(prev->get(1));
+
+      if (lhs == NULL || lhs->var != sym)
+        return false;
+
+    } else {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 static void
@@ -1241,7 +1392,8 @@ expandBodyForIteratorInline(ForLoop*       forLoop,
         if (CallExpr* prev = toCallExpr(call->prev)) {
           if (prev->isPrimitive(PRIM_MOVE)) {
             if (SymExpr* lhs = toSymExpr(prev->get(1))) {
-              if (lhs->var == yieldedSymbol) {
+              if (lhs->var == yieldedSymbol &&
+                  isYieldTemp(yieldedSymbol, ibody)) {
                 lhs->var = yieldedIndex;
 
                 prev->insertBefore(new DefExpr(yieldedIndex));
@@ -1319,13 +1471,18 @@ expandBodyForIteratorInline(ForLoop*       forLoop,
   }
 }
 
-// Returns true if the iterator can be inlined; false otherwise.
+// Returns NULL if the iterator can be inlined into 'forLoop'; otherwise
+// the reason it cannot.
 //
-// It can be inlined if it contains exactly one yield statement.
-static bool
-canInlineIterator(FnSymbol* iterator) {
+// It can be inlined if it contains exactly one yield statement, or if
+// none of its several yields is in a task function and the copies of
+// the loop body made for them stay within iteratorInlineBudget and
+// iteratorInlineGrowthBudget.
+static const char*
+whyNotInlineIterator(FnSymbol* iterator, ForLoop* forLoop) {
   Vec<CallExpr*> calls;
-  int            count = 0;
+  int            count      = 0;
+  bool           startsTask = false;
 
   collectCallExprs(iterator, calls);
 
@@ -1333,13 +1490,75 @@ canInlineIterator(FnSymbol* iterator) {
     if (call->isPrimitive(PRIM_YIELD))
       count++;
 
-    else if (FnSymbol* taskFn = resolvedToTaskFun(call))
+    else if (FnSymbol* taskFn = resolvedToTaskFun(call)) {
       // Need to descend into 'taskFn' - append to 'calls'.
       collectCallExprs(taskFn->body, calls);
+
+      startsTask = true;
+    }
   }
 
   // count==0 e.g. in users/biesack/test_recursive_iterator.chpl
-  return (count == 1) ? true : false;
+  if (count == 0)
+    return "it does not yield directly";
+
+  if (count > 1) {
+    std::vector<Expr*> exprs;
+
+    if (startsTask)
+      return "it has several yields and starts tasks";
+
+    collectExprs(forLoop, exprs);
+
+    if (count * exprs.size() > iteratorInlineBudget)
+      return astr("the loop body is copied for each of its ", istr(count),
+                  " yields");
+
+    if (iteratorInlineGrowth[forLoop->parentSymbol] +
+        (count - 1) * exprs.size() > iteratorInlineGrowthBudget)
+      return astr(forLoop->parentSymbol->name,
+                  " has grown too much from copied loop bodies");
+  }
+
+  return NULL;
+}
+
+
+// Why the iterator of 'ic' is not inlined into 'forLoop'.
+static const char*
+whyNotInlineLoopIterator(Symbol* ic, ForLoop* forLoop) {
+  FnSymbol* iterator = ic->type->defaultInitializer->getFormal(1)->type->defaultInitializer;
+
+  if (fNoInlineIterators)
+    return "iterator inlining is disabled";
+
+  if (!iterator->iteratorInfo)
+    return "it is not a simple iterator";
+
+  if (iterator->hasFlag(FLAG_RECURSIVE_ITERATOR))
+    return "it is recursive";
+
+  if (!(ic->type->dispatchChildren.n == 0 ||
+        (ic->type->dispatchChildren.n == 1 &&
+         ic->type->dispatchChildren.v[0] == dtObject)))
+    return "it is dynamically dispatched";
+
+  return whyNotInlineIterator(iterator, forLoop);
+}
+
+
+static void
+reportUninlinedIterator(ForLoop* forLoop, Symbol* ic, const char* reason) {
+  FnSymbol*     iterator = ic->type->defaultInitializer->getFormal(1)->type->defaultInitializer;
+  ModuleSymbol* mod      = forLoop->getModule();
+
+  if (!developer && (mod->modTag == MOD_INTERNAL ||
+                     mod->modTag == MOD_STANDARD))
+    return;
+
+  printf("Iterator %s not inlined in %s (%s:%d): %s\n",
+         iterator->name, forLoop->parentSymbol->name,
+         forLoop->fname(), forLoop->linenum(), reason);
 }
 
 
@@ -1610,6 +1829,142 @@ inlineSingleYieldIterator(ForLoop* forLoop) {
   forLoop->replace(body);
 }
 
+//
+// Can the first iterator of a zippered loop be inlined, with the others
+// stepped alongside it?  It must bound the loop by itself, as the first
+// iterator does for the C for loop built below.
+//
+static bool
+canInlineZipLeader(Symbol* iterator, ForLoop* forLoop) {
+  if (fNoInlineIterators || !iterator->type->symbol->hasFlag(FLAG_TUPLE))
+    return false;
+
+  Vec<Symbol*> iterators;
+
+  getRecursiveIterators(iterators, iterator);
+
+  Symbol*   leader = iterators.v[0];
+  FnSymbol* fn     = leader->type->defaultInitializer->getFormal(1)->type->defaultInitializer;
+
+  return whyNotInlineLoopIterator(leader, forLoop) == NULL &&
+         isBoundedIterator(fn);
+}
+
+
+//
+// Step 'iterator', one of the iterators zippered with an inlined first
+// iterator, once per copy of the loop body, and check that the two run
+// out together.
+//
+static void
+addZipFollowerCalls(ForLoop* forLoop, Symbol* iterator, Symbol* index) {
+  Vec<Type*> children;
+
+  getIteratorChildren(children, iterator->type);
+
+  forLoop->insertBefore(buildIteratorCall(NULL, ZIP1, iterator, children));
+  forLoop->insertBefore(buildIteratorCall(NULL, INIT, iterator, children));
+
+  forLoop->insertAtHead(buildIteratorCall(index, GETVALUE, iterator, children));
+
+  if (children.n == 0) {
+    forLoop->insertAtTail(buildIteratorCall(NULL, ZIP3, iterator, children));
+    forLoop->insertAtTail(buildIteratorCall(NULL, INCR, iterator, children));
+  } else {
+    forLoop->insertAtTail(buildIteratorCall(NULL, INCR, iterator, children));
+    forLoop->insertAtTail(buildIteratorCall(NULL, ZIP3, iterator, children));
+  }
+
+  forLoop->insertAfter(buildIteratorCall(NULL, ZIP4, iterator, children));
+
+  if (isBoundedIterator(iterator->type->defaultInitializer->getFormal(1)->type->defaultInitializer) &&
+      !fNoBoundsChecks) {
+    VarSymbol* hasMore    = newTemp("hasMore",    dtBool);
+    VarSymbol* isFinished = newTemp("isFinished", dtBool);
+
+    forLoop->insertBefore(new DefExpr(isFinished));
+    forLoop->insertBefore(new DefExpr(hasMore));
+
+    forLoop->insertAtHead(new CondStmt(new SymExpr(isFinished),
+                                       new CallExpr(PRIM_RT_ERROR,
+                                                    new_StringSymbol("zippered iterations have non-equal lengths"))));
+
+    forLoop->insertAtHead(new CallExpr(PRIM_MOVE, isFinished, new CallExpr(PRIM_UNARY_LNOT, hasMore)));
+
+    forLoop->insertAtHead(buildIteratorCall(hasMore, HASMORE, iterator, children));
+
+    forLoop->insertAfter(new CondStmt(new SymExpr(hasMore),
+                                      new CallExpr(PRIM_RT_ERROR,
+                                                   new_StringSymbol("zippered iterations have non-equal lengths"))));
+
+    forLoop->insertAfter(buildIteratorCall(hasMore, HASMORE, iterator, children));
+  }
+
+  forLoop->insertAtHead(buildIteratorCall(NULL, ZIP2, iterator, children));
+}
+
+
+//
+// Inline the first iterator of a zippered loop like the iterator of an
+// unzippered one.  Each copy of the loop body gets the values of the
+// other iterators through their iterator classes.
+//
+static void
+inlineZipLeader(ForLoop* forLoop) {
+  SET_LINENO(forLoop);
+
+  Symbol*      index    = forLoop->indexGet()->var;
+  Symbol*      iterator = forLoop->iteratorGet()->var;
+
+  Vec<Symbol*> iterators;
+  Vec<Symbol*> indices;
+
+  setupSimultaneousIterators(iterators, indices, iterator, index, forLoop);
+
+  for (int i = 1; i < iterators.n; i++) {
+    FnSymbol*  fn = iterators.v[i]->type->defaultInitializer->getFormal(1)->type->defaultInitializer;
+    Vec<Type*> children;
+
+    getIteratorChildren(children, iterators.v[i]->type);
+
+    // Its zip and getValue code runs in each copy of the body.
+    if (children.n > 0 || isOrderIndependentIterator(fn) == false)
+      forLoop->orderIndependentSet(false);
+
+    addZipFollowerCalls(forLoop, iterators.v[i], indices.v[i]);
+
+    if (fReportUninlinedIterators)
+      reportUninlinedIterator(forLoop, iterators.v[i],
+                              "it is zippered after the first iterator");
+  }
+
+  // Each copy of the body builds its own index tuple, from the value
+  // yielded for it by the first iterator.
+  forLoop->insertAtHead(index->defPoint->remove());
+
+  indices.v[0]->defPoint->remove();
+
+  inlineIteratorBody(forLoop, iterators.v[0], indices.v[0]);
+}
+
+
+static void
+reportUninlinedLoopIterators(ForLoop* forLoop, Symbol* iterator) {
+  Vec<Symbol*> iterators;
+
+  getRecursiveIterators(iterators, iterator);
+
+  for (int i = 0; i < iterators.n; i++) {
+    const char* reason = whyNotInlineLoopIterator(iterators.v[i], forLoop);
+
+    if (reason == NULL)
+      reason = "it is zippered with an iterator that cannot be inlined";
+
+    reportUninlinedIterator(forLoop, iterators.v[i], reason);
+  }
+}
+
+
 static void
 expandForLoop(ForLoop* forLoop) {
   SymExpr*   se2      = forLoop->iteratorGet();
@@ -1617,7 +1972,7 @@ expandForLoop(ForLoop* forLoop) {
 
   if (!fNoInlineIterators &&
       iterator->type->defaultInitializer->getFormal(1)->type->defaultInitializer->iteratorInfo &&
-      canInlineIterator(iterator->type->defaultInitializer->getFormal(1)->type->defaultInitializer) &&
+      whyNotInlineIterator(iterator->type->defaultInitializer->getFormal(1)->type->defaultInitializer, forLoop) == NULL &&
       (iterator->type->dispatchChildren.n == 0 ||
        (iterator->type->dispatchChildren.n == 1 &&
         iterator->type->dispatchChildren.v[0] == dtObject))) {
@@ -1626,7 +1981,13 @@ expandForLoop(ForLoop* forLoop) {
   } else if (!fNoInlineIterators && canInlineSingleYieldIterator(iterator)) {
     inlineSingleYieldIterator(forLoop);
 
+  } else if (canInlineZipLeader(iterator, forLoop)) {
+    inlineZipLeader(forLoop);
+
   } else {
+    if (fReportUninlinedIterators)
+      reportUninlinedLoopIterators(forLoop, iterator);
+
     // This code handles zippered iterators, dynamic iterators, and any other
     // iterator that cannot be inlined.
     SET_LINENO(forLoop);
@@ -1641,6 +2002,15 @@ expandForLoop(ForLoop* forLoop) {
     BlockStmt*   testBlock = NULL;
     BlockStmt*   incrBlock = new BlockStmt();
 
+    // Only a loop stepped by C for loop init/incr functions is countable
+    // (and worth a vectorization hint); one driven by advance() keeps its
+    // state in the iterator class.
+    bool         stepsLikeCForLoop = true;
+
+    // The iterators' zip and getValue code runs in the loop body, so the
+    // iterations are only as independent as the iterators are.
+    bool         independentIters  = true;
+
     setupSimultaneousIterators(iterators, indices, iterator, index, forLoop);
 
     // For each iterator we add the zip* functions in the appropriate place and
@@ -1662,6 +2032,20 @@ expandForLoop(ForLoop* forLoop) {
 
       isNotDynIter = (children.n == 0);
 
+      if (isNotDynIter == true) {
+        FnSymbol* fn = iterators.v[i]->type->defaultInitializer->getFormal(1)->type->defaultInitializer;
+
+        if (fn->iteratorInfo->cforLoop == false)
+          stepsLikeCForLoop = false;
+
+        if (isOrderIndependentIterator(fn) == false)
+          independentIters = false;
+
+      } else {
+        stepsLikeCForLoop = false;
+        independentIters  = false;
+      }
+
       if (isNotDynIter) {
         // add the init, and incr functions to the init, and incr blocks of the
         // c for loop. If the underlying iterator does not have a c for loop,
@@ -1750,6 +2134,11 @@ expandForLoop(ForLoop* forLoop) {
 
     cforLoop->loopHeaderSet(initBlock, testBlock, incrBlock);
 
+    cforLoop->countableSet(stepsLikeCForLoop);
+
+    if (independentIters == false)
+      cforLoop->orderIndependentSet(false);
+
     forLoop->replace(cforLoop);
   }
 }
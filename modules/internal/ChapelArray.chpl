@@ -107,7 +107,7 @@ module ChapelArray {
     compilerError("index rank must match domain rank");
   }
   
-  proc _makeIndexTuple(param rank, val:integral, param expand: bool=false) {
+  inline proc _makeIndexTuple(param rank, val:integral, param expand: bool=false) {
     if expand || rank == 1 {
       var t: rank*val.type;
       for param i in 1..rank do
@@ -809,6 +809,10 @@ module ChapelArray {
     iter dimIter(param d, ind) {
       for i in _value.dimIter(d, ind) do yield i;
     }
+
+    inline proc rows() {
+      return _value.rows();
+    }
   
     proc buildArray(type eltType) {
       var x = _value.dsiBuildArray(eltType);
@@ -852,6 +856,13 @@ module ChapelArray {
       _value.dsiRequestCapacity(i);
     }
 
+    proc bulkAdd(inds: []) {
+      if !isAssociativeDom(this) && !isSparseDom(this) then
+        compilerError("domain.bulkAdd only applies to associative and sparse domains");
+
+      _value.dsiBulkAdd(inds);
+    }
+
     proc size return numIndices;
     proc numIndices return _value.dsiNumIndices;
     proc low return _value.dsiLow;
@@ -863,14 +874,14 @@ module ChapelArray {
     proc alignedLow return _value.dsiAlignedLow;
     proc alignedHigh return _value.dsiAlignedHigh;
   
-    proc member(i: rank*_value.idxType) {
+    inline proc member(i: rank*_value.idxType) {
       if isRectangularDom(this) || isSparseDom(this) then
-        return _value.dsiMember(_makeIndexTuple(rank, i));
+        return _value.dsiMember(i);
       else
         return _value.dsiMember(i(1));
     }
 
-    proc member(i: _value.idxType ...rank) {
+    inline proc member(i: _value.idxType ...rank) {
       return member(i);
     }
 
@@ -915,7 +926,7 @@ module ChapelArray {
     }
 
     // 1/5/10: do we want to support order() and position()?
-    proc indexOrder(i) return _value.dsiIndexOrder(_makeIndexTuple(rank, i));
+    inline proc indexOrder(i) return _value.dsiIndexOrder(_makeIndexTuple(rank, i));
   
     proc position(i) {
       var ind = _makeIndexTuple(rank, i), pos: rank*_value.idxType;
@@ -1516,6 +1527,10 @@ module ChapelArray {
     proc IRV ref {
       return _value.IRV;
     }
+
+    iter rowNonzeros(r) {
+      for nz in _value.rowNonzeros(r) do yield nz;
+    }
   
     // associative array interface
   
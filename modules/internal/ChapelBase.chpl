@@ -776,7 +776,8 @@ module ChapelBase {
   class _EndCount {
     var i: atomic int,
         taskCnt: taskCntType,
-        taskList: _task_list = _defaultOf(_task_list);
+        taskList: _task_list = _defaultOf(_task_list),
+        numDeferred: int;
   }
   
   // This function is called once by the initiating task.  No on
@@ -796,25 +797,49 @@ module ChapelBase {
   }
   
   // This function is called by the initiating task once for each new
-  // task *before* any of the tasks are started.  As above, no on
-  // statement needed.
+  // task *before* any of the tasks are started, or once with the
+  // number of new tasks.  As above, no on statement needed.
   pragma "dont disable remote value forwarding"
   pragma "no remote memory fence"
-  proc _upEndCount(e: _EndCount) {
+  proc _upEndCount(e: _EndCount, numTasks = 1) {
     if useAtomicTaskCnt {
-      e.i.add(1, memory_order_release);
-      e.taskCnt.add(1, memory_order_release);
+      e.i.add(numTasks, memory_order_release);
+      e.taskCnt.add(numTasks, memory_order_release);
     } else {
       // note that this on statement does not have the usual
       // remote memory fence becaues of pragma "no remote memory fence"
       // above. So we do an acquire fence before it.
       chpl_rmem_consist_fence(memory_order_release);
       on e {
-        e.i.add(1, memory_order_release);
-        e.taskCnt += 1;
+        e.i.add(numTasks, memory_order_release);
+        e.taskCnt += numTasks;
       }
     }
-    here.runningTaskCntAdd(1);  // decrement is in _waitEndCount()
+    here.runningTaskCntAdd(numTasks);  // decrement is in _waitEndCount()
+  }
+
+  // A coforall counts its tasks with this function as it creates them
+  // and adds them all to the end count with _upEndCountFlush() before
+  // waiting.  Only the initiating task touches numDeferred, so creating
+  // each task costs no atomic operations on the shared counters, and no
+  // fork when network atomics are off.  A task may finish, and
+  // decrement e.i, before it has been added; that only makes e.i
+  // negative until the flush, and nothing waits on it before then.
+  pragma "dont disable remote value forwarding"
+  inline proc _upEndCountDeferred(e: _EndCount) {
+    e.numDeferred += 1;
+  }
+
+  // Called once by the initiating task after it has created the tasks
+  // counted by _upEndCountDeferred(), and before they are run from the
+  // task list or waited for.
+  pragma "dont disable remote value forwarding"
+  proc _upEndCountFlush(e: _EndCount) {
+    const numTasks = e.numDeferred;
+    if numTasks > 0 {
+      e.numDeferred = 0;
+      _upEndCount(e, numTasks);
+    }
   }
   
   // This function is called once by each newly initiated task.  No on
@@ -344,6 +344,10 @@ module ChapelDistribution {
     proc sparseShiftArrayBack(shiftrange) {
       halt("sparseShiftArrayBack not supported for non-sparse arrays");
     }
+
+    proc sparseBulkShiftArray(shiftMap, initrange) {
+      halt("sparseBulkShiftArray not supported for non-sparse arrays");
+    }
   
     // methods for associative arrays
     proc clearEntry(idx, haveLock:bool = false) {
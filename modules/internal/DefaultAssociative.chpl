@@ -358,6 +358,20 @@ module DefaultAssociative {
       }
     }
   
+    // Add all of the indices in 'inds', sizing the table for them
+    // once up front rather than growing it as they are added.
+    proc dsiBulkAdd(inds: []) {
+      on this {
+        const numKeys = numEntries.read() + inds.numElements;
+        if (numKeys+1)*2 > tableSize then
+          dsiRequestCapacity(numKeys);
+        if parSafe then lockTable();
+        for ind in inds do
+          dsiAdd(ind, haveLock=true);
+        if parSafe then unlockTable();
+      }
+    }
+
     iter dsiSorted() {
       var tableCopy: [0..#numEntries.read()] idxType;
   
@@ -39,6 +39,69 @@ module DefaultRectangular {
   config param defaultDoRADOpt = true;
   config param defaultDisableLazyRADOpt = false;
   config param earlyShiftData = true;
+
+  // Arrays of at least this many bytes get their memory placed
+  // explicitly under the numa locale model; smaller ones share pages
+  // with other allocations, so where they land is up to the allocator.
+  config param numaPlacementMinBytes = 1 << 20;
+
+  //
+  // Allocate and default-initialize the data for an array under the
+  // numa locale model.  If the requesting task asked for a specific
+  // sublocale, the pages are bound to that sublocale's NUMA domain.
+  // Otherwise the data is divided the way the leader iterator divides
+  // the outermost dimension among sublocales, and each piece is bound
+  // to, and first touched by a task on, its own sublocale, so a later
+  // forall finds its chunk in local memory.
+  //
+  proc _ddata_allocate_numa(type eltType, size: integral) {
+    extern proc chpl_mem_localizeToSubloc(ref start, len: size_t,
+                                          subloc: chpl_sublocID_t);
+    extern proc chpl_task_getRequestedSubloc(): chpl_sublocID_t;
+    extern proc sizeof(type x): size_t;
+
+    // Arrays of class references are small next to the objects, which
+    // are allocated separately, so they aren't worth placing.
+    if isClassType(eltType) then
+      return _ddata_allocate(eltType, size);
+
+    var ret: _ddata(eltType);
+    __primitive("array_alloc", ret, eltType, size);
+
+    const eltSize = sizeof(eltType);
+    const numBytes = size:size_t * eltSize;
+    if numBytes < numaPlacementMinBytes {
+      init_elts(ret, size, eltType);
+      return ret;
+    }
+
+    const numSublocs = here.getChildCount();
+    const subloc = chpl_task_getRequestedSubloc();
+    const dptpl = if dataParTasksPerLocale==0 then here.maxTaskPar
+                  else dataParTasksPerLocale;
+    const numChunks = min(numSublocs, dptpl, size:int);
+    const n = size:int;
+
+    if subloc >= 0 {
+      chpl_mem_localizeToSubloc(ret[0], numBytes, subloc);
+      init_elts(ret, size, eltType);
+    } else if numChunks <= 1 || __primitive("task_get_serial") {
+      init_elts(ret, size, eltType);
+    } else {
+      coforall chunk in 0..#numChunks {
+        on here.getChild(chunk) {
+          const (lo, hi) = _computeBlock(n, numChunks, chunk, n-1);
+          chpl_mem_localizeToSubloc(ret[lo], (hi-lo+1):size_t * eltSize,
+                                    chunk:chpl_sublocID_t);
+          for i in lo..hi {
+            pragma "no auto destroy" var y: eltType;
+            __primitive("array_set_first", ret, i, y);
+          }
+        }
+      }
+    }
+    return ret;
+  }
   
   class DefaultDist: BaseDist {
     proc dsiNewRectangularDom(param rank: int, type idxType, param stridable: bool)
@@ -301,13 +364,31 @@ module DefaultRectangular {
                offset=createTuple(rank, idxType, 0:idxType))
       where tag == iterKind.follower {
 
+      if debugDefaultDist then
+        writeln("In domain follower code: Following ", followThis);
+      const block = followerBlock(followThis);
+  
+      if rank == 1 {
+        for i in zip((...block)) {
+          yield i;
+        }
+      } else {
+        for i in these_help(1, block) {
+          yield i;
+        }
+      }
+    }
+
+    // Translate a follower's block of (0-based) index positions into the
+    // corresponding block of this domain's indices.  Array followers
+    // use this too.
+    proc followerBlock(followThis) {
+      chpl__testPar("default rectangular domain follower invoked on ":string_rec, followThis);
+
       proc anyStridable(rangeTuple, param i: int = 1) param
         return if i == rangeTuple.size then rangeTuple(i).stridable
                else rangeTuple(i).stridable || anyStridable(rangeTuple, i+1);
-  
-      chpl__testPar("default rectangular domain follower invoked on ":string_rec, followThis);
-      if debugDefaultDist then
-        writeln("In domain follower code: Following ", followThis);
+
       param stridable = this.stridable || anyStridable(followThis);
       var block: rank*range(idxType=idxType, stridable=stridable);
       if stridable {
@@ -331,26 +412,17 @@ module DefaultRectangular {
         for  param i in 1..rank do
           block(i) = ranges(i).low+followThis(i).low:idxType..ranges(i).low+followThis(i).high:idxType;
       }
-  
-      if rank == 1 {
-        for i in zip((...block)) {
-          yield i;
-        }
-      } else {
-        for i in these_help(1, block) {
-          yield i;
-        }
-      }
+      return block;
     }
   
-    proc dsiMember(ind: rank*idxType) {
+    inline proc dsiMember(ind: rank*idxType) {
       for param i in 1..rank do
         if !ranges(i).member(ind(i)) then
           return false;
       return true;
     }
   
-    proc dsiIndexOrder(ind: rank*idxType) {
+    inline proc dsiIndexOrder(ind: rank*idxType) {
       var totOrder: idxType;
       var blk: idxType = 1;
       for param d in 1..rank by -1 {
@@ -621,8 +693,8 @@ module DefaultRectangular {
               yield data(i);
         }
       } else {
-        for i in dom do
-          yield dsiAccess(i);
+        for i in dataIndices(dom.ranges) do
+          yield theData(i);
       }
     }
   
@@ -645,11 +717,57 @@ module DefaultRectangular {
       ref where tag == iterKind.follower {
       if debugDefaultDist then
         writeln("*** In array follower code:"); // [\n", this, "]");
-      for i in dom.these(tag=iterKind.follower, followThis,
-                         tasksPerLocale,
-                         ignoreRunning,
-                         minIndicesPerTask) do
-        yield dsiAccess(i);
+      for i in dataIndices(dom.followerBlock(followThis)) do
+        yield theData(i);
+    }
+
+    //
+    // Yield the data index of each element of 'block', a tuple of
+    // ranges of this array's indices, in row-major order.  Rather than
+    // calling getDataIndex() per element, this computes the first
+    // element's data index once, along with the distance in the data
+    // between neighboring elements in each dimension, and then walks
+    // the data with nested C for loops.  Strided domains and blocks
+    // thus need no per-element division, and when the last dimension
+    // is dense the innermost loop steps through the data by 1.
+    //
+    iter dataIndices(block) {
+      type strType = chpl__signedType(idxType);
+      var first: rank*idxType;
+      var counts: rank*idxType;
+      var steps: rank*strType;
+      var empty = false;
+      for param d in 1..rank {
+        counts(d) = block(d).length;
+        if counts(d) == 0 then
+          empty = true;
+        else
+          first(d) = block(d).first;
+        if stridable || block(d).stridable then
+          steps(d) = blk(d):strType *
+                     (block(d).stride:strType / abs(str(d)):strType);
+        else
+          steps(d) = blk(d):strType;
+      }
+      if !empty then
+        for i in dataIndicesHelp(1, counts, steps, getDataIndex(first)) do
+          yield i;
+    }
+
+    iter dataIndicesHelp(param d: int, counts, steps, start: idxType) {
+      const count = counts(d), step = steps(d);
+      var i = start, j: idxType;
+      while __primitive("C for loop",
+                        __primitive( "=", j, 0:idxType),
+                        __primitive("<", j, count),
+                        __primitive("+=", j, 1:idxType)) {
+        if d == rank then
+          yield i;
+        else
+          for k in dataIndicesHelp(d+1, counts, steps, i) do
+            yield k;
+        i += step:idxType;
+      }
     }
   
     proc computeFactoredOffs() {
@@ -686,7 +804,10 @@ module DefaultRectangular {
         blk(dim) = blk(dim+1) * dom.dsiDim(dim+1).length;
       computeFactoredOffs();
       var size = blk(1) * dom.dsiDim(1).length;
-      data = _ddata_allocate(eltType, size);
+      if CHPL_LOCALE_MODEL == "numa" then
+        data = _ddata_allocate_numa(eltType, size);
+      else
+        data = _ddata_allocate(eltType, size);
       initShiftedData();
     }
   
@@ -23,6 +23,7 @@ pragma "no use ChapelStandard"
 module DefaultSparse {
   
   use Search;
+  use Sort /* only QuickSort */;
   config param debugDefaultSparse = false;
   
   class DefaultSparseDom: BaseSparseDom {
@@ -209,6 +210,53 @@ module DefaultSparse {
       rem_help(ind);
     }
   
+    // Add all of the indices in 'inds' at once.  The new indices are
+    // sorted and deduplicated in parallel and then merged with the
+    // existing ones in a single backward pass, so that the indices and
+    // the arrays declared over this domain are grown and shifted only
+    // once rather than once per index.
+    proc dsiBulkAdd(inds: []) {
+      if boundsChecking then
+        for ind in inds do
+          if !parentDom.member(ind) then
+            halt("sparse index out of bounds: ", ind,
+                 " (expected to be within ", parentDom, ")");
+
+      const toAdd = _sparseBulkAddPrep(this, inds, index(rank));
+      const numAdded = toAdd.numElements;
+      if numAdded == 0 then return;
+
+      const oldNNZ = nnz;
+      const oldNNZDomSize = nnzDomSize;
+      nnz += numAdded;
+      if (nnz > nnzDomSize) {
+        while (nnz > nnzDomSize) do
+          nnzDomSize = if (nnzDomSize) then 2*nnzDomSize else 1;
+        nnzDom = {1..nnzDomSize};
+      }
+
+      // merge from the back; shiftMap(i) records where the index that
+      // used to be at position i ended up
+      var shiftMap: [1..oldNNZ] int;
+      var src = oldNNZ, dst = nnz;
+      for k in 1..numAdded by -1 {
+        while (src >= 1 && indices(src) > toAdd(k)) {
+          indices(dst) = indices(src);
+          shiftMap(src) = dst;
+          src -= 1;
+          dst -= 1;
+        }
+        indices(dst) = toAdd(k);
+        dst -= 1;
+      }
+      for i in 1..src do
+        shiftMap(i) = i;
+
+      for a in _arrs {
+        a.sparseBulkShiftArray(shiftMap, oldNNZDomSize+1..nnzDomSize);
+      }
+    }
+
     proc dsiClear() {
       nnz = 0;
     }
@@ -313,6 +361,10 @@ module DefaultSparse {
       }
     }
 
+    proc sparseBulkShiftArray(shiftMap, initrange) {
+      _sparseBulkShiftData(data, irv, dom.nnz, shiftMap, initrange);
+    }
+
     proc dsiTargetLocales() {
       compilerError("targetLocales is unsuppported by sparse domains");
     }
@@ -325,6 +377,103 @@ module DefaultSparse {
   }
   
   
+  //
+  // Helpers for the sparse bulk-add routines
+  //
+
+  // Copy 'inds' into a new array of 'indexType', sort it, and return
+  // (in ascending order) just the indices that are neither duplicates
+  // nor already members of 'dom'.  Each task sorts one block, the
+  // blocks are merged pairwise, and the filtering is a two-pass
+  // count-then-fill over the same blocks.
+  proc _sparseBulkAddPrep(dom, inds: [], type indexType) {
+    const n = inds.numElements;
+    const numChunks = max(1, _computeNumChunks(n));
+    proc chunkLo(chunk) return _computeChunkStartEnd(n, numChunks, chunk)(1);
+    proc chunkHi(chunk) return _computeChunkStartEnd(n, numChunks, chunk)(2);
+
+    var newInds: [1..n] indexType;
+    for (ni, i) in zip(newInds, inds) do
+      ni = i;
+
+    coforall chunk in 1..numChunks do
+      QuickSort(newInds[chunkLo(chunk)..chunkHi(chunk)]);
+
+    if numChunks > 1 {
+      var tmp: [1..n] indexType;
+      var width = 1;
+      while width < numChunks {
+        coforall first in 1..numChunks by 2*width {
+          const lo = chunkLo(first);
+          const mid = if first+width > numChunks then n
+                      else chunkLo(first+width)-1;
+          const hi = if first+2*width > numChunks then n
+                     else chunkLo(first+2*width)-1;
+          var a = lo, b = mid+1;
+          for i in lo..hi {
+            if b > hi || (a <= mid && newInds(a) <= newInds(b)) {
+              tmp(i) = newInds(a);
+              a += 1;
+            } else {
+              tmp(i) = newInds(b);
+              b += 1;
+            }
+          }
+        }
+        newInds = tmp;
+        width *= 2;
+      }
+    }
+
+    var keep: [1..n] bool;
+    var numKept: [1..numChunks] int;
+    coforall chunk in 1..numChunks {
+      for i in chunkLo(chunk)..chunkHi(chunk) {
+        if (i == 1 || newInds(i) != newInds(i-1)) &&
+           !dom.dsiMember(newInds(i)) {
+          keep(i) = true;
+          numKept(chunk) += 1;
+        }
+      }
+    }
+
+    var toAdd: [1..+ reduce numKept] indexType;
+    coforall chunk in 1..numChunks {
+      var pos = + reduce numKept[1..chunk-1];
+      for i in chunkLo(chunk)..chunkHi(chunk) {
+        if keep(i) {
+          pos += 1;
+          toAdd(pos) = newInds(i);
+        }
+      }
+    }
+    return toAdd;
+  }
+
+  // Move the first shiftMap.numElements elements of 'data' to the
+  // positions given by 'shiftMap' (which only ever move them up), and
+  // set the positions left over in 1..nnz, as well as the newly
+  // allocated 'initrange', to 'irv'.  'shiftMap' holds int positions;
+  // 'data' is indexed by the type of 'nnz'.
+  proc _sparseBulkShiftData(data, irv, nnz, shiftMap, initrange) {
+    for i in initrange {
+      data(i) = irv;
+    }
+    var dst = nnz;
+    for i in shiftMap.domain by -1 {
+      const newLoc = shiftMap(i): nnz.type;
+      for j in newLoc+1..dst {
+        data(j) = irv;
+      }
+      data(newLoc) = data(i: nnz.type);
+      dst = newLoc - 1;
+    }
+    for j in 1..dst {
+      data(j) = irv;
+    }
+  }
+
+
   proc DefaultSparseDom.dsiSerialWrite(f: Writer) {
     if (rank == 1) {
       f.write("{");
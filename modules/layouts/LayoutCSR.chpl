@@ -97,23 +97,23 @@ class CSRDom: BaseSparseDom {
   }
 
   iter these(param tag: iterKind) where tag == iterKind.leader {
-    // same as DefaultSparseDom's leader
+    // Chunks are made of whole rows and balanced by the number of
+    // nonzeros (plus one per row, for the per-row overhead), so that a
+    // task never starts in the middle of a row.
     const numElems = nnz;
-      const numChunks = _computeNumChunks(numElems);
-      //writeln("leader- rowRange=", rowRange, " colRange=", colRange, "\n",
-      //        "        rowStart=", rowStart, " colIdx=", colIdx);
-      if debugCSR then
-        writeln("CSRDom leader: ", numChunks, " chunks, ", numElems, " elems");
-
-      // split our numElems elements over numChunks tasks
-      if numChunks == 1 then
-        yield (this, 1, numElems);
-      else
-        coforall chunk in 1..numChunks do
-          yield (this, (..._computeChunkStartEnd(numElems, numChunks, chunk)));
-      // TODO: to handle large numElems and numChunks faster, it would be great
-      // to run the binary search in _private_findStartRow smarter, e.g.
-      // pass to the tasks created in 'coforall' smaller ranges to search over.
+    const numChunks = _computeNumChunks(numElems);
+    if debugCSR then
+      writeln("CSRDom leader: ", numChunks, " chunks, ", numElems, " elems");
+
+    if numChunks == 1 then
+      yield (this, 1, numElems);
+    else
+      coforall chunk in 1..numChunks {
+        const (loRow, hiRow) = _private_rowChunk(numChunks, chunk);
+        const startIx = rowStart(loRow), endIx = rowStop(hiRow);
+        if startIx <= endIx then
+          yield (this, startIx, endIx);
+      }
   }
 
   iter these(param tag: iterKind, followThis: (?,?,?)) where tag == iterKind.follower {
@@ -124,16 +124,18 @@ class CSRDom: BaseSparseDom {
     if (followThisDom != this) then
       halt("Sparse domains can't be zippered with anything other than themselves and their arrays (CSR layout)");
 
-    // This loop is identical to the serial iterator, except for the iteration
-    // space and finding the initial 'cursorRow'.
+    // Find the starting row once, then walk the chunk row by row.
     var cursorRow = _private_findStartRow(startIx);
     if debugCSR then
       writeln("CSRDom follower: ", startIx, "..", endIx,
               "  rowStart(", cursorRow, ")=", rowStart(cursorRow));
 
-    for i in startIx..endIx {
-      while (rowStart(cursorRow+1) <= i) do cursorRow += 1;
-      yield (cursorRow, colIdx(i));
+    while true {
+      const hi = min(rowStop(cursorRow), endIx);
+      for i in max(rowStart(cursorRow), startIx)..hi do
+        yield (cursorRow, colIdx(i));
+      if hi == endIx then break;
+      cursorRow += 1;
     }
   }
 
@@ -174,6 +176,28 @@ class CSRDom: BaseSparseDom {
     return l;
   }
 
+  // Helper: the rows of chunk 'chunk' out of 'numChunks' chunks, where
+  // each row costs its number of nonzeros plus one.  Empty when there
+  // are more chunks than rows.
+  proc _private_rowChunk(numChunks, chunk) {
+    const numRows = rowRange.length;
+    const total = nnz + numRows;
+    return (_private_findRowBoundary((chunk-1) * total / numChunks),
+            _private_findRowBoundary(chunk * total / numChunks) - 1);
+  }
+
+  // Helper: the first row 'r' (in rowDom) such that the cost of all
+  // rows before 'r' is at least 'target'.
+  proc _private_findRowBoundary(target) {
+    proc cost(r) return rowStart(r) - 1 + (r - rowRange.low);
+    var l = rowDom.low, h = rowDom.high;
+    while l < h {
+      const m = (l + h) / 2;
+      if cost(m) < target then l = m + 1; else h = m;
+    }
+    return l;
+  }
+
   proc dsiDim(d : int) {
     if (d == 1) {
       return rowRange;
@@ -296,6 +320,69 @@ class CSRDom: BaseSparseDom {
     }
   }
 
+  // Add all of the indices in 'inds' at once.  As with
+  // DefaultSparseDom.dsiBulkAdd(), the new indices are sorted and
+  // deduplicated in parallel, then merged into colIdx in a single
+  // backward pass.  rowStart is fixed up afterwards with a scan of the
+  // number of new indices in each row.
+  proc dsiBulkAdd(inds: []) {
+    if boundsChecking then
+      for ind in inds do
+        boundsCheck(ind);
+
+    const toAdd = _sparseBulkAddPrep(this, inds, rank*idxType);
+    const numAdded = toAdd.numElements;
+    if numAdded == 0 then return;
+
+    const oldNNZ = nnz;
+    const oldNNZDomSize = nnzDomSize;
+    nnz += numAdded: idxType;
+    if (nnz > nnzDomSize) {
+      // double in int so a narrow idxType can't wrap around; if the
+      // doubled size doesn't fit, grow to exactly nnz
+      var newSize = nnzDomSize: int;
+      while (nnz > newSize) do
+        newSize = if (newSize) then 2*newSize else 1;
+      nnzDomSize = if newSize > max(idxType) then nnz else newSize: idxType;
+      nnzDom = {1..nnzDomSize};
+    }
+
+    // merge from the back, tracking the row of colIdx(src) as we go;
+    // shiftMap(i) records where the index at position i ended up
+    var shiftMap: [1..oldNNZ:int] int;
+    var src = oldNNZ, dst = nnz;
+    var srcRow = rowRange.high;
+    for k in 1..numAdded by -1 {
+      while (src >= 1) {
+        while (rowStart(srcRow) > src) do srcRow -= 1;
+        if (srcRow, colIdx(src)) < toAdd(k) then break;
+        colIdx(dst) = colIdx(src);
+        shiftMap(src) = dst;
+        src -= 1;
+        dst -= 1;
+      }
+      colIdx(dst) = toAdd(k)(2);
+      dst -= 1;
+    }
+    for i in 1..src do
+      shiftMap(i) = i;
+
+    // each row now starts later by the number of new indices that
+    // landed in earlier rows
+    var numNew: [rowDom] idxType;
+    for (row, col) in toAdd do
+      numNew(row+1) += 1;
+    var shift = 0: idxType;
+    for r in rowDom {
+      shift += numNew(r);
+      rowStart(r) += shift;
+    }
+
+    for a in _arrs {
+      a.sparseBulkShiftArray(shiftMap, oldNNZDomSize+1..nnzDomSize);
+    }
+  }
+
   proc dsiClear() {
     nnz = 0;
     rowStart = 1;
@@ -308,6 +395,36 @@ class CSRDom: BaseSparseDom {
     for c in colIdx[rowStart(ind)..rowStop(ind)] do
       yield c;
   }
+
+  // Iterate over the rows of the domain.  The parallel version hands
+  // each task a contiguous block of rows balanced by nonzero count, and
+  // follows/leads like a 1-D rectangular domain over 'rowRange', so it
+  // can be zippered with dense vectors over the rows.
+  iter rows() {
+    for r in rowRange do yield r;
+  }
+
+  iter rows(param tag: iterKind) where tag == iterKind.leader {
+    const numRows = rowRange.length;
+    const numChunks = min(_computeNumChunks(nnz + numRows), numRows);
+    if debugCSR then
+      writeln("CSRDom rows leader: ", numChunks, " chunks, ", numRows, " rows");
+
+    if numChunks == 1 then
+      yield (0..numRows-1,);
+    else
+      coforall chunk in 1..numChunks {
+        const (loRow, hiRow) = _private_rowChunk(numChunks, chunk);
+        if loRow <= hiRow then
+          yield ((loRow-rowRange.low)..(hiRow-rowRange.low),);
+      }
+  }
+
+  iter rows(param tag: iterKind, followThis) where tag == iterKind.follower {
+    const (followRows,) = followThis;
+    for r in rowRange.low+followRows.low..rowRange.low+followRows.high do
+      yield r;
+  }
 }
 
 
@@ -360,7 +477,7 @@ class CSRArr: BaseArr {
     if debugCSR then
       writeln("CSRArr follower: ", startIx, "..", endIx);
 
-    for e in data[startIx..endIx] do yield e;
+    for i in startIx..endIx do yield data(i);
   }
 
   iter these(param tag: iterKind, followThis) where tag == iterKind.follower {
@@ -372,6 +489,16 @@ class CSRArr: BaseArr {
     return irv;
   }
 
+  // Yield (col, value) for each nonzero in row 'r', without searching.
+  iter rowNonzeros(r: idxType) {
+    if boundsChecking then
+      if !dom.rowRange.member(r) then
+        halt("CSR array row out of bounds: ", r,
+             " (expected to be within ", dom.rowRange, ")");
+    for i in dom.rowStart(r)..dom.rowStop(r) do
+      yield (dom.colIdx(i), data(i));
+  }
+
   proc sparseShiftArray(shiftrange, initrange) {
     for i in initrange {
       data(i) = irv;
@@ -387,6 +514,10 @@ class CSRArr: BaseArr {
       data(i) = data(i+1);
     }
   }
+
+  proc sparseBulkShiftArray(shiftMap, initrange) {
+    _sparseBulkShiftData(data, irv, dom.nnz, shiftMap, initrange);
+  }
 }
 
 
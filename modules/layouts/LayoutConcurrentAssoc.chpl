@@ -0,0 +1,830 @@
+/*
+ * Copyright 2004-2014 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Concurrent associative domains
+//
+// This layout provides associative domains that scale when many tasks
+// add indices at once, e.g.
+//
+//   var D: domain(int) dmapped new dmap(new ConcurrentAssoc());
+//   forall i in 1..n do D += key(i);
+//
+// Unlike DefaultAssociative, which serializes every operation on one
+// table lock, the table here is open-addressed with a power-of-two
+// size and linear probing, and each slot carries its own atomic state.
+// Lookups never lock, and insertions claim an empty slot with a single
+// compare-and-swap.  Removed indices leave a tombstone that is only
+// reclaimed when the table is rebuilt.
+//
+// The table maps each index to an entry number.  The entries hold the
+// indices themselves (for iteration) and the elements of every array
+// declared over the domain.  They live in segments that double in size
+// as the domain grows and that are never moved or freed while the
+// domain exists, so references to array elements and iterations over
+// the domain or its arrays stay valid across resizes.  The entries of
+// removed indices are recycled when the table is next rebuilt.
+//
+// When the table gets too full, the task that notices starts a resize.
+// It waits for the operations already in flight to drain, publishes a
+// table of twice the size, and then every task that arrives at the
+// domain while the resize is active helps by migrating chunks of the
+// old table before it retries its own operation.
+//
+// The resize protocol uses the following phases:
+//
+//   idle      - normal operation
+//   draining  - a resize has been requested; new operations wait and
+//               the initiator waits for inFlight to drop to zero
+//   migrating - chunks of the old table are being rehashed by the
+//               initiator and by any helpers
+//   finishing - the new table has been published; the initiator waits
+//               for helpers to leave before freeing the old table
+//
+// Every access to the table happens between _enter() and _leave() so
+// that a resize can wait for it.  Domains declared with parSafe=false
+// are never modified by several tasks at once, so they skip that.
+//
+use DSIUtil;
+use BitOps;
+use Sort /* only QuickSort */;
+
+config param debugConcurrentAssoc = false;
+
+// Number of old-table slots migrated by one helper at a time
+config param concurrentAssocMigrateChunk = 1024;
+
+// Initial number of slots in the table (rounded up to a power of two)
+config const concurrentAssocInitialSize = 64;
+
+// Most entry segments a domain can have; plenty, since they double
+param _caMaxSegments = 48;
+
+// slot and entry states
+param _caEmpty   = 0: int(8),
+      _caBusy    = 1: int(8),  // claimed by an inserter, idx not yet valid
+      _caFull    = 2: int(8),
+      _caDeleted = 3: int(8);
+
+// resize phases
+param _caIdle      = 0,
+      _caDraining  = 1,
+      _caMigrating = 2,
+      _caFinishing = 3;
+
+class ConcurrentAssoc: BaseDist {
+  proc dsiNewAssociativeDom(type idxType, param parSafe: bool) {
+    return new ConcurrentAssocDom(idxType=idxType, parSafe=parSafe,
+                                  dist=this);
+  }
+
+  proc dsiNewAssociativeDom(type idxType, param parSafe: bool)
+  where isEnumType(idxType) {
+    compilerError("enumerated domains not supported by the ConcurrentAssoc layout");
+  }
+
+  proc dsiClone() return new ConcurrentAssoc();
+}
+
+//
+// One generation of the hash table.  A resize builds a new instance
+// and swaps it in, so the table itself never changes size.
+//
+class ConcurrentAssocTable {
+  type idxType;
+  const size: int;
+  const mask = size - 1;
+  const slotDom = {0..#size};
+  var status: [slotDom] atomic_int8;
+  var idx: [slotDom] idxType;
+  var entry: [slotDom] int;
+
+  // full + deleted + busy slots; drives the resize decision
+  var used: atomic_int64;
+
+  inline proc overLoaded() {
+    return used.read() * 2 >= size;
+  }
+
+  // Insert 'ind' (whose hash is 'h') with entry number 'e'.  Returns
+  // whether 'ind' was newly added and the slot holding it, or (false,
+  // -1) if no free slot was found along the probe sequence.  A newly
+  // added slot stays busy until the caller publishes it.
+  proc add(ind: idxType, h: int, e: int): (bool, int) {
+    var slot = h & mask;
+    for 1..size {
+      var s = status[slot].read();
+      if s == _caEmpty {
+        if status[slot].compareExchangeStrong(_caEmpty, _caBusy) {
+          used.add(1);
+          idx[slot] = ind;
+          entry[slot] = e;
+          return (true, slot);
+        }
+        s = status[slot].read();
+      }
+      while s == _caBusy {
+        chpl_task_yield();
+        s = status[slot].read();
+      }
+      if s == _caFull && idx[slot] == ind then
+        return (false, slot);
+      slot = (slot + 1) & mask;
+    }
+    return (false, -1);
+  }
+
+  inline proc publish(slot: int) {
+    status[slot].write(_caFull);
+  }
+
+  // Return the slot holding 'ind', or -1 if it is not in the table.
+  proc find(ind: idxType, h: int): int {
+    var slot = h & mask;
+    for 1..size {
+      var s = status[slot].read();
+      if s == _caEmpty then
+        return -1;
+      while s == _caBusy {
+        chpl_task_yield();
+        s = status[slot].read();
+      }
+      if s == _caFull && idx[slot] == ind then
+        return slot;
+      slot = (slot + 1) & mask;
+    }
+    return -1;
+  }
+}
+
+class ConcurrentAssocDom: BaseAssociativeDom {
+  type idxType;
+  param parSafe: bool;
+
+  var dist: ConcurrentAssoc;
+
+  var table = new ConcurrentAssocTable(idxType,
+                 _caPow2AtLeast(concurrentAssocInitialSize));
+  var numEntries: atomic_int64;
+
+  // entry storage, see the description at the top of the file
+  const firstSegBits = 63 - clz(table.size);
+  var numSegs = 0;
+  var entries: [0..#_caMaxSegments] ConcurrentAssocEntries(idxType);
+  var entryCap: atomic_int64;   // entries covered by the segments
+  var nextEntry: atomic_int64;  // first entry never handed out
+  var freeDom = {0..-1};
+  var freeEntries: [freeDom] int;  // recycled by the last rebuild
+  var freeNext: atomic_int64;
+
+  // resize state, see the protocol description at the top of the file
+  var phase: atomic_int64;
+  var inFlight: atomic_int64;
+  var helpers: atomic_int64;
+  var oldTable, nextTable: ConcurrentAssocTable(idxType);
+  var migrateNext: atomic_int64;
+  var migrateDone: atomic_int64;
+
+  proc ConcurrentAssocDom(type idxType, param parSafe: bool,
+                          dist: ConcurrentAssoc) {
+    if !chpl__validDefaultAssocDomIdxType(idxType) then
+      compilerError("ConcurrentAssoc domains with idxType=",
+                    typeToString(idxType), " are not allowed", 2);
+    this.dist = dist;
+    _growEntries(table.size);
+  }
+
+  proc dsiMyDist() return dist;
+
+  proc ~ConcurrentAssocDom() {
+    delete table;
+    for s in 0..#numSegs do
+      delete entries[s];
+  }
+
+  //
+  // Standard Internal Domain Interface
+  //
+  proc dsiBuildArray(type eltType) {
+    return new ConcurrentAssocArr(eltType=eltType, idxType=idxType,
+                                  parSafeDom=parSafe, dom=this);
+  }
+
+  proc dsiSerialReadWrite(f /*: Reader or Writer*/) {
+    var first = true;
+    f <~> new ioLiteral("{");
+    for idx in this {
+      if first then
+        first = false;
+      else
+        f <~> new ioLiteral(", ");
+      f <~> idx;
+    }
+    f <~> new ioLiteral("}");
+  }
+  proc dsiSerialWrite(f: Writer) { this.dsiSerialReadWrite(f); }
+  proc dsiSerialRead(f: Reader) { this.dsiSerialReadWrite(f); }
+
+  //
+  // Standard user domain interface
+  //
+  inline proc dsiNumIndices {
+    return numEntries.read();
+  }
+
+  iter dsiIndsIterSafeForRemoving() {
+    // removals only mark entries deleted, so the entries never move
+    for i in this.these() do
+      yield i;
+  }
+
+  // Iteration walks the entries rather than the table, so it does not
+  // need to register with _enter(): the entries it visits stay put even
+  // if the table is rebuilt meanwhile, for instance by the loop body
+  // adding indices.
+  iter these() {
+    for (s, offs) in _entryPieces(0, _numUsedEntries()-1) {
+      const seg = entries[s];
+      for off in offs do
+        if seg.state[off].read() == _caFull then
+          yield seg.idx[off];
+    }
+  }
+
+  iter these(param tag: iterKind) where tag == iterKind.leader {
+    const numTasks = if dataParTasksPerLocale==0 then here.maxTaskPar
+                     else dataParTasksPerLocale;
+    const ignoreRunning = dataParIgnoreRunningTasks;
+    const minIndicesPerTask = dataParMinGranularity;
+    // As for DefaultAssociative, we slice up the entries rather than
+    // the full ones.  This requires that zippered domains share the
+    // same entry layout.
+    const numIndices = _numUsedEntries();
+    const numChunks = _computeNumChunks(numTasks, ignoreRunning,
+                                        minIndicesPerTask, numIndices);
+    if debugConcurrentAssoc then
+      writeln("ConcurrentAssocDom leader: ", numChunks, " chunks, ",
+              numIndices, " entries");
+
+    if numChunks == 1 {
+      yield (0..numIndices-1, this);
+    } else {
+      coforall chunk in 0..#numChunks {
+        const (lo, hi) = _computeBlock(numIndices, numChunks,
+                                       chunk, numIndices-1);
+        yield (lo..hi, this);
+      }
+    }
+  }
+
+  iter these(param tag: iterKind, followThis) where tag == iterKind.follower {
+    var (chunk, followThisDom) = followThis;
+    if followThisDom != this then
+      _checkSameLayout(followThisDom, chunk,
+                       "zippered associative domains do not match");
+
+    for (s, offs) in _entryPieces(chunk.low, chunk.high) {
+      const seg = entries[s];
+      for off in offs do
+        if seg.state[off].read() == _caFull then
+          yield seg.idx[off];
+    }
+  }
+
+  proc _checkSameLayout(other, chunk, msg) {
+    const n = _numUsedEntries(), otherN = other._numUsedEntries();
+    for e in chunk do
+      if (e < n && _isFullEntry(e)) != (e < otherN && other._isFullEntry(e)) then
+        halt(msg);
+  }
+
+  //
+  // Associative Domain Interface
+  //
+  proc dsiClear() {
+    on this {
+      _enter();
+      const tab = table;
+      forall slot in tab.slotDom do
+        tab.status[slot].write(_caEmpty);
+      tab.used.write(0);
+      numEntries.write(0);
+      forall e in 0..#_numUsedEntries() {
+        const (s, off) = _caEntrySeg(e, firstSegBits);
+        if entries[s].state[off].compareExchangeStrong(_caFull, _caDeleted) then
+          for a in _arrs do
+            a.clearEntry(e, true);
+      }
+      _leave();
+    }
+  }
+
+  proc dsiMember(ind: idxType): bool {
+    var found = false;
+    on this {
+      _enter();
+      found = table.find(ind, _caHash(ind)) != -1;
+      _leave();
+    }
+    return found;
+  }
+
+  proc dsiAdd(ind: idxType) {
+    var e: int;
+    on this do e = _addEntry(ind);
+    return e;
+  }
+
+  // Add 'ind' and return its entry number.  Must be called on the
+  // domain's locale.
+  proc _addEntry(ind: idxType): int {
+    const h = _caHash(ind);
+    while true {
+      _enter();
+      const tab = table;
+      const found = tab.find(ind, h);
+      if found != -1 {
+        const e = tab.entry[found];
+        _leave();
+        return e;
+      }
+      if !tab.overLoaded() {
+        const e = _allocEntry();
+        if e != -1 {
+          const (added, slot) = tab.add(ind, h, e);
+          if added {
+            // publish the entry before the slot, so that a remove,
+            // which waits for the slot, always sees the entry full
+            const (s, off) = _caEntrySeg(e, firstSegBits);
+            entries[s].idx[off] = ind;
+            entries[s].state[off].write(_caFull);
+            tab.publish(slot);
+            numEntries.add(1);
+            _leave();
+            return e;
+          } else if slot != -1 {
+            // another task added 'ind' first; 'e' is recycled later
+            const other = tab.entry[slot];
+            _leave();
+            return other;
+          }
+        }
+      }
+      _leave();
+      _resize(numEntries.read() + 1);
+    }
+    return -1;
+  }
+
+  proc dsiRemove(ind: idxType) {
+    on this {
+      _enter();
+      const tab = table;
+      const slot = tab.find(ind, _caHash(ind));
+      if slot != -1 &&
+         tab.status[slot].compareExchangeStrong(_caFull, _caDeleted) {
+        const e = tab.entry[slot];
+        const (s, off) = _caEntrySeg(e, firstSegBits);
+        entries[s].state[off].write(_caDeleted);
+        numEntries.sub(1);
+        for a in _arrs do
+          a.clearEntry(e, true);
+        _leave();
+      } else {
+        _leave();
+        halt("index not in domain: ", ind);
+      }
+    }
+  }
+
+  proc dsiRequestCapacity(numKeys: int) {
+    on this {
+      const size = numEntries.read();
+      if size > numKeys then
+        warning("Requested capacity (" + numKeys + ") " +
+                "is less than current size (" + size + ")");
+      else
+        _resize(numKeys);
+    }
+  }
+
+  // Add all of the indices in 'inds'.  The table is grown once up
+  // front so that the insertions, which run in parallel, never need
+  // to wait for a resize.  That is also what makes this safe for a
+  // domain with parSafe=false.
+  proc dsiBulkAdd(inds: []) {
+    on this {
+      _resize(numEntries.read() + inds.numElements);
+      forall ind in inds do
+        _addEntry(ind);
+    }
+  }
+
+  iter dsiSorted() {
+    var tableCopy: [0..#numEntries.read()] idxType;
+
+    for (tmp, ind) in zip(tableCopy.domain, this) do
+      tableCopy(tmp) = ind;
+
+    QuickSort(tableCopy);
+
+    for ind in tableCopy do
+      yield ind;
+  }
+
+  //
+  // Internal interface (private)
+  //
+
+  // Register an operation against the current table, helping with (and
+  // waiting out) any resize that is under way.
+  inline proc _enter() {
+    if !parSafe then
+      return;
+    while true {
+      if phase.read() == _caIdle {
+        inFlight.add(1);
+        if phase.read() == _caIdle then
+          return;
+        inFlight.sub(1);
+      }
+      _helpResize();
+    }
+  }
+
+  inline proc _leave() {
+    if parSafe then
+      inFlight.sub(1);
+  }
+
+  proc _helpResize() {
+    helpers.add(1);
+    var p = phase.read();
+    while p == _caDraining {
+      chpl_task_yield();
+      p = phase.read();
+    }
+    if p == _caMigrating then
+      _migrateChunks();
+    helpers.sub(1);
+    while phase.read() != _caIdle do
+      chpl_task_yield();
+  }
+
+  // Rebuild the table so that it can hold 'minEntries' indices at no
+  // more than a quarter load.  Returns without doing anything if a
+  // different task is resizing; the caller retries against the table
+  // that task publishes.
+  proc _resize(minEntries: int) {
+    if !phase.compareExchangeStrong(_caIdle, _caDraining) {
+      _helpResize();
+      return;
+    }
+    while inFlight.read() != 0 do
+      chpl_task_yield();
+
+    var newSize = table.size;
+    while minEntries * 4 > newSize do
+      newSize *= 2;
+    const unusedFree = max(freeDom.numIndices - freeNext.read(), 0);
+    const handedOut = _numUsedEntries() - unusedFree;
+    if newSize == table.size && table.used.read() == numEntries.read() &&
+       handedOut == numEntries.read() {
+      // neither growth nor tombstones nor entries to reclaim
+      phase.write(_caIdle);
+      return;
+    }
+    if debugConcurrentAssoc then
+      writeln("ConcurrentAssocDom resize: ", table.size, " -> ", newSize);
+
+    oldTable = table;
+    nextTable = new ConcurrentAssocTable(idxType, newSize);
+    migrateNext.write(0);
+    migrateDone.write(0);
+    phase.write(_caMigrating);
+
+    _migrateChunks();
+    const numChunks = _caNumChunks(oldTable.size);
+    while migrateDone.read() != numChunks do
+      chpl_task_yield();
+
+    table = nextTable;
+    _recycleEntries();
+    _growEntries(newSize);
+    phase.write(_caFinishing);
+    while helpers.read() != 0 do
+      chpl_task_yield();
+    delete oldTable;
+    oldTable = nil;
+    nextTable = nil;
+    phase.write(_caIdle);
+  }
+
+  // Claim chunks of the old table until there are none left, moving
+  // their full slots into the new table.  The entries, and so the
+  // array elements, stay where they are.
+  proc _migrateChunks() {
+    const oldTab = oldTable, newTab = nextTable;
+    const numChunks = _caNumChunks(oldTab.size);
+    while true {
+      const chunk = migrateNext.fetchAdd(1);
+      if chunk >= numChunks then
+        return;
+      const lo = chunk * concurrentAssocMigrateChunk;
+      const hi = min(lo + concurrentAssocMigrateChunk, oldTab.size) - 1;
+      for oldslot in lo..hi {
+        if oldTab.status[oldslot].read() == _caFull {
+          const ind = oldTab.idx[oldslot];
+          const (_, newslot) = newTab.add(ind, _caHash(ind),
+                                          oldTab.entry[oldslot]);
+          newTab.publish(newslot);
+        }
+      }
+      migrateDone.add(1);
+    }
+  }
+
+  // Hand out an entry for a new index, preferring the ones recycled by
+  // the last rebuild.  Returns -1 when the segments are used up.
+  proc _allocEntry(): int {
+    const numFree = freeDom.numIndices;
+    if freeNext.read() < numFree {
+      const k = freeNext.fetchAdd(1);
+      if k < numFree then
+        return freeEntries[k];
+    }
+    const e = nextEntry.fetchAdd(1);
+    return if e < entryCap.read() then e else -1;
+  }
+
+  // Collect the entries that no index holds any more: those of removed
+  // indices, and those taken by tasks that lost a race to add the same
+  // index.  Only called while a resize has drained all other operations.
+  proc _recycleEntries() {
+    const numUsed = _numUsedEntries();
+    nextEntry.write(numUsed);
+    freeDom = {0..#(numUsed - numEntries.read())};
+    var numFree = 0;
+    for (s, offs) in _entryPieces(0, numUsed-1) {
+      const seg = entries[s], base = _caSegStart(s, firstSegBits);
+      for off in offs {
+        if seg.state[off].read() != _caFull {
+          seg.state[off].write(_caEmpty);
+          freeEntries[numFree] = base + off;
+          numFree += 1;
+        }
+      }
+    }
+    freeNext.write(0);
+  }
+
+  // Add segments until there are entries for 'size' indices, and have
+  // the arrays add theirs, before any of them can be handed out.
+  proc _growEntries(size: int) {
+    while _caSegStart(numSegs, firstSegBits) < size {
+      entries[numSegs] = new ConcurrentAssocEntries(idxType,
+                               _caSegSize(numSegs, firstSegBits));
+      numSegs += 1;
+    }
+    _backupArrays();
+    entryCap.write(_caSegStart(numSegs, firstSegBits));
+  }
+
+  inline proc _numUsedEntries() {
+    return min(nextEntry.read(), entryCap.read());
+  }
+
+  inline proc _isFullEntry(e: int) {
+    const (s, off) = _caEntrySeg(e, firstSegBits);
+    return entries[s].state[off].read() == _caFull;
+  }
+
+  // Split the entries lo..hi into (segment, offsets) pieces.
+  iter _entryPieces(lo: int, hi: int) {
+    var e = lo;
+    var s = _caEntrySeg(lo, firstSegBits)(1);
+    while e <= hi {
+      const base = _caSegStart(s, firstSegBits);
+      const last = min(base + _caSegSize(s, firstSegBits) - 1, hi);
+      yield (s, e-base..last-base);
+      e = last + 1;
+      s += 1;
+    }
+  }
+}
+
+// The indices of one segment of a domain's entries
+class ConcurrentAssocEntries {
+  type idxType;
+  const size: int;
+  const entryDom = {0..#size};
+  var state: [entryDom] atomic_int8;
+  var idx: [entryDom] idxType;
+}
+
+class ConcurrentAssocArr: BaseArr {
+  type eltType;
+  type idxType;
+  param parSafeDom: bool;
+  var dom: ConcurrentAssocDom(idxType, parSafe=parSafeDom);
+
+  // one segment per segment of the domain's entries
+  const firstSegBits = dom.firstSegBits;
+  var numSegs = 0;
+  var data: [0..#_caMaxSegments] ConcurrentAssocArrData(eltType);
+
+  proc initialize() {
+    _backupArray();
+  }
+
+  //
+  // Standard internal array interface
+  //
+  proc dsiGetBaseDom() return dom;
+
+  proc dsiDestroyData() {
+    for s in 0..#numSegs do
+      delete data[s];
+  }
+
+  // Unlike DefaultAssociativeArr, 'idx' is the entry rather than the
+  // index, since the domain has already marked the entry deleted.
+  proc clearEntry(idx: int, haveLock = false) {
+    const initval: eltType;
+    const (s, off) = _caEntrySeg(idx, firstSegBits);
+    data[s].elems(off) = initval;
+  }
+
+  // The returned reference stays valid until 'ind' is removed, since
+  // the entry it points into is never moved.
+  proc dsiAccess(ind: idxType) ref {
+    var e = -1;
+    on dom {
+      dom._enter();
+      const slot = dom.table.find(ind, _caHash(ind));
+      if slot != -1 then
+        e = dom.table.entry[slot];
+      dom._leave();
+    }
+    if e == -1 {
+      if setter {
+        if dom._arrs.length != 1 then
+          halt("cannot implicitly add to an array's domain when the domain is used by more than one array: ", dom._arrs.length);
+        on dom do e = dom._addEntry(ind);
+      } else {
+        halt("array index out of bounds: ", ind);
+      }
+    }
+    const (s, off) = _caEntrySeg(e, firstSegBits);
+    return data[s].elems(off);
+  }
+
+  iter these() ref {
+    for (s, offs) in dom._entryPieces(0, dom._numUsedEntries()-1) {
+      const seg = dom.entries[s];
+      for off in offs do
+        if seg.state[off].read() == _caFull then
+          yield data[s].elems(off);
+    }
+  }
+
+  iter these(param tag: iterKind) where tag == iterKind.leader {
+    for followThis in dom.these(tag) do
+      yield followThis;
+  }
+
+  iter these(param tag: iterKind, followThis) ref where tag == iterKind.follower {
+    var (chunk, followThisDom) = followThis;
+    if followThisDom != dom then
+      dom._checkSameLayout(followThisDom, chunk,
+                           "zippered associative array does not match the iterated domain");
+    for (s, offs) in dom._entryPieces(chunk.low, chunk.high) {
+      const seg = dom.entries[s];
+      for off in offs do
+        if seg.state[off].read() == _caFull then
+          yield data[s].elems(off);
+    }
+  }
+
+  proc dsiSerialReadWrite(f /*: Reader or Writer*/) {
+    var first = true;
+    for val in this {
+      if (first) then
+        first = false;
+      else
+        f <~> new ioLiteral(" ");
+      f <~> val;
+    }
+  }
+  proc dsiSerialWrite(f: Writer) { this.dsiSerialReadWrite(f); }
+  proc dsiSerialRead(f: Reader) { this.dsiSerialReadWrite(f); }
+
+  //
+  // Associative array interface
+  //
+  iter dsiSorted() {
+    var tableCopy: [0..#dom.dsiNumIndices] eltType;
+    for (copy, elem) in zip(tableCopy.domain, this) do
+      tableCopy(copy) = elem;
+
+    QuickSort(tableCopy);
+
+    for elem in tableCopy do
+      yield elem;
+  }
+
+  //
+  // Internal associative array interface.  The elements never move, so
+  // the domain's resize only needs _backupArray(), which here allocates
+  // storage for the segments the domain has added.
+  //
+  proc _backupArray() {
+    while numSegs < dom.numSegs {
+      data[numSegs] = new ConcurrentAssocArrData(eltType,
+                            _caSegSize(numSegs, firstSegBits));
+      numSegs += 1;
+    }
+  }
+
+  proc dsiTargetLocales() {
+    compilerError("targetLocales is unsupported by associative domains");
+  }
+
+  proc dsiHasSingleLocalSubdomain() param return true;
+
+  proc dsiLocalSubdomain() {
+    return _newDomain(dom);
+  }
+}
+
+// Element storage for one segment of a ConcurrentAssocArr
+class ConcurrentAssocArrData {
+  type eltType;
+  const size: int;
+  const dataDom = {0..#size};
+  var elems: [dataDom] eltType;
+}
+
+//
+// Mix the bits of the default hash so that the low-order bits, which
+// select a slot in a power-of-two table, depend on every input bit.
+// This is the 64-bit finalizer from MurmurHash3.
+//
+inline proc _caHash(ind): int {
+  param c1 = (0xff51afd7: uint(64) << 32) | 0xed558ccd: uint(64),
+        c2 = (0xc4ceb9fe: uint(64) << 32) | 0x1a85ec53: uint(64);
+  var h = chpl__defaultHash(ind): uint(64);
+  h ^= h >> 33;
+  h *= c1;
+  h ^= h >> 33;
+  h *= c2;
+  h ^= h >> 33;
+  return (h & max(int(64)): uint(64)): int;
+}
+
+proc _caPow2AtLeast(n: int) {
+  var size = 1;
+  while size < n do
+    size *= 2;
+  return size;
+}
+
+inline proc _caNumChunks(size: int) {
+  return (size + concurrentAssocMigrateChunk - 1) / concurrentAssocMigrateChunk;
+}
+
+//
+// Segment 0 of a domain's entries holds the first 2**firstSegBits of
+// them and segment s > 0 the next 2**(firstSegBits+s-1), so that the
+// capacity doubles with every segment, like the table.
+//
+inline proc _caEntrySeg(e: int, firstSegBits: int): (int, int) {
+  if e < 1 << firstSegBits then
+    return (0, e);
+  const top = 63 - clz(e);  // 2**top <= e
+  return (top - firstSegBits + 1, e - (1 << top));
+}
+
+inline proc _caSegStart(s: int, firstSegBits: int) {
+  return if s == 0 then 0 else 1 << (firstSegBits + s - 1);
+}
+
+inline proc _caSegSize(s: int, firstSegBits: int) {
+  return if s == 0 then 1 << firstSegBits else 1 << (firstSegBits + s - 1);
+}
@@ -344,7 +344,267 @@ where tag == iterKind.follower
   }
 }
 
+//************************* Work-stealing iterator
+//
+// Each task owns a deque holding one contiguous sub-range.  The owner
+// takes chunkSize-sized pieces from the head without locking; a task
+// that runs out picks a random victim and steals the tail half of its
+// remaining sub-range.  The victim's lock is only taken by thieves and
+// by an owner that races with a thief, so small chunks do not funnel
+// every task through one shared counter or lock.
+
+//Serial iterator
+iter stealing(c:range(?), chunkSize:int=1, numTasks:int=0) {
+
+  if debugAdvancedIters then
+    writeln("Serial work-stealing Iterator. Working with range ", c);
+
+  for i in c do yield i;
+}
+
+iter stealing(c:domain, chunkSize:int=1, numTasks:int=0) {
+
+  if debugAdvancedIters then
+    writeln("Serial work-stealing Iterator. Working with domain ", c);
+
+  for i in c do yield i;
+}
+
+// Parallel iterator
+
+// Leader iterator
+iter stealing(param tag:iterKind, c:range(?), chunkSize:int=1, numTasks:int=0)
+where tag == iterKind.leader
+{
+  assert(chunkSize > 0); // caller's responsibility
+
+  use UtilMath;
+  // # of tasks the range can fill. (fast) ceil so all work is represented
+  const chunkTasks = divceilpos(c.length, chunkSize): int;
+
+  // Check if the number of tasks is 0, in that case it returns a default value
+  const nTasks = min(chunkTasks, defaultNumTasks(numTasks));
+
+  type rType=c.type;
+  const remain:rType=densify(c,c);
+
+  // If the number of tasks is insufficient, yield in serial
+  if c.length == 0 then halt("The range is empty");
+  if nTasks == 1 then {
+    if debugAdvancedIters then
+      writeln("Work-stealing Iterator: serial execution because there is not enough work");
+    yield (remain,);
+  } else {
+    type idxType = remain.low.type;
+    for (low, high) in stealingSplit(tag, c.length:int, chunkSize, nTasks) {
+      const current:rType = remain(low:idxType .. high:idxType);
+      if debugAdvancedIters then
+        writeln("Parallel work-stealing Iterator. Working with range ", unDensify(current,c), " yielded as ", current);
+      yield (current,);
+    }
+  }
+}
+
+// Multi-dimensional domains are split along one dimension, chosen the
+// way the default rectangular leader chooses it.  Block-distributed
+// domains run the stealing iterator on each locale over its own block,
+// so tasks only steal from tasks on the same locale.
+iter stealing(param tag:iterKind, c:domain, chunkSize:int=1, numTasks:int=0)
+where tag == iterKind.leader
+{
+  assert(chunkSize > 0); // caller's responsibility
+  if !isRectangularDom(c) then
+    compilerError("stealing() is only supported on ranges and rectangular domains");
+
+  if c.numIndices == 0 then halt("The domain is empty");
+  if isBlockDom(c) {
+    const whole = c._value.whole;
+    coforall locDom in c._value.locDoms do on locDom {
+      const myBlock = locDom.myBlock;
+      if myBlock.numIndices > 0 then
+        for followThis in stealingBlock(tag, whole, myBlock, chunkSize, numTasks) do
+          yield followThis;
+    }
+  } else {
+    for followThis in stealingBlock(tag, c, c, chunkSize, numTasks) do
+      yield followThis;
+  }
+}
+
+// Follower
+iter stealing(param tag:iterKind, c:range(?), chunkSize:int, numTasks:int, followThis)
+where tag == iterKind.follower
+{
+  type rType=c.type;
+  const current:rType=unDensify(followThis(1),c);
+  if debugAdvancedIters then
+    writeln("Follower received range ", followThis, " ; shifting to ", current);
+  for i in current do {
+    yield i;
+  }
+}
+
+iter stealing(param tag:iterKind, c:domain, chunkSize:int, numTasks:int, followThis)
+where tag == iterKind.follower
+{
+  if debugAdvancedIters then
+    writeln("Follower received ", followThis);
+  // the leader yields the domain's own follower format
+  for i in c._value.these(tag, followThis) do
+    yield i;
+}
+
 //************************* Helper functions
+
+// Run the work-stealing iterator over 'block', a local subdomain of
+// 'whole', and yield followThis tuples relative to 'whole'.
+iter stealingBlock(param tag:iterKind, whole:domain, block:domain, chunkSize:int, numTasks:int)
+where tag == iterKind.leader
+{
+  use UtilMath;
+  param rank = block.rank;
+
+  // Dimension to parallelize: the first one with enough indices to keep
+  // every task busy, or else the largest one.
+  const maxTasks = defaultNumTasks(numTasks);
+  var parDim = -1, maxDim = 1;
+  for i in 1..rank {
+    if block.dim(i).length >= maxTasks {
+      parDim = i;
+      break;
+    }
+    if block.dim(i).length > block.dim(maxDim).length then
+      maxDim = i;
+  }
+  if parDim == -1 then parDim = maxDim;
+
+  var dense: rank*densify(block.dim(1), whole.dim(1)).type;
+  for param i in 1..rank do
+    dense(i) = densify(block.dim(i), whole.dim(i));
+  const parLen = block.dim(parDim).length:int;
+  const nTasks = min(divceilpos(parLen, chunkSize):int, maxTasks);
+
+  if nTasks == 1 then {
+    if debugAdvancedIters then
+      writeln("Work-stealing Iterator: serial execution because there is not enough work");
+    yield dense;
+  } else {
+    const parLow = dense(parDim).low;
+    for (low, high) in stealingSplit(tag, parLen, chunkSize, nTasks) {
+      var followThis = dense;
+      followThis(parDim) = parLow+low:parLow.type .. parLow+high:parLow.type;
+      if debugAdvancedIters then
+        writeln("Parallel work-stealing Iterator. Working on ", here, " yielded as ", followThis);
+      yield followThis;
+    }
+  }
+}
+
+// Per-task deque of the stealing iterator.  'head' is only advanced
+// by the owner; 'tail' is only lowered by thieves, under 'lock'.
+record stealDeque {
+  var head, tail: atomic int;
+  var lock: vlock;
+}
+
+// Split 0..n-1 over nTasks work-stealing tasks, yielding (low, high)
+// chunks of at most chunkSize indices.
+iter stealingSplit(param tag:iterKind, n:int, chunkSize:int, nTasks:int)
+where tag == iterKind.leader
+{
+  const SpaceThreads:domain(1)=0..#nTasks;
+  var deques:[SpaceThreads] stealDeque;
+
+  // Initial contiguous block per task
+  for tid in SpaceThreads {
+    deques[tid].head.write(tid*n/nTasks);
+    deques[tid].tail.write((tid+1)*n/nTasks);
+  }
+
+  coforall tid in 0..#nTasks with (ref deques) do {
+    var seed = tid:uint + 1;
+
+    while true {
+      // Drain the local deque
+      while true {
+        const (found, low, high) = stealTake(deques[tid], chunkSize);
+        if !found then break;
+        yield (low, high);
+      }
+
+      // Try every other task, starting from a random victim
+      seed = seed * 6364136223846793005:uint + 1442695040888963407:uint;
+      const first = ((seed >> 33) % nTasks:uint):int;
+      var stolen = false;
+      for k in 0..#nTasks {
+        const victim = (first + k) % nTasks;
+        if victim != tid && stealHalf(deques[victim], deques[tid]) {
+          if debugAdvancedIters then
+            writeln("Task ", tid, " stole ", deques[tid].head.read(), "..",
+                    deques[tid].tail.read()-1, " from task ", victim);
+          stolen = true;
+          break;
+        }
+      }
+      if !stolen then break;
+    }
+  }
+}
+
+// Owner side: claim the next chunk from the head of 'dq'.
+proc stealTake(ref dq:stealDeque, chunkSize:int)
+{
+  const low = dq.head.fetchAdd(chunkSize);
+  if low + chunkSize <= dq.tail.read() then
+    return (true, low, low + chunkSize - 1);
+
+  // A thief may be moving the tail; settle the claim under the lock.
+  dq.lock.lock();
+  const tail = dq.tail.read();
+  dq.lock.unlock();
+  if low < tail then
+    return (true, low, min(low + chunkSize, tail) - 1);
+  return (false, 0, -1);
+}
+
+// Thief side: move the tail half of 'victim's remaining range into
+// 'mine', which must be empty.  Returns false if there was nothing to
+// steal.
+proc stealHalf(ref victim:stealDeque, ref mine:stealDeque)
+{
+  victim.lock.lock();
+  const tail = victim.tail.read();
+  var split = tail - (tail - victim.head.read()) / 2;
+  while split < tail {
+    victim.tail.write(split);
+    const head = victim.head.read();
+    if head <= split then break;
+    // the owner claimed past our split point; give it that much
+    split = head;
+  }
+  if split >= tail {
+    victim.tail.write(tail);
+    victim.lock.unlock();
+    return false;
+  }
+  victim.lock.unlock();
+
+  mine.lock.lock();
+  mine.head.write(split);
+  mine.tail.write(tail);
+  mine.lock.unlock();
+  return true;
+}
+
+// The use is scoped here so that programs using this module do not
+// also get BlockDist's symbols.
+proc isBlockDom(d:domain) param {
+  use BlockDist;
+  proc isBlockDomClass(dc:BlockDom) param return true;
+  proc isBlockDomClass(dc) param return false;
+  return isBlockDomClass(d._value);
+}
+
 proc defaultNumTasks(nTasks:int)
 {
   var dnTasks=nTasks;
@@ -22,6 +22,8 @@
 pragma "no use ChapelStandard"
 module CommDiagnostics
 {
+  use Sort;
+
   //
   // multi-locale diagnostics/debugging support
   //
@@ -121,5 +123,120 @@ module CommDiagnostics
     cd.get_nb_wait = chpl_numCommWaitNBGets();
     return cd;
   }
-  
+
+  //
+  // Comm hotspots: remote GETs and PUTs counted by the source line that
+  // caused them and the locale they went to, with byte-size histograms.
+  // With a sample period N > 1, only every Nth operation on each thread
+  // is recorded (and counted N times), so recording can be left on for
+  // whole runs.  Setting CHPL_RT_COMM_HOTSPOTS in the environment turns
+  // recording on from program start.  See runtime/include/
+  // chpl-comm-hotspots.h.  The line is the one the compiler passes
+  // with the transfer; remote reads of a module-level variable
+  // currently carry the line that declares it.
+  //
+  extern const CHPL_COMM_HOT_NBUCKETS: int(32);
+
+  extern proc chpl_comm_startHotspotsHere(samplePeriod: int(64));
+  extern proc chpl_comm_stopHotspotsHere();
+  extern proc chpl_comm_resetHotspotsHere();
+  extern proc chpl_comm_snapshotHotspotsHere(): int(32);
+  extern proc chpl_comm_hotspotKind(i: int(32)): int(32);
+  extern proc chpl_comm_hotspotFile(i: int(32)): c_string;
+  extern proc chpl_comm_hotspotLine(i: int(32)): int(32);
+  extern proc chpl_comm_hotspotNode(i: int(32)): int(32);
+  extern proc chpl_comm_hotspotCount(i: int(32)): uint(64);
+  extern proc chpl_comm_hotspotBytes(i: int(32)): uint(64);
+  extern proc chpl_comm_hotspotHist(i: int(32), bucket: int(32)): uint(64);
+
+  proc startCommHotspots(samplePeriod: int = 1) {
+    for loc in Locales do on loc do
+      chpl_comm_startHotspotsHere(samplePeriod);
+  }
+  proc stopCommHotspots() {
+    for loc in Locales do on loc do
+      chpl_comm_stopHotspotsHere();
+  }
+  proc startCommHotspotsHere(samplePeriod: int = 1) {
+    chpl_comm_startHotspotsHere(samplePeriod);
+  }
+  proc stopCommHotspotsHere() { chpl_comm_stopHotspotsHere(); }
+
+  proc resetCommHotspots() {
+    for loc in Locales do on loc do
+      chpl_comm_resetHotspotsHere();
+  }
+  proc resetCommHotspotsHere() { chpl_comm_resetHotspotsHere(); }
+
+  // Label for size bucket b, which counts transfers of 2**b bytes up
+  // to (but not including) 2**(b+1).
+  proc commHotspotSizeLabel(b: int) {
+    if b < 10 then return (1 << b) + "B";
+    else if b < 20 then return (1 << (b - 10)) + "K";
+    else return (1 << (b - 20)) + "M";
+  }
+
+  //
+  // Print the n remote operations that were most frequent and the n
+  // that moved the most bytes, merged over all locales.  Each line
+  // names the operation, the source line that issued it, and the
+  // locale it went to, followed by the nonzero size buckets, each
+  // labeled with its smallest size.
+  //
+  proc printCommHotspots(n: int = 10) {
+    const kindNames = ("get", "put");
+    var keys: domain(string);
+    var counts, bytes: [keys] uint(64);
+    var hists: [keys] [0..#CHPL_COMM_HOT_NBUCKETS] uint(64);
+
+    for loc in Locales do on loc {
+      for i in 0:int(32)..#chpl_comm_snapshotHotspotsHere() {
+        const key = kindNames(chpl_comm_hotspotKind(i) + 1) + " " +
+                    chpl_comm_hotspotFile(i):string + ":" +
+                    chpl_comm_hotspotLine(i) + " -> locale " +
+                    chpl_comm_hotspotNode(i);
+        var h: [0..#CHPL_COMM_HOT_NBUCKETS] uint(64);
+        for b in 0:int(32)..#CHPL_COMM_HOT_NBUCKETS do
+          h[b] = chpl_comm_hotspotHist(i, b);
+        const c = chpl_comm_hotspotCount(i), nb = chpl_comm_hotspotBytes(i);
+        on Locales[0] {
+          keys += key;
+          counts[key] += c;
+          bytes[key] += nb;
+          hists[key] += h;
+        }
+      }
+    }
+
+    // Rank by (count, bytes) and by (bytes, count), breaking ties by
+    // name so that the report is deterministic.
+    const numKeys = keys.numIndices;
+    var names: [1..numKeys] string;
+    var byCount, byBytes: [1..numKeys] (uint(64), uint(64), int);
+    for (name, i) in zip(keys.sorted(), 1..) {
+      names[i] = name;
+      byCount[i] = (counts[name], bytes[name], -i);
+      byBytes[i] = (bytes[name], counts[name], -i);
+    }
+    QuickSort(byCount, reverse=true);
+    QuickSort(byBytes, reverse=true);
+
+    proc printRanked(title: string, ranked) {
+      writeln(title);
+      if numKeys == 0 then
+        writeln("  (none)");
+      for r in 1..min(n, numKeys) {
+        const name = names[-ranked[r](3)];
+        write("  ", name, ": ", counts[name], " ops, ", bytes[name],
+              " bytes; sizes");
+        for b in 0..#CHPL_COMM_HOT_NBUCKETS do
+          if hists[name][b] != 0 then
+            write(" ", commHotspotSizeLabel(b), ":", hists[name][b]);
+        writeln();
+      }
+    }
+
+    printRanked("Comm hotspots by operation count:", byCount);
+    printRanked("Comm hotspots by bytes moved:", byBytes);
+  }
 }
@@ -0,0 +1,200 @@
+/*
+ * Copyright 2004-2014 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+   Memory-mapped files as arrays.
+
+   file.mmapArray(eltType, ...) maps a region of a file and returns a
+   MappedArray, a 1-D array of eltType indexed 0..#numElements whose
+   elements live directly in the mapped pages.  No data is copied:
+   iterating over it (serially, with forall, or zippered with 1-D
+   arrays of the same size) reads the file through the page cache.
+
+   The parallel iterator applies the mapping's hints to each task's
+   chunk with posix_madvise (IOHINT_SEQUENTIAL -> POSIX_MADV_SEQUENTIAL,
+   IOHINT_CACHED -> POSIX_MADV_WILLNEED, IOHINT_RANDOM ->
+   POSIX_MADV_RANDOM).
+
+   Without writeBack, the mapping is copy-on-write: elements may be
+   modified but the file is never changed.  With writeBack, the file
+   must be open for writing; it is extended if needed to cover the
+   region, modifications go to the file, and flush() (or deleting the
+   MappedArray) msyncs them.
+
+   The mapping belongs to the locale that created it and must only be
+   accessed there.  Delete the MappedArray to unmap it.
+*/
+
+use IO;
+
+extern proc qio_file_mmap_region(f:qio_file_ptr_t, offset:int(64), len:int(64),
+                                 writeback:c_int, ref data:c_void_ptr):syserr;
+extern proc qio_mmap_sync(data:c_void_ptr, len:int(64), async:c_int):syserr;
+extern proc qio_munmap_region(data:c_void_ptr, len:int(64)):syserr;
+extern proc qio_madvise_for_hints(data:c_void_ptr, len:int(64), hints:c_int):syserr;
+
+config param debugMappedFile = false;
+
+class MappedArray {
+  type eltType;
+  const home: locale = here;
+  const numElements: int;
+  const writeBack: bool;
+  const hints: iohints;
+  const dom: domain(1) = {0..#numElements};
+  var data: c_ptr(eltType);
+
+  proc ~MappedArray() {
+    on home {
+      var err:syserr = ENOERR;
+      if writeBack then
+        err = qio_mmap_sync(data:c_void_ptr, numBytes, 0);
+      if !err then
+        err = qio_munmap_region(data:c_void_ptr, numBytes);
+      if err then ioerror(err, "in ~MappedArray");
+    }
+  }
+
+  proc numBytes: int(64) {
+    extern proc sizeof(type x): int;
+    return numElements * sizeof(eltType);
+  }
+
+  proc checkLocal() {
+    if here.id != home.id then
+      halt("MappedArray accessed on locale ", here.id,
+           " but it is mapped on locale ", home.id);
+  }
+
+  inline proc this(i: int) ref {
+    if boundsChecking {
+      checkLocal();
+      if !dom.member(i) then
+        halt("MappedArray index out of bounds: ", i,
+             " (expected to be within ", dom, ")");
+    }
+    return data(i);
+  }
+
+  iter these() ref {
+    checkLocal();
+    for i in 0..#numElements do
+      yield data(i);
+  }
+
+  iter these(param tag: iterKind) where tag == iterKind.leader {
+    checkLocal();
+    const numChunks = _computeNumChunks(numElements);
+    if debugMappedFile then
+      writeln("MappedArray leader: ", numChunks, " chunks, ",
+              numElements, " elems");
+
+    if numChunks == 1 {
+      advise(0, numElements-1);
+      yield (0..numElements-1,);
+    } else {
+      coforall chunk in 1..numChunks {
+        const (lo, hi) = _computeChunkStartEnd(numElements, numChunks, chunk);
+        advise(lo-1, hi-1);
+        yield (lo-1..hi-1,);
+      }
+    }
+  }
+
+  iter these(param tag: iterKind, followThis) ref where tag == iterKind.follower {
+    const (followRange,) = followThis;
+    if boundsChecking then
+      if followRange.low < 0 || followRange.high >= numElements then
+        halt("MappedArray follower got out-of-bounds range ", followRange);
+    for i in followRange do
+      yield data(i);
+  }
+
+  // Tell the OS how elements lo..hi are about to be used.
+  proc advise(lo: int, hi: int) {
+    if hints == IOHINT_NONE || hi < lo then return;
+    const err = qio_madvise_for_hints(c_ptrTo(data(lo)):c_void_ptr,
+                                      (hi-lo+1) * (numBytes/numElements),
+                                      hints);
+    if debugMappedFile && err then
+      writeln("MappedArray: madvise failed for ", lo, "..", hi);
+  }
+
+  // Write modified elements back to the file.
+  proc flush(out error:syserr, async = false) {
+    error = ENOERR;
+    if !writeBack then return;
+    on home do
+      error = qio_mmap_sync(data:c_void_ptr, numBytes, async:c_int);
+  }
+
+  proc flush(async = false) {
+    var err:syserr = ENOERR;
+    flush(err, async);
+    if err then ioerror(err, "in MappedArray.flush");
+  }
+
+  proc writeThis(f: Writer) {
+    var first = true;
+    for e in this {
+      if first then first = false; else f.write(" ");
+      f.write(e);
+    }
+  }
+}
+
+// Map numElements elements of eltType from the file, starting at byte
+// offset 'start'.  If numElements is negative, map through the end of
+// the file.
+proc file.mmapArray(type eltType, out error:syserr, start:int(64) = 0,
+                    numElements:int(64) = -1, writeBack = false,
+                    hints:iohints = IOHINT_SEQUENTIAL): MappedArray(eltType) {
+  if !(isNumericType(eltType) || isBoolType(eltType)) then
+    compilerError("mmapArray requires a numeric or bool element type");
+  extern proc sizeof(type x): int;
+
+  check();
+  var ret: MappedArray(eltType);
+  on this.home {
+    var n = numElements;
+    error = ENOERR;
+    if n < 0 {
+      var len:int(64);
+      error = qio_file_length(_file_internal, len);
+      n = max(0, len - start) / sizeof(eltType);
+    }
+    var data:c_void_ptr;
+    if !error && n > 0 then
+      error = qio_file_mmap_region(_file_internal, start, n*sizeof(eltType),
+                                   writeBack:c_int, data);
+    if !error then
+      ret = new MappedArray(eltType, numElements=n, writeBack=writeBack,
+                            hints=hints, data=data:c_ptr(eltType));
+  }
+  return ret;
+}
+
+proc file.mmapArray(type eltType, start:int(64) = 0, numElements:int(64) = -1,
+                    writeBack = false,
+                    hints:iohints = IOHINT_SEQUENTIAL): MappedArray(eltType) {
+  var err:syserr = ENOERR;
+  var ret = this.mmapArray(eltType, err, start, numElements, writeBack, hints);
+  if err then ioerror(err, "in file.mmapArray", this.tryGetPath());
+  return ret;
+}
@@ -62,6 +62,11 @@ proc printMemStat() {
   chpl_printMemStat();
 }
 
+proc printHugePageUsage() {
+  extern proc chpl_mem_printHugePageUsage();
+  chpl_mem_printHugePageUsage();
+}
+
 proc startVerboseMem() { 
   extern proc chpl_startVerboseMem();
   chpl_startVerboseMem();
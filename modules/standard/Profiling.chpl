@@ -0,0 +1,139 @@
+/*
+ * Copyright 2004-2014 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+   Task profiling.
+
+   While profiling is on, each locale counts, per profiling region, the
+   tasks spawned and run, how long they ran, how long they waited to
+   start, and how often and how long they blocked on sync variables.
+   With CHPL_RT_PROFILE_HW set it also counts CPU cycles and cache
+   misses.  Tasks inherit the region of the task that spawned them, so
+   marking a region around a forall attributes the forall's tasks to
+   it:
+
+     const r = beginProfileRegion("stencil");
+     forall i in D do ...;
+     endProfileRegion(r);
+
+   Results can be printed, merged across locales, with printProfile(),
+   or written with dumpProfile() to one file per locale.  The runtime
+   also honors CHPL_RT_PROFILE (profile from program start) and
+   CHPL_RT_PROFILE_FILE (dump at exit).  Counts are exact only when
+   read while no other tasks are running.  See runtime/include/
+   chpl-prof.h for details.
+*/
+module Profiling {
+
+  enum profCounter { tasksSpawned=0, tasksRun, runNs, queueWaitNs,
+                     syncWaits, syncWaitNs, cycles, cacheMisses };
+
+  const allProfCounters = (profCounter.tasksSpawned, profCounter.tasksRun,
+                           profCounter.runNs, profCounter.queueWaitNs,
+                           profCounter.syncWaits, profCounter.syncWaitNs,
+                           profCounter.cycles, profCounter.cacheMisses);
+
+  extern proc chpl_prof_start();
+  extern proc chpl_prof_stop();
+  extern proc chpl_prof_reset();
+  extern proc chpl_prof_beginRegion(name: c_string): int(32);
+  extern proc chpl_prof_endRegion(prevRegion: int(32));
+  extern proc chpl_prof_getNumRegions(): int(32);
+  extern proc chpl_prof_getRegionName(region: int(32)): c_string;
+  extern proc chpl_prof_getCounter(region: int(32), counter: int(32)): uint(64);
+  extern proc chpl_prof_dump(filename: c_string): c_int;
+
+  proc startProfiling() {
+    for loc in Locales do on loc do
+      chpl_prof_start();
+  }
+
+  proc stopProfiling() {
+    for loc in Locales do on loc do
+      chpl_prof_stop();
+  }
+
+  proc startProfilingHere() { chpl_prof_start(); }
+  proc stopProfilingHere() { chpl_prof_stop(); }
+
+  proc resetProfiling() {
+    for loc in Locales do on loc do
+      chpl_prof_reset();
+  }
+
+  proc resetProfilingHere() { chpl_prof_reset(); }
+
+  // Move the calling task into the named region, returning a handle
+  // for the region it was in; pass that to endProfileRegion().
+  proc beginProfileRegion(name: string): int(32) {
+    return chpl_prof_beginRegion(name.c_str());
+  }
+
+  proc endProfileRegion(prevRegion: int(32)) {
+    chpl_prof_endRegion(prevRegion);
+  }
+
+  // The count for the named region on this locale, or 0 if the region
+  // was never entered here.
+  proc getProfileCounterHere(region: string, counter: profCounter): uint(64) {
+    for r in 0:int(32)..#chpl_prof_getNumRegions() do
+      if chpl_prof_getRegionName(r):string == region then
+        return chpl_prof_getCounter(r, counter:int(32));
+    return 0;
+  }
+
+  // The count for the named region summed over all locales.
+  proc getProfileCounter(region: string, counter: profCounter): uint(64) {
+    var counts: [LocaleSpace] uint(64);
+    for loc in Locales do on loc do
+      counts[loc.id] = getProfileCounterHere(region, counter);
+    return + reduce counts;
+  }
+
+  // Print one line per region, summing each counter over all locales.
+  proc printProfile() {
+    // Regions are numbered per locale, so merge them by name.
+    var regions: domain(string);
+    for loc in Locales do on loc {
+      for r in 0:int(32)..#chpl_prof_getNumRegions() {
+        const name = chpl_prof_getRegionName(r):string;
+        on Locales[0] do regions += name;
+      }
+    }
+
+    write("region");
+    for c in allProfCounters do write("\t", c);
+    writeln();
+    for name in regions.sorted() {
+      write(name);
+      for c in allProfCounters do write("\t", getProfileCounter(name, c));
+      writeln();
+    }
+  }
+
+  // Write each locale's results to <prefix>.<locale id>.
+  proc dumpProfile(prefix: string) {
+    for loc in Locales do on loc {
+      const filename = prefix + "." + here.id;
+      const err = chpl_prof_dump(filename.c_str());
+      if err != 0 then
+        halt("cannot write task profile to ", filename);
+    }
+  }
+}
@@ -89,6 +89,9 @@ inline proc _cast(type t, x) where t:c_ptr && x.type:c_ptr {
 inline proc _cast(type t, x) where t:c_void_ptr && x.type:c_ptr {
   return __primitive("cast", t, x);
 }
+inline proc _cast(type t, x) where t:c_ptr && x.type:c_void_ptr {
+  return __primitive("cast", t, x);
+}
 
 
 inline proc c_calloc(type eltType, size: integral) {
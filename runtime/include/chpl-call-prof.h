@@ -0,0 +1,72 @@
+/*
+ * Copyright 2004-2014 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _chpl_call_prof_h_
+#define _chpl_call_prof_h_
+
+#ifndef LAUNCHER
+
+#include <stdint.h>
+#include "chpl-atomics.h"
+#include "chpltypes.h"
+
+//
+// Call site profiling.
+//
+// A program compiled with --profile-generate counts how often each of
+// its profiled call sites runs.  The compiler numbers the sites from 0
+// to chpl_numCallSites-1 and puts a call to chpl_call_prof_count()
+// ahead of each one.  At exit each locale writes its counts to
+// <prefix>.<locale id>, for the compiler to read back with
+// --profile-use <prefix>.  The file has a header line giving the
+// number of sites, then one line per site that ran, with the site
+// number, its count, and its fingerprint: the name of the function it
+// calls and the file and line of the call.  The compiler ignores a
+// profile whose fingerprints do not match the program it is compiling.
+// Calls are not counted per function as well: a function's count is
+// the sum of the counts of the sites that call it.
+//
+// Environment:
+//   CHPL_RT_CALL_PROFILE_FILE  the prefix; "chpl-call-profile" if unset
+//
+
+// Generated by the compiler; 0 unless compiled with --profile-generate.
+extern const int chpl_numCallSites;
+extern const char* chpl_callSiteNames[];
+
+extern atomic_uint_least64_t* chpl_call_prof_counts;
+
+void chpl_call_prof_init(void);
+void chpl_call_prof_exit(void);
+
+//
+// Module code can run before the counters are allocated, for instance
+// when chpl_mem_init() sets the memory tracking flags; those calls are
+// not counted.
+//
+static ___always_inline
+void chpl_call_prof_count(int32_t site) {
+  if (chpl_call_prof_counts != NULL)
+    atomic_fetch_add_explicit_uint_least64_t(&chpl_call_prof_counts[site], 1,
+                                             memory_order_relaxed);
+}
+
+#endif // LAUNCHER
+
+#endif
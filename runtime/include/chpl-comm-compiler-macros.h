@@ -23,6 +23,7 @@
 #ifndef LAUNCHER
 
 #include "chpl-comm.h"
+#include "chpl-comm-hotspots.h"
 #include "chpl-mem.h"
 #include "error.h"
 #include "chpl-wide-ptr-fns.h"
@@ -45,6 +46,7 @@ void chpl_gen_comm_get(void *addr, c_nodeid_t node, void* raddr,
                        int32_t elemSize, int32_t typeIndex, int32_t len,
                        int ln, c_string fn)
 {
+  chpl_comm_hotspots_xfer(chpl_comm_hot_get, node, elemSize, len, ln, fn);
   if (chpl_nodeID == node) {
     if (raddr != addr)
       chpl_memcpy(addr, raddr, elemSize*len);
@@ -94,6 +96,7 @@ void chpl_gen_comm_put(void* addr, c_nodeid_t node, void* raddr,
                        int32_t elemSize, int32_t typeIndex, int32_t len,
                        int ln, c_string fn)
 {
+  chpl_comm_hotspots_xfer(chpl_comm_hot_put, node, elemSize, len, ln, fn);
   if (chpl_nodeID == node) {
     chpl_memcpy(raddr, addr, elemSize*len);
 #ifdef HAS_CHPL_CACHE_FNS
@@ -115,6 +118,8 @@ void chpl_gen_comm_get_strd(void *addr, void *dststr, c_nodeid_t node, void *rad
                        int32_t elemSize, int32_t typeIndex,
                        int ln, c_string fn)
 {
+  chpl_comm_hotspots_xfer_strd(chpl_comm_hot_get, node, count, strlevels,
+                               elemSize, ln, fn);
   if( 0 ) {
 #ifdef HAS_CHPL_CACHE_FNS
   } else if( chpl_cache_enabled() ) {
@@ -135,6 +140,8 @@ void chpl_gen_comm_put_strd(void *addr, void *dststr, c_nodeid_t node, void *rad
                        int32_t elemSize, int32_t typeIndex,
                        int ln, c_string fn)
 {
+  chpl_comm_hotspots_xfer_strd(chpl_comm_hot_put, node, count, strlevels,
+                               elemSize, ln, fn);
   if( 0 ) {
 #ifdef HAS_CHPL_CACHE_FNS
   } else if( chpl_cache_enabled() ) {
@@ -199,7 +206,10 @@ void chpl_check_nil(void* ptr, int32_t lineno, const char* filename)
 
 static ___always_inline
 void* chpl_array_alloc(size_t nmemb, size_t eltSize, int32_t lineno, const char* filename) {
-  return chpl_mem_allocManyZero(nmemb, eltSize, CHPL_RT_MD_ARRAY_ELEMENTS, lineno, filename);
+  void* p = chpl_mem_allocManyZero(nmemb, eltSize, CHPL_RT_MD_ARRAY_ELEMENTS, lineno, filename);
+  if (nmemb * eltSize >= chpl_mem_hugePageThreshold)
+    chpl_mem_adviseHugePages(p, nmemb * eltSize);
+  return p;
 }
 
 static ___always_inline
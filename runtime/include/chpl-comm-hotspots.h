@@ -0,0 +1,116 @@
+/*
+ * Copyright 2004-2014 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _chpl_comm_hotspots_h_
+#define _chpl_comm_hotspots_h_
+
+#ifndef LAUNCHER
+
+#include <stdint.h>
+#include "chpl-comm.h"
+#include "chpltypes.h"
+
+//
+// Communication hotspots.
+//
+// While hotspot recording is on, each locale counts the remote GETs
+// and PUTs issued by generated code, bucketed by the source line that
+// caused them and the locale they went to, with a histogram of their
+// sizes in bytes.  Size bucket b counts transfers of 2^b through
+// 2^(b+1)-1 bytes; the last bucket also counts everything larger.
+//
+// Recording can sample, counting only every Nth operation on each
+// thread and weighting it by N, which keeps the overhead low enough
+// to leave on for whole runs.  The counts are then estimates.
+//
+// Counters are kept per thread and merged when read, so the totals
+// are exact (up to sampling) only while no other tasks are running.
+//
+// Environment:
+//   CHPL_RT_COMM_HOTSPOTS  if set, record from program start, sampling
+//                          every Nth operation if the value is a
+//                          number N > 1; each locale then prints its
+//                          top hotspots at exit
+//
+
+#define CHPL_COMM_HOT_NBUCKETS 24
+
+typedef enum {
+  chpl_comm_hot_get,
+  chpl_comm_hot_put,
+  chpl_comm_hot_numKinds
+} chpl_comm_hot_kind_t;
+
+extern volatile chpl_bool chpl_comm_hotspots_on;
+
+void chpl_comm_hotspots_init(void);
+void chpl_comm_hotspots_exit(void);
+
+//
+// These act on the calling locale only.  A sample period of 1 or less
+// records every operation.
+//
+void chpl_comm_startHotspotsHere(int64_t samplePeriod);
+void chpl_comm_stopHotspotsHere(void);
+void chpl_comm_resetHotspotsHere(void);
+
+//
+// Merge the per-thread counts into a snapshot, most frequent first,
+// and return the number of entries in it.  The accessors read entry i
+// of the most recent snapshot.
+//
+int32_t chpl_comm_snapshotHotspotsHere(void);
+int32_t chpl_comm_hotspotKind(int32_t i);
+c_string chpl_comm_hotspotFile(int32_t i);
+int32_t chpl_comm_hotspotLine(int32_t i);
+int32_t chpl_comm_hotspotNode(int32_t i);
+uint64_t chpl_comm_hotspotCount(int32_t i);
+uint64_t chpl_comm_hotspotBytes(int32_t i);
+uint64_t chpl_comm_hotspotHist(int32_t i, int32_t bucket);
+
+void chpl_comm_hotspots_record(chpl_comm_hot_kind_t kind, int32_t node,
+                               uint64_t bytes, int ln, c_string fn);
+
+//
+// Generated-code hooks.  These ignore transfers within the locale.
+//
+static ___always_inline
+void chpl_comm_hotspots_xfer(chpl_comm_hot_kind_t kind, int32_t node,
+                             int32_t elemSize, int32_t len,
+                             int ln, c_string fn) {
+  if (chpl_comm_hotspots_on && node != chpl_nodeID)
+    chpl_comm_hotspots_record(kind, node, (uint64_t) elemSize * len, ln, fn);
+}
+
+static ___always_inline
+void chpl_comm_hotspots_xfer_strd(chpl_comm_hot_kind_t kind, int32_t node,
+                                  void* count, int32_t strlevels,
+                                  int32_t elemSize, int ln, c_string fn) {
+  if (chpl_comm_hotspots_on && node != chpl_nodeID) {
+    uint64_t bytes = (uint64_t) elemSize;
+    int32_t i;
+    for (i = 0; i <= strlevels; i++)
+      bytes *= (uint64_t) ((int32_t*) count)[i];
+    chpl_comm_hotspots_record(kind, node, bytes, ln, fn);
+  }
+}
+
+#endif // LAUNCHER
+
+#endif
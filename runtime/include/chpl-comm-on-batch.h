@@ -0,0 +1,76 @@
+/*
+ * Copyright 2004-2014 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _chpl_comm_on_batch_h_
+#define _chpl_comm_on_batch_h_
+
+#ifndef LAUNCHER
+
+#include <stdint.h>
+#include "chpltypes.h"
+
+//
+// Batched "on" statements.
+//
+// In a forall whose body ends in a fast "on" (one the compiler has
+// shown cannot block or communicate), the compiler replaces each fork
+// with chpl_comm_on_batch_add(), which copies the argument bundle into
+// a buffer belonging to the task running the loop.  Consecutive bundles
+// for the same target are then sent in one fast fork of the batch
+// runner, a compiler-generated function that passes the buffer to
+// chpl_comm_on_batch_run() on the target, which calls the on-body of
+// each bundle in turn.  The buffer is sent when the target changes,
+// when it is full, and when the loop ends.  Bundles for the calling
+// locale are not buffered; their on-bodies are called directly.
+//
+
+//
+// The most bytes of bundles sent in one fork.
+//
+#define CHPL_COMM_ON_BATCH_BYTES 4096
+
+//
+// Return a new, empty batch whose buffers will be run by the function
+// with ftable index runner_fid.
+//
+void* chpl_comm_on_batch_create(chpl_fn_int_t runner_fid, int ln, c_string fn);
+
+//
+// Add a call of the on-body with ftable index fid, on the locale loc,
+// with the argument bundle arg.  The bundle is copied, so the caller
+// may free it upon return.
+//
+void chpl_comm_on_batch_add(void* batch, chpl_localeID_t* loc,
+                            chpl_fn_int_t fid, void* arg, int32_t arg_size,
+                            int ln, c_string fn);
+
+//
+// Send anything still buffered, wait for it to complete, and free the
+// batch.
+//
+void chpl_comm_on_batch_finish(void* batch, int ln, c_string fn);
+
+//
+// Run the on-bodies in a buffer received by the batch runner.
+//
+void chpl_comm_on_batch_run(void* buf);
+
+#endif // LAUNCHER
+
+#endif
@@ -45,6 +45,13 @@ extern int chpl_verbose_comm;     // set via startVerboseComm
 extern int chpl_comm_diagnostics; // set via startCommDiagnostics
 extern int chpl_verbose_mem;      // set via startVerboseMem
 
+//
+// Return the size given by environment variable 'var', such as "4096",
+// "2m", or "1g".  Return 'dflt' if it is not set, or warn and return
+// 'dflt' if it cannot be parsed.
+//
+size_t chpl_comm_getenvSize(const char* var, size_t dflt);
+
 size_t chpl_comm_getenvMaxHeapSize(void);
 
 
@@ -23,6 +23,7 @@
 #include "chpl-atomics.h" // for memory_order
 
 #include "chpl-cache.h" // for chpl_cache_release, chpl_cache_acquire
+#include "chpl-trace.h"
 
 // These functions support memory consistency with the remote
 // data cache. They do not need to do anything if the cache is
@@ -60,6 +61,7 @@
 static ___always_inline
 void chpl_rmem_consist_release(int ln, c_string fn)
 {
+  chpl_trace_event(chpl_trace_fenceRelease, -1, 0, 0);
 #ifdef HAS_CHPL_CACHE_FNS
   chpl_cache_release(ln, fn);
 #endif
@@ -68,6 +70,7 @@ void chpl_rmem_consist_release(int ln, c_string fn)
 static ___always_inline
 void chpl_rmem_consist_acquire(int ln, c_string fn)
 {
+  chpl_trace_event(chpl_trace_fenceAcquire, -1, 0, 0);
 #ifdef HAS_CHPL_CACHE_FNS
   chpl_cache_acquire(ln, fn);
 #endif
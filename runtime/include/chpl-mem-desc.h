@@ -118,8 +118,18 @@
           "task pool descriptor"),                                      \
         m(TASK_LIST_DESCRIPTOR,                                         \
           "task list descriptor"),                                      \
+        m(POOLED_ALLOC_CACHE,                                           \
+          "per-thread pooled allocation cache"),                        \
         m(THREAD_PRIVATE_DATA,                                          \
           "thread private data"),                                       \
+        m(TASK_PROFILE_DATA,                                            \
+          "task profiling data"),                                       \
+        m(EVENT_TRACE_DATA,                                             \
+          "event trace buffer"),                                        \
+        m(COMM_HOTSPOTS,                                                \
+          "comm hotspot counters"),                                     \
+        m(CALL_PROFILE_DATA,                                            \
+          "call site profile counters"),                                \
         m(THREAD_LIST_DESCRIPTOR,                                       \
           "thread list descriptor"),                                    \
         m(IO_BUFFER,                                                    \
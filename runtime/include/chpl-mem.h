@@ -136,6 +136,65 @@ void chpl_rt_free_c_string(c_string* s, int32_t lineno, c_string filename)
   chpl_rt_free_c_string_copy(s, lineno, filename);
 }
 
+//
+// Pooled allocation, for small blocks that are allocated and freed
+// very often, such as task descriptors and the argument bundles the
+// compiler builds for begin, cobegin, coforall, and on statements.
+// Freed blocks go back on a free list of the thread that allocated
+// them, so the common case takes no locks and does not touch the
+// memory layer, even when a task frees a block its spawner allocated.
+// Blocks from chpl_mem_allocPooled() must be freed with
+// chpl_mem_freePooled() and vice versa.  When memory tracking is on
+// every request goes to chpl_mem_alloc()/chpl_mem_free() so it is
+// tracked as usual.
+//
+void* chpl_mem_allocPooled(size_t size, chpl_mem_descInt_t description,
+                           int32_t lineno, c_string filename);
+void chpl_mem_freePooled(void* memAlloc, int32_t lineno, c_string filename);
+
+//
+// Release the per-thread pool caches and the free blocks on them.
+// Call this only once no other thread can use the pool; blocks
+// allocated or freed afterward bypass it.
+//
+void chpl_mem_exitPools(void);
+
+//
+// Ask that the pages of [start, start+len) come from the
+// memory of the NUMA domain for sublocale 'subloc' when first touched.
+// This is advice: it does nothing where NUMA placement isn't
+// supported, for pages the range only partly covers, or if 'subloc'
+// isn't a specific sublocale.
+//
+void chpl_mem_localizeToSubloc(void* start, size_t len, c_sublocid_t subloc);
+
+//
+// Huge pages.  CHPL_RT_HUGE_PAGES selects a policy:
+//   none        default pages everywhere (the default)
+//   transparent ask for transparent huge pages, via madvise(), for
+//               the registered heap and for array data of at least
+//               CHPL_RT_HUGE_PAGE_THRESHOLD bytes
+//   hugetlb     as for transparent, but a memory layer that maps its
+//               own heap takes it from the hugetlbfs pool instead,
+//               in pages of CHPL_RT_HUGE_PAGE_SIZE (2m or 1g)
+// The threshold defaults to the huge page size.
+// chpl_mem_printHugePageUsage() prints the policy, what was advised,
+// and how much memory huge pages back right now, for this locale; if
+// CHPL_RT_HUGE_PAGE_REPORT is set each locale also prints it at exit.
+// chpl_mem_hugePageThreshold is SIZE_MAX when the policy is none, so
+// callers need only compare against it.
+//
+extern size_t chpl_mem_hugePageThreshold;
+void chpl_mem_adviseHugePages(void* start, size_t len);
+void chpl_mem_printHugePageUsage(void);
+
+//
+// Map a heap from the hugetlbfs pool for a memory layer to manage.
+// Returns NULL unless the policy is hugetlb and the pool can supply
+// CHPL_RT_MAX_HEAP_SIZE bytes; on success *size_p is the heap size.
+//
+void* chpl_mem_mapHugeHeap(size_t* size_p);
+
 void chpl_mem_layerInit(void);
 void chpl_mem_layerExit(void);
 void* chpl_mem_layerAlloc(size_t, int32_t lineno, c_string filename);
@@ -0,0 +1,141 @@
+/*
+ * Copyright 2004-2014 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _chpl_prof_h_
+#define _chpl_prof_h_
+
+#ifndef LAUNCHER
+
+#include <stdint.h>
+#include "chpltypes.h"
+
+//
+// Task profiling.
+//
+// While profiling is on, each locale counts, per profiling region, the
+// tasks spawned and run, how long they ran, how long they waited in
+// the task queue before starting, and how often and how long they
+// blocked on sync variables.  Optionally it also counts CPU cycles and
+// cache misses with perf_event_open().  A task starts in the region
+// its parent was in when it spawned it and may move to another with
+// chpl_prof_beginRegion().  Region 0 covers everything outside any
+// named region.
+//
+// A task's run time includes time spent blocked, but not time spent
+// running other tasks inline (as when a coforall runs its first task
+// itself).  The main task, and a task that turns profiling on, is
+// timed from the moment profiling is turned on.
+//
+// Counters are kept per thread and summed when read, so the totals
+// are exact only while no other tasks are running.
+//
+// Environment:
+//   CHPL_RT_PROFILE       if set, profiling is on from program start
+//   CHPL_RT_PROFILE_HW    if set, count cycles and cache misses too
+//   CHPL_RT_PROFILE_FILE  if set, each locale dumps its results to
+//                         <value>.<locale id> at exit
+//
+
+#define CHPL_PROF_MAX_REGIONS 64
+
+typedef enum {
+  chpl_prof_tasksSpawned,
+  chpl_prof_tasksRun,
+  chpl_prof_runNs,
+  chpl_prof_queueWaitNs,
+  chpl_prof_syncWaits,
+  chpl_prof_syncWaitNs,
+  chpl_prof_cycles,
+  chpl_prof_cacheMisses,
+  chpl_prof_numCounters
+} chpl_prof_counter_t;
+
+extern volatile chpl_bool chpl_prof_on;
+
+// chpl_prof_init() must follow tasking layer initialization.
+void chpl_prof_init(void);
+void chpl_prof_exit(void);
+
+//
+// These act on the calling locale only.
+//
+void chpl_prof_start(void);
+void chpl_prof_stop(void);
+void chpl_prof_reset(void);
+
+//
+// Move the calling task into the named region, returning the region
+// it was in.  Pass the result to chpl_prof_endRegion() to move back.
+//
+int32_t chpl_prof_beginRegion(c_string name);
+void chpl_prof_endRegion(int32_t prevRegion);
+
+int32_t chpl_prof_getNumRegions(void);
+c_string chpl_prof_getRegionName(int32_t region);
+uint64_t chpl_prof_getCounter(int32_t region, int32_t counter);
+
+//
+// Write this locale's results to the named file, one line per region
+// with a column per counter.  Files from different locales have the
+// same layout, so they can be merged by summing lines with the same
+// region name.  Returns 0 on success or an errno value.
+//
+int chpl_prof_dump(c_string filename);
+
+//
+// Tasking layer hooks.
+//
+// Call chpl_prof_taskSpawned() once per task created, and record
+// chpl_prof_stamp() when the task is queued.  Bracket running it with
+// chpl_prof_taskBegin() and chpl_prof_taskEnd(), passing the same
+// state to both.  When a task has to wait for a sync variable, record
+// chpl_prof_stamp() as it starts waiting and pass that to
+// chpl_prof_syncWaited() once it is done.  chpl_prof_stamp() is 0
+// when profiling is off, and the hooks then do nothing.
+//
+typedef struct {
+  chpl_bool valid;
+  int32_t   region;
+  uint64_t  start;
+  uint64_t  hwStart[2];
+} chpl_prof_taskState_t;
+
+uint64_t chpl_prof_now(void);
+
+void chpl_prof_countSpawn(int32_t region);
+
+static ___always_inline
+void chpl_prof_taskSpawned(int32_t region) {
+  if (chpl_prof_on)
+    chpl_prof_countSpawn(region);
+}
+
+static ___always_inline
+uint64_t chpl_prof_stamp(void) {
+  return chpl_prof_on ? chpl_prof_now() : 0;
+}
+
+void chpl_prof_taskBegin(int32_t region, uint64_t queuedAt,
+                         chpl_prof_taskState_t* saved);
+void chpl_prof_taskEnd(chpl_prof_taskState_t* saved);
+void chpl_prof_syncWaited(uint64_t since);
+
+#endif // LAUNCHER
+
+#endif
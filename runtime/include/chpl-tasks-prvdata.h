@@ -26,6 +26,7 @@
 // The type for task private data
 typedef struct {
   chpl_bool serial_state;      // true: serialize execution
+  int32_t prof_region;         // task profiling region; see chpl-prof.h
   chpl_comm_taskPrvData_t comm_data;
 } chpl_task_prvData_t;
 
@@ -0,0 +1,114 @@
+/*
+ * Copyright 2004-2014 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _chpl_trace_h_
+#define _chpl_trace_h_
+
+#ifndef LAUNCHER
+
+#include <stdint.h>
+#include "chpltypes.h"
+
+//
+// Event tracing.
+//
+// If CHPL_RT_TRACE is set, each thread records task, communication,
+// fence, and barrier events with timestamps into a ring buffer of its
+// own, and at exit each locale writes its buffers to the binary file
+// <value of CHPL_RT_TRACE>.<locale id>.  When a ring fills, the oldest
+// events are overwritten, so the file holds the most recent
+// CHPL_RT_TRACE_EVENTS (default 65536) events per thread.
+// util/devel/chplTraceToJSON converts the files from all the locales
+// into a single Chrome trace (chrome://tracing, Perfetto).
+//
+// Task events are hooked only in the fifo tasking layer, and gets,
+// puts, and forks only in the gasnet comm layer.  Barriers are hooked
+// in the none and gasnet comm layers, and fences everywhere.  See
+// "Tracing Events" in doc/release/README.executing.
+//
+// File layout, in the writer's byte order:
+//   chpl_trace_fileHdr_t
+//   for each thread:
+//     chpl_trace_threadHdr_t
+//     numEvents chpl_trace_event_t, oldest first
+//
+
+typedef enum {
+  chpl_trace_taskCreate,  // arg: task ID
+  chpl_trace_taskStart,   // arg: task ID
+  chpl_trace_taskEnd,     // arg: task ID
+  chpl_trace_forkBegin,   // blocking on; peer, arg: argument bytes
+  chpl_trace_forkEnd,     // blocking or fast on has returned; peer
+  chpl_trace_forkNb,      // non-blocking on; peer, arg: argument bytes
+  chpl_trace_forkFast,    // fast on; peer, arg: argument bytes
+  chpl_trace_get,         // peer, arg: bytes; flags: strided, nb
+  chpl_trace_put,         // peer, arg: bytes; flags: strided, nb
+  chpl_trace_fenceAcquire,
+  chpl_trace_fenceRelease,
+  chpl_trace_barrierBegin,
+  chpl_trace_barrierEnd,
+  chpl_trace_numEventTypes
+} chpl_trace_eventType_t;
+
+#define CHPL_TRACE_FLAG_STRIDED 0x1
+#define CHPL_TRACE_FLAG_NB      0x2
+
+typedef struct {
+  uint64_t time;   // ns since the epoch
+  uint64_t arg;    // task ID or byte count, per the event type
+  int32_t  peer;   // the other locale, or -1
+  uint16_t type;   // chpl_trace_eventType_t
+  uint16_t flags;
+} chpl_trace_event_t;
+
+#define CHPL_TRACE_MAGIC   "CHPLTRC"
+#define CHPL_TRACE_VERSION 1
+
+typedef struct {
+  char     magic[8];     // CHPL_TRACE_MAGIC, NUL-terminated
+  uint32_t version;      // CHPL_TRACE_VERSION
+  int32_t  node;
+  int32_t  numNodes;
+  uint32_t numThreads;
+} chpl_trace_fileHdr_t;
+
+typedef struct {
+  uint32_t thread;       // index of the thread on this locale
+  uint32_t numEvents;
+  uint64_t numDropped;   // older events overwritten in the ring
+} chpl_trace_threadHdr_t;
+
+extern volatile chpl_bool chpl_trace_on;
+
+void chpl_trace_init(void);
+void chpl_trace_exit(void);
+
+void chpl_trace_record(chpl_trace_eventType_t type, int32_t peer,
+                       uint64_t arg, uint16_t flags);
+
+static ___always_inline
+void chpl_trace_event(chpl_trace_eventType_t type, int32_t peer,
+                      uint64_t arg, uint16_t flags) {
+  if (chpl_trace_on)
+    chpl_trace_record(type, peer, arg, flags);
+}
+
+#endif // LAUNCHER
+
+#endif
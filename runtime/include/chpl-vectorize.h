@@ -0,0 +1,48 @@
+/*
+ * Copyright 2004-2014 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ * 
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ * 
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _chpl_vectorize_h_
+#define _chpl_vectorize_h_
+
+#include "chpl-comp-detect-macros.h"
+
+//
+// The compiler puts CHPL_PRAGMA_IVDEP in front of loops whose iterations
+// may run in any order (those of forall followers), to tell the back-end
+// compiler that it may ignore assumed loop-carried dependences and
+// vectorize them.  With OpenMP 4.0 enabled we say so with 'omp simd';
+// otherwise we use whatever the compiler offers, or nothing.
+//
+#if defined(_OPENMP) && _OPENMP >= 201307
+#define CHPL_PRAGMA_IVDEP _Pragma("omp simd")
+#elif RT_COMP_CC == RT_COMP_CRAY
+#define CHPL_PRAGMA_IVDEP _Pragma("_CRI ivdep")
+#elif RT_COMP_CC == RT_COMP_INTEL
+#define CHPL_PRAGMA_IVDEP _Pragma("ivdep")
+#elif RT_COMP_CC == RT_COMP_CLANG && \
+      (__clang_major__ > 3 || (__clang_major__ == 3 && __clang_minor__ >= 9))
+#define CHPL_PRAGMA_IVDEP _Pragma("clang loop vectorize(assume_safety)")
+#elif RT_COMP_CC == RT_COMP_GCC && \
+      (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define CHPL_PRAGMA_IVDEP _Pragma("GCC ivdep")
+#else
+#define CHPL_PRAGMA_IVDEP
+#endif
+
+#endif // _chpl_vectorize_h_
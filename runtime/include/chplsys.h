@@ -28,6 +28,7 @@ uint64_t chpl_bytesPerLocale(void);
 size_t chpl_bytesAvailOnThisLocale(void);
 int chpl_getNumPhysicalCpus(chpl_bool accessible_only);
 int chpl_getNumLogicalCpus(chpl_bool accessible_only);
+size_t chpl_getSysPageSize(void);
 
 //
 // returns the name of a locale via uname -n or the like
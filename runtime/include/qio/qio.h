@@ -572,6 +572,17 @@ qioerr qio_file_close(qio_file_t* f);
 
 qioerr qio_file_sync(qio_file_t* f);
 
+// Map len bytes of the file starting at offset (which need not be
+// page-aligned) and return a pointer to the first byte.  With
+// writeback, the mapping is shared and a writeable file is extended to
+// cover the region; otherwise the mapping is copy-on-write.
+qioerr qio_file_mmap_region(qio_file_t* file, int64_t offset, int64_t len, int writeback, void** data_out);
+// msync/munmap a region returned by qio_file_mmap_region (or part of one).
+qioerr qio_mmap_sync(void* data, int64_t len, int async);
+qioerr qio_munmap_region(void* data, int64_t len);
+// posix_madvise the pages covering [data, data+len) according to hints.
+qioerr qio_madvise_for_hints(void* data, int64_t len, qio_hint_t hints);
+
 // This one gets called automatically.
 void _qio_file_destroy(qio_file_t* f);
 
@@ -41,7 +41,10 @@
 #include "chplcgfns.h"
 #include "chpl-atomics.h"
 #include "chpl-bitops.h"
+#include "chpl-call-prof.h"
 #include "chpl-comm.h"
+#include "chpl-comm-hotspots.h"
+#include "chpl-comm-on-batch.h"
 #include "chpldirent.h"
 #include "chplexit.h"
 #include "chpl-file-utils.h"
@@ -54,11 +57,14 @@
 #include "chplmemtrack.h"
 #include "chpl-prefetch.h"
 #include "chpl-privatization.h"
+#include "chpl-prof.h"
 #include "chpl-string.h"
 #include "chplsys.h"
 #include "chpl-tasks.h"
 #include "chpltimers.h"
+#include "chpl-trace.h"
 #include "chpltypes.h"
+#include "chpl-vectorize.h"
 #include "error.h"
 
 #include "chplgmp.h"
@@ -48,14 +48,27 @@ typedef uint64_t chpl_taskID_t;
 #define chpl_nullTaskID 0
 
 //
-// Condition variables
+// Sync variables
 //
-typedef pthread_cond_t chpl_thread_condvar_t;
+// On Linux a sync variable is a single 32-bit state word that blocked
+// tasks sleep on with futex(2).  Elsewhere, or if CHPL_TASKS_FIFO_NO_FUTEX
+// is defined when the runtime is built, it is a mutex and a pair of
+// condition variables.
+//
+#if defined(__linux__) && !defined(CHPL_TASKS_FIFO_NO_FUTEX)
+#define CHPL_TASKS_FIFO_FUTEX_SYNC
+
+typedef struct {
+  volatile uint32_t state;   // full/locked/waiting bits; see tasks-fifo.c
+} chpl_sync_aux_t;
 
+#else
 
 //
-// Sync variables
+// Condition variables
 //
+typedef pthread_cond_t chpl_thread_condvar_t;
+
 typedef struct {
   volatile chpl_bool  is_full;
   chpl_thread_mutex_t lock;
@@ -64,6 +77,8 @@ typedef struct {
   //  threadlayer_sync_aux_t tl_aux;
 } chpl_sync_aux_t;
 
+#endif
+
 
 //
 // The fifo tasking layer doesn't really support sublocales.
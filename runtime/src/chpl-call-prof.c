@@ -0,0 +1,103 @@
+/*
+ * Copyright 2004-2014 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Call site profiling; see chpl-call-prof.h.
+//
+#include "chplrt.h"
+
+#include "chpl-atomics.h"
+#include "chpl-call-prof.h"
+#include "chpl-comm.h"
+#include "chpl-mem.h"
+#include "chpltypes.h"
+#include "error.h"
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+atomic_uint_least64_t* chpl_call_prof_counts = NULL;
+
+
+void chpl_call_prof_init(void) {
+  int site;
+
+  if (chpl_numCallSites == 0)
+    return;
+
+  chpl_call_prof_counts =
+    chpl_mem_allocMany(chpl_numCallSites, sizeof(atomic_uint_least64_t),
+                       CHPL_RT_MD_CALL_PROFILE_DATA, 0, 0);
+  for (site = 0; site < chpl_numCallSites; site++)
+    atomic_init_uint_least64_t(&chpl_call_prof_counts[site], 0);
+}
+
+
+static int call_prof_dump(const char* filename) {
+  FILE* f;
+  int site;
+
+  if ((f = fopen(filename, "w")) == NULL)
+    return errno;
+
+  fprintf(f, "# call site profile, locale %" PRId32 " of %" PRId32 "\n",
+          chpl_nodeID, chpl_numNodes);
+  fprintf(f, "sites %d\n", chpl_numCallSites);
+
+  for (site = 0; site < chpl_numCallSites; site++) {
+    uint_least64_t count =
+      atomic_load_uint_least64_t(&chpl_call_prof_counts[site]);
+    if (count != 0)
+      fprintf(f, "%d\t%" PRIu64 "\t%s\n", site, (uint64_t) count,
+              chpl_callSiteNames[site]);
+  }
+
+  if (fclose(f) != 0)
+    return errno;
+  return 0;
+}
+
+
+void chpl_call_prof_exit(void) {
+  const char* prefix;
+  char* filename;
+  size_t len;
+  int err;
+
+  if (chpl_call_prof_counts == NULL)
+    return;
+
+  if ((prefix = getenv("CHPL_RT_CALL_PROFILE_FILE")) == NULL)
+    prefix = "chpl-call-profile";
+
+  len = strlen(prefix) + 16;
+  filename = (char*) chpl_mem_alloc(len, CHPL_RT_MD_CALL_PROFILE_DATA, 0, 0);
+  snprintf(filename, len, "%s.%" PRId32, prefix, chpl_nodeID);
+  if ((err = call_prof_dump(filename)) != 0) {
+    char msg[256];
+    snprintf(msg, sizeof(msg), "cannot write call site profile to %s: %s",
+             filename, strerror(err));
+    chpl_warning(msg, 0, NULL);
+  }
+  chpl_mem_free(filename, 0, 0);
+}
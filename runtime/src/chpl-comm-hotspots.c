@@ -0,0 +1,402 @@
+/*
+ * Copyright 2004-2014 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Communication hotspots; see chpl-comm-hotspots.h.
+//
+#include "chplrt.h"
+
+#include "chpl-atomics.h"
+#include "chpl-comm.h"
+#include "chpl-comm-hotspots.h"
+#include "chpl-mem.h"
+#include "chpl-thread-local-storage.h"
+#include "chpltypes.h"
+#include "error.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+volatile chpl_bool chpl_comm_hotspots_on = false;
+
+static int64_t samplePeriod = 1;
+
+static chpl_bool reportAtExit = false;
+
+static const char* kindNames[chpl_comm_hot_numKinds] = { "get", "put" };
+
+
+typedef struct {
+  c_string fn;          // NULL if the slot is empty
+  int32_t  ln;
+  int32_t  node;
+  int32_t  kind;
+  uint64_t count;
+  uint64_t bytes;
+  uint64_t hist[CHPL_COMM_HOT_NBUCKETS];
+} hot_entry_t;
+
+
+//
+// Per-thread hash tables of hotspots, linked together so they can be
+// merged.  Only the owning thread adds to its table, but it holds the
+// table's lock while doing so, and readers take the same lock, so they
+// never see a half-filled slot or a table that is being grown or
+// cleared.  The lock is only contended while a snapshot or reset is
+// walking the tables.
+//
+typedef struct thread_hot_s {
+  atomic_flag          lock;
+  hot_entry_t*         table;
+  uint32_t             capacity;   // a power of 2
+  uint32_t             used;
+  int64_t              countdown;  // operations until the next sample
+  struct thread_hot_s* next;
+} thread_hot_t;
+
+#define INITIAL_CAPACITY 256
+
+static thread_hot_t* volatile threadHots = NULL;
+static atomic_flag threadHotsLock;
+
+CHPL_TLS_DECL(thread_hot_t*, thread_hot);
+
+
+//
+// The most recent snapshot, merged across threads.
+//
+static hot_entry_t* snapshot = NULL;
+static int32_t snapshotLen = 0;
+
+
+static void spinLock(atomic_flag* lock) {
+  while (atomic_flag_test_and_set(lock))
+    ;
+}
+
+static void spinUnlock(atomic_flag* lock) {
+  atomic_flag_clear(lock);
+}
+
+
+static uint32_t hash_key(c_string fn, int32_t ln, int32_t node, int32_t kind) {
+  uint64_t h = (uint64_t) (intptr_t) fn;
+  h = h * 31 + (uint32_t) ln;
+  h = h * 31 + (uint32_t) node;
+  h = h * 31 + (uint32_t) kind;
+  h ^= h >> 29;
+  h *= 0xbf58476d1ce4e5b9ULL;
+  h ^= h >> 32;
+  return (uint32_t) h;
+}
+
+
+static hot_entry_t* find_slot(hot_entry_t* table, uint32_t capacity,
+                              c_string fn, int32_t ln, int32_t node,
+                              int32_t kind) {
+  uint32_t i = hash_key(fn, ln, node, kind) & (capacity - 1);
+
+  while (table[i].fn != NULL
+         && !(table[i].fn == fn && table[i].ln == ln
+              && table[i].node == node && table[i].kind == kind))
+    i = (i + 1) & (capacity - 1);
+  return &table[i];
+}
+
+
+static void grow_table(thread_hot_t* th) {
+  uint32_t newCapacity = th->capacity * 2;
+  hot_entry_t* newTable;
+  uint32_t i;
+
+  newTable = (hot_entry_t*) chpl_mem_allocManyZero(newCapacity,
+                                                   sizeof(hot_entry_t),
+                                                   CHPL_RT_MD_COMM_HOTSPOTS,
+                                                   0, 0);
+  for (i = 0; i < th->capacity; i++) {
+    hot_entry_t* e = &th->table[i];
+    if (e->fn != NULL)
+      *find_slot(newTable, newCapacity, e->fn, e->ln, e->node, e->kind) = *e;
+  }
+
+  chpl_mem_free(th->table, 0, 0);
+  th->table = newTable;
+  th->capacity = newCapacity;
+}
+
+
+static thread_hot_t* get_thread_hot(void) {
+  thread_hot_t* th = (thread_hot_t*) CHPL_TLS_GET(thread_hot);
+
+  if (th == NULL) {
+    th = (thread_hot_t*) chpl_mem_alloc(sizeof(thread_hot_t),
+                                        CHPL_RT_MD_COMM_HOTSPOTS, 0, 0);
+    th->table = (hot_entry_t*) chpl_mem_allocManyZero(INITIAL_CAPACITY,
+                                                      sizeof(hot_entry_t),
+                                                      CHPL_RT_MD_COMM_HOTSPOTS,
+                                                      0, 0);
+    th->capacity = INITIAL_CAPACITY;
+    th->used = 0;
+    th->countdown = 1;
+    atomic_flag_clear(&th->lock);
+
+    spinLock(&threadHotsLock);
+    th->next = threadHots;
+    threadHots = th;
+    spinUnlock(&threadHotsLock);
+
+    CHPL_TLS_SET(thread_hot, th);
+  }
+  return th;
+}
+
+
+static int size_bucket(uint64_t bytes) {
+  int b = 0;
+
+  while (bytes > 1 && b < CHPL_COMM_HOT_NBUCKETS - 1) {
+    bytes >>= 1;
+    b++;
+  }
+  return b;
+}
+
+
+void chpl_comm_hotspots_record(chpl_comm_hot_kind_t kind, int32_t node,
+                               uint64_t bytes, int ln, c_string fn) {
+  thread_hot_t* th = get_thread_hot();
+  hot_entry_t* e;
+  uint64_t weight;
+
+  if (--th->countdown > 0)
+    return;
+  weight = (samplePeriod > 1) ? (uint64_t) samplePeriod : 1;
+  th->countdown = (int64_t) weight;
+
+  if (fn == NULL)
+    fn = "<unknown>";
+
+  spinLock(&th->lock);
+  e = find_slot(th->table, th->capacity, fn, ln, node, kind);
+  if (e->fn == NULL) {
+    if (2 * (th->used + 1) > th->capacity) {
+      grow_table(th);
+      e = find_slot(th->table, th->capacity, fn, ln, node, kind);
+    }
+    e->ln = ln;
+    e->node = node;
+    e->kind = kind;
+    e->fn = fn;
+    th->used++;
+  }
+  e->count += weight;
+  e->bytes += weight * bytes;
+  e->hist[size_bucket(bytes)] += weight;
+  spinUnlock(&th->lock);
+}
+
+
+void chpl_comm_startHotspotsHere(int64_t period) {
+  thread_hot_t* th;
+
+  samplePeriod = (period > 1) ? period : 1;
+
+  // Restart every thread's countdown under the new period.
+  spinLock(&threadHotsLock);
+  for (th = threadHots; th != NULL; th = th->next)
+    th->countdown = 1;
+  spinUnlock(&threadHotsLock);
+
+  chpl_comm_hotspots_on = true;
+}
+
+
+void chpl_comm_stopHotspotsHere(void) {
+  chpl_comm_hotspots_on = false;
+}
+
+
+void chpl_comm_resetHotspotsHere(void) {
+  thread_hot_t* th;
+
+  spinLock(&threadHotsLock);
+  for (th = threadHots; th != NULL; th = th->next) {
+    spinLock(&th->lock);
+    memset(th->table, 0, th->capacity * sizeof(hot_entry_t));
+    th->used = 0;
+    spinUnlock(&th->lock);
+  }
+  spinUnlock(&threadHotsLock);
+}
+
+
+static int cmp_key(const void* p1, const void* p2) {
+  const hot_entry_t* e1 = (const hot_entry_t*) p1;
+  const hot_entry_t* e2 = (const hot_entry_t*) p2;
+  int c;
+
+  if (e1->kind != e2->kind)
+    return (e1->kind < e2->kind) ? -1 : 1;
+  if ((c = strcmp(e1->fn, e2->fn)) != 0)
+    return c;
+  if (e1->ln != e2->ln)
+    return (e1->ln < e2->ln) ? -1 : 1;
+  if (e1->node != e2->node)
+    return (e1->node < e2->node) ? -1 : 1;
+  return 0;
+}
+
+
+static int cmp_count(const void* p1, const void* p2) {
+  const hot_entry_t* e1 = (const hot_entry_t*) p1;
+  const hot_entry_t* e2 = (const hot_entry_t*) p2;
+
+  if (e1->count != e2->count)
+    return (e1->count > e2->count) ? -1 : 1;
+  if (e1->bytes != e2->bytes)
+    return (e1->bytes > e2->bytes) ? -1 : 1;
+  return cmp_key(p1, p2);
+}
+
+
+int32_t chpl_comm_snapshotHotspotsHere(void) {
+  thread_hot_t* th;
+  size_t n = 0;
+  int32_t i, j;
+
+  if (snapshot != NULL) {
+    chpl_mem_free(snapshot, 0, 0);
+    snapshot = NULL;
+  }
+  snapshotLen = 0;
+
+  //
+  // Copy every thread's entries, then sort them by key and merge
+  // neighbors.  The same file may appear under different pointers
+  // from different threads or translation units, so keys are compared
+  // by file name here.
+  //
+  // Tables can gain entries between sizing the buffer and copying
+  // them, so the copy stops at the size that was allocated.
+  //
+  spinLock(&threadHotsLock);
+  for (th = threadHots; th != NULL; th = th->next)
+    n += th->used;
+  if (n > 0) {
+    size_t max = n;
+    snapshot = (hot_entry_t*) chpl_mem_allocMany(max, sizeof(hot_entry_t),
+                                                 CHPL_RT_MD_COMM_HOTSPOTS,
+                                                 0, 0);
+    n = 0;
+    for (th = threadHots; th != NULL && n < max; th = th->next) {
+      uint32_t k;
+      spinLock(&th->lock);
+      for (k = 0; k < th->capacity && n < max; k++)
+        if (th->table[k].fn != NULL)
+          snapshot[n++] = th->table[k];
+      spinUnlock(&th->lock);
+    }
+  }
+  spinUnlock(&threadHotsLock);
+
+  if (n == 0)
+    return 0;
+
+  qsort(snapshot, n, sizeof(hot_entry_t), cmp_key);
+  for (i = 0, j = 1; j < (int32_t) n; j++) {
+    if (cmp_key(&snapshot[i], &snapshot[j]) == 0) {
+      int b;
+      snapshot[i].count += snapshot[j].count;
+      snapshot[i].bytes += snapshot[j].bytes;
+      for (b = 0; b < CHPL_COMM_HOT_NBUCKETS; b++)
+        snapshot[i].hist[b] += snapshot[j].hist[b];
+    }
+    else
+      snapshot[++i] = snapshot[j];
+  }
+  snapshotLen = i + 1;
+
+  qsort(snapshot, snapshotLen, sizeof(hot_entry_t), cmp_count);
+  return snapshotLen;
+}
+
+
+static hot_entry_t* snapshot_entry(int32_t i) {
+  static hot_entry_t empty = { "", 0, -1, 0, 0, 0, { 0 } };
+  return (i >= 0 && i < snapshotLen) ? &snapshot[i] : &empty;
+}
+
+int32_t chpl_comm_hotspotKind(int32_t i) { return snapshot_entry(i)->kind; }
+c_string chpl_comm_hotspotFile(int32_t i) { return snapshot_entry(i)->fn; }
+int32_t chpl_comm_hotspotLine(int32_t i) { return snapshot_entry(i)->ln; }
+int32_t chpl_comm_hotspotNode(int32_t i) { return snapshot_entry(i)->node; }
+uint64_t chpl_comm_hotspotCount(int32_t i) { return snapshot_entry(i)->count; }
+uint64_t chpl_comm_hotspotBytes(int32_t i) { return snapshot_entry(i)->bytes; }
+
+uint64_t chpl_comm_hotspotHist(int32_t i, int32_t bucket) {
+  if (bucket < 0 || bucket >= CHPL_COMM_HOT_NBUCKETS)
+    return 0;
+  return snapshot_entry(i)->hist[bucket];
+}
+
+
+void chpl_comm_hotspots_init(void) {
+  char* ev;
+
+  atomic_flag_clear(&threadHotsLock);
+  CHPL_TLS_INIT(thread_hot);
+
+  if ((ev = getenv("CHPL_RT_COMM_HOTSPOTS")) != NULL) {
+    int64_t period;
+    if (sscanf(ev, "%" SCNi64, &period) != 1)
+      period = 1;
+    reportAtExit = true;
+    chpl_comm_startHotspotsHere(period);
+  }
+}
+
+
+void chpl_comm_hotspots_exit(void) {
+  const int32_t maxLines = 10;
+  int32_t n, i;
+
+  chpl_comm_stopHotspotsHere();
+  if (!reportAtExit)
+    return;
+
+  n = chpl_comm_snapshotHotspotsHere();
+  if (n == 0)
+    return;
+
+  printf("comm hotspots on locale %" PRId32, chpl_nodeID);
+  if (samplePeriod > 1)
+    printf(" (sampled 1 in %" PRId64 ")", samplePeriod);
+  printf(":\n");
+  for (i = 0; i < n && i < maxLines; i++)
+    printf("  %s %s:%" PRId32 " locale %" PRId32 ": %" PRIu64 " ops, %"
+           PRIu64 " bytes\n",
+           kindNames[snapshot[i].kind], snapshot[i].fn, snapshot[i].ln,
+           snapshot[i].node, snapshot[i].count, snapshot[i].bytes);
+  if (n > maxLines)
+    printf("  ... and %" PRId32 " more\n", n - maxLines);
+  fflush(stdout);
+}
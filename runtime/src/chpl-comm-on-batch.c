@@ -0,0 +1,162 @@
+/*
+ * Copyright 2004-2014 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Batched "on" statements; see chpl-comm-on-batch.h.
+//
+#include "chplrt.h"
+
+#include "chpl-comm.h"
+#include "chpl-comm-on-batch.h"
+#include "chpl-mem.h"
+#include "chpl-tasks.h"
+#include "chplcgfns.h"
+#include "chpl-gen-includes.h"
+#include "chpltypes.h"
+
+#include <string.h>
+
+
+//
+// A buffer holds a header followed by the entries.  Each entry is an
+// entry header followed by the argument bundle, padded so that the
+// next entry header and bundle stay aligned.
+//
+#define ON_BATCH_ALIGN 16
+#define ON_BATCH_ROUND(n) (((n) + ON_BATCH_ALIGN - 1) & ~(ON_BATCH_ALIGN - 1))
+
+typedef struct {
+  int32_t count;
+} on_batch_hdr_t;
+
+typedef struct {
+  chpl_fn_int_t fid;
+  int32_t       arg_size;
+} on_batch_entry_t;
+
+#define ON_BATCH_HDR_SIZE   ON_BATCH_ROUND(sizeof(on_batch_hdr_t))
+#define ON_BATCH_ENTRY_SIZE ON_BATCH_ROUND(sizeof(on_batch_entry_t))
+
+typedef struct {
+  chpl_fn_int_t runner_fid;
+  c_nodeid_t    node;         // target of the buffered entries
+  c_sublocid_t  subloc;
+  int32_t       size;         // bytes used in buf, including the header
+  char*         buf;          // allocated on the first remote add
+} on_batch_t;
+
+
+void* chpl_comm_on_batch_create(chpl_fn_int_t runner_fid, int ln, c_string fn) {
+  on_batch_t* batch = chpl_mem_alloc(sizeof(on_batch_t),
+                                     CHPL_RT_MD_COMM_FORK_SEND_INFO,
+                                     ln, fn);
+  batch->runner_fid = runner_fid;
+  batch->node = -1;
+  batch->subloc = c_sublocid_any;
+  batch->size = ON_BATCH_HDR_SIZE;
+  batch->buf = NULL;
+  return batch;
+}
+
+
+static void on_batch_flush(on_batch_t* batch) {
+  if (batch->size == ON_BATCH_HDR_SIZE)
+    return;
+
+  chpl_comm_fork_fast(batch->node, batch->subloc, batch->runner_fid,
+                      batch->buf, batch->size);
+
+  ((on_batch_hdr_t*) batch->buf)->count = 0;
+  batch->size = ON_BATCH_HDR_SIZE;
+}
+
+
+void chpl_comm_on_batch_add(void* batch_arg, chpl_localeID_t* loc,
+                            chpl_fn_int_t fid, void* arg, int32_t arg_size,
+                            int ln, c_string fn) {
+  on_batch_t*       batch = (on_batch_t*) batch_arg;
+  c_nodeid_t        node = chpl_rt_nodeFromLocaleID(*loc);
+  c_sublocid_t      subloc = chpl_rt_sublocFromLocaleID(*loc);
+  int32_t           entry_size = ON_BATCH_ENTRY_SIZE + ON_BATCH_ROUND(arg_size);
+  on_batch_entry_t* entry;
+
+  if (node == chpl_nodeID) {
+    c_sublocid_t orig_subloc = chpl_task_getRequestedSubloc();
+
+    if (subloc == c_sublocid_any || subloc == orig_subloc) {
+      chpl_ftable_call(fid, arg);
+    } else {
+      chpl_task_setSubloc(subloc);
+      chpl_ftable_call(fid, arg);
+      chpl_task_setSubloc(orig_subloc);
+    }
+    return;
+  }
+
+  if (node != batch->node || subloc != batch->subloc ||
+      batch->size + entry_size > CHPL_COMM_ON_BATCH_BYTES) {
+    on_batch_flush(batch);
+    batch->node = node;
+    batch->subloc = subloc;
+  }
+
+  if (ON_BATCH_HDR_SIZE + entry_size > CHPL_COMM_ON_BATCH_BYTES) {
+    // Too big to batch; send it on its own.
+    chpl_comm_fork_fast(node, subloc, fid, arg, arg_size);
+    return;
+  }
+
+  if (batch->buf == NULL) {
+    batch->buf = chpl_mem_alloc(CHPL_COMM_ON_BATCH_BYTES,
+                                CHPL_RT_MD_COMM_FORK_SEND_INFO, ln, fn);
+    ((on_batch_hdr_t*) batch->buf)->count = 0;
+  }
+
+  entry = (on_batch_entry_t*) (batch->buf + batch->size);
+  entry->fid = fid;
+  entry->arg_size = arg_size;
+  memcpy((char*) entry + ON_BATCH_ENTRY_SIZE, arg, arg_size);
+
+  ((on_batch_hdr_t*) batch->buf)->count++;
+  batch->size += entry_size;
+}
+
+
+void chpl_comm_on_batch_finish(void* batch_arg, int ln, c_string fn) {
+  on_batch_t* batch = (on_batch_t*) batch_arg;
+
+  on_batch_flush(batch);
+
+  if (batch->buf != NULL)
+    chpl_mem_free(batch->buf, ln, fn);
+  chpl_mem_free(batch, ln, fn);
+}
+
+
+void chpl_comm_on_batch_run(void* buf) {
+  int32_t count = ((on_batch_hdr_t*) buf)->count;
+  char*   p = (char*) buf + ON_BATCH_HDR_SIZE;
+  int32_t i;
+
+  for (i = 0; i < count; i++) {
+    on_batch_entry_t* entry = (on_batch_entry_t*) p;
+    chpl_ftable_call(entry->fid, p + ON_BATCH_ENTRY_SIZE);
+    p += ON_BATCH_ENTRY_SIZE + ON_BATCH_ROUND(entry->arg_size);
+  }
+}
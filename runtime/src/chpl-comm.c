@@ -77,37 +77,62 @@ void chpl_gen_stopCommDiagnosticsHere(void) {
 }
 
 
-size_t chpl_comm_getenvMaxHeapSize(void)
+size_t chpl_comm_getenvSize(const char* var, size_t dflt)
 {
   char*  p;
+  size_t size;
+  int    num_scanned;
+  char   units;
+
+  if ((p = getenv(var)) == NULL)
+    return dflt;
+
+  if ((num_scanned = sscanf(p, "%zi%c", &size, &units)) != 1) {
+    if (num_scanned == 2 && strchr("kKmMgG", units) != NULL) {
+      switch (units) {
+      case 'k' : case 'K': size <<= 10; break;
+      case 'm' : case 'M': size <<= 20; break;
+      case 'g' : case 'G': size <<= 30; break;
+      }
+    }
+    else {
+      char dfltStr[32];
+      char msg[200];
+
+      if (dflt != 0 && dflt % (((size_t) 1) << 30) == 0)
+        snprintf(dfltStr, sizeof(dfltStr), "%zug", dflt >> 30);
+      else if (dflt != 0 && dflt % (((size_t) 1) << 20) == 0)
+        snprintf(dfltStr, sizeof(dfltStr), "%zum", dflt >> 20);
+      else if (dflt != 0 && dflt % (((size_t) 1) << 10) == 0)
+        snprintf(dfltStr, sizeof(dfltStr), "%zuk", dflt >> 10);
+      else
+        snprintf(dfltStr, sizeof(dfltStr), "%zu", dflt);
+      snprintf(msg, sizeof(msg),
+               "Cannot parse %s environment variable; assuming %s",
+               var, dfltStr);
+      chpl_warning(msg, 0, NULL);
+      size = dflt;
+    }
+  }
+
+  return size;
+}
+
+
+size_t chpl_comm_getenvMaxHeapSize(void)
+{
   static int    env_checked = 0;
   static size_t size = 0;
 
   if (env_checked)
     return size;
 
-  if ((p = getenv("CHPL_RT_MAX_HEAP_SIZE")) != NULL) {
-    //
-    // The user specified a maximum size, so start with that.
-    //
-    int  num_scanned;
-    char units;
-
-    if ((num_scanned = sscanf(p, "%zi%c", &size, &units)) != 1) {
-      if (num_scanned == 2 && strchr("kKmMgG", units) != NULL) {
-        switch (units) {
-        case 'k' : case 'K': size <<= 10; break;
-        case 'm' : case 'M': size <<= 20; break;
-        case 'g' : case 'G': size <<= 30; break;
-        }
-      }
-      else {
-        chpl_warning("Cannot parse CHPL_RT_MAX_HEAP_SIZE environment "
-                     "variable; assuming 1g", 0, NULL);
-        size = ((size_t) 1) << 30;
-      }
-    }
-  }
+  //
+  // If the user specified a maximum size, start with that.  One that
+  // cannot be parsed is taken as 1g.
+  //
+  if (getenv("CHPL_RT_MAX_HEAP_SIZE") != NULL)
+    size = chpl_comm_getenvSize("CHPL_RT_MAX_HEAP_SIZE", ((size_t) 1) << 30);
 
   env_checked = 1;
 
@@ -30,6 +30,10 @@
 #include "chpl-mem.h"
 #include "chplmemtrack.h"
 #include "chpl-privatization.h"
+#include "chpl-comm-hotspots.h"
+#include "chpl-call-prof.h"
+#include "chpl-prof.h"
+#include "chpl-trace.h"
 #include "chpl-tasks.h"
 #include "chplsys.h"
 #include "config.h"
@@ -152,6 +156,7 @@ void chpl_rt_init(int argc, char* argv[]) {
   chpl_comm_init(&argc, &argv);
   chpl_mem_init();
   chpl_comm_post_mem_init();
+  chpl_trace_init();
 
   chpl_comm_barrier("about to leave comm init code");
 
@@ -184,6 +189,9 @@ void chpl_rt_init(int argc, char* argv[]) {
   // Initialize the task management layer.
   //
   chpl_task_init();
+  chpl_prof_init();
+  chpl_call_prof_init();
+  chpl_comm_hotspots_init();
 
   // Initialize privatization, needs to happen before hitting module init
   chpl_privatization_init();
@@ -22,21 +22,432 @@
 //
 #include "chplrt.h"
 
+#include "chpl-atomics.h"
+#include "chpl-comm.h"
 #include "chpl-mem.h"
+#include "chpl-thread-local-storage.h"
+#include "chplsys.h"
 #include "chpltypes.h"
 #include "error.h"
 
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
 
 static int heapInitialized = 0;
 
 
+//
+// Pooled allocation.  Requests are rounded up to a multiple of
+// POOL_GRAIN bytes; each size class up to POOL_MAX_SIZE has its own
+// free list per thread, holding at most POOL_MAX_CACHED blocks.
+// Larger requests, and everything when memory tracking is on, go
+// straight to the memory layer.  Each block starts with a header
+// recording its size class and the cache of the thread that allocated
+// it.
+//
+// A block goes back to the cache it came from.  Task argument bundles
+// are typically allocated by the spawning thread and freed by the one
+// that runs the task, so a thread freeing another thread's block
+// pushes it on that cache's remote list, a lock-free stack.  The
+// owner takes the whole remote list with one exchange when its own
+// free list runs dry.  Since only the owner ever pops, and it takes
+// every block at once, the stack has no ABA problem.
+//
+// Every cache is also pushed on a global list when it is created, so
+// that chpl_mem_exitPools() can release the caches and the blocks on
+// them once all the threads are gone.  After that, pooled requests go
+// straight to the memory layer.
+//
+#define POOL_GRAIN 32
+#define POOL_NUM_CLASSES 8
+#define POOL_MAX_SIZE (POOL_GRAIN * POOL_NUM_CLASSES)
+#define POOL_MAX_CACHED 64
+#define POOL_UNPOOLED ((size_t) -1)
+
+typedef struct pool_cache_s pool_cache_t;
+
+typedef union pool_hdr_u {
+  struct {
+    union pool_hdr_u* next;      // while on a free list
+    pool_cache_t*     owner;     // cache of the allocating thread
+    size_t            sizeClass;
+  } b;
+  long double align;             // keep the block maximally aligned
+} pool_hdr_t;
+
+struct pool_cache_s {
+  pool_hdr_t*      freeList[POOL_NUM_CLASSES];
+  int              numFree[POOL_NUM_CLASSES];
+  atomic_uintptr_t remoteFree[POOL_NUM_CLASSES];
+  pool_cache_t*    nextCache;    // on allPoolCaches
+};
+
+CHPL_TLS_DECL(pool_cache_t*, pool_cache);
+
+static atomic_uintptr_t allPoolCaches;
+static chpl_bool poolsReleased = false;
+
+static pool_cache_t* get_pool_cache(void) {
+  pool_cache_t* cache = (pool_cache_t*) CHPL_TLS_GET(pool_cache);
+  if (cache == NULL) {
+    int i;
+    cache = (pool_cache_t*) chpl_mem_calloc(sizeof(pool_cache_t),
+                                            CHPL_RT_MD_POOLED_ALLOC_CACHE,
+                                            0, 0);
+    for (i = 0; i < POOL_NUM_CLASSES; i++)
+      atomic_init_uintptr_t(&cache->remoteFree[i], (uintptr_t) NULL);
+    do {
+      cache->nextCache =
+        (pool_cache_t*) atomic_load_uintptr_t(&allPoolCaches);
+    } while (!atomic_compare_exchange_strong_uintptr_t(&allPoolCaches,
+                                                       (uintptr_t) cache->nextCache,
+                                                       (uintptr_t) cache));
+    CHPL_TLS_SET(pool_cache, cache);
+  }
+  return cache;
+}
+
+
+static pool_hdr_t* pool_take_remote(pool_cache_t* cache, size_t sizeClass) {
+  pool_hdr_t* list;
+
+  if (atomic_load_uintptr_t(&cache->remoteFree[sizeClass]) == (uintptr_t) NULL)
+    return NULL;
+  list = (pool_hdr_t*) atomic_exchange_uintptr_t(&cache->remoteFree[sizeClass],
+                                                 (uintptr_t) NULL);
+  return list;
+}
+
+
+static void pool_push_remote(pool_cache_t* owner, size_t sizeClass,
+                             pool_hdr_t* hdr) {
+  uintptr_t head;
+
+  do {
+    head = atomic_load_uintptr_t(&owner->remoteFree[sizeClass]);
+    hdr->b.next = (pool_hdr_t*) head;
+  } while (!atomic_compare_exchange_strong_uintptr_t(&owner->remoteFree[sizeClass],
+                                                     head, (uintptr_t) hdr));
+}
+
+
+void* chpl_mem_allocPooled(size_t size, chpl_mem_descInt_t description,
+                           int32_t lineno, c_string filename) {
+  pool_hdr_t* hdr;
+
+  if (size == 0)
+    size = 1;
+
+  if (chpl_memTrack || size > POOL_MAX_SIZE || poolsReleased) {
+    hdr = (pool_hdr_t*) chpl_mem_alloc(sizeof(pool_hdr_t) + size,
+                                       description, lineno, filename);
+    hdr->b.sizeClass = POOL_UNPOOLED;
+  } else {
+    size_t sizeClass = (size - 1) / POOL_GRAIN;
+    pool_cache_t* cache = get_pool_cache();
+
+    if (cache->freeList[sizeClass] == NULL) {
+      //
+      // Take back the blocks other threads have freed.  These are not
+      // counted in numFree; there are never more of them than blocks
+      // this thread has handed out.
+      //
+      cache->freeList[sizeClass] = pool_take_remote(cache, sizeClass);
+    }
+
+    if ((hdr = cache->freeList[sizeClass]) != NULL) {
+      cache->freeList[sizeClass] = hdr->b.next;
+      if (cache->numFree[sizeClass] > 0)
+        cache->numFree[sizeClass]--;
+    } else {
+      hdr = (pool_hdr_t*) chpl_mem_alloc(sizeof(pool_hdr_t) +
+                                         (sizeClass + 1) * POOL_GRAIN,
+                                         description, lineno, filename);
+    }
+    hdr->b.owner = cache;
+    hdr->b.sizeClass = sizeClass;
+  }
+
+  return hdr + 1;
+}
+
+
+void chpl_mem_freePooled(void* memAlloc, int32_t lineno, c_string filename) {
+  pool_hdr_t* hdr;
+  size_t sizeClass;
+  pool_cache_t* cache;
+
+  if (memAlloc == NULL)
+    return;
+
+  hdr = (pool_hdr_t*) memAlloc - 1;
+  sizeClass = hdr->b.sizeClass;
+  if (sizeClass == POOL_UNPOOLED || chpl_memTrack || poolsReleased) {
+    chpl_mem_free(hdr, lineno, filename);
+    return;
+  }
+
+  cache = get_pool_cache();
+  if (hdr->b.owner != cache) {
+    pool_push_remote(hdr->b.owner, sizeClass, hdr);
+    return;
+  }
+  if (cache->numFree[sizeClass] >= POOL_MAX_CACHED) {
+    chpl_mem_free(hdr, lineno, filename);
+    return;
+  }
+  hdr->b.next = cache->freeList[sizeClass];
+  cache->freeList[sizeClass] = hdr;
+  cache->numFree[sizeClass]++;
+}
+
+
+static void pool_free_list(pool_hdr_t* hdr) {
+  while (hdr != NULL) {
+    pool_hdr_t* next = hdr->b.next;
+    chpl_mem_free(hdr, 0, 0);
+    hdr = next;
+  }
+}
+
+
+void chpl_mem_exitPools(void) {
+  pool_cache_t* cache;
+  int i;
+
+  poolsReleased = true;
+  cache = (pool_cache_t*) atomic_exchange_uintptr_t(&allPoolCaches,
+                                                    (uintptr_t) NULL);
+  while (cache != NULL) {
+    pool_cache_t* next = cache->nextCache;
+    for (i = 0; i < POOL_NUM_CLASSES; i++) {
+      pool_free_list(cache->freeList[i]);
+      pool_free_list(pool_take_remote(cache, i));
+    }
+    chpl_mem_free(cache, 0, 0);
+    cache = next;
+  }
+  CHPL_TLS_SET(pool_cache, NULL);
+}
+
+
+//
+// NUMA placement.  We call mbind() directly rather than through libnuma
+// so there is nothing extra to link against.  MPOL_PREFERRED lets the
+// kernel fall back to other domains when the preferred one is full.
+//
+#if defined(__linux__) && defined(SYS_mbind)
+#define CHPL_MPOL_PREFERRED 1
+#endif
+
+void chpl_mem_localizeToSubloc(void* start, size_t len, c_sublocid_t subloc) {
+#ifdef CHPL_MPOL_PREFERRED
+  uintptr_t pageSize = (uintptr_t) chpl_getSysPageSize();
+  uintptr_t lo = ((uintptr_t) start + pageSize - 1) & ~(pageSize - 1);
+  uintptr_t hi = ((uintptr_t) start + len) & ~(pageSize - 1);
+  unsigned long nodeMask;
+
+  if (subloc < 0 || subloc >= (c_sublocid_t) (8 * sizeof(nodeMask)) || hi <= lo)
+    return;
+
+  // Failure (e.g., no such NUMA node) just leaves the default policy.
+  nodeMask = 1UL << subloc;
+  (void) syscall(SYS_mbind, (void*) lo, (unsigned long) (hi - lo),
+                 CHPL_MPOL_PREFERRED, &nodeMask, 8 * sizeof(nodeMask) + 1, 0);
+#endif
+}
+
+
+//
+// Huge pages.
+//
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+#define CHPL_HAVE_THP
+#endif
+#if defined(__linux__) && defined(MAP_HUGETLB)
+#define CHPL_HAVE_HUGETLB
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+#endif
+
+typedef enum {
+  hugePagesNone,
+  hugePagesTransparent,
+  hugePagesHugetlb
+} hugePagePolicy_t;
+
+static hugePagePolicy_t hugePagePolicy = hugePagesNone;
+static size_t hugePageSize = ((size_t) 2) << 20;
+static int hugePageReport = 0;
+static size_t hugeHeapSize = 0;
+static atomic_uint_least64_t hugeRegionsAdvised;
+static atomic_uint_least64_t hugeBytesAdvised;
+
+size_t chpl_mem_hugePageThreshold = SIZE_MAX;
+
+
+static void hugePagesInit(void) {
+  char* p;
+
+  if ((p = getenv("CHPL_RT_HUGE_PAGES")) != NULL) {
+    if (strcmp(p, "transparent") == 0)
+      hugePagePolicy = hugePagesTransparent;
+    else if (strcmp(p, "hugetlb") == 0)
+      hugePagePolicy = hugePagesHugetlb;
+    else if (strcmp(p, "none") != 0)
+      chpl_warning("CHPL_RT_HUGE_PAGES must be none, transparent, or "
+                   "hugetlb; using none", 0, NULL);
+  }
+
+  hugePageSize =
+    chpl_comm_getenvSize("CHPL_RT_HUGE_PAGE_SIZE", hugePageSize);
+  if (hugePageSize != ((size_t) 2) << 20 && hugePageSize != ((size_t) 1) << 30) {
+    chpl_warning("CHPL_RT_HUGE_PAGE_SIZE must be 2m or 1g; using 2m", 0, NULL);
+    hugePageSize = ((size_t) 2) << 20;
+  }
+
+  if (hugePagePolicy != hugePagesNone) {
+    chpl_mem_hugePageThreshold =
+      chpl_comm_getenvSize("CHPL_RT_HUGE_PAGE_THRESHOLD", hugePageSize);
+    if (chpl_mem_hugePageThreshold == 0)
+      chpl_mem_hugePageThreshold = 1;
+  }
+
+  hugePageReport = (getenv("CHPL_RT_HUGE_PAGE_REPORT") != NULL);
+  atomic_init_uint_least64_t(&hugeRegionsAdvised, 0);
+  atomic_init_uint_least64_t(&hugeBytesAdvised, 0);
+}
+
+
+void chpl_mem_adviseHugePages(void* start, size_t len) {
+#ifdef CHPL_HAVE_THP
+  // Transparent huge pages only back aligned huge-page-sized extents,
+  // so advise just the ones the range covers completely.
+  uintptr_t thpSize = ((uintptr_t) 2) << 20;
+  uintptr_t lo = ((uintptr_t) start + thpSize - 1) & ~(thpSize - 1);
+  uintptr_t hi = ((uintptr_t) start + len) & ~(thpSize - 1);
+
+  if (hugePagePolicy == hugePagesNone || start == NULL || hi <= lo)
+    return;
+
+  // Failure (e.g., THP disabled in the kernel) leaves default pages.
+  if (madvise((void*) lo, hi - lo, MADV_HUGEPAGE) == 0) {
+    atomic_fetch_add_uint_least64_t(&hugeRegionsAdvised, 1);
+    atomic_fetch_add_uint_least64_t(&hugeBytesAdvised, hi - lo);
+  }
+#endif
+}
+
+
+void* chpl_mem_mapHugeHeap(size_t* size_p) {
+#ifdef CHPL_HAVE_HUGETLB
+  size_t size;
+  int log2PageSize;
+  void* heap;
+
+  if (hugePagePolicy != hugePagesHugetlb)
+    return NULL;
+
+  if ((size = chpl_comm_getenvMaxHeapSize()) == 0) {
+    chpl_warning("CHPL_RT_HUGE_PAGES=hugetlb needs CHPL_RT_MAX_HEAP_SIZE "
+                 "to size the heap; using transparent huge pages", 0, NULL);
+    return NULL;
+  }
+  size = (size + hugePageSize - 1) & ~(hugePageSize - 1);
+
+  for (log2PageSize = 0; ((size_t) 1 << log2PageSize) < hugePageSize;
+       log2PageSize++)
+    ;
+  heap = mmap(NULL, size, PROT_READ | PROT_WRITE,
+              MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB
+              | (log2PageSize << MAP_HUGE_SHIFT),
+              -1, 0);
+  if (heap == MAP_FAILED) {
+    chpl_warning("cannot map the heap from the hugetlbfs pool; "
+                 "using transparent huge pages", 0, NULL);
+    return NULL;
+  }
+
+  hugeHeapSize = size;
+  *size_p = size;
+  return heap;
+#else
+  return NULL;
+#endif
+}
+
+
+//
+// Sum the huge page fields of /proc/self/smaps_rollup, in kB.  Returns
+// -1 if it can't be read.
+//
+static int64_t readHugePageUsage(const char* field) {
+#ifdef __linux__
+  FILE* f;
+  char line[256];
+  size_t fieldLen = strlen(field);
+  int64_t total = -1;
+  int64_t kb;
+
+  if ((f = fopen("/proc/self/smaps_rollup", "r")) == NULL)
+    return -1;
+  while (fgets(line, sizeof(line), f) != NULL) {
+    if (strncmp(line, field, fieldLen) == 0
+        && sscanf(line + fieldLen, " %" SCNd64, &kb) == 1)
+      total = (total < 0 ? 0 : total) + kb;
+  }
+  fclose(f);
+  return total;
+#else
+  return -1;
+#endif
+}
+
+
+void chpl_mem_printHugePageUsage(void) {
+  static const char* policyNames[] = { "none", "transparent", "hugetlb" };
+  int64_t thpKb, hugetlbKb;
+
+  printf("%" PRId32 ": huge pages: policy %s, threshold %zu bytes\n",
+         chpl_nodeID, policyNames[hugePagePolicy],
+         hugePagePolicy == hugePagesNone ? (size_t) 0
+                                         : chpl_mem_hugePageThreshold);
+  printf("%" PRId32 ": huge pages: advised %" PRIu64 " regions, %" PRIu64
+         " bytes\n", chpl_nodeID,
+         (uint64_t) atomic_load_uint_least64_t(&hugeRegionsAdvised),
+         (uint64_t) atomic_load_uint_least64_t(&hugeBytesAdvised));
+  if (hugeHeapSize > 0)
+    printf("%" PRId32 ": huge pages: heap of %zu bytes in %zu-byte "
+           "hugetlb pages\n", chpl_nodeID, hugeHeapSize, hugePageSize);
+  if ((thpKb = readHugePageUsage("AnonHugePages:")) >= 0
+      && (hugetlbKb = readHugePageUsage("Private_Hugetlb:")) >= 0)
+    printf("%" PRId32 ": huge pages: in use %" PRId64 " kB transparent, %"
+           PRId64 " kB hugetlb\n", chpl_nodeID, thpKb, hugetlbKb);
+  fflush(stdout);
+}
+
+
 void chpl_mem_init(void) {
+  hugePagesInit();
   chpl_mem_layerInit();
+  CHPL_TLS_INIT(pool_cache);
+  atomic_init_uintptr_t(&allPoolCaches, (uintptr_t) NULL);
   heapInitialized = 1;
 }
 
 
 void chpl_mem_exit(void) {
+  if (hugePageReport)
+    chpl_mem_printHugePageUsage();
   chpl_mem_layerExit();
 }
 
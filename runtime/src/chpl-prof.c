@@ -0,0 +1,496 @@
+/*
+ * Copyright 2004-2014 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Task profiling; see chpl-prof.h.
+//
+#include "chplrt.h"
+
+#include "chpl-atomics.h"
+#include "chpl-comm.h"
+#include "chpl-mem.h"
+#include "chpl-prof.h"
+#include "chpl-tasks.h"
+#include "chpl-thread-local-storage.h"
+#include "chpltypes.h"
+#include "error.h"
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#endif
+
+#if defined(__linux__) && defined(SYS_perf_event_open)
+#define CHPL_PROF_HAVE_PERF
+#endif
+
+
+volatile chpl_bool chpl_prof_on = false;
+
+static chpl_bool hwCounters = false;
+
+static const char* counterNames[chpl_prof_numCounters] = {
+  "tasks_spawned",
+  "tasks_run",
+  "run_ns",
+  "queue_wait_ns",
+  "sync_waits",
+  "sync_wait_ns",
+  "cycles",
+  "cache_misses"
+};
+
+
+//
+// Region names.  Region 0 is everything outside a named region.
+// Regions are never removed, so readers need no lock.  A new region's
+// name is stored before numRegions is raised with a release store, so
+// a reader that loads numRegions with acquire sees every name below it.
+//
+static c_string regionNames[CHPL_PROF_MAX_REGIONS] = { "<none>" };
+static atomic_int_least32_t numRegions;
+static atomic_flag regionLock;
+
+static inline int32_t get_num_regions(void) {
+  return atomic_load_explicit_int_least32_t(&numRegions,
+                                            memory_order_acquire);
+}
+
+
+//
+// Per-thread counters, linked together so they can be summed.  A
+// thread's active record describes the task it is running, if any.
+//
+typedef struct thread_prof_s {
+  uint64_t              counts[CHPL_PROF_MAX_REGIONS][chpl_prof_numCounters];
+  chpl_prof_taskState_t active;
+  int                   hwFd[2];
+  struct thread_prof_s* next;
+} thread_prof_t;
+
+static thread_prof_t* volatile threadProfs = NULL;
+static atomic_flag threadProfsLock;
+
+CHPL_TLS_DECL(thread_prof_t*, thread_prof);
+
+
+static void spinLock(atomic_flag* lock) {
+  while (atomic_flag_test_and_set(lock))
+    ;
+}
+
+static void spinUnlock(atomic_flag* lock) {
+  atomic_flag_clear(lock);
+}
+
+
+uint64_t chpl_prof_now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+
+static void openHwCounters(thread_prof_t* tp) {
+#ifdef CHPL_PROF_HAVE_PERF
+  static const uint64_t configs[2] = { PERF_COUNT_HW_CPU_CYCLES,
+                                       PERF_COUNT_HW_CACHE_MISSES };
+  static chpl_bool warned = false;
+  struct perf_event_attr attr;
+  int i;
+
+  for (i = 0; i < 2; i++) {
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = configs[i];
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    tp->hwFd[i] = (int) syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    if (tp->hwFd[i] < 0 && !warned) {
+      warned = true;
+      chpl_warning("CHPL_RT_PROFILE_HW: cannot open hardware counters; "
+                   "cycles and cache misses will be 0", 0, NULL);
+    }
+  }
+#endif
+}
+
+
+static void readHwCounters(thread_prof_t* tp, uint64_t* vals) {
+  int i;
+
+  for (i = 0; i < 2; i++) {
+    vals[i] = 0;
+    if (tp->hwFd[i] >= 0
+        && read(tp->hwFd[i], &vals[i], sizeof(vals[i])) != sizeof(vals[i]))
+      vals[i] = 0;
+  }
+}
+
+
+static thread_prof_t* get_thread_prof(void) {
+  thread_prof_t* tp = (thread_prof_t*) CHPL_TLS_GET(thread_prof);
+
+  if (tp == NULL) {
+    tp = (thread_prof_t*) chpl_mem_calloc(sizeof(thread_prof_t),
+                                          CHPL_RT_MD_TASK_PROFILE_DATA,
+                                          0, 0);
+    tp->hwFd[0] = tp->hwFd[1] = -1;
+    if (hwCounters)
+      openHwCounters(tp);
+
+    spinLock(&threadProfsLock);
+    tp->next = threadProfs;
+    threadProfs = tp;
+    spinUnlock(&threadProfsLock);
+
+    CHPL_TLS_SET(thread_prof, tp);
+  }
+  return tp;
+}
+
+
+//
+// Charge the time since the active record started to its region, and
+// restart it from now.
+//
+static void charge_active(thread_prof_t* tp, chpl_bool taskDone) {
+  chpl_prof_taskState_t* a = &tp->active;
+  uint64_t* counts;
+  uint64_t now;
+
+  if (!a->valid)
+    return;
+
+  now = chpl_prof_now();
+  counts = tp->counts[a->region];
+  counts[chpl_prof_runNs] += now - a->start;
+  if (taskDone)
+    counts[chpl_prof_tasksRun]++;
+  a->start = now;
+
+  if (hwCounters) {
+    uint64_t hw[2];
+    readHwCounters(tp, hw);
+    counts[chpl_prof_cycles] += hw[0] - a->hwStart[0];
+    counts[chpl_prof_cacheMisses] += hw[1] - a->hwStart[1];
+    a->hwStart[0] = hw[0];
+    a->hwStart[1] = hw[1];
+  }
+}
+
+
+static void start_active(thread_prof_t* tp, int32_t region) {
+  tp->active.valid = true;
+  tp->active.region = region;
+  tp->active.start = chpl_prof_now();
+  if (hwCounters)
+    readHwCounters(tp, tp->active.hwStart);
+}
+
+
+//
+// Regions come from task-private data, which the tasking layer copies
+// from parent to child; charge anything out of range to region 0.
+//
+static int32_t valid_region(int32_t region) {
+  return (region >= 0 && region < get_num_regions()) ? region : 0;
+}
+
+
+static int32_t current_region(void) {
+  return valid_region(chpl_task_getPrvData()->prof_region);
+}
+
+
+void chpl_prof_countSpawn(int32_t region) {
+  get_thread_prof()->counts[valid_region(region)][chpl_prof_tasksSpawned]++;
+}
+
+
+void chpl_prof_taskBegin(int32_t region, uint64_t queuedAt,
+                         chpl_prof_taskState_t* saved) {
+  thread_prof_t* tp;
+
+  saved->valid = false;
+  if (!chpl_prof_on)
+    return;
+
+  region = valid_region(region);
+  tp = get_thread_prof();
+  charge_active(tp, false);
+  *saved = tp->active;
+  saved->valid = true;   // even if the thread was idle; see taskEnd
+  saved->region = tp->active.valid ? tp->active.region : -1;
+
+  if (queuedAt != 0) {
+    uint64_t now = chpl_prof_now();
+    if (now > queuedAt)
+      tp->counts[region][chpl_prof_queueWaitNs] += now - queuedAt;
+  }
+  start_active(tp, region);
+}
+
+
+void chpl_prof_taskEnd(chpl_prof_taskState_t* saved) {
+  thread_prof_t* tp;
+
+  if (!saved->valid && !chpl_prof_on)
+    return;
+  if ((tp = (thread_prof_t*) CHPL_TLS_GET(thread_prof)) == NULL)
+    return;
+
+  if (chpl_prof_on)
+    charge_active(tp, true);
+
+  // Go back to timing whatever task this one ran inside of, or to
+  // idle if it wasn't run inside another task (or profiling was off
+  // when it began).
+  if (saved->valid && saved->region >= 0 && chpl_prof_on) {
+    tp->active = *saved;
+    start_active(tp, saved->region);
+  }
+  else
+    tp->active.valid = false;
+}
+
+
+void chpl_prof_syncWaited(uint64_t since) {
+  thread_prof_t* tp;
+  uint64_t now;
+
+  if (!chpl_prof_on || since == 0)
+    return;
+
+  tp = get_thread_prof();
+  now = chpl_prof_now();
+  if (tp->active.valid) {
+    tp->counts[tp->active.region][chpl_prof_syncWaits]++;
+    tp->counts[tp->active.region][chpl_prof_syncWaitNs] += now - since;
+  }
+}
+
+
+int32_t chpl_prof_beginRegion(c_string name) {
+  int32_t prev = current_region();
+  int32_t n = get_num_regions();
+  int32_t region;
+
+  for (region = 0; region < n; region++)
+    if (strcmp(regionNames[region], name) == 0)
+      break;
+
+  if (region == n) {
+    spinLock(&regionLock);
+    n = get_num_regions();
+    for (region = 0; region < n; region++)
+      if (strcmp(regionNames[region], name) == 0)
+        break;
+    if (region == n) {
+      if (n < CHPL_PROF_MAX_REGIONS) {
+        size_t len = strlen(name) + 1;
+        char* copy = (char*) chpl_mem_alloc(len, CHPL_RT_MD_TASK_PROFILE_DATA,
+                                            0, 0);
+        memcpy(copy, name, len);
+        regionNames[region] = copy;
+        atomic_store_explicit_int_least32_t(&numRegions, n + 1,
+                                            memory_order_release);
+      }
+      else {
+        static chpl_bool warned = false;
+        if (!warned) {
+          warned = true;
+          chpl_warning("too many profiling regions; "
+                       "counting the rest in region <none>", 0, NULL);
+        }
+        region = 0;
+      }
+    }
+    spinUnlock(&regionLock);
+  }
+
+  chpl_prof_endRegion(region);
+  return prev;
+}
+
+
+void chpl_prof_endRegion(int32_t prevRegion) {
+  if (prevRegion < 0 || prevRegion >= get_num_regions())
+    prevRegion = 0;
+
+  if (chpl_prof_on) {
+    thread_prof_t* tp = get_thread_prof();
+    charge_active(tp, false);
+    if (tp->active.valid)
+      tp->active.region = prevRegion;
+    else
+      start_active(tp, prevRegion);
+  }
+
+  chpl_task_getPrvData()->prof_region = prevRegion;
+}
+
+
+void chpl_prof_start(void) {
+  thread_prof_t* tp;
+
+  chpl_prof_on = true;
+
+  // Time the calling task from now on.
+  tp = get_thread_prof();
+  if (!tp->active.valid)
+    start_active(tp, current_region());
+}
+
+
+void chpl_prof_stop(void) {
+  thread_prof_t* tp;
+
+  if (!chpl_prof_on)
+    return;
+
+  if ((tp = (thread_prof_t*) CHPL_TLS_GET(thread_prof)) != NULL) {
+    charge_active(tp, false);
+    tp->active.valid = false;
+  }
+  chpl_prof_on = false;
+}
+
+
+void chpl_prof_reset(void) {
+  thread_prof_t* tp;
+
+  spinLock(&threadProfsLock);
+  for (tp = threadProfs; tp != NULL; tp = tp->next)
+    memset(tp->counts, 0, sizeof(tp->counts));
+  spinUnlock(&threadProfsLock);
+
+  // Restart the calling task's clock so time before the reset is
+  // not counted.
+  if ((tp = (thread_prof_t*) CHPL_TLS_GET(thread_prof)) != NULL
+      && tp->active.valid)
+    start_active(tp, tp->active.region);
+}
+
+
+int32_t chpl_prof_getNumRegions(void) {
+  return get_num_regions();
+}
+
+
+c_string chpl_prof_getRegionName(int32_t region) {
+  if (region < 0 || region >= get_num_regions())
+    return "";
+  return regionNames[region];
+}
+
+
+uint64_t chpl_prof_getCounter(int32_t region, int32_t counter) {
+  thread_prof_t* tp;
+  uint64_t sum = 0;
+
+  if (region < 0 || region >= get_num_regions()
+      || counter < 0 || counter >= chpl_prof_numCounters)
+    return 0;
+
+  // Bring the calling task's time up to date first.
+  if (chpl_prof_on
+      && (tp = (thread_prof_t*) CHPL_TLS_GET(thread_prof)) != NULL)
+    charge_active(tp, false);
+
+  spinLock(&threadProfsLock);
+  for (tp = threadProfs; tp != NULL; tp = tp->next)
+    sum += tp->counts[region][counter];
+  spinUnlock(&threadProfsLock);
+
+  return sum;
+}
+
+
+int chpl_prof_dump(c_string filename) {
+  FILE* f;
+  int32_t region, n;
+  int counter;
+
+  if ((f = fopen(filename, "w")) == NULL)
+    return errno;
+
+  fprintf(f, "# locale %" PRId32 " of %" PRId32 "\n",
+          chpl_nodeID, chpl_numNodes);
+  fprintf(f, "region");
+  for (counter = 0; counter < chpl_prof_numCounters; counter++)
+    fprintf(f, "\t%s", counterNames[counter]);
+  fprintf(f, "\n");
+
+  n = get_num_regions();
+  for (region = 0; region < n; region++) {
+    fprintf(f, "%s", regionNames[region]);
+    for (counter = 0; counter < chpl_prof_numCounters; counter++)
+      fprintf(f, "\t%" PRIu64, chpl_prof_getCounter(region, counter));
+    fprintf(f, "\n");
+  }
+
+  if (fclose(f) != 0)
+    return errno;
+  return 0;
+}
+
+
+void chpl_prof_init(void) {
+  atomic_init_int_least32_t(&numRegions, 1);
+  atomic_flag_clear(&regionLock);
+  atomic_flag_clear(&threadProfsLock);
+  CHPL_TLS_INIT(thread_prof);
+  hwCounters = (getenv("CHPL_RT_PROFILE_HW") != NULL);
+  if (getenv("CHPL_RT_PROFILE") != NULL)
+    chpl_prof_start();
+}
+
+
+void chpl_prof_exit(void) {
+  char* prefix;
+
+  if ((prefix = getenv("CHPL_RT_PROFILE_FILE")) != NULL) {
+    char* filename;
+    int err;
+    size_t len = strlen(prefix) + 16;
+
+    filename = (char*) chpl_mem_alloc(len, CHPL_RT_MD_TASK_PROFILE_DATA,
+                                      0, 0);
+    snprintf(filename, len, "%s.%" PRId32, prefix, chpl_nodeID);
+    if ((err = chpl_prof_dump(filename)) != 0) {
+      char msg[256];
+      snprintf(msg, sizeof(msg), "cannot write task profile to %s: %s",
+               filename, strerror(err));
+      chpl_warning(msg, 0, NULL);
+    }
+    chpl_mem_free(filename, 0, 0);
+  }
+
+  chpl_prof_stop();
+}
@@ -0,0 +1,246 @@
+/*
+ * Copyright 2004-2014 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Event tracing; see chpl-trace.h.
+//
+#include "chplrt.h"
+
+#include "chpl-atomics.h"
+#include "chpl-comm.h"
+#include "chpl-mem.h"
+#include "chpl-thread-local-storage.h"
+#include "chpl-trace.h"
+#include "chpltypes.h"
+#include "error.h"
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+
+volatile chpl_bool chpl_trace_on = false;
+
+static char* tracePrefix = NULL;
+
+#define DEFAULT_RING_EVENTS ((size_t) 65536)
+
+static size_t ringEvents = DEFAULT_RING_EVENTS;   // a power of 2
+
+
+//
+// Per-thread rings, linked together so they can be written at exit.
+// Only the owning thread writes to a ring; numRecorded counts every
+// event ever recorded, so the ring holds the last min(numRecorded,
+// ringEvents) of them.
+//
+typedef struct thread_trace_s {
+  chpl_trace_event_t*    ring;
+  uint64_t               numRecorded;
+  uint32_t               thread;
+  struct thread_trace_s* next;
+} thread_trace_t;
+
+static thread_trace_t* volatile threadTraces = NULL;
+static uint32_t numThreadTraces = 0;
+static atomic_flag threadTracesLock;
+
+CHPL_TLS_DECL(thread_trace_t*, thread_trace);
+
+
+static void spinLock(atomic_flag* lock) {
+  while (atomic_flag_test_and_set(lock))
+    ;
+}
+
+static void spinUnlock(atomic_flag* lock) {
+  atomic_flag_clear(lock);
+}
+
+
+static thread_trace_t* get_thread_trace(void) {
+  thread_trace_t* tt = (thread_trace_t*) CHPL_TLS_GET(thread_trace);
+
+  if (tt == NULL) {
+    tt = (thread_trace_t*) chpl_mem_alloc(sizeof(thread_trace_t),
+                                          CHPL_RT_MD_EVENT_TRACE_DATA, 0, 0);
+    tt->ring = (chpl_trace_event_t*)
+               chpl_mem_allocMany(ringEvents, sizeof(chpl_trace_event_t),
+                                  CHPL_RT_MD_EVENT_TRACE_DATA, 0, 0);
+    tt->numRecorded = 0;
+
+    spinLock(&threadTracesLock);
+    tt->thread = numThreadTraces++;
+    tt->next = threadTraces;
+    threadTraces = tt;
+    spinUnlock(&threadTracesLock);
+
+    CHPL_TLS_SET(thread_trace, tt);
+  }
+  return tt;
+}
+
+
+void chpl_trace_record(chpl_trace_eventType_t type, int32_t peer,
+                       uint64_t arg, uint16_t flags) {
+  thread_trace_t* tt = get_thread_trace();
+  chpl_trace_event_t* ev;
+  struct timespec ts;
+
+  // Wall-clock time, so that events from different locales line up
+  // as well as the nodes' clocks do.
+  clock_gettime(CLOCK_REALTIME, &ts);
+
+  ev = &tt->ring[tt->numRecorded & (ringEvents - 1)];
+  ev->time = (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+  ev->arg = arg;
+  ev->peer = peer;
+  ev->type = (uint16_t) type;
+  ev->flags = flags;
+  tt->numRecorded++;
+}
+
+
+static int write_trace(const char* filename) {
+  FILE* f;
+  chpl_trace_fileHdr_t fh;
+  thread_trace_t* tt;
+  int err = 0;
+
+  if ((f = fopen(filename, "wb")) == NULL)
+    return errno;
+
+  memset(&fh, 0, sizeof(fh));
+  strncpy(fh.magic, CHPL_TRACE_MAGIC, sizeof(fh.magic));
+  fh.version = CHPL_TRACE_VERSION;
+  fh.node = chpl_nodeID;
+  fh.numNodes = chpl_numNodes;
+  spinLock(&threadTracesLock);
+  fh.numThreads = numThreadTraces;
+  tt = threadTraces;
+  spinUnlock(&threadTracesLock);
+
+  if (fwrite(&fh, sizeof(fh), 1, f) != 1)
+    err = errno;
+
+  for ( ; tt != NULL && err == 0; tt = tt->next) {
+    chpl_trace_threadHdr_t th;
+    uint64_t n = tt->numRecorded;
+    uint64_t first;
+
+    if (n > ringEvents)
+      n = ringEvents;
+    first = (tt->numRecorded - n) & (ringEvents - 1);
+
+    th.thread = tt->thread;
+    th.numEvents = (uint32_t) n;
+    th.numDropped = tt->numRecorded - n;
+    if (fwrite(&th, sizeof(th), 1, f) != 1) {
+      err = errno;
+      break;
+    }
+
+    // Oldest first: from 'first' to the end of the ring, then from
+    // the start of the ring for whatever wrapped around.
+    if (first + n > ringEvents) {
+      size_t tail = ringEvents - first;
+      if (fwrite(&tt->ring[first], sizeof(chpl_trace_event_t), tail, f)
+          != tail
+          || fwrite(&tt->ring[0], sizeof(chpl_trace_event_t), n - tail, f)
+             != n - tail)
+        err = errno;
+    }
+    else if (fwrite(&tt->ring[first], sizeof(chpl_trace_event_t), n, f)
+             != n)
+      err = errno;
+  }
+
+  if (fclose(f) != 0 && err == 0)
+    err = errno;
+  return err;
+}
+
+
+void chpl_trace_init(void) {
+  char* ev;
+
+  atomic_flag_clear(&threadTracesLock);
+  CHPL_TLS_INIT(thread_trace);
+
+  if ((ev = getenv("CHPL_RT_TRACE_EVENTS")) != NULL) {
+    size_t n;
+    char units;
+
+    if (sscanf(ev, "%zi%c", &n, &units) == 2) {
+      if (units == 'k' || units == 'K')
+        n <<= 10;
+      else if (units == 'm' || units == 'M')
+        n <<= 20;
+      else
+        n = 0;
+    }
+    else if (sscanf(ev, "%zi", &n) != 1)
+      n = 0;
+
+    if (n == 0)
+      chpl_warning("CHPL_RT_TRACE_EVENTS: cannot parse value; "
+                   "using the default", 0, NULL);
+    else {
+      // Round up to a power of 2, so that ring indices can be masked.
+      for (ringEvents = 1; ringEvents < n; ringEvents <<= 1)
+        ;
+    }
+  }
+
+  if ((ev = getenv("CHPL_RT_TRACE")) != NULL && ev[0] != '\0') {
+    size_t len = strlen(ev) + 1;
+    tracePrefix = (char*) chpl_mem_alloc(len, CHPL_RT_MD_EVENT_TRACE_DATA,
+                                         0, 0);
+    memcpy(tracePrefix, ev, len);
+    chpl_trace_on = true;
+  }
+}
+
+
+void chpl_trace_exit(void) {
+  char* filename;
+  size_t len;
+  int err;
+
+  if (!chpl_trace_on)
+    return;
+
+  // Stop recording first.  Threads still running may be partway
+  // through an event; at worst the last one on such a thread is torn.
+  chpl_trace_on = false;
+
+  len = strlen(tracePrefix) + 16;
+  filename = (char*) chpl_mem_alloc(len, CHPL_RT_MD_EVENT_TRACE_DATA, 0, 0);
+  snprintf(filename, len, "%s.%" PRId32, tracePrefix, chpl_nodeID);
+  if ((err = write_trace(filename)) != 0) {
+    char msg[256];
+    snprintf(msg, sizeof(msg), "cannot write event trace to %s: %s",
+             filename, strerror(err));
+    chpl_warning(msg, 0, NULL);
+  }
+  chpl_mem_free(filename, 0, 0);
+}
@@ -24,6 +24,10 @@
 #include "chplexit.h"
 #include "chpl-mem.h"
 #include "chplmemtrack.h"
+#include "chpl-comm-hotspots.h"
+#include "chpl-call-prof.h"
+#include "chpl-prof.h"
+#include "chpl-trace.h"
 #include "gdb.h"
 
 #include <stdio.h>
@@ -38,8 +42,13 @@ static void chpl_exit_common(int status, int all) {
     gdbShouldBreakHere();
   }
   chpl_comm_pre_task_exit(all);
+  chpl_prof_exit();
+  chpl_call_prof_exit();
+  chpl_trace_exit();
+  chpl_comm_hotspots_exit();
   if (all) {
     chpl_task_exit();
+    chpl_mem_exitPools();
     chpl_reportMemInfo();
   }
   chpl_mem_exit();
@@ -98,6 +98,19 @@ uint64_t chpl_bytesPerLocale(void) {
 }
 
 
+size_t chpl_getSysPageSize(void) {
+  static size_t pageSize = 0;
+
+  if (pageSize == 0) {
+    long int ps = chplGetPageSize();
+    if (ps <= 0)
+      chpl_internal_error("query of page size failed");
+    pageSize = (size_t) ps;
+  }
+  return pageSize;
+}
+
+
 size_t chpl_bytesAvailOnThisLocale(void) {
 #if defined __APPLE__
   int membytes;
@@ -27,6 +27,7 @@
 #include "chpl-mem.h"
 #include "chplsys.h"
 #include "chpl-tasks.h"
+#include "chpl-trace.h"
 #include "chplcgfns.h"
 #include "chpl-gen-includes.h"
 #include "chpl-atomics.h"
@@ -365,6 +366,7 @@ chpl_comm_nb_handle_t chpl_comm_put_nb(void *addr, c_nodeid_t node, void* raddr,
   size_t nbytes = elemSize*len;
   gasnet_handle_t ret;
 
+  chpl_trace_event(chpl_trace_put, node, nbytes, CHPL_TRACE_FLAG_NB);
   ret = gasnet_put_nb_bulk(node, raddr, addr, nbytes);
 
   if (chpl_comm_diagnostics && !chpl_comm_no_debug_private) {
@@ -384,6 +386,7 @@ chpl_comm_nb_handle_t chpl_comm_get_nb(void* addr, c_nodeid_t node, void* raddr,
   size_t nbytes = elemSize*len;
   gasnet_handle_t ret;
 
+  chpl_trace_event(chpl_trace_get, node, nbytes, CHPL_TRACE_FLAG_NB);
   ret = gasnet_get_nb_bulk(addr, node, raddr, nbytes);
 
   if (chpl_comm_diagnostics && !chpl_comm_no_debug_private) {
@@ -710,11 +713,13 @@ void chpl_comm_barrier(const char *msg) {
   // satisfy; see chpl_comm.h.  This prevents us from monopolizing the
   // processor while waiting.
   //
+  chpl_trace_event(chpl_trace_barrierBegin, -1, 0, 0);
   gasnet_barrier_notify(id, 0);
   while ((retval = gasnet_barrier_try(id, 0)) == GASNET_ERR_NOT_READY) {
     chpl_task_yield();
   }
   GASNET_Safe_Retval(gasnet_barrier_try(id, 0), retval);
+  chpl_trace_event(chpl_trace_barrierEnd, -1, 0, 0);
 }
 
 void chpl_comm_pre_task_exit(int all) {
@@ -807,6 +812,7 @@ void  chpl_comm_put(void* addr, c_nodeid_t node, void* raddr,
       chpl_comm_commDiagnostics.put++;
       chpl_sync_unlock(&chpl_comm_diagnostics_sync);
     }
+    chpl_trace_event(chpl_trace_put, node, size, 0);
     gasnet_put(node, raddr, addr, size); // node, dest, src, size
   }
 }
@@ -828,10 +834,20 @@ void  chpl_comm_get(void* addr, c_nodeid_t node, void* raddr,
       chpl_comm_commDiagnostics.get++;
       chpl_sync_unlock(&chpl_comm_diagnostics_sync);
     }
+    chpl_trace_event(chpl_trace_get, node, size, 0);
     gasnet_get(addr, node, raddr, size); // dest, node, src, size
   }
 }
 
+// Total bytes moved by a strided get or put, given GASNet-style counts.
+static uint64_t strd_bytes(size_t* cnt, size_t strlvls) {
+  uint64_t bytes = cnt[0];
+  size_t i;
+  for (i = 1; i <= strlvls; i++)
+    bytes *= cnt[i];
+  return bytes;
+}
+
 //
 // This is an adaptor from Chapel code to GASNet's gasnet_gets_bulk. It does:
 // * convert count[0] and all of 'srcstr' and 'dststr' from counts of element
@@ -886,6 +902,9 @@ void  chpl_comm_get_strd(void* dstaddr, void* dststrides, c_nodeid_t srcnode_id,
     chpl_comm_commDiagnostics.get++;
     chpl_sync_unlock(&chpl_comm_diagnostics_sync);
   }
+  if (chpl_trace_on)
+    chpl_trace_record(chpl_trace_get, srcnode, strd_bytes(cnt, strlvls),
+                      CHPL_TRACE_FLAG_STRIDED);
   gasnet_gets_bulk(dstaddr, dststr, srcnode, srcaddr, srcstr, cnt, strlvls); 
 }
 
@@ -936,6 +955,9 @@ void  chpl_comm_put_strd(void* dstaddr, void* dststrides, c_nodeid_t dstnode_id,
     chpl_comm_commDiagnostics.put++;
     chpl_sync_unlock(&chpl_comm_diagnostics_sync);
   }
+  if (chpl_trace_on)
+    chpl_trace_record(chpl_trace_put, dstnode, strd_bytes(cnt, strlvls),
+                      CHPL_TRACE_FLAG_STRIDED);
   gasnet_puts_bulk(dstnode, dstaddr, dststr, srcaddr, srcstr, cnt, strlvls); 
 }
 
@@ -976,6 +998,7 @@ void  chpl_comm_fork(c_nodeid_t node, c_sublocid_t subloc,
 
     INIT_DONE_OBJ(done, 1);
 
+    chpl_trace_event(chpl_trace_forkBegin, node, arg_size, 0);
     if (passArg) {
       if (arg_size)
         chpl_memcpy(&(info->arg), arg, arg_size);
@@ -992,6 +1015,7 @@ void  chpl_comm_fork(c_nodeid_t node, c_sublocid_t subloc,
       chpl_task_yield();
     }
 #endif
+    chpl_trace_event(chpl_trace_forkEnd, node, 0, 0);
     chpl_mem_free(info, 0, 0);
   }
 }
@@ -1044,6 +1068,7 @@ void  chpl_comm_fork_nb(c_nodeid_t node, c_sublocid_t subloc,
       chpl_comm_commDiagnostics.fork_nb++;
       chpl_sync_unlock(&chpl_comm_diagnostics_sync);
     }
+    chpl_trace_event(chpl_trace_forkNb, node, arg_size, 0);
     if (passArg) {
       GASNET_Safe(gasnet_AMRequestMedium0(node, FORK_NB, info, info_size));
       chpl_mem_free(info, 0, 0);
@@ -1085,6 +1110,7 @@ void  chpl_comm_fork_fast(c_nodeid_t node, c_sublocid_t subloc,
 
       INIT_DONE_OBJ(done, 1);
 
+      chpl_trace_event(chpl_trace_forkFast, node, arg_size, 0);
       if (arg_size)
         chpl_memcpy(&(info->arg), arg, arg_size);
       GASNET_Safe(gasnet_AMRequestMedium0(node, FORK_FAST, info, info_size));
@@ -1097,6 +1123,7 @@ void  chpl_comm_fork_fast(c_nodeid_t node, c_sublocid_t subloc,
         chpl_task_yield();
       }
 #endif
+      chpl_trace_event(chpl_trace_forkEnd, node, 0, 0);
     } else {
       // Call the normal chpl_comm_fork()
       chpl_comm_fork(node, subloc, fid, arg, arg_size);
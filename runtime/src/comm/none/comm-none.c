@@ -24,6 +24,7 @@
 #include "error.h"
 #include "chpl-mem.h"
 #include "chpl-tasks.h"
+#include "chpl-trace.h"
 
 #include "chplcgfns.h"
 #include "chpl-gen-includes.h"
@@ -131,7 +132,10 @@ void chpl_comm_broadcast_global_vars(int numGlobals) { }
 
 void chpl_comm_broadcast_private(int id, int32_t sizee, int32_t tid) { }
 
-void chpl_comm_barrier(const char *msg) { }
+void chpl_comm_barrier(const char *msg) {
+  chpl_trace_event(chpl_trace_barrierBegin, -1, 0, 0);
+  chpl_trace_event(chpl_trace_barrierEnd, -1, 0, 0);
+}
 
 void chpl_comm_pre_task_exit(int all) { }
 
@@ -27,22 +27,195 @@
 #include "chpl-comm.h"
 #include "chpl-mem.h"
 #include "chplmemtrack.h"
+#include "chpl-thread-local-storage.h"
 #include "chpltypes.h"
 #include "error.h"
 #include "dlmalloc.h"
 
 mspace chpl_dlmalloc_heap;
 
+// These are in dlmalloc 2.8.5+ but missing from our copy of the header.
+size_t mspace_bulk_free(mspace msp, void* array[], size_t nelem);
+size_t mspace_usable_size(void* mem);
+
+
+//
+// Per-thread caches.  The heap lives in the comm layer's registered
+// segment and is shared by every thread behind a single lock, so
+// requests up to CACHE_MAX_SIZE bytes are rounded up to a multiple of
+// CACHE_GRAIN and served from a free list private to the calling
+// thread.  An empty list is refilled with CACHE_BATCH blocks from one
+// mspace_independent_comalloc() call, and a list that grows past
+// CACHE_MAX_CACHED blocks gives CACHE_BATCH of them back with one
+// mspace_bulk_free(), so the lock is taken once per batch rather than
+// once per request.  Every block still comes from chpl_dlmalloc_heap,
+// so all memory stays inside the segment.
+//
+// Blocks carry no header of their own: on free, the size class is the
+// largest one that fits in the block's usable size, which is never
+// smaller than the class it was allocated for.  So a block may be
+// freed by a different thread than allocated it, and blocks obtained
+// directly from the heap can go on a free list too.
+//
+#define CACHE_GRAIN 16
+#define CACHE_NUM_CLASSES 32
+#define CACHE_MAX_SIZE (CACHE_GRAIN * CACHE_NUM_CLASSES)
+#define CACHE_BATCH 16
+#define CACHE_MAX_CACHED (4 * CACHE_BATCH)
+
+typedef struct cache_blk_s {
+  struct cache_blk_s* next;
+} cache_blk_t;
+
+typedef struct {
+  cache_blk_t* freeList[CACHE_NUM_CLASSES];
+  int          numFree[CACHE_NUM_CLASSES];
+} thread_cache_t;
+
+static CHPL_TLS_DECL(thread_cache_t*, thread_cache);
+
+static thread_cache_t* get_thread_cache(void) {
+  thread_cache_t* tc = (thread_cache_t*) CHPL_TLS_GET(thread_cache);
+  if (tc == NULL) {
+    tc = (thread_cache_t*) mspace_calloc(chpl_dlmalloc_heap, 1,
+                                         sizeof(thread_cache_t));
+    if (tc == NULL)
+      return NULL;
+    CHPL_TLS_SET(thread_cache, tc);
+  }
+  return tc;
+}
+
+static void* cache_alloc(size_t size) {
+  int sc = (size == 0) ? 0 : (size - 1) / CACHE_GRAIN;
+  thread_cache_t* tc = get_thread_cache();
+  cache_blk_t* blk;
+
+  if (tc == NULL)
+    return mspace_malloc(chpl_dlmalloc_heap, size);
+
+  if (tc->freeList[sc] == NULL) {
+    size_t sizes[CACHE_BATCH];
+    void* blks[CACHE_BATCH];
+    int i;
+
+    for (i = 0; i < CACHE_BATCH; i++)
+      sizes[i] = (sc + 1) * CACHE_GRAIN;
+    if (mspace_independent_comalloc(chpl_dlmalloc_heap, CACHE_BATCH,
+                                    sizes, blks) == NULL)
+      return mspace_malloc(chpl_dlmalloc_heap, size);
+    for (i = 0; i < CACHE_BATCH; i++) {
+      ((cache_blk_t*) blks[i])->next = tc->freeList[sc];
+      tc->freeList[sc] = (cache_blk_t*) blks[i];
+    }
+    tc->numFree[sc] += CACHE_BATCH;
+  }
+
+  blk = tc->freeList[sc];
+  tc->freeList[sc] = blk->next;
+  tc->numFree[sc]--;
+  return blk;
+}
+
+static void cache_free(void* ptr, size_t usable) {
+  int sc = (usable >= CACHE_MAX_SIZE) ? CACHE_NUM_CLASSES - 1
+                                      : usable / CACHE_GRAIN - 1;
+  thread_cache_t* tc = get_thread_cache();
+  cache_blk_t* blk = (cache_blk_t*) ptr;
+
+  if (tc == NULL || sc < 0) {
+    mspace_free(chpl_dlmalloc_heap, ptr);
+    return;
+  }
+
+  blk->next = tc->freeList[sc];
+  tc->freeList[sc] = blk;
+  if (++tc->numFree[sc] > CACHE_MAX_CACHED) {
+    void* blks[CACHE_BATCH];
+    int i;
+
+    for (i = 0; i < CACHE_BATCH; i++) {
+      blks[i] = tc->freeList[sc];
+      tc->freeList[sc] = tc->freeList[sc]->next;
+    }
+    tc->numFree[sc] -= CACHE_BATCH;
+    (void) mspace_bulk_free(chpl_dlmalloc_heap, blks, CACHE_BATCH);
+  }
+}
+
+// Blocks whose usable size is at most this can go on a free list.
+#define CACHE_MAX_USABLE (CACHE_MAX_SIZE + CACHE_GRAIN)
+
+void* chpl_dlmalloc_malloc(size_t size) {
+  if (size <= CACHE_MAX_SIZE)
+    return cache_alloc(size);
+  return mspace_malloc(chpl_dlmalloc_heap, size);
+}
+
+void* chpl_dlmalloc_calloc(size_t n, size_t size) {
+  void* ptr;
+
+  if (n == 0 || size == 0 || size > CACHE_MAX_SIZE || n > CACHE_MAX_SIZE / size)
+    return mspace_calloc(chpl_dlmalloc_heap, n, size);
+  if ((ptr = cache_alloc(n * size)) != NULL)
+    memset(ptr, 0, n * size);
+  return ptr;
+}
+
+void* chpl_dlmalloc_realloc(void* ptr, size_t size) {
+  size_t usable;
+  void* newPtr;
+
+  if (ptr == NULL)
+    return chpl_dlmalloc_malloc(size);
+  if (size == 0) {
+    chpl_dlmalloc_free(ptr);
+    return NULL;
+  }
+
+  usable = mspace_usable_size(ptr);
+  if (size <= usable && (usable <= CACHE_MAX_USABLE || size > CACHE_MAX_SIZE))
+    return ptr;
+  if (usable > CACHE_MAX_USABLE && size > CACHE_MAX_SIZE)
+    return mspace_realloc(chpl_dlmalloc_heap, ptr, size);
+
+  if ((newPtr = chpl_dlmalloc_malloc(size)) != NULL) {
+    memcpy(newPtr, ptr, (usable < size) ? usable : size);
+    chpl_dlmalloc_free(ptr);
+  }
+  return newPtr;
+}
+
+void chpl_dlmalloc_free(void* ptr) {
+  size_t usable;
+
+  if (ptr == NULL)
+    return;
+  usable = mspace_usable_size(ptr);
+  if (usable <= CACHE_MAX_USABLE)
+    cache_free(ptr, usable);
+  else
+    mspace_free(chpl_dlmalloc_heap, ptr);
+}
+
 
 void chpl_mem_layerInit(void) {
   void*  heap_base;
   size_t heap_size;
 
   chpl_comm_desired_shared_heap(&heap_base, &heap_size);
-  if (heap_base == NULL || heap_size == 0)
-    chpl_dlmalloc_heap = create_mspace(0, 1);
-  else
+  if (heap_base == NULL || heap_size == 0) {
+    // With no segment from the comm layer we may map our own heap
+    // from the hugetlbfs pool; otherwise dlmalloc grows its own.
+    if ((heap_base = chpl_mem_mapHugeHeap(&heap_size)) != NULL)
+      chpl_dlmalloc_heap = create_mspace_with_base(heap_base, heap_size, 1);
+    else
+      chpl_dlmalloc_heap = create_mspace(0, 1);
+  } else {
+    chpl_mem_adviseHugePages(heap_base, heap_size);
     chpl_dlmalloc_heap = create_mspace_with_base(heap_base, heap_size, 1);
+  }
+  CHPL_TLS_INIT(thread_cache);
 }
 
 
@@ -44,6 +44,9 @@ void chpl_mem_layerInit(void)
   if (heap_base != NULL && heap_size == 0)
     chpl_internal_error("if heap address is specified, size must be also");
 
+  if (heap_base != NULL)
+    chpl_mem_adviseHugePages(heap_base, heap_size);
+
   //
   // Do a first allocation, to allow tcmalloc to set up its internal
   // management structures.
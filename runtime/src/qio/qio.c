@@ -627,24 +627,44 @@ qioerr qio_fadvise_for_hints(qio_file_t* file)
   return 0;
 }
 
+// Page-align a region for madvise/msync/munmap.
 static
+void qio_page_align_region(void* data, int64_t len, void** start_out, int64_t* len_out)
+{
+  uintptr_t pagesize = sys_page_size();
+  uintptr_t start = ((uintptr_t) data) & ~(pagesize - 1);
+  *start_out = (void*) start;
+  *len_out = len + (((uintptr_t) data) - start);
+}
+
+// Applies the advice for 'hints' to [data, data+len), which need not
+// be page-aligned.  posix_madvise advice values are not flags, so each
+// one is given separately.
 qioerr qio_madvise_for_hints(void* data, int64_t len, qio_hint_t hints)
 {
-  int advice = 0;
-  qioerr err;
+  int advice[3];
+  int nadvice = 0;
+  void* start;
+  int64_t alen;
+  qioerr err = 0;
+  int i;
 
 #ifdef POSIX_MADV_RANDOM
-  if( hints & QIO_HINT_RANDOM ) advice |= POSIX_MADV_RANDOM;
+  if( hints & QIO_HINT_RANDOM ) advice[nadvice++] = POSIX_MADV_RANDOM;
 #endif
 #ifdef POSIX_MADV_SEQUENTIAL
-  if( hints & QIO_HINT_SEQUENTIAL ) advice |= POSIX_MADV_SEQUENTIAL;
+  if( hints & QIO_HINT_SEQUENTIAL ) advice[nadvice++] = POSIX_MADV_SEQUENTIAL;
 #endif
 #ifdef POSIX_MADV_WILLNEED
-  if( hints & QIO_HINT_CACHED ) advice |= POSIX_MADV_WILLNEED;
+  if( hints & QIO_HINT_CACHED ) advice[nadvice++] = POSIX_MADV_WILLNEED;
 #endif
 
-  if( advice == 0 ) err = 0; // do nothing.
-  else err = qio_int_to_err(sys_posix_madvise(data, len, advice));
+  if( len <= 0 ) return 0;
+
+  qio_page_align_region(data, len, &start, &alen);
+  for( i = 0; i < nadvice && !err; i++ ) {
+    err = qio_int_to_err(sys_posix_madvise(start, alen, advice[i]));
+  }
 
   return err;
 }
@@ -706,6 +726,65 @@ qioerr qio_mmap_initial(qio_file_t* file)
 }
 
 
+qioerr qio_file_mmap_region(qio_file_t* file, int64_t offset, int64_t len, int writeback, void** data_out)
+{
+  int64_t pagesize = sys_page_size();
+  int64_t map_start = (offset / pagesize) * pagesize;
+  int64_t skip = offset - map_start;
+  int64_t file_len = 0;
+  int flags = writeback ? MAP_SHARED : MAP_PRIVATE;
+  void* data = NULL;
+  qioerr err;
+
+  *data_out = NULL;
+
+  if( offset < 0 || len <= 0 ) QIO_RETURN_CONSTANT_ERROR(EINVAL, "invalid region to map");
+  if( file->fd == -1 ) QIO_RETURN_CONSTANT_ERROR(ENOSYS, "mmap requires a file descriptor");
+  if( writeback && !(file->fdflags & QIO_FDFLAG_WRITEABLE) ) {
+    QIO_RETURN_CONSTANT_ERROR(EBADF, "write-back mapping of a file not open for writing");
+  }
+  if( len + skip > SSIZE_MAX ) return QIO_ENOMEM;
+
+  err = qio_file_length(file, &file_len);
+  if( err ) return err;
+
+  if( offset + len > file_len ) {
+    // Touching pages past the end of the file would raise SIGBUS,
+    // so extend a writeable file and refuse otherwise.
+    if( !writeback ) QIO_RETURN_CONSTANT_ERROR(EINVAL, "region extends past the end of the file");
+    err = qio_int_to_err(sys_ftruncate(file->fd, offset + len));
+    if( err ) return err;
+  }
+
+  // Mappings without write-back are copy-on-write, so the array may
+  // still be modified in memory.
+  err = qio_int_to_err(sys_mmap(NULL, len + skip, PROT_READ|PROT_WRITE, flags, file->fd, map_start, &data));
+  if( err ) return err;
+
+  *data_out = ((char*) data) + skip;
+  return 0;
+}
+
+qioerr qio_mmap_sync(void* data, int64_t len, int async)
+{
+  void* start;
+  int64_t alen;
+
+  if( len <= 0 ) return 0;
+  qio_page_align_region(data, len, &start, &alen);
+  return qio_int_to_err(sys_msync(start, alen, async ? MS_ASYNC : MS_SYNC));
+}
+
+qioerr qio_munmap_region(void* data, int64_t len)
+{
+  void* start;
+  int64_t alen;
+
+  if( len <= 0 ) return 0;
+  qio_page_align_region(data, len, &start, &alen);
+  return qio_int_to_err(sys_munmap(start, alen));
+}
+
 qioerr qio_file_init(qio_file_t** file_out, FILE* fp, fd_t fd, qio_hint_t iohints, const qio_style_t* style, int usefilestar)
 {
   off_t initial_pos = 0;
@@ -744,6 +744,20 @@ err_t sys_munmap(void* addr, size_t length)
   return err_out;
 }
 
+err_t sys_msync(void* addr, size_t length, int flags)
+{
+  int rc;
+  err_t err_out;
+  rc = msync(addr, length, flags);
+  if( rc ) {
+    err_out = errno;
+  } else {
+    err_out = 0;
+  }
+
+  return err_out;
+}
+
 
 err_t sys_read(int fd, void* buf, size_t count, ssize_t* num_read_out)
 {
@@ -33,7 +33,9 @@
 #include "chplexit.h"
 #include "chpl-locale-model.h"
 #include "chpl-mem.h"
+#include "chpl-prof.h"
 #include "chpl-tasks.h"
+#include "chpl-trace.h"
 #include "chplsys.h"
 #include "error.h"
 #include <stdio.h>
@@ -44,6 +46,11 @@
 #include <errno.h>
 #include <sys/time.h>
 #include <unistd.h>
+#ifdef CHPL_TASKS_FIFO_FUTEX_SYNC
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#endif
 
 
 //
@@ -64,6 +71,7 @@ typedef struct task_pool_struct {
   c_string         filename;
   int              lineno;
   chpl_task_prvDataImpl_t chpl_data;
+  uint64_t         prof_queued;  // when queued, for task profiling
   task_pool_p      next;
   task_pool_p      prev;
 } task_pool_t;
@@ -174,6 +182,7 @@ static task_pool_p             add_to_task_pool(chpl_fn_p,
                                                 chpl_task_prvDataImpl_t,
                                                 chpl_task_list_p);
 
+#ifndef CHPL_TASKS_FIFO_FUTEX_SYNC
 //
 // Condition variable methods
 //
@@ -185,16 +194,242 @@ static void chpl_thread_condvar_init(chpl_thread_condvar_t* cv);
 static chpl_bool chpl_thread_sync_suspend(chpl_sync_aux_t *s,
                                    struct timeval *deadline);
 static void chpl_thread_sync_awaken(chpl_sync_aux_t *s);
+#endif
 
 // Sync variables
 
+#ifdef CHPL_TASKS_FIFO_FUTEX_SYNC
+
+//
+// The whole state of a sync variable is one 32-bit word:
+//
+//   bit 0       full
+//   bit 1       locked
+//   bits 2-4    some task is (or may be) asleep until the variable is
+//               full, empty, or just unlocked, respectively
+//   bits 24-31  running estimate of how long acquirers spin, in units
+//               of SYNC_SPIN_UNIT iterations
+//
+// A task that cannot get the variable first spins for a while, then
+// sets its waiting bit and sleeps on the word with FUTEX_WAIT_BITSET.
+// Releasing the variable wakes at most one sleeper whose condition can
+// now succeed, plus at most one that only wants the lock, instead of
+// waking everybody.  Since the releaser clears the waiting bits it
+// wakes on, a woken task sets its bit again when it acquires, in case
+// others are still asleep; that can cost a spurious wakeup later but
+// never loses one.
+//
+#define SYNC_FULL          0x01u
+#define SYNC_LOCKED        0x02u
+#define SYNC_WAIT_FULL     0x04u
+#define SYNC_WAIT_EMPTY    0x08u
+#define SYNC_WAIT_UNLOCK   0x10u
+#define SYNC_SPIN_SHIFT    24
+#define SYNC_SPIN_MASK     (0xffu << SYNC_SPIN_SHIFT)
+#define SYNC_SPIN_UNIT     4
+#define SYNC_MAX_SPIN      (0xff * SYNC_SPIN_UNIT)
+
+static inline void sync_cpu_relax(void) {
+#if defined(__x86_64__) || defined(__i386__)
+  __asm__ __volatile__ ("pause" ::: "memory");
+#else
+  __sync_synchronize();
+#endif
+}
+
+static inline chpl_bool sync_cas(chpl_sync_aux_t *s,
+                                 uint32_t old, uint32_t new) {
+  return __sync_bool_compare_and_swap(&s->state, old, new);
+}
+
+//
+// Sleep while the state is still 'val'.  Returns true if the relative
+// timeout (if any) expired.
+//
+static chpl_bool sync_futex_wait(chpl_sync_aux_t *s, uint32_t val,
+                                 uint32_t bits, struct timespec *timeout) {
+  struct timespec deadline;
+  if (timeout != NULL) {
+    // FUTEX_WAIT_BITSET takes an absolute CLOCK_MONOTONIC deadline
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec += timeout->tv_sec;
+    deadline.tv_nsec += timeout->tv_nsec;
+    if (deadline.tv_nsec >= 1000000000L) {
+      deadline.tv_sec++;
+      deadline.tv_nsec -= 1000000000L;
+    }
+  }
+  if (syscall(SYS_futex, &s->state, FUTEX_WAIT_BITSET | FUTEX_PRIVATE_FLAG,
+              val, timeout ? &deadline : NULL, NULL, bits) == -1
+      && errno == ETIMEDOUT)
+    return true;
+  return false;
+}
+
+static void sync_futex_wake(chpl_sync_aux_t *s, uint32_t bits) {
+  (void) syscall(SYS_futex, &s->state, FUTEX_WAKE_BITSET | FUTEX_PRIVATE_FLAG,
+                 1, NULL, NULL, bits);
+}
+
+static int sync_spin_limit(uint32_t state) {
+  int est;
+
+  // If we're oversubscribing the hardware, spinning only delays the
+  // task we are waiting for.
+  if (chpl_thread_getNumThreads() >= chpl_getNumLogicalCpus(true))
+    return 0;
+
+  est = ((state & SYNC_SPIN_MASK) >> SYNC_SPIN_SHIFT) * SYNC_SPIN_UNIT;
+  return (2 * est + 16 < SYNC_MAX_SPIN) ? 2 * est + 16 : SYNC_MAX_SPIN;
+}
+
+static uint32_t sync_spin_update(uint32_t state, int spins) {
+  int est = ((state & SYNC_SPIN_MASK) >> SYNC_SPIN_SHIFT) * SYNC_SPIN_UNIT;
+  est += (spins - est) / 8;
+  if (est > SYNC_MAX_SPIN)
+    est = SYNC_MAX_SPIN;
+  return (state & ~SYNC_SPIN_MASK)
+         | ((uint32_t) (est / SYNC_SPIN_UNIT) << SYNC_SPIN_SHIFT);
+}
+
+//
+// Lock the sync variable once (state & mask) == val.  wait_bit says
+// what we wait for if we have to sleep.
+//
+static void sync_acquire(chpl_sync_aux_t *s, uint32_t mask, uint32_t val,
+                         uint32_t wait_bit, chpl_bool report_block,
+                         int32_t lineno, c_string filename) {
+  uint32_t old = s->state;
+  uint32_t rewait = 0;
+  int spins = 0;
+  int max_spins;
+  uint64_t wait_start;
+
+  if ((old & (mask | SYNC_LOCKED)) == val
+      && sync_cas(s, old, old | SYNC_LOCKED))
+    return;
+
+  max_spins = sync_spin_limit(old);
+  wait_start = chpl_prof_stamp();
+
+  while (true) {
+    old = s->state;
+
+    if ((old & (mask | SYNC_LOCKED)) == val) {
+      uint32_t new = old | SYNC_LOCKED | rewait;
+      if (rewait == 0)
+        new = sync_spin_update(new, spins);
+      if (sync_cas(s, old, new)) {
+        chpl_prof_syncWaited(wait_start);
+        return;
+      }
+      continue;
+    }
+
+    if (spins < max_spins) {
+      spins++;
+      sync_cpu_relax();
+      continue;
+    }
+
+    if ((old & wait_bit) == 0) {
+      if (!sync_cas(s, old, sync_spin_update(old | wait_bit, SYNC_MAX_SPIN)))
+        continue;
+      old = sync_spin_update(old | wait_bit, SYNC_MAX_SPIN);
+    }
+    rewait = wait_bit;
+
+    if (report_block && set_block_loc(lineno, filename)) {
+      // all other tasks appear to be blocked
+      struct timespec timeout = { 1, 0 };
+      if (sync_futex_wait(s, old, wait_bit, &timeout)
+          && (s->state & (mask | SYNC_LOCKED)) != val)
+        check_for_deadlock();
+    }
+    else
+      (void) sync_futex_wait(s, old, wait_bit, NULL);
+    if (report_block)
+      unset_block_loc();
+  }
+}
+
+//
+// Unlock the sync variable, leaving it full or empty as given, and wake
+// the sleepers that can now make progress.
+//
+static void sync_release(chpl_sync_aux_t *s, chpl_bool full) {
+  uint32_t old, new, wake;
+
+  do {
+    old = s->state;
+    wake = (old & SYNC_WAIT_UNLOCK)
+           | (old & (full ? SYNC_WAIT_FULL : SYNC_WAIT_EMPTY));
+    new = (old & ~(SYNC_LOCKED | SYNC_FULL | wake)) | (full ? SYNC_FULL : 0);
+  } while (!sync_cas(s, old, new));
+
+  if (wake & SYNC_WAIT_FULL)
+    sync_futex_wake(s, SYNC_WAIT_FULL);
+  if (wake & SYNC_WAIT_EMPTY)
+    sync_futex_wake(s, SYNC_WAIT_EMPTY);
+  if (wake & SYNC_WAIT_UNLOCK)
+    sync_futex_wake(s, SYNC_WAIT_UNLOCK);
+}
+
+void chpl_sync_lock(chpl_sync_aux_t *s) {
+  sync_acquire(s, 0, 0, SYNC_WAIT_UNLOCK, false, 0, NULL);
+}
+
+void chpl_sync_unlock(chpl_sync_aux_t *s) {
+  sync_release(s, (s->state & SYNC_FULL) != 0);
+}
+
+void chpl_sync_waitFullAndLock(chpl_sync_aux_t *s,
+                                  int32_t lineno, c_string filename) {
+  sync_acquire(s, SYNC_FULL, SYNC_FULL, SYNC_WAIT_FULL, true,
+               lineno, filename);
+  if (blockreport)
+    progress_cnt++;
+}
+
+void chpl_sync_waitEmptyAndLock(chpl_sync_aux_t *s,
+                                   int32_t lineno, c_string filename) {
+  sync_acquire(s, SYNC_FULL, 0, SYNC_WAIT_EMPTY, true, lineno, filename);
+  if (blockreport)
+    progress_cnt++;
+}
+
+void chpl_sync_markAndSignalFull(chpl_sync_aux_t *s) {
+  sync_release(s, true);
+}
+
+void chpl_sync_markAndSignalEmpty(chpl_sync_aux_t *s) {
+  sync_release(s, false);
+}
+
+chpl_bool chpl_sync_isFull(void *val_ptr,
+                            chpl_sync_aux_t *s) {
+  return (s->state & SYNC_FULL) != 0;
+}
+
+void chpl_sync_initAux(chpl_sync_aux_t *s) {
+  s->state = 0;
+}
+
+void chpl_sync_destroyAux(chpl_sync_aux_t *s) { }
+
+#else // CHPL_TASKS_FIFO_FUTEX_SYNC
+
 static void sync_wait_and_lock(chpl_sync_aux_t *s,
                                chpl_bool want_full,
                                int32_t lineno, c_string filename) {
   chpl_bool suspend_using_cond;
+  uint64_t wait_start = 0;
 
   chpl_thread_mutexLock(&s->lock);
 
+  if (s->is_full != want_full)
+    wait_start = chpl_prof_stamp();
+
   // If we're oversubscribing the hardware, we wait using conditionals
   // in order to ensure fairness and thus progress.  If we're not, we
   // can spin-wait.
@@ -243,6 +478,8 @@ static void sync_wait_and_lock(chpl_sync_aux_t *s,
       chpl_thread_mutexLock(&s->lock);
   }
 
+  chpl_prof_syncWaited(wait_start);
+
   if (blockreport)
     progress_cnt++;
 }
@@ -320,6 +557,8 @@ void chpl_sync_initAux(chpl_sync_aux_t *s) {
 
 void chpl_sync_destroyAux(chpl_sync_aux_t *s) { }
 
+#endif // CHPL_TASKS_FIFO_FUTEX_SYNC
+
 // Tasks
 
 void chpl_task_init(void) {
@@ -369,6 +608,7 @@ void chpl_task_init(void) {
 
     // Set up task-private data for locale (architectural) support.
     tp->ptask->chpl_data.prvdata.serial_state = true;     // Set to false in chpl_task_callMain().
+    tp->ptask->chpl_data.prvdata.prof_region = 0;
 
     chpl_thread_setPrivateData(tp);
   }
@@ -467,6 +707,7 @@ static void comm_task_wrapper(void* arg) {
   // The comm (polling) task shouldn't really need this information.
   //
   tp->ptask->chpl_data.prvdata.serial_state = true;
+  tp->ptask->chpl_data.prvdata.prof_region = 0;
 
   tp->lockRprt = NULL;
 
@@ -484,16 +725,20 @@ void chpl_task_addToTaskList(chpl_fn_int_t fid, void* arg,
                              int lineno,
                              c_string filename) {
   chpl_task_prvDataImpl_t chpl_data = {
-    .prvdata = { .serial_state = chpl_task_getSerial() } };
+    .prvdata = { .serial_state = chpl_task_getSerial(),
+                 .prof_region = chpl_task_getPrvData()->prof_region } };
 
   assert(subloc == 0 || subloc == c_sublocid_any);
 
+  if (!chpl_data.prvdata.serial_state)
+    chpl_prof_taskSpawned(chpl_data.prvdata.prof_region);
+
   if (task_list_locale == chpl_nodeID) {
     chpl_task_list_p ltask;
 
-    ltask = (chpl_task_list_p) chpl_mem_alloc(sizeof(struct chpl_task_list),
-                                              CHPL_RT_MD_TASK_LIST_DESCRIPTOR,
-                                              0, 0);
+    ltask = (chpl_task_list_p) chpl_mem_allocPooled(sizeof(struct chpl_task_list),
+                                                    CHPL_RT_MD_TASK_LIST_DESCRIPTOR,
+                                                    0, 0);
     ltask->filename = filename;
     ltask->lineno   = lineno;
     ltask->fun      = chpl_ftable[fid];
@@ -536,6 +781,7 @@ void chpl_task_processTaskList(chpl_task_list_p task_list) {
   chpl_task_list_p ltask = task_list, next_task;
   task_pool_p curr_ptask;
   task_pool_t nested_task;
+  chpl_prof_taskState_t prof;
 
   // This function is not expected to be called if a cobegin contains fewer
   // than two statements; a coforall, however, may generate just one task,
@@ -614,7 +860,12 @@ void chpl_task_processTaskList(chpl_task_list_p task_list) {
     if (blockreport)
       initializeLockReportForThread();
 
+    chpl_trace_event(chpl_trace_taskCreate, -1, nested_task.id, 0);
+    chpl_trace_event(chpl_trace_taskStart, -1, nested_task.id, 0);
+    chpl_prof_taskBegin(nested_task.chpl_data.prvdata.prof_region, 0, &prof);
     (*first_task->fun)(first_task->arg);
+    chpl_prof_taskEnd(&prof);
+    chpl_trace_event(chpl_trace_taskEnd, -1, nested_task.id, 0);
 
     // begin critical section
     chpl_thread_mutexLock(&extra_task_lock);
@@ -661,6 +912,7 @@ void chpl_task_executeTasksInList(chpl_task_list_p task_list) {
       task_pool_p  nested_ptask = NULL;
       chpl_fn_p    task_to_run_fun = NULL;
       void*        task_to_run_arg = NULL;
+      chpl_prof_taskState_t prof;
 
       // begin critical section
       chpl_thread_mutexLock(&threading_lock);
@@ -720,7 +972,12 @@ void chpl_task_executeTasksInList(chpl_task_list_p task_list) {
         if (blockreport)
           initializeLockReportForThread();
 
+        chpl_trace_event(chpl_trace_taskStart, -1, nested_ptask->id, 0);
+        chpl_prof_taskBegin(nested_ptask->chpl_data.prvdata.prof_region,
+                            nested_ptask->prof_queued, &prof);
         (*task_to_run_fun)(task_to_run_arg);
+        chpl_prof_taskEnd(&prof);
+        chpl_trace_event(chpl_trace_taskEnd, -1, nested_ptask->id, 0);
 
         if (do_taskReport) {
           chpl_thread_mutexLock(&taskTable_lock);
@@ -738,7 +995,7 @@ void chpl_task_executeTasksInList(chpl_task_list_p task_list) {
         chpl_thread_mutexUnlock(&extra_task_lock);
 
         set_current_ptask(curr_ptask);
-        chpl_mem_free(nested_ptask, 0, 0);
+        chpl_mem_freePooled(nested_ptask, 0, 0);
       }
     }
 
@@ -761,7 +1018,7 @@ void chpl_task_freeTaskList(chpl_task_list_p task_list) {
   do {
     ltask = next_task;
     next_task = ltask->next;
-    chpl_mem_free(ltask, 0, 0);
+    chpl_mem_freePooled(ltask, 0, 0);
   } while (ltask != task_list);
 }
 
@@ -778,6 +1035,8 @@ void chpl_task_startMovedTask(chpl_fn_p fp,
   assert(subloc == 0 || subloc == c_sublocid_any);
   assert(id == chpl_nullTaskID);
 
+  chpl_prof_taskSpawned(0);
+
   pmtwd = (movedTaskWrapperDesc_t*)
           chpl_mem_alloc(sizeof(*pmtwd),
                          CHPL_RT_MD_THREAD_PRIVATE_DATA,
@@ -1154,6 +1413,7 @@ static void
 thread_begin(void* ptask_void) {
   task_pool_p ptask = (task_pool_p) ptask_void;
   thread_private_data_t *tp;
+  chpl_prof_taskState_t prof;
 
   tp = (thread_private_data_t*) chpl_mem_alloc(sizeof(thread_private_data_t),
                                                CHPL_RT_MD_THREAD_PRIVATE_DATA,
@@ -1172,7 +1432,12 @@ thread_begin(void* ptask_void) {
       chpl_thread_mutexUnlock(&taskTable_lock);
     }
 
+    chpl_trace_event(chpl_trace_taskStart, -1, ptask->id, 0);
+    chpl_prof_taskBegin(ptask->chpl_data.prvdata.prof_region,
+                        ptask->prof_queued, &prof);
     (*ptask->fun)(ptask->arg);
+    chpl_prof_taskEnd(&prof);
+    chpl_trace_event(chpl_trace_taskEnd, -1, ptask->id, 0);
 
     if (do_taskReport) {
       chpl_thread_mutexLock(&taskTable_lock);
@@ -1194,7 +1459,7 @@ thread_begin(void* ptask_void) {
     // to create a thread.
     //
     tp->ptask = NULL;
-    chpl_mem_free(ptask, 0, 0);
+    chpl_mem_freePooled(ptask, 0, 0);
 
     //
     // finished task; decrement running count and increment idle count
@@ -1432,15 +1697,18 @@ static task_pool_p add_to_task_pool(chpl_fn_p fp,
                                     chpl_task_prvDataImpl_t chpl_data,
                                     chpl_task_list_p ltask) {
   task_pool_p ptask =
-    (task_pool_p) chpl_mem_alloc(sizeof(task_pool_t),
-                                        CHPL_RT_MD_TASK_POOL_DESCRIPTOR,
-                                        0, 0);
+    (task_pool_p) chpl_mem_allocPooled(sizeof(task_pool_t),
+                                       CHPL_RT_MD_TASK_POOL_DESCRIPTOR,
+                                       0, 0);
   ptask->id           = get_next_task_id();
   ptask->fun          = fp;
   ptask->arg          = a;
   ptask->ltask        = ltask;
   ptask->begun        = false;
   ptask->chpl_data    = chpl_data;
+  ptask->prof_queued  = chpl_prof_stamp();
+
+  chpl_trace_event(chpl_trace_taskCreate, -1, ptask->id, 0);
 
   if (ltask) {
     ptask->filename = ltask->filename;
@@ -0,0 +1,29 @@
+// Serial, follower, and slice iteration over multidimensional arrays,
+// including strided, negatively strided, empty, and unsigned domains.
+
+config const n = 5;
+var A: [1..n, 1..n] int;
+for (i,j) in A.domain do A[i,j] = i*10+j;
+for a in A do write(a, " "); writeln();
+var B: [1..n by 2, 1..n by -2] int;
+for (i,j) in B.domain do B[i,j] = i*10+j;
+for b in B do write(b, " "); writeln();
+writeln(+ reduce A);
+forall a in A do a += 1;
+writeln(A);
+var C: [0..2, 0..3, 0..4] real;
+forall (c, (i,j,k)) in zip(C, C.domain) do c = i*100+j*10+k;
+writeln(C);
+ref S = A[2..4, 2..4 by 2];
+for s in S do write(s, " "); writeln();
+forall s in A[2..3, ..] do s = 0;
+writeln(A);
+var E: [1..0, 1..3] int;
+for e in E do writeln("bad");
+var R = A[3, ..];
+for r in R do write(r, " "); writeln();
+var D: [1..4, 1..4] int;
+forall (d, i) in zip(D[.., 2], 1..4) do d = i;
+writeln(D);
+const U: [1:uint..3:uint, 1:uint..2:uint] int = 7;
+writeln(+ reduce U);
@@ -0,0 +1,16 @@
+var D: domain(string);
+var A: [D] int;
+
+D += "zero";
+A("zero") = 0;
+
+var words = ["one", "two", "three", "two", "zero"];
+D.bulkAdd(words);
+writeln(D.numIndices);
+writeln(D.sorted());
+writeln(A("zero"), " ", A("three"));
+
+var E: domain(int);
+var keys: [1..1000] int = [i in 1..1000] i % 100;
+E.bulkAdd(keys);
+writeln(E.numIndices, " ", + reduce E);
@@ -0,0 +1,30 @@
+use LayoutConcurrentAssoc;
+
+var D: domain(int) dmapped new dmap(new ConcurrentAssoc());
+var A: [D] real;
+
+for i in 1..10 do
+  D += i*i;
+
+writeln(D.numIndices);
+writeln(D.member(49), " ", D.member(50));
+
+for i in D do
+  A(i) = i / 2.0;
+
+D -= 49;
+writeln(D.numIndices, " ", D.member(49));
+
+writeln(D.sorted());
+for i in D.sorted() do
+  write(A(i), " ");
+writeln();
+
+// force several resizes and make sure the array follows the domain
+for i in 11..1000 do
+  D += i*i;
+writeln(D.numIndices, " ", A(100), " ", A(81));
+
+var sum = 0;
+for i in D do sum += i;
+writeln(sum);
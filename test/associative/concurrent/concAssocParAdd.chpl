@@ -0,0 +1,22 @@
+use LayoutConcurrentAssoc;
+
+config const n = 100000;
+
+var D: domain(int) dmapped new dmap(new ConcurrentAssoc());
+
+// many tasks adding overlapping keys while the table keeps growing
+forall i in 1..n do
+  D.add(i % (n/2));
+writeln(D.numIndices);
+
+writeln(&& reduce [i in 0..#(n/2)] D.member(i), " ", D.member(n));
+
+var A: [D] int;
+forall i in D do
+  A(i) = i;
+writeln(+ reduce A == + reduce D);
+
+// bulk insertion of new and existing keys; existing values survive
+var keys: [1..n] int = [i in 1..n] i;
+D.bulkAdd(keys);
+writeln(D.numIndices, " ", A(n/4), " ", A(n));
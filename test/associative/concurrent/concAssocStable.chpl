@@ -0,0 +1,60 @@
+use LayoutConcurrentAssoc;
+
+config const n = 20000;
+
+var D: domain(int) dmapped new dmap(new ConcurrentAssoc());
+var A: [D] int;
+
+for i in 1..10 do
+  D += i;
+
+// a reference stays valid while the domain grows under it
+ref r = A(5);
+for i in 11..n do
+  D += i;
+r = 42;
+writeln(A(5));
+
+// writes to existing elements are not lost while other tasks resize
+proc bump() {
+  forall i in 1..n do
+    A(i) += i;
+}
+
+cobegin {
+  forall i in n+1..4*n do
+    D.add(i);
+  bump();
+}
+writeln(D.numIndices, " ", + reduce A == n*(n+1)/2 + 42);
+
+// adding to the domain while iterating over it only visits the
+// indices that were there when the loop started
+var visited = 0;
+for i in D {
+  visited += 1;
+  if i <= n then
+    D += i + 4*n;
+}
+writeln(visited, " ", D.numIndices);
+
+// removed entries are recycled; new indices start with default values
+for i in 1..n do
+  D -= i;
+for i in 1..n do
+  D += -i;
+writeln(D.numIndices, " ", A(-1), " ", + reduce [i in 1..n] A(-i));
+forall (i, a) in zip(D, A) do
+  a = i;
+writeln(&& reduce [i in D] A(i) == i);
+
+// parSafe=false domains skip the resize registration
+var S: domain(int, parSafe=false) dmapped new dmap(new ConcurrentAssoc());
+var B: [S] real;
+const squares: [1..n] int = [i in 1..n] i*i;
+S.bulkAdd(squares);
+for i in 1..n do
+  B(i*i) = i;
+for i in 1..n by 2 do
+  S -= i*i;
+writeln(S.numIndices, " ", + reduce B);
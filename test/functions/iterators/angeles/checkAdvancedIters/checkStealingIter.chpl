@@ -0,0 +1,102 @@
+// Test to check the correctness of the stealing() Iterator from the AdvancedIters module
+use AdvancedIters, BlockDist;
+
+config const nTasks=4;          // here.numCores; should be here.maxTaskPar?
+config const n:int=10000;       // The size of the range
+config const chunkSize:int=1;   // The size of the chunk
+var rng:range=1..n;             // The ranges
+var rngs=rng by 2;
+
+var A:[rng] atomic int;         // The test arrays
+var B:[rngs] atomic int;
+var C:[rngs,rng] atomic int;
+
+writeln("Checking a non-strided range ");
+forall i in stealing(rng,chunkSize,nTasks) do {
+  // uneven work so that tasks run dry at different times
+  if i % 97 == 0 then for 1..200 do chpl_task_yield();
+  A[i].add(1);
+ }
+checkCorrectness(A);
+
+writeln("Checking a strided range with larger chunks ");
+forall i in stealing(rngs,16,nTasks) do {
+  B[i].add(1);
+ }
+checkCorrectness(B);
+
+writeln("Checking a zippered iteration ");
+forall (i,j) in zip(stealing(rngs,chunkSize,nTasks),rng#rngs.size) do {
+  C[i,j].add(1);
+ }
+checkCorrectness2(C,rngs,rng);
+
+writeln("Checking a 2D domain ");
+const D2 = {1..3, 1..n/10};
+var E:[D2] atomic int;
+forall (i,j) in stealing(D2,chunkSize,nTasks) do {
+  E[i,j].add(1);
+ }
+checkCorrectness(E);
+
+writeln("Checking a 2D domain zippered with an array ");
+var F:[D2] int;
+forall ((i,j), f) in zip(stealing(D2,chunkSize,nTasks), F) do {
+  f = i*n + j;
+ }
+var ok = true;
+for (i,j) in D2 do if F[i,j] != i*n + j then ok = false;
+writeln("Stealing Iterator: ", if ok then "Correct" else "Error");
+
+writeln("Checking a Block domain ");
+const BD = {1..n/10, 1..5} dmapped Block(boundingBox={1..n/10, 1..5});
+var G:[BD] atomic int;
+forall ij in stealing(BD,chunkSize,nTasks) do {
+  G[ij].add(1);
+ }
+checkCorrectness(G);
+
+writeln("Checking a Block domain zippered with a Block array ");
+var H:[BD] int;
+forall ((i,j), h) in zip(stealing(BD,chunkSize,nTasks), H) do {
+  h = i*10 + j;
+ }
+ok = true;
+for (i,j) in BD do if H[i,j] != i*10 + j then ok = false;
+writeln("Stealing Iterator: ", if ok then "Correct" else "Error");
+
+proc checkCorrectness(Arr:[])
+{
+  var check=true;
+  for i in Arr.domain do {
+    if Arr[i].read() != 1 then {
+      check=false;
+      writeln(" ");
+      writeln("Stealing Iterator: Error in iteration ", i);
+      writeln(" ");
+    }
+  }
+  if check==true then
+    writeln("Stealing Iterator: Correct");
+}
+
+proc checkCorrectness2(Arr:[],r:range(?), r2:range(?))
+{
+  var check=true;
+  for (i,j) in zip(r,r2#r.size) do {
+    if Arr[i,j].read() != 1 then {
+      check=false;
+      writeln(" ");
+      writeln("Stealing Iterator: Error in iteration ", i, ",",j);
+      writeln(" ");
+    }
+  }
+  for ij in Arr.domain do
+    if Arr[ij].read() > 1 then {
+      check=false;
+      writeln("Stealing Iterator: Repeated iteration ", ij);
+    }
+
+  if check==true then
+    writeln("Stealing Iterator: Correct");
+}
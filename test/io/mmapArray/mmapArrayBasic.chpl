@@ -0,0 +1,90 @@
+use MappedFile;
+
+config const n = 100000;
+
+// write n native int(32)s, preceded by a 3-byte header so the mapping
+// starts at an unaligned offset
+var f = open("mmapArrayBasic.bin", iomode.cwr);
+{
+  var w = f.writer(kind=ionative);
+  w.write(1:uint(8), 2:uint(8), 3:uint(8));
+  for i in 1..n do w.write(i:int(32));
+  w.close();
+}
+
+// read-only view: parallel and serial sums agree with the data written
+{
+  var A = f.mmapArray(int(32), start=3);
+  writeln("numElements = ", A.numElements);
+  writeln("A(0) = ", A(0), " A(", n-1, ") = ", A(n-1));
+  writeln("forall sum ok: ", (+ reduce [a in A] a:int) == n*(n+1)/2);
+  var s = 0;
+  for a in A do s += a;
+  writeln("serial sum ok: ", s == n*(n+1)/2);
+
+  // zippered with a dense array over the same number of elements
+  var B: [0..#n] int;
+  forall (b, a) in zip(B, A) do b = 2*a;
+  writeln("zippered ok: ", && reduce [i in 0..#n] (B(i) == 2*(i+1)));
+
+  // without write-back the mapping is copy-on-write
+  A(0) = 42;
+  writeln("modified in memory: ", A(0));
+  delete A;
+}
+{
+  var r = f.reader(kind=ionative, start=3);
+  var x: int(32);
+  r.read(x);
+  writeln("file unchanged: ", x);
+  r.close();
+}
+
+// write-back: modify in parallel, flush, and read back through a channel
+{
+  var A = f.mmapArray(int(32), start=3, numElements=n, writeBack=true,
+                      hints=IOHINT_SEQUENTIAL | IOHINT_CACHED);
+  forall a in A do a = -a;
+  A.flush();
+  delete A;
+}
+{
+  var r = f.reader(kind=ionative, start=3);
+  var ok = true;
+  for i in 1..n {
+    var x: int(32);
+    r.read(x);
+    if x != -i then ok = false;
+  }
+  writeln("write-back ok: ", ok);
+  r.close();
+}
+
+// write-back past the end of the file extends it
+{
+  var A = f.mmapArray(int(32), start=3+4*n, numElements=10, writeBack=true);
+  for (a, i) in zip(A, 1..) do a = i:int(32);
+  delete A;
+}
+writeln("length after extending: ", f.length());
+
+// a read-only mapping past the end of the file is an error
+{
+  var err: syserr;
+  var A = f.mmapArray(int(32), err, start=3, numElements=2*n);
+  writeln("mapping past the end fails: ", err != ENOERR);
+}
+
+f.close();
+
+// files open for reading only can be mapped, but not for write-back
+{
+  var rf = open("mmapArrayBasic.bin", iomode.r);
+  var A = rf.mmapArray(int(32), start=3+4*n);
+  writeln("read-only file: ", A);
+  delete A;
+  var err: syserr;
+  var B = rf.mmapArray(int(32), err, start=3, writeBack=true);
+  writeln("write-back on a read-only file fails: ", err != ENOERR);
+  rf.close();
+}
@@ -0,0 +1,39 @@
+// Arrays large enough to be placed on sublocales must still be
+// default-initialized everywhere and work with forall.
+
+config const n = 1 << 18;
+
+record R {
+  var x = 1;
+  var y = 2.0;
+}
+
+class C {
+  var v: int;
+}
+
+var A: [1..n] real;
+writeln(+ reduce A);
+forall i in A.domain do A[i] = i;
+writeln(+ reduce A == n*(n+1)/2.0);
+
+var B: [1..4, 1..n] int;
+writeln(+ reduce B);
+forall (i,j) in B.domain do B[i,j] = i;
+writeln(+ reduce B == 10*n);
+
+var D: [0..#n] R;
+writeln((+ reduce [d in D] (d.x + d.y)) == 3.0*n);
+
+var E: [1..n] C;
+writeln(&& reduce [e in E] (e == nil));
+
+var ok = true;
+for loc in Locales do on loc {
+  for i in 0..#here.getChildCount() do on here.getChild(i) {
+    var S: [1..n] int;
+    forall s in S do s += 1;
+    if (+ reduce S) != n then ok = false;
+  }
+}
+writeln(ok);
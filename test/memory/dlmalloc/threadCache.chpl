@@ -0,0 +1,42 @@
+// Small allocations go through per-thread caches in the dlmalloc
+// layer.  Objects are freed by a different task than allocated them,
+// strings are grown (realloc), and nothing may be lost or shared.
+
+class Node {
+  var id: int;
+  var name: string;
+}
+
+config const numTasks = 4,
+             perTask = 5000;
+
+var nodes: [1..numTasks, 1..perTask] Node;
+
+// each task allocates its own row
+coforall t in 1..numTasks do
+  for i in 1..perTask do
+    nodes[t, i] = new Node(t*perTask + i, "n" + i);
+
+// and frees another task's row after checking it
+var ok: atomic bool;
+ok.write(true);
+coforall t in 1..numTasks {
+  const victim = t % numTasks + 1;
+  for i in 1..perTask {
+    const n = nodes[victim, i];
+    if n.id != victim*perTask + i || n.name != "n" + i then
+      ok.write(false);
+    delete n;
+  }
+}
+writeln(ok.read());
+
+// strings that grow one piece at a time
+var lens: [1..numTasks] int;
+coforall t in 1..numTasks {
+  var s = "";
+  for i in 1..200 do
+    s += "ab";
+  lens[t] = s.length;
+}
+writeln(lens);
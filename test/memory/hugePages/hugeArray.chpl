@@ -0,0 +1,22 @@
+// Arrays above the huge page threshold are advised to use transparent
+// huge pages (see hugeArray.execenv); their contents must not change,
+// and the two large ones must show up in the advice counters.
+use Memory;
+
+config const n = 4 * 1024 * 1024;
+
+var A: [1..n] int;
+forall i in 1..n do A[i] = i;
+writeln(+ reduce A == n * (n + 1) / 2);
+
+var B: [1..1000] real = 1.0;
+writeln(+ reduce B);
+
+// Growing past the threshold reallocates through the same path.
+var D = {1..10};
+var C: [D] int = 7;
+D = {1..n};
+C[n] = 7;
+writeln(C[1] + C[10] + C[11] + C[n]);
+
+printHugePageUsage();
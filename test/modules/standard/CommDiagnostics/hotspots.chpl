@@ -0,0 +1,41 @@
+use CommDiagnostics;
+
+// With CHPL_COMM=none there is no remote communication to record, so
+// feed the runtime's recorder directly, the way generated GETs and
+// PUTs would.  hotspotsRemote.chpl records real transfers.
+extern proc chpl_comm_hotspots_record(kind: int(32), node: int(32),
+                                      bytes: uint(64), ln: c_int,
+                                      fn: c_string);
+
+proc fakeGets(n: int, bytes: int, line: int, node: int) {
+  for 1..n do
+    chpl_comm_hotspots_record(0, node:int(32), bytes:uint(64), line:c_int,
+                              "fake.chpl");
+}
+
+proc fakePuts(n: int, bytes: int, line: int, node: int) {
+  for 1..n do
+    chpl_comm_hotspots_record(1, node:int(32), bytes:uint(64), line:c_int,
+                              "fake.chpl");
+}
+
+startCommHotspots();
+fakeGets(900, 8, 10, 1);
+fakeGets(50, 8, 10, 2);
+fakeGets(40, 16, 20, 1);
+fakePuts(2, 1 << 20, 30, 3);
+fakePuts(1, 4096, 30, 3);
+sync begin fakeGets(10, 8, 10, 1);
+stopCommHotspots();
+printCommHotspots(3);
+
+// Sampling every 4th operation still gives the right totals for
+// counts that are multiples of the period.
+resetCommHotspots();
+startCommHotspots(4);
+fakeGets(400, 8, 10, 1);
+stopCommHotspots();
+printCommHotspots(1);
+
+resetCommHotspots();
+printCommHotspots();
@@ -0,0 +1,53 @@
+use CommDiagnostics, Sort;
+
+//
+// Drive real remote GETs and PUTs, plain and strided, from generated
+// code and check that the hotspots recorded for them carry this file's
+// line numbers.  Entries attributed to module code are left out, since
+// their lines change whenever the modules do.  The strided transfers
+// come from the slice assignments, which need useBulkTransferStride.
+//
+// The reads of x in the loop are reported against x's declaration,
+// which is the line the compiler passes for them.
+//
+config const n = 10;
+
+var x = 1;
+var A: [1..2*n] int = 1..2*n;
+
+on Locales[1] {
+  var B: [1..2*n] int;
+  var sum = 0;
+  startCommHotspotsHere();
+  for 1..n do
+    sum += x;
+  x = sum;
+  B[1..2*n by 2] = A[1..2*n by 2];
+  A[2..2*n by 2] = B[1..2*n by 2];
+  stopCommHotspotsHere();
+  writeln(sum, " ", B);
+
+  const kindNames = ("get", "put");
+  var sites: [1..0] string;
+  for i in 0:int(32)..#chpl_comm_snapshotHotspotsHere() {
+    if chpl_comm_hotspotFile(i):string != "hotspotsRemote.chpl" then
+      continue;
+    var site = kindNames(chpl_comm_hotspotKind(i) + 1) + " line " +
+               chpl_comm_hotspotLine(i) + " -> locale " +
+               chpl_comm_hotspotNode(i) + ": " +
+               chpl_comm_hotspotCount(i) + " ops, " +
+               chpl_comm_hotspotBytes(i) + " bytes; sizes";
+    for b in 0:int(32)..#CHPL_COMM_HOT_NBUCKETS do
+      if chpl_comm_hotspotHist(i, b) != 0 then
+        site += " " + commHotspotSizeLabel(b) + ":" +
+                chpl_comm_hotspotHist(i, b);
+    sites.push_back(site);
+  }
+
+  // Sites with equal counts come out of the snapshot in no particular
+  // order, so sort them.
+  QuickSort(sites);
+  for site in sites do
+    writeln(site);
+}
+writeln(A);
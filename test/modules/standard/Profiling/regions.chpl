@@ -0,0 +1,50 @@
+use Profiling;
+
+config const numTasks = 4;
+
+startProfiling();
+
+// Tasks spawned inside a region are counted there, and inherit it.
+const prev = beginProfileRegion("coforall");
+coforall i in 1..numTasks {
+  var x = 0;
+  for j in 1..1000 do x += j;
+}
+endProfileRegion(prev);
+
+// A sync variable handoff between two tasks.
+var s$: sync int;
+const prev2 = beginProfileRegion("handoff");
+cobegin {
+  { var v = s$; }
+  { s$ = 1; }
+}
+endProfileRegion(prev2);
+
+stopProfiling();
+
+writeln(getProfileCounter("coforall", profCounter.tasksSpawned));
+writeln(getProfileCounter("coforall", profCounter.tasksRun));
+writeln(getProfileCounter("coforall", profCounter.runNs) > 0);
+writeln(getProfileCounter("handoff", profCounter.tasksSpawned));
+writeln(getProfileCounter("<none>", profCounter.tasksSpawned));
+writeln(getProfileCounter("unused", profCounter.tasksRun));
+
+// Nothing is counted while profiling is off.
+coforall i in 1..numTasks do ;
+writeln(getProfileCounter("coforall", profCounter.tasksSpawned));
+
+dumpProfile("regions.prof");
+var f = open("regions.prof." + here.id, iomode.r);
+var r = f.reader();
+var line: string;
+r.readline(line);
+write(line);
+r.readline(line);
+write(line);
+var numLines = 2;
+while r.readline(line) do numLines += 1;
+writeln(numLines);
+r.close();
+f.close();
+unlink("regions.prof." + here.id);
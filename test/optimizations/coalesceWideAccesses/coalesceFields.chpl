@@ -0,0 +1,40 @@
+// Runs of accesses to fields of one remote object should be coalesced
+// into a single transfer.  Accesses separated by a call, and writes to
+// fields that are not adjacent, should be left alone.
+class C {
+  var a, b, c: int;
+  var x, y, z: real;
+}
+
+record R {
+  var a, b, c: int;
+  var x, y, z: real;
+}
+
+var c = new C(1, 2, 3, 4.0, 5.0, 6.0);
+var r = new R(1, 2, 3, 4.0, 5.0, 6.0);
+
+proc sumC(obj: C) {
+  return obj.a + obj.b + obj.c + obj.x + obj.y + obj.z;
+}
+
+proc f(i: int) {
+  return i + 1;
+}
+
+on Locales[numLocales-1] {
+  writeln(sumC(c));
+  writeln(r.a + r.b + r.c + r.x + r.y + r.z);
+
+  c.a = 10;
+  c.b = 20;
+  c.c = 30;
+  writeln((c.a, c.b, c.c));
+
+  const t = f(c.a);
+  writeln(t + f(c.b));
+
+  c.a = 100;
+  c.x = 400.0;
+  writeln(c);
+}
@@ -0,0 +1,63 @@
+// Remote array reads whose index is an affine function of the loop
+// index are prefetched --comm-prefetch-distance iterations ahead.  In
+// gather(), only the read of Idx is; the read of A through it is not.
+// The strided loop steps through an iterator, not a C for-loop, so it
+// is left alone, and so is the loop in firstOver(), which may return
+// before its test says it is done.
+
+config const n = 20;
+
+var A: [1..n] int = [i in 1..n] i;
+var B: [1..n, 1..n] real = [(i, j) in {1..n, 1..n}] i + j / 100.0;
+var Idx: [1..n] int = [i in 1..n] n + 1 - i;
+
+proc sumAll() {
+  var s = 0;
+  for i in 1..n do
+    s += A[i];
+  return s;
+}
+
+proc sumStrided() {
+  var s = 0;
+  for i in 1..n by 3 do
+    s += A[i];
+  return s;
+}
+
+proc rowSum(i) {
+  var s = 0.0;
+  for j in 1..n do
+    s += B[i, j];
+  return s;
+}
+
+proc colSum(j) {
+  var s = 0.0;
+  for i in 1..n do
+    s += B[i, j];
+  return s;
+}
+
+proc gather() {
+  var s = 0;
+  for i in 1..n do
+    s += A[Idx[i]];
+  return s;
+}
+
+proc firstOver(x) {
+  for i in 1..n do
+    if A[i] > x then
+      return i;
+  return 0;
+}
+
+on Locales[0] {
+  writeln(sumAll());
+  writeln(sumStrided());
+  writeln(rowSum(3));
+  writeln(colSum(7));
+  writeln(gather());
+  writeln(firstOver(7));
+}
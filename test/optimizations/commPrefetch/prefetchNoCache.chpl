@@ -0,0 +1,12 @@
+// Without the cache for remote data a remote prefetch would block like
+// the read it is meant to hide, so --comm-prefetch-distance warns and
+// does nothing.
+
+config const n = 20;
+
+var A: [1..n] int = [i in 1..n] i;
+
+var s = 0;
+for i in 1..n do
+  s += A[i];
+writeln(s);
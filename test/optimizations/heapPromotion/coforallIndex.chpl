@@ -0,0 +1,41 @@
+// Coforall index variables only need to live on the heap if their
+// address can reach a task.  A tuple index whose components are
+// copied into each task stays on the stack; a local shared with a
+// begin still goes to the heap.
+
+record R {
+  var a, b: int;
+}
+
+config const n = 8;
+
+proc tupleIndex() {
+  var sum: atomic int;
+  coforall (i, j) in zip(1..n, 1..n by -1) do
+    sum.add(i * j);
+  writeln(sum.read());
+}
+
+iter recs() {
+  for i in 1..n do
+    yield new R(i, 2*i);
+}
+
+proc recordIndex() {
+  var sum: atomic int;
+  coforall r in recs() do
+    sum.add(r.a + r.b);
+  writeln(sum.read());
+}
+
+proc sharedWithBegin() {
+  var x: atomic int;
+  sync {
+    begin x.write(42);
+  }
+  writeln(x.read());
+}
+
+tupleIndex();
+recordIndex();
+sharedWithBegin();
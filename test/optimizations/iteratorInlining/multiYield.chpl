@@ -0,0 +1,47 @@
+// Serial loops over iterators with several yields, alone and as the
+// first iterator of a zippered loop, including break and continue.
+
+iter pairs(n: int) {
+  for i in 1..n {
+    yield i;
+    yield -i;
+  }
+}
+
+iter blocks(lo: int, hi: int, bs: int) {
+  var i = lo;
+  while i + bs - 1 <= hi {
+    for j in i..#bs do yield j;
+    i += bs;
+  }
+  for j in i..hi do yield j;
+}
+
+var s = 0;
+for p in pairs(10) do s += p * p;
+writeln(s);
+
+var b = 0;
+for x in blocks(1, 103, 8) do b += x;
+writeln(b);
+
+var z = 0;
+for (x, y) in zip(blocks(1, 20, 6), 1..20) do z += x * y;
+writeln(z);
+
+for p in pairs(3) {
+  if p == -2 then break;
+  write(p, " ");
+}
+writeln();
+
+var q = 0;
+for (x, y) in zip(pairs(5), blocks(1, 10, 3)) {
+  if y == 4 then continue;
+  q += x * y;
+}
+writeln(q);
+
+var A: [1..6] int;
+for (a, p) in zip(A, pairs(3)) do a = p;
+writeln(A);
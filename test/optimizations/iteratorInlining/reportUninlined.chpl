@@ -0,0 +1,23 @@
+class Node { var val: int; var left, right: Node; }
+
+iter pairs(n: int) {
+  for i in 1..n {
+    yield i;
+    yield -i;
+  }
+}
+
+iter walk(t: Node): int {
+  if t.left != nil then for x in walk(t.left) do yield x;
+  yield t.val;
+  if t.right != nil then for x in walk(t.right) do yield x;
+}
+
+var s = 0;
+for p in pairs(4) do s += p;
+for (p, i) in zip(pairs(4), 1..8) do s += p * i;
+writeln(s);
+
+var r = new Node(2, new Node(1), new Node(3));
+for x in walk(r) do write(x, " ");
+writeln();
@@ -0,0 +1,12 @@
+// The iterators zippered with an inlined first iterator must have the
+// same length as it.
+
+iter pairs(n: int) {
+  for i in 1..n {
+    yield i;
+    yield -i;
+  }
+}
+
+for (p, i) in zip(pairs(2), 1..5) do
+  writeln((p, i));
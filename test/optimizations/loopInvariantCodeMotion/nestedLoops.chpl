@@ -0,0 +1,52 @@
+// Loop nests with invariant expressions at several depths, early exits
+// and code after a return, to exercise the dominator tree and the flow
+// analyses that loop invariant code motion and copy propagation use.
+config const n = 6;
+
+proc sumNest(a: int, b: int) {
+  var total = 0;
+  for i in 1..n {
+    const ab = a * b;
+    for j in 1..n {
+      const ai = a + i;
+      var k = 0;
+      while k < j {
+        const c = ab + ai;
+        if c > 1000 then break;
+        total += c + k;
+        k += 1;
+      }
+      if j == i then continue;
+      total -= ab;
+    }
+  }
+  return total;
+}
+
+proc firstOver(limit: int) {
+  var x = 1, y = 1;
+  for i in 1..100 {
+    const step = limit / 10;
+    x += step;
+    y = x;
+    if x > limit then
+      return (i, y);
+  }
+  return (0, y);
+  writeln("not reached");
+}
+
+proc countDown(m: int) {
+  var i = m, steps = 0;
+  do {
+    const half = m / 2;
+    if i > half then steps += 2; else steps += 1;
+    i -= 1;
+  } while i > 0;
+  return steps;
+}
+
+writeln(sumNest(2, 3));
+writeln(sumNest(7, 11));
+writeln(firstOver(50));
+writeln(countDown(9));
@@ -0,0 +1,71 @@
+//
+// The forks of a fast on statement that ends each iteration of a
+// forall are batched; those of a serial loop, or of an on whose result
+// the iteration goes on to use, are not.
+//
+config const n = 100;
+
+//
+// Each locale's share of the data lives in an object allocated there,
+// so the on-bodies can be local blocks, which makes them fast.
+//
+class Part {
+  var A: [1..n] int;
+  var B: [1..n] int;
+  var C: [1..n] int;
+  var D: [1..n, 1..4] int;
+}
+
+var parts: [LocaleSpace] Part;
+coforall loc in Locales do on loc do
+  parts[loc.id] = new Part();
+
+proc part(i) return parts[i % numLocales];
+
+proc scatter() {
+  forall i in 1..n {
+    const p = part(i);
+    on p do local { p.A[i] = i * 10; }
+  }
+}
+
+proc scatter2D() {
+  forall (i, j) in {1..n, 1..4} {
+    const p = part(i + j);
+    on p do local { p.D[i, j] = i * j; }
+  }
+}
+
+proc serialScatter() {
+  for i in 1..n {
+    const p = part(i);
+    on p do local { p.B[i] = i + 1; }
+  }
+}
+
+proc scatterAndCheck() {
+  var count: atomic int;
+  forall i in 1..n {
+    const p = part(i);
+    on p do local { p.C[i] = i; }
+    if p.C[i] == i then count.add(1);
+  }
+  return count.read();
+}
+
+scatter();
+scatter2D();
+serialScatter();
+
+var sumA, sumB, sumD: int;
+for p in parts {
+  sumA += + reduce p.A;
+  sumB += + reduce p.B;
+  sumD += + reduce p.D;
+}
+writeln(sumA);
+writeln(sumD);
+writeln(sumB);
+writeln(scatterAndCheck());
+
+for p in parts do delete p;
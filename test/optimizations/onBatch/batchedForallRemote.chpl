@@ -0,0 +1,43 @@
+//
+// Run batched on-bodies on another locale: the first half of the
+// iterations write to locale 0 and the second half to locale 1, so
+// the forks to locale 1 are buffered and sent a batch at a time.
+//
+use CommDiagnostics;
+
+config const n = 1000;
+
+class Part {
+  var A: [1..n] int;
+}
+
+var parts: [LocaleSpace] Part;
+coforall loc in Locales do on loc do
+  parts[loc.id] = new Part();
+
+proc part(i) return parts[(i - 1) * numLocales / n];
+
+proc scatter() {
+  forall i in 1..n {
+    const p = part(i);
+    on p do local { p.A[i] = i * 10; }
+  }
+}
+
+startCommDiagnostics();
+scatter();
+stopCommDiagnostics();
+
+for p in parts {
+  const owner = p.locale.id;
+  var ok = true;
+  for i in 1..n do
+    if p.A[i] != (if part(i) == p then i * 10 else 0) then ok = false;
+  writeln(owner, ": ", ok, " ", + reduce p.A);
+}
+
+// One fork per iteration to the other locale without batching.
+const cd = getCommDiagnostics()[0];
+writeln((cd.fork + cd.fork_fast):int < n / numLocales);
+
+for p in parts do delete p;
@@ -0,0 +1,32 @@
+// Compiled with --profile-generate, the program must behave as usual
+// and leave its call site counts in chpl-call-profile.0, which the
+// .prediff appends to the output.
+
+record point {
+  var x, y: int;
+}
+
+proc dist2(p: point, q: point) {
+  const dx = p.x - q.x, dy = p.y - q.y;
+  return dx*dx + dy*dy;
+}
+
+proc closest(pts: [] point, q: point) {
+  var best = pts.domain.low;
+  for i in pts.domain do
+    if dist2(pts[i], q) < dist2(pts[best], q) then
+      best = i;
+  return best;
+}
+
+config const n = 1000;
+
+var pts: [1..n] point;
+for i in 1..n do
+  pts[i] = new point(i % 37, i % 41);
+
+var total = 0;
+for j in 1..50 do
+  total += closest(pts, new point(j, 2*j));
+
+writeln(total);
@@ -0,0 +1,9 @@
+// A profile whose call sites no longer match the program's is ignored
+// with a warning naming the first site that moved.
+
+proc square(x: int) return x*x;
+
+var sum = 0;
+for i in 1..10 do
+  sum += square(i);
+writeln(sum);
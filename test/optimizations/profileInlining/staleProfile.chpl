@@ -0,0 +1,8 @@
+// A profile written for a different program is ignored with a warning.
+
+proc square(x: int) return x*x;
+
+var sum = 0;
+for i in 1..10 do
+  sum += square(i);
+writeln(sum);
@@ -0,0 +1,26 @@
+// Index tuples in a serial 2-D stencil, including those passed to the
+// inlined member() and array accessors, or by value to the non-inline
+// weight(), should all be scalar replaced.  Only the tuple passed by
+// ref to shift() and the serial iterator's default offset argument
+// should be reported.
+config const n = 5;
+const D = {1..n, 1..n};
+var A, B: [D] int;
+
+proc weight(i: 2*int) return i(1) * 10 + i(2);
+
+proc shift(ref i: 2*int) { i(2) -= 1; }
+
+for (i,j) in D do
+  A(i,j) = i + j;
+
+for idx in D {
+  const north = idx + (-1,0), east = idx + (0,1);
+  if D.member(north) && D.member(east) then
+    B(idx) = A(north) + A(east) + weight(idx);
+  var west = idx;
+  shift(west);
+  if D.member(west) then
+    B(idx) += A(west);
+}
+writeln(B);
@@ -0,0 +1,61 @@
+// Small records passed to and returned from non-inline functions are
+// split into their fields at the call boundary.  Check that results are
+// unchanged when the record is also the destination, an array element,
+// or a field of a class, and when it is returned from inside a loop.
+record vec3 {
+  var x, y, z: real;
+}
+
+proc +(a: vec3, b: vec3) return new vec3(a.x+b.x, a.y+b.y, a.z+b.z);
+proc *(s: real, a: vec3) return new vec3(s*a.x, s*a.y, s*a.z);
+proc dot(a: vec3, b: vec3) return a.x*b.x + a.y*b.y + a.z*b.z;
+
+proc step(p: vec3, v: vec3, dt: real) {
+  var q = p + dt * v;
+  return q;
+}
+
+proc swapPair(t: (int, real)) return (t(2):int, t(1):real);
+
+proc firstPast(p: vec3, v: vec3, limit: real) {
+  var q = p;
+  for i in 1..100 {
+    q = q + v;
+    if q.x > limit then
+      return q;
+  }
+  return p;
+}
+
+class Body {
+  var pos, vel: vec3;
+}
+
+proc main {
+  var p = new vec3(1.0, 2.0, 3.0);
+  var v = new vec3(0.5, -0.5, 0.25);
+  for i in 1..10 do
+    p = step(p, v, 0.1);
+  writeln(p);
+  writeln(dot(p, v));
+
+  p = p + p;
+  writeln(p);
+
+  var A: [1..3] vec3;
+  for i in 1..3 do
+    A(i) = A(i) + i * v;
+  writeln(A);
+
+  var b = new Body(p, v);
+  b.pos = step(b.pos, b.vel, 1.0);
+  writeln(b.pos);
+  delete b;
+
+  writeln(firstPast(p, v, 5.25));
+  writeln(firstPast(p, v, 500.0));
+
+  var t = (3, 4.5);
+  for i in 1..3 do t = swapPair(t);
+  writeln(t);
+}
@@ -0,0 +1,51 @@
+// The loops that forall followers are inlined into get vectorization
+// hints, including the range and zippered followers.  Only the
+// innermost loop of a multidimensional follower gets one.  Serial loops
+// and loops over a user's follower, which may carry state from one
+// yield to the next, do not.
+
+config const n = 10;
+
+var A, B: [1..n] real;
+var M: [1..n, 1..n] int;
+
+forall i in 1..n do
+  A(i) = i;
+
+forall (a, b) in zip(A, B) do
+  b = 2 * a;
+
+forall (i, j) in M.domain do
+  M(i, j) = i * j;
+
+forall m in M do
+  m += 1;
+
+for i in 1..n do
+  A(i) += 1;
+
+forall (i, k) in zip(1..n, running(n)) do
+  B(i) = k;
+
+writeln(+ reduce B);
+writeln(A);
+writeln(M(n, n));
+writeln(B);
+
+iter running(n: int) {
+  for i in 1..n do yield i;
+}
+
+iter running(param tag: iterKind, n: int) where tag == iterKind.leader {
+  yield (0..n-1,);
+}
+
+iter running(param tag: iterKind, n: int, followThis)
+  where tag == iterKind.follower {
+  var k = followThis(1).low + 1;
+
+  for i in followThis(1) {
+    yield k;
+    k += 1;
+  }
+}
@@ -0,0 +1,54 @@
+// The tasks of a coforall are added to its end count in one step
+// after they have all been created.  Make sure the join still waits
+// for every task (including ones that finish before the count is
+// added), and that the running task count is back where it started
+// afterwards.
+
+config const n = 10000;
+
+const before = here.runningTasks();
+
+var count: atomic int;
+coforall i in 1..n do
+  count.add(i);
+writeln(count.read() == n*(n+1)/2);
+
+// tasks that finish long before the others have been created
+count.write(0);
+coforall i in 1..n {
+  if i > 1 then count.add(1);
+  else count.waitFor(n-1);
+}
+writeln(count.read());
+
+// nested task functions capture records by value, so count through
+// a class from here on
+class Counter {
+  var c: atomic int;
+}
+const counter = new Counter();
+
+// coforall + on
+coforall loc in Locales do on loc do
+  coforall i in 1..100 do counter.c.add(1);
+writeln(counter.c.read() == 100 * numLocales);
+
+// cobegin
+count.write(0);
+cobegin {
+  count.add(1);
+  count.add(2);
+  count.add(3);
+}
+writeln(count.read());
+
+// nested
+counter.c.write(0);
+coforall i in 1..10 do
+  coforall j in 1..10 do
+    counter.c.add(1);
+writeln(counter.c.read());
+
+delete counter;
+
+writeln(here.runningTasks() == before);
@@ -0,0 +1,33 @@
+// Several producers and consumers handing values through one sync
+// variable, so tasks sleep waiting for both full and empty at once,
+// and a crowd of readers waiting on one single variable.
+
+config const numProducers = 4,
+             numConsumers = 3,
+             perProducer = 5000;
+
+var s$: sync int;
+var received: atomic int;
+var sum: atomic int;
+const total = numProducers * perProducer;
+
+coforall t in 1..numProducers+numConsumers {
+  if t <= numProducers {
+    for i in 1..perProducer do
+      s$ = i;
+  } else {
+    // stop once every value has been claimed
+    while received.fetchAdd(1) < total do
+      sum.add(s$);
+  }
+}
+writeln(sum.read() == numProducers * perProducer * (perProducer+1) / 2);
+writeln(s$.isFull);
+
+var go$: single bool;
+var seen: atomic int;
+coforall r in 0..8 {
+  if r == 0 then go$ = true;
+  else if go$ then seen.add(1);
+}
+writeln(seen.read());
@@ -0,0 +1,54 @@
+// Spawn many coforall, begin, and on bodies, so that their argument
+// bundles get recycled through the runtime's per-thread pool, and
+// make sure every task sees its own arguments.  The second run turns
+// on memory tracking, which bypasses the pool.
+
+config const rounds = 20,
+             tasksPerRound = 50;
+
+var small, large, onSmall, onLarge: atomic int;
+
+proc smallBundles(r: int) {
+  coforall t in 1..tasksPerRound do
+    small.add(r + t);
+}
+
+proc largeBundles(r: int) {
+  var big: 48*int;
+  for i in 1..48 do big(i) = r * i;
+  coforall t in 1..tasksPerRound {
+    var sum = 0;
+    for i in 1..48 do sum += big(i);
+    large.add(sum + t);
+  }
+}
+
+proc onBundles(r: int) {
+  var big: 48*int;
+  for i in 1..48 do big(i) = i;
+  sync {
+    for t in 1..tasksPerRound {
+      on here do onSmall.add(r + t);
+      begin on here do onLarge.add(big(48) + t);
+    }
+  }
+}
+
+proc expected(perTask: int) {
+  var total = 0;
+  for r in 1..rounds do
+    for t in 1..tasksPerRound do
+      total += perTask * r + t;
+  return total;
+}
+
+for r in 1..rounds {
+  smallBundles(r);
+  largeBundles(r);
+  onBundles(r);
+}
+
+writeln(small.read() == expected(1));
+writeln(large.read() == expected(48*49/2));
+writeln(onSmall.read() == expected(1));
+writeln(onLarge.read() == rounds * (tasksPerRound * 48 + tasksPerRound * (tasksPerRound + 1) / 2));
@@ -0,0 +1,57 @@
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "poolCrossThread.h"
+
+// from the runtime's chpl-mem.h
+void* chpl_mem_allocPooled(size_t size, int16_t description,
+                           int32_t lineno, const char* filename);
+void chpl_mem_freePooled(void* memAlloc, int32_t lineno, const char* filename);
+
+typedef struct {
+  void** blocks;
+  int64_t n;
+} freeArgs_t;
+
+static void* freeAll(void* arg) {
+  freeArgs_t* args = (freeArgs_t*) arg;
+  int64_t i;
+  for (i = 0; i < args->n; i++)
+    chpl_mem_freePooled(args->blocks[i], 0, 0);
+  return NULL;
+}
+
+//
+// Allocate n pooled blocks on this thread, free them on another one,
+// and return how many of them this thread gets back when it allocates
+// again.  Allocate extra blocks the second time so that any blocks
+// this thread already had cached don't hide the ones freed remotely.
+//
+int64_t poolReusedAcrossThreads(int64_t n, int64_t size) {
+  int64_t extra = 100, reused = 0, i, j;
+  void** first = malloc(n * sizeof(void*));
+  void** again = malloc((n + extra) * sizeof(void*));
+  freeArgs_t args;
+  pthread_t thread;
+
+  for (i = 0; i < n; i++)
+    first[i] = chpl_mem_allocPooled(size, 0, 0, 0);
+
+  args.blocks = first;
+  args.n = n;
+  pthread_create(&thread, NULL, freeAll, &args);
+  pthread_join(thread, NULL);
+
+  for (i = 0; i < n + extra; i++) {
+    again[i] = chpl_mem_allocPooled(size, 0, 0, 0);
+    for (j = 0; j < n; j++)
+      if (again[i] == first[j])
+        reused++;
+  }
+  for (i = 0; i < n + extra; i++)
+    chpl_mem_freePooled(again[i], 0, 0);
+
+  free(first);
+  free(again);
+  return reused;
+}
@@ -0,0 +1,8 @@
+// Pooled blocks freed by another thread, as task argument bundles are
+// freed by the thread that runs the task, go back to the allocating
+// thread's pool and are handed out again there.
+
+extern proc poolReusedAcrossThreads(n: int, size: int): int;
+
+for size in (16, 100, 250) do
+  writeln(size, ": ", poolReusedAcrossThreads(50, size));
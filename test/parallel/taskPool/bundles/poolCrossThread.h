@@ -0,0 +1,2 @@
+#include <stdint.h>
+int64_t poolReusedAcrossThreads(int64_t n, int64_t size);
@@ -0,0 +1,461 @@
+/* Atomics.chpl:52 */
+static void chpl__init_Atomics(int64_t _ln, c_string _fn) {
+  c_string modFormatStr;
+  c_string modStr;
+  _ref_int32_t refIndentLevel = NULL;
+  if (chpl__init_Atomics_p) {
+    goto _exit_chpl__init_Atomics;
+  }
+  modFormatStr = "%*s\n";
+  modStr = "Atomics";
+  printModuleInit(modFormatStr, modStr, INT64(7), _ln, _fn);
+  refIndentLevel = &moduleInitLevel;
+  *(refIndentLevel) += INT64(1);
+  chpl__init_Atomics_p = true;
+  {
+    chpl__init_MemConsistency(_ln, _fn);
+  }
+  *(refIndentLevel) -= INT64(1);
+  _exit_chpl__init_Atomics:;
+  return;
+}
+
+/* Atomics.chpl:247 */
+static void atomic_fence(memory_order order, int64_t _ln, c_string _fn) {
+  atomic_thread_fence(order);
+  chpl_rmem_consist_fence(order, _ln, _fn);
+  return;
+}
+
+/* Atomics.chpl:280 */
+static atomicflag _construct_atomicflag(atomic_flag _v, atomicflag* const meme, int64_t _ln, c_string _fn) {
+  atomicflag this6;
+  this6 = *(meme);
+  (&this6)->_v = _v;
+  return this6;
+}
+
+/* Atomics.chpl:314 */
+static void _local_on_fn(chpl____wide__ref_atomicflag* const this6, memory_order order, chpl____wide__ref_chpl_bool* const ret, int64_t _ln, c_string _fn) {
+  _ref_atomic_flag call_tmp = NULL;
+  _ref_atomicflag local_this = NULL;
+  chpl_bool call_tmp2;
+  _ref_atomic_flag T = NULL;
+  _ref_chpl_bool local_ret = NULL;
+  chpl_check_local(chpl_nodeFromLocaleID(&((this6)->locale), INT64(0), NULL), _ln, _fn, "cannot access remote data in local block");
+  local_this = (this6)->addr;
+  chpl_check_nil(local_this, INT64(314), "/root/repo/modules/internal/Atomics.chpl");
+  call_tmp = &((local_this)->_v);
+  T = call_tmp;
+  call_tmp2 = atomic_flag_test_and_set_explicit(T, order);
+  call_tmp = T;
+  chpl_check_local(chpl_nodeFromLocaleID(&((ret)->locale), INT64(0), NULL), _ln, _fn, "cannot access remote data in local block");
+  local_ret = (ret)->addr;
+  *(local_ret) = call_tmp2;
+  return;
+}
+
+/* Atomics.chpl:314 */
+static void on_fn(chpl____wide__ref_atomicflag* const this6, memory_order order, chpl____wide__ref_chpl_bool* const ret, int64_t _ln, c_string _fn) {
+  chpl____wide__ref_atomic_flag call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp2;
+  _ref_atomic_flag T = NULL;
+  chpl____wide__ref_atomic_flag chpl_macro_tmp_43;
+  chpl____wide__ref_atomic_flag chpl_macro_tmp_44;
+  chpl_macro_tmp_43.locale = (*(this6)).locale;
+  chpl_macro_tmp_43.addr = &(((*(this6)).addr)->_v);
+  call_tmp = chpl_macro_tmp_43;
+  T = (&call_tmp)->addr;
+  call_tmp2 = atomic_flag_test_and_set_explicit(T, order);
+  chpl_macro_tmp_44.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_44.addr = T;
+  call_tmp = chpl_macro_tmp_44;
+  chpl_gen_comm_put(((void*)(&call_tmp2)), chpl_nodeFromLocaleID(&((*(ret)).locale), INT64(0), NULL), (*(ret)).addr, sizeof(chpl_bool), -1, INT64(1), INT64(314), "/root/repo/modules/internal/Atomics.chpl");
+  return;
+}
+
+/* Atomics.chpl:314 */
+static void _local_wrapon_fn(_class_localson_fn c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_atomicflag _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order _2_order;
+  chpl____wide__ref_chpl_bool _3__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln2;
+  _fn = (c)->_fn2;
+  chpl_check_nil(c, INT64(314), "/root/repo/modules/internal/Atomics.chpl");
+  _1_this = (c)->_1_this;
+  chpl_check_nil(c, INT64(314), "/root/repo/modules/internal/Atomics.chpl");
+  _2_order = (c)->_2_order;
+  chpl_check_nil(c, INT64(314), "/root/repo/modules/internal/Atomics.chpl");
+  _3__tmp = (c)->_3__tmp;
+  _local_on_fn(&_1_this, _2_order, &_3__tmp, _ln, _fn);
+  return;
+}
+
+/* Atomics.chpl:314 */
+static void wrapon_fn(_class_localson_fn c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_atomicflag _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order _2_order;
+  chpl____wide__ref_chpl_bool _3__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(314), "/root/repo/modules/internal/Atomics.chpl");
+  _1_this = (c)->_1_this;
+  chpl_check_nil(c, INT64(314), "/root/repo/modules/internal/Atomics.chpl");
+  _2_order = (c)->_2_order;
+  chpl_check_nil(c, INT64(314), "/root/repo/modules/internal/Atomics.chpl");
+  _3__tmp = (c)->_3__tmp;
+  on_fn(&_1_this, _2_order, &_3__tmp, _ln, _fn);
+  return;
+}
+
+/* Atomics.chpl:318 */
+static void _local_on_fn2(chpl____wide__ref_atomicflag* const this6, memory_order order, int64_t _ln, c_string _fn) {
+  _ref_atomic_flag call_tmp = NULL;
+  _ref_atomicflag local_this = NULL;
+  _ref_atomic_flag T = NULL;
+  chpl_check_local(chpl_nodeFromLocaleID(&((this6)->locale), INT64(0), NULL), _ln, _fn, "cannot access remote data in local block");
+  local_this = (this6)->addr;
+  chpl_check_nil(local_this, INT64(318), "/root/repo/modules/internal/Atomics.chpl");
+  call_tmp = &((local_this)->_v);
+  T = call_tmp;
+  atomic_flag_clear_explicit(T, order);
+  call_tmp = T;
+  return;
+}
+
+/* Atomics.chpl:318 */
+static void on_fn2(chpl____wide__ref_atomicflag* const this6, memory_order order, int64_t _ln, c_string _fn) {
+  chpl____wide__ref_atomic_flag call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_flag T = NULL;
+  chpl____wide__ref_atomic_flag chpl_macro_tmp_45;
+  chpl____wide__ref_atomic_flag chpl_macro_tmp_46;
+  chpl_macro_tmp_45.locale = (*(this6)).locale;
+  chpl_macro_tmp_45.addr = &(((*(this6)).addr)->_v);
+  call_tmp = chpl_macro_tmp_45;
+  T = (&call_tmp)->addr;
+  atomic_flag_clear_explicit(T, order);
+  chpl_macro_tmp_46.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_46.addr = T;
+  call_tmp = chpl_macro_tmp_46;
+  return;
+}
+
+/* Atomics.chpl:318 */
+static void _local_wrapon_fn2(_class_localson_fn2 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_atomicflag _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order _2_order;
+  _ln = (c)->_ln2;
+  _fn = (c)->_fn2;
+  chpl_check_nil(c, INT64(318), "/root/repo/modules/internal/Atomics.chpl");
+  _1_this = (c)->_1_this;
+  chpl_check_nil(c, INT64(318), "/root/repo/modules/internal/Atomics.chpl");
+  _2_order = (c)->_2_order;
+  _local_on_fn2(&_1_this, _2_order, _ln, _fn);
+  return;
+}
+
+/* Atomics.chpl:318 */
+static void wrapon_fn2(_class_localson_fn2 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_atomicflag _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order _2_order;
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(318), "/root/repo/modules/internal/Atomics.chpl");
+  _1_this = (c)->_1_this;
+  chpl_check_nil(c, INT64(318), "/root/repo/modules/internal/Atomics.chpl");
+  _2_order = (c)->_2_order;
+  on_fn2(&_1_this, _2_order, _ln, _fn);
+  return;
+}
+
+/* Atomics.chpl:322 */
+static void on_fn3(chpl____wide__ref_atomicflag* const this6, chpl_bool val, memory_order order, int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_relaxed;
+  chpl_bool T;
+  chpl____wide__ref_atomic_flag call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp2;
+  _ref_atomic_flag T2 = NULL;
+  chpl_bool call_tmp3;
+  chpl____wide__ref_atomic_flag call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp5;
+  _ref_atomic_flag T3 = NULL;
+  chpl_bool call_tmp6;
+  chpl____wide__ref_atomic_flag chpl_macro_tmp_47;
+  chpl____wide__ref_atomic_flag chpl_macro_tmp_48;
+  chpl____wide__ref_atomic_flag chpl_macro_tmp_49;
+  chpl____wide__ref_atomic_flag chpl_macro_tmp_50;
+  local_memory_order_relaxed = memory_order_relaxed;
+  chpl_macro_tmp_47.locale = (*(this6)).locale;
+  chpl_macro_tmp_47.addr = &(((*(this6)).addr)->_v);
+  call_tmp = chpl_macro_tmp_47;
+  T2 = (&call_tmp)->addr;
+  call_tmp2 = atomic_load_explicit_flag(T2, local_memory_order_relaxed);
+  chpl_macro_tmp_48.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_48.addr = T2;
+  call_tmp = chpl_macro_tmp_48;
+  call_tmp3 = (call_tmp2 != val);
+  T = call_tmp3;
+  while (T) {
+    chpl_task_yield();
+    chpl_macro_tmp_49.locale = (*(this6)).locale;
+    chpl_macro_tmp_49.addr = &(((*(this6)).addr)->_v);
+    call_tmp4 = chpl_macro_tmp_49;
+    T3 = (&call_tmp4)->addr;
+    call_tmp5 = atomic_load_explicit_flag(T3, local_memory_order_relaxed);
+    chpl_macro_tmp_50.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_50.addr = T3;
+    call_tmp4 = chpl_macro_tmp_50;
+    call_tmp6 = (call_tmp5 != val);
+    T = call_tmp6;
+  }
+  atomic_thread_fence(order);
+  return;
+}
+
+/* Atomics.chpl:322 */
+static void wrapon_fn3(_class_localson_fn3 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_atomicflag _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool _2_val;
+  memory_order _3_order;
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(322), "/root/repo/modules/internal/Atomics.chpl");
+  _1_this = (c)->_1_this;
+  chpl_check_nil(c, INT64(322), "/root/repo/modules/internal/Atomics.chpl");
+  _2_val = (c)->_2_val;
+  chpl_check_nil(c, INT64(322), "/root/repo/modules/internal/Atomics.chpl");
+  _3_order = (c)->_3_order;
+  on_fn3(&_1_this, _2_val, _3_order, _ln, _fn);
+  return;
+}
+
+/* Atomics.chpl:1066 */
+static atomic_int64 _construct_atomic_int64(atomic_int_least64_t _v, atomic_int64* const meme, int64_t _ln, c_string _fn) {
+  atomic_int64 this6;
+  this6 = *(meme);
+  (&this6)->_v = _v;
+  return this6;
+}
+
+/* Atomics.chpl:1077 */
+static void on_fn4(chpl____wide__ref_atomic_int64* const this6, int64_t value, memory_order order, int64_t _ln, c_string _fn) {
+  chpl____wide__ref_atomic_int_least64_t call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_int_least64_t T = NULL;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_51;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_52;
+  chpl_macro_tmp_51.locale = (*(this6)).locale;
+  chpl_macro_tmp_51.addr = &(((*(this6)).addr)->_v);
+  call_tmp = chpl_macro_tmp_51;
+  T = (&call_tmp)->addr;
+  atomic_store_explicit_int_least64_t(T, value, order);
+  chpl_macro_tmp_52.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_52.addr = T;
+  call_tmp = chpl_macro_tmp_52;
+  return;
+}
+
+/* Atomics.chpl:1077 */
+static void wrapon_fn4(_class_localson_fn4 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_atomic_int64 _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t _2_value;
+  memory_order _3_order;
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(1077), "/root/repo/modules/internal/Atomics.chpl");
+  _1_this = (c)->_1_this;
+  chpl_check_nil(c, INT64(1077), "/root/repo/modules/internal/Atomics.chpl");
+  _2_value = (c)->_2_value;
+  chpl_check_nil(c, INT64(1077), "/root/repo/modules/internal/Atomics.chpl");
+  _3_order = (c)->_3_order;
+  on_fn4(&_1_this, _2_value, _3_order, _ln, _fn);
+  return;
+}
+
+/* Atomics.chpl:1103 */
+static void on_fn5(chpl____wide__ref_atomic_int64* const this6, int64_t value, memory_order order, int64_t _ln, c_string _fn) {
+  chpl____wide__ref_atomic_int_least64_t call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_int_least64_t T = NULL;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_53;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_54;
+  chpl_macro_tmp_53.locale = (*(this6)).locale;
+  chpl_macro_tmp_53.addr = &(((*(this6)).addr)->_v);
+  call_tmp = chpl_macro_tmp_53;
+  T = (&call_tmp)->addr;
+  atomic_fetch_add_explicit_int_least64_t(T, value, order);
+  chpl_macro_tmp_54.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_54.addr = T;
+  call_tmp = chpl_macro_tmp_54;
+  return;
+}
+
+/* Atomics.chpl:1103 */
+static void wrapon_fn5(_class_localson_fn5 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_atomic_int64 _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t _2_value;
+  memory_order _3_order;
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(1103), "/root/repo/modules/internal/Atomics.chpl");
+  _1_this = (c)->_1_this;
+  chpl_check_nil(c, INT64(1103), "/root/repo/modules/internal/Atomics.chpl");
+  _2_value = (c)->_2_value;
+  chpl_check_nil(c, INT64(1103), "/root/repo/modules/internal/Atomics.chpl");
+  _3_order = (c)->_3_order;
+  on_fn5(&_1_this, _2_value, _3_order, _ln, _fn);
+  return;
+}
+
+/* Atomics.chpl:1107 */
+static void on_fn6(chpl____wide__ref_atomic_int64* const this6, int64_t value, memory_order order, chpl____wide__ref_int64_t* const ret, int64_t _ln, c_string _fn) {
+  chpl____wide__ref_atomic_int_least64_t call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp2;
+  _ref_atomic_int_least64_t T = NULL;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_55;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_56;
+  chpl_macro_tmp_55.locale = (*(this6)).locale;
+  chpl_macro_tmp_55.addr = &(((*(this6)).addr)->_v);
+  call_tmp = chpl_macro_tmp_55;
+  T = (&call_tmp)->addr;
+  call_tmp2 = atomic_fetch_sub_explicit_int_least64_t(T, value, order);
+  chpl_macro_tmp_56.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_56.addr = T;
+  call_tmp = chpl_macro_tmp_56;
+  chpl_gen_comm_put(((void*)(&call_tmp2)), chpl_nodeFromLocaleID(&((*(ret)).locale), INT64(0), NULL), (*(ret)).addr, sizeof(int64_t), -1, INT64(1), INT64(1107), "/root/repo/modules/internal/Atomics.chpl");
+  return;
+}
+
+/* Atomics.chpl:1107 */
+static void wrapon_fn6(_class_localson_fn6 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_atomic_int64 _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t _2_value;
+  memory_order _3_order;
+  chpl____wide__ref_int64_t _4__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(1107), "/root/repo/modules/internal/Atomics.chpl");
+  _1_this = (c)->_1_this;
+  chpl_check_nil(c, INT64(1107), "/root/repo/modules/internal/Atomics.chpl");
+  _2_value = (c)->_2_value;
+  chpl_check_nil(c, INT64(1107), "/root/repo/modules/internal/Atomics.chpl");
+  _3_order = (c)->_3_order;
+  chpl_check_nil(c, INT64(1107), "/root/repo/modules/internal/Atomics.chpl");
+  _4__tmp = (c)->_4__tmp;
+  on_fn6(&_1_this, _2_value, _3_order, &_4__tmp, _ln, _fn);
+  return;
+}
+
+/* Atomics.chpl:1111 */
+static void on_fn7(chpl____wide__ref_atomic_int64* const this6, int64_t value, memory_order order, int64_t _ln, c_string _fn) {
+  chpl____wide__ref_atomic_int_least64_t call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_int_least64_t T = NULL;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_57;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_58;
+  chpl_macro_tmp_57.locale = (*(this6)).locale;
+  chpl_macro_tmp_57.addr = &(((*(this6)).addr)->_v);
+  call_tmp = chpl_macro_tmp_57;
+  T = (&call_tmp)->addr;
+  atomic_fetch_sub_explicit_int_least64_t(T, value, order);
+  chpl_macro_tmp_58.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_58.addr = T;
+  call_tmp = chpl_macro_tmp_58;
+  return;
+}
+
+/* Atomics.chpl:1111 */
+static void wrapon_fn7(_class_localson_fn7 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_atomic_int64 _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t _2_value;
+  memory_order _3_order;
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(1111), "/root/repo/modules/internal/Atomics.chpl");
+  _1_this = (c)->_1_this;
+  chpl_check_nil(c, INT64(1111), "/root/repo/modules/internal/Atomics.chpl");
+  _2_value = (c)->_2_value;
+  chpl_check_nil(c, INT64(1111), "/root/repo/modules/internal/Atomics.chpl");
+  _3_order = (c)->_3_order;
+  on_fn7(&_1_this, _2_value, _3_order, _ln, _fn);
+  return;
+}
+
+/* Atomics.chpl:1139 */
+static void on_fn8(chpl____wide__ref_atomic_int64* const this6, int64_t val, memory_order order, int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_relaxed;
+  chpl_bool T;
+  chpl____wide__ref_atomic_int_least64_t call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp2;
+  _ref_atomic_int_least64_t T2 = NULL;
+  chpl_bool call_tmp3;
+  chpl____wide__ref_atomic_int_least64_t call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp5;
+  _ref_atomic_int_least64_t T3 = NULL;
+  chpl_bool call_tmp6;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_59;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_60;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_61;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_62;
+  local_memory_order_relaxed = memory_order_relaxed;
+  chpl_macro_tmp_59.locale = (*(this6)).locale;
+  chpl_macro_tmp_59.addr = &(((*(this6)).addr)->_v);
+  call_tmp = chpl_macro_tmp_59;
+  T2 = (&call_tmp)->addr;
+  call_tmp2 = atomic_load_explicit_int_least64_t(T2, local_memory_order_relaxed);
+  chpl_macro_tmp_60.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_60.addr = T2;
+  call_tmp = chpl_macro_tmp_60;
+  call_tmp3 = (call_tmp2 != val);
+  T = call_tmp3;
+  while (T) {
+    chpl_task_yield();
+    chpl_macro_tmp_61.locale = (*(this6)).locale;
+    chpl_macro_tmp_61.addr = &(((*(this6)).addr)->_v);
+    call_tmp4 = chpl_macro_tmp_61;
+    T3 = (&call_tmp4)->addr;
+    call_tmp5 = atomic_load_explicit_int_least64_t(T3, local_memory_order_relaxed);
+    chpl_macro_tmp_62.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_62.addr = T3;
+    call_tmp4 = chpl_macro_tmp_62;
+    call_tmp6 = (call_tmp5 != val);
+    T = call_tmp6;
+  }
+  atomic_thread_fence(order);
+  return;
+}
+
+/* Atomics.chpl:1139 */
+static void wrapon_fn8(_class_localson_fn8 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_atomic_int64 _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t _2_val;
+  memory_order _3_order;
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(1139), "/root/repo/modules/internal/Atomics.chpl");
+  _1_this = (c)->_1_this;
+  chpl_check_nil(c, INT64(1139), "/root/repo/modules/internal/Atomics.chpl");
+  _2_val = (c)->_2_val;
+  chpl_check_nil(c, INT64(1139), "/root/repo/modules/internal/Atomics.chpl");
+  _3_order = (c)->_3_order;
+  on_fn8(&_1_this, _2_val, _3_order, _ln, _fn);
+  return;
+}
+
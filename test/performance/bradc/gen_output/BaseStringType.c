@@ -0,0 +1,22 @@
+/* NewString.chpl:72 */
+static void chpl__init_BaseStringType(int64_t _ln, c_string _fn) {
+  c_string modFormatStr;
+  c_string modStr;
+  _ref_int32_t refIndentLevel = NULL;
+  if (chpl__init_BaseStringType_p) {
+    goto _exit_chpl__init_BaseStringType;
+  }
+  modFormatStr = "%*s\n";
+  modStr = "BaseStringType";
+  printModuleInit(modFormatStr, modStr, INT64(14), _ln, _fn);
+  refIndentLevel = &moduleInitLevel;
+  *(refIndentLevel) += INT64(1);
+  chpl__init_BaseStringType_p = true;
+  {
+    chpl__init_CString(_ln, _fn);
+  }
+  *(refIndentLevel) -= INT64(1);
+  _exit_chpl__init_BaseStringType:;
+  return;
+}
+
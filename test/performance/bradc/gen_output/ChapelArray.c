@@ -0,0 +1,1641 @@
+/* ChapelArray.chpl:23 */
+static void chpl__init_ChapelArray(int64_t _ln, c_string _fn) {
+  c_string modFormatStr;
+  c_string modStr;
+  _ref_int32_t refIndentLevel = NULL;
+  atomic_int64 this6;
+  atomic_int_least64_t ret;
+  atomic_int_least64_t type_tmp;
+  _ref_atomic_int_least64_t _ref_tmp_ = NULL;
+  _ref_atomic_int_least64_t T = NULL;
+  atomic_int64 wrap_call_tmp;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_381;
+  if (chpl__init_ChapelArray_p) {
+    goto _exit_chpl__init_ChapelArray;
+  }
+  modFormatStr = "%*s\n";
+  modStr = "ChapelArray";
+  printModuleInit(modFormatStr, modStr, INT64(11), _ln, _fn);
+  refIndentLevel = &moduleInitLevel;
+  *(refIndentLevel) += INT64(1);
+  chpl__init_ChapelArray_p = true;
+  {
+    chpl__init_ChapelBase(_ln, _fn);
+    chpl__init_ChapelTuple(_ln, _fn);
+    chpl__init_ChapelLocale(_ln, _fn);
+  }
+  ret = type_tmp;
+  _ref_tmp_ = &ret;
+  T = _ref_tmp_;
+  atomic_init_int_least64_t(T, INT64(0));
+  _ref_tmp_ = T;
+  (&this6)->_v = ret;
+  wrap_call_tmp = _construct_atomic_int64(ret, &this6, _ln, _fn);
+  chpl_check_nil((&numPrivateObjects)->addr, INT64(31), "/root/repo/modules/internal/ChapelArray.chpl");
+  chpl_macro_tmp_381.locale = (&numPrivateObjects)->locale;
+  chpl_macro_tmp_381.addr = &(((&numPrivateObjects)->addr)->value);
+  chpl_gen_comm_put(((void*)(&wrap_call_tmp)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_381).locale), INT64(0), NULL), (chpl_macro_tmp_381).addr, sizeof(atomic_int64), -1, INT64(1), INT64(31), "/root/repo/modules/internal/ChapelArray.chpl");
+  *(refIndentLevel) -= INT64(1);
+  _exit_chpl__init_ChapelArray:;
+  return;
+}
+
+/* ChapelArray.chpl:123 */
+static void _newArray(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const value, _ref_DefaultRectangularArr_locale_1_int64_t_F _retArg, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F this6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F wrap_call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__nilType chpl_macro_tmp_382;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F chpl_macro_tmp_383;
+  chpl_macro_tmp_382.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_382.addr = nil;
+  chpl_macro_tmp_383.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_383.addr = NULL;
+  this6 = chpl_macro_tmp_383;
+  this6 = *(value);
+  wrap_call_tmp = _construct__array(value, &this6, _ln, _fn);
+  *(_retArg) = chpl__autoCopy3(&wrap_call_tmp, _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:123 */
+static void _newArray2(chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const value, _ref_DefaultRectangularArr_localesSignal_1_int64_t_F _retArg, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F this6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F wrap_call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__nilType chpl_macro_tmp_384;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F chpl_macro_tmp_385;
+  chpl_macro_tmp_384.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_384.addr = nil;
+  chpl_macro_tmp_385.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_385.addr = NULL;
+  this6 = chpl_macro_tmp_385;
+  this6 = *(value);
+  wrap_call_tmp = _construct__array2(value, &this6, _ln, _fn);
+  *(_retArg) = chpl__autoCopy4(&wrap_call_tmp, _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:130 */
+static void _newDomain(DefaultRectangularDom_1_int64_t_F value, _ref_DefaultRectangularDom_1_int64_t_F _retArg, int64_t _ln, c_string _fn) {
+  DefaultRectangularDom_1_int64_t_F this6 = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F wrap_call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F T = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F T2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_386;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_387;
+  this6 = nil;
+  this6 = value;
+  chpl_macro_tmp_386.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_386.addr = this6;
+  T = chpl_macro_tmp_386;
+  chpl_macro_tmp_387.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_387.addr = value;
+  T2 = chpl_macro_tmp_387;
+  wrap_call_tmp = _construct__domain(&T2, &T, _ln, _fn);
+  *(_retArg) = chpl__autoCopy2(&wrap_call_tmp, _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:137 */
+static void _getDomain(chpl____wide_DefaultRectangularDom_1_int64_t_F* const value, _ref_DefaultRectangularDom_1_int64_t_F _retArg, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularDom_1_int64_t_F this6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F wrap_call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__nilType chpl_macro_tmp_388;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_389;
+  chpl_macro_tmp_388.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_388.addr = nil;
+  chpl_macro_tmp_389.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_389.addr = NULL;
+  this6 = chpl_macro_tmp_389;
+  this6 = *(value);
+  wrap_call_tmp = _construct__domain(value, &this6, _ln, _fn);
+  *(_retArg) = chpl__autoCopy2(&wrap_call_tmp, _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:144 */
+static void _newDistribution(chpl____wide_DefaultDist* const value, _ref_DefaultDist _retArg, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultDist call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  call_tmp = _distribution(value, _ln, _fn);
+  *(_retArg) = chpl__autoCopy(&call_tmp, _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:151 */
+static void _getDistribution(chpl____wide_DefaultDist* const value, _ref_DefaultDist _retArg, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultDist call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  call_tmp = _distribution(value, _ln, _fn);
+  *(_retArg) = chpl__autoCopy(&call_tmp, _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:163 */
+static void chpl__convertRuntimeTypeToValue(chpl____wide_DefaultDist* const d, _ref_DefaultRectangularDom_1_int64_t_F _retArg, int64_t _ln, c_string _fn) {
+  DefaultRectangularDom_1_int64_t_F call_tmp = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultRectangularDom_1_int64_t_F ret_to_arg_ref_tmp_ = NULL;
+  chpl_check_nil((d)->addr, INT64(166), "/root/repo/modules/internal/ChapelArray.chpl");
+  call_tmp = newRectangularDom(d, _ln, _fn);
+  ret_to_arg_ref_tmp_ = &call_tmp2;
+  _newDomain(call_tmp, ret_to_arg_ref_tmp_, _ln, _fn);
+  *(_retArg) = call_tmp2;
+  return;
+}
+
+/* ChapelArray.chpl:163 */
+static chpl___RuntimeTypeInfo chpl__buildDomainRuntimeType(chpl____wide_DefaultDist* const d, int64_t _ln, c_string _fn) {
+  chpl___RuntimeTypeInfo _return_tmp_;
+  (&_return_tmp_)->d = *(d);
+  return _return_tmp_;
+}
+
+/* ChapelArray.chpl:191 */
+static chpl___RuntimeTypeInfo chpl__convertValueToRuntimeType(chpl____wide_DefaultRectangularDom_1_int64_t_F* const dom, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultDist call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultDist ret_to_arg_ref_tmp_ = NULL;
+  chpl___RuntimeTypeInfo call_tmp2;
+  ret_to_arg_ref_tmp_ = &call_tmp;
+  chpl_check_nil((dom)->addr, INT64(193), "/root/repo/modules/internal/ChapelArray.chpl");
+  dist(dom, ret_to_arg_ref_tmp_, _ln, _fn);
+  call_tmp2 = chpl__buildDomainRuntimeType(&call_tmp, _ln, _fn);
+  chpl__autoDestroy(&call_tmp, _ln, _fn);
+  return call_tmp2;
+}
+
+/* ChapelArray.chpl:217 */
+static void chpl__convertRuntimeTypeToValue2(chpl____wide_DefaultRectangularDom_1_int64_t_F* const dom, _ref_DefaultRectangularArr_locale_1_int64_t_F _retArg, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultRectangularArr_locale_1_int64_t_F ret_to_arg_ref_tmp_ = NULL;
+  ret_to_arg_ref_tmp_ = &call_tmp;
+  chpl_check_nil((dom)->addr, INT64(218), "/root/repo/modules/internal/ChapelArray.chpl");
+  buildArray(dom, ret_to_arg_ref_tmp_, _ln, _fn);
+  *(_retArg) = call_tmp;
+  return;
+}
+
+/* ChapelArray.chpl:217 */
+static chpl___RuntimeTypeInfo2 chpl__buildArrayRuntimeType(chpl____wide_DefaultRectangularDom_1_int64_t_F* const dom, int64_t _ln, c_string _fn) {
+  chpl___RuntimeTypeInfo2 _return_tmp_;
+  (&_return_tmp_)->dom = *(dom);
+  return _return_tmp_;
+}
+
+/* ChapelArray.chpl:217 */
+static void chpl__convertRuntimeTypeToValue3(chpl____wide_DefaultRectangularDom_1_int64_t_F* const dom, _ref_DefaultRectangularArr_localesSignal_1_int64_t_F _retArg, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultRectangularArr_localesSignal_1_int64_t_F ret_to_arg_ref_tmp_ = NULL;
+  ret_to_arg_ref_tmp_ = &call_tmp;
+  chpl_check_nil((dom)->addr, INT64(218), "/root/repo/modules/internal/ChapelArray.chpl");
+  buildArray2(dom, ret_to_arg_ref_tmp_, _ln, _fn);
+  *(_retArg) = call_tmp;
+  return;
+}
+
+/* ChapelArray.chpl:217 */
+static chpl___RuntimeTypeInfo3 chpl__buildArrayRuntimeType2(chpl____wide_DefaultRectangularDom_1_int64_t_F* const dom, int64_t _ln, c_string _fn) {
+  chpl___RuntimeTypeInfo3 _return_tmp_;
+  (&_return_tmp_)->dom = *(dom);
+  return _return_tmp_;
+}
+
+/* ChapelArray.chpl:334 */
+static void chpl_incRefCountsForDomainsInArrayEltTypes(void) {
+  compilerAssert();
+  return;
+}
+
+/* ChapelArray.chpl:334 */
+static void chpl_incRefCountsForDomainsInArrayEltTypes2(void) {
+  compilerAssert();
+  return;
+}
+
+/* ChapelArray.chpl:355 */
+static void chpl_decRefCountsForDomainsInArrayEltTypes(void) {
+  compilerAssert();
+  return;
+}
+
+/* ChapelArray.chpl:355 */
+static void chpl_decRefCountsForDomainsInArrayEltTypes2(void) {
+  compilerAssert();
+  return;
+}
+
+/* ChapelArray.chpl:379 */
+static void chpl__buildDomainExpr(range_int64_t_bounded_F* const _e0_ranges, _ref_DefaultRectangularDom_1_int64_t_F _retArg, int64_t _ln, c_string _fn) {
+  _tuple_1_star_range_int64_t_bounded_F ranges;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F d = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F type_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl___RuntimeTypeInfo call_tmp;
+  chpl____wide_DefaultDist _runtime_type_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultRectangularDom_1_int64_t_F ret_to_arg_ref_tmp_ = NULL;
+  *(ranges + INT64(0)) = *(_e0_ranges);
+  call_tmp = chpl__buildDomainRuntimeType(&defaultDist, _ln, _fn);
+  _runtime_type_tmp_ = (&call_tmp)->d;
+  ret_to_arg_ref_tmp_ = &type_tmp;
+  chpl__convertRuntimeTypeToValue(&_runtime_type_tmp_, ret_to_arg_ref_tmp_, _ln, _fn);
+  d = type_tmp;
+  chpl_check_nil((&type_tmp)->addr, INT64(387), "/root/repo/modules/internal/ChapelArray.chpl");
+  setIndices(&type_tmp, &ranges, _ln, _fn);
+  *(_retArg) = d;
+  return;
+}
+
+/* ChapelArray.chpl:416 */
+static void chpl__ensureDomainExpr(chpl____wide_DefaultRectangularDom_1_int64_t_F* const x2, _ref_DefaultRectangularDom_1_int64_t_F _retArg, int64_t _ln, c_string _fn) {
+  *(_retArg) = chpl__autoCopy2(x2, _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:420 */
+static void chpl__ensureDomainExpr2(range_int64_t_bounded_F* const _e0_x, _ref_DefaultRectangularDom_1_int64_t_F _retArg, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularDom_1_int64_t_F call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultRectangularDom_1_int64_t_F ret_to_arg_ref_tmp_ = NULL;
+  ret_to_arg_ref_tmp_ = &call_tmp;
+  chpl__buildDomainExpr(_e0_x, ret_to_arg_ref_tmp_, _ln, _fn);
+  *(_retArg) = call_tmp;
+  return;
+}
+
+/* ChapelArray.chpl:553 */
+static void chpl__buildDistValue(DefaultDist x2, _ref_DefaultDist _retArg, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultDist call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultDist ret_to_arg_ref_tmp_ = NULL;
+  chpl____wide_DefaultDist T = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultDist chpl_macro_tmp_390;
+  ret_to_arg_ref_tmp_ = &call_tmp;
+  chpl_macro_tmp_390.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_390.addr = x2;
+  T = chpl_macro_tmp_390;
+  _newDistribution(&T, ret_to_arg_ref_tmp_, _ln, _fn);
+  *(_retArg) = chpl__initCopy(&call_tmp, _ln, _fn);
+  chpl__autoDestroy(&call_tmp, _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:553 */
+static void chpl__buildDistValue2(DefaultDist x2, _ref_DefaultDist _retArg, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultDist call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultDist ret_to_arg_ref_tmp_ = NULL;
+  chpl____wide_DefaultDist T = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultDist chpl_macro_tmp_391;
+  ret_to_arg_ref_tmp_ = &call_tmp;
+  chpl_macro_tmp_391.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_391.addr = x2;
+  T = chpl_macro_tmp_391;
+  _newDistribution(&T, ret_to_arg_ref_tmp_, _ln, _fn);
+  *(_retArg) = call_tmp;
+  return;
+}
+
+/* ChapelArray.chpl:566 */
+static chpl____wide_DefaultDist _construct__distribution(chpl____wide_DefaultDist* const _value, chpl____wide_DefaultDist* const meme, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultDist this6 = {CHPL_LOCALEID_T_INIT, NULL};
+  this6 = *(meme);
+  this6 = *(_value);
+  return this6;
+}
+
+/* ChapelArray.chpl:570 */
+static chpl____wide_DefaultDist _distribution(chpl____wide_DefaultDist* const _value, int64_t _ln, c_string _fn) {
+  DefaultDist this6 = NULL;
+  chpl____wide_DefaultDist this7 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultDist wrap_call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__nilType chpl_macro_tmp_392;
+  chpl____wide_DefaultDist chpl_macro_tmp_393;
+  chpl_macro_tmp_392.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_392.addr = nil;
+  chpl_macro_tmp_393.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_393.addr = NULL;
+  this7 = chpl_macro_tmp_393;
+  this7 = *(_value);
+  wrap_call_tmp = _construct__distribution(_value, &this7, _ln, _fn);
+  return wrap_call_tmp;
+}
+
+/* ChapelArray.chpl:580 */
+static void chpl___TILDE__distribution(chpl____wide_DefaultDist* const this6, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultDist ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp;
+  _class_localson_fn9 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  ret = *(this6);
+  call_tmp = (&ret)->locale;
+  _args_size = sizeof(chpl__class_localson_fn9_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn9)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(583), "/root/repo/modules/internal/ChapelArray.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp;
+  chpl_check_nil(_args_foron_fn, INT64(583), "/root/repo/modules/internal/ChapelArray.chpl");
+  (_args_foron_fn)->_1_this = *(this6);
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn9 ***/ chpl_executeOn(&call_tmp, INT32(10), _args_foron_fn, sizeof(chpl__class_localson_fn9_object), INT64(583), "/root/repo/modules/internal/ChapelArray.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:583 */
+static void on_fn9(chpl____wide_DefaultDist* const this6, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultDist ret = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp;
+  chpl____wide_BaseDist call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp3;
+  chpl____wide_DefaultDist ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDist call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultDist ret3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDist _parent_destructor_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomicflag _field_destructor_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_flag call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_flag T = NULL;
+  chpl____wide__ref_atomic_refcnt _field_destructor_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 _field_destructor_tmp_3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int_least64_t call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_int_least64_t T2 = NULL;
+  chpl_localeID_t call_tmp7;
+  chpl____wide_DefaultDist rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn10 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide_BaseDist chpl_macro_tmp_394;
+  chpl____wide_BaseDist chpl_macro_tmp_395;
+  chpl____wide_BaseDist chpl_macro_tmp_396;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_397;
+  chpl____wide__ref_atomic_flag chpl_macro_tmp_398;
+  chpl____wide__ref_atomic_flag chpl_macro_tmp_399;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_400;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_401;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_402;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_403;
+  ret = *(this6);
+  chpl_macro_tmp_394.locale = (&ret)->locale;
+  chpl_macro_tmp_394.addr = ((BaseDist)((&ret)->addr));
+  call_tmp2 = chpl_macro_tmp_394;
+  chpl_check_nil((&call_tmp2)->addr, INT64(584), "/root/repo/modules/internal/ChapelArray.chpl");
+  call_tmp = destroyDist(&call_tmp2, _ln, _fn);
+  call_tmp3 = (call_tmp == INT64(0));
+  if (call_tmp3) {
+    ret2 = *(this6);
+    chpl_macro_tmp_395.locale = (&ret2)->locale;
+    chpl_macro_tmp_395.addr = ((BaseDist)((&ret2)->addr));
+    call_tmp4 = chpl_macro_tmp_395;
+    chpl_check_nil((&call_tmp4)->addr, INT64(586), "/root/repo/modules/internal/ChapelArray.chpl");
+    dsiDestroyDistClass(&call_tmp4);
+    ret3 = *(this6);
+    chpl_macro_tmp_396.locale = (&ret3)->locale;
+    chpl_macro_tmp_396.addr = ((BaseDist)((&ret3)->addr));
+    _parent_destructor_tmp_ = chpl_macro_tmp_396;
+    chpl_check_nil((&_parent_destructor_tmp_)->addr, INT64(587), "/root/repo/modules/internal/ChapelArray.chpl");
+    chpl_macro_tmp_397.locale = (&_parent_destructor_tmp_)->locale;
+    chpl_macro_tmp_397.addr = &(((&_parent_destructor_tmp_)->addr)->_domsLock);
+    _field_destructor_tmp_ = chpl_macro_tmp_397;
+    chpl_macro_tmp_398.locale = (_field_destructor_tmp_).locale;
+    chpl_macro_tmp_398.addr = &(((_field_destructor_tmp_).addr)->_v);
+    call_tmp5 = chpl_macro_tmp_398;
+    T = (&call_tmp5)->addr;
+    atomic_destroy_flag(T);
+    chpl_macro_tmp_399.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_399.addr = T;
+    call_tmp5 = chpl_macro_tmp_399;
+    chpl_check_nil((&_parent_destructor_tmp_)->addr, INT64(587), "/root/repo/modules/internal/ChapelArray.chpl");
+    chpl_macro_tmp_400.locale = (&_parent_destructor_tmp_)->locale;
+    chpl_macro_tmp_400.addr = &(((&_parent_destructor_tmp_)->addr)->_distCnt);
+    _field_destructor_tmp_2 = chpl_macro_tmp_400;
+    chpl_macro_tmp_401.locale = (_field_destructor_tmp_2).locale;
+    chpl_macro_tmp_401.addr = &(((_field_destructor_tmp_2).addr)->_cnt);
+    _field_destructor_tmp_3 = chpl_macro_tmp_401;
+    chpl_macro_tmp_402.locale = (_field_destructor_tmp_3).locale;
+    chpl_macro_tmp_402.addr = &(((_field_destructor_tmp_3).addr)->_v);
+    call_tmp6 = chpl_macro_tmp_402;
+    T2 = (&call_tmp6)->addr;
+    atomic_destroy_int_least64_t(T2);
+    chpl_macro_tmp_403.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_403.addr = T2;
+    call_tmp6 = chpl_macro_tmp_403;
+    call_tmp7 = (&ret3)->locale;
+    rvfDerefTmp = ret3;
+    _args_size = sizeof(chpl__class_localson_fn10_object);
+    _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn = ((_class_localson_fn10)(_args_alloc));
+    chpl_check_nil(_args_foron_fn, INT64(587), "/root/repo/modules/internal/ChapelArray.chpl");
+    (_args_foron_fn)->_0__tmp = call_tmp7;
+    chpl_check_nil(_args_foron_fn, INT64(587), "/root/repo/modules/internal/ChapelArray.chpl");
+    (_args_foron_fn)->_1_rvfDerefTmp = rvfDerefTmp;
+    (_args_foron_fn)->_ln = _ln;
+    (_args_foron_fn)->_fn = _fn;
+    /*** wrapon_fn10 ***/ chpl_executeOn(&call_tmp7, INT32(11), _args_foron_fn, sizeof(chpl__class_localson_fn10_object), INT64(587), "/root/repo/modules/internal/ChapelArray.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  }
+  return;
+}
+
+/* ChapelArray.chpl:583 */
+static void wrapon_fn9(_class_localson_fn9 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_DefaultDist _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(583), "/root/repo/modules/internal/ChapelArray.chpl");
+  _1_this = (c)->_1_this;
+  on_fn9(&_1_this, _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:587 */
+static void on_fn10(chpl____wide_DefaultDist* const delete_tmp, int64_t _ln, c_string _fn) {
+  chpl_opaque call_tmp;
+  call_tmp = ((void*)((delete_tmp)->addr));
+  chpl_here_free(call_tmp, _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:587 */
+static void wrapon_fn10(_class_localson_fn10 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_DefaultDist _1_rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(587), "/root/repo/modules/internal/ChapelArray.chpl");
+  _1_rvfDerefTmp = (c)->_1_rvfDerefTmp;
+  on_fn10(&_1_rvfDerefTmp, _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:594 */
+static void clone2(chpl____wide_DefaultDist* const this6, _ref_DefaultDist _retArg, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultDist ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultDist call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultDist call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultDist ret_to_arg_ref_tmp_ = NULL;
+  ret = *(this6);
+  chpl_check_nil((&ret)->addr, INT64(595), "/root/repo/modules/internal/ChapelArray.chpl");
+  call_tmp = dsiClone(&ret);
+  ret_to_arg_ref_tmp_ = &call_tmp2;
+  _newDistribution(&call_tmp, ret_to_arg_ref_tmp_, _ln, _fn);
+  *(_retArg) = call_tmp2;
+  return;
+}
+
+/* ChapelArray.chpl:598 */
+static DefaultRectangularDom_1_int64_t_F newRectangularDom(chpl____wide_DefaultDist* const this6, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultDist ret = {CHPL_LOCALEID_T_INIT, NULL};
+  DefaultRectangularDom_1_int64_t_F call_tmp = NULL;
+  ret = *(this6);
+  chpl_check_nil((&ret)->addr, INT64(599), "/root/repo/modules/internal/ChapelArray.chpl");
+  call_tmp = dsiNewRectangularDom(&ret, _ln, _fn);
+  return call_tmp;
+}
+
+/* ChapelArray.chpl:679 */
+static chpl____wide_DefaultRectangularDom_1_int64_t_F _construct__domain(chpl____wide_DefaultRectangularDom_1_int64_t_F* const _value, chpl____wide_DefaultRectangularDom_1_int64_t_F* const meme, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularDom_1_int64_t_F this6 = {CHPL_LOCALEID_T_INIT, NULL};
+  this6 = *(meme);
+  this6 = *(_value);
+  return this6;
+}
+
+/* ChapelArray.chpl:692 */
+static void chpl___TILDE__domain(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp;
+  _class_localson_fn11 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  ret = *(this6);
+  call_tmp = (&ret)->locale;
+  _args_size = sizeof(chpl__class_localson_fn11_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn11)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(695), "/root/repo/modules/internal/ChapelArray.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp;
+  chpl_check_nil(_args_foron_fn, INT64(695), "/root/repo/modules/internal/ChapelArray.chpl");
+  (_args_foron_fn)->_1_this = *(this6);
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn11 ***/ chpl_executeOn(&call_tmp, INT32(12), _args_foron_fn, sizeof(chpl__class_localson_fn11_object), INT64(695), "/root/repo/modules/internal/ChapelArray.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:695 */
+static void on_fn11(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp;
+  chpl____wide_BaseDom call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp3;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseRectangularDom _parent_destructor_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDom _parent_destructor_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomicflag _field_destructor_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_flag call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_flag T = NULL;
+  chpl____wide__ref_atomic_refcnt _field_destructor_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 _field_destructor_tmp_3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int_least64_t call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_int_least64_t T2 = NULL;
+  chpl_localeID_t call_tmp6;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn12 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide_BaseDom chpl_macro_tmp_404;
+  chpl____wide_BaseRectangularDom chpl_macro_tmp_405;
+  chpl____wide_BaseDom chpl_macro_tmp_406;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_407;
+  chpl____wide__ref_atomic_flag chpl_macro_tmp_408;
+  chpl____wide__ref_atomic_flag chpl_macro_tmp_409;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_410;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_411;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_412;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_413;
+  ret = *(this6);
+  chpl_macro_tmp_404.locale = (&ret)->locale;
+  chpl_macro_tmp_404.addr = ((BaseDom)((&ret)->addr));
+  call_tmp2 = chpl_macro_tmp_404;
+  chpl_check_nil((&call_tmp2)->addr, INT64(696), "/root/repo/modules/internal/ChapelArray.chpl");
+  call_tmp = destroyDom(&call_tmp2, _ln, _fn);
+  call_tmp3 = (call_tmp == INT64(0));
+  if (call_tmp3) {
+    ret2 = *(this6);
+    chpl_macro_tmp_405.locale = (&ret2)->locale;
+    chpl_macro_tmp_405.addr = ((BaseRectangularDom)((&ret2)->addr));
+    _parent_destructor_tmp_ = chpl_macro_tmp_405;
+    chpl_macro_tmp_406.locale = (&_parent_destructor_tmp_)->locale;
+    chpl_macro_tmp_406.addr = ((BaseDom)((&_parent_destructor_tmp_)->addr));
+    _parent_destructor_tmp_2 = chpl_macro_tmp_406;
+    chpl_check_nil((&_parent_destructor_tmp_2)->addr, INT64(698), "/root/repo/modules/internal/ChapelArray.chpl");
+    chpl_macro_tmp_407.locale = (&_parent_destructor_tmp_2)->locale;
+    chpl_macro_tmp_407.addr = &(((&_parent_destructor_tmp_2)->addr)->_arrsLock);
+    _field_destructor_tmp_ = chpl_macro_tmp_407;
+    chpl_macro_tmp_408.locale = (_field_destructor_tmp_).locale;
+    chpl_macro_tmp_408.addr = &(((_field_destructor_tmp_).addr)->_v);
+    call_tmp4 = chpl_macro_tmp_408;
+    T = (&call_tmp4)->addr;
+    atomic_destroy_flag(T);
+    chpl_macro_tmp_409.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_409.addr = T;
+    call_tmp4 = chpl_macro_tmp_409;
+    chpl_check_nil((&_parent_destructor_tmp_2)->addr, INT64(698), "/root/repo/modules/internal/ChapelArray.chpl");
+    chpl_macro_tmp_410.locale = (&_parent_destructor_tmp_2)->locale;
+    chpl_macro_tmp_410.addr = &(((&_parent_destructor_tmp_2)->addr)->_domCnt);
+    _field_destructor_tmp_2 = chpl_macro_tmp_410;
+    chpl_macro_tmp_411.locale = (_field_destructor_tmp_2).locale;
+    chpl_macro_tmp_411.addr = &(((_field_destructor_tmp_2).addr)->_cnt);
+    _field_destructor_tmp_3 = chpl_macro_tmp_411;
+    chpl_macro_tmp_412.locale = (_field_destructor_tmp_3).locale;
+    chpl_macro_tmp_412.addr = &(((_field_destructor_tmp_3).addr)->_v);
+    call_tmp5 = chpl_macro_tmp_412;
+    T2 = (&call_tmp5)->addr;
+    atomic_destroy_int_least64_t(T2);
+    chpl_macro_tmp_413.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_413.addr = T2;
+    call_tmp5 = chpl_macro_tmp_413;
+    call_tmp6 = (&ret2)->locale;
+    rvfDerefTmp = ret2;
+    _args_size = sizeof(chpl__class_localson_fn12_object);
+    _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn = ((_class_localson_fn12)(_args_alloc));
+    chpl_check_nil(_args_foron_fn, INT64(698), "/root/repo/modules/internal/ChapelArray.chpl");
+    (_args_foron_fn)->_0__tmp = call_tmp6;
+    chpl_check_nil(_args_foron_fn, INT64(698), "/root/repo/modules/internal/ChapelArray.chpl");
+    (_args_foron_fn)->_1_rvfDerefTmp = rvfDerefTmp;
+    (_args_foron_fn)->_ln = _ln;
+    (_args_foron_fn)->_fn = _fn;
+    /*** wrapon_fn12 ***/ chpl_executeOn(&call_tmp6, INT32(13), _args_foron_fn, sizeof(chpl__class_localson_fn12_object), INT64(698), "/root/repo/modules/internal/ChapelArray.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  }
+  return;
+}
+
+/* ChapelArray.chpl:695 */
+static void wrapon_fn11(_class_localson_fn11 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(695), "/root/repo/modules/internal/ChapelArray.chpl");
+  _1_this = (c)->_1_this;
+  on_fn11(&_1_this, _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:698 */
+static void on_fn12(chpl____wide_DefaultRectangularDom_1_int64_t_F* const delete_tmp, int64_t _ln, c_string _fn) {
+  chpl_opaque call_tmp;
+  call_tmp = ((void*)((delete_tmp)->addr));
+  chpl_here_free(call_tmp, _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:698 */
+static void wrapon_fn12(_class_localson_fn12 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F _1_rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(698), "/root/repo/modules/internal/ChapelArray.chpl");
+  _1_rvfDerefTmp = (c)->_1_rvfDerefTmp;
+  on_fn12(&_1_rvfDerefTmp, _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:704 */
+static void dist(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, _ref_DefaultDist _retArg, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularDom_1_int64_t_F call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultDist ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultDist call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultDist ret_to_arg_ref_tmp_ = NULL;
+  chpl____wide__ref_DefaultDist chpl_macro_tmp_414;
+  ret = *(this6);
+  call_tmp = ret;
+  chpl_check_nil((&call_tmp)->addr, INT64(704), "/root/repo/modules/internal/ChapelArray.chpl");
+  chpl_macro_tmp_414.locale = (&call_tmp)->locale;
+  chpl_macro_tmp_414.addr = &(((&call_tmp)->addr)->dist);
+  chpl_gen_comm_get(((void*)(&ret2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_414).locale), INT64(0), NULL), (chpl_macro_tmp_414).addr, sizeof(chpl____wide_DefaultDist), -1, INT64(1), INT64(704), "/root/repo/modules/internal/ChapelArray.chpl");
+  ret_to_arg_ref_tmp_ = &call_tmp2;
+  _getDistribution(&ret2, ret_to_arg_ref_tmp_, _ln, _fn);
+  *(_retArg) = call_tmp2;
+  return;
+}
+
+/* ChapelArray.chpl:752 */
+static void this2(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, range_int64_t_bounded_F* const _e0_ranges, _ref_DefaultRectangularDom_1_int64_t_F _retArg, int64_t _ln, c_string _fn) {
+  _tuple_1_star_range_int64_t_bounded_F r;
+  range_int64_t_bounded_F wrap_call_tmp;
+  chpl____wide__ref_range_int64_t_bounded_F call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  range_int64_t_bounded_F call_tmp2;
+  _ref_range_int64_t_bounded_F ret_to_arg_ref_tmp_ = NULL;
+  range_int64_t_bounded_F call_tmp3;
+  _ref_range_int64_t_bounded_F ret_to_arg_ref_tmp_2 = NULL;
+  _ref_range_int64_t_bounded_F _ref_tmp_ = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  DefaultRectangularDom_1_int64_t_F call_tmp4 = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultRectangularDom_1_int64_t_F ret_to_arg_ref_tmp_3 = NULL;
+  chpl____wide__ref_range_int64_t_bounded_F chpl_macro_tmp_415;
+  wrap_call_tmp = range(INT64(1), INT64(0), INT64(1), INT64(0), false, _ln, _fn);
+  *(r + INT64(0)) = wrap_call_tmp;
+  chpl_macro_tmp_415.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_415.addr = (r + INT64(0));
+  call_tmp = chpl_macro_tmp_415;
+  ret = *(this6);
+  ret_to_arg_ref_tmp_ = &call_tmp2;
+  chpl_check_nil((&ret)->addr, INT64(759), "/root/repo/modules/internal/ChapelArray.chpl");
+  dsiDim(&ret, ret_to_arg_ref_tmp_, _ln, _fn);
+  ret_to_arg_ref_tmp_2 = &call_tmp3;
+  _ref_tmp_ = &call_tmp2;
+  this3(_ref_tmp_, _e0_ranges, ret_to_arg_ref_tmp_2, _ln, _fn);
+  chpl_gen_comm_put(((void*)(&call_tmp3)), chpl_nodeFromLocaleID(&((call_tmp).locale), INT64(0), NULL), (call_tmp).addr, sizeof(range_int64_t_bounded_F), -1, INT64(1), INT64(759), "/root/repo/modules/internal/ChapelArray.chpl");
+  ret2 = *(this6);
+  chpl_check_nil((&ret2)->addr, INT64(761), "/root/repo/modules/internal/ChapelArray.chpl");
+  call_tmp4 = dsiBuildRectangularDom(&ret2, &r, _ln, _fn);
+  ret_to_arg_ref_tmp_3 = &call_tmp5;
+  _newDomain(call_tmp4, ret_to_arg_ref_tmp_3, _ln, _fn);
+  *(_retArg) = call_tmp5;
+  return;
+}
+
+/* ChapelArray.chpl:817 */
+static void buildArray(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, _ref_DefaultRectangularArr_locale_1_int64_t_F _retArg, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F x2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  DefaultRectangularArr_locale_1_int64_t_F call_tmp = NULL;
+  _ref_DefaultRectangularArr_locale_1_int64_t_F T = NULL;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultRectangularArr_locale_1_int64_t_F ret_to_arg_ref_tmp_ = NULL;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F chpl_macro_tmp_416;
+  ret = *(this6);
+  chpl_check_nil((&ret)->addr, INT64(818), "/root/repo/modules/internal/ChapelArray.chpl");
+  call_tmp = dsiBuildArray(&ret, _ln, _fn);
+  chpl_macro_tmp_416.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_416.addr = call_tmp;
+  x2 = chpl_macro_tmp_416;
+  T = &x2;
+  help(this6, T, _ln, _fn);
+  ret_to_arg_ref_tmp_ = &call_tmp2;
+  _newArray(&x2, ret_to_arg_ref_tmp_, _ln, _fn);
+  *(_retArg) = call_tmp2;
+  return;
+}
+
+/* ChapelArray.chpl:817 */
+static void buildArray2(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, _ref_DefaultRectangularArr_localesSignal_1_int64_t_F _retArg, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F x2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  DefaultRectangularArr_localesSignal_1_int64_t_F call_tmp = NULL;
+  _ref_DefaultRectangularArr_localesSignal_1_int64_t_F T = NULL;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultRectangularArr_localesSignal_1_int64_t_F ret_to_arg_ref_tmp_ = NULL;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F chpl_macro_tmp_417;
+  ret = *(this6);
+  chpl_check_nil((&ret)->addr, INT64(818), "/root/repo/modules/internal/ChapelArray.chpl");
+  call_tmp = dsiBuildArray2(&ret, _ln, _fn);
+  chpl_macro_tmp_417.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_417.addr = call_tmp;
+  x2 = chpl_macro_tmp_417;
+  T = &x2;
+  help2(this6, T, _ln, _fn);
+  ret_to_arg_ref_tmp_ = &call_tmp2;
+  _newArray2(&x2, ret_to_arg_ref_tmp_, _ln, _fn);
+  *(_retArg) = call_tmp2;
+  return;
+}
+
+/* ChapelArray.chpl:820 */
+static void help(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, _ref_DefaultRectangularArr_locale_1_int64_t_F x2, int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_seq_cst;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDom call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F T = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp2;
+  _class_localson_fn25 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDom coerce_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDom call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_refcnt call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder;
+  chpl_localeID_t call_tmp6;
+  _class_localson_fn5 _args_foron_fn2 = NULL;
+  int64_t _args_size2;
+  chpl_opaque _args_alloc2;
+  chpl____wide_BaseDom chpl_macro_tmp_418;
+  chpl____wide_BaseDom chpl_macro_tmp_419;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_420;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_421;
+  local_memory_order_seq_cst = memory_order_seq_cst;
+  ret = *(this6);
+  chpl_macro_tmp_418.locale = (&ret)->locale;
+  chpl_macro_tmp_418.addr = ((BaseDom)((&ret)->addr));
+  call_tmp = chpl_macro_tmp_418;
+  T = *(x2);
+  call_tmp2 = (&call_tmp)->locale;
+  _args_size = sizeof(chpl__class_localson_fn25_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn25)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(821), "/root/repo/modules/internal/ChapelArray.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp2;
+  chpl_check_nil(_args_foron_fn, INT64(821), "/root/repo/modules/internal/ChapelArray.chpl");
+  (_args_foron_fn)->_1_this = call_tmp;
+  chpl_check_nil(_args_foron_fn, INT64(821), "/root/repo/modules/internal/ChapelArray.chpl");
+  (_args_foron_fn)->_2_x = T;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn25 ***/ chpl_executeOn(&call_tmp2, INT32(28), _args_foron_fn, sizeof(chpl__class_localson_fn25_object), INT64(157), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  ret2 = *(this6);
+  chpl_macro_tmp_419.locale = (&ret2)->locale;
+  chpl_macro_tmp_419.addr = ((BaseDom)((&ret2)->addr));
+  call_tmp3 = chpl_macro_tmp_419;
+  coerce_tmp = call_tmp3;
+  compilerAssert();
+  chpl_check_nil((&coerce_tmp)->addr, INT64(823), "/root/repo/modules/internal/ChapelArray.chpl");
+  chpl_macro_tmp_420.locale = (&coerce_tmp)->locale;
+  chpl_macro_tmp_420.addr = &(((&coerce_tmp)->addr)->_domCnt);
+  call_tmp4 = chpl_macro_tmp_420;
+  chpl_macro_tmp_421.locale = (call_tmp4).locale;
+  chpl_macro_tmp_421.addr = &(((call_tmp4).addr)->_cnt);
+  call_tmp5 = chpl_macro_tmp_421;
+  default_argorder = local_memory_order_seq_cst;
+  call_tmp6 = (&call_tmp5)->locale;
+  _args_size2 = sizeof(chpl__class_localson_fn5_object);
+  _args_alloc2 = chpl_mem_allocPooled(_args_size2, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn2 = ((_class_localson_fn5)(_args_alloc2));
+  chpl_check_nil(_args_foron_fn2, INT64(823), "/root/repo/modules/internal/ChapelArray.chpl");
+  (_args_foron_fn2)->_0__tmp = call_tmp6;
+  chpl_check_nil(_args_foron_fn2, INT64(823), "/root/repo/modules/internal/ChapelArray.chpl");
+  (_args_foron_fn2)->_1_this = call_tmp5;
+  chpl_check_nil(_args_foron_fn2, INT64(823), "/root/repo/modules/internal/ChapelArray.chpl");
+  (_args_foron_fn2)->_2_value = INT64(1);
+  chpl_check_nil(_args_foron_fn2, INT64(823), "/root/repo/modules/internal/ChapelArray.chpl");
+  (_args_foron_fn2)->_3_order = default_argorder;
+  (_args_foron_fn2)->_ln = _ln;
+  (_args_foron_fn2)->_fn = _fn;
+  /*** wrapon_fn5 ***/ chpl_executeOn(&call_tmp6, INT32(6), _args_foron_fn2, sizeof(chpl__class_localson_fn5_object), INT64(1103), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn2)), _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:820 */
+static void help2(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, _ref_DefaultRectangularArr_localesSignal_1_int64_t_F x2, int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_seq_cst;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDom call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F T = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp2;
+  _class_localson_fn26 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDom coerce_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDom call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_refcnt call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder;
+  chpl_localeID_t call_tmp6;
+  _class_localson_fn5 _args_foron_fn2 = NULL;
+  int64_t _args_size2;
+  chpl_opaque _args_alloc2;
+  chpl____wide_BaseDom chpl_macro_tmp_422;
+  chpl____wide_BaseDom chpl_macro_tmp_423;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_424;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_425;
+  local_memory_order_seq_cst = memory_order_seq_cst;
+  ret = *(this6);
+  chpl_macro_tmp_422.locale = (&ret)->locale;
+  chpl_macro_tmp_422.addr = ((BaseDom)((&ret)->addr));
+  call_tmp = chpl_macro_tmp_422;
+  T = *(x2);
+  call_tmp2 = (&call_tmp)->locale;
+  _args_size = sizeof(chpl__class_localson_fn26_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn26)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(821), "/root/repo/modules/internal/ChapelArray.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp2;
+  chpl_check_nil(_args_foron_fn, INT64(821), "/root/repo/modules/internal/ChapelArray.chpl");
+  (_args_foron_fn)->_1_this = call_tmp;
+  chpl_check_nil(_args_foron_fn, INT64(821), "/root/repo/modules/internal/ChapelArray.chpl");
+  (_args_foron_fn)->_2_x = T;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn26 ***/ chpl_executeOn(&call_tmp2, INT32(29), _args_foron_fn, sizeof(chpl__class_localson_fn26_object), INT64(157), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  ret2 = *(this6);
+  chpl_macro_tmp_423.locale = (&ret2)->locale;
+  chpl_macro_tmp_423.addr = ((BaseDom)((&ret2)->addr));
+  call_tmp3 = chpl_macro_tmp_423;
+  coerce_tmp = call_tmp3;
+  compilerAssert();
+  chpl_check_nil((&coerce_tmp)->addr, INT64(823), "/root/repo/modules/internal/ChapelArray.chpl");
+  chpl_macro_tmp_424.locale = (&coerce_tmp)->locale;
+  chpl_macro_tmp_424.addr = &(((&coerce_tmp)->addr)->_domCnt);
+  call_tmp4 = chpl_macro_tmp_424;
+  chpl_macro_tmp_425.locale = (call_tmp4).locale;
+  chpl_macro_tmp_425.addr = &(((call_tmp4).addr)->_cnt);
+  call_tmp5 = chpl_macro_tmp_425;
+  default_argorder = local_memory_order_seq_cst;
+  call_tmp6 = (&call_tmp5)->locale;
+  _args_size2 = sizeof(chpl__class_localson_fn5_object);
+  _args_alloc2 = chpl_mem_allocPooled(_args_size2, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn2 = ((_class_localson_fn5)(_args_alloc2));
+  chpl_check_nil(_args_foron_fn2, INT64(823), "/root/repo/modules/internal/ChapelArray.chpl");
+  (_args_foron_fn2)->_0__tmp = call_tmp6;
+  chpl_check_nil(_args_foron_fn2, INT64(823), "/root/repo/modules/internal/ChapelArray.chpl");
+  (_args_foron_fn2)->_1_this = call_tmp5;
+  chpl_check_nil(_args_foron_fn2, INT64(823), "/root/repo/modules/internal/ChapelArray.chpl");
+  (_args_foron_fn2)->_2_value = INT64(1);
+  chpl_check_nil(_args_foron_fn2, INT64(823), "/root/repo/modules/internal/ChapelArray.chpl");
+  (_args_foron_fn2)->_3_order = default_argorder;
+  (_args_foron_fn2)->_ln = _ln;
+  (_args_foron_fn2)->_fn = _fn;
+  /*** wrapon_fn5 ***/ chpl_executeOn(&call_tmp6, INT32(6), _args_foron_fn2, sizeof(chpl__class_localson_fn5_object), INT64(1103), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn2)), _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:867 */
+static int64_t numIndices(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp;
+  ret = *(this6);
+  chpl_check_nil((&ret)->addr, INT64(867), "/root/repo/modules/internal/ChapelArray.chpl");
+  call_tmp = dsiNumIndices(&ret, _ln, _fn);
+  return call_tmp;
+}
+
+/* ChapelArray.chpl:1076 */
+static void setIndices(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, _tuple_1_star_range_int64_t_bounded_F* const x2, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  ret = *(this6);
+  chpl_check_nil((&ret)->addr, INT64(1077), "/root/repo/modules/internal/ChapelArray.chpl");
+  dsiSetIndices(&ret, x2, _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:1083 */
+static void getIndices(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, _ref__tuple_1_star_range_int64_t_bounded_F _retArg, int64_t _ln, c_string _fn) {
+  range_int64_t_bounded_F ret_x1;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  _tuple_1_star_range_int64_t_bounded_F call_tmp;
+  _ref__tuple_1_star_range_int64_t_bounded_F ret_to_arg_ref_tmp_ = NULL;
+  ret = *(this6);
+  ret_to_arg_ref_tmp_ = &call_tmp;
+  chpl_check_nil((&ret)->addr, INT64(1084), "/root/repo/modules/internal/ChapelArray.chpl");
+  dsiGetIndices(&ret, ret_to_arg_ref_tmp_, _ln, _fn);
+  ret_x1 = *(call_tmp + INT64(0));
+  *(*(_retArg) + INT64(0)) = ret_x1;
+  return;
+}
+
+/* ChapelArray.chpl:1294 */
+static chpl____wide_DefaultRectangularArr_locale_1_int64_t_F _construct__array(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const _value, chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const meme, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F this6 = {CHPL_LOCALEID_T_INIT, NULL};
+  this6 = *(meme);
+  this6 = *(_value);
+  chpl_check_nil((&this6)->addr, INT64(1294), "/root/repo/modules/internal/ChapelArray.chpl");
+  initialize(&this6);
+  return this6;
+}
+
+/* ChapelArray.chpl:1294 */
+static chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F _construct__array2(chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const _value, chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const meme, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F this6 = {CHPL_LOCALEID_T_INIT, NULL};
+  this6 = *(meme);
+  this6 = *(_value);
+  chpl_check_nil((&this6)->addr, INT64(1294), "/root/repo/modules/internal/ChapelArray.chpl");
+  initialize2(&this6);
+  return this6;
+}
+
+/* ChapelArray.chpl:1299 */
+static void initialize(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const this6) {
+  chpl_incRefCountsForDomainsInArrayEltTypes();
+  return;
+}
+
+/* ChapelArray.chpl:1299 */
+static void initialize2(chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const this6) {
+  chpl_incRefCountsForDomainsInArrayEltTypes2();
+  return;
+}
+
+/* ChapelArray.chpl:1319 */
+static void chpl___TILDE__array(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const this6, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp;
+  _class_localson_fn13 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  ret = *(this6);
+  call_tmp = (&ret)->locale;
+  _args_size = sizeof(chpl__class_localson_fn13_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn13)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(1322), "/root/repo/modules/internal/ChapelArray.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp;
+  chpl_check_nil(_args_foron_fn, INT64(1322), "/root/repo/modules/internal/ChapelArray.chpl");
+  (_args_foron_fn)->_1_this = *(this6);
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn13 ***/ chpl_executeOn(&call_tmp, INT32(14), _args_foron_fn, sizeof(chpl__class_localson_fn13_object), INT64(1322), "/root/repo/modules/internal/ChapelArray.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:1319 */
+static void chpl___TILDE__array2(chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const this6, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp;
+  _class_localson_fn14 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  ret = *(this6);
+  call_tmp = (&ret)->locale;
+  _args_size = sizeof(chpl__class_localson_fn14_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn14)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(1322), "/root/repo/modules/internal/ChapelArray.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp;
+  chpl_check_nil(_args_foron_fn, INT64(1322), "/root/repo/modules/internal/ChapelArray.chpl");
+  (_args_foron_fn)->_1_this = *(this6);
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn14 ***/ chpl_executeOn(&call_tmp, INT32(15), _args_foron_fn, sizeof(chpl__class_localson_fn14_object), INT64(1322), "/root/repo/modules/internal/ChapelArray.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:1322 */
+static void on_fn13(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const this6, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp;
+  chpl____wide_BaseArr call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp3;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseArr _parent_destructor_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_refcnt _field_destructor_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 _field_destructor_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int_least64_t call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_int_least64_t T = NULL;
+  chpl_localeID_t call_tmp5;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn15 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide_BaseArr chpl_macro_tmp_426;
+  chpl____wide_BaseArr chpl_macro_tmp_427;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_428;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_429;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_430;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_431;
+  ret = *(this6);
+  chpl_macro_tmp_426.locale = (&ret)->locale;
+  chpl_macro_tmp_426.addr = ((BaseArr)((&ret)->addr));
+  call_tmp2 = chpl_macro_tmp_426;
+  chpl_check_nil((&call_tmp2)->addr, INT64(1323), "/root/repo/modules/internal/ChapelArray.chpl");
+  call_tmp = destroyArr(&call_tmp2, _ln, _fn);
+  call_tmp3 = (call_tmp == INT64(0));
+  if (call_tmp3) {
+    chpl_decRefCountsForDomainsInArrayEltTypes();
+    ret2 = *(this6);
+    chpl_macro_tmp_427.locale = (&ret2)->locale;
+    chpl_macro_tmp_427.addr = ((BaseArr)((&ret2)->addr));
+    _parent_destructor_tmp_ = chpl_macro_tmp_427;
+    chpl_check_nil((&_parent_destructor_tmp_)->addr, INT64(1326), "/root/repo/modules/internal/ChapelArray.chpl");
+    chpl_macro_tmp_428.locale = (&_parent_destructor_tmp_)->locale;
+    chpl_macro_tmp_428.addr = &(((&_parent_destructor_tmp_)->addr)->_arrCnt);
+    _field_destructor_tmp_ = chpl_macro_tmp_428;
+    chpl_macro_tmp_429.locale = (_field_destructor_tmp_).locale;
+    chpl_macro_tmp_429.addr = &(((_field_destructor_tmp_).addr)->_cnt);
+    _field_destructor_tmp_2 = chpl_macro_tmp_429;
+    chpl_macro_tmp_430.locale = (_field_destructor_tmp_2).locale;
+    chpl_macro_tmp_430.addr = &(((_field_destructor_tmp_2).addr)->_v);
+    call_tmp4 = chpl_macro_tmp_430;
+    T = (&call_tmp4)->addr;
+    atomic_destroy_int_least64_t(T);
+    chpl_macro_tmp_431.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_431.addr = T;
+    call_tmp4 = chpl_macro_tmp_431;
+    call_tmp5 = (&ret2)->locale;
+    rvfDerefTmp = ret2;
+    _args_size = sizeof(chpl__class_localson_fn15_object);
+    _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn = ((_class_localson_fn15)(_args_alloc));
+    chpl_check_nil(_args_foron_fn, INT64(1326), "/root/repo/modules/internal/ChapelArray.chpl");
+    (_args_foron_fn)->_0__tmp = call_tmp5;
+    chpl_check_nil(_args_foron_fn, INT64(1326), "/root/repo/modules/internal/ChapelArray.chpl");
+    (_args_foron_fn)->_1_rvfDerefTmp = rvfDerefTmp;
+    (_args_foron_fn)->_ln = _ln;
+    (_args_foron_fn)->_fn = _fn;
+    /*** wrapon_fn15 ***/ chpl_executeOn(&call_tmp5, INT32(16), _args_foron_fn, sizeof(chpl__class_localson_fn15_object), INT64(1326), "/root/repo/modules/internal/ChapelArray.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  }
+  return;
+}
+
+/* ChapelArray.chpl:1322 */
+static void on_fn14(chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const this6, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp;
+  chpl____wide_BaseArr call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp3;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseArr _parent_destructor_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_refcnt _field_destructor_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 _field_destructor_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int_least64_t call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_int_least64_t T = NULL;
+  chpl_localeID_t call_tmp5;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn16 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide_BaseArr chpl_macro_tmp_432;
+  chpl____wide_BaseArr chpl_macro_tmp_433;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_434;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_435;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_436;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_437;
+  ret = *(this6);
+  chpl_macro_tmp_432.locale = (&ret)->locale;
+  chpl_macro_tmp_432.addr = ((BaseArr)((&ret)->addr));
+  call_tmp2 = chpl_macro_tmp_432;
+  chpl_check_nil((&call_tmp2)->addr, INT64(1323), "/root/repo/modules/internal/ChapelArray.chpl");
+  call_tmp = destroyArr(&call_tmp2, _ln, _fn);
+  call_tmp3 = (call_tmp == INT64(0));
+  if (call_tmp3) {
+    chpl_decRefCountsForDomainsInArrayEltTypes2();
+    ret2 = *(this6);
+    chpl_macro_tmp_433.locale = (&ret2)->locale;
+    chpl_macro_tmp_433.addr = ((BaseArr)((&ret2)->addr));
+    _parent_destructor_tmp_ = chpl_macro_tmp_433;
+    chpl_check_nil((&_parent_destructor_tmp_)->addr, INT64(1326), "/root/repo/modules/internal/ChapelArray.chpl");
+    chpl_macro_tmp_434.locale = (&_parent_destructor_tmp_)->locale;
+    chpl_macro_tmp_434.addr = &(((&_parent_destructor_tmp_)->addr)->_arrCnt);
+    _field_destructor_tmp_ = chpl_macro_tmp_434;
+    chpl_macro_tmp_435.locale = (_field_destructor_tmp_).locale;
+    chpl_macro_tmp_435.addr = &(((_field_destructor_tmp_).addr)->_cnt);
+    _field_destructor_tmp_2 = chpl_macro_tmp_435;
+    chpl_macro_tmp_436.locale = (_field_destructor_tmp_2).locale;
+    chpl_macro_tmp_436.addr = &(((_field_destructor_tmp_2).addr)->_v);
+    call_tmp4 = chpl_macro_tmp_436;
+    T = (&call_tmp4)->addr;
+    atomic_destroy_int_least64_t(T);
+    chpl_macro_tmp_437.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_437.addr = T;
+    call_tmp4 = chpl_macro_tmp_437;
+    call_tmp5 = (&ret2)->locale;
+    rvfDerefTmp = ret2;
+    _args_size = sizeof(chpl__class_localson_fn16_object);
+    _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn = ((_class_localson_fn16)(_args_alloc));
+    chpl_check_nil(_args_foron_fn, INT64(1326), "/root/repo/modules/internal/ChapelArray.chpl");
+    (_args_foron_fn)->_0__tmp = call_tmp5;
+    chpl_check_nil(_args_foron_fn, INT64(1326), "/root/repo/modules/internal/ChapelArray.chpl");
+    (_args_foron_fn)->_1_rvfDerefTmp = rvfDerefTmp;
+    (_args_foron_fn)->_ln = _ln;
+    (_args_foron_fn)->_fn = _fn;
+    /*** wrapon_fn16 ***/ chpl_executeOn(&call_tmp5, INT32(17), _args_foron_fn, sizeof(chpl__class_localson_fn16_object), INT64(1326), "/root/repo/modules/internal/ChapelArray.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  }
+  return;
+}
+
+/* ChapelArray.chpl:1322 */
+static void wrapon_fn13(_class_localson_fn13 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(1322), "/root/repo/modules/internal/ChapelArray.chpl");
+  _1_this = (c)->_1_this;
+  on_fn13(&_1_this, _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:1322 */
+static void wrapon_fn14(_class_localson_fn14 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(1322), "/root/repo/modules/internal/ChapelArray.chpl");
+  _1_this = (c)->_1_this;
+  on_fn14(&_1_this, _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:1326 */
+static void on_fn15(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const delete_tmp, int64_t _ln, c_string _fn) {
+  chpl_opaque call_tmp;
+  call_tmp = ((void*)((delete_tmp)->addr));
+  chpl_here_free(call_tmp, _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:1326 */
+static void on_fn16(chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const delete_tmp, int64_t _ln, c_string _fn) {
+  chpl_opaque call_tmp;
+  call_tmp = ((void*)((delete_tmp)->addr));
+  chpl_here_free(call_tmp, _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:1326 */
+static void wrapon_fn15(_class_localson_fn15 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F _1_rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(1326), "/root/repo/modules/internal/ChapelArray.chpl");
+  _1_rvfDerefTmp = (c)->_1_rvfDerefTmp;
+  on_fn15(&_1_rvfDerefTmp, _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:1326 */
+static void wrapon_fn16(_class_localson_fn16 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F _1_rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(1326), "/root/repo/modules/internal/ChapelArray.chpl");
+  _1_rvfDerefTmp = (c)->_1_rvfDerefTmp;
+  on_fn16(&_1_rvfDerefTmp, _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:1335 */
+static void _dom(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const this6, _ref_DefaultRectangularDom_1_int64_t_F _retArg, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultRectangularDom_1_int64_t_F ret_to_arg_ref_tmp_ = NULL;
+  chpl____wide__ref_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_438;
+  ret = *(this6);
+  call_tmp = ret;
+  chpl_check_nil((&call_tmp)->addr, INT64(1335), "/root/repo/modules/internal/ChapelArray.chpl");
+  chpl_macro_tmp_438.locale = (&call_tmp)->locale;
+  chpl_macro_tmp_438.addr = &(((&call_tmp)->addr)->dom);
+  chpl_gen_comm_get(((void*)(&ret2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_438).locale), INT64(0), NULL), (chpl_macro_tmp_438).addr, sizeof(chpl____wide_DefaultRectangularDom_1_int64_t_F), -1, INT64(1), INT64(1335), "/root/repo/modules/internal/ChapelArray.chpl");
+  ret_to_arg_ref_tmp_ = &call_tmp2;
+  _getDomain(&ret2, ret_to_arg_ref_tmp_, _ln, _fn);
+  *(_retArg) = chpl__initCopy2(&call_tmp2, _ln, _fn);
+  chpl__autoDestroy2(&call_tmp2, _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:1470 */
+static void newAlias(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const this6, _ref_DefaultRectangularArr_locale_1_int64_t_F _retArg, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultRectangularArr_locale_1_int64_t_F ret_to_arg_ref_tmp_ = NULL;
+  ret = *(this6);
+  ret_to_arg_ref_tmp_ = &call_tmp;
+  _newArray(&ret, ret_to_arg_ref_tmp_, _ln, _fn);
+  *(_retArg) = call_tmp;
+  return;
+}
+
+/* ChapelArray.chpl:2106 */
+static void chpl___ASSIGN_(chpl____wide_DefaultDist* const a, chpl____wide_DefaultDist* const b, int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_seq_cst;
+  chpl____wide_DefaultDist ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp2;
+  chpl____wide_DefaultDist call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultDist ret_to_arg_ref_tmp_ = NULL;
+  chpl____wide_DefaultDist ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDist coerce_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDist call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_list_BaseDom call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t ret3;
+  chpl_bool call_tmp6;
+  chpl____wide_DefaultDist ret4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultDist ret5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp7 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp9;
+  chpl____wide_DefaultDist ret6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDist coerce_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDist call_tmp10 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_refcnt call_tmp11 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 call_tmp12 = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder;
+  chpl_localeID_t call_tmp13;
+  _class_localson_fn5 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide_DefaultDist ret7 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultDist ret8 = {CHPL_LOCALEID_T_INIT, NULL};
+  c_string T;
+  chpl____wide_object chpl_macro_tmp_439;
+  chpl____wide_BaseDist chpl_macro_tmp_440;
+  chpl____wide__ref_list_BaseDom chpl_macro_tmp_441;
+  chpl____wide__ref_int64_t chpl_macro_tmp_442;
+  chpl____wide_object chpl_macro_tmp_443;
+  chpl____wide_object chpl_macro_tmp_444;
+  chpl____wide_BaseDist chpl_macro_tmp_445;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_446;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_447;
+  local_memory_order_seq_cst = memory_order_seq_cst;
+  ret = *(a);
+  chpl_macro_tmp_439.locale = (&ret)->locale;
+  chpl_macro_tmp_439.addr = ((object)((&ret)->addr));
+  call_tmp = chpl_macro_tmp_439;
+  call_tmp2 = (&call_tmp)->addr == nil;
+  if (call_tmp2) {
+    ret_to_arg_ref_tmp_ = &call_tmp3;
+    chpl_check_nil((b)->addr, INT64(2108), "/root/repo/modules/internal/ChapelArray.chpl");
+    clone2(b, ret_to_arg_ref_tmp_, _ln, _fn);
+    *(a) = call_tmp3;
+  } else {
+    ret2 = *(a);
+    chpl_macro_tmp_440.locale = (&ret2)->locale;
+    chpl_macro_tmp_440.addr = ((BaseDist)((&ret2)->addr));
+    call_tmp4 = chpl_macro_tmp_440;
+    coerce_tmp = call_tmp4;
+    chpl_check_nil((&coerce_tmp)->addr, INT64(2109), "/root/repo/modules/internal/ChapelArray.chpl");
+    chpl_macro_tmp_441.locale = (&coerce_tmp)->locale;
+    chpl_macro_tmp_441.addr = &(((&coerce_tmp)->addr)->_doms);
+    call_tmp5 = chpl_macro_tmp_441;
+    chpl_macro_tmp_442.locale = (call_tmp5).locale;
+    chpl_macro_tmp_442.addr = &(((call_tmp5).addr)->length);
+    chpl_gen_comm_get(((void*)(&ret3)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_442).locale), INT64(0), NULL), (chpl_macro_tmp_442).addr, sizeof(int64_t), -1, INT64(1), INT64(2109), "/root/repo/modules/internal/ChapelArray.chpl");
+    call_tmp6 = (ret3 == INT64(0));
+    if (call_tmp6) {
+      ret4 = *(a);
+      ret5 = *(b);
+      chpl_macro_tmp_443.locale = (&ret4)->locale;
+      chpl_macro_tmp_443.addr = ((object)((&ret4)->addr));
+      call_tmp7 = chpl_macro_tmp_443;
+      chpl_macro_tmp_444.locale = (&ret5)->locale;
+      chpl_macro_tmp_444.addr = ((object)((&ret5)->addr));
+      call_tmp8 = chpl_macro_tmp_444;
+      call_tmp9 = (! (((&call_tmp7)->addr != (&call_tmp8)->addr) || ((!(! (&call_tmp7)->addr)) && (chpl_nodeFromLocaleID(&((&call_tmp7)->locale), INT64(0), NULL) != chpl_nodeFromLocaleID(&((&call_tmp8)->locale), INT64(0), NULL)))));
+      if (call_tmp9) {
+        ret6 = *(a);
+        chpl_macro_tmp_445.locale = (&ret6)->locale;
+        chpl_macro_tmp_445.addr = ((BaseDist)((&ret6)->addr));
+        call_tmp10 = chpl_macro_tmp_445;
+        coerce_tmp2 = call_tmp10;
+        compilerAssert();
+        chpl_check_nil((&coerce_tmp2)->addr, INT64(2118), "/root/repo/modules/internal/ChapelArray.chpl");
+        chpl_macro_tmp_446.locale = (&coerce_tmp2)->locale;
+        chpl_macro_tmp_446.addr = &(((&coerce_tmp2)->addr)->_distCnt);
+        call_tmp11 = chpl_macro_tmp_446;
+        chpl_macro_tmp_447.locale = (call_tmp11).locale;
+        chpl_macro_tmp_447.addr = &(((call_tmp11).addr)->_cnt);
+        call_tmp12 = chpl_macro_tmp_447;
+        default_argorder = local_memory_order_seq_cst;
+        call_tmp13 = (&call_tmp12)->locale;
+        _args_size = sizeof(chpl__class_localson_fn5_object);
+        _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+        _args_foron_fn = ((_class_localson_fn5)(_args_alloc));
+        chpl_check_nil(_args_foron_fn, INT64(2118), "/root/repo/modules/internal/ChapelArray.chpl");
+        (_args_foron_fn)->_0__tmp = call_tmp13;
+        chpl_check_nil(_args_foron_fn, INT64(2118), "/root/repo/modules/internal/ChapelArray.chpl");
+        (_args_foron_fn)->_1_this = call_tmp12;
+        chpl_check_nil(_args_foron_fn, INT64(2118), "/root/repo/modules/internal/ChapelArray.chpl");
+        (_args_foron_fn)->_2_value = INT64(1);
+        chpl_check_nil(_args_foron_fn, INT64(2118), "/root/repo/modules/internal/ChapelArray.chpl");
+        (_args_foron_fn)->_3_order = default_argorder;
+        (_args_foron_fn)->_ln = _ln;
+        (_args_foron_fn)->_fn = _fn;
+        /*** wrapon_fn5 ***/ chpl_executeOn(&call_tmp13, INT32(6), _args_foron_fn, sizeof(chpl__class_localson_fn5_object), INT64(1103), "/root/repo/modules/internal/Atomics.chpl");
+        chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+      } else {
+        ret7 = *(a);
+        ret8 = *(b);
+        chpl_check_nil((&ret7)->addr, INT64(2120), "/root/repo/modules/internal/ChapelArray.chpl");
+        dsiAssign(&ret7, &ret8);
+      }
+    } else {
+      T = "assignment to distributions with declared domains is not yet supported";
+      halt(T, _ln, _fn);
+    }
+  }
+  return;
+}
+
+/* ChapelArray.chpl:2128 */
+static void chpl___ASSIGN_2(chpl____wide_DefaultRectangularDom_1_int64_t_F* const a, chpl____wide_DefaultRectangularDom_1_int64_t_F* const b, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDom coerce_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDom call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  list_BaseArr ret2;
+  list_BaseArr _ic__F0_this;
+  chpl____wide_listNode_BaseArr tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_listNode_BaseArr ret3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool T;
+  chpl____wide_object call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp3;
+  chpl____wide_BaseArr ret4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseArr e = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp4;
+  _class_localson_fn17 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide_listNode_BaseArr ret5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp6;
+  _tuple_1_star_range_int64_t_bounded_F call_tmp7;
+  _ref__tuple_1_star_range_int64_t_bounded_F ret_to_arg_ref_tmp_ = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDom coerce_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDom call_tmp8 = {CHPL_LOCALEID_T_INIT, NULL};
+  list_BaseArr ret7;
+  list_BaseArr _ic__F0_this2;
+  chpl____wide_listNode_BaseArr tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_listNode_BaseArr ret8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool T2;
+  chpl____wide_object call_tmp9 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp10;
+  chpl____wide_BaseArr ret9 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseArr e2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp11;
+  _class_localson_fn18 _args_foron_fn2 = NULL;
+  int64_t _args_size2;
+  chpl_opaque _args_alloc2;
+  chpl____wide_listNode_BaseArr ret10 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp12 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp13;
+  chpl____wide_BaseDom chpl_macro_tmp_448;
+  chpl____wide__ref_list_BaseArr chpl_macro_tmp_449;
+  chpl____wide_object chpl_macro_tmp_450;
+  chpl____wide__ref_BaseArr chpl_macro_tmp_451;
+  chpl____wide__ref_listNode_BaseArr chpl_macro_tmp_452;
+  chpl____wide_object chpl_macro_tmp_453;
+  chpl____wide_BaseDom chpl_macro_tmp_454;
+  chpl____wide__ref_list_BaseArr chpl_macro_tmp_455;
+  chpl____wide_object chpl_macro_tmp_456;
+  chpl____wide__ref_BaseArr chpl_macro_tmp_457;
+  chpl____wide__ref_listNode_BaseArr chpl_macro_tmp_458;
+  chpl____wide_object chpl_macro_tmp_459;
+  ret = *(a);
+  chpl_macro_tmp_448.locale = (&ret)->locale;
+  chpl_macro_tmp_448.addr = ((BaseDom)((&ret)->addr));
+  call_tmp = chpl_macro_tmp_448;
+  coerce_tmp = call_tmp;
+  chpl_check_nil((&coerce_tmp)->addr, INT64(2130), "/root/repo/modules/internal/ChapelArray.chpl");
+  chpl_macro_tmp_449.locale = (&coerce_tmp)->locale;
+  chpl_macro_tmp_449.addr = &(((&coerce_tmp)->addr)->_arrs);
+  chpl_gen_comm_get(((void*)(&ret2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_449).locale), INT64(0), NULL), (chpl_macro_tmp_449).addr, sizeof(list_BaseArr), -1, INT64(1), INT64(2130), "/root/repo/modules/internal/ChapelArray.chpl");
+  _ic__F0_this = ret2;
+  ret3 = (&_ic__F0_this)->first;
+  tmp = ret3;
+  chpl_macro_tmp_450.locale = (&ret3)->locale;
+  chpl_macro_tmp_450.addr = ((object)((&ret3)->addr));
+  call_tmp2 = chpl_macro_tmp_450;
+  call_tmp3 = (&call_tmp2)->addr != nil;
+  T = call_tmp3;
+  while (T) {
+    chpl_check_nil((&tmp)->addr, INT64(2130), "/root/repo/modules/internal/ChapelArray.chpl");
+    chpl_macro_tmp_451.locale = (&tmp)->locale;
+    chpl_macro_tmp_451.addr = &(((&tmp)->addr)->data);
+    chpl_gen_comm_get(((void*)(&ret4)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_451).locale), INT64(0), NULL), (chpl_macro_tmp_451).addr, sizeof(chpl____wide_BaseArr), -1, INT64(1), INT64(2130), "/root/repo/modules/internal/ChapelArray.chpl");
+    e = ret4;
+    call_tmp4 = (&e)->locale;
+    _args_size = sizeof(chpl__class_localson_fn17_object);
+    _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn = ((_class_localson_fn17)(_args_alloc));
+    chpl_check_nil(_args_foron_fn, INT64(2131), "/root/repo/modules/internal/ChapelArray.chpl");
+    (_args_foron_fn)->_0__tmp = call_tmp4;
+    chpl_check_nil(_args_foron_fn, INT64(2131), "/root/repo/modules/internal/ChapelArray.chpl");
+    (_args_foron_fn)->_1_e = e;
+    chpl_check_nil(_args_foron_fn, INT64(2131), "/root/repo/modules/internal/ChapelArray.chpl");
+    (_args_foron_fn)->_2__tmp = *(b);
+    (_args_foron_fn)->_ln = _ln;
+    (_args_foron_fn)->_fn = _fn;
+    /*** wrapon_fn17 ***/ chpl_executeOn(&call_tmp4, INT32(18), _args_foron_fn, sizeof(chpl__class_localson_fn17_object), INT64(2131), "/root/repo/modules/internal/ChapelArray.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+    chpl_check_nil((&tmp)->addr, INT64(2130), "/root/repo/modules/internal/ChapelArray.chpl");
+    chpl_macro_tmp_452.locale = (&tmp)->locale;
+    chpl_macro_tmp_452.addr = &(((&tmp)->addr)->next);
+    chpl_gen_comm_get(((void*)(&ret5)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_452).locale), INT64(0), NULL), (chpl_macro_tmp_452).addr, sizeof(chpl____wide_listNode_BaseArr), -1, INT64(1), INT64(2130), "/root/repo/modules/internal/ChapelArray.chpl");
+    tmp = ret5;
+    chpl_macro_tmp_453.locale = (&ret5)->locale;
+    chpl_macro_tmp_453.addr = ((object)((&ret5)->addr));
+    call_tmp5 = chpl_macro_tmp_453;
+    call_tmp6 = (&call_tmp5)->addr != nil;
+    T = call_tmp6;
+  }
+  ret_to_arg_ref_tmp_ = &call_tmp7;
+  chpl_check_nil((b)->addr, INT64(2133), "/root/repo/modules/internal/ChapelArray.chpl");
+  getIndices(b, ret_to_arg_ref_tmp_, _ln, _fn);
+  chpl_check_nil((a)->addr, INT64(2133), "/root/repo/modules/internal/ChapelArray.chpl");
+  setIndices(a, &call_tmp7, _ln, _fn);
+  ret6 = *(a);
+  chpl_macro_tmp_454.locale = (&ret6)->locale;
+  chpl_macro_tmp_454.addr = ((BaseDom)((&ret6)->addr));
+  call_tmp8 = chpl_macro_tmp_454;
+  coerce_tmp2 = call_tmp8;
+  chpl_check_nil((&coerce_tmp2)->addr, INT64(2134), "/root/repo/modules/internal/ChapelArray.chpl");
+  chpl_macro_tmp_455.locale = (&coerce_tmp2)->locale;
+  chpl_macro_tmp_455.addr = &(((&coerce_tmp2)->addr)->_arrs);
+  chpl_gen_comm_get(((void*)(&ret7)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_455).locale), INT64(0), NULL), (chpl_macro_tmp_455).addr, sizeof(list_BaseArr), -1, INT64(1), INT64(2134), "/root/repo/modules/internal/ChapelArray.chpl");
+  _ic__F0_this2 = ret7;
+  ret8 = (&_ic__F0_this2)->first;
+  tmp2 = ret8;
+  chpl_macro_tmp_456.locale = (&ret8)->locale;
+  chpl_macro_tmp_456.addr = ((object)((&ret8)->addr));
+  call_tmp9 = chpl_macro_tmp_456;
+  call_tmp10 = (&call_tmp9)->addr != nil;
+  T2 = call_tmp10;
+  while (T2) {
+    chpl_check_nil((&tmp2)->addr, INT64(2134), "/root/repo/modules/internal/ChapelArray.chpl");
+    chpl_macro_tmp_457.locale = (&tmp2)->locale;
+    chpl_macro_tmp_457.addr = &(((&tmp2)->addr)->data);
+    chpl_gen_comm_get(((void*)(&ret9)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_457).locale), INT64(0), NULL), (chpl_macro_tmp_457).addr, sizeof(chpl____wide_BaseArr), -1, INT64(1), INT64(2134), "/root/repo/modules/internal/ChapelArray.chpl");
+    e2 = ret9;
+    call_tmp11 = (&e2)->locale;
+    _args_size2 = sizeof(chpl__class_localson_fn18_object);
+    _args_alloc2 = chpl_mem_allocPooled(_args_size2, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn2 = ((_class_localson_fn18)(_args_alloc2));
+    chpl_check_nil(_args_foron_fn2, INT64(2135), "/root/repo/modules/internal/ChapelArray.chpl");
+    (_args_foron_fn2)->_0__tmp = call_tmp11;
+    chpl_check_nil(_args_foron_fn2, INT64(2135), "/root/repo/modules/internal/ChapelArray.chpl");
+    (_args_foron_fn2)->_1_e = e2;
+    (_args_foron_fn2)->_ln = _ln;
+    (_args_foron_fn2)->_fn = _fn;
+    /*** wrapon_fn18 ***/ chpl_executeOnFast(&call_tmp11, INT32(19), _args_foron_fn2, sizeof(chpl__class_localson_fn18_object), INT64(2135), "/root/repo/modules/internal/ChapelArray.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn2)), _ln, _fn);
+    chpl_check_nil((&tmp2)->addr, INT64(2134), "/root/repo/modules/internal/ChapelArray.chpl");
+    chpl_macro_tmp_458.locale = (&tmp2)->locale;
+    chpl_macro_tmp_458.addr = &(((&tmp2)->addr)->next);
+    chpl_gen_comm_get(((void*)(&ret10)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_458).locale), INT64(0), NULL), (chpl_macro_tmp_458).addr, sizeof(chpl____wide_listNode_BaseArr), -1, INT64(1), INT64(2134), "/root/repo/modules/internal/ChapelArray.chpl");
+    tmp2 = ret10;
+    chpl_macro_tmp_459.locale = (&ret10)->locale;
+    chpl_macro_tmp_459.addr = ((object)((&ret10)->addr));
+    call_tmp12 = chpl_macro_tmp_459;
+    call_tmp13 = (&call_tmp12)->addr != nil;
+    T2 = call_tmp13;
+  }
+  return;
+}
+
+/* ChapelArray.chpl:2131 */
+static void on_fn17(chpl____wide_BaseArr* const e, chpl____wide_DefaultRectangularDom_1_int64_t_F* const b, int64_t _ln, c_string _fn) {
+  chpl_bool _dynamic_dispatch_tmp_;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F _cast_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool _dynamic_dispatch_tmp_2;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F _cast_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_int32_t chpl_macro_tmp_460;
+  int32_t chpl_macro_tmp_461;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F chpl_macro_tmp_462;
+  chpl____wide__ref_int32_t chpl_macro_tmp_463;
+  int32_t chpl_macro_tmp_464;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F chpl_macro_tmp_465;
+  chpl_check_nil((e)->addr, INT64(2131), "/root/repo/modules/internal/ChapelArray.chpl");
+  chpl_macro_tmp_460.locale = (e)->locale;
+  chpl_macro_tmp_460.addr = &(((object)((e)->addr))->chpl__cid);
+  chpl_gen_comm_get(((void*)(&chpl_macro_tmp_461)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_460).locale), INT64(0), NULL), (chpl_macro_tmp_460).addr, sizeof(int32_t), -1, INT64(1), INT64(2131), "/root/repo/modules/internal/ChapelArray.chpl");
+  _dynamic_dispatch_tmp_ = (chpl_macro_tmp_461 == chpl__cid_DefaultRectangularArr_locale_1_int64_t_F);
+  if (_dynamic_dispatch_tmp_) {
+    chpl_macro_tmp_462.locale = (e)->locale;
+    chpl_macro_tmp_462.addr = ((DefaultRectangularArr_locale_1_int64_t_F)((e)->addr));
+    _cast_tmp_ = chpl_macro_tmp_462;
+    chpl_check_nil((&_cast_tmp_)->addr, INT64(2131), "/root/repo/modules/internal/ChapelArray.chpl");
+    dsiReallocate2(&_cast_tmp_, b, _ln, _fn);
+  } else {
+    chpl_check_nil((e)->addr, INT64(2131), "/root/repo/modules/internal/ChapelArray.chpl");
+    chpl_macro_tmp_463.locale = (e)->locale;
+    chpl_macro_tmp_463.addr = &(((object)((e)->addr))->chpl__cid);
+    chpl_gen_comm_get(((void*)(&chpl_macro_tmp_464)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_463).locale), INT64(0), NULL), (chpl_macro_tmp_463).addr, sizeof(int32_t), -1, INT64(1), INT64(2131), "/root/repo/modules/internal/ChapelArray.chpl");
+    _dynamic_dispatch_tmp_2 = (chpl_macro_tmp_464 == chpl__cid_DefaultRectangularArr_localesSignal_1_int64_t_F);
+    if (_dynamic_dispatch_tmp_2) {
+      chpl_macro_tmp_465.locale = (e)->locale;
+      chpl_macro_tmp_465.addr = ((DefaultRectangularArr_localesSignal_1_int64_t_F)((e)->addr));
+      _cast_tmp_2 = chpl_macro_tmp_465;
+      chpl_check_nil((&_cast_tmp_2)->addr, INT64(2131), "/root/repo/modules/internal/ChapelArray.chpl");
+      dsiReallocate3(&_cast_tmp_2, b, _ln, _fn);
+    } else {
+      chpl_check_nil((e)->addr, INT64(2131), "/root/repo/modules/internal/ChapelArray.chpl");
+      dsiReallocate(e, b, _ln, _fn);
+    }
+  }
+  return;
+}
+
+/* ChapelArray.chpl:2131 */
+static void wrapon_fn17(_class_localson_fn17 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_BaseArr _1_e = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F _2__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(2131), "/root/repo/modules/internal/ChapelArray.chpl");
+  _1_e = (c)->_1_e;
+  chpl_check_nil(c, INT64(2131), "/root/repo/modules/internal/ChapelArray.chpl");
+  _2__tmp = (c)->_2__tmp;
+  on_fn17(&_1_e, &_2__tmp, _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:2135 */
+static void on_fn18(chpl____wide_BaseArr* const e, int64_t _ln, c_string _fn) {
+  chpl_check_nil((e)->addr, INT64(2135), "/root/repo/modules/internal/ChapelArray.chpl");
+  dsiPostReallocate(e);
+  return;
+}
+
+/* ChapelArray.chpl:2135 */
+static void wrapon_fn18(_class_localson_fn18 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_BaseArr _1_e = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(2135), "/root/repo/modules/internal/ChapelArray.chpl");
+  _1_e = (c)->_1_e;
+  on_fn18(&_1_e, _ln, _fn);
+  return;
+}
+
+/* ChapelArray.chpl:2498 */
+static chpl____wide_DefaultDist chpl__initCopy(chpl____wide_DefaultDist* const a, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultDist call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultDist ret_to_arg_ref_tmp_ = NULL;
+  ret_to_arg_ref_tmp_ = &call_tmp;
+  chpl_check_nil((a)->addr, INT64(2499), "/root/repo/modules/internal/ChapelArray.chpl");
+  clone2(a, ret_to_arg_ref_tmp_, _ln, _fn);
+  return call_tmp;
+}
+
+/* ChapelArray.chpl:2504 */
+static chpl____wide_DefaultRectangularDom_1_int64_t_F chpl__initCopy2(chpl____wide_DefaultRectangularDom_1_int64_t_F* const a, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularDom_1_int64_t_F b = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F type_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl___RuntimeTypeInfo call_tmp;
+  chpl____wide_DefaultDist _runtime_type_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultRectangularDom_1_int64_t_F ret_to_arg_ref_tmp_ = NULL;
+  _tuple_1_star_range_int64_t_bounded_F call_tmp2;
+  _ref__tuple_1_star_range_int64_t_bounded_F ret_to_arg_ref_tmp_2 = NULL;
+  call_tmp = chpl__convertValueToRuntimeType(a, _ln, _fn);
+  _runtime_type_tmp_ = (&call_tmp)->d;
+  ret_to_arg_ref_tmp_ = &type_tmp;
+  chpl__convertRuntimeTypeToValue(&_runtime_type_tmp_, ret_to_arg_ref_tmp_, _ln, _fn);
+  b = type_tmp;
+  ret_to_arg_ref_tmp_2 = &call_tmp2;
+  chpl_check_nil((a)->addr, INT64(2507), "/root/repo/modules/internal/ChapelArray.chpl");
+  getIndices(a, ret_to_arg_ref_tmp_2, _ln, _fn);
+  chpl_check_nil((&type_tmp)->addr, INT64(2507), "/root/repo/modules/internal/ChapelArray.chpl");
+  setIndices(&type_tmp, &call_tmp2, _ln, _fn);
+  return b;
+}
+
@@ -0,0 +1,740 @@
+/* ChapelBase.chpl:24 */
+static void chpl__init_ChapelBase(int64_t _ln, c_string _fn) {
+  c_string modFormatStr;
+  c_string modStr;
+  _ref_int32_t refIndentLevel = NULL;
+  if (chpl__init_ChapelBase_p) {
+    goto _exit_chpl__init_ChapelBase;
+  }
+  modFormatStr = "%*s\n";
+  modStr = "ChapelBase";
+  printModuleInit(modFormatStr, modStr, INT64(10), _ln, _fn);
+  refIndentLevel = &moduleInitLevel;
+  *(refIndentLevel) += INT64(1);
+  chpl__init_ChapelBase_p = true;
+  *(refIndentLevel) -= INT64(1);
+  _exit_chpl__init_ChapelBase:;
+  return;
+}
+
+/* ChapelBase.chpl:183 */
+static void compilerAssert(void) {
+  return;
+}
+
+/* ChapelBase.chpl:663 */
+static void init_elts(chpl____wide__ddata_locale* const x2, int64_t s, int64_t _ln, c_string _fn) {
+  range_int64_t_bounded_F call_tmp;
+  _ref_range_int64_t_bounded_F ret_to_arg_ref_tmp_ = NULL;
+  range_int64_t_bounded_F _ic__F0_this;
+  _ref_range_int64_t_bounded_F this6 = NULL;
+  int64_t i;
+  int64_t ret;
+  int64_t end;
+  int64_t ret2;
+  chpl____wide_locale call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  locale T = NULL;
+  int64_t call_tmp3;
+  chpl____wide_locale chpl_macro_tmp_19;
+  chpl____wide__ref_locale chpl_macro_tmp_20;
+  ret_to_arg_ref_tmp_ = &call_tmp;
+  _build_range(INT64(1), s, ret_to_arg_ref_tmp_, _ln, _fn);
+  _ic__F0_this = call_tmp;
+  this6 = &_ic__F0_this;
+  checkIfIterWillOverflow(this6, true, _ln, _fn);
+  ret = (&_ic__F0_this)->_low;
+  ret2 = (&_ic__F0_this)->_high;
+  end = ret2;
+  for (i = ret; ((i <= end)); i += INT64(1)) {
+    T = ((locale)(nil));
+    chpl_macro_tmp_19.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_19.addr = T;
+    call_tmp2 = chpl_macro_tmp_19;
+    call_tmp3 = (i - INT64(1));
+    chpl_macro_tmp_20.locale = (x2)->locale;
+    chpl_macro_tmp_20.addr = ((x2)->addr + call_tmp3);
+    chpl_gen_comm_put(((void*)(&call_tmp2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_20).locale), INT64(0), NULL), (chpl_macro_tmp_20).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(675), "/root/repo/modules/internal/ChapelBase.chpl");
+  }
+  return;
+}
+
+/* ChapelBase.chpl:663 */
+static void init_elts2(chpl____wide__ddata_localesSignal* const x2, int64_t s, int64_t _ln, c_string _fn) {
+  range_int64_t_bounded_F call_tmp;
+  _ref_range_int64_t_bounded_F ret_to_arg_ref_tmp_ = NULL;
+  range_int64_t_bounded_F _ic__F0_this;
+  _ref_range_int64_t_bounded_F this6 = NULL;
+  int64_t i;
+  int64_t ret;
+  int64_t end;
+  int64_t ret2;
+  chpl____wide_localesSignal call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  localesSignal T = NULL;
+  int64_t call_tmp3;
+  chpl____wide_localesSignal chpl_macro_tmp_21;
+  chpl____wide__ref_localesSignal chpl_macro_tmp_22;
+  ret_to_arg_ref_tmp_ = &call_tmp;
+  _build_range(INT64(1), s, ret_to_arg_ref_tmp_, _ln, _fn);
+  _ic__F0_this = call_tmp;
+  this6 = &_ic__F0_this;
+  checkIfIterWillOverflow(this6, true, _ln, _fn);
+  ret = (&_ic__F0_this)->_low;
+  ret2 = (&_ic__F0_this)->_high;
+  end = ret2;
+  for (i = ret; ((i <= end)); i += INT64(1)) {
+    T = ((localesSignal)(nil));
+    chpl_macro_tmp_21.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_21.addr = T;
+    call_tmp2 = chpl_macro_tmp_21;
+    call_tmp3 = (i - INT64(1));
+    chpl_macro_tmp_22.locale = (x2)->locale;
+    chpl_macro_tmp_22.addr = ((x2)->addr + call_tmp3);
+    chpl_gen_comm_put(((void*)(&call_tmp2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_22).locale), INT64(0), NULL), (chpl_macro_tmp_22).addr, sizeof(chpl____wide_localesSignal), -1, INT64(1), INT64(675), "/root/repo/modules/internal/ChapelBase.chpl");
+  }
+  return;
+}
+
+/* ChapelBase.chpl:776 */
+static chpl___EndCount _construct__EndCount(atomic_int64* const i, int64_t taskCnt, chpl_task_list_p taskList, int64_t numDeferred, chpl___EndCount meme, int64_t _ln, c_string _fn) {
+  chpl___EndCount this6 = NULL;
+  object T = NULL;
+  this6 = meme;
+  chpl_check_nil(this6, INT64(776), "/root/repo/modules/internal/ChapelBase.chpl");
+  T = &((this6)->super);
+  _construct_object(T);
+  chpl_check_nil(this6, INT64(777), "/root/repo/modules/internal/ChapelBase.chpl");
+  (this6)->i = *(i);
+  chpl_check_nil(this6, INT64(778), "/root/repo/modules/internal/ChapelBase.chpl");
+  (this6)->taskCnt = taskCnt;
+  chpl_check_nil(this6, INT64(779), "/root/repo/modules/internal/ChapelBase.chpl");
+  (this6)->taskList = taskList;
+  chpl_check_nil(this6, INT64(780), "/root/repo/modules/internal/ChapelBase.chpl");
+  (this6)->numDeferred = numDeferred;
+  return this6;
+}
+
+/* ChapelBase.chpl:776 */
+static void chpl__auto_destroy__EndCount(chpl___EndCount this6, int64_t _ln, c_string _fn) {
+  _ref_atomic_int64 _field_destructor_tmp_ = NULL;
+  _ref_atomic_int_least64_t call_tmp = NULL;
+  _ref_atomic_int_least64_t T = NULL;
+  chpl_check_nil(this6, INT64(777), "/root/repo/modules/internal/ChapelBase.chpl");
+  _field_destructor_tmp_ = &((this6)->i);
+  chpl_check_nil(_field_destructor_tmp_, INT64(777), "/root/repo/modules/internal/ChapelBase.chpl");
+  call_tmp = &((_field_destructor_tmp_)->_v);
+  T = call_tmp;
+  atomic_destroy_int_least64_t(T);
+  call_tmp = T;
+  return;
+}
+
+/* ChapelBase.chpl:796 */
+static void on_fn19(chpl____wide__EndCount* const delete_tmp, int64_t _ln, c_string _fn) {
+  chpl_opaque call_tmp;
+  call_tmp = ((void*)((delete_tmp)->addr));
+  chpl_here_free(call_tmp, _ln, _fn);
+  return;
+}
+
+/* ChapelBase.chpl:796 */
+static void wrapon_fn19(_class_localson_fn19 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__EndCount _1_rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(796), "/root/repo/modules/internal/ChapelBase.chpl");
+  _1_rvfDerefTmp = (c)->_1_rvfDerefTmp;
+  on_fn19(&_1_rvfDerefTmp, _ln, _fn);
+  return;
+}
+
+/* ChapelBase.chpl:804 */
+static void _upEndCount(chpl____wide__EndCount* const e, int64_t numTasks, int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_relaxed;
+  memory_order local_memory_order_release;
+  chpl_localeID_t call_tmp;
+  _class_localson_fn20 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide_locale call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  int32_t call_tmp3;
+  chpl_localeID_t call_tmp4;
+  _ref_chpl_localeID_t ret_to_arg_ref_tmp_ = NULL;
+  chpl_localeID_t call_tmp5;
+  chpl____wide_locale call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 call_tmp7 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp8;
+  _class_localson_fn5 _args_foron_fn2 = NULL;
+  int64_t _args_size2;
+  chpl_opaque _args_alloc2;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_23;
+  local_memory_order_relaxed = memory_order_relaxed;
+  local_memory_order_release = memory_order_release;
+  chpl_rmem_consist_fence(local_memory_order_release, _ln, _fn);
+  call_tmp = (e)->locale;
+  _args_size = sizeof(chpl__class_localson_fn20_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn20)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(813), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp;
+  chpl_check_nil(_args_foron_fn, INT64(813), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_1_e = *(e);
+  chpl_check_nil(_args_foron_fn, INT64(813), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_2_numTasks = numTasks;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn20 ***/ chpl_executeOn(&call_tmp, INT32(21), _args_foron_fn, sizeof(chpl__class_localson_fn20_object), INT64(813), "/root/repo/modules/internal/ChapelBase.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  call_tmp3 = chpl_task_getRequestedSubloc();
+  ret_to_arg_ref_tmp_ = &call_tmp4;
+  chpl_buildLocaleID(chpl_nodeID, call_tmp3, ret_to_arg_ref_tmp_, _ln, _fn);
+  call_tmp5 = chpl__initCopy_chpl_rt_localeID_t(call_tmp4);
+  call_tmp6 = chpl_localeID_to_locale(&call_tmp5, _ln, _fn);
+  call_tmp2 = call_tmp6;
+  chpl_check_nil((&call_tmp2)->addr, INT64(818), "/root/repo/modules/internal/ChapelBase.chpl");
+  chpl_macro_tmp_23.locale = (&call_tmp2)->locale;
+  chpl_macro_tmp_23.addr = &(((&call_tmp2)->addr)->runningTaskCounter);
+  call_tmp7 = chpl_macro_tmp_23;
+  call_tmp8 = (&call_tmp7)->locale;
+  _args_size2 = sizeof(chpl__class_localson_fn5_object);
+  _args_alloc2 = chpl_mem_allocPooled(_args_size2, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn2 = ((_class_localson_fn5)(_args_alloc2));
+  chpl_check_nil(_args_foron_fn2, INT64(818), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn2)->_0__tmp = call_tmp8;
+  chpl_check_nil(_args_foron_fn2, INT64(818), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn2)->_1_this = call_tmp7;
+  chpl_check_nil(_args_foron_fn2, INT64(818), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn2)->_2_value = numTasks;
+  chpl_check_nil(_args_foron_fn2, INT64(818), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn2)->_3_order = local_memory_order_relaxed;
+  (_args_foron_fn2)->_ln = _ln;
+  (_args_foron_fn2)->_fn = _fn;
+  /*** wrapon_fn5 ***/ chpl_executeOn(&call_tmp8, INT32(6), _args_foron_fn2, sizeof(chpl__class_localson_fn5_object), INT64(1103), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn2)), _ln, _fn);
+  return;
+}
+
+/* ChapelBase.chpl:813 */
+static void on_fn20(chpl____wide__EndCount* const e, int64_t numTasks, int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_release;
+  chpl____wide__ref_atomic_int64 call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp2;
+  _class_localson_fn5 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_int64_t call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_24;
+  chpl____wide__ref_int64_t chpl_macro_tmp_25;
+  int64_t chpl_macro_tmp_26;
+  local_memory_order_release = memory_order_release;
+  chpl_check_nil((e)->addr, INT64(814), "/root/repo/modules/internal/ChapelBase.chpl");
+  chpl_macro_tmp_24.locale = (e)->locale;
+  chpl_macro_tmp_24.addr = &(((e)->addr)->i);
+  call_tmp = chpl_macro_tmp_24;
+  call_tmp2 = (&call_tmp)->locale;
+  _args_size = sizeof(chpl__class_localson_fn5_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn5)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(814), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp2;
+  chpl_check_nil(_args_foron_fn, INT64(814), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_1_this = call_tmp;
+  chpl_check_nil(_args_foron_fn, INT64(814), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_2_value = numTasks;
+  chpl_check_nil(_args_foron_fn, INT64(814), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_3_order = local_memory_order_release;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn5 ***/ chpl_executeOn(&call_tmp2, INT32(6), _args_foron_fn, sizeof(chpl__class_localson_fn5_object), INT64(1103), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  chpl_check_nil((e)->addr, INT64(815), "/root/repo/modules/internal/ChapelBase.chpl");
+  chpl_macro_tmp_25.locale = (e)->locale;
+  chpl_macro_tmp_25.addr = &(((e)->addr)->taskCnt);
+  call_tmp3 = chpl_macro_tmp_25;
+  chpl_gen_comm_get(((void*)(&chpl_macro_tmp_26)), chpl_nodeFromLocaleID(&((call_tmp3).locale), INT64(0), NULL), (call_tmp3).addr, sizeof(int64_t), -1, INT64(1), INT64(815), "/root/repo/modules/internal/ChapelBase.chpl");
+  chpl_macro_tmp_26 += numTasks;
+  chpl_gen_comm_put(((void*)(&chpl_macro_tmp_26)), chpl_nodeFromLocaleID(&((call_tmp3).locale), INT64(0), NULL), (call_tmp3).addr, sizeof(int64_t), -1, INT64(1), INT64(815), "/root/repo/modules/internal/ChapelBase.chpl");
+  return;
+}
+
+/* ChapelBase.chpl:813 */
+static void wrapon_fn20(_class_localson_fn20 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__EndCount _1_e = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t _2_numTasks;
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(813), "/root/repo/modules/internal/ChapelBase.chpl");
+  _1_e = (c)->_1_e;
+  chpl_check_nil(c, INT64(813), "/root/repo/modules/internal/ChapelBase.chpl");
+  _2_numTasks = (c)->_2_numTasks;
+  on_fn20(&_1_e, _2_numTasks, _ln, _fn);
+  return;
+}
+
+/* ChapelBase.chpl:837 */
+static void _upEndCountFlush(chpl___EndCount e, int64_t _ln, c_string _fn) {
+  int64_t ret;
+  chpl_bool call_tmp;
+  _ref_int64_t call_tmp2 = NULL;
+  chpl____wide__EndCount T = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__EndCount chpl_macro_tmp_27;
+  chpl_check_nil(e, INT64(838), "/root/repo/modules/internal/ChapelBase.chpl");
+  ret = (e)->numDeferred;
+  call_tmp = (ret > INT64(0));
+  if (call_tmp) {
+    chpl_check_nil(e, INT64(840), "/root/repo/modules/internal/ChapelBase.chpl");
+    call_tmp2 = &((e)->numDeferred);
+    *(call_tmp2) = INT64(0);
+    chpl_macro_tmp_27.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_27.addr = e;
+    T = chpl_macro_tmp_27;
+    _upEndCount(&T, ret, _ln, _fn);
+  }
+  return;
+}
+
+/* ChapelBase.chpl:849 */
+static void _downEndCount(chpl____wide__EndCount* const e, int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_release;
+  chpl____wide__ref_atomic_int64 call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp2;
+  _class_localson_fn7 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_28;
+  local_memory_order_release = memory_order_release;
+  chpl_check_nil((e)->addr, INT64(850), "/root/repo/modules/internal/ChapelBase.chpl");
+  chpl_macro_tmp_28.locale = (e)->locale;
+  chpl_macro_tmp_28.addr = &(((e)->addr)->i);
+  call_tmp = chpl_macro_tmp_28;
+  call_tmp2 = (&call_tmp)->locale;
+  _args_size = sizeof(chpl__class_localson_fn7_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn7)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(850), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp2;
+  chpl_check_nil(_args_foron_fn, INT64(850), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_1_this = call_tmp;
+  chpl_check_nil(_args_foron_fn, INT64(850), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_2_value = INT64(1);
+  chpl_check_nil(_args_foron_fn, INT64(850), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_3_order = local_memory_order_release;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn7 ***/ chpl_executeOn(&call_tmp2, INT32(8), _args_foron_fn, sizeof(chpl__class_localson_fn7_object), INT64(1111), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  return;
+}
+
+/* ChapelBase.chpl:856 */
+static void _waitEndCount(chpl___EndCount e, int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_relaxed;
+  memory_order local_memory_order_acquire;
+  chpl_task_list_p ret;
+  chpl____wide__ref_atomic_int64 call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp2;
+  _class_localson_fn8 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  int64_t ret2;
+  chpl____wide_locale call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  int32_t call_tmp4;
+  chpl_localeID_t call_tmp5;
+  _ref_chpl_localeID_t ret_to_arg_ref_tmp_ = NULL;
+  chpl_localeID_t call_tmp6;
+  chpl____wide_locale call_tmp7 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 call_tmp8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp9;
+  _class_localson_fn7 _args_foron_fn2 = NULL;
+  int64_t _args_size2;
+  chpl_opaque _args_alloc2;
+  chpl_task_list_p ret3;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_29;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_30;
+  local_memory_order_relaxed = memory_order_relaxed;
+  local_memory_order_acquire = memory_order_acquire;
+  chpl_check_nil(e, INT64(858), "/root/repo/modules/internal/ChapelBase.chpl");
+  ret = (e)->taskList;
+  chpl_taskListExecute(ret, _ln, _fn);
+  chpl_check_nil(e, INT64(861), "/root/repo/modules/internal/ChapelBase.chpl");
+  chpl_macro_tmp_29.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_29.addr = &((e)->i);
+  call_tmp = chpl_macro_tmp_29;
+  call_tmp2 = (&call_tmp)->locale;
+  _args_size = sizeof(chpl__class_localson_fn8_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn8)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(861), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp2;
+  chpl_check_nil(_args_foron_fn, INT64(861), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_1_this = call_tmp;
+  chpl_check_nil(_args_foron_fn, INT64(861), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_2_val = INT64(0);
+  chpl_check_nil(_args_foron_fn, INT64(861), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_3_order = local_memory_order_acquire;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn8 ***/ chpl_executeOn(&call_tmp2, INT32(9), _args_foron_fn, sizeof(chpl__class_localson_fn8_object), INT64(1139), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  chpl_check_nil(e, INT64(863), "/root/repo/modules/internal/ChapelBase.chpl");
+  ret2 = (e)->taskCnt;
+  call_tmp4 = chpl_task_getRequestedSubloc();
+  ret_to_arg_ref_tmp_ = &call_tmp5;
+  chpl_buildLocaleID(chpl_nodeID, call_tmp4, ret_to_arg_ref_tmp_, _ln, _fn);
+  call_tmp6 = chpl__initCopy_chpl_rt_localeID_t(call_tmp5);
+  call_tmp7 = chpl_localeID_to_locale(&call_tmp6, _ln, _fn);
+  call_tmp3 = call_tmp7;
+  chpl_check_nil((&call_tmp3)->addr, INT64(864), "/root/repo/modules/internal/ChapelBase.chpl");
+  chpl_macro_tmp_30.locale = (&call_tmp3)->locale;
+  chpl_macro_tmp_30.addr = &(((&call_tmp3)->addr)->runningTaskCounter);
+  call_tmp8 = chpl_macro_tmp_30;
+  call_tmp9 = (&call_tmp8)->locale;
+  _args_size2 = sizeof(chpl__class_localson_fn7_object);
+  _args_alloc2 = chpl_mem_allocPooled(_args_size2, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn2 = ((_class_localson_fn7)(_args_alloc2));
+  chpl_check_nil(_args_foron_fn2, INT64(864), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn2)->_0__tmp = call_tmp9;
+  chpl_check_nil(_args_foron_fn2, INT64(864), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn2)->_1_this = call_tmp8;
+  chpl_check_nil(_args_foron_fn2, INT64(864), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn2)->_2_value = ret2;
+  chpl_check_nil(_args_foron_fn2, INT64(864), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn2)->_3_order = local_memory_order_relaxed;
+  (_args_foron_fn2)->_ln = _ln;
+  (_args_foron_fn2)->_fn = _fn;
+  /*** wrapon_fn7 ***/ chpl_executeOn(&call_tmp9, INT32(8), _args_foron_fn2, sizeof(chpl__class_localson_fn7_object), INT64(1111), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn2)), _ln, _fn);
+  chpl_check_nil(e, INT64(874), "/root/repo/modules/internal/ChapelBase.chpl");
+  ret3 = (e)->taskList;
+  chpl_taskListFree(ret3, _ln, _fn);
+  return;
+}
+
+/* ChapelBase.chpl:887 */
+static void _waitEndCount2(chpl___EndCount _endCount, int64_t _ln, c_string _fn) {
+  _waitEndCount(_endCount, _ln, _fn);
+  return;
+}
+
+/* ChapelBase.chpl:893 */
+static int64_t _command_line_cast(c_string x2, int64_t _ln, c_string _fn) {
+  int64_t call_tmp;
+  call_tmp = c_string_to_int64_t(x2, _ln, _fn);
+  return call_tmp;
+}
+
+/* ChapelBase.chpl:893 */
+static chpl_bool _command_line_cast2(c_string x2, int64_t _ln, c_string _fn) {
+  chpl_bool call_tmp;
+  call_tmp = c_string_to_chpl_bool(x2, _ln, _fn);
+  return call_tmp;
+}
+
+/* ChapelBase.chpl:893 */
+static int64_t _command_line_cast3(c_string x2, int64_t _ln, c_string _fn) {
+  int64_t call_tmp;
+  call_tmp = c_string_to_int64_t(x2, _ln, _fn);
+  return call_tmp;
+}
+
+/* ChapelBase.chpl:893 */
+static int64_t _command_line_cast4(c_string x2, int64_t _ln, c_string _fn) {
+  int64_t call_tmp;
+  call_tmp = c_string_to_int64_t(x2, _ln, _fn);
+  return call_tmp;
+}
+
+/* ChapelBase.chpl:893 */
+static chpl_bool _command_line_cast5(c_string x2, int64_t _ln, c_string _fn) {
+  chpl_bool call_tmp;
+  call_tmp = c_string_to_chpl_bool(x2, _ln, _fn);
+  return call_tmp;
+}
+
+/* ChapelBase.chpl:893 */
+static chpl_bool _command_line_cast6(c_string x2, int64_t _ln, c_string _fn) {
+  chpl_bool call_tmp;
+  call_tmp = c_string_to_chpl_bool(x2, _ln, _fn);
+  return call_tmp;
+}
+
+/* ChapelBase.chpl:893 */
+static chpl_bool _command_line_cast7(c_string x2, int64_t _ln, c_string _fn) {
+  chpl_bool call_tmp;
+  call_tmp = c_string_to_chpl_bool(x2, _ln, _fn);
+  return call_tmp;
+}
+
+/* ChapelBase.chpl:893 */
+static chpl_bool _command_line_cast8(c_string x2, int64_t _ln, c_string _fn) {
+  chpl_bool call_tmp;
+  call_tmp = c_string_to_chpl_bool(x2, _ln, _fn);
+  return call_tmp;
+}
+
+/* ChapelBase.chpl:893 */
+static uint64_t _command_line_cast9(c_string x2, int64_t _ln, c_string _fn) {
+  uint64_t call_tmp;
+  call_tmp = c_string_to_uint64_t(x2, _ln, _fn);
+  return call_tmp;
+}
+
+/* ChapelBase.chpl:893 */
+static uint64_t _command_line_cast10(c_string x2, int64_t _ln, c_string _fn) {
+  uint64_t call_tmp;
+  call_tmp = c_string_to_uint64_t(x2, _ln, _fn);
+  return call_tmp;
+}
+
+/* ChapelBase.chpl:893 */
+static c_string _command_line_cast11(c_string x2, int64_t _ln, c_string _fn) {
+  chpl____wide_chpl_string call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  c_string call_tmp2;
+  wide_string_from_c_string(&call_tmp, x2, INT64(0), INT64(0), _ln, _fn);
+  c_string_from_wide_string(&call_tmp2, &call_tmp, _ln, _fn);
+  return call_tmp2;
+}
+
+/* ChapelBase.chpl:893 */
+static c_string _command_line_cast12(c_string x2, int64_t _ln, c_string _fn) {
+  chpl____wide_chpl_string call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  c_string call_tmp2;
+  wide_string_from_c_string(&call_tmp, x2, INT64(0), INT64(0), _ln, _fn);
+  c_string_from_wide_string(&call_tmp2, &call_tmp, _ln, _fn);
+  return call_tmp2;
+}
+
+/* ChapelBase.chpl:893 */
+static chpl_bool _command_line_cast13(c_string x2, int64_t _ln, c_string _fn) {
+  chpl_bool call_tmp;
+  call_tmp = c_string_to_chpl_bool(x2, _ln, _fn);
+  return call_tmp;
+}
+
+/* ChapelBase.chpl:1038 */
+static chpl____wide_DefaultDist chpl__autoCopy(chpl____wide_DefaultDist* const x2, int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_seq_cst;
+  chpl____wide_DefaultDist ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDist coerce_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDist call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_refcnt call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder;
+  chpl_localeID_t call_tmp4;
+  _class_localson_fn5 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide_BaseDist chpl_macro_tmp_31;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_32;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_33;
+  local_memory_order_seq_cst = memory_order_seq_cst;
+  ret = *(x2);
+  chpl_macro_tmp_31.locale = (&ret)->locale;
+  chpl_macro_tmp_31.addr = ((BaseDist)((&ret)->addr));
+  call_tmp = chpl_macro_tmp_31;
+  coerce_tmp = call_tmp;
+  compilerAssert();
+  chpl_check_nil((&coerce_tmp)->addr, INT64(1039), "/root/repo/modules/internal/ChapelBase.chpl");
+  chpl_macro_tmp_32.locale = (&coerce_tmp)->locale;
+  chpl_macro_tmp_32.addr = &(((&coerce_tmp)->addr)->_distCnt);
+  call_tmp2 = chpl_macro_tmp_32;
+  chpl_macro_tmp_33.locale = (call_tmp2).locale;
+  chpl_macro_tmp_33.addr = &(((call_tmp2).addr)->_cnt);
+  call_tmp3 = chpl_macro_tmp_33;
+  default_argorder = local_memory_order_seq_cst;
+  call_tmp4 = (&call_tmp3)->locale;
+  _args_size = sizeof(chpl__class_localson_fn5_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn5)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(1039), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp4;
+  chpl_check_nil(_args_foron_fn, INT64(1039), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_1_this = call_tmp3;
+  chpl_check_nil(_args_foron_fn, INT64(1039), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_2_value = INT64(1);
+  chpl_check_nil(_args_foron_fn, INT64(1039), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_3_order = default_argorder;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn5 ***/ chpl_executeOn(&call_tmp4, INT32(6), _args_foron_fn, sizeof(chpl__class_localson_fn5_object), INT64(1103), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  return *(x2);
+}
+
+/* ChapelBase.chpl:1046 */
+static chpl____wide_DefaultRectangularDom_1_int64_t_F chpl__autoCopy2(chpl____wide_DefaultRectangularDom_1_int64_t_F* const x2, int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_seq_cst;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDom coerce_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDom call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_refcnt call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder;
+  chpl_localeID_t call_tmp4;
+  _class_localson_fn5 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide_BaseDom chpl_macro_tmp_34;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_35;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_36;
+  local_memory_order_seq_cst = memory_order_seq_cst;
+  ret = *(x2);
+  chpl_macro_tmp_34.locale = (&ret)->locale;
+  chpl_macro_tmp_34.addr = ((BaseDom)((&ret)->addr));
+  call_tmp = chpl_macro_tmp_34;
+  coerce_tmp = call_tmp;
+  compilerAssert();
+  chpl_check_nil((&coerce_tmp)->addr, INT64(1047), "/root/repo/modules/internal/ChapelBase.chpl");
+  chpl_macro_tmp_35.locale = (&coerce_tmp)->locale;
+  chpl_macro_tmp_35.addr = &(((&coerce_tmp)->addr)->_domCnt);
+  call_tmp2 = chpl_macro_tmp_35;
+  chpl_macro_tmp_36.locale = (call_tmp2).locale;
+  chpl_macro_tmp_36.addr = &(((call_tmp2).addr)->_cnt);
+  call_tmp3 = chpl_macro_tmp_36;
+  default_argorder = local_memory_order_seq_cst;
+  call_tmp4 = (&call_tmp3)->locale;
+  _args_size = sizeof(chpl__class_localson_fn5_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn5)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(1047), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp4;
+  chpl_check_nil(_args_foron_fn, INT64(1047), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_1_this = call_tmp3;
+  chpl_check_nil(_args_foron_fn, INT64(1047), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_2_value = INT64(1);
+  chpl_check_nil(_args_foron_fn, INT64(1047), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_3_order = default_argorder;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn5 ***/ chpl_executeOn(&call_tmp4, INT32(6), _args_foron_fn, sizeof(chpl__class_localson_fn5_object), INT64(1103), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  return *(x2);
+}
+
+/* ChapelBase.chpl:1054 */
+static chpl____wide_DefaultRectangularArr_locale_1_int64_t_F chpl__autoCopy3(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const x2, int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_seq_cst;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseArr coerce_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseArr call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_refcnt call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder;
+  chpl_localeID_t call_tmp4;
+  _class_localson_fn5 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide_BaseArr chpl_macro_tmp_37;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_38;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_39;
+  local_memory_order_seq_cst = memory_order_seq_cst;
+  ret = *(x2);
+  chpl_macro_tmp_37.locale = (&ret)->locale;
+  chpl_macro_tmp_37.addr = ((BaseArr)((&ret)->addr));
+  call_tmp = chpl_macro_tmp_37;
+  coerce_tmp = call_tmp;
+  compilerAssert();
+  chpl_check_nil((&coerce_tmp)->addr, INT64(1055), "/root/repo/modules/internal/ChapelBase.chpl");
+  chpl_macro_tmp_38.locale = (&coerce_tmp)->locale;
+  chpl_macro_tmp_38.addr = &(((&coerce_tmp)->addr)->_arrCnt);
+  call_tmp2 = chpl_macro_tmp_38;
+  chpl_macro_tmp_39.locale = (call_tmp2).locale;
+  chpl_macro_tmp_39.addr = &(((call_tmp2).addr)->_cnt);
+  call_tmp3 = chpl_macro_tmp_39;
+  default_argorder = local_memory_order_seq_cst;
+  call_tmp4 = (&call_tmp3)->locale;
+  _args_size = sizeof(chpl__class_localson_fn5_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn5)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(1055), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp4;
+  chpl_check_nil(_args_foron_fn, INT64(1055), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_1_this = call_tmp3;
+  chpl_check_nil(_args_foron_fn, INT64(1055), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_2_value = INT64(1);
+  chpl_check_nil(_args_foron_fn, INT64(1055), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_3_order = default_argorder;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn5 ***/ chpl_executeOn(&call_tmp4, INT32(6), _args_foron_fn, sizeof(chpl__class_localson_fn5_object), INT64(1103), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  return *(x2);
+}
+
+/* ChapelBase.chpl:1054 */
+static chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F chpl__autoCopy4(chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const x2, int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_seq_cst;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseArr coerce_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseArr call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_refcnt call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder;
+  chpl_localeID_t call_tmp4;
+  _class_localson_fn5 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide_BaseArr chpl_macro_tmp_40;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_41;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_42;
+  local_memory_order_seq_cst = memory_order_seq_cst;
+  ret = *(x2);
+  chpl_macro_tmp_40.locale = (&ret)->locale;
+  chpl_macro_tmp_40.addr = ((BaseArr)((&ret)->addr));
+  call_tmp = chpl_macro_tmp_40;
+  coerce_tmp = call_tmp;
+  compilerAssert();
+  chpl_check_nil((&coerce_tmp)->addr, INT64(1055), "/root/repo/modules/internal/ChapelBase.chpl");
+  chpl_macro_tmp_41.locale = (&coerce_tmp)->locale;
+  chpl_macro_tmp_41.addr = &(((&coerce_tmp)->addr)->_arrCnt);
+  call_tmp2 = chpl_macro_tmp_41;
+  chpl_macro_tmp_42.locale = (call_tmp2).locale;
+  chpl_macro_tmp_42.addr = &(((call_tmp2).addr)->_cnt);
+  call_tmp3 = chpl_macro_tmp_42;
+  default_argorder = local_memory_order_seq_cst;
+  call_tmp4 = (&call_tmp3)->locale;
+  _args_size = sizeof(chpl__class_localson_fn5_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn5)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(1055), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp4;
+  chpl_check_nil(_args_foron_fn, INT64(1055), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_1_this = call_tmp3;
+  chpl_check_nil(_args_foron_fn, INT64(1055), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_2_value = INT64(1);
+  chpl_check_nil(_args_foron_fn, INT64(1055), "/root/repo/modules/internal/ChapelBase.chpl");
+  (_args_foron_fn)->_3_order = default_argorder;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn5 ***/ chpl_executeOn(&call_tmp4, INT32(6), _args_foron_fn, sizeof(chpl__class_localson_fn5_object), INT64(1103), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  return *(x2);
+}
+
+/* ChapelBase.chpl:1099 */
+static void chpl__autoDestroy(chpl____wide_DefaultDist* const x2, int64_t _ln, c_string _fn) {
+  chpl___TILDE__distribution(x2, _ln, _fn);
+  return;
+}
+
+/* ChapelBase.chpl:1104 */
+static void chpl__autoDestroy2(chpl____wide_DefaultRectangularDom_1_int64_t_F* const x2, int64_t _ln, c_string _fn) {
+  chpl___TILDE__domain(x2, _ln, _fn);
+  return;
+}
+
+/* ChapelBase.chpl:1109 */
+static void chpl__autoDestroy3(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const x2, int64_t _ln, c_string _fn) {
+  chpl___TILDE__array(x2, _ln, _fn);
+  return;
+}
+
+/* ChapelBase.chpl:1109 */
+static void chpl__autoDestroy4(chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const x2, int64_t _ln, c_string _fn) {
+  chpl___TILDE__array2(x2, _ln, _fn);
+  return;
+}
+
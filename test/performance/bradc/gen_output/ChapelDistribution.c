@@ -0,0 +1,2340 @@
+/* ChapelDistribution.chpl:21 */
+static void chpl__init_ChapelDistribution(int64_t _ln, c_string _fn) {
+  c_string modFormatStr;
+  c_string modStr;
+  _ref_int32_t refIndentLevel = NULL;
+  if (chpl__init_ChapelDistribution_p) {
+    goto _exit_chpl__init_ChapelDistribution;
+  }
+  modFormatStr = "%*s\n";
+  modStr = "ChapelDistribution";
+  printModuleInit(modFormatStr, modStr, INT64(18), _ln, _fn);
+  refIndentLevel = &moduleInitLevel;
+  *(refIndentLevel) += INT64(1);
+  chpl__init_ChapelDistribution_p = true;
+  {
+    chpl__init_List(_ln, _fn);
+  }
+  *(refIndentLevel) -= INT64(1);
+  _exit_chpl__init_ChapelDistribution:;
+  return;
+}
+
+/* ChapelDistribution.chpl:31 */
+static BaseDist _construct_BaseDist(atomic_refcnt* const _distCnt, list_BaseDom* const _doms, atomicflag* const _domsLock, BaseDist meme, int64_t _ln, c_string _fn) {
+  BaseDist this6 = NULL;
+  object T = NULL;
+  this6 = meme;
+  chpl_check_nil(this6, INT64(31), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  T = &((this6)->super);
+  _construct_object(T);
+  chpl_check_nil(this6, INT64(35), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (this6)->_distCnt = *(_distCnt);
+  chpl_check_nil(this6, INT64(36), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (this6)->_doms = *(_doms);
+  chpl_check_nil(this6, INT64(37), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (this6)->_domsLock = *(_domsLock);
+  return this6;
+}
+
+/* ChapelDistribution.chpl:31 */
+static void chpl__auto_destroy_BaseDist(BaseDist this6, int64_t _ln, c_string _fn) {
+  _ref_atomicflag _field_destructor_tmp_ = NULL;
+  _ref_atomic_flag call_tmp = NULL;
+  _ref_atomic_flag T = NULL;
+  _ref_atomic_refcnt _field_destructor_tmp_2 = NULL;
+  _ref_atomic_int64 _field_destructor_tmp_3 = NULL;
+  _ref_atomic_int_least64_t call_tmp2 = NULL;
+  _ref_atomic_int_least64_t T2 = NULL;
+  chpl_check_nil(this6, INT64(37), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _field_destructor_tmp_ = &((this6)->_domsLock);
+  chpl_check_nil(_field_destructor_tmp_, INT64(37), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  call_tmp = &((_field_destructor_tmp_)->_v);
+  T = call_tmp;
+  atomic_destroy_flag(T);
+  call_tmp = T;
+  chpl_check_nil(this6, INT64(35), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _field_destructor_tmp_2 = &((this6)->_distCnt);
+  chpl_check_nil(_field_destructor_tmp_2, INT64(35), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _field_destructor_tmp_3 = &((_field_destructor_tmp_2)->_cnt);
+  chpl_check_nil(_field_destructor_tmp_3, INT64(35), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  call_tmp2 = &((_field_destructor_tmp_3)->_v);
+  T2 = call_tmp2;
+  atomic_destroy_int_least64_t(T2);
+  call_tmp2 = T2;
+  return;
+}
+
+/* ChapelDistribution.chpl:40 */
+static int64_t destroyDist(chpl____wide_BaseDist* const this6, int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_seq_cst;
+  chpl____wide__ref_atomic_refcnt call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder;
+  heap_int64_t ret = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_int64_t T = NULL;
+  chpl_localeID_t call_tmp3;
+  _ref_int64_t T2 = NULL;
+  _class_localson_fn6 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_int64_t T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t T4;
+  int64_t call_tmp4;
+  chpl_bool call_tmp5;
+  c_string T5;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_466;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_467;
+  chpl____wide__ref_int64_t chpl_macro_tmp_468;
+  local_memory_order_seq_cst = memory_order_seq_cst;
+  compilerAssert();
+  compilerAssert();
+  chpl_check_nil((this6)->addr, INT64(42), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  chpl_macro_tmp_466.locale = (this6)->locale;
+  chpl_macro_tmp_466.addr = &(((this6)->addr)->_distCnt);
+  call_tmp = chpl_macro_tmp_466;
+  chpl_macro_tmp_467.locale = (call_tmp).locale;
+  chpl_macro_tmp_467.addr = &(((call_tmp).addr)->_cnt);
+  call_tmp2 = chpl_macro_tmp_467;
+  default_argorder = local_memory_order_seq_cst;
+  chpl_here_alloc_size = sizeof(chpl_heap_int64_t_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T = ((heap_int64_t)(chpl_here_alloc_tmp));
+  ret = T;
+  chpl_check_nil(ret, INT64(42), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (ret)->value = INT64(0);
+  call_tmp3 = (&call_tmp2)->locale;
+  chpl_check_nil(ret, INT64(42), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  T2 = &((ret)->value);
+  _args_size = sizeof(chpl__class_localson_fn6_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn6)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(42), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp3;
+  chpl_check_nil(_args_foron_fn, INT64(42), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_1_this = call_tmp2;
+  chpl_check_nil(_args_foron_fn, INT64(42), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_2_value = INT64(1);
+  chpl_check_nil(_args_foron_fn, INT64(42), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_3_order = default_argorder;
+  chpl_macro_tmp_468.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_468.addr = T2;
+  T3 = chpl_macro_tmp_468;
+  chpl_check_nil(_args_foron_fn, INT64(42), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_4__tmp = T3;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn6 ***/ chpl_executeOn(&call_tmp3, INT32(7), _args_foron_fn, sizeof(chpl__class_localson_fn6_object), INT64(1107), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  chpl_check_nil(ret, INT64(42), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  T4 = (ret)->value;
+  chpl_here_free(((void*)(ret)), _ln, _fn);
+  call_tmp4 = (T4 - INT64(1));
+  call_tmp5 = (call_tmp4 < INT64(0));
+  if (call_tmp5) {
+    T5 = "distribution reference count is negative!";
+    halt(T5, _ln, _fn);
+  }
+  return call_tmp4;
+}
+
+/* ChapelDistribution.chpl:46 */
+static void _local_on_fn3(chpl____wide_BaseDist* const this6, chpl____wide_BaseDom* const x2, int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_seq_cst;
+  chpl_bool T;
+  chpl____wide__ref_atomicflag call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  BaseDist local_this = NULL;
+  memory_order default_argorder;
+  heap_chpl_bool ret = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_chpl_bool T2 = NULL;
+  heap_chpl_bool local_ret = NULL;
+  chpl_localeID_t call_tmp2;
+  _ref_chpl_bool T3 = NULL;
+  heap_chpl_bool local_ret2 = NULL;
+  _class_localson_fn _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_chpl_bool T4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool T5;
+  heap_chpl_bool local_ret3 = NULL;
+  chpl____wide__ref_atomicflag call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  BaseDist local_this2 = NULL;
+  memory_order default_argorder2;
+  heap_chpl_bool ret2 = NULL;
+  int64_t chpl_here_alloc_size2;
+  chpl_opaque chpl_here_alloc_tmp2;
+  heap_chpl_bool T6 = NULL;
+  heap_chpl_bool local_ret4 = NULL;
+  chpl_localeID_t call_tmp4;
+  _ref_chpl_bool T7 = NULL;
+  heap_chpl_bool local_ret5 = NULL;
+  _class_localson_fn _args_foron_fn2 = NULL;
+  int64_t _args_size2;
+  chpl_opaque _args_alloc2;
+  chpl____wide__ref_chpl_bool T8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool T9;
+  heap_chpl_bool local_ret6 = NULL;
+  _ref_list_BaseDom call_tmp5 = NULL;
+  BaseDist local_this3 = NULL;
+  chpl____wide__ref_atomicflag call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  BaseDist local_this4 = NULL;
+  memory_order default_argorder3;
+  chpl_localeID_t call_tmp7;
+  _class_localson_fn2 _args_foron_fn3 = NULL;
+  int64_t _args_size3;
+  chpl_opaque _args_alloc3;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_469;
+  chpl____wide__ref_chpl_bool chpl_macro_tmp_470;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_471;
+  chpl____wide__ref_chpl_bool chpl_macro_tmp_472;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_473;
+  local_memory_order_seq_cst = memory_order_seq_cst;
+  chpl_check_local(chpl_nodeFromLocaleID(&((this6)->locale), INT64(0), NULL), _ln, _fn, "cannot access remote data in local block");
+  local_this = (this6)->addr;
+  chpl_check_nil(local_this, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  chpl_macro_tmp_469.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_469.addr = &((local_this)->_domsLock);
+  call_tmp = chpl_macro_tmp_469;
+  default_argorder = local_memory_order_seq_cst;
+  chpl_here_alloc_size = sizeof(chpl_heap_chpl_bool_object);
+  chpl_here_alloc_tmp = _local_chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T2 = ((heap_chpl_bool)(chpl_here_alloc_tmp));
+  ret = T2;
+  local_ret = ret;
+  chpl_check_nil(local_ret, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (local_ret)->value = false;
+  call_tmp2 = (&call_tmp)->locale;
+  local_ret2 = ret;
+  chpl_check_nil(local_ret2, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  T3 = &((local_ret2)->value);
+  _args_size = sizeof(chpl__class_localson_fn_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp2;
+  chpl_check_nil(_args_foron_fn, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_1_this = call_tmp;
+  chpl_check_nil(_args_foron_fn, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_2_order = default_argorder;
+  chpl_macro_tmp_470.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_470.addr = T3;
+  T4 = chpl_macro_tmp_470;
+  chpl_check_nil(_args_foron_fn, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_3__tmp = T4;
+  (_args_foron_fn)->_ln2 = _ln;
+  (_args_foron_fn)->_fn2 = _fn;
+  /*** _local_wrapon_fn ***/ chpl_executeOn(&call_tmp2, INT32(0), _args_foron_fn, sizeof(chpl__class_localson_fn_object), INT64(314), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  local_ret3 = ret;
+  chpl_check_nil(local_ret3, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  T5 = (local_ret3)->value;
+  _local_chpl_here_free(((void*)(ret)), _ln, _fn);
+  T = T5;
+  while (T) {
+    chpl_task_yield();
+    chpl_check_local(chpl_nodeFromLocaleID(&((this6)->locale), INT64(0), NULL), _ln, _fn, "cannot access remote data in local block");
+    local_this2 = (this6)->addr;
+    chpl_check_nil(local_this2, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    chpl_macro_tmp_471.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_471.addr = &((local_this2)->_domsLock);
+    call_tmp3 = chpl_macro_tmp_471;
+    default_argorder2 = local_memory_order_seq_cst;
+    chpl_here_alloc_size2 = sizeof(chpl_heap_chpl_bool_object);
+    chpl_here_alloc_tmp2 = _local_chpl_here_alloc(chpl_here_alloc_size2, INT16(22), _ln, _fn);
+    T6 = ((heap_chpl_bool)(chpl_here_alloc_tmp2));
+    ret2 = T6;
+    local_ret4 = ret2;
+    chpl_check_nil(local_ret4, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (local_ret4)->value = false;
+    call_tmp4 = (&call_tmp3)->locale;
+    local_ret5 = ret2;
+    chpl_check_nil(local_ret5, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    T7 = &((local_ret5)->value);
+    _args_size2 = sizeof(chpl__class_localson_fn_object);
+    _args_alloc2 = chpl_mem_allocPooled(_args_size2, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn2 = ((_class_localson_fn)(_args_alloc2));
+    chpl_check_nil(_args_foron_fn2, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_0__tmp = call_tmp4;
+    chpl_check_nil(_args_foron_fn2, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_1_this = call_tmp3;
+    chpl_check_nil(_args_foron_fn2, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_2_order = default_argorder2;
+    chpl_macro_tmp_472.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_472.addr = T7;
+    T8 = chpl_macro_tmp_472;
+    chpl_check_nil(_args_foron_fn2, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_3__tmp = T8;
+    (_args_foron_fn2)->_ln2 = _ln;
+    (_args_foron_fn2)->_fn2 = _fn;
+    /*** _local_wrapon_fn ***/ chpl_executeOn(&call_tmp4, INT32(0), _args_foron_fn2, sizeof(chpl__class_localson_fn_object), INT64(314), "/root/repo/modules/internal/Atomics.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn2)), _ln, _fn);
+    local_ret6 = ret2;
+    chpl_check_nil(local_ret6, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    T9 = (local_ret6)->value;
+    _local_chpl_here_free(((void*)(ret2)), _ln, _fn);
+    T = T9;
+  }
+  chpl_check_local(chpl_nodeFromLocaleID(&((this6)->locale), INT64(0), NULL), _ln, _fn, "cannot access remote data in local block");
+  local_this3 = (this6)->addr;
+  chpl_check_nil(local_this3, INT64(48), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  call_tmp5 = &((local_this3)->_doms);
+  chpl_check_nil(call_tmp5, INT64(48), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _local_remove(call_tmp5, x2, _ln, _fn);
+  chpl_check_local(chpl_nodeFromLocaleID(&((this6)->locale), INT64(0), NULL), _ln, _fn, "cannot access remote data in local block");
+  local_this4 = (this6)->addr;
+  chpl_check_nil(local_this4, INT64(49), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  chpl_macro_tmp_473.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_473.addr = &((local_this4)->_domsLock);
+  call_tmp6 = chpl_macro_tmp_473;
+  default_argorder3 = local_memory_order_seq_cst;
+  call_tmp7 = (&call_tmp6)->locale;
+  _args_size3 = sizeof(chpl__class_localson_fn2_object);
+  _args_alloc3 = chpl_mem_allocPooled(_args_size3, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn3 = ((_class_localson_fn2)(_args_alloc3));
+  chpl_check_nil(_args_foron_fn3, INT64(49), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn3)->_0__tmp = call_tmp7;
+  chpl_check_nil(_args_foron_fn3, INT64(49), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn3)->_1_this = call_tmp6;
+  chpl_check_nil(_args_foron_fn3, INT64(49), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn3)->_2_order = default_argorder3;
+  (_args_foron_fn3)->_ln2 = _ln;
+  (_args_foron_fn3)->_fn2 = _fn;
+  /*** _local_wrapon_fn2 ***/ chpl_executeOn(&call_tmp7, INT32(2), _args_foron_fn3, sizeof(chpl__class_localson_fn2_object), INT64(318), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn3)), _ln, _fn);
+  return;
+}
+
+/* ChapelDistribution.chpl:46 */
+static void on_fn21(chpl____wide_BaseDist* const this6, chpl____wide_BaseDom* const x2, int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_seq_cst;
+  chpl_bool T;
+  chpl____wide__ref_atomicflag call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder;
+  heap_chpl_bool ret = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_chpl_bool T2 = NULL;
+  chpl_localeID_t call_tmp2;
+  _ref_chpl_bool T3 = NULL;
+  _class_localson_fn _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_chpl_bool T4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool T5;
+  chpl____wide__ref_atomicflag call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder2;
+  heap_chpl_bool ret2 = NULL;
+  int64_t chpl_here_alloc_size2;
+  chpl_opaque chpl_here_alloc_tmp2;
+  heap_chpl_bool T6 = NULL;
+  chpl_localeID_t call_tmp4;
+  _ref_chpl_bool T7 = NULL;
+  _class_localson_fn _args_foron_fn2 = NULL;
+  int64_t _args_size2;
+  chpl_opaque _args_alloc2;
+  chpl____wide__ref_chpl_bool T8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool T9;
+  chpl____wide__ref_list_BaseDom call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomicflag call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder3;
+  chpl_localeID_t call_tmp7;
+  _class_localson_fn2 _args_foron_fn3 = NULL;
+  int64_t _args_size3;
+  chpl_opaque _args_alloc3;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_474;
+  chpl____wide__ref_chpl_bool chpl_macro_tmp_475;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_476;
+  chpl____wide__ref_chpl_bool chpl_macro_tmp_477;
+  chpl____wide__ref_list_BaseDom chpl_macro_tmp_478;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_479;
+  local_memory_order_seq_cst = memory_order_seq_cst;
+  chpl_check_nil((this6)->addr, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  chpl_macro_tmp_474.locale = (this6)->locale;
+  chpl_macro_tmp_474.addr = &(((this6)->addr)->_domsLock);
+  call_tmp = chpl_macro_tmp_474;
+  default_argorder = local_memory_order_seq_cst;
+  chpl_here_alloc_size = sizeof(chpl_heap_chpl_bool_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T2 = ((heap_chpl_bool)(chpl_here_alloc_tmp));
+  ret = T2;
+  chpl_check_nil(ret, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (ret)->value = false;
+  call_tmp2 = (&call_tmp)->locale;
+  chpl_check_nil(ret, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  T3 = &((ret)->value);
+  _args_size = sizeof(chpl__class_localson_fn_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp2;
+  chpl_check_nil(_args_foron_fn, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_1_this = call_tmp;
+  chpl_check_nil(_args_foron_fn, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_2_order = default_argorder;
+  chpl_macro_tmp_475.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_475.addr = T3;
+  T4 = chpl_macro_tmp_475;
+  chpl_check_nil(_args_foron_fn, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_3__tmp = T4;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn ***/ chpl_executeOn(&call_tmp2, INT32(1), _args_foron_fn, sizeof(chpl__class_localson_fn_object), INT64(314), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  chpl_check_nil(ret, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  T5 = (ret)->value;
+  chpl_here_free(((void*)(ret)), _ln, _fn);
+  T = T5;
+  while (T) {
+    chpl_task_yield();
+    chpl_check_nil((this6)->addr, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    chpl_macro_tmp_476.locale = (this6)->locale;
+    chpl_macro_tmp_476.addr = &(((this6)->addr)->_domsLock);
+    call_tmp3 = chpl_macro_tmp_476;
+    default_argorder2 = local_memory_order_seq_cst;
+    chpl_here_alloc_size2 = sizeof(chpl_heap_chpl_bool_object);
+    chpl_here_alloc_tmp2 = chpl_here_alloc(chpl_here_alloc_size2, INT16(22), _ln, _fn);
+    T6 = ((heap_chpl_bool)(chpl_here_alloc_tmp2));
+    ret2 = T6;
+    chpl_check_nil(ret2, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (ret2)->value = false;
+    call_tmp4 = (&call_tmp3)->locale;
+    chpl_check_nil(ret2, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    T7 = &((ret2)->value);
+    _args_size2 = sizeof(chpl__class_localson_fn_object);
+    _args_alloc2 = chpl_mem_allocPooled(_args_size2, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn2 = ((_class_localson_fn)(_args_alloc2));
+    chpl_check_nil(_args_foron_fn2, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_0__tmp = call_tmp4;
+    chpl_check_nil(_args_foron_fn2, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_1_this = call_tmp3;
+    chpl_check_nil(_args_foron_fn2, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_2_order = default_argorder2;
+    chpl_macro_tmp_477.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_477.addr = T7;
+    T8 = chpl_macro_tmp_477;
+    chpl_check_nil(_args_foron_fn2, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_3__tmp = T8;
+    (_args_foron_fn2)->_ln = _ln;
+    (_args_foron_fn2)->_fn = _fn;
+    /*** wrapon_fn ***/ chpl_executeOn(&call_tmp4, INT32(1), _args_foron_fn2, sizeof(chpl__class_localson_fn_object), INT64(314), "/root/repo/modules/internal/Atomics.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn2)), _ln, _fn);
+    chpl_check_nil(ret2, INT64(47), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    T9 = (ret2)->value;
+    chpl_here_free(((void*)(ret2)), _ln, _fn);
+    T = T9;
+  }
+  chpl_check_nil((this6)->addr, INT64(48), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  chpl_macro_tmp_478.locale = (this6)->locale;
+  chpl_macro_tmp_478.addr = &(((this6)->addr)->_doms);
+  call_tmp5 = chpl_macro_tmp_478;
+  remove2(&call_tmp5, x2, _ln, _fn);
+  chpl_check_nil((this6)->addr, INT64(49), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  chpl_macro_tmp_479.locale = (this6)->locale;
+  chpl_macro_tmp_479.addr = &(((this6)->addr)->_domsLock);
+  call_tmp6 = chpl_macro_tmp_479;
+  default_argorder3 = local_memory_order_seq_cst;
+  call_tmp7 = (&call_tmp6)->locale;
+  _args_size3 = sizeof(chpl__class_localson_fn2_object);
+  _args_alloc3 = chpl_mem_allocPooled(_args_size3, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn3 = ((_class_localson_fn2)(_args_alloc3));
+  chpl_check_nil(_args_foron_fn3, INT64(49), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn3)->_0__tmp = call_tmp7;
+  chpl_check_nil(_args_foron_fn3, INT64(49), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn3)->_1_this = call_tmp6;
+  chpl_check_nil(_args_foron_fn3, INT64(49), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn3)->_2_order = default_argorder3;
+  (_args_foron_fn3)->_ln = _ln;
+  (_args_foron_fn3)->_fn = _fn;
+  /*** wrapon_fn2 ***/ chpl_executeOn(&call_tmp7, INT32(3), _args_foron_fn3, sizeof(chpl__class_localson_fn2_object), INT64(318), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn3)), _ln, _fn);
+  return;
+}
+
+/* ChapelDistribution.chpl:46 */
+static void _local_wrapon_fn3(_class_localson_fn21 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_BaseDist _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDom _2_x = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln2;
+  _fn = (c)->_fn2;
+  chpl_check_nil(c, INT64(46), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _1_this = (c)->_1_this;
+  chpl_check_nil(c, INT64(46), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _2_x = (c)->_2_x;
+  _local_on_fn3(&_1_this, &_2_x, _ln, _fn);
+  return;
+}
+
+/* ChapelDistribution.chpl:46 */
+static void wrapon_fn21(_class_localson_fn21 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_BaseDist _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDom _2_x = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(46), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _1_this = (c)->_1_this;
+  chpl_check_nil(c, INT64(46), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _2_x = (c)->_2_x;
+  on_fn21(&_1_this, &_2_x, _ln, _fn);
+  return;
+}
+
+/* ChapelDistribution.chpl:110 */
+static void dsiDestroyDistClass(chpl____wide_BaseDist* const this6) {
+  return;
+}
+
+/* ChapelDistribution.chpl:119 */
+static BaseDom _construct_BaseDom(atomic_refcnt* const _domCnt, list_BaseArr* const _arrs, atomicflag* const _arrsLock, BaseDom meme, int64_t _ln, c_string _fn) {
+  BaseDom this6 = NULL;
+  object T = NULL;
+  this6 = meme;
+  chpl_check_nil(this6, INT64(119), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  T = &((this6)->super);
+  _construct_object(T);
+  chpl_check_nil(this6, INT64(123), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (this6)->_domCnt = *(_domCnt);
+  chpl_check_nil(this6, INT64(124), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (this6)->_arrs = *(_arrs);
+  chpl_check_nil(this6, INT64(125), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (this6)->_arrsLock = *(_arrsLock);
+  return this6;
+}
+
+/* ChapelDistribution.chpl:119 */
+static void chpl__auto_destroy_BaseDom(BaseDom this6, int64_t _ln, c_string _fn) {
+  _ref_atomicflag _field_destructor_tmp_ = NULL;
+  _ref_atomic_flag call_tmp = NULL;
+  _ref_atomic_flag T = NULL;
+  _ref_atomic_refcnt _field_destructor_tmp_2 = NULL;
+  _ref_atomic_int64 _field_destructor_tmp_3 = NULL;
+  _ref_atomic_int_least64_t call_tmp2 = NULL;
+  _ref_atomic_int_least64_t T2 = NULL;
+  chpl_check_nil(this6, INT64(125), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _field_destructor_tmp_ = &((this6)->_arrsLock);
+  chpl_check_nil(_field_destructor_tmp_, INT64(125), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  call_tmp = &((_field_destructor_tmp_)->_v);
+  T = call_tmp;
+  atomic_destroy_flag(T);
+  call_tmp = T;
+  chpl_check_nil(this6, INT64(123), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _field_destructor_tmp_2 = &((this6)->_domCnt);
+  chpl_check_nil(_field_destructor_tmp_2, INT64(123), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _field_destructor_tmp_3 = &((_field_destructor_tmp_2)->_cnt);
+  chpl_check_nil(_field_destructor_tmp_3, INT64(123), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  call_tmp2 = &((_field_destructor_tmp_3)->_v);
+  T2 = call_tmp2;
+  atomic_destroy_int_least64_t(T2);
+  call_tmp2 = T2;
+  return;
+}
+
+/* ChapelDistribution.chpl:127 */
+static BaseDist dsiMyDist(chpl____wide_BaseDom* const this6, int64_t _ln, c_string _fn) {
+  BaseDist ret = NULL;
+  c_string T;
+  T = "internal error: dsiMyDist is not implemented";
+  halt(T, _ln, _fn);
+  ret = nil;
+  return ret;
+}
+
+/* ChapelDistribution.chpl:133 */
+static int64_t destroyDom(chpl____wide_BaseDom* const this6, int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_seq_cst;
+  chpl____wide__ref_atomic_refcnt call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder;
+  heap_int64_t ret = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_int64_t T = NULL;
+  chpl_localeID_t call_tmp3;
+  _ref_int64_t T2 = NULL;
+  _class_localson_fn6 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_int64_t T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t T4;
+  int64_t call_tmp4;
+  chpl_bool call_tmp5;
+  c_string T5;
+  chpl_bool call_tmp6;
+  chpl_bool T6;
+  chpl_bool call_tmp7;
+  int32_t _virtual_method_tmp_;
+  chpl____wide_BaseDist call_tmp8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp9;
+  chpl____wide_BaseDist rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn22 _args_foron_fn2 = NULL;
+  int64_t _args_size2;
+  chpl_opaque _args_alloc2;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_480;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_481;
+  chpl____wide__ref_int64_t chpl_macro_tmp_482;
+  chpl____wide__ref_int32_t chpl_macro_tmp_483;
+  chpl____wide_BaseDist chpl_macro_tmp_484;
+  local_memory_order_seq_cst = memory_order_seq_cst;
+  compilerAssert();
+  compilerAssert();
+  chpl_check_nil((this6)->addr, INT64(135), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  chpl_macro_tmp_480.locale = (this6)->locale;
+  chpl_macro_tmp_480.addr = &(((this6)->addr)->_domCnt);
+  call_tmp = chpl_macro_tmp_480;
+  chpl_macro_tmp_481.locale = (call_tmp).locale;
+  chpl_macro_tmp_481.addr = &(((call_tmp).addr)->_cnt);
+  call_tmp2 = chpl_macro_tmp_481;
+  default_argorder = local_memory_order_seq_cst;
+  chpl_here_alloc_size = sizeof(chpl_heap_int64_t_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T = ((heap_int64_t)(chpl_here_alloc_tmp));
+  ret = T;
+  chpl_check_nil(ret, INT64(135), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (ret)->value = INT64(0);
+  call_tmp3 = (&call_tmp2)->locale;
+  chpl_check_nil(ret, INT64(135), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  T2 = &((ret)->value);
+  _args_size = sizeof(chpl__class_localson_fn6_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn6)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(135), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp3;
+  chpl_check_nil(_args_foron_fn, INT64(135), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_1_this = call_tmp2;
+  chpl_check_nil(_args_foron_fn, INT64(135), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_2_value = INT64(1);
+  chpl_check_nil(_args_foron_fn, INT64(135), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_3_order = default_argorder;
+  chpl_macro_tmp_482.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_482.addr = T2;
+  T3 = chpl_macro_tmp_482;
+  chpl_check_nil(_args_foron_fn, INT64(135), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_4__tmp = T3;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn6 ***/ chpl_executeOn(&call_tmp3, INT32(7), _args_foron_fn, sizeof(chpl__class_localson_fn6_object), INT64(1107), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  chpl_check_nil(ret, INT64(135), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  T4 = (ret)->value;
+  chpl_here_free(((void*)(ret)), _ln, _fn);
+  call_tmp4 = (T4 - INT64(1));
+  call_tmp5 = (call_tmp4 < INT64(0));
+  if (call_tmp5) {
+    T5 = "domain reference count is negative!";
+    halt(T5, _ln, _fn);
+  }
+  call_tmp6 = (call_tmp4 == INT64(0));
+  if (call_tmp6) {
+    chpl_check_nil((this6)->addr, INT64(136), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    chpl_macro_tmp_483.locale = (this6)->locale;
+    chpl_macro_tmp_483.addr = &(((object)((this6)->addr))->chpl__cid);
+    chpl_gen_comm_get(((void*)(&_virtual_method_tmp_)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_483).locale), INT64(0), NULL), (chpl_macro_tmp_483).addr, sizeof(int32_t), -1, INT64(1), INT64(136), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    call_tmp7 = ((chpl_bool(*)(chpl____wide_BaseDom* const))chpl_vmtable[((INT64(4) * _virtual_method_tmp_) + INT64(1))])(this6);
+    T6 = call_tmp7;
+  } else {
+    T6 = false;
+  }
+  if (T6) {
+    chpl_check_nil((this6)->addr, INT64(137), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    chpl_macro_tmp_484.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_484.addr = dsiMyDist(this6, _ln, _fn);
+    call_tmp8 = chpl_macro_tmp_484;
+    call_tmp9 = (&call_tmp8)->locale;
+    rvfDerefTmp = call_tmp8;
+    _args_size2 = sizeof(chpl__class_localson_fn22_object);
+    _args_alloc2 = chpl_mem_allocPooled(_args_size2, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn2 = ((_class_localson_fn22)(_args_alloc2));
+    chpl_check_nil(_args_foron_fn2, INT64(138), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_0__tmp = call_tmp9;
+    chpl_check_nil(_args_foron_fn2, INT64(138), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_1_rvfDerefTmp = rvfDerefTmp;
+    chpl_check_nil(_args_foron_fn2, INT64(138), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_2_this = *(this6);
+    (_args_foron_fn2)->_ln = _ln;
+    (_args_foron_fn2)->_fn = _fn;
+    /*** wrapon_fn22 ***/ chpl_executeOn(&call_tmp9, INT32(24), _args_foron_fn2, sizeof(chpl__class_localson_fn22_object), INT64(138), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn2)), _ln, _fn);
+  }
+  return call_tmp4;
+}
+
+/* ChapelDistribution.chpl:138 */
+static void on_fn22(chpl____wide_BaseDist* const dist2, chpl____wide_BaseDom* const this6, int64_t _ln, c_string _fn) {
+  chpl_localeID_t call_tmp;
+  _class_localson_fn21 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  int64_t call_tmp2;
+  chpl_bool call_tmp3;
+  chpl____wide_BaseDist delete_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool _dynamic_dispatch_tmp_;
+  chpl____wide_DefaultDist _cast_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDist _parent_destructor_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomicflag _field_destructor_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_flag call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_flag T = NULL;
+  chpl____wide__ref_atomic_refcnt _field_destructor_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 _field_destructor_tmp_3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int_least64_t call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_int_least64_t T2 = NULL;
+  chpl____wide__ref_atomicflag _field_destructor_tmp_4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_flag call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_flag T3 = NULL;
+  chpl____wide__ref_atomic_refcnt _field_destructor_tmp_5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 _field_destructor_tmp_6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int_least64_t call_tmp7 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_int_least64_t T4 = NULL;
+  chpl_localeID_t call_tmp8;
+  chpl____wide_BaseDist rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn23 _args_foron_fn2 = NULL;
+  int64_t _args_size2;
+  chpl_opaque _args_alloc2;
+  chpl____wide__ref_int32_t chpl_macro_tmp_485;
+  int32_t chpl_macro_tmp_486;
+  chpl____wide_DefaultDist chpl_macro_tmp_487;
+  chpl____wide_BaseDist chpl_macro_tmp_488;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_489;
+  chpl____wide__ref_atomic_flag chpl_macro_tmp_490;
+  chpl____wide__ref_atomic_flag chpl_macro_tmp_491;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_492;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_493;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_494;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_495;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_496;
+  chpl____wide__ref_atomic_flag chpl_macro_tmp_497;
+  chpl____wide__ref_atomic_flag chpl_macro_tmp_498;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_499;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_500;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_501;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_502;
+  {
+    call_tmp = (dist2)->locale;
+    _args_size = sizeof(chpl__class_localson_fn21_object);
+    _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn = ((_class_localson_fn21)(_args_alloc));
+    chpl_check_nil(_args_foron_fn, INT64(139), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn)->_0__tmp = call_tmp;
+    chpl_check_nil(_args_foron_fn, INT64(139), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn)->_1_this = *(dist2);
+    chpl_check_nil(_args_foron_fn, INT64(139), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn)->_2_x = *(this6);
+    (_args_foron_fn)->_ln2 = _ln;
+    (_args_foron_fn)->_fn2 = _fn;
+    /*** _local_wrapon_fn3 ***/ chpl_executeOn(&call_tmp, INT32(22), _args_foron_fn, sizeof(chpl__class_localson_fn21_object), INT64(46), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  }
+  chpl_check_nil((dist2)->addr, INT64(140), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  call_tmp2 = destroyDist(dist2, _ln, _fn);
+  call_tmp3 = (call_tmp2 == INT64(0));
+  if (call_tmp3) {
+    delete_tmp = *(dist2);
+    chpl_check_nil((dist2)->addr, INT64(142), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    chpl_macro_tmp_485.locale = (dist2)->locale;
+    chpl_macro_tmp_485.addr = &(((object)((dist2)->addr))->chpl__cid);
+    chpl_gen_comm_get(((void*)(&chpl_macro_tmp_486)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_485).locale), INT64(0), NULL), (chpl_macro_tmp_485).addr, sizeof(int32_t), -1, INT64(1), INT64(142), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    _dynamic_dispatch_tmp_ = (chpl_macro_tmp_486 == chpl__cid_DefaultDist);
+    if (_dynamic_dispatch_tmp_) {
+      chpl_macro_tmp_487.locale = (dist2)->locale;
+      chpl_macro_tmp_487.addr = ((DefaultDist)((dist2)->addr));
+      _cast_tmp_ = chpl_macro_tmp_487;
+      chpl_macro_tmp_488.locale = (&_cast_tmp_)->locale;
+      chpl_macro_tmp_488.addr = ((BaseDist)((&_cast_tmp_)->addr));
+      _parent_destructor_tmp_ = chpl_macro_tmp_488;
+      chpl_check_nil((&_parent_destructor_tmp_)->addr, INT64(142), "/root/repo/modules/internal/ChapelDistribution.chpl");
+      chpl_macro_tmp_489.locale = (&_parent_destructor_tmp_)->locale;
+      chpl_macro_tmp_489.addr = &(((&_parent_destructor_tmp_)->addr)->_domsLock);
+      _field_destructor_tmp_ = chpl_macro_tmp_489;
+      chpl_macro_tmp_490.locale = (_field_destructor_tmp_).locale;
+      chpl_macro_tmp_490.addr = &(((_field_destructor_tmp_).addr)->_v);
+      call_tmp4 = chpl_macro_tmp_490;
+      T = (&call_tmp4)->addr;
+      atomic_destroy_flag(T);
+      chpl_macro_tmp_491.locale = chpl_gen_getLocaleID();
+      chpl_macro_tmp_491.addr = T;
+      call_tmp4 = chpl_macro_tmp_491;
+      chpl_check_nil((&_parent_destructor_tmp_)->addr, INT64(142), "/root/repo/modules/internal/ChapelDistribution.chpl");
+      chpl_macro_tmp_492.locale = (&_parent_destructor_tmp_)->locale;
+      chpl_macro_tmp_492.addr = &(((&_parent_destructor_tmp_)->addr)->_distCnt);
+      _field_destructor_tmp_2 = chpl_macro_tmp_492;
+      chpl_macro_tmp_493.locale = (_field_destructor_tmp_2).locale;
+      chpl_macro_tmp_493.addr = &(((_field_destructor_tmp_2).addr)->_cnt);
+      _field_destructor_tmp_3 = chpl_macro_tmp_493;
+      chpl_macro_tmp_494.locale = (_field_destructor_tmp_3).locale;
+      chpl_macro_tmp_494.addr = &(((_field_destructor_tmp_3).addr)->_v);
+      call_tmp5 = chpl_macro_tmp_494;
+      T2 = (&call_tmp5)->addr;
+      atomic_destroy_int_least64_t(T2);
+      chpl_macro_tmp_495.locale = chpl_gen_getLocaleID();
+      chpl_macro_tmp_495.addr = T2;
+      call_tmp5 = chpl_macro_tmp_495;
+    } else {
+      chpl_check_nil((&delete_tmp)->addr, INT64(142), "/root/repo/modules/internal/ChapelDistribution.chpl");
+      chpl_macro_tmp_496.locale = (&delete_tmp)->locale;
+      chpl_macro_tmp_496.addr = &(((&delete_tmp)->addr)->_domsLock);
+      _field_destructor_tmp_4 = chpl_macro_tmp_496;
+      chpl_macro_tmp_497.locale = (_field_destructor_tmp_4).locale;
+      chpl_macro_tmp_497.addr = &(((_field_destructor_tmp_4).addr)->_v);
+      call_tmp6 = chpl_macro_tmp_497;
+      T3 = (&call_tmp6)->addr;
+      atomic_destroy_flag(T3);
+      chpl_macro_tmp_498.locale = chpl_gen_getLocaleID();
+      chpl_macro_tmp_498.addr = T3;
+      call_tmp6 = chpl_macro_tmp_498;
+      chpl_check_nil((&delete_tmp)->addr, INT64(142), "/root/repo/modules/internal/ChapelDistribution.chpl");
+      chpl_macro_tmp_499.locale = (&delete_tmp)->locale;
+      chpl_macro_tmp_499.addr = &(((&delete_tmp)->addr)->_distCnt);
+      _field_destructor_tmp_5 = chpl_macro_tmp_499;
+      chpl_macro_tmp_500.locale = (_field_destructor_tmp_5).locale;
+      chpl_macro_tmp_500.addr = &(((_field_destructor_tmp_5).addr)->_cnt);
+      _field_destructor_tmp_6 = chpl_macro_tmp_500;
+      chpl_macro_tmp_501.locale = (_field_destructor_tmp_6).locale;
+      chpl_macro_tmp_501.addr = &(((_field_destructor_tmp_6).addr)->_v);
+      call_tmp7 = chpl_macro_tmp_501;
+      T4 = (&call_tmp7)->addr;
+      atomic_destroy_int_least64_t(T4);
+      chpl_macro_tmp_502.locale = chpl_gen_getLocaleID();
+      chpl_macro_tmp_502.addr = T4;
+      call_tmp7 = chpl_macro_tmp_502;
+    }
+    call_tmp8 = (&delete_tmp)->locale;
+    rvfDerefTmp = delete_tmp;
+    _args_size2 = sizeof(chpl__class_localson_fn23_object);
+    _args_alloc2 = chpl_mem_allocPooled(_args_size2, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn2 = ((_class_localson_fn23)(_args_alloc2));
+    chpl_check_nil(_args_foron_fn2, INT64(142), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_0__tmp = call_tmp8;
+    chpl_check_nil(_args_foron_fn2, INT64(142), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_1_rvfDerefTmp = rvfDerefTmp;
+    (_args_foron_fn2)->_ln = _ln;
+    (_args_foron_fn2)->_fn = _fn;
+    /*** wrapon_fn23 ***/ chpl_executeOn(&call_tmp8, INT32(25), _args_foron_fn2, sizeof(chpl__class_localson_fn23_object), INT64(142), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn2)), _ln, _fn);
+  }
+  return;
+}
+
+/* ChapelDistribution.chpl:138 */
+static void wrapon_fn22(_class_localson_fn22 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_BaseDist _1_rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDom _2_this = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(138), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _1_rvfDerefTmp = (c)->_1_rvfDerefTmp;
+  chpl_check_nil(c, INT64(138), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _2_this = (c)->_2_this;
+  on_fn22(&_1_rvfDerefTmp, &_2_this, _ln, _fn);
+  return;
+}
+
+/* ChapelDistribution.chpl:142 */
+static void on_fn23(chpl____wide_BaseDist* const delete_tmp, int64_t _ln, c_string _fn) {
+  chpl_opaque call_tmp;
+  call_tmp = ((void*)((delete_tmp)->addr));
+  chpl_here_free(call_tmp, _ln, _fn);
+  return;
+}
+
+/* ChapelDistribution.chpl:142 */
+static void wrapon_fn23(_class_localson_fn23 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_BaseDist _1_rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(142), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _1_rvfDerefTmp = (c)->_1_rvfDerefTmp;
+  on_fn23(&_1_rvfDerefTmp, _ln, _fn);
+  return;
+}
+
+/* ChapelDistribution.chpl:149 */
+static void _local_on_fn4(chpl____wide_BaseDom* const this6, chpl____wide_BaseArr* const x2, int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_seq_cst;
+  chpl_bool T;
+  chpl____wide__ref_atomicflag call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  BaseDom local_this = NULL;
+  memory_order default_argorder;
+  heap_chpl_bool ret = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_chpl_bool T2 = NULL;
+  heap_chpl_bool local_ret = NULL;
+  chpl_localeID_t call_tmp2;
+  _ref_chpl_bool T3 = NULL;
+  heap_chpl_bool local_ret2 = NULL;
+  _class_localson_fn _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_chpl_bool T4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool T5;
+  heap_chpl_bool local_ret3 = NULL;
+  chpl____wide__ref_atomicflag call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  BaseDom local_this2 = NULL;
+  memory_order default_argorder2;
+  heap_chpl_bool ret2 = NULL;
+  int64_t chpl_here_alloc_size2;
+  chpl_opaque chpl_here_alloc_tmp2;
+  heap_chpl_bool T6 = NULL;
+  heap_chpl_bool local_ret4 = NULL;
+  chpl_localeID_t call_tmp4;
+  _ref_chpl_bool T7 = NULL;
+  heap_chpl_bool local_ret5 = NULL;
+  _class_localson_fn _args_foron_fn2 = NULL;
+  int64_t _args_size2;
+  chpl_opaque _args_alloc2;
+  chpl____wide__ref_chpl_bool T8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool T9;
+  heap_chpl_bool local_ret6 = NULL;
+  _ref_list_BaseArr call_tmp5 = NULL;
+  BaseDom local_this3 = NULL;
+  chpl____wide__ref_atomicflag call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  BaseDom local_this4 = NULL;
+  memory_order default_argorder3;
+  chpl_localeID_t call_tmp7;
+  _class_localson_fn2 _args_foron_fn3 = NULL;
+  int64_t _args_size3;
+  chpl_opaque _args_alloc3;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_503;
+  chpl____wide__ref_chpl_bool chpl_macro_tmp_504;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_505;
+  chpl____wide__ref_chpl_bool chpl_macro_tmp_506;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_507;
+  local_memory_order_seq_cst = memory_order_seq_cst;
+  chpl_check_local(chpl_nodeFromLocaleID(&((this6)->locale), INT64(0), NULL), _ln, _fn, "cannot access remote data in local block");
+  local_this = (this6)->addr;
+  chpl_check_nil(local_this, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  chpl_macro_tmp_503.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_503.addr = &((local_this)->_arrsLock);
+  call_tmp = chpl_macro_tmp_503;
+  default_argorder = local_memory_order_seq_cst;
+  chpl_here_alloc_size = sizeof(chpl_heap_chpl_bool_object);
+  chpl_here_alloc_tmp = _local_chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T2 = ((heap_chpl_bool)(chpl_here_alloc_tmp));
+  ret = T2;
+  local_ret = ret;
+  chpl_check_nil(local_ret, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (local_ret)->value = false;
+  call_tmp2 = (&call_tmp)->locale;
+  local_ret2 = ret;
+  chpl_check_nil(local_ret2, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  T3 = &((local_ret2)->value);
+  _args_size = sizeof(chpl__class_localson_fn_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp2;
+  chpl_check_nil(_args_foron_fn, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_1_this = call_tmp;
+  chpl_check_nil(_args_foron_fn, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_2_order = default_argorder;
+  chpl_macro_tmp_504.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_504.addr = T3;
+  T4 = chpl_macro_tmp_504;
+  chpl_check_nil(_args_foron_fn, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_3__tmp = T4;
+  (_args_foron_fn)->_ln2 = _ln;
+  (_args_foron_fn)->_fn2 = _fn;
+  /*** _local_wrapon_fn ***/ chpl_executeOn(&call_tmp2, INT32(0), _args_foron_fn, sizeof(chpl__class_localson_fn_object), INT64(314), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  local_ret3 = ret;
+  chpl_check_nil(local_ret3, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  T5 = (local_ret3)->value;
+  _local_chpl_here_free(((void*)(ret)), _ln, _fn);
+  T = T5;
+  while (T) {
+    chpl_task_yield();
+    chpl_check_local(chpl_nodeFromLocaleID(&((this6)->locale), INT64(0), NULL), _ln, _fn, "cannot access remote data in local block");
+    local_this2 = (this6)->addr;
+    chpl_check_nil(local_this2, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    chpl_macro_tmp_505.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_505.addr = &((local_this2)->_arrsLock);
+    call_tmp3 = chpl_macro_tmp_505;
+    default_argorder2 = local_memory_order_seq_cst;
+    chpl_here_alloc_size2 = sizeof(chpl_heap_chpl_bool_object);
+    chpl_here_alloc_tmp2 = _local_chpl_here_alloc(chpl_here_alloc_size2, INT16(22), _ln, _fn);
+    T6 = ((heap_chpl_bool)(chpl_here_alloc_tmp2));
+    ret2 = T6;
+    local_ret4 = ret2;
+    chpl_check_nil(local_ret4, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (local_ret4)->value = false;
+    call_tmp4 = (&call_tmp3)->locale;
+    local_ret5 = ret2;
+    chpl_check_nil(local_ret5, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    T7 = &((local_ret5)->value);
+    _args_size2 = sizeof(chpl__class_localson_fn_object);
+    _args_alloc2 = chpl_mem_allocPooled(_args_size2, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn2 = ((_class_localson_fn)(_args_alloc2));
+    chpl_check_nil(_args_foron_fn2, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_0__tmp = call_tmp4;
+    chpl_check_nil(_args_foron_fn2, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_1_this = call_tmp3;
+    chpl_check_nil(_args_foron_fn2, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_2_order = default_argorder2;
+    chpl_macro_tmp_506.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_506.addr = T7;
+    T8 = chpl_macro_tmp_506;
+    chpl_check_nil(_args_foron_fn2, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_3__tmp = T8;
+    (_args_foron_fn2)->_ln2 = _ln;
+    (_args_foron_fn2)->_fn2 = _fn;
+    /*** _local_wrapon_fn ***/ chpl_executeOn(&call_tmp4, INT32(0), _args_foron_fn2, sizeof(chpl__class_localson_fn_object), INT64(314), "/root/repo/modules/internal/Atomics.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn2)), _ln, _fn);
+    local_ret6 = ret2;
+    chpl_check_nil(local_ret6, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    T9 = (local_ret6)->value;
+    _local_chpl_here_free(((void*)(ret2)), _ln, _fn);
+    T = T9;
+  }
+  chpl_check_local(chpl_nodeFromLocaleID(&((this6)->locale), INT64(0), NULL), _ln, _fn, "cannot access remote data in local block");
+  local_this3 = (this6)->addr;
+  chpl_check_nil(local_this3, INT64(151), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  call_tmp5 = &((local_this3)->_arrs);
+  chpl_check_nil(call_tmp5, INT64(151), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _local_remove2(call_tmp5, x2, _ln, _fn);
+  chpl_check_local(chpl_nodeFromLocaleID(&((this6)->locale), INT64(0), NULL), _ln, _fn, "cannot access remote data in local block");
+  local_this4 = (this6)->addr;
+  chpl_check_nil(local_this4, INT64(152), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  chpl_macro_tmp_507.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_507.addr = &((local_this4)->_arrsLock);
+  call_tmp6 = chpl_macro_tmp_507;
+  default_argorder3 = local_memory_order_seq_cst;
+  call_tmp7 = (&call_tmp6)->locale;
+  _args_size3 = sizeof(chpl__class_localson_fn2_object);
+  _args_alloc3 = chpl_mem_allocPooled(_args_size3, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn3 = ((_class_localson_fn2)(_args_alloc3));
+  chpl_check_nil(_args_foron_fn3, INT64(152), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn3)->_0__tmp = call_tmp7;
+  chpl_check_nil(_args_foron_fn3, INT64(152), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn3)->_1_this = call_tmp6;
+  chpl_check_nil(_args_foron_fn3, INT64(152), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn3)->_2_order = default_argorder3;
+  (_args_foron_fn3)->_ln2 = _ln;
+  (_args_foron_fn3)->_fn2 = _fn;
+  /*** _local_wrapon_fn2 ***/ chpl_executeOn(&call_tmp7, INT32(2), _args_foron_fn3, sizeof(chpl__class_localson_fn2_object), INT64(318), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn3)), _ln, _fn);
+  return;
+}
+
+/* ChapelDistribution.chpl:149 */
+static void on_fn24(chpl____wide_BaseDom* const this6, chpl____wide_BaseArr* const x2, int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_seq_cst;
+  chpl_bool T;
+  chpl____wide__ref_atomicflag call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder;
+  heap_chpl_bool ret = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_chpl_bool T2 = NULL;
+  chpl_localeID_t call_tmp2;
+  _ref_chpl_bool T3 = NULL;
+  _class_localson_fn _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_chpl_bool T4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool T5;
+  chpl____wide__ref_atomicflag call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder2;
+  heap_chpl_bool ret2 = NULL;
+  int64_t chpl_here_alloc_size2;
+  chpl_opaque chpl_here_alloc_tmp2;
+  heap_chpl_bool T6 = NULL;
+  chpl_localeID_t call_tmp4;
+  _ref_chpl_bool T7 = NULL;
+  _class_localson_fn _args_foron_fn2 = NULL;
+  int64_t _args_size2;
+  chpl_opaque _args_alloc2;
+  chpl____wide__ref_chpl_bool T8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool T9;
+  chpl____wide__ref_list_BaseArr call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomicflag call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder3;
+  chpl_localeID_t call_tmp7;
+  _class_localson_fn2 _args_foron_fn3 = NULL;
+  int64_t _args_size3;
+  chpl_opaque _args_alloc3;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_508;
+  chpl____wide__ref_chpl_bool chpl_macro_tmp_509;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_510;
+  chpl____wide__ref_chpl_bool chpl_macro_tmp_511;
+  chpl____wide__ref_list_BaseArr chpl_macro_tmp_512;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_513;
+  local_memory_order_seq_cst = memory_order_seq_cst;
+  chpl_check_nil((this6)->addr, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  chpl_macro_tmp_508.locale = (this6)->locale;
+  chpl_macro_tmp_508.addr = &(((this6)->addr)->_arrsLock);
+  call_tmp = chpl_macro_tmp_508;
+  default_argorder = local_memory_order_seq_cst;
+  chpl_here_alloc_size = sizeof(chpl_heap_chpl_bool_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T2 = ((heap_chpl_bool)(chpl_here_alloc_tmp));
+  ret = T2;
+  chpl_check_nil(ret, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (ret)->value = false;
+  call_tmp2 = (&call_tmp)->locale;
+  chpl_check_nil(ret, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  T3 = &((ret)->value);
+  _args_size = sizeof(chpl__class_localson_fn_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp2;
+  chpl_check_nil(_args_foron_fn, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_1_this = call_tmp;
+  chpl_check_nil(_args_foron_fn, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_2_order = default_argorder;
+  chpl_macro_tmp_509.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_509.addr = T3;
+  T4 = chpl_macro_tmp_509;
+  chpl_check_nil(_args_foron_fn, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_3__tmp = T4;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn ***/ chpl_executeOn(&call_tmp2, INT32(1), _args_foron_fn, sizeof(chpl__class_localson_fn_object), INT64(314), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  chpl_check_nil(ret, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  T5 = (ret)->value;
+  chpl_here_free(((void*)(ret)), _ln, _fn);
+  T = T5;
+  while (T) {
+    chpl_task_yield();
+    chpl_check_nil((this6)->addr, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    chpl_macro_tmp_510.locale = (this6)->locale;
+    chpl_macro_tmp_510.addr = &(((this6)->addr)->_arrsLock);
+    call_tmp3 = chpl_macro_tmp_510;
+    default_argorder2 = local_memory_order_seq_cst;
+    chpl_here_alloc_size2 = sizeof(chpl_heap_chpl_bool_object);
+    chpl_here_alloc_tmp2 = chpl_here_alloc(chpl_here_alloc_size2, INT16(22), _ln, _fn);
+    T6 = ((heap_chpl_bool)(chpl_here_alloc_tmp2));
+    ret2 = T6;
+    chpl_check_nil(ret2, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (ret2)->value = false;
+    call_tmp4 = (&call_tmp3)->locale;
+    chpl_check_nil(ret2, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    T7 = &((ret2)->value);
+    _args_size2 = sizeof(chpl__class_localson_fn_object);
+    _args_alloc2 = chpl_mem_allocPooled(_args_size2, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn2 = ((_class_localson_fn)(_args_alloc2));
+    chpl_check_nil(_args_foron_fn2, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_0__tmp = call_tmp4;
+    chpl_check_nil(_args_foron_fn2, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_1_this = call_tmp3;
+    chpl_check_nil(_args_foron_fn2, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_2_order = default_argorder2;
+    chpl_macro_tmp_511.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_511.addr = T7;
+    T8 = chpl_macro_tmp_511;
+    chpl_check_nil(_args_foron_fn2, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_3__tmp = T8;
+    (_args_foron_fn2)->_ln = _ln;
+    (_args_foron_fn2)->_fn = _fn;
+    /*** wrapon_fn ***/ chpl_executeOn(&call_tmp4, INT32(1), _args_foron_fn2, sizeof(chpl__class_localson_fn_object), INT64(314), "/root/repo/modules/internal/Atomics.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn2)), _ln, _fn);
+    chpl_check_nil(ret2, INT64(150), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    T9 = (ret2)->value;
+    chpl_here_free(((void*)(ret2)), _ln, _fn);
+    T = T9;
+  }
+  chpl_check_nil((this6)->addr, INT64(151), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  chpl_macro_tmp_512.locale = (this6)->locale;
+  chpl_macro_tmp_512.addr = &(((this6)->addr)->_arrs);
+  call_tmp5 = chpl_macro_tmp_512;
+  remove3(&call_tmp5, x2, _ln, _fn);
+  chpl_check_nil((this6)->addr, INT64(152), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  chpl_macro_tmp_513.locale = (this6)->locale;
+  chpl_macro_tmp_513.addr = &(((this6)->addr)->_arrsLock);
+  call_tmp6 = chpl_macro_tmp_513;
+  default_argorder3 = local_memory_order_seq_cst;
+  call_tmp7 = (&call_tmp6)->locale;
+  _args_size3 = sizeof(chpl__class_localson_fn2_object);
+  _args_alloc3 = chpl_mem_allocPooled(_args_size3, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn3 = ((_class_localson_fn2)(_args_alloc3));
+  chpl_check_nil(_args_foron_fn3, INT64(152), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn3)->_0__tmp = call_tmp7;
+  chpl_check_nil(_args_foron_fn3, INT64(152), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn3)->_1_this = call_tmp6;
+  chpl_check_nil(_args_foron_fn3, INT64(152), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn3)->_2_order = default_argorder3;
+  (_args_foron_fn3)->_ln = _ln;
+  (_args_foron_fn3)->_fn = _fn;
+  /*** wrapon_fn2 ***/ chpl_executeOn(&call_tmp7, INT32(3), _args_foron_fn3, sizeof(chpl__class_localson_fn2_object), INT64(318), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn3)), _ln, _fn);
+  return;
+}
+
+/* ChapelDistribution.chpl:149 */
+static void _local_wrapon_fn4(_class_localson_fn24 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_BaseDom _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseArr _2_x = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln2;
+  _fn = (c)->_fn2;
+  chpl_check_nil(c, INT64(149), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _1_this = (c)->_1_this;
+  chpl_check_nil(c, INT64(149), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _2_x = (c)->_2_x;
+  _local_on_fn4(&_1_this, &_2_x, _ln, _fn);
+  return;
+}
+
+/* ChapelDistribution.chpl:149 */
+static void wrapon_fn24(_class_localson_fn24 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_BaseDom _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseArr _2_x = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(149), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _1_this = (c)->_1_this;
+  chpl_check_nil(c, INT64(149), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _2_x = (c)->_2_x;
+  on_fn24(&_1_this, &_2_x, _ln, _fn);
+  return;
+}
+
+/* ChapelDistribution.chpl:157 */
+static void on_fn25(chpl____wide_BaseDom* const this6, chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const x2, int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_seq_cst;
+  chpl_bool T;
+  chpl____wide__ref_atomicflag call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder;
+  heap_chpl_bool ret = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_chpl_bool T2 = NULL;
+  chpl_localeID_t call_tmp2;
+  _ref_chpl_bool T3 = NULL;
+  _class_localson_fn _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_chpl_bool T4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool T5;
+  chpl____wide__ref_atomicflag call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder2;
+  heap_chpl_bool ret2 = NULL;
+  int64_t chpl_here_alloc_size2;
+  chpl_opaque chpl_here_alloc_tmp2;
+  heap_chpl_bool T6 = NULL;
+  chpl_localeID_t call_tmp4;
+  _ref_chpl_bool T7 = NULL;
+  _class_localson_fn _args_foron_fn2 = NULL;
+  int64_t _args_size2;
+  chpl_opaque _args_alloc2;
+  chpl____wide__ref_chpl_bool T8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool T9;
+  chpl____wide__ref_list_BaseArr call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseArr call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomicflag call_tmp7 = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder3;
+  chpl_localeID_t call_tmp8;
+  _class_localson_fn2 _args_foron_fn3 = NULL;
+  int64_t _args_size3;
+  chpl_opaque _args_alloc3;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_514;
+  chpl____wide__ref_chpl_bool chpl_macro_tmp_515;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_516;
+  chpl____wide__ref_chpl_bool chpl_macro_tmp_517;
+  chpl____wide__ref_list_BaseArr chpl_macro_tmp_518;
+  chpl____wide_BaseArr chpl_macro_tmp_519;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_520;
+  local_memory_order_seq_cst = memory_order_seq_cst;
+  chpl_check_nil((this6)->addr, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  chpl_macro_tmp_514.locale = (this6)->locale;
+  chpl_macro_tmp_514.addr = &(((this6)->addr)->_arrsLock);
+  call_tmp = chpl_macro_tmp_514;
+  default_argorder = local_memory_order_seq_cst;
+  chpl_here_alloc_size = sizeof(chpl_heap_chpl_bool_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T2 = ((heap_chpl_bool)(chpl_here_alloc_tmp));
+  ret = T2;
+  chpl_check_nil(ret, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (ret)->value = false;
+  call_tmp2 = (&call_tmp)->locale;
+  chpl_check_nil(ret, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  T3 = &((ret)->value);
+  _args_size = sizeof(chpl__class_localson_fn_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp2;
+  chpl_check_nil(_args_foron_fn, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_1_this = call_tmp;
+  chpl_check_nil(_args_foron_fn, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_2_order = default_argorder;
+  chpl_macro_tmp_515.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_515.addr = T3;
+  T4 = chpl_macro_tmp_515;
+  chpl_check_nil(_args_foron_fn, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_3__tmp = T4;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn ***/ chpl_executeOn(&call_tmp2, INT32(1), _args_foron_fn, sizeof(chpl__class_localson_fn_object), INT64(314), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  chpl_check_nil(ret, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  T5 = (ret)->value;
+  chpl_here_free(((void*)(ret)), _ln, _fn);
+  T = T5;
+  while (T) {
+    chpl_task_yield();
+    chpl_check_nil((this6)->addr, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    chpl_macro_tmp_516.locale = (this6)->locale;
+    chpl_macro_tmp_516.addr = &(((this6)->addr)->_arrsLock);
+    call_tmp3 = chpl_macro_tmp_516;
+    default_argorder2 = local_memory_order_seq_cst;
+    chpl_here_alloc_size2 = sizeof(chpl_heap_chpl_bool_object);
+    chpl_here_alloc_tmp2 = chpl_here_alloc(chpl_here_alloc_size2, INT16(22), _ln, _fn);
+    T6 = ((heap_chpl_bool)(chpl_here_alloc_tmp2));
+    ret2 = T6;
+    chpl_check_nil(ret2, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (ret2)->value = false;
+    call_tmp4 = (&call_tmp3)->locale;
+    chpl_check_nil(ret2, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    T7 = &((ret2)->value);
+    _args_size2 = sizeof(chpl__class_localson_fn_object);
+    _args_alloc2 = chpl_mem_allocPooled(_args_size2, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn2 = ((_class_localson_fn)(_args_alloc2));
+    chpl_check_nil(_args_foron_fn2, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_0__tmp = call_tmp4;
+    chpl_check_nil(_args_foron_fn2, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_1_this = call_tmp3;
+    chpl_check_nil(_args_foron_fn2, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_2_order = default_argorder2;
+    chpl_macro_tmp_517.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_517.addr = T7;
+    T8 = chpl_macro_tmp_517;
+    chpl_check_nil(_args_foron_fn2, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_3__tmp = T8;
+    (_args_foron_fn2)->_ln = _ln;
+    (_args_foron_fn2)->_fn = _fn;
+    /*** wrapon_fn ***/ chpl_executeOn(&call_tmp4, INT32(1), _args_foron_fn2, sizeof(chpl__class_localson_fn_object), INT64(314), "/root/repo/modules/internal/Atomics.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn2)), _ln, _fn);
+    chpl_check_nil(ret2, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    T9 = (ret2)->value;
+    chpl_here_free(((void*)(ret2)), _ln, _fn);
+    T = T9;
+  }
+  chpl_check_nil((this6)->addr, INT64(159), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  chpl_macro_tmp_518.locale = (this6)->locale;
+  chpl_macro_tmp_518.addr = &(((this6)->addr)->_arrs);
+  call_tmp5 = chpl_macro_tmp_518;
+  chpl_macro_tmp_519.locale = (x2)->locale;
+  chpl_macro_tmp_519.addr = ((BaseArr)((x2)->addr));
+  call_tmp6 = chpl_macro_tmp_519;
+  append(&call_tmp5, &call_tmp6, _ln, _fn);
+  chpl_check_nil((this6)->addr, INT64(160), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  chpl_macro_tmp_520.locale = (this6)->locale;
+  chpl_macro_tmp_520.addr = &(((this6)->addr)->_arrsLock);
+  call_tmp7 = chpl_macro_tmp_520;
+  default_argorder3 = local_memory_order_seq_cst;
+  call_tmp8 = (&call_tmp7)->locale;
+  _args_size3 = sizeof(chpl__class_localson_fn2_object);
+  _args_alloc3 = chpl_mem_allocPooled(_args_size3, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn3 = ((_class_localson_fn2)(_args_alloc3));
+  chpl_check_nil(_args_foron_fn3, INT64(160), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn3)->_0__tmp = call_tmp8;
+  chpl_check_nil(_args_foron_fn3, INT64(160), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn3)->_1_this = call_tmp7;
+  chpl_check_nil(_args_foron_fn3, INT64(160), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn3)->_2_order = default_argorder3;
+  (_args_foron_fn3)->_ln = _ln;
+  (_args_foron_fn3)->_fn = _fn;
+  /*** wrapon_fn2 ***/ chpl_executeOn(&call_tmp8, INT32(3), _args_foron_fn3, sizeof(chpl__class_localson_fn2_object), INT64(318), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn3)), _ln, _fn);
+  return;
+}
+
+/* ChapelDistribution.chpl:157 */
+static void on_fn26(chpl____wide_BaseDom* const this6, chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const x2, int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_seq_cst;
+  chpl_bool T;
+  chpl____wide__ref_atomicflag call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder;
+  heap_chpl_bool ret = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_chpl_bool T2 = NULL;
+  chpl_localeID_t call_tmp2;
+  _ref_chpl_bool T3 = NULL;
+  _class_localson_fn _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_chpl_bool T4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool T5;
+  chpl____wide__ref_atomicflag call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder2;
+  heap_chpl_bool ret2 = NULL;
+  int64_t chpl_here_alloc_size2;
+  chpl_opaque chpl_here_alloc_tmp2;
+  heap_chpl_bool T6 = NULL;
+  chpl_localeID_t call_tmp4;
+  _ref_chpl_bool T7 = NULL;
+  _class_localson_fn _args_foron_fn2 = NULL;
+  int64_t _args_size2;
+  chpl_opaque _args_alloc2;
+  chpl____wide__ref_chpl_bool T8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool T9;
+  chpl____wide__ref_list_BaseArr call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseArr call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomicflag call_tmp7 = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder3;
+  chpl_localeID_t call_tmp8;
+  _class_localson_fn2 _args_foron_fn3 = NULL;
+  int64_t _args_size3;
+  chpl_opaque _args_alloc3;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_521;
+  chpl____wide__ref_chpl_bool chpl_macro_tmp_522;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_523;
+  chpl____wide__ref_chpl_bool chpl_macro_tmp_524;
+  chpl____wide__ref_list_BaseArr chpl_macro_tmp_525;
+  chpl____wide_BaseArr chpl_macro_tmp_526;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_527;
+  local_memory_order_seq_cst = memory_order_seq_cst;
+  chpl_check_nil((this6)->addr, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  chpl_macro_tmp_521.locale = (this6)->locale;
+  chpl_macro_tmp_521.addr = &(((this6)->addr)->_arrsLock);
+  call_tmp = chpl_macro_tmp_521;
+  default_argorder = local_memory_order_seq_cst;
+  chpl_here_alloc_size = sizeof(chpl_heap_chpl_bool_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T2 = ((heap_chpl_bool)(chpl_here_alloc_tmp));
+  ret = T2;
+  chpl_check_nil(ret, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (ret)->value = false;
+  call_tmp2 = (&call_tmp)->locale;
+  chpl_check_nil(ret, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  T3 = &((ret)->value);
+  _args_size = sizeof(chpl__class_localson_fn_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp2;
+  chpl_check_nil(_args_foron_fn, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_1_this = call_tmp;
+  chpl_check_nil(_args_foron_fn, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_2_order = default_argorder;
+  chpl_macro_tmp_522.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_522.addr = T3;
+  T4 = chpl_macro_tmp_522;
+  chpl_check_nil(_args_foron_fn, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_3__tmp = T4;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn ***/ chpl_executeOn(&call_tmp2, INT32(1), _args_foron_fn, sizeof(chpl__class_localson_fn_object), INT64(314), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  chpl_check_nil(ret, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  T5 = (ret)->value;
+  chpl_here_free(((void*)(ret)), _ln, _fn);
+  T = T5;
+  while (T) {
+    chpl_task_yield();
+    chpl_check_nil((this6)->addr, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    chpl_macro_tmp_523.locale = (this6)->locale;
+    chpl_macro_tmp_523.addr = &(((this6)->addr)->_arrsLock);
+    call_tmp3 = chpl_macro_tmp_523;
+    default_argorder2 = local_memory_order_seq_cst;
+    chpl_here_alloc_size2 = sizeof(chpl_heap_chpl_bool_object);
+    chpl_here_alloc_tmp2 = chpl_here_alloc(chpl_here_alloc_size2, INT16(22), _ln, _fn);
+    T6 = ((heap_chpl_bool)(chpl_here_alloc_tmp2));
+    ret2 = T6;
+    chpl_check_nil(ret2, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (ret2)->value = false;
+    call_tmp4 = (&call_tmp3)->locale;
+    chpl_check_nil(ret2, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    T7 = &((ret2)->value);
+    _args_size2 = sizeof(chpl__class_localson_fn_object);
+    _args_alloc2 = chpl_mem_allocPooled(_args_size2, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn2 = ((_class_localson_fn)(_args_alloc2));
+    chpl_check_nil(_args_foron_fn2, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_0__tmp = call_tmp4;
+    chpl_check_nil(_args_foron_fn2, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_1_this = call_tmp3;
+    chpl_check_nil(_args_foron_fn2, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_2_order = default_argorder2;
+    chpl_macro_tmp_524.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_524.addr = T7;
+    T8 = chpl_macro_tmp_524;
+    chpl_check_nil(_args_foron_fn2, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_3__tmp = T8;
+    (_args_foron_fn2)->_ln = _ln;
+    (_args_foron_fn2)->_fn = _fn;
+    /*** wrapon_fn ***/ chpl_executeOn(&call_tmp4, INT32(1), _args_foron_fn2, sizeof(chpl__class_localson_fn_object), INT64(314), "/root/repo/modules/internal/Atomics.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn2)), _ln, _fn);
+    chpl_check_nil(ret2, INT64(158), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    T9 = (ret2)->value;
+    chpl_here_free(((void*)(ret2)), _ln, _fn);
+    T = T9;
+  }
+  chpl_check_nil((this6)->addr, INT64(159), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  chpl_macro_tmp_525.locale = (this6)->locale;
+  chpl_macro_tmp_525.addr = &(((this6)->addr)->_arrs);
+  call_tmp5 = chpl_macro_tmp_525;
+  chpl_macro_tmp_526.locale = (x2)->locale;
+  chpl_macro_tmp_526.addr = ((BaseArr)((x2)->addr));
+  call_tmp6 = chpl_macro_tmp_526;
+  append(&call_tmp5, &call_tmp6, _ln, _fn);
+  chpl_check_nil((this6)->addr, INT64(160), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  chpl_macro_tmp_527.locale = (this6)->locale;
+  chpl_macro_tmp_527.addr = &(((this6)->addr)->_arrsLock);
+  call_tmp7 = chpl_macro_tmp_527;
+  default_argorder3 = local_memory_order_seq_cst;
+  call_tmp8 = (&call_tmp7)->locale;
+  _args_size3 = sizeof(chpl__class_localson_fn2_object);
+  _args_alloc3 = chpl_mem_allocPooled(_args_size3, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn3 = ((_class_localson_fn2)(_args_alloc3));
+  chpl_check_nil(_args_foron_fn3, INT64(160), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn3)->_0__tmp = call_tmp8;
+  chpl_check_nil(_args_foron_fn3, INT64(160), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn3)->_1_this = call_tmp7;
+  chpl_check_nil(_args_foron_fn3, INT64(160), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn3)->_2_order = default_argorder3;
+  (_args_foron_fn3)->_ln = _ln;
+  (_args_foron_fn3)->_fn = _fn;
+  /*** wrapon_fn2 ***/ chpl_executeOn(&call_tmp8, INT32(3), _args_foron_fn3, sizeof(chpl__class_localson_fn2_object), INT64(318), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn3)), _ln, _fn);
+  return;
+}
+
+/* ChapelDistribution.chpl:157 */
+static void wrapon_fn25(_class_localson_fn25 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_BaseDom _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F _2_x = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(157), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _1_this = (c)->_1_this;
+  chpl_check_nil(c, INT64(157), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _2_x = (c)->_2_x;
+  on_fn25(&_1_this, &_2_x, _ln, _fn);
+  return;
+}
+
+/* ChapelDistribution.chpl:157 */
+static void wrapon_fn26(_class_localson_fn26 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_BaseDom _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F _2_x = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(157), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _1_this = (c)->_1_this;
+  chpl_check_nil(c, INT64(157), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _2_x = (c)->_2_x;
+  on_fn26(&_1_this, &_2_x, _ln, _fn);
+  return;
+}
+
+/* ChapelDistribution.chpl:214 */
+static chpl_bool dsiLinksDistribution(chpl____wide_BaseDom* const this6) {
+  return true;
+}
+
+/* ChapelDistribution.chpl:219 */
+static BaseRectangularDom _construct_BaseRectangularDom(atomic_refcnt* const _domCnt, list_BaseArr* const _arrs, atomicflag* const _arrsLock, BaseRectangularDom meme, int64_t _ln, c_string _fn) {
+  BaseRectangularDom this6 = NULL;
+  BaseDom T = NULL;
+  this6 = meme;
+  chpl_check_nil(this6, INT64(219), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  T = &((this6)->super);
+  _construct_BaseDom(_domCnt, _arrs, _arrsLock, T, _ln, _fn);
+  return meme;
+}
+
+/* ChapelDistribution.chpl:219 */
+static void chpl__auto_destroy_BaseRectangularDom(BaseRectangularDom this6, int64_t _ln, c_string _fn) {
+  BaseDom _parent_destructor_tmp_ = NULL;
+  _ref_atomicflag _field_destructor_tmp_ = NULL;
+  _ref_atomic_flag call_tmp = NULL;
+  _ref_atomic_flag T = NULL;
+  _ref_atomic_refcnt _field_destructor_tmp_2 = NULL;
+  _ref_atomic_int64 _field_destructor_tmp_3 = NULL;
+  _ref_atomic_int_least64_t call_tmp2 = NULL;
+  _ref_atomic_int_least64_t T2 = NULL;
+  _parent_destructor_tmp_ = ((BaseDom)(this6));
+  chpl_check_nil(_parent_destructor_tmp_, INT64(219), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _field_destructor_tmp_ = &((_parent_destructor_tmp_)->_arrsLock);
+  chpl_check_nil(_field_destructor_tmp_, INT64(219), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  call_tmp = &((_field_destructor_tmp_)->_v);
+  T = call_tmp;
+  atomic_destroy_flag(T);
+  call_tmp = T;
+  chpl_check_nil(_parent_destructor_tmp_, INT64(219), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _field_destructor_tmp_2 = &((_parent_destructor_tmp_)->_domCnt);
+  chpl_check_nil(_field_destructor_tmp_2, INT64(219), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _field_destructor_tmp_3 = &((_field_destructor_tmp_2)->_cnt);
+  chpl_check_nil(_field_destructor_tmp_3, INT64(219), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  call_tmp2 = &((_field_destructor_tmp_3)->_v);
+  T2 = call_tmp2;
+  atomic_destroy_int_least64_t(T2);
+  call_tmp2 = T2;
+  return;
+}
+
+/* ChapelDistribution.chpl:271 */
+static BaseArr _construct_BaseArr(atomic_refcnt* const _arrCnt, BaseArr _arrAlias, BaseArr meme, int64_t _ln, c_string _fn) {
+  BaseArr this6 = NULL;
+  object T = NULL;
+  chpl____wide_BaseArr T2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseArr chpl_macro_tmp_528;
+  this6 = meme;
+  chpl_check_nil(this6, INT64(271), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  T = &((this6)->super);
+  _construct_object(T);
+  chpl_check_nil(this6, INT64(275), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (this6)->_arrCnt = *(_arrCnt);
+  chpl_macro_tmp_528.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_528.addr = _arrAlias;
+  T2 = chpl_macro_tmp_528;
+  chpl_check_nil(this6, INT64(276), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (this6)->_arrAlias = T2;
+  return this6;
+}
+
+/* ChapelDistribution.chpl:271 */
+static void chpl__auto_destroy_BaseArr(BaseArr this6, int64_t _ln, c_string _fn) {
+  _ref_atomic_refcnt _field_destructor_tmp_ = NULL;
+  _ref_atomic_int64 _field_destructor_tmp_2 = NULL;
+  _ref_atomic_int_least64_t call_tmp = NULL;
+  _ref_atomic_int_least64_t T = NULL;
+  chpl_check_nil(this6, INT64(275), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _field_destructor_tmp_ = &((this6)->_arrCnt);
+  chpl_check_nil(_field_destructor_tmp_, INT64(275), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _field_destructor_tmp_2 = &((_field_destructor_tmp_)->_cnt);
+  chpl_check_nil(_field_destructor_tmp_2, INT64(275), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  call_tmp = &((_field_destructor_tmp_2)->_v);
+  T = call_tmp;
+  atomic_destroy_int_least64_t(T);
+  call_tmp = T;
+  return;
+}
+
+/* ChapelDistribution.chpl:280 */
+static chpl____wide_BaseDom dsiGetBaseDom(chpl____wide_BaseArr* const this6, int64_t _ln, c_string _fn) {
+  chpl____wide_BaseDom ret = {CHPL_LOCALEID_T_INIT, NULL};
+  c_string T;
+  chpl____wide__nilType chpl_macro_tmp_529;
+  chpl____wide_BaseDom chpl_macro_tmp_530;
+  T = "internal error: dsiGetBaseDom is not implemented";
+  halt(T, _ln, _fn);
+  chpl_macro_tmp_529.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_529.addr = nil;
+  chpl_macro_tmp_530.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_530.addr = NULL;
+  ret = chpl_macro_tmp_530;
+  return ret;
+}
+
+/* ChapelDistribution.chpl:286 */
+static int64_t destroyArr(chpl____wide_BaseArr* const this6, int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_seq_cst;
+  chpl____wide__ref_atomic_refcnt call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder;
+  heap_int64_t ret = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_int64_t T = NULL;
+  chpl_localeID_t call_tmp3;
+  _ref_int64_t T2 = NULL;
+  _class_localson_fn6 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_int64_t T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t T4;
+  int64_t call_tmp4;
+  chpl_bool call_tmp5;
+  c_string T5;
+  chpl_bool call_tmp6;
+  chpl____wide_BaseArr ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp7 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp8;
+  chpl____wide__ref_BaseArr call_tmp9 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp10;
+  chpl____wide_BaseArr T6 = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn27 _args_foron_fn2 = NULL;
+  int64_t _args_size2;
+  chpl_opaque _args_alloc2;
+  int32_t _virtual_method_tmp_;
+  chpl_bool call_tmp11;
+  chpl____wide_BaseDom call_tmp12 = {CHPL_LOCALEID_T_INIT, NULL};
+  int32_t _virtual_method_tmp_2;
+  chpl_localeID_t call_tmp13;
+  chpl____wide_BaseDom rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn29 _args_foron_fn3 = NULL;
+  int64_t _args_size3;
+  chpl_opaque _args_alloc3;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_531;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_532;
+  chpl____wide__ref_int64_t chpl_macro_tmp_533;
+  chpl____wide__ref_BaseArr chpl_macro_tmp_534;
+  chpl____wide_object chpl_macro_tmp_535;
+  chpl____wide__ref_BaseArr chpl_macro_tmp_536;
+  chpl____wide__ref_int32_t chpl_macro_tmp_537;
+  chpl____wide__ref_int32_t chpl_macro_tmp_538;
+  local_memory_order_seq_cst = memory_order_seq_cst;
+  compilerAssert();
+  compilerAssert();
+  chpl_check_nil((this6)->addr, INT64(288), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  chpl_macro_tmp_531.locale = (this6)->locale;
+  chpl_macro_tmp_531.addr = &(((this6)->addr)->_arrCnt);
+  call_tmp = chpl_macro_tmp_531;
+  chpl_macro_tmp_532.locale = (call_tmp).locale;
+  chpl_macro_tmp_532.addr = &(((call_tmp).addr)->_cnt);
+  call_tmp2 = chpl_macro_tmp_532;
+  default_argorder = local_memory_order_seq_cst;
+  chpl_here_alloc_size = sizeof(chpl_heap_int64_t_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T = ((heap_int64_t)(chpl_here_alloc_tmp));
+  ret = T;
+  chpl_check_nil(ret, INT64(288), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (ret)->value = INT64(0);
+  call_tmp3 = (&call_tmp2)->locale;
+  chpl_check_nil(ret, INT64(288), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  T2 = &((ret)->value);
+  _args_size = sizeof(chpl__class_localson_fn6_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn6)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(288), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp3;
+  chpl_check_nil(_args_foron_fn, INT64(288), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_1_this = call_tmp2;
+  chpl_check_nil(_args_foron_fn, INT64(288), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_2_value = INT64(1);
+  chpl_check_nil(_args_foron_fn, INT64(288), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_3_order = default_argorder;
+  chpl_macro_tmp_533.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_533.addr = T2;
+  T3 = chpl_macro_tmp_533;
+  chpl_check_nil(_args_foron_fn, INT64(288), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  (_args_foron_fn)->_4__tmp = T3;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn6 ***/ chpl_executeOn(&call_tmp3, INT32(7), _args_foron_fn, sizeof(chpl__class_localson_fn6_object), INT64(1107), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  chpl_check_nil(ret, INT64(288), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  T4 = (ret)->value;
+  chpl_here_free(((void*)(ret)), _ln, _fn);
+  call_tmp4 = (T4 - INT64(1));
+  call_tmp5 = (call_tmp4 < INT64(0));
+  if (call_tmp5) {
+    T5 = "array reference count is negative!";
+    halt(T5, _ln, _fn);
+  }
+  call_tmp6 = (call_tmp4 == INT64(0));
+  if (call_tmp6) {
+    chpl_check_nil((this6)->addr, INT64(290), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    chpl_macro_tmp_534.locale = (this6)->locale;
+    chpl_macro_tmp_534.addr = &(((this6)->addr)->_arrAlias);
+    chpl_gen_comm_get(((void*)(&ret2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_534).locale), INT64(0), NULL), (chpl_macro_tmp_534).addr, sizeof(chpl____wide_BaseArr), -1, INT64(1), INT64(290), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    chpl_macro_tmp_535.locale = (&ret2)->locale;
+    chpl_macro_tmp_535.addr = ((object)((&ret2)->addr));
+    call_tmp7 = chpl_macro_tmp_535;
+    call_tmp8 = (&call_tmp7)->addr != nil;
+    if (call_tmp8) {
+      chpl_check_nil((this6)->addr, INT64(291), "/root/repo/modules/internal/ChapelDistribution.chpl");
+      chpl_macro_tmp_536.locale = (this6)->locale;
+      chpl_macro_tmp_536.addr = &(((this6)->addr)->_arrAlias);
+      call_tmp9 = chpl_macro_tmp_536;
+      chpl_gen_comm_get(((void*)(&T6)), chpl_nodeFromLocaleID(&((call_tmp9).locale), INT64(0), NULL), (call_tmp9).addr, sizeof(chpl____wide_BaseArr), -1, INT64(1), INT64(291), "/root/repo/modules/internal/ChapelDistribution.chpl");
+      call_tmp10 = (&T6)->locale;
+      _args_size2 = sizeof(chpl__class_localson_fn27_object);
+      _args_alloc2 = chpl_mem_allocPooled(_args_size2, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+      _args_foron_fn2 = ((_class_localson_fn27)(_args_alloc2));
+      chpl_check_nil(_args_foron_fn2, INT64(291), "/root/repo/modules/internal/ChapelDistribution.chpl");
+      (_args_foron_fn2)->_0__tmp = call_tmp10;
+      chpl_check_nil(_args_foron_fn2, INT64(291), "/root/repo/modules/internal/ChapelDistribution.chpl");
+      (_args_foron_fn2)->_1_this = *(this6);
+      (_args_foron_fn2)->_ln = _ln;
+      (_args_foron_fn2)->_fn = _fn;
+      /*** wrapon_fn27 ***/ chpl_executeOn(&call_tmp10, INT32(30), _args_foron_fn2, sizeof(chpl__class_localson_fn27_object), INT64(291), "/root/repo/modules/internal/ChapelDistribution.chpl");
+      chpl_mem_freePooled(((void*)(_args_foron_fn2)), _ln, _fn);
+    } else {
+      chpl_check_nil((this6)->addr, INT64(297), "/root/repo/modules/internal/ChapelDistribution.chpl");
+      chpl_macro_tmp_537.locale = (this6)->locale;
+      chpl_macro_tmp_537.addr = &(((object)((this6)->addr))->chpl__cid);
+      chpl_gen_comm_get(((void*)(&_virtual_method_tmp_)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_537).locale), INT64(0), NULL), (chpl_macro_tmp_537).addr, sizeof(int32_t), -1, INT64(1), INT64(297), "/root/repo/modules/internal/ChapelDistribution.chpl");
+      ((void(*)(chpl____wide_BaseArr* const, int64_t, c_string))chpl_vmtable[((INT64(4) * _virtual_method_tmp_) + INT64(2))])(this6, _ln, _fn);
+    }
+  }
+  call_tmp11 = (call_tmp4 == INT64(0));
+  if (call_tmp11) {
+    chpl_check_nil((this6)->addr, INT64(301), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    chpl_macro_tmp_538.locale = (this6)->locale;
+    chpl_macro_tmp_538.addr = &(((object)((this6)->addr))->chpl__cid);
+    chpl_gen_comm_get(((void*)(&_virtual_method_tmp_2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_538).locale), INT64(0), NULL), (chpl_macro_tmp_538).addr, sizeof(int32_t), -1, INT64(1), INT64(301), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    call_tmp12 = ((chpl____wide_BaseDom(*)(chpl____wide_BaseArr* const, int64_t, c_string))chpl_vmtable[((INT64(4) * _virtual_method_tmp_2) + INT64(1))])(this6, _ln, _fn);
+    call_tmp13 = (&call_tmp12)->locale;
+    rvfDerefTmp = call_tmp12;
+    _args_size3 = sizeof(chpl__class_localson_fn29_object);
+    _args_alloc3 = chpl_mem_allocPooled(_args_size3, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn3 = ((_class_localson_fn29)(_args_alloc3));
+    chpl_check_nil(_args_foron_fn3, INT64(302), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn3)->_0__tmp = call_tmp13;
+    chpl_check_nil(_args_foron_fn3, INT64(302), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn3)->_1_rvfDerefTmp = rvfDerefTmp;
+    chpl_check_nil(_args_foron_fn3, INT64(302), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn3)->_2_this = *(this6);
+    (_args_foron_fn3)->_ln = _ln;
+    (_args_foron_fn3)->_fn = _fn;
+    /*** wrapon_fn29 ***/ chpl_executeOn(&call_tmp13, INT32(32), _args_foron_fn3, sizeof(chpl__class_localson_fn29_object), INT64(302), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn3)), _ln, _fn);
+  }
+  return call_tmp4;
+}
+
+/* ChapelDistribution.chpl:291 */
+static void on_fn27(chpl____wide_BaseArr* const this6, int64_t _ln, c_string _fn) {
+  chpl____wide_BaseArr ret = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp;
+  chpl_bool call_tmp2;
+  chpl____wide__ref_BaseArr call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseArr coerce_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool _dynamic_dispatch_tmp_;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F _cast_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseArr _parent_destructor_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_refcnt _field_destructor_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 _field_destructor_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int_least64_t call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_int_least64_t T = NULL;
+  chpl_bool _dynamic_dispatch_tmp_2;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F _cast_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseArr _parent_destructor_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_refcnt _field_destructor_tmp_3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 _field_destructor_tmp_4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int_least64_t call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_int_least64_t T2 = NULL;
+  chpl____wide__ref_atomic_refcnt _field_destructor_tmp_5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 _field_destructor_tmp_6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int_least64_t call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_int_least64_t T3 = NULL;
+  chpl_localeID_t call_tmp7;
+  chpl____wide_BaseArr T4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseArr rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn28 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_BaseArr chpl_macro_tmp_539;
+  chpl____wide__ref_BaseArr chpl_macro_tmp_540;
+  chpl____wide__ref_BaseArr chpl_macro_tmp_541;
+  chpl____wide__ref_int32_t chpl_macro_tmp_542;
+  int32_t chpl_macro_tmp_543;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F chpl_macro_tmp_544;
+  chpl____wide_BaseArr chpl_macro_tmp_545;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_546;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_547;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_548;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_549;
+  chpl____wide__ref_int32_t chpl_macro_tmp_550;
+  int32_t chpl_macro_tmp_551;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F chpl_macro_tmp_552;
+  chpl____wide_BaseArr chpl_macro_tmp_553;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_554;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_555;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_556;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_557;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_558;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_559;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_560;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_561;
+  chpl____wide__ref_BaseArr chpl_macro_tmp_562;
+  chpl_check_nil((this6)->addr, INT64(292), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  chpl_macro_tmp_539.locale = (this6)->locale;
+  chpl_macro_tmp_539.addr = &(((this6)->addr)->_arrAlias);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_539).locale), INT64(0), NULL), (chpl_macro_tmp_539).addr, sizeof(chpl____wide_BaseArr), -1, INT64(1), INT64(292), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  chpl_check_nil((&ret)->addr, INT64(292), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  call_tmp = destroyArr(&ret, _ln, _fn);
+  call_tmp2 = (call_tmp == INT64(0));
+  if (call_tmp2) {
+    chpl_check_nil((this6)->addr, INT64(294), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    chpl_macro_tmp_540.locale = (this6)->locale;
+    chpl_macro_tmp_540.addr = &(((this6)->addr)->_arrAlias);
+    call_tmp3 = chpl_macro_tmp_540;
+    chpl_check_nil((this6)->addr, INT64(294), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    chpl_macro_tmp_541.locale = (this6)->locale;
+    chpl_macro_tmp_541.addr = &(((this6)->addr)->_arrAlias);
+    chpl_gen_comm_get(((void*)(&coerce_tmp)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_541).locale), INT64(0), NULL), (chpl_macro_tmp_541).addr, sizeof(chpl____wide_BaseArr), -1, INT64(1), INT64(294), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    chpl_check_nil((&coerce_tmp)->addr, INT64(294), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    chpl_macro_tmp_542.locale = (&coerce_tmp)->locale;
+    chpl_macro_tmp_542.addr = &(((object)((&coerce_tmp)->addr))->chpl__cid);
+    chpl_gen_comm_get(((void*)(&chpl_macro_tmp_543)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_542).locale), INT64(0), NULL), (chpl_macro_tmp_542).addr, sizeof(int32_t), -1, INT64(1), INT64(294), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    _dynamic_dispatch_tmp_ = (chpl_macro_tmp_543 == chpl__cid_DefaultRectangularArr_locale_1_int64_t_F);
+    if (_dynamic_dispatch_tmp_) {
+      chpl_macro_tmp_544.locale = (&coerce_tmp)->locale;
+      chpl_macro_tmp_544.addr = ((DefaultRectangularArr_locale_1_int64_t_F)((&coerce_tmp)->addr));
+      _cast_tmp_ = chpl_macro_tmp_544;
+      chpl_macro_tmp_545.locale = (&_cast_tmp_)->locale;
+      chpl_macro_tmp_545.addr = ((BaseArr)((&_cast_tmp_)->addr));
+      _parent_destructor_tmp_ = chpl_macro_tmp_545;
+      chpl_check_nil((&_parent_destructor_tmp_)->addr, INT64(294), "/root/repo/modules/internal/ChapelDistribution.chpl");
+      chpl_macro_tmp_546.locale = (&_parent_destructor_tmp_)->locale;
+      chpl_macro_tmp_546.addr = &(((&_parent_destructor_tmp_)->addr)->_arrCnt);
+      _field_destructor_tmp_ = chpl_macro_tmp_546;
+      chpl_macro_tmp_547.locale = (_field_destructor_tmp_).locale;
+      chpl_macro_tmp_547.addr = &(((_field_destructor_tmp_).addr)->_cnt);
+      _field_destructor_tmp_2 = chpl_macro_tmp_547;
+      chpl_macro_tmp_548.locale = (_field_destructor_tmp_2).locale;
+      chpl_macro_tmp_548.addr = &(((_field_destructor_tmp_2).addr)->_v);
+      call_tmp4 = chpl_macro_tmp_548;
+      T = (&call_tmp4)->addr;
+      atomic_destroy_int_least64_t(T);
+      chpl_macro_tmp_549.locale = chpl_gen_getLocaleID();
+      chpl_macro_tmp_549.addr = T;
+      call_tmp4 = chpl_macro_tmp_549;
+    } else {
+      chpl_check_nil((&coerce_tmp)->addr, INT64(294), "/root/repo/modules/internal/ChapelDistribution.chpl");
+      chpl_macro_tmp_550.locale = (&coerce_tmp)->locale;
+      chpl_macro_tmp_550.addr = &(((object)((&coerce_tmp)->addr))->chpl__cid);
+      chpl_gen_comm_get(((void*)(&chpl_macro_tmp_551)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_550).locale), INT64(0), NULL), (chpl_macro_tmp_550).addr, sizeof(int32_t), -1, INT64(1), INT64(294), "/root/repo/modules/internal/ChapelDistribution.chpl");
+      _dynamic_dispatch_tmp_2 = (chpl_macro_tmp_551 == chpl__cid_DefaultRectangularArr_localesSignal_1_int64_t_F);
+      if (_dynamic_dispatch_tmp_2) {
+        chpl_macro_tmp_552.locale = (&coerce_tmp)->locale;
+        chpl_macro_tmp_552.addr = ((DefaultRectangularArr_localesSignal_1_int64_t_F)((&coerce_tmp)->addr));
+        _cast_tmp_2 = chpl_macro_tmp_552;
+        chpl_macro_tmp_553.locale = (&_cast_tmp_2)->locale;
+        chpl_macro_tmp_553.addr = ((BaseArr)((&_cast_tmp_2)->addr));
+        _parent_destructor_tmp_2 = chpl_macro_tmp_553;
+        chpl_check_nil((&_parent_destructor_tmp_2)->addr, INT64(294), "/root/repo/modules/internal/ChapelDistribution.chpl");
+        chpl_macro_tmp_554.locale = (&_parent_destructor_tmp_2)->locale;
+        chpl_macro_tmp_554.addr = &(((&_parent_destructor_tmp_2)->addr)->_arrCnt);
+        _field_destructor_tmp_3 = chpl_macro_tmp_554;
+        chpl_macro_tmp_555.locale = (_field_destructor_tmp_3).locale;
+        chpl_macro_tmp_555.addr = &(((_field_destructor_tmp_3).addr)->_cnt);
+        _field_destructor_tmp_4 = chpl_macro_tmp_555;
+        chpl_macro_tmp_556.locale = (_field_destructor_tmp_4).locale;
+        chpl_macro_tmp_556.addr = &(((_field_destructor_tmp_4).addr)->_v);
+        call_tmp5 = chpl_macro_tmp_556;
+        T2 = (&call_tmp5)->addr;
+        atomic_destroy_int_least64_t(T2);
+        chpl_macro_tmp_557.locale = chpl_gen_getLocaleID();
+        chpl_macro_tmp_557.addr = T2;
+        call_tmp5 = chpl_macro_tmp_557;
+      } else {
+        chpl_check_nil((&coerce_tmp)->addr, INT64(294), "/root/repo/modules/internal/ChapelDistribution.chpl");
+        chpl_macro_tmp_558.locale = (&coerce_tmp)->locale;
+        chpl_macro_tmp_558.addr = &(((&coerce_tmp)->addr)->_arrCnt);
+        _field_destructor_tmp_5 = chpl_macro_tmp_558;
+        chpl_macro_tmp_559.locale = (_field_destructor_tmp_5).locale;
+        chpl_macro_tmp_559.addr = &(((_field_destructor_tmp_5).addr)->_cnt);
+        _field_destructor_tmp_6 = chpl_macro_tmp_559;
+        chpl_macro_tmp_560.locale = (_field_destructor_tmp_6).locale;
+        chpl_macro_tmp_560.addr = &(((_field_destructor_tmp_6).addr)->_v);
+        call_tmp6 = chpl_macro_tmp_560;
+        T3 = (&call_tmp6)->addr;
+        atomic_destroy_int_least64_t(T3);
+        chpl_macro_tmp_561.locale = chpl_gen_getLocaleID();
+        chpl_macro_tmp_561.addr = T3;
+        call_tmp6 = chpl_macro_tmp_561;
+      }
+    }
+    chpl_gen_comm_get(((void*)(&T4)), chpl_nodeFromLocaleID(&((call_tmp3).locale), INT64(0), NULL), (call_tmp3).addr, sizeof(chpl____wide_BaseArr), -1, INT64(1), INT64(294), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    call_tmp7 = (&T4)->locale;
+    chpl_check_nil((this6)->addr, INT64(294), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    chpl_macro_tmp_562.locale = (this6)->locale;
+    chpl_macro_tmp_562.addr = &(((this6)->addr)->_arrAlias);
+    chpl_gen_comm_get(((void*)(&rvfDerefTmp)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_562).locale), INT64(0), NULL), (chpl_macro_tmp_562).addr, sizeof(chpl____wide_BaseArr), -1, INT64(1), INT64(294), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    _args_size = sizeof(chpl__class_localson_fn28_object);
+    _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn = ((_class_localson_fn28)(_args_alloc));
+    chpl_check_nil(_args_foron_fn, INT64(294), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn)->_0__tmp = call_tmp7;
+    chpl_check_nil(_args_foron_fn, INT64(294), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn)->_1_rvfDerefTmp = rvfDerefTmp;
+    (_args_foron_fn)->_ln = _ln;
+    (_args_foron_fn)->_fn = _fn;
+    /*** wrapon_fn28 ***/ chpl_executeOn(&call_tmp7, INT32(31), _args_foron_fn, sizeof(chpl__class_localson_fn28_object), INT64(294), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  }
+  return;
+}
+
+/* ChapelDistribution.chpl:291 */
+static void wrapon_fn27(_class_localson_fn27 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_BaseArr _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(291), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _1_this = (c)->_1_this;
+  on_fn27(&_1_this, _ln, _fn);
+  return;
+}
+
+/* ChapelDistribution.chpl:294 */
+static void on_fn28(chpl____wide_BaseArr* const delete_tmp, int64_t _ln, c_string _fn) {
+  chpl_opaque call_tmp;
+  call_tmp = ((void*)((delete_tmp)->addr));
+  chpl_here_free(call_tmp, _ln, _fn);
+  return;
+}
+
+/* ChapelDistribution.chpl:294 */
+static void wrapon_fn28(_class_localson_fn28 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_BaseArr _1_rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(294), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _1_rvfDerefTmp = (c)->_1_rvfDerefTmp;
+  on_fn28(&_1_rvfDerefTmp, _ln, _fn);
+  return;
+}
+
+/* ChapelDistribution.chpl:302 */
+static void on_fn29(chpl____wide_BaseDom* const dom, chpl____wide_BaseArr* const this6, int64_t _ln, c_string _fn) {
+  chpl_localeID_t call_tmp;
+  _class_localson_fn24 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  int64_t call_tmp2;
+  chpl_bool call_tmp3;
+  chpl____wide_BaseDom delete_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool _dynamic_dispatch_tmp_;
+  chpl____wide_BaseRectangularDom _cast_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool _dynamic_dispatch_tmp_2;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F _cast_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseRectangularDom _parent_destructor_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDom _parent_destructor_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomicflag _field_destructor_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_flag call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_flag T = NULL;
+  chpl____wide__ref_atomic_refcnt _field_destructor_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 _field_destructor_tmp_3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int_least64_t call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_int_least64_t T2 = NULL;
+  chpl____wide_BaseDom _parent_destructor_tmp_3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomicflag _field_destructor_tmp_4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_flag call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_flag T3 = NULL;
+  chpl____wide__ref_atomic_refcnt _field_destructor_tmp_5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 _field_destructor_tmp_6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int_least64_t call_tmp7 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_int_least64_t T4 = NULL;
+  chpl_bool _dynamic_dispatch_tmp_3;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F _cast_tmp_3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseRectangularDom _parent_destructor_tmp_4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDom _parent_destructor_tmp_5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomicflag _field_destructor_tmp_7 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_flag call_tmp8 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_flag T5 = NULL;
+  chpl____wide__ref_atomic_refcnt _field_destructor_tmp_8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 _field_destructor_tmp_9 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int_least64_t call_tmp9 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_int_least64_t T6 = NULL;
+  chpl____wide__ref_atomicflag _field_destructor_tmp_10 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_flag call_tmp10 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_flag T7 = NULL;
+  chpl____wide__ref_atomic_refcnt _field_destructor_tmp_11 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 _field_destructor_tmp_12 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int_least64_t call_tmp11 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_int_least64_t T8 = NULL;
+  chpl_localeID_t call_tmp12;
+  chpl____wide_BaseDom rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn30 _args_foron_fn2 = NULL;
+  int64_t _args_size2;
+  chpl_opaque _args_alloc2;
+  chpl____wide__ref_int32_t chpl_macro_tmp_563;
+  int32_t chpl_macro_tmp_564;
+  chpl____wide_BaseRectangularDom chpl_macro_tmp_565;
+  chpl____wide__ref_int32_t chpl_macro_tmp_566;
+  int32_t chpl_macro_tmp_567;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_568;
+  chpl____wide_BaseRectangularDom chpl_macro_tmp_569;
+  chpl____wide_BaseDom chpl_macro_tmp_570;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_571;
+  chpl____wide__ref_atomic_flag chpl_macro_tmp_572;
+  chpl____wide__ref_atomic_flag chpl_macro_tmp_573;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_574;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_575;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_576;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_577;
+  chpl____wide_BaseDom chpl_macro_tmp_578;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_579;
+  chpl____wide__ref_atomic_flag chpl_macro_tmp_580;
+  chpl____wide__ref_atomic_flag chpl_macro_tmp_581;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_582;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_583;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_584;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_585;
+  chpl____wide__ref_int32_t chpl_macro_tmp_586;
+  int32_t chpl_macro_tmp_587;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_588;
+  chpl____wide_BaseRectangularDom chpl_macro_tmp_589;
+  chpl____wide_BaseDom chpl_macro_tmp_590;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_591;
+  chpl____wide__ref_atomic_flag chpl_macro_tmp_592;
+  chpl____wide__ref_atomic_flag chpl_macro_tmp_593;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_594;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_595;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_596;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_597;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_598;
+  chpl____wide__ref_atomic_flag chpl_macro_tmp_599;
+  chpl____wide__ref_atomic_flag chpl_macro_tmp_600;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_601;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_602;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_603;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_604;
+  {
+    call_tmp = (dom)->locale;
+    _args_size = sizeof(chpl__class_localson_fn24_object);
+    _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn = ((_class_localson_fn24)(_args_alloc));
+    chpl_check_nil(_args_foron_fn, INT64(303), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn)->_0__tmp = call_tmp;
+    chpl_check_nil(_args_foron_fn, INT64(303), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn)->_1_this = *(dom);
+    chpl_check_nil(_args_foron_fn, INT64(303), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn)->_2_x = *(this6);
+    (_args_foron_fn)->_ln2 = _ln;
+    (_args_foron_fn)->_fn2 = _fn;
+    /*** _local_wrapon_fn4 ***/ chpl_executeOn(&call_tmp, INT32(26), _args_foron_fn, sizeof(chpl__class_localson_fn24_object), INT64(149), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  }
+  chpl_check_nil((dom)->addr, INT64(304), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  call_tmp2 = destroyDom(dom, _ln, _fn);
+  call_tmp3 = (call_tmp2 == INT64(0));
+  if (call_tmp3) {
+    delete_tmp = *(dom);
+    chpl_check_nil((dom)->addr, INT64(306), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    chpl_macro_tmp_563.locale = (dom)->locale;
+    chpl_macro_tmp_563.addr = &(((object)((dom)->addr))->chpl__cid);
+    chpl_gen_comm_get(((void*)(&chpl_macro_tmp_564)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_563).locale), INT64(0), NULL), (chpl_macro_tmp_563).addr, sizeof(int32_t), -1, INT64(1), INT64(306), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    _dynamic_dispatch_tmp_ = (chpl_macro_tmp_564 == chpl__cid_BaseRectangularDom);
+    if (_dynamic_dispatch_tmp_) {
+      chpl_macro_tmp_565.locale = (dom)->locale;
+      chpl_macro_tmp_565.addr = ((BaseRectangularDom)((dom)->addr));
+      _cast_tmp_ = chpl_macro_tmp_565;
+      chpl_check_nil((&_cast_tmp_)->addr, INT64(306), "/root/repo/modules/internal/ChapelDistribution.chpl");
+      chpl_macro_tmp_566.locale = (&_cast_tmp_)->locale;
+      chpl_macro_tmp_566.addr = &(((object)((&_cast_tmp_)->addr))->chpl__cid);
+      chpl_gen_comm_get(((void*)(&chpl_macro_tmp_567)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_566).locale), INT64(0), NULL), (chpl_macro_tmp_566).addr, sizeof(int32_t), -1, INT64(1), INT64(306), "/root/repo/modules/internal/ChapelDistribution.chpl");
+      _dynamic_dispatch_tmp_2 = (chpl_macro_tmp_567 == chpl__cid_DefaultRectangularDom_1_int64_t_F);
+      if (_dynamic_dispatch_tmp_2) {
+        chpl_macro_tmp_568.locale = (&_cast_tmp_)->locale;
+        chpl_macro_tmp_568.addr = ((DefaultRectangularDom_1_int64_t_F)((&_cast_tmp_)->addr));
+        _cast_tmp_2 = chpl_macro_tmp_568;
+        chpl_macro_tmp_569.locale = (&_cast_tmp_2)->locale;
+        chpl_macro_tmp_569.addr = ((BaseRectangularDom)((&_cast_tmp_2)->addr));
+        _parent_destructor_tmp_ = chpl_macro_tmp_569;
+        chpl_macro_tmp_570.locale = (&_parent_destructor_tmp_)->locale;
+        chpl_macro_tmp_570.addr = ((BaseDom)((&_parent_destructor_tmp_)->addr));
+        _parent_destructor_tmp_2 = chpl_macro_tmp_570;
+        chpl_check_nil((&_parent_destructor_tmp_2)->addr, INT64(306), "/root/repo/modules/internal/ChapelDistribution.chpl");
+        chpl_macro_tmp_571.locale = (&_parent_destructor_tmp_2)->locale;
+        chpl_macro_tmp_571.addr = &(((&_parent_destructor_tmp_2)->addr)->_arrsLock);
+        _field_destructor_tmp_ = chpl_macro_tmp_571;
+        chpl_macro_tmp_572.locale = (_field_destructor_tmp_).locale;
+        chpl_macro_tmp_572.addr = &(((_field_destructor_tmp_).addr)->_v);
+        call_tmp4 = chpl_macro_tmp_572;
+        T = (&call_tmp4)->addr;
+        atomic_destroy_flag(T);
+        chpl_macro_tmp_573.locale = chpl_gen_getLocaleID();
+        chpl_macro_tmp_573.addr = T;
+        call_tmp4 = chpl_macro_tmp_573;
+        chpl_check_nil((&_parent_destructor_tmp_2)->addr, INT64(306), "/root/repo/modules/internal/ChapelDistribution.chpl");
+        chpl_macro_tmp_574.locale = (&_parent_destructor_tmp_2)->locale;
+        chpl_macro_tmp_574.addr = &(((&_parent_destructor_tmp_2)->addr)->_domCnt);
+        _field_destructor_tmp_2 = chpl_macro_tmp_574;
+        chpl_macro_tmp_575.locale = (_field_destructor_tmp_2).locale;
+        chpl_macro_tmp_575.addr = &(((_field_destructor_tmp_2).addr)->_cnt);
+        _field_destructor_tmp_3 = chpl_macro_tmp_575;
+        chpl_macro_tmp_576.locale = (_field_destructor_tmp_3).locale;
+        chpl_macro_tmp_576.addr = &(((_field_destructor_tmp_3).addr)->_v);
+        call_tmp5 = chpl_macro_tmp_576;
+        T2 = (&call_tmp5)->addr;
+        atomic_destroy_int_least64_t(T2);
+        chpl_macro_tmp_577.locale = chpl_gen_getLocaleID();
+        chpl_macro_tmp_577.addr = T2;
+        call_tmp5 = chpl_macro_tmp_577;
+      } else {
+        chpl_macro_tmp_578.locale = (&_cast_tmp_)->locale;
+        chpl_macro_tmp_578.addr = ((BaseDom)((&_cast_tmp_)->addr));
+        _parent_destructor_tmp_3 = chpl_macro_tmp_578;
+        chpl_check_nil((&_parent_destructor_tmp_3)->addr, INT64(306), "/root/repo/modules/internal/ChapelDistribution.chpl");
+        chpl_macro_tmp_579.locale = (&_parent_destructor_tmp_3)->locale;
+        chpl_macro_tmp_579.addr = &(((&_parent_destructor_tmp_3)->addr)->_arrsLock);
+        _field_destructor_tmp_4 = chpl_macro_tmp_579;
+        chpl_macro_tmp_580.locale = (_field_destructor_tmp_4).locale;
+        chpl_macro_tmp_580.addr = &(((_field_destructor_tmp_4).addr)->_v);
+        call_tmp6 = chpl_macro_tmp_580;
+        T3 = (&call_tmp6)->addr;
+        atomic_destroy_flag(T3);
+        chpl_macro_tmp_581.locale = chpl_gen_getLocaleID();
+        chpl_macro_tmp_581.addr = T3;
+        call_tmp6 = chpl_macro_tmp_581;
+        chpl_check_nil((&_parent_destructor_tmp_3)->addr, INT64(306), "/root/repo/modules/internal/ChapelDistribution.chpl");
+        chpl_macro_tmp_582.locale = (&_parent_destructor_tmp_3)->locale;
+        chpl_macro_tmp_582.addr = &(((&_parent_destructor_tmp_3)->addr)->_domCnt);
+        _field_destructor_tmp_5 = chpl_macro_tmp_582;
+        chpl_macro_tmp_583.locale = (_field_destructor_tmp_5).locale;
+        chpl_macro_tmp_583.addr = &(((_field_destructor_tmp_5).addr)->_cnt);
+        _field_destructor_tmp_6 = chpl_macro_tmp_583;
+        chpl_macro_tmp_584.locale = (_field_destructor_tmp_6).locale;
+        chpl_macro_tmp_584.addr = &(((_field_destructor_tmp_6).addr)->_v);
+        call_tmp7 = chpl_macro_tmp_584;
+        T4 = (&call_tmp7)->addr;
+        atomic_destroy_int_least64_t(T4);
+        chpl_macro_tmp_585.locale = chpl_gen_getLocaleID();
+        chpl_macro_tmp_585.addr = T4;
+        call_tmp7 = chpl_macro_tmp_585;
+      }
+    } else {
+      chpl_check_nil((dom)->addr, INT64(306), "/root/repo/modules/internal/ChapelDistribution.chpl");
+      chpl_macro_tmp_586.locale = (dom)->locale;
+      chpl_macro_tmp_586.addr = &(((object)((dom)->addr))->chpl__cid);
+      chpl_gen_comm_get(((void*)(&chpl_macro_tmp_587)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_586).locale), INT64(0), NULL), (chpl_macro_tmp_586).addr, sizeof(int32_t), -1, INT64(1), INT64(306), "/root/repo/modules/internal/ChapelDistribution.chpl");
+      _dynamic_dispatch_tmp_3 = (chpl_macro_tmp_587 == chpl__cid_DefaultRectangularDom_1_int64_t_F);
+      if (_dynamic_dispatch_tmp_3) {
+        chpl_macro_tmp_588.locale = (dom)->locale;
+        chpl_macro_tmp_588.addr = ((DefaultRectangularDom_1_int64_t_F)((dom)->addr));
+        _cast_tmp_3 = chpl_macro_tmp_588;
+        chpl_macro_tmp_589.locale = (&_cast_tmp_3)->locale;
+        chpl_macro_tmp_589.addr = ((BaseRectangularDom)((&_cast_tmp_3)->addr));
+        _parent_destructor_tmp_4 = chpl_macro_tmp_589;
+        chpl_macro_tmp_590.locale = (&_parent_destructor_tmp_4)->locale;
+        chpl_macro_tmp_590.addr = ((BaseDom)((&_parent_destructor_tmp_4)->addr));
+        _parent_destructor_tmp_5 = chpl_macro_tmp_590;
+        chpl_check_nil((&_parent_destructor_tmp_5)->addr, INT64(306), "/root/repo/modules/internal/ChapelDistribution.chpl");
+        chpl_macro_tmp_591.locale = (&_parent_destructor_tmp_5)->locale;
+        chpl_macro_tmp_591.addr = &(((&_parent_destructor_tmp_5)->addr)->_arrsLock);
+        _field_destructor_tmp_7 = chpl_macro_tmp_591;
+        chpl_macro_tmp_592.locale = (_field_destructor_tmp_7).locale;
+        chpl_macro_tmp_592.addr = &(((_field_destructor_tmp_7).addr)->_v);
+        call_tmp8 = chpl_macro_tmp_592;
+        T5 = (&call_tmp8)->addr;
+        atomic_destroy_flag(T5);
+        chpl_macro_tmp_593.locale = chpl_gen_getLocaleID();
+        chpl_macro_tmp_593.addr = T5;
+        call_tmp8 = chpl_macro_tmp_593;
+        chpl_check_nil((&_parent_destructor_tmp_5)->addr, INT64(306), "/root/repo/modules/internal/ChapelDistribution.chpl");
+        chpl_macro_tmp_594.locale = (&_parent_destructor_tmp_5)->locale;
+        chpl_macro_tmp_594.addr = &(((&_parent_destructor_tmp_5)->addr)->_domCnt);
+        _field_destructor_tmp_8 = chpl_macro_tmp_594;
+        chpl_macro_tmp_595.locale = (_field_destructor_tmp_8).locale;
+        chpl_macro_tmp_595.addr = &(((_field_destructor_tmp_8).addr)->_cnt);
+        _field_destructor_tmp_9 = chpl_macro_tmp_595;
+        chpl_macro_tmp_596.locale = (_field_destructor_tmp_9).locale;
+        chpl_macro_tmp_596.addr = &(((_field_destructor_tmp_9).addr)->_v);
+        call_tmp9 = chpl_macro_tmp_596;
+        T6 = (&call_tmp9)->addr;
+        atomic_destroy_int_least64_t(T6);
+        chpl_macro_tmp_597.locale = chpl_gen_getLocaleID();
+        chpl_macro_tmp_597.addr = T6;
+        call_tmp9 = chpl_macro_tmp_597;
+      } else {
+        chpl_check_nil((&delete_tmp)->addr, INT64(306), "/root/repo/modules/internal/ChapelDistribution.chpl");
+        chpl_macro_tmp_598.locale = (&delete_tmp)->locale;
+        chpl_macro_tmp_598.addr = &(((&delete_tmp)->addr)->_arrsLock);
+        _field_destructor_tmp_10 = chpl_macro_tmp_598;
+        chpl_macro_tmp_599.locale = (_field_destructor_tmp_10).locale;
+        chpl_macro_tmp_599.addr = &(((_field_destructor_tmp_10).addr)->_v);
+        call_tmp10 = chpl_macro_tmp_599;
+        T7 = (&call_tmp10)->addr;
+        atomic_destroy_flag(T7);
+        chpl_macro_tmp_600.locale = chpl_gen_getLocaleID();
+        chpl_macro_tmp_600.addr = T7;
+        call_tmp10 = chpl_macro_tmp_600;
+        chpl_check_nil((&delete_tmp)->addr, INT64(306), "/root/repo/modules/internal/ChapelDistribution.chpl");
+        chpl_macro_tmp_601.locale = (&delete_tmp)->locale;
+        chpl_macro_tmp_601.addr = &(((&delete_tmp)->addr)->_domCnt);
+        _field_destructor_tmp_11 = chpl_macro_tmp_601;
+        chpl_macro_tmp_602.locale = (_field_destructor_tmp_11).locale;
+        chpl_macro_tmp_602.addr = &(((_field_destructor_tmp_11).addr)->_cnt);
+        _field_destructor_tmp_12 = chpl_macro_tmp_602;
+        chpl_macro_tmp_603.locale = (_field_destructor_tmp_12).locale;
+        chpl_macro_tmp_603.addr = &(((_field_destructor_tmp_12).addr)->_v);
+        call_tmp11 = chpl_macro_tmp_603;
+        T8 = (&call_tmp11)->addr;
+        atomic_destroy_int_least64_t(T8);
+        chpl_macro_tmp_604.locale = chpl_gen_getLocaleID();
+        chpl_macro_tmp_604.addr = T8;
+        call_tmp11 = chpl_macro_tmp_604;
+      }
+    }
+    call_tmp12 = (&delete_tmp)->locale;
+    rvfDerefTmp = delete_tmp;
+    _args_size2 = sizeof(chpl__class_localson_fn30_object);
+    _args_alloc2 = chpl_mem_allocPooled(_args_size2, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn2 = ((_class_localson_fn30)(_args_alloc2));
+    chpl_check_nil(_args_foron_fn2, INT64(306), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_0__tmp = call_tmp12;
+    chpl_check_nil(_args_foron_fn2, INT64(306), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    (_args_foron_fn2)->_1_rvfDerefTmp = rvfDerefTmp;
+    (_args_foron_fn2)->_ln = _ln;
+    (_args_foron_fn2)->_fn = _fn;
+    /*** wrapon_fn30 ***/ chpl_executeOn(&call_tmp12, INT32(33), _args_foron_fn2, sizeof(chpl__class_localson_fn30_object), INT64(306), "/root/repo/modules/internal/ChapelDistribution.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn2)), _ln, _fn);
+  }
+  return;
+}
+
+/* ChapelDistribution.chpl:302 */
+static void wrapon_fn29(_class_localson_fn29 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_BaseDom _1_rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseArr _2_this = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(302), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _1_rvfDerefTmp = (c)->_1_rvfDerefTmp;
+  chpl_check_nil(c, INT64(302), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _2_this = (c)->_2_this;
+  on_fn29(&_1_rvfDerefTmp, &_2_this, _ln, _fn);
+  return;
+}
+
+/* ChapelDistribution.chpl:306 */
+static void on_fn30(chpl____wide_BaseDom* const delete_tmp, int64_t _ln, c_string _fn) {
+  chpl_opaque call_tmp;
+  call_tmp = ((void*)((delete_tmp)->addr));
+  chpl_here_free(call_tmp, _ln, _fn);
+  return;
+}
+
+/* ChapelDistribution.chpl:306 */
+static void wrapon_fn30(_class_localson_fn30 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_BaseDom _1_rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(306), "/root/repo/modules/internal/ChapelDistribution.chpl");
+  _1_rvfDerefTmp = (c)->_1_rvfDerefTmp;
+  on_fn30(&_1_rvfDerefTmp, _ln, _fn);
+  return;
+}
+
+/* ChapelDistribution.chpl:312 */
+static void dsiDestroyData(chpl____wide_BaseArr* const this6, int64_t _ln, c_string _fn) {
+  return;
+}
+
+/* ChapelDistribution.chpl:314 */
+static void dsiReallocate(chpl____wide_BaseArr* const this6, chpl____wide_DefaultRectangularDom_1_int64_t_F* const d, int64_t _ln, c_string _fn) {
+  c_string T;
+  T = "reallocating not supported for this array type";
+  halt(T, _ln, _fn);
+  return;
+}
+
+/* ChapelDistribution.chpl:318 */
+static void dsiPostReallocate(chpl____wide_BaseArr* const this6) {
+  return;
+}
+
@@ -0,0 +1,726 @@
+/* ChapelIO.chpl:23 */
+static void chpl__init_ChapelIO(int64_t _ln, c_string _fn) {
+  c_string modFormatStr;
+  c_string modStr;
+  _ref_int32_t refIndentLevel = NULL;
+  chpl____wide__ref_chpl_bool chpl_macro_tmp_605;
+  chpl_bool chpl_macro_tmp_606;
+  if (chpl__init_ChapelIO_p) {
+    goto _exit_chpl__init_ChapelIO;
+  }
+  modFormatStr = "%*s\n";
+  modStr = "ChapelIO";
+  printModuleInit(modFormatStr, modStr, INT64(8), _ln, _fn);
+  refIndentLevel = &moduleInitLevel;
+  *(refIndentLevel) += INT64(1);
+  chpl__init_ChapelIO_p = true;
+  {
+    chpl__init_ChapelBase(_ln, _fn);
+    chpl__init_SysBasic(_ln, _fn);
+    chpl__init_IO(_ln, _fn);
+  }
+  chpl_check_nil((&chpl__testParOn)->addr, INT64(652), "/root/repo/modules/internal/ChapelIO.chpl");
+  chpl_macro_tmp_605.locale = (&chpl__testParOn)->locale;
+  chpl_macro_tmp_605.addr = &(((&chpl__testParOn)->addr)->value);
+  chpl_macro_tmp_606 = false;
+  chpl_gen_comm_put(((void*)(&chpl_macro_tmp_606)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_605).locale), INT64(0), NULL), (chpl_macro_tmp_605).addr, sizeof(chpl_bool), -1, INT64(1), INT64(652), "/root/repo/modules/internal/ChapelIO.chpl");
+  *(refIndentLevel) -= INT64(1);
+  _exit_chpl__init_ChapelIO:;
+  return;
+}
+
+/* ChapelIO.chpl:34 */
+static Writer _construct_Writer(Writer meme, int64_t _ln, c_string _fn) {
+  Writer this6 = NULL;
+  object T = NULL;
+  this6 = meme;
+  chpl_check_nil(this6, INT64(34), "/root/repo/modules/internal/ChapelIO.chpl");
+  T = &((this6)->super);
+  _construct_object(T);
+  return meme;
+}
+
+/* ChapelIO.chpl:34 */
+static void chpl__auto_destroy_Writer(Writer this6, int64_t _ln, c_string _fn) {
+  return;
+}
+
+/* ChapelIO.chpl:37 */
+static chpl_bool binary(Writer this6, int64_t _ln, c_string _fn) {
+  chpl_bool ret;
+  _ref_chpl_bool _ref_tmp_ = NULL;
+  _ref_tmp_ = &ret;
+  *(_ref_tmp_) = false;
+  return ret;
+}
+
+/* ChapelIO.chpl:39 */
+static int64_t styleElement(Writer this6, int64_t element) {
+  return INT64(0);
+}
+
+/* ChapelIO.chpl:44 */
+static void writePrimitive(chpl____wide_Writer* const this6, chpl____wide_chpl_string x2, int64_t _ln, c_string _fn) {
+  c_string T;
+  T = "Generic Writer.writePrimitive called";
+  halt(T, _ln, _fn);
+  return;
+}
+
+/* ChapelIO.chpl:44 */
+static void writePrimitive2(chpl____wide_Writer* const this6, ioLiteral* const x2, int64_t _ln, c_string _fn) {
+  c_string T;
+  T = "Generic Writer.writePrimitive called";
+  halt(T, _ln, _fn);
+  return;
+}
+
+/* ChapelIO.chpl:44 */
+static void writePrimitive3(chpl____wide_Writer* const this6, int64_t x2, int64_t _ln, c_string _fn) {
+  c_string T;
+  T = "Generic Writer.writePrimitive called";
+  halt(T, _ln, _fn);
+  return;
+}
+
+/* ChapelIO.chpl:51 */
+static void writeIt(chpl____wide_Writer* const this6, chpl____wide_chpl_string x2, int64_t _ln, c_string _fn) {
+  chpl_bool _dynamic_dispatch_tmp_;
+  chpl____wide_StringWriter _cast_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_int32_t chpl_macro_tmp_607;
+  int32_t chpl_macro_tmp_608;
+  chpl____wide_StringWriter chpl_macro_tmp_609;
+  chpl_check_nil((this6)->addr, INT64(53), "/root/repo/modules/internal/ChapelIO.chpl");
+  chpl_macro_tmp_607.locale = (this6)->locale;
+  chpl_macro_tmp_607.addr = &(((object)((this6)->addr))->chpl__cid);
+  chpl_gen_comm_get(((void*)(&chpl_macro_tmp_608)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_607).locale), INT64(0), NULL), (chpl_macro_tmp_607).addr, sizeof(int32_t), -1, INT64(1), INT64(53), "/root/repo/modules/internal/ChapelIO.chpl");
+  _dynamic_dispatch_tmp_ = (chpl_macro_tmp_608 == chpl__cid_StringWriter);
+  if (_dynamic_dispatch_tmp_) {
+    chpl_macro_tmp_609.locale = (this6)->locale;
+    chpl_macro_tmp_609.addr = ((StringWriter)((this6)->addr));
+    _cast_tmp_ = chpl_macro_tmp_609;
+    chpl_check_nil((&_cast_tmp_)->addr, INT64(53), "/root/repo/modules/internal/ChapelIO.chpl");
+    writePrimitive4(&_cast_tmp_, x2, _ln, _fn);
+  } else {
+    chpl_check_nil((this6)->addr, INT64(53), "/root/repo/modules/internal/ChapelIO.chpl");
+    writePrimitive(this6, x2, _ln, _fn);
+  }
+  return;
+}
+
+/* ChapelIO.chpl:51 */
+static void writeIt2(Writer this6, _tuple_1_star_int64_t* const x2, int64_t _ln, c_string _fn) {
+  _ref__tuple_1_star_int64_t _ref_tmp_ = NULL;
+  _ref_tmp_ = x2;
+  readWriteThis(_ref_tmp_, this6, _ln, _fn);
+  return;
+}
+
+/* ChapelIO.chpl:51 */
+static void writeIt3(chpl____wide_Writer* const this6, ioLiteral* const x2, int64_t _ln, c_string _fn) {
+  chpl_bool _dynamic_dispatch_tmp_;
+  chpl____wide_StringWriter _cast_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_int32_t chpl_macro_tmp_610;
+  int32_t chpl_macro_tmp_611;
+  chpl____wide_StringWriter chpl_macro_tmp_612;
+  chpl_check_nil((this6)->addr, INT64(53), "/root/repo/modules/internal/ChapelIO.chpl");
+  chpl_macro_tmp_610.locale = (this6)->locale;
+  chpl_macro_tmp_610.addr = &(((object)((this6)->addr))->chpl__cid);
+  chpl_gen_comm_get(((void*)(&chpl_macro_tmp_611)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_610).locale), INT64(0), NULL), (chpl_macro_tmp_610).addr, sizeof(int32_t), -1, INT64(1), INT64(53), "/root/repo/modules/internal/ChapelIO.chpl");
+  _dynamic_dispatch_tmp_ = (chpl_macro_tmp_611 == chpl__cid_StringWriter);
+  if (_dynamic_dispatch_tmp_) {
+    chpl_macro_tmp_612.locale = (this6)->locale;
+    chpl_macro_tmp_612.addr = ((StringWriter)((this6)->addr));
+    _cast_tmp_ = chpl_macro_tmp_612;
+    chpl_check_nil((&_cast_tmp_)->addr, INT64(53), "/root/repo/modules/internal/ChapelIO.chpl");
+    writePrimitive5(&_cast_tmp_, x2, _ln, _fn);
+  } else {
+    chpl_check_nil((this6)->addr, INT64(53), "/root/repo/modules/internal/ChapelIO.chpl");
+    writePrimitive2(this6, x2, _ln, _fn);
+  }
+  return;
+}
+
+/* ChapelIO.chpl:51 */
+static void writeIt4(chpl____wide_Writer* const this6, int64_t x2, int64_t _ln, c_string _fn) {
+  chpl_bool _dynamic_dispatch_tmp_;
+  chpl____wide_StringWriter _cast_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_int32_t chpl_macro_tmp_613;
+  int32_t chpl_macro_tmp_614;
+  chpl____wide_StringWriter chpl_macro_tmp_615;
+  chpl_check_nil((this6)->addr, INT64(53), "/root/repo/modules/internal/ChapelIO.chpl");
+  chpl_macro_tmp_613.locale = (this6)->locale;
+  chpl_macro_tmp_613.addr = &(((object)((this6)->addr))->chpl__cid);
+  chpl_gen_comm_get(((void*)(&chpl_macro_tmp_614)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_613).locale), INT64(0), NULL), (chpl_macro_tmp_613).addr, sizeof(int32_t), -1, INT64(1), INT64(53), "/root/repo/modules/internal/ChapelIO.chpl");
+  _dynamic_dispatch_tmp_ = (chpl_macro_tmp_614 == chpl__cid_StringWriter);
+  if (_dynamic_dispatch_tmp_) {
+    chpl_macro_tmp_615.locale = (this6)->locale;
+    chpl_macro_tmp_615.addr = ((StringWriter)((this6)->addr));
+    _cast_tmp_ = chpl_macro_tmp_615;
+    chpl_check_nil((&_cast_tmp_)->addr, INT64(53), "/root/repo/modules/internal/ChapelIO.chpl");
+    writePrimitive6(&_cast_tmp_, x2, _ln, _fn);
+  } else {
+    chpl_check_nil((this6)->addr, INT64(53), "/root/repo/modules/internal/ChapelIO.chpl");
+    writePrimitive3(this6, x2, _ln, _fn);
+  }
+  return;
+}
+
+/* ChapelIO.chpl:74 */
+static void readwrite(Writer this6, ioLiteral* const x2, int64_t _ln, c_string _fn) {
+  chpl____wide_Writer T = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_Writer chpl_macro_tmp_616;
+  chpl_macro_tmp_616.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_616.addr = this6;
+  T = chpl_macro_tmp_616;
+  chpl_check_nil((&T)->addr, INT64(75), "/root/repo/modules/internal/ChapelIO.chpl");
+  writeIt3(&T, x2, _ln, _fn);
+  return;
+}
+
+/* ChapelIO.chpl:74 */
+static void readwrite2(Writer this6, int64_t x2, int64_t _ln, c_string _fn) {
+  chpl____wide_Writer T = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_Writer chpl_macro_tmp_617;
+  chpl_macro_tmp_617.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_617.addr = this6;
+  T = chpl_macro_tmp_617;
+  chpl_check_nil((&T)->addr, INT64(75), "/root/repo/modules/internal/ChapelIO.chpl");
+  writeIt4(&T, x2, _ln, _fn);
+  return;
+}
+
+/* ChapelIO.chpl:77 */
+static void write2(Writer this6, chpl____wide_chpl_string _e0_args, _tuple_1_star_int64_t* const _e1_args, int64_t _ln, c_string _fn) {
+  int64_t this_x2_x1;
+  chpl____wide_Writer T = {CHPL_LOCALEID_T_INIT, NULL};
+  _tuple_1_star_int64_t coerce_tmp;
+  chpl____wide_Writer chpl_macro_tmp_618;
+  this_x2_x1 = *(*(_e1_args) + INT64(0));
+  chpl_macro_tmp_618.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_618.addr = this6;
+  T = chpl_macro_tmp_618;
+  chpl_check_nil((&T)->addr, INT64(79), "/root/repo/modules/internal/ChapelIO.chpl");
+  writeIt(&T, _e0_args, _ln, _fn);
+  *(coerce_tmp + INT64(0)) = this_x2_x1;
+  chpl_check_nil(this6, INT64(79), "/root/repo/modules/internal/ChapelIO.chpl");
+  writeIt2(this6, &coerce_tmp, _ln, _fn);
+  return;
+}
+
+/* ChapelIO.chpl:77 */
+static void write3(Writer this6, chpl____wide_chpl_string _e0_args, int64_t _e1_args, int64_t _ln, c_string _fn) {
+  chpl____wide_Writer T = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_Writer T2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_Writer chpl_macro_tmp_619;
+  chpl____wide_Writer chpl_macro_tmp_620;
+  chpl_macro_tmp_619.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_619.addr = this6;
+  T = chpl_macro_tmp_619;
+  chpl_check_nil((&T)->addr, INT64(79), "/root/repo/modules/internal/ChapelIO.chpl");
+  writeIt(&T, _e0_args, _ln, _fn);
+  chpl_macro_tmp_620.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_620.addr = this6;
+  T2 = chpl_macro_tmp_620;
+  chpl_check_nil((&T2)->addr, INT64(79), "/root/repo/modules/internal/ChapelIO.chpl");
+  writeIt4(&T2, _e1_args, _ln, _fn);
+  return;
+}
+
+/* ChapelIO.chpl:203 */
+static void chpl__auto_destroy_Reader(Reader this6, int64_t _ln, c_string _fn) {
+  return;
+}
+
+/* ChapelIO.chpl:484 */
+static void assert2(chpl_bool test, int64_t _ln, c_string _fn) {
+  chpl_bool call_tmp;
+  call_tmp = (! test);
+  if (call_tmp) {
+    chpl_error("assert failed", _ln, _fn);
+  }
+  return;
+}
+
+/* ChapelIO.chpl:507 */
+static void halt(c_string s, int64_t _ln, c_string _fn) {
+  c_string_copy call_tmp;
+  call_tmp = string_concat("halt reached - ", s, _ln, _fn);
+  chpl_error(call_tmp, _ln, _fn);
+  return;
+}
+
+/* ChapelIO.chpl:511 */
+static void halt2(chpl____wide_chpl_string _e0_args, _tuple_1_star_int64_t* const _e1_args, int64_t _ln, c_string _fn) {
+  int64_t this_x2_x1;
+  c_string tmpstring;
+  _tuple_1_star_int64_t coerce_tmp;
+  chpl____wide__ref_c_string _ref_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  c_string_copy call_tmp;
+  chpl____wide__ref_c_string chpl_macro_tmp_621;
+  this_x2_x1 = *(*(_e1_args) + INT64(0));
+  tmpstring = "";
+  *(coerce_tmp + INT64(0)) = this_x2_x1;
+  chpl_macro_tmp_621.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_621.addr = &tmpstring;
+  _ref_tmp_ = chpl_macro_tmp_621;
+  write4(&_ref_tmp_, _e0_args, &coerce_tmp, _ln, _fn);
+  call_tmp = string_concat("halt reached - ", tmpstring, _ln, _fn);
+  chpl_error(call_tmp, _ln, _fn);
+  return;
+}
+
+/* ChapelIO.chpl:511 */
+static void halt3(chpl____wide_chpl_string _e0_args, int64_t _e1_args, int64_t _ln, c_string _fn) {
+  c_string tmpstring;
+  chpl____wide__ref_c_string _ref_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  c_string_copy call_tmp;
+  chpl____wide__ref_c_string chpl_macro_tmp_622;
+  tmpstring = "";
+  chpl_macro_tmp_622.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_622.addr = &tmpstring;
+  _ref_tmp_ = chpl_macro_tmp_622;
+  write5(&_ref_tmp_, _e0_args, _e1_args, _ln, _fn);
+  call_tmp = string_concat("halt reached - ", tmpstring, _ln, _fn);
+  chpl_error(call_tmp, _ln, _fn);
+  return;
+}
+
+/* ChapelIO.chpl:547 */
+static StringWriter _construct_StringWriter(c_string_copy s, StringWriter meme, int64_t _ln, c_string _fn) {
+  StringWriter this6 = NULL;
+  Writer T = NULL;
+  this6 = meme;
+  chpl_check_nil(this6, INT64(547), "/root/repo/modules/internal/ChapelIO.chpl");
+  T = &((this6)->super);
+  _construct_Writer(T, _ln, _fn);
+  chpl_check_nil(this6, INT64(548), "/root/repo/modules/internal/ChapelIO.chpl");
+  (this6)->s = s;
+  return this6;
+}
+
+/* ChapelIO.chpl:549 */
+static StringWriter StringWriter2(c_string x2, int64_t _ln, c_string _fn) {
+  StringWriter this6 = NULL;
+  StringWriter this7 = NULL;
+  int64_t call_tmp;
+  chpl_opaque cast_tmp;
+  StringWriter T = NULL;
+  c_string_copy ret;
+  StringWriter wrap_call_tmp = NULL;
+  _ref_c_string_copy call_tmp2 = NULL;
+  c_string_copy call_tmp3;
+  c_string_copy coerce_tmp;
+  c_string call_tmp4;
+  c_string call_tmp5;
+  int64_t call_tmp6;
+  chpl_bool call_tmp7;
+  _ref_c_string_copy T2 = NULL;
+  call_tmp = sizeof(chpl_StringWriter_object);
+  cast_tmp = chpl_here_alloc(call_tmp, INT16(18), _ln, _fn);
+  T = ((StringWriter)(cast_tmp));
+  this7 = T;
+  ((object)(this7))->chpl__cid = chpl__cid_StringWriter;
+  chpl_check_nil(this7, INT64(549), "/root/repo/modules/internal/ChapelIO.chpl");
+  (this7)->s = NULL;
+  ret = NULL;
+  chpl_check_nil(this7, INT64(549), "/root/repo/modules/internal/ChapelIO.chpl");
+  (this7)->s = ret;
+  wrap_call_tmp = _construct_StringWriter(ret, this7, _ln, _fn);
+  this6 = wrap_call_tmp;
+  chpl_check_nil(this6, INT64(550), "/root/repo/modules/internal/ChapelIO.chpl");
+  call_tmp2 = &((this6)->s);
+  call_tmp3 = string_copy(x2, _ln, _fn);
+  chpl_check_nil(this6, INT64(550), "/root/repo/modules/internal/ChapelIO.chpl");
+  coerce_tmp = (this6)->s;
+  call_tmp4 = ((c_string)(coerce_tmp));
+  call_tmp5 = ((c_string)(NULL));
+  call_tmp6 = string_compare(call_tmp4, call_tmp5);
+  call_tmp7 = (call_tmp6 != INT64(0));
+  if (call_tmp7) {
+    T2 = call_tmp2;
+    chpl_rt_free_c_string(T2, _ln, _fn);
+    call_tmp2 = T2;
+  }
+  *(call_tmp2) = call_tmp3;
+  return this6;
+}
+
+/* ChapelIO.chpl:552 */
+static void writePrimitive4(chpl____wide_StringWriter* const this6, chpl____wide_chpl_string x2, int64_t _ln, c_string _fn) {
+  c_string_copy aug;
+  c_string_copy call_tmp;
+  chpl____wide__ref_c_string_copy call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  c_string_copy coerce_tmp;
+  c_string call_tmp3;
+  c_string call_tmp4;
+  c_string_copy call_tmp5;
+  c_string_copy coerce_tmp2;
+  c_string call_tmp6;
+  c_string call_tmp7;
+  int64_t call_tmp8;
+  chpl_bool call_tmp9;
+  _ref_c_string_copy T = NULL;
+  _ref_c_string_copy _ref_tmp_ = NULL;
+  c_string call_tmp10;
+  c_string call_tmp11;
+  int64_t call_tmp12;
+  chpl_bool call_tmp13;
+  _ref_c_string_copy T2 = NULL;
+  chpl____wide__ref_c_string_copy chpl_macro_tmp_623;
+  chpl____wide__ref_c_string_copy chpl_macro_tmp_624;
+  chpl____wide__ref_c_string_copy chpl_macro_tmp_625;
+  chpl____wide__ref_c_string_copy chpl_macro_tmp_626;
+  call_tmp = chpl_wide_string_copy(&x2, _ln, _fn);
+  aug = call_tmp;
+  chpl_check_nil((this6)->addr, INT64(555), "/root/repo/modules/internal/ChapelIO.chpl");
+  chpl_macro_tmp_623.locale = (this6)->locale;
+  chpl_macro_tmp_623.addr = &(((this6)->addr)->s);
+  call_tmp2 = chpl_macro_tmp_623;
+  chpl_check_nil((this6)->addr, INT64(555), "/root/repo/modules/internal/ChapelIO.chpl");
+  chpl_macro_tmp_624.locale = (this6)->locale;
+  chpl_macro_tmp_624.addr = &(((this6)->addr)->s);
+  chpl_gen_comm_get(((void*)(&coerce_tmp)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_624).locale), INT64(0), NULL), (chpl_macro_tmp_624).addr, sizeof(c_string_copy), -1, INT64(1), INT64(555), "/root/repo/modules/internal/ChapelIO.chpl");
+  call_tmp3 = ((c_string)(coerce_tmp));
+  call_tmp4 = ((c_string)(call_tmp));
+  call_tmp5 = string_concat(call_tmp3, call_tmp4, _ln, _fn);
+  chpl_check_nil((this6)->addr, INT64(555), "/root/repo/modules/internal/ChapelIO.chpl");
+  chpl_macro_tmp_625.locale = (this6)->locale;
+  chpl_macro_tmp_625.addr = &(((this6)->addr)->s);
+  chpl_gen_comm_get(((void*)(&coerce_tmp2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_625).locale), INT64(0), NULL), (chpl_macro_tmp_625).addr, sizeof(c_string_copy), -1, INT64(1), INT64(555), "/root/repo/modules/internal/ChapelIO.chpl");
+  call_tmp6 = ((c_string)(coerce_tmp2));
+  call_tmp7 = ((c_string)(NULL));
+  call_tmp8 = string_compare(call_tmp6, call_tmp7);
+  call_tmp9 = (call_tmp8 != INT64(0));
+  if (call_tmp9) {
+    T = (&call_tmp2)->addr;
+    chpl_rt_free_c_string(T, _ln, _fn);
+    chpl_macro_tmp_626.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_626.addr = T;
+    call_tmp2 = chpl_macro_tmp_626;
+  }
+  chpl_gen_comm_put(((void*)(&call_tmp5)), chpl_nodeFromLocaleID(&((call_tmp2).locale), INT64(0), NULL), (call_tmp2).addr, sizeof(c_string_copy), -1, INT64(1), INT64(555), "/root/repo/modules/internal/ChapelIO.chpl");
+  _ref_tmp_ = &aug;
+  call_tmp10 = ((c_string)(aug));
+  call_tmp11 = ((c_string)(NULL));
+  call_tmp12 = string_compare(call_tmp10, call_tmp11);
+  call_tmp13 = (call_tmp12 != INT64(0));
+  if (call_tmp13) {
+    T2 = _ref_tmp_;
+    chpl_rt_free_c_string(T2, _ln, _fn);
+    _ref_tmp_ = T2;
+  }
+  return;
+}
+
+/* ChapelIO.chpl:552 */
+static void writePrimitive5(chpl____wide_StringWriter* const this6, ioLiteral* const x2, int64_t _ln, c_string _fn) {
+  c_string_copy aug;
+  _ref_c_string call_tmp = NULL;
+  c_string T;
+  c_string ret;
+  c_string_copy call_tmp2;
+  chpl____wide__ref_c_string_copy call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  c_string_copy coerce_tmp;
+  c_string call_tmp4;
+  c_string call_tmp5;
+  c_string_copy call_tmp6;
+  c_string_copy coerce_tmp2;
+  c_string call_tmp7;
+  c_string call_tmp8;
+  int64_t call_tmp9;
+  chpl_bool call_tmp10;
+  _ref_c_string_copy T2 = NULL;
+  _ref_c_string_copy _ref_tmp_ = NULL;
+  c_string call_tmp11;
+  c_string call_tmp12;
+  int64_t call_tmp13;
+  chpl_bool call_tmp14;
+  _ref_c_string_copy T3 = NULL;
+  chpl____wide__ref_c_string_copy chpl_macro_tmp_627;
+  chpl____wide__ref_c_string_copy chpl_macro_tmp_628;
+  chpl____wide__ref_c_string_copy chpl_macro_tmp_629;
+  chpl____wide__ref_c_string_copy chpl_macro_tmp_630;
+  ret = (x2)->val;
+  T = ret;
+  call_tmp = &T;
+  call_tmp2 = string_copy(*(call_tmp), _ln, _fn);
+  aug = call_tmp2;
+  chpl_check_nil((this6)->addr, INT64(555), "/root/repo/modules/internal/ChapelIO.chpl");
+  chpl_macro_tmp_627.locale = (this6)->locale;
+  chpl_macro_tmp_627.addr = &(((this6)->addr)->s);
+  call_tmp3 = chpl_macro_tmp_627;
+  chpl_check_nil((this6)->addr, INT64(555), "/root/repo/modules/internal/ChapelIO.chpl");
+  chpl_macro_tmp_628.locale = (this6)->locale;
+  chpl_macro_tmp_628.addr = &(((this6)->addr)->s);
+  chpl_gen_comm_get(((void*)(&coerce_tmp)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_628).locale), INT64(0), NULL), (chpl_macro_tmp_628).addr, sizeof(c_string_copy), -1, INT64(1), INT64(555), "/root/repo/modules/internal/ChapelIO.chpl");
+  call_tmp4 = ((c_string)(coerce_tmp));
+  call_tmp5 = ((c_string)(call_tmp2));
+  call_tmp6 = string_concat(call_tmp4, call_tmp5, _ln, _fn);
+  chpl_check_nil((this6)->addr, INT64(555), "/root/repo/modules/internal/ChapelIO.chpl");
+  chpl_macro_tmp_629.locale = (this6)->locale;
+  chpl_macro_tmp_629.addr = &(((this6)->addr)->s);
+  chpl_gen_comm_get(((void*)(&coerce_tmp2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_629).locale), INT64(0), NULL), (chpl_macro_tmp_629).addr, sizeof(c_string_copy), -1, INT64(1), INT64(555), "/root/repo/modules/internal/ChapelIO.chpl");
+  call_tmp7 = ((c_string)(coerce_tmp2));
+  call_tmp8 = ((c_string)(NULL));
+  call_tmp9 = string_compare(call_tmp7, call_tmp8);
+  call_tmp10 = (call_tmp9 != INT64(0));
+  if (call_tmp10) {
+    T2 = (&call_tmp3)->addr;
+    chpl_rt_free_c_string(T2, _ln, _fn);
+    chpl_macro_tmp_630.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_630.addr = T2;
+    call_tmp3 = chpl_macro_tmp_630;
+  }
+  chpl_gen_comm_put(((void*)(&call_tmp6)), chpl_nodeFromLocaleID(&((call_tmp3).locale), INT64(0), NULL), (call_tmp3).addr, sizeof(c_string_copy), -1, INT64(1), INT64(555), "/root/repo/modules/internal/ChapelIO.chpl");
+  _ref_tmp_ = &aug;
+  call_tmp11 = ((c_string)(aug));
+  call_tmp12 = ((c_string)(NULL));
+  call_tmp13 = string_compare(call_tmp11, call_tmp12);
+  call_tmp14 = (call_tmp13 != INT64(0));
+  if (call_tmp14) {
+    T3 = _ref_tmp_;
+    chpl_rt_free_c_string(T3, _ln, _fn);
+    _ref_tmp_ = T3;
+  }
+  return;
+}
+
+/* ChapelIO.chpl:552 */
+static void writePrimitive6(chpl____wide_StringWriter* const this6, int64_t x2, int64_t _ln, c_string _fn) {
+  c_string_copy aug;
+  c_string_copy call_tmp;
+  uint32_t call_tmp2;
+  chpl____wide__ref_c_string_copy call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  c_string_copy coerce_tmp;
+  c_string call_tmp4;
+  c_string call_tmp5;
+  c_string_copy call_tmp6;
+  c_string_copy coerce_tmp2;
+  c_string call_tmp7;
+  c_string call_tmp8;
+  int64_t call_tmp9;
+  chpl_bool call_tmp10;
+  _ref_c_string_copy T = NULL;
+  _ref_c_string_copy _ref_tmp_ = NULL;
+  c_string call_tmp11;
+  c_string call_tmp12;
+  int64_t call_tmp13;
+  chpl_bool call_tmp14;
+  _ref_c_string_copy T2 = NULL;
+  chpl____wide__ref_c_string_copy chpl_macro_tmp_631;
+  chpl____wide__ref_c_string_copy chpl_macro_tmp_632;
+  chpl____wide__ref_c_string_copy chpl_macro_tmp_633;
+  chpl____wide__ref_c_string_copy chpl_macro_tmp_634;
+  call_tmp2 = ((uint32_t)(INT64(8)));
+  call_tmp = integral_to_c_string_copy(x2, call_tmp2, true);
+  aug = call_tmp;
+  chpl_check_nil((this6)->addr, INT64(555), "/root/repo/modules/internal/ChapelIO.chpl");
+  chpl_macro_tmp_631.locale = (this6)->locale;
+  chpl_macro_tmp_631.addr = &(((this6)->addr)->s);
+  call_tmp3 = chpl_macro_tmp_631;
+  chpl_check_nil((this6)->addr, INT64(555), "/root/repo/modules/internal/ChapelIO.chpl");
+  chpl_macro_tmp_632.locale = (this6)->locale;
+  chpl_macro_tmp_632.addr = &(((this6)->addr)->s);
+  chpl_gen_comm_get(((void*)(&coerce_tmp)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_632).locale), INT64(0), NULL), (chpl_macro_tmp_632).addr, sizeof(c_string_copy), -1, INT64(1), INT64(555), "/root/repo/modules/internal/ChapelIO.chpl");
+  call_tmp4 = ((c_string)(coerce_tmp));
+  call_tmp5 = ((c_string)(call_tmp));
+  call_tmp6 = string_concat(call_tmp4, call_tmp5, _ln, _fn);
+  chpl_check_nil((this6)->addr, INT64(555), "/root/repo/modules/internal/ChapelIO.chpl");
+  chpl_macro_tmp_633.locale = (this6)->locale;
+  chpl_macro_tmp_633.addr = &(((this6)->addr)->s);
+  chpl_gen_comm_get(((void*)(&coerce_tmp2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_633).locale), INT64(0), NULL), (chpl_macro_tmp_633).addr, sizeof(c_string_copy), -1, INT64(1), INT64(555), "/root/repo/modules/internal/ChapelIO.chpl");
+  call_tmp7 = ((c_string)(coerce_tmp2));
+  call_tmp8 = ((c_string)(NULL));
+  call_tmp9 = string_compare(call_tmp7, call_tmp8);
+  call_tmp10 = (call_tmp9 != INT64(0));
+  if (call_tmp10) {
+    T = (&call_tmp3)->addr;
+    chpl_rt_free_c_string(T, _ln, _fn);
+    chpl_macro_tmp_634.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_634.addr = T;
+    call_tmp3 = chpl_macro_tmp_634;
+  }
+  chpl_gen_comm_put(((void*)(&call_tmp6)), chpl_nodeFromLocaleID(&((call_tmp3).locale), INT64(0), NULL), (call_tmp3).addr, sizeof(c_string_copy), -1, INT64(1), INT64(555), "/root/repo/modules/internal/ChapelIO.chpl");
+  _ref_tmp_ = &aug;
+  call_tmp11 = ((c_string)(aug));
+  call_tmp12 = ((c_string)(NULL));
+  call_tmp13 = string_compare(call_tmp11, call_tmp12);
+  call_tmp14 = (call_tmp13 != INT64(0));
+  if (call_tmp14) {
+    T2 = _ref_tmp_;
+    chpl_rt_free_c_string(T2, _ln, _fn);
+    _ref_tmp_ = T2;
+  }
+  return;
+}
+
+/* ChapelIO.chpl:558 */
+static void chpl___TILDE_StringWriter(StringWriter this6, int64_t _ln, c_string _fn) {
+  _ref_c_string_copy call_tmp = NULL;
+  c_string_copy coerce_tmp;
+  c_string call_tmp2;
+  c_string call_tmp3;
+  int64_t call_tmp4;
+  chpl_bool call_tmp5;
+  _ref_c_string_copy T = NULL;
+  _ref_c_string_copy call_tmp6 = NULL;
+  chpl_check_nil(this6, INT64(559), "/root/repo/modules/internal/ChapelIO.chpl");
+  call_tmp = &((this6)->s);
+  chpl_check_nil(this6, INT64(559), "/root/repo/modules/internal/ChapelIO.chpl");
+  coerce_tmp = (this6)->s;
+  call_tmp2 = ((c_string)(coerce_tmp));
+  call_tmp3 = ((c_string)(NULL));
+  call_tmp4 = string_compare(call_tmp2, call_tmp3);
+  call_tmp5 = (call_tmp4 != INT64(0));
+  if (call_tmp5) {
+    T = call_tmp;
+    chpl_rt_free_c_string(T, _ln, _fn);
+    call_tmp = T;
+  }
+  chpl_check_nil(this6, INT64(560), "/root/repo/modules/internal/ChapelIO.chpl");
+  call_tmp6 = &((this6)->s);
+  *(call_tmp6) = NULL;
+  return;
+}
+
+/* ChapelIO.chpl:580 */
+static void write4(chpl____wide__ref_c_string* const this6, chpl____wide_chpl_string _e0_args, _tuple_1_star_int64_t* const _e1_args, int64_t _ln, c_string _fn) {
+  int64_t this_x2_x1;
+  StringWriter sc = NULL;
+  c_string coerce_tmp;
+  Writer call_tmp = NULL;
+  _tuple_1_star_int64_t coerce_tmp2;
+  c_string_copy ret;
+  c_string call_tmp2;
+  _ref_c_string_copy call_tmp3 = NULL;
+  chpl____wide_StringWriter delete_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp4;
+  chpl____wide_StringWriter rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn31 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide_StringWriter chpl_macro_tmp_635;
+  this_x2_x1 = *(*(_e1_args) + INT64(0));
+  chpl_gen_comm_get(((void*)(&coerce_tmp)), chpl_nodeFromLocaleID(&((*(this6)).locale), INT64(0), NULL), (*(this6)).addr, sizeof(c_string), -1, INT64(1), INT64(581), "/root/repo/modules/internal/ChapelIO.chpl");
+  sc = StringWriter2(coerce_tmp, _ln, _fn);
+  call_tmp = ((Writer)(sc));
+  *(coerce_tmp2 + INT64(0)) = this_x2_x1;
+  chpl_check_nil(call_tmp, INT64(582), "/root/repo/modules/internal/ChapelIO.chpl");
+  write2(call_tmp, _e0_args, &coerce_tmp2, _ln, _fn);
+  chpl_check_nil(sc, INT64(584), "/root/repo/modules/internal/ChapelIO.chpl");
+  ret = (sc)->s;
+  call_tmp2 = ((c_string)(ret));
+  chpl_gen_comm_put(((void*)(&call_tmp2)), chpl_nodeFromLocaleID(&((*(this6)).locale), INT64(0), NULL), (*(this6)).addr, sizeof(c_string), -1, INT64(1), INT64(584), "/root/repo/modules/internal/ChapelIO.chpl");
+  chpl_check_nil(sc, INT64(586), "/root/repo/modules/internal/ChapelIO.chpl");
+  call_tmp3 = &((sc)->s);
+  *(call_tmp3) = NULL;
+  chpl_macro_tmp_635.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_635.addr = sc;
+  delete_tmp = chpl_macro_tmp_635;
+  chpl___TILDE_StringWriter(sc, _ln, _fn);
+  call_tmp4 = (&delete_tmp)->locale;
+  rvfDerefTmp = delete_tmp;
+  _args_size = sizeof(chpl__class_localson_fn31_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn31)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(587), "/root/repo/modules/internal/ChapelIO.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp4;
+  chpl_check_nil(_args_foron_fn, INT64(587), "/root/repo/modules/internal/ChapelIO.chpl");
+  (_args_foron_fn)->_1_rvfDerefTmp = rvfDerefTmp;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn31 ***/ chpl_executeOn(&call_tmp4, INT32(34), _args_foron_fn, sizeof(chpl__class_localson_fn31_object), INT64(587), "/root/repo/modules/internal/ChapelIO.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  return;
+}
+
+/* ChapelIO.chpl:580 */
+static void write5(chpl____wide__ref_c_string* const this6, chpl____wide_chpl_string _e0_args, int64_t _e1_args, int64_t _ln, c_string _fn) {
+  StringWriter sc = NULL;
+  c_string coerce_tmp;
+  Writer call_tmp = NULL;
+  c_string_copy ret;
+  c_string call_tmp2;
+  _ref_c_string_copy call_tmp3 = NULL;
+  chpl____wide_StringWriter delete_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp4;
+  chpl____wide_StringWriter rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn32 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide_StringWriter chpl_macro_tmp_636;
+  chpl_gen_comm_get(((void*)(&coerce_tmp)), chpl_nodeFromLocaleID(&((*(this6)).locale), INT64(0), NULL), (*(this6)).addr, sizeof(c_string), -1, INT64(1), INT64(581), "/root/repo/modules/internal/ChapelIO.chpl");
+  sc = StringWriter2(coerce_tmp, _ln, _fn);
+  call_tmp = ((Writer)(sc));
+  chpl_check_nil(call_tmp, INT64(582), "/root/repo/modules/internal/ChapelIO.chpl");
+  write3(call_tmp, _e0_args, _e1_args, _ln, _fn);
+  chpl_check_nil(sc, INT64(584), "/root/repo/modules/internal/ChapelIO.chpl");
+  ret = (sc)->s;
+  call_tmp2 = ((c_string)(ret));
+  chpl_gen_comm_put(((void*)(&call_tmp2)), chpl_nodeFromLocaleID(&((*(this6)).locale), INT64(0), NULL), (*(this6)).addr, sizeof(c_string), -1, INT64(1), INT64(584), "/root/repo/modules/internal/ChapelIO.chpl");
+  chpl_check_nil(sc, INT64(586), "/root/repo/modules/internal/ChapelIO.chpl");
+  call_tmp3 = &((sc)->s);
+  *(call_tmp3) = NULL;
+  chpl_macro_tmp_636.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_636.addr = sc;
+  delete_tmp = chpl_macro_tmp_636;
+  chpl___TILDE_StringWriter(sc, _ln, _fn);
+  call_tmp4 = (&delete_tmp)->locale;
+  rvfDerefTmp = delete_tmp;
+  _args_size = sizeof(chpl__class_localson_fn32_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn32)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(587), "/root/repo/modules/internal/ChapelIO.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp4;
+  chpl_check_nil(_args_foron_fn, INT64(587), "/root/repo/modules/internal/ChapelIO.chpl");
+  (_args_foron_fn)->_1_rvfDerefTmp = rvfDerefTmp;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn32 ***/ chpl_executeOn(&call_tmp4, INT32(35), _args_foron_fn, sizeof(chpl__class_localson_fn32_object), INT64(587), "/root/repo/modules/internal/ChapelIO.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  return;
+}
+
+/* ChapelIO.chpl:587 */
+static void on_fn31(chpl____wide_StringWriter* const delete_tmp, int64_t _ln, c_string _fn) {
+  chpl_opaque call_tmp;
+  call_tmp = ((void*)((delete_tmp)->addr));
+  chpl_here_free(call_tmp, _ln, _fn);
+  return;
+}
+
+/* ChapelIO.chpl:587 */
+static void on_fn32(chpl____wide_StringWriter* const delete_tmp, int64_t _ln, c_string _fn) {
+  chpl_opaque call_tmp;
+  call_tmp = ((void*)((delete_tmp)->addr));
+  chpl_here_free(call_tmp, _ln, _fn);
+  return;
+}
+
+/* ChapelIO.chpl:587 */
+static void wrapon_fn31(_class_localson_fn31 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_StringWriter _1_rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(587), "/root/repo/modules/internal/ChapelIO.chpl");
+  _1_rvfDerefTmp = (c)->_1_rvfDerefTmp;
+  on_fn31(&_1_rvfDerefTmp, _ln, _fn);
+  return;
+}
+
+/* ChapelIO.chpl:587 */
+static void wrapon_fn32(_class_localson_fn32 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_StringWriter _1_rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(587), "/root/repo/modules/internal/ChapelIO.chpl");
+  _1_rvfDerefTmp = (c)->_1_rvfDerefTmp;
+  on_fn32(&_1_rvfDerefTmp, _ln, _fn);
+  return;
+}
+
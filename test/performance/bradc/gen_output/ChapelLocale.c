@@ -0,0 +1,1183 @@
+/* ChapelLocale.chpl:23 */
+static void chpl__init_ChapelLocale(int64_t _ln, c_string _fn) {
+  c_string modFormatStr;
+  c_string modStr;
+  _ref_int32_t refIndentLevel = NULL;
+  locale type_tmp = NULL;
+  locale type_tmp2 = NULL;
+  chpl____wide_locale T = {CHPL_LOCALEID_T_INIT, NULL};
+  locale const_tmp = NULL;
+  chpl____wide_locale T2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_locale chpl_macro_tmp_128;
+  chpl____wide_locale chpl_macro_tmp_129;
+  chpl____wide__ref_locale chpl_macro_tmp_130;
+  chpl____wide_locale chpl_macro_tmp_131;
+  chpl____wide__ref_locale chpl_macro_tmp_132;
+  if (chpl__init_ChapelLocale_p) {
+    goto _exit_chpl__init_ChapelLocale;
+  }
+  modFormatStr = "%*s\n";
+  modStr = "ChapelLocale";
+  printModuleInit(modFormatStr, modStr, INT64(12), _ln, _fn);
+  refIndentLevel = &moduleInitLevel;
+  *(refIndentLevel) += INT64(1);
+  chpl__init_ChapelLocale_p = true;
+  {
+    chpl__init_LocaleModel(_ln, _fn);
+  }
+  type_tmp = nil;
+  chpl_macro_tmp_128.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_128.addr = type_tmp;
+  rootLocale = chpl_macro_tmp_128;
+  type_tmp2 = nil;
+  chpl_macro_tmp_129.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_129.addr = type_tmp2;
+  T = chpl_macro_tmp_129;
+  chpl_check_nil((&origRootLocale)->addr, INT64(175), "/root/repo/modules/internal/ChapelLocale.chpl");
+  chpl_macro_tmp_130.locale = (&origRootLocale)->locale;
+  chpl_macro_tmp_130.addr = &(((&origRootLocale)->addr)->value);
+  chpl_gen_comm_put(((void*)(&T)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_130).locale), INT64(0), NULL), (chpl_macro_tmp_130).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(175), "/root/repo/modules/internal/ChapelLocale.chpl");
+  const_tmp = locale2(_ln, _fn);
+  chpl_macro_tmp_131.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_131.addr = const_tmp;
+  T2 = chpl_macro_tmp_131;
+  chpl_check_nil((&dummyLocale)->addr, INT64(351), "/root/repo/modules/internal/ChapelLocale.chpl");
+  chpl_macro_tmp_132.locale = (&dummyLocale)->locale;
+  chpl_macro_tmp_132.addr = &(((&dummyLocale)->addr)->value);
+  chpl_gen_comm_put(((void*)(&T2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_132).locale), INT64(0), NULL), (chpl_macro_tmp_132).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(351), "/root/repo/modules/internal/ChapelLocale.chpl");
+  *(refIndentLevel) -= INT64(1);
+  _exit_chpl__init_ChapelLocale:;
+  return;
+}
+
+/* ChapelLocale.chpl:31 */
+static locale _construct_locale(locale parent, int64_t numCores, int64_t maxTaskPar, atomic_int64* const runningTaskCounter, locale meme, int64_t _ln, c_string _fn) {
+  locale this6 = NULL;
+  object T = NULL;
+  chpl____wide_locale T2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_locale chpl_macro_tmp_133;
+  this6 = meme;
+  chpl_check_nil(this6, INT64(31), "/root/repo/modules/internal/ChapelLocale.chpl");
+  T = &((this6)->super);
+  _construct_object(T);
+  chpl_macro_tmp_133.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_133.addr = parent;
+  T2 = chpl_macro_tmp_133;
+  chpl_check_nil(this6, INT64(41), "/root/repo/modules/internal/ChapelLocale.chpl");
+  (this6)->parent = T2;
+  chpl_check_nil(this6, INT64(45), "/root/repo/modules/internal/ChapelLocale.chpl");
+  (this6)->numCores = numCores;
+  chpl_check_nil(this6, INT64(47), "/root/repo/modules/internal/ChapelLocale.chpl");
+  (this6)->maxTaskPar = maxTaskPar;
+  chpl_check_nil(this6, INT64(67), "/root/repo/modules/internal/ChapelLocale.chpl");
+  (this6)->runningTaskCounter = *(runningTaskCounter);
+  return this6;
+}
+
+/* ChapelLocale.chpl:31 */
+static void chpl__auto_destroy_locale(locale this6, int64_t _ln, c_string _fn) {
+  _ref_atomic_int64 _field_destructor_tmp_ = NULL;
+  _ref_atomic_int_least64_t call_tmp = NULL;
+  _ref_atomic_int_least64_t T = NULL;
+  chpl_check_nil(this6, INT64(67), "/root/repo/modules/internal/ChapelLocale.chpl");
+  _field_destructor_tmp_ = &((this6)->runningTaskCounter);
+  chpl_check_nil(_field_destructor_tmp_, INT64(67), "/root/repo/modules/internal/ChapelLocale.chpl");
+  call_tmp = &((_field_destructor_tmp_)->_v);
+  T = call_tmp;
+  atomic_destroy_int_least64_t(T);
+  call_tmp = T;
+  return;
+}
+
+/* ChapelLocale.chpl:33 */
+static locale locale2(int64_t _ln, c_string _fn) {
+  locale this6 = NULL;
+  locale this7 = NULL;
+  int64_t call_tmp;
+  chpl_opaque cast_tmp;
+  locale T = NULL;
+  locale T2 = NULL;
+  chpl____wide_locale T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  atomic_int64 _init_class_tmp_;
+  locale call_tmp2 = NULL;
+  locale T4 = NULL;
+  chpl____wide_locale T5 = {CHPL_LOCALEID_T_INIT, NULL};
+  atomic_int64 this8;
+  atomic_int_least64_t ret;
+  atomic_int_least64_t type_tmp;
+  _ref_atomic_int_least64_t _ref_tmp_ = NULL;
+  _ref_atomic_int_least64_t T6 = NULL;
+  atomic_int64 wrap_call_tmp;
+  locale wrap_call_tmp2 = NULL;
+  chpl____wide_locale chpl_macro_tmp_134;
+  chpl____wide_locale chpl_macro_tmp_135;
+  call_tmp = sizeof(chpl_locale_object);
+  cast_tmp = chpl_here_alloc(call_tmp, INT16(1), _ln, _fn);
+  T = ((locale)(cast_tmp));
+  this7 = T;
+  ((object)(this7))->chpl__cid = chpl__cid_locale;
+  T2 = nil;
+  chpl_macro_tmp_134.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_134.addr = T2;
+  T3 = chpl_macro_tmp_134;
+  chpl_check_nil(this7, INT64(33), "/root/repo/modules/internal/ChapelLocale.chpl");
+  (this7)->parent = T3;
+  chpl_check_nil(this7, INT64(33), "/root/repo/modules/internal/ChapelLocale.chpl");
+  (this7)->numCores = INT64(0);
+  chpl_check_nil(this7, INT64(33), "/root/repo/modules/internal/ChapelLocale.chpl");
+  (this7)->maxTaskPar = INT64(0);
+  chpl_check_nil(this7, INT64(33), "/root/repo/modules/internal/ChapelLocale.chpl");
+  (this7)->runningTaskCounter = _init_class_tmp_;
+  T4 = ((locale)(nil));
+  call_tmp2 = T4;
+  chpl_macro_tmp_135.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_135.addr = call_tmp2;
+  T5 = chpl_macro_tmp_135;
+  chpl_check_nil(this7, INT64(33), "/root/repo/modules/internal/ChapelLocale.chpl");
+  (this7)->parent = T5;
+  chpl_check_nil(this7, INT64(33), "/root/repo/modules/internal/ChapelLocale.chpl");
+  (this7)->numCores = INT64(0);
+  chpl_check_nil(this7, INT64(33), "/root/repo/modules/internal/ChapelLocale.chpl");
+  (this7)->maxTaskPar = INT64(0);
+  ret = type_tmp;
+  _ref_tmp_ = &ret;
+  T6 = _ref_tmp_;
+  atomic_init_int_least64_t(T6, INT64(0));
+  _ref_tmp_ = T6;
+  (&this8)->_v = ret;
+  wrap_call_tmp = _construct_atomic_int64(ret, &this8, _ln, _fn);
+  chpl_check_nil(this7, INT64(33), "/root/repo/modules/internal/ChapelLocale.chpl");
+  (this7)->runningTaskCounter = wrap_call_tmp;
+  wrap_call_tmp2 = _construct_locale(call_tmp2, INT64(0), INT64(0), &wrap_call_tmp, this7, _ln, _fn);
+  return wrap_call_tmp2;
+}
+
+/* ChapelLocale.chpl:49 */
+static int64_t id(chpl____wide_locale* const this6, int64_t _ln, c_string _fn) {
+  int64_t call_tmp;
+  int32_t _virtual_method_tmp_;
+  chpl____wide__ref_int32_t chpl_macro_tmp_136;
+  chpl_check_nil((this6)->addr, INT64(49), "/root/repo/modules/internal/ChapelLocale.chpl");
+  chpl_macro_tmp_136.locale = (this6)->locale;
+  chpl_macro_tmp_136.addr = &(((object)((this6)->addr))->chpl__cid);
+  chpl_gen_comm_get(((void*)(&_virtual_method_tmp_)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_136).locale), INT64(0), NULL), (chpl_macro_tmp_136).addr, sizeof(int32_t), -1, INT64(1), INT64(49), "/root/repo/modules/internal/ChapelLocale.chpl");
+  call_tmp = ((int64_t(*)(chpl____wide_locale* const, int64_t, c_string))chpl_vmtable[((INT64(4) * _virtual_method_tmp_) + INT64(2))])(this6, _ln, _fn);
+  return call_tmp;
+}
+
+/* ChapelLocale.chpl:93 */
+static int64_t chpl_id(chpl____wide_locale* const this6, int64_t _ln, c_string _fn) {
+  c_string T;
+  T = "Pure virtual function called.";
+  halt(T, _ln, _fn);
+  return INT64(-1);
+}
+
+/* ChapelLocale.chpl:131 */
+static chpl____wide_locale getChild(chpl____wide_locale* const this6, int64_t idx, int64_t _ln, c_string _fn) {
+  c_string T;
+  T = "Pure virtual function called.";
+  halt(T, _ln, _fn);
+  return *(this6);
+}
+
+/* ChapelLocale.chpl:146 */
+static AbstractLocaleModel _construct_AbstractLocaleModel(locale parent, int64_t numCores, int64_t maxTaskPar, atomic_int64* const runningTaskCounter, AbstractLocaleModel meme, int64_t _ln, c_string _fn) {
+  AbstractLocaleModel this6 = NULL;
+  locale T = NULL;
+  this6 = meme;
+  chpl_check_nil(this6, INT64(146), "/root/repo/modules/internal/ChapelLocale.chpl");
+  T = &((this6)->super);
+  _construct_locale(parent, numCores, maxTaskPar, runningTaskCounter, T, _ln, _fn);
+  return meme;
+}
+
+/* ChapelLocale.chpl:146 */
+static void chpl__auto_destroy_AbstractLocaleModel(AbstractLocaleModel this6, int64_t _ln, c_string _fn) {
+  locale _parent_destructor_tmp_ = NULL;
+  _ref_atomic_int64 _field_destructor_tmp_ = NULL;
+  _ref_atomic_int_least64_t call_tmp = NULL;
+  _ref_atomic_int_least64_t T = NULL;
+  _parent_destructor_tmp_ = ((locale)(this6));
+  chpl_check_nil(_parent_destructor_tmp_, INT64(146), "/root/repo/modules/internal/ChapelLocale.chpl");
+  _field_destructor_tmp_ = &((_parent_destructor_tmp_)->runningTaskCounter);
+  chpl_check_nil(_field_destructor_tmp_, INT64(146), "/root/repo/modules/internal/ChapelLocale.chpl");
+  call_tmp = &((_field_destructor_tmp_)->_v);
+  T = call_tmp;
+  atomic_destroy_int_least64_t(T);
+  call_tmp = T;
+  return;
+}
+
+/* ChapelLocale.chpl:177 */
+static AbstractRootLocale _construct_AbstractRootLocale(locale parent, int64_t numCores, int64_t maxTaskPar, atomic_int64* const runningTaskCounter, AbstractRootLocale meme, int64_t _ln, c_string _fn) {
+  AbstractRootLocale this6 = NULL;
+  locale T = NULL;
+  this6 = meme;
+  chpl_check_nil(this6, INT64(177), "/root/repo/modules/internal/ChapelLocale.chpl");
+  T = &((this6)->super);
+  _construct_locale(parent, numCores, maxTaskPar, runningTaskCounter, T, _ln, _fn);
+  return meme;
+}
+
+/* ChapelLocale.chpl:177 */
+static void chpl__auto_destroy_AbstractRootLocale(AbstractRootLocale this6, int64_t _ln, c_string _fn) {
+  locale _parent_destructor_tmp_ = NULL;
+  _ref_atomic_int64 _field_destructor_tmp_ = NULL;
+  _ref_atomic_int_least64_t call_tmp = NULL;
+  _ref_atomic_int_least64_t T = NULL;
+  _parent_destructor_tmp_ = ((locale)(this6));
+  chpl_check_nil(_parent_destructor_tmp_, INT64(177), "/root/repo/modules/internal/ChapelLocale.chpl");
+  _field_destructor_tmp_ = &((_parent_destructor_tmp_)->runningTaskCounter);
+  chpl_check_nil(_field_destructor_tmp_, INT64(177), "/root/repo/modules/internal/ChapelLocale.chpl");
+  call_tmp = &((_field_destructor_tmp_)->_v);
+  T = call_tmp;
+  atomic_destroy_int_least64_t(T);
+  call_tmp = T;
+  return;
+}
+
+/* ChapelLocale.chpl:195 */
+static chpl____wide_locale localeIDtoLocale(chpl____wide_AbstractRootLocale* const this6, chpl_localeID_t* const id2, int64_t _ln, c_string _fn) {
+  c_string T;
+  chpl____wide_locale call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_locale chpl_macro_tmp_137;
+  T = "Pure virtual function called.";
+  halt(T, _ln, _fn);
+  chpl_macro_tmp_137.locale = (this6)->locale;
+  chpl_macro_tmp_137.addr = ((locale)((this6)->addr));
+  call_tmp = chpl_macro_tmp_137;
+  return call_tmp;
+}
+
+/* ChapelLocale.chpl:257 */
+static localesSignal _construct_localesSignal(atomicflag* const s, localesSignal meme, int64_t _ln, c_string _fn) {
+  localesSignal this6 = NULL;
+  object T = NULL;
+  this6 = meme;
+  chpl_check_nil(this6, INT64(257), "/root/repo/modules/internal/ChapelLocale.chpl");
+  T = &((this6)->super);
+  _construct_object(T);
+  chpl_check_nil(this6, INT64(258), "/root/repo/modules/internal/ChapelLocale.chpl");
+  (this6)->s = *(s);
+  return this6;
+}
+
+/* ChapelLocale.chpl:257 */
+static void chpl__auto_destroy_localesSignal(localesSignal this6, int64_t _ln, c_string _fn) {
+  _ref_atomicflag _field_destructor_tmp_ = NULL;
+  _ref_atomic_flag call_tmp = NULL;
+  _ref_atomic_flag T = NULL;
+  chpl_check_nil(this6, INT64(258), "/root/repo/modules/internal/ChapelLocale.chpl");
+  _field_destructor_tmp_ = &((this6)->s);
+  chpl_check_nil(_field_destructor_tmp_, INT64(258), "/root/repo/modules/internal/ChapelLocale.chpl");
+  call_tmp = &((_field_destructor_tmp_)->_v);
+  T = call_tmp;
+  atomic_destroy_flag(T);
+  call_tmp = T;
+  return;
+}
+
+/* ChapelLocale.chpl:260 */
+static localesBarrier _construct_localesBarrier(localesBarrier* const meme) {
+  localesBarrier this6;
+  return *(meme);
+}
+
+/* ChapelLocale.chpl:261 */
+static void wait5(_ref_localesBarrier this6, int64_t locIdx, chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const flags, int64_t _ln, c_string _fn) {
+  int64_t local_numLocales;
+  memory_order local_memory_order_seq_cst;
+  chpl_bool call_tmp;
+  chpl_bool T;
+  memory_order default_argorder;
+  int64_t count;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F _ic__F0_this = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t i;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F this7 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp2;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F this8 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t sum;
+  int64_t ret_x1;
+  chpl____wide__ref__tuple_1_star_int64_t ret_ = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp3;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F this9 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret3 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp4;
+  int64_t call_tmp5;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F this10 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t sum2;
+  int64_t ret_x12;
+  chpl____wide__ref__tuple_1_star_int64_t ret_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp6;
+  int64_t step;
+  int64_t call_tmp7;
+  int64_t last;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F this11 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret4 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp8;
+  int64_t call_tmp9;
+  int64_t call_tmp10;
+  int64_t call_tmp11;
+  chpl____wide__ddata_localesSignal T2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F this12 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_localesSignal ret5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_localesSignal call_tmp12 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_localesSignal coerce_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp13 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp14;
+  int64_t call_tmp15;
+  chpl_bool call_tmp16;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F ret6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F _ic__F0_this2 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t i2;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F this13 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret7 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp17;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F this14 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t sum3;
+  int64_t ret_x13;
+  chpl____wide__ref__tuple_1_star_int64_t ret_3 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp18;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F this15 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret8 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp19;
+  int64_t call_tmp20;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F this16 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t sum4;
+  int64_t ret_x14;
+  chpl____wide__ref__tuple_1_star_int64_t ret_4 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp21;
+  int64_t step2;
+  int64_t call_tmp22;
+  int64_t last2;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F this17 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret9 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp23;
+  int64_t call_tmp24;
+  int64_t call_tmp25;
+  int64_t call_tmp26;
+  chpl____wide__ddata_localesSignal T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F this18 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_localesSignal ret10 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_localesSignal call_tmp27 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_localesSignal coerce_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomicflag call_tmp28 = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder2;
+  heap_chpl_bool ret11 = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_chpl_bool T4 = NULL;
+  chpl_localeID_t call_tmp29;
+  _ref_chpl_bool T5 = NULL;
+  _class_localson_fn _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_chpl_bool T6 = {CHPL_LOCALEID_T_INIT, NULL};
+  localesSignal f = NULL;
+  localesSignal this19 = NULL;
+  int64_t call_tmp30;
+  chpl_opaque cast_tmp;
+  localesSignal T7 = NULL;
+  atomicflag _init_class_tmp_;
+  atomicflag this20;
+  atomic_flag ret12;
+  atomic_flag type_tmp;
+  _ref_atomic_flag _ref_tmp_ = NULL;
+  _ref_atomic_flag T8 = NULL;
+  atomicflag wrap_call_tmp;
+  localesSignal wrap_call_tmp2 = NULL;
+  _tuple_1_star_int64_t i3;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F call_tmp31 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F ret13 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret14 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F coerce_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool ret15;
+  chpl____wide__ref_range_int64_t_bounded_F call_tmp32 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F call_tmp33 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t coerce_tmp4;
+  chpl_bool ret16;
+  int64_t ret17;
+  chpl_bool call_tmp34;
+  int64_t ret18;
+  chpl_bool call_tmp35;
+  chpl_bool call_tmp36;
+  chpl_bool call_tmp37;
+  chpl____wide_chpl_string call_tmp38 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t sum5;
+  int64_t ret_x15;
+  chpl____wide__ref__tuple_1_star_int64_t ret_5 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t coerce_tmp5;
+  int64_t call_tmp39;
+  chpl____wide__ddata_localesSignal ret19 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_localesSignal coerce_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_localesSignal call_tmp40 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_localesSignal T9 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomicflag call_tmp41 = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder3;
+  chpl_localeID_t call_tmp42;
+  _class_localson_fn3 _args_foron_fn2 = NULL;
+  int64_t _args_size2;
+  chpl_opaque _args_alloc2;
+  chpl____wide_localesSignal delete_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomicflag _field_destructor_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_flag call_tmp43 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_flag T10 = NULL;
+  chpl_localeID_t call_tmp44;
+  chpl____wide_localesSignal rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn33 _args_foron_fn3 = NULL;
+  int64_t _args_size3;
+  chpl_opaque _args_alloc3;
+  chpl____wide__ref__tuple_1_star_int64_t chpl_macro_tmp_138;
+  chpl____wide__ref_int64_t chpl_macro_tmp_139;
+  chpl____wide__ref__tuple_1_star_int64_t chpl_macro_tmp_140;
+  chpl____wide__ref_int64_t chpl_macro_tmp_141;
+  chpl____wide__ref_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_142;
+  chpl____wide__ref_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_143;
+  chpl____wide__ref_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_144;
+  chpl____wide__ref__ddata_localesSignal chpl_macro_tmp_145;
+  chpl____wide__ref_localesSignal chpl_macro_tmp_146;
+  chpl____wide_object chpl_macro_tmp_147;
+  chpl____wide__ref_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_148;
+  chpl____wide__ref__tuple_1_star_int64_t chpl_macro_tmp_149;
+  chpl____wide__ref_int64_t chpl_macro_tmp_150;
+  chpl____wide__ref_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_151;
+  chpl____wide__ref__tuple_1_star_int64_t chpl_macro_tmp_152;
+  chpl____wide__ref_int64_t chpl_macro_tmp_153;
+  chpl____wide__ref_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_154;
+  chpl____wide__ref__ddata_localesSignal chpl_macro_tmp_155;
+  chpl____wide__ref_localesSignal chpl_macro_tmp_156;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_157;
+  chpl____wide__ref_chpl_bool chpl_macro_tmp_158;
+  chpl____wide__ref_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_159;
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F chpl_macro_tmp_160;
+  chpl____wide__ref_range_int64_t_bounded_F chpl_macro_tmp_161;
+  chpl____wide__ref_int64_t chpl_macro_tmp_162;
+  chpl____wide__ref_int64_t chpl_macro_tmp_163;
+  chpl____wide__ref__tuple_1_star_int64_t chpl_macro_tmp_164;
+  chpl____wide__ref_int64_t chpl_macro_tmp_165;
+  chpl____wide__ref__ddata_localesSignal chpl_macro_tmp_166;
+  chpl____wide__ref_localesSignal chpl_macro_tmp_167;
+  chpl____wide_localesSignal chpl_macro_tmp_168;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_169;
+  chpl____wide_localesSignal chpl_macro_tmp_170;
+  chpl____wide__ref_atomicflag chpl_macro_tmp_171;
+  chpl____wide__ref_atomic_flag chpl_macro_tmp_172;
+  chpl____wide__ref_atomic_flag chpl_macro_tmp_173;
+  local_numLocales = numLocales;
+  local_memory_order_seq_cst = memory_order_seq_cst;
+  call_tmp = (locIdx == INT64(0));
+  if (call_tmp) {
+    T = true;
+    ret = *(flags);
+    _ic__F0_this = ret;
+    this7 = ret;
+    this8 = ret;
+    chpl_check_nil((&this8)->addr, INT64(273), "/root/repo/modules/internal/ChapelLocale.chpl");
+    chpl_macro_tmp_138.locale = (&this8)->locale;
+    chpl_macro_tmp_138.addr = &(((&this8)->addr)->blk);
+    ret_ = chpl_macro_tmp_138;
+    chpl_macro_tmp_139.locale = (ret_).locale;
+    chpl_macro_tmp_139.addr = (*((ret_).addr) + INT64(0));
+    chpl_gen_comm_get(((void*)(&ret_x1)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_139).locale), INT64(0), NULL), (chpl_macro_tmp_139).addr, sizeof(int64_t), -1, INT64(1), INT64(273), "/root/repo/modules/internal/ChapelLocale.chpl");
+    this9 = ret;
+    this10 = ret;
+    chpl_check_nil((&this10)->addr, INT64(273), "/root/repo/modules/internal/ChapelLocale.chpl");
+    chpl_macro_tmp_140.locale = (&this10)->locale;
+    chpl_macro_tmp_140.addr = &(((&this10)->addr)->blk);
+    ret_2 = chpl_macro_tmp_140;
+    chpl_macro_tmp_141.locale = (ret_2).locale;
+    chpl_macro_tmp_141.addr = (*((ret_2).addr) + INT64(0));
+    chpl_gen_comm_get(((void*)(&ret_x12)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_141).locale), INT64(0), NULL), (chpl_macro_tmp_141).addr, sizeof(int64_t), -1, INT64(1), INT64(273), "/root/repo/modules/internal/ChapelLocale.chpl");
+    this11 = ret;
+    call_tmp15 = (local_numLocales - INT64(1));
+    while (T) {
+      default_argorder = local_memory_order_seq_cst;
+      atomic_fence(default_argorder, _ln, _fn);
+      count = INT64(0);
+      chpl_check_nil((&this7)->addr, INT64(273), "/root/repo/modules/internal/ChapelLocale.chpl");
+      chpl_macro_tmp_142.locale = (&this7)->locale;
+      chpl_macro_tmp_142.addr = &(((&this7)->addr)->dom);
+      chpl_gen_comm_get(((void*)(&ret2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_142).locale), INT64(0), NULL), (chpl_macro_tmp_142).addr, sizeof(chpl____wide_DefaultRectangularDom_1_int64_t_F), -1, INT64(1), INT64(273), "/root/repo/modules/internal/ChapelLocale.chpl");
+      chpl_check_nil((&ret2)->addr, INT64(273), "/root/repo/modules/internal/ChapelLocale.chpl");
+      call_tmp2 = dsiLow(&ret2, _ln, _fn);
+      sum = INT64(0);
+      call_tmp3 = (call_tmp2 * ret_x1);
+      sum += call_tmp3;
+      chpl_check_nil((&this9)->addr, INT64(273), "/root/repo/modules/internal/ChapelLocale.chpl");
+      chpl_macro_tmp_143.locale = (&this9)->locale;
+      chpl_macro_tmp_143.addr = &(((&this9)->addr)->dom);
+      chpl_gen_comm_get(((void*)(&ret3)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_143).locale), INT64(0), NULL), (chpl_macro_tmp_143).addr, sizeof(chpl____wide_DefaultRectangularDom_1_int64_t_F), -1, INT64(1), INT64(273), "/root/repo/modules/internal/ChapelLocale.chpl");
+      chpl_check_nil((&ret3)->addr, INT64(273), "/root/repo/modules/internal/ChapelLocale.chpl");
+      call_tmp4 = dsiLow(&ret3, _ln, _fn);
+      call_tmp5 = (call_tmp4 + INT64(1));
+      sum2 = INT64(0);
+      call_tmp6 = (call_tmp5 * ret_x12);
+      sum2 += call_tmp6;
+      call_tmp7 = (sum2 - sum);
+      step = call_tmp7;
+      chpl_check_nil((&this11)->addr, INT64(273), "/root/repo/modules/internal/ChapelLocale.chpl");
+      chpl_macro_tmp_144.locale = (&this11)->locale;
+      chpl_macro_tmp_144.addr = &(((&this11)->addr)->dom);
+      chpl_gen_comm_get(((void*)(&ret4)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_144).locale), INT64(0), NULL), (chpl_macro_tmp_144).addr, sizeof(chpl____wide_DefaultRectangularDom_1_int64_t_F), -1, INT64(1), INT64(273), "/root/repo/modules/internal/ChapelLocale.chpl");
+      chpl_check_nil((&ret4)->addr, INT64(273), "/root/repo/modules/internal/ChapelLocale.chpl");
+      call_tmp8 = dsiNumIndices(&ret4, _ln, _fn);
+      call_tmp9 = (call_tmp8 - INT64(1));
+      call_tmp10 = (call_tmp9 * call_tmp7);
+      call_tmp11 = (sum + call_tmp10);
+      last = call_tmp11;
+      this12 = _ic__F0_this;
+      chpl_check_nil((&this12)->addr, INT64(273), "/root/repo/modules/internal/ChapelLocale.chpl");
+      chpl_macro_tmp_145.locale = (&this12)->locale;
+      chpl_macro_tmp_145.addr = &(((&this12)->addr)->shiftedData);
+      chpl_gen_comm_get(((void*)(&ret5)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_145).locale), INT64(0), NULL), (chpl_macro_tmp_145).addr, sizeof(chpl____wide__ddata_localesSignal), -1, INT64(1), INT64(273), "/root/repo/modules/internal/ChapelLocale.chpl");
+      T2 = ret5;
+      for (i = sum; ((i <= last)); i += step) {
+        chpl_macro_tmp_146.locale = (&T2)->locale;
+        chpl_macro_tmp_146.addr = ((&T2)->addr + i);
+        call_tmp12 = chpl_macro_tmp_146;
+        chpl_gen_comm_get(((void*)(&coerce_tmp)), chpl_nodeFromLocaleID(&((call_tmp12).locale), INT64(0), NULL), (call_tmp12).addr, sizeof(chpl____wide_localesSignal), -1, INT64(1), INT64(274), "/root/repo/modules/internal/ChapelLocale.chpl");
+        chpl_macro_tmp_147.locale = (&coerce_tmp)->locale;
+        chpl_macro_tmp_147.addr = ((object)((&coerce_tmp)->addr));
+        call_tmp13 = chpl_macro_tmp_147;
+        call_tmp14 = (&call_tmp13)->addr != nil;
+        if (call_tmp14) {
+          count += INT64(1);
+        }
+      }
+      call_tmp16 = (count == call_tmp15);
+      if (call_tmp16) {
+        goto _breakLabel;
+      }
+      chpl_task_yield();
+      T = true;
+    }
+    _breakLabel:;
+    ret6 = *(flags);
+    _ic__F0_this2 = ret6;
+    this13 = ret6;
+    chpl_check_nil((&this13)->addr, INT64(281), "/root/repo/modules/internal/ChapelLocale.chpl");
+    chpl_macro_tmp_148.locale = (&this13)->locale;
+    chpl_macro_tmp_148.addr = &(((&this13)->addr)->dom);
+    chpl_gen_comm_get(((void*)(&ret7)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_148).locale), INT64(0), NULL), (chpl_macro_tmp_148).addr, sizeof(chpl____wide_DefaultRectangularDom_1_int64_t_F), -1, INT64(1), INT64(281), "/root/repo/modules/internal/ChapelLocale.chpl");
+    chpl_check_nil((&ret7)->addr, INT64(281), "/root/repo/modules/internal/ChapelLocale.chpl");
+    call_tmp17 = dsiLow(&ret7, _ln, _fn);
+    this14 = ret6;
+    sum3 = INT64(0);
+    chpl_check_nil((&this14)->addr, INT64(281), "/root/repo/modules/internal/ChapelLocale.chpl");
+    chpl_macro_tmp_149.locale = (&this14)->locale;
+    chpl_macro_tmp_149.addr = &(((&this14)->addr)->blk);
+    ret_3 = chpl_macro_tmp_149;
+    chpl_macro_tmp_150.locale = (ret_3).locale;
+    chpl_macro_tmp_150.addr = (*((ret_3).addr) + INT64(0));
+    chpl_gen_comm_get(((void*)(&ret_x13)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_150).locale), INT64(0), NULL), (chpl_macro_tmp_150).addr, sizeof(int64_t), -1, INT64(1), INT64(281), "/root/repo/modules/internal/ChapelLocale.chpl");
+    call_tmp18 = (call_tmp17 * ret_x13);
+    sum3 += call_tmp18;
+    this15 = ret6;
+    chpl_check_nil((&this15)->addr, INT64(281), "/root/repo/modules/internal/ChapelLocale.chpl");
+    chpl_macro_tmp_151.locale = (&this15)->locale;
+    chpl_macro_tmp_151.addr = &(((&this15)->addr)->dom);
+    chpl_gen_comm_get(((void*)(&ret8)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_151).locale), INT64(0), NULL), (chpl_macro_tmp_151).addr, sizeof(chpl____wide_DefaultRectangularDom_1_int64_t_F), -1, INT64(1), INT64(281), "/root/repo/modules/internal/ChapelLocale.chpl");
+    chpl_check_nil((&ret8)->addr, INT64(281), "/root/repo/modules/internal/ChapelLocale.chpl");
+    call_tmp19 = dsiLow(&ret8, _ln, _fn);
+    call_tmp20 = (call_tmp19 + INT64(1));
+    this16 = ret6;
+    sum4 = INT64(0);
+    chpl_check_nil((&this16)->addr, INT64(281), "/root/repo/modules/internal/ChapelLocale.chpl");
+    chpl_macro_tmp_152.locale = (&this16)->locale;
+    chpl_macro_tmp_152.addr = &(((&this16)->addr)->blk);
+    ret_4 = chpl_macro_tmp_152;
+    chpl_macro_tmp_153.locale = (ret_4).locale;
+    chpl_macro_tmp_153.addr = (*((ret_4).addr) + INT64(0));
+    chpl_gen_comm_get(((void*)(&ret_x14)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_153).locale), INT64(0), NULL), (chpl_macro_tmp_153).addr, sizeof(int64_t), -1, INT64(1), INT64(281), "/root/repo/modules/internal/ChapelLocale.chpl");
+    call_tmp21 = (call_tmp20 * ret_x14);
+    sum4 += call_tmp21;
+    call_tmp22 = (sum4 - sum3);
+    step2 = call_tmp22;
+    this17 = ret6;
+    chpl_check_nil((&this17)->addr, INT64(281), "/root/repo/modules/internal/ChapelLocale.chpl");
+    chpl_macro_tmp_154.locale = (&this17)->locale;
+    chpl_macro_tmp_154.addr = &(((&this17)->addr)->dom);
+    chpl_gen_comm_get(((void*)(&ret9)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_154).locale), INT64(0), NULL), (chpl_macro_tmp_154).addr, sizeof(chpl____wide_DefaultRectangularDom_1_int64_t_F), -1, INT64(1), INT64(281), "/root/repo/modules/internal/ChapelLocale.chpl");
+    chpl_check_nil((&ret9)->addr, INT64(281), "/root/repo/modules/internal/ChapelLocale.chpl");
+    call_tmp23 = dsiNumIndices(&ret9, _ln, _fn);
+    call_tmp24 = (call_tmp23 - INT64(1));
+    call_tmp25 = (call_tmp24 * call_tmp22);
+    call_tmp26 = (sum3 + call_tmp25);
+    last2 = call_tmp26;
+    for (i2 = sum3; ((i2 <= last2)); i2 += step2) {
+      this18 = _ic__F0_this2;
+      chpl_check_nil((&this18)->addr, INT64(281), "/root/repo/modules/internal/ChapelLocale.chpl");
+      chpl_macro_tmp_155.locale = (&this18)->locale;
+      chpl_macro_tmp_155.addr = &(((&this18)->addr)->shiftedData);
+      chpl_gen_comm_get(((void*)(&ret10)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_155).locale), INT64(0), NULL), (chpl_macro_tmp_155).addr, sizeof(chpl____wide__ddata_localesSignal), -1, INT64(1), INT64(281), "/root/repo/modules/internal/ChapelLocale.chpl");
+      T3 = ret10;
+      chpl_macro_tmp_156.locale = (&T3)->locale;
+      chpl_macro_tmp_156.addr = ((&T3)->addr + i2);
+      call_tmp27 = chpl_macro_tmp_156;
+      chpl_gen_comm_get(((void*)(&coerce_tmp2)), chpl_nodeFromLocaleID(&((call_tmp27).locale), INT64(0), NULL), (call_tmp27).addr, sizeof(chpl____wide_localesSignal), -1, INT64(1), INT64(282), "/root/repo/modules/internal/ChapelLocale.chpl");
+      chpl_check_nil((&coerce_tmp2)->addr, INT64(282), "/root/repo/modules/internal/ChapelLocale.chpl");
+      chpl_macro_tmp_157.locale = (&coerce_tmp2)->locale;
+      chpl_macro_tmp_157.addr = &(((&coerce_tmp2)->addr)->s);
+      call_tmp28 = chpl_macro_tmp_157;
+      default_argorder2 = local_memory_order_seq_cst;
+      chpl_here_alloc_size = sizeof(chpl_heap_chpl_bool_object);
+      chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+      T4 = ((heap_chpl_bool)(chpl_here_alloc_tmp));
+      ret11 = T4;
+      chpl_check_nil(ret11, INT64(282), "/root/repo/modules/internal/ChapelLocale.chpl");
+      (ret11)->value = false;
+      call_tmp29 = (&call_tmp28)->locale;
+      chpl_check_nil(ret11, INT64(282), "/root/repo/modules/internal/ChapelLocale.chpl");
+      T5 = &((ret11)->value);
+      _args_size = sizeof(chpl__class_localson_fn_object);
+      _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+      _args_foron_fn = ((_class_localson_fn)(_args_alloc));
+      chpl_check_nil(_args_foron_fn, INT64(282), "/root/repo/modules/internal/ChapelLocale.chpl");
+      (_args_foron_fn)->_0__tmp = call_tmp29;
+      chpl_check_nil(_args_foron_fn, INT64(282), "/root/repo/modules/internal/ChapelLocale.chpl");
+      (_args_foron_fn)->_1_this = call_tmp28;
+      chpl_check_nil(_args_foron_fn, INT64(282), "/root/repo/modules/internal/ChapelLocale.chpl");
+      (_args_foron_fn)->_2_order = default_argorder2;
+      chpl_macro_tmp_158.locale = chpl_gen_getLocaleID();
+      chpl_macro_tmp_158.addr = T5;
+      T6 = chpl_macro_tmp_158;
+      chpl_check_nil(_args_foron_fn, INT64(282), "/root/repo/modules/internal/ChapelLocale.chpl");
+      (_args_foron_fn)->_3__tmp = T6;
+      (_args_foron_fn)->_ln = _ln;
+      (_args_foron_fn)->_fn = _fn;
+      /*** wrapon_fn ***/ chpl_executeOn(&call_tmp29, INT32(1), _args_foron_fn, sizeof(chpl__class_localson_fn_object), INT64(314), "/root/repo/modules/internal/Atomics.chpl");
+      chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+      chpl_here_free(((void*)(ret11)), _ln, _fn);
+    }
+  } else {
+    call_tmp30 = sizeof(chpl_localesSignal_object);
+    cast_tmp = chpl_here_alloc(call_tmp30, INT16(17), _ln, _fn);
+    T7 = ((localesSignal)(cast_tmp));
+    this19 = T7;
+    ((object)(this19))->chpl__cid = chpl__cid_localesSignal;
+    chpl_check_nil(this19, INT64(284), "/root/repo/modules/internal/ChapelLocale.chpl");
+    (this19)->s = _init_class_tmp_;
+    ret12 = type_tmp;
+    _ref_tmp_ = &ret12;
+    T8 = _ref_tmp_;
+    atomic_init_flag(T8, false);
+    _ref_tmp_ = T8;
+    (&this20)->_v = ret12;
+    wrap_call_tmp = _construct_atomicflag(ret12, &this20, _ln, _fn);
+    chpl_check_nil(this19, INT64(284), "/root/repo/modules/internal/ChapelLocale.chpl");
+    (this19)->s = wrap_call_tmp;
+    wrap_call_tmp2 = _construct_localesSignal(&wrap_call_tmp, this19, _ln, _fn);
+    f = wrap_call_tmp2;
+    *(i3 + INT64(0)) = locIdx;
+    ret13 = *(flags);
+    call_tmp31 = ret13;
+    chpl_check_nil((&call_tmp31)->addr, INT64(286), "/root/repo/modules/internal/ChapelLocale.chpl");
+    chpl_macro_tmp_159.locale = (&call_tmp31)->locale;
+    chpl_macro_tmp_159.addr = &(((&call_tmp31)->addr)->dom);
+    chpl_gen_comm_get(((void*)(&ret14)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_159).locale), INT64(0), NULL), (chpl_macro_tmp_159).addr, sizeof(chpl____wide_DefaultRectangularDom_1_int64_t_F), -1, INT64(1), INT64(286), "/root/repo/modules/internal/ChapelLocale.chpl");
+    coerce_tmp3 = ret14;
+    chpl_check_nil((&coerce_tmp3)->addr, INT64(286), "/root/repo/modules/internal/ChapelLocale.chpl");
+    chpl_macro_tmp_160.locale = (&coerce_tmp3)->locale;
+    chpl_macro_tmp_160.addr = &(((&coerce_tmp3)->addr)->ranges);
+    call_tmp33 = chpl_macro_tmp_160;
+    chpl_macro_tmp_161.locale = (call_tmp33).locale;
+    chpl_macro_tmp_161.addr = (*((call_tmp33).addr) + INT64(0));
+    call_tmp32 = chpl_macro_tmp_161;
+    coerce_tmp4 = *(i3 + INT64(0));
+    chpl_macro_tmp_162.locale = (call_tmp32).locale;
+    chpl_macro_tmp_162.addr = &(((call_tmp32).addr)->_high);
+    chpl_gen_comm_get(((void*)(&ret17)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_162).locale), INT64(0), NULL), (chpl_macro_tmp_162).addr, sizeof(int64_t), -1, INT64(1), INT64(286), "/root/repo/modules/internal/ChapelLocale.chpl");
+    call_tmp34 = (coerce_tmp4 > ret17);
+    if (call_tmp34) {
+      ret16 = false;
+      goto _end_member;
+    }
+    chpl_macro_tmp_163.locale = (call_tmp32).locale;
+    chpl_macro_tmp_163.addr = &(((call_tmp32).addr)->_low);
+    chpl_gen_comm_get(((void*)(&ret18)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_163).locale), INT64(0), NULL), (chpl_macro_tmp_163).addr, sizeof(int64_t), -1, INT64(1), INT64(286), "/root/repo/modules/internal/ChapelLocale.chpl");
+    call_tmp35 = (coerce_tmp4 < ret18);
+    if (call_tmp35) {
+      ret16 = false;
+      goto _end_member;
+    }
+    ret16 = true;
+    _end_member:;
+    call_tmp36 = (! ret16);
+    if (call_tmp36) {
+      ret15 = false;
+      goto _end_dsiMember;
+    }
+    ret15 = true;
+    _end_dsiMember:;
+    call_tmp37 = (! ret15);
+    if (call_tmp37) {
+      wide_string_from_c_string(&call_tmp38, "array index out of bounds: ", INT64(0), INT64(0), _ln, _fn);
+      halt2(call_tmp38, &i3, _ln, _fn);
+    }
+    sum5 = INT64(0);
+    chpl_check_nil((&call_tmp31)->addr, INT64(286), "/root/repo/modules/internal/ChapelLocale.chpl");
+    chpl_macro_tmp_164.locale = (&call_tmp31)->locale;
+    chpl_macro_tmp_164.addr = &(((&call_tmp31)->addr)->blk);
+    ret_5 = chpl_macro_tmp_164;
+    chpl_macro_tmp_165.locale = (ret_5).locale;
+    chpl_macro_tmp_165.addr = (*((ret_5).addr) + INT64(0));
+    chpl_gen_comm_get(((void*)(&ret_x15)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_165).locale), INT64(0), NULL), (chpl_macro_tmp_165).addr, sizeof(int64_t), -1, INT64(1), INT64(286), "/root/repo/modules/internal/ChapelLocale.chpl");
+    coerce_tmp5 = *(i3 + INT64(0));
+    call_tmp39 = (coerce_tmp5 * ret_x15);
+    sum5 += call_tmp39;
+    chpl_check_nil((&call_tmp31)->addr, INT64(286), "/root/repo/modules/internal/ChapelLocale.chpl");
+    chpl_macro_tmp_166.locale = (&call_tmp31)->locale;
+    chpl_macro_tmp_166.addr = &(((&call_tmp31)->addr)->shiftedData);
+    chpl_gen_comm_get(((void*)(&ret19)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_166).locale), INT64(0), NULL), (chpl_macro_tmp_166).addr, sizeof(chpl____wide__ddata_localesSignal), -1, INT64(1), INT64(286), "/root/repo/modules/internal/ChapelLocale.chpl");
+    coerce_tmp6 = ret19;
+    chpl_macro_tmp_167.locale = (&coerce_tmp6)->locale;
+    chpl_macro_tmp_167.addr = ((&coerce_tmp6)->addr + sum5);
+    call_tmp40 = chpl_macro_tmp_167;
+    chpl_macro_tmp_168.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_168.addr = f;
+    T9 = chpl_macro_tmp_168;
+    chpl_gen_comm_put(((void*)(&T9)), chpl_nodeFromLocaleID(&((call_tmp40).locale), INT64(0), NULL), (call_tmp40).addr, sizeof(chpl____wide_localesSignal), -1, INT64(1), INT64(286), "/root/repo/modules/internal/ChapelLocale.chpl");
+    chpl_check_nil(f, INT64(288), "/root/repo/modules/internal/ChapelLocale.chpl");
+    chpl_macro_tmp_169.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_169.addr = &((f)->s);
+    call_tmp41 = chpl_macro_tmp_169;
+    default_argorder3 = local_memory_order_seq_cst;
+    call_tmp42 = (&call_tmp41)->locale;
+    _args_size2 = sizeof(chpl__class_localson_fn3_object);
+    _args_alloc2 = chpl_mem_allocPooled(_args_size2, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn2 = ((_class_localson_fn3)(_args_alloc2));
+    chpl_check_nil(_args_foron_fn2, INT64(288), "/root/repo/modules/internal/ChapelLocale.chpl");
+    (_args_foron_fn2)->_0__tmp = call_tmp42;
+    chpl_check_nil(_args_foron_fn2, INT64(288), "/root/repo/modules/internal/ChapelLocale.chpl");
+    (_args_foron_fn2)->_1_this = call_tmp41;
+    chpl_check_nil(_args_foron_fn2, INT64(288), "/root/repo/modules/internal/ChapelLocale.chpl");
+    (_args_foron_fn2)->_2_val = true;
+    chpl_check_nil(_args_foron_fn2, INT64(288), "/root/repo/modules/internal/ChapelLocale.chpl");
+    (_args_foron_fn2)->_3_order = default_argorder3;
+    (_args_foron_fn2)->_ln = _ln;
+    (_args_foron_fn2)->_fn = _fn;
+    /*** wrapon_fn3 ***/ chpl_executeOn(&call_tmp42, INT32(4), _args_foron_fn2, sizeof(chpl__class_localson_fn3_object), INT64(322), "/root/repo/modules/internal/Atomics.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn2)), _ln, _fn);
+    chpl_macro_tmp_170.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_170.addr = f;
+    delete_tmp = chpl_macro_tmp_170;
+    chpl_check_nil((&delete_tmp)->addr, INT64(290), "/root/repo/modules/internal/ChapelLocale.chpl");
+    chpl_macro_tmp_171.locale = (&delete_tmp)->locale;
+    chpl_macro_tmp_171.addr = &(((&delete_tmp)->addr)->s);
+    _field_destructor_tmp_ = chpl_macro_tmp_171;
+    chpl_macro_tmp_172.locale = (_field_destructor_tmp_).locale;
+    chpl_macro_tmp_172.addr = &(((_field_destructor_tmp_).addr)->_v);
+    call_tmp43 = chpl_macro_tmp_172;
+    T10 = (&call_tmp43)->addr;
+    atomic_destroy_flag(T10);
+    chpl_macro_tmp_173.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_173.addr = T10;
+    call_tmp43 = chpl_macro_tmp_173;
+    call_tmp44 = (&delete_tmp)->locale;
+    rvfDerefTmp = delete_tmp;
+    _args_size3 = sizeof(chpl__class_localson_fn33_object);
+    _args_alloc3 = chpl_mem_allocPooled(_args_size3, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn3 = ((_class_localson_fn33)(_args_alloc3));
+    chpl_check_nil(_args_foron_fn3, INT64(290), "/root/repo/modules/internal/ChapelLocale.chpl");
+    (_args_foron_fn3)->_0__tmp = call_tmp44;
+    chpl_check_nil(_args_foron_fn3, INT64(290), "/root/repo/modules/internal/ChapelLocale.chpl");
+    (_args_foron_fn3)->_1_rvfDerefTmp = rvfDerefTmp;
+    (_args_foron_fn3)->_ln = _ln;
+    (_args_foron_fn3)->_fn = _fn;
+    /*** wrapon_fn33 ***/ chpl_executeOn(&call_tmp44, INT32(36), _args_foron_fn3, sizeof(chpl__class_localson_fn33_object), INT64(290), "/root/repo/modules/internal/ChapelLocale.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn3)), _ln, _fn);
+  }
+  return;
+}
+
+/* ChapelLocale.chpl:290 */
+static void on_fn33(chpl____wide_localesSignal* const delete_tmp, int64_t _ln, c_string _fn) {
+  chpl_opaque call_tmp;
+  call_tmp = ((void*)((delete_tmp)->addr));
+  chpl_here_free(call_tmp, _ln, _fn);
+  return;
+}
+
+/* ChapelLocale.chpl:290 */
+static void wrapon_fn33(_class_localson_fn33 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_localesSignal _1_rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(290), "/root/repo/modules/internal/ChapelLocale.chpl");
+  _1_rvfDerefTmp = (c)->_1_rvfDerefTmp;
+  on_fn33(&_1_rvfDerefTmp, _ln, _fn);
+  return;
+}
+
+/* ChapelLocale.chpl:303 */
+static void chpl_init_rootLocale(int64_t _ln, c_string _fn) {
+  RootLocale call_tmp = NULL;
+  locale call_tmp2 = NULL;
+  chpl____wide__ref_locale _ref_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_locale T = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_locale T2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_RootLocale _formal_type_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_RootLocale T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp4;
+  chpl____wide_RootLocale call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  RootLocale call_tmp6 = NULL;
+  RootLocale T4 = NULL;
+  chpl____wide__ref_locale chpl_macro_tmp_174;
+  chpl____wide_locale chpl_macro_tmp_175;
+  chpl____wide__ref_locale chpl_macro_tmp_176;
+  chpl____wide_object chpl_macro_tmp_177;
+  chpl____wide__ref_int32_t chpl_macro_tmp_178;
+  int32_t chpl_macro_tmp_179;
+  chpl____wide_RootLocale chpl_macro_tmp_180;
+  chpl____wide_RootLocale chpl_macro_tmp_181;
+  call_tmp = RootLocale2(_ln, _fn);
+  call_tmp2 = ((locale)(call_tmp));
+  chpl_check_nil((&origRootLocale)->addr, INT64(304), "/root/repo/modules/internal/ChapelLocale.chpl");
+  chpl_macro_tmp_174.locale = (&origRootLocale)->locale;
+  chpl_macro_tmp_174.addr = &(((&origRootLocale)->addr)->value);
+  _ref_tmp_ = chpl_macro_tmp_174;
+  chpl_macro_tmp_175.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_175.addr = call_tmp2;
+  T = chpl_macro_tmp_175;
+  chpl_gen_comm_put(((void*)(&T)), chpl_nodeFromLocaleID(&((_ref_tmp_).locale), INT64(0), NULL), (_ref_tmp_).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(304), "/root/repo/modules/internal/ChapelLocale.chpl");
+  chpl_check_nil((&origRootLocale)->addr, INT64(175), "/root/repo/modules/internal/ChapelLocale.chpl");
+  chpl_macro_tmp_176.locale = (&origRootLocale)->locale;
+  chpl_macro_tmp_176.addr = &(((&origRootLocale)->addr)->value);
+  chpl_gen_comm_get(((void*)(&T2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_176).locale), INT64(0), NULL), (chpl_macro_tmp_176).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(175), "/root/repo/modules/internal/ChapelLocale.chpl");
+  chpl_macro_tmp_177.locale = (&T2)->locale;
+  chpl_macro_tmp_177.addr = ((object)((&T2)->addr));
+  call_tmp3 = chpl_macro_tmp_177;
+  call_tmp4 = (&call_tmp3)->addr != nil;
+  if (call_tmp4) {
+    chpl_macro_tmp_178.locale = (T2).locale;
+    chpl_macro_tmp_178.addr = &(((object)((T2).addr))->chpl__cid);
+    chpl_gen_comm_get(((void*)(&chpl_macro_tmp_179)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_178).locale), INT64(0), NULL), (chpl_macro_tmp_178).addr, sizeof(int32_t), -1, INT64(1), INT64(305), "/root/repo/modules/internal/ChapelLocale.chpl");
+    chpl_macro_tmp_180.locale = (T2).locale;
+    chpl_macro_tmp_180.addr = ((chpl_macro_tmp_179 == chpl__cid_RootLocale))?(((RootLocale)((T2).addr))):(((RootLocale)(NULL)));
+    call_tmp5 = chpl_macro_tmp_180;
+    T3 = call_tmp5;
+  } else {
+    T4 = ((RootLocale)(nil));
+    call_tmp6 = T4;
+    chpl_macro_tmp_181.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_181.addr = call_tmp6;
+    T3 = chpl_macro_tmp_181;
+  }
+  chpl_check_nil((&T3)->addr, INT64(305), "/root/repo/modules/internal/ChapelLocale.chpl");
+  init2(&T3, _ln, _fn);
+  return;
+}
+
+/* ChapelLocale.chpl:312 */
+static void chpl_rootLocaleInitPrivate(int64_t locIdx, int64_t _ln, c_string _fn) {
+  int64_t local_numLocales;
+  chpl____wide_locale T = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp;
+  RootLocale newRootLocale = NULL;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F origLocales = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_locale T2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_RootLocale _formal_type_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_RootLocale T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp3;
+  chpl____wide_RootLocale call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  RootLocale call_tmp5 = NULL;
+  RootLocale T4 = NULL;
+  chpl____wide__ddata_locale origRL = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_locale ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_locale newRL = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F call_tmp7 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultRectangularArr_locale_1_int64_t_F ret_to_arg_ref_tmp_ = NULL;
+  chpl____wide_RootLocale T5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F call_tmp8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F ret3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_locale ret4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_locale call_tmp9 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_locale call_tmp10 = {CHPL_LOCALEID_T_INIT, NULL};
+  locale call_tmp11 = NULL;
+  chpl_bool call_tmp12;
+  chpl____wide_RootLocale _formal_type_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_RootLocale T6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp13 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp14;
+  chpl____wide_RootLocale call_tmp15 = {CHPL_LOCALEID_T_INIT, NULL};
+  RootLocale call_tmp16 = NULL;
+  RootLocale T7 = NULL;
+  chpl____wide__ref_locale chpl_macro_tmp_182;
+  chpl____wide__ref_locale chpl_macro_tmp_183;
+  chpl____wide_object chpl_macro_tmp_184;
+  chpl____wide__ref_int32_t chpl_macro_tmp_185;
+  int32_t chpl_macro_tmp_186;
+  chpl____wide_RootLocale chpl_macro_tmp_187;
+  chpl____wide_RootLocale chpl_macro_tmp_188;
+  chpl____wide__ref__ddata_locale chpl_macro_tmp_189;
+  chpl____wide_RootLocale chpl_macro_tmp_190;
+  chpl____wide__ref__ddata_locale chpl_macro_tmp_191;
+  chpl____wide__ref_locale chpl_macro_tmp_192;
+  chpl____wide__ref_locale chpl_macro_tmp_193;
+  chpl____wide_locale chpl_macro_tmp_194;
+  chpl____wide_object chpl_macro_tmp_195;
+  chpl____wide__ref_int32_t chpl_macro_tmp_196;
+  int32_t chpl_macro_tmp_197;
+  chpl____wide_RootLocale chpl_macro_tmp_198;
+  chpl____wide_RootLocale chpl_macro_tmp_199;
+  local_numLocales = numLocales;
+  chpl_check_nil((&origRootLocale)->addr, INT64(175), "/root/repo/modules/internal/ChapelLocale.chpl");
+  chpl_macro_tmp_182.locale = (&origRootLocale)->locale;
+  chpl_macro_tmp_182.addr = &(((&origRootLocale)->addr)->value);
+  chpl_gen_comm_get(((void*)(&T)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_182).locale), INT64(0), NULL), (chpl_macro_tmp_182).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(175), "/root/repo/modules/internal/ChapelLocale.chpl");
+  rootLocale = T;
+  call_tmp = (locIdx != INT64(0));
+  if (call_tmp) {
+    newRootLocale = RootLocale2(_ln, _fn);
+    chpl_check_nil((&origRootLocale)->addr, INT64(175), "/root/repo/modules/internal/ChapelLocale.chpl");
+    chpl_macro_tmp_183.locale = (&origRootLocale)->locale;
+    chpl_macro_tmp_183.addr = &(((&origRootLocale)->addr)->value);
+    chpl_gen_comm_get(((void*)(&T2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_183).locale), INT64(0), NULL), (chpl_macro_tmp_183).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(175), "/root/repo/modules/internal/ChapelLocale.chpl");
+    chpl_macro_tmp_184.locale = (&T2)->locale;
+    chpl_macro_tmp_184.addr = ((object)((&T2)->addr));
+    call_tmp2 = chpl_macro_tmp_184;
+    call_tmp3 = (&call_tmp2)->addr != nil;
+    if (call_tmp3) {
+      chpl_macro_tmp_185.locale = (T2).locale;
+      chpl_macro_tmp_185.addr = &(((object)((T2).addr))->chpl__cid);
+      chpl_gen_comm_get(((void*)(&chpl_macro_tmp_186)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_185).locale), INT64(0), NULL), (chpl_macro_tmp_185).addr, sizeof(int32_t), -1, INT64(1), INT64(324), "/root/repo/modules/internal/ChapelLocale.chpl");
+      chpl_macro_tmp_187.locale = (T2).locale;
+      chpl_macro_tmp_187.addr = ((chpl_macro_tmp_186 == chpl__cid_RootLocale))?(((RootLocale)((T2).addr))):(((RootLocale)(NULL)));
+      call_tmp4 = chpl_macro_tmp_187;
+      T3 = call_tmp4;
+    } else {
+      T4 = ((RootLocale)(nil));
+      call_tmp5 = T4;
+      chpl_macro_tmp_188.locale = chpl_gen_getLocaleID();
+      chpl_macro_tmp_188.addr = call_tmp5;
+      T3 = chpl_macro_tmp_188;
+    }
+    chpl_check_nil((&T3)->addr, INT64(324), "/root/repo/modules/internal/ChapelLocale.chpl");
+    origLocales = getDefaultLocaleArray(&T3, _ln, _fn);
+    ret = origLocales;
+    call_tmp6 = ret;
+    chpl_check_nil((&call_tmp6)->addr, INT64(325), "/root/repo/modules/internal/ChapelLocale.chpl");
+    chpl_macro_tmp_189.locale = (&call_tmp6)->locale;
+    chpl_macro_tmp_189.addr = &(((&call_tmp6)->addr)->shiftedData);
+    chpl_gen_comm_get(((void*)(&ret2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_189).locale), INT64(0), NULL), (chpl_macro_tmp_189).addr, sizeof(chpl____wide__ddata_locale), -1, INT64(1), INT64(325), "/root/repo/modules/internal/ChapelLocale.chpl");
+    origRL = ret2;
+    ret_to_arg_ref_tmp_ = &call_tmp7;
+    chpl_macro_tmp_190.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_190.addr = newRootLocale;
+    T5 = chpl_macro_tmp_190;
+    chpl_check_nil((&T5)->addr, INT64(326), "/root/repo/modules/internal/ChapelLocale.chpl");
+    getDefaultLocaleArray2(&T5, ret_to_arg_ref_tmp_, _ln, _fn);
+    ret3 = call_tmp7;
+    call_tmp8 = ret3;
+    chpl_check_nil((&call_tmp8)->addr, INT64(326), "/root/repo/modules/internal/ChapelLocale.chpl");
+    chpl_macro_tmp_191.locale = (&call_tmp8)->locale;
+    chpl_macro_tmp_191.addr = &(((&call_tmp8)->addr)->shiftedData);
+    chpl_gen_comm_get(((void*)(&ret4)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_191).locale), INT64(0), NULL), (chpl_macro_tmp_191).addr, sizeof(chpl____wide__ddata_locale), -1, INT64(1), INT64(326), "/root/repo/modules/internal/ChapelLocale.chpl");
+    newRL = ret4;
+    chpl_macro_tmp_192.locale = (&newRL)->locale;
+    chpl_macro_tmp_192.addr = ((&newRL)->addr + INT64(0));
+    call_tmp9 = chpl_macro_tmp_192;
+    chpl_macro_tmp_193.locale = (&origRL)->locale;
+    chpl_macro_tmp_193.addr = ((&origRL)->addr + INT64(0));
+    call_tmp10 = chpl_macro_tmp_193;
+    chpl_gen_comm_get(((void*)((&call_tmp9)->addr)), INT64(0), (&call_tmp10)->addr, sizeof(chpl____wide_locale), -1, local_numLocales, _ln, _fn);
+    call_tmp11 = ((locale)(newRootLocale));
+    chpl_macro_tmp_194.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_194.addr = call_tmp11;
+    rootLocale = chpl_macro_tmp_194;
+    chpl__autoDestroy3(&call_tmp7, _ln, _fn);
+  }
+  call_tmp12 = (locIdx != INT64(0));
+  if (call_tmp12) {
+    chpl_macro_tmp_195.locale = (&rootLocale)->locale;
+    chpl_macro_tmp_195.addr = ((object)((&rootLocale)->addr));
+    call_tmp13 = chpl_macro_tmp_195;
+    call_tmp14 = (&call_tmp13)->addr != nil;
+    if (call_tmp14) {
+      chpl_macro_tmp_196.locale = (rootLocale).locale;
+      chpl_macro_tmp_196.addr = &(((object)((rootLocale).addr))->chpl__cid);
+      chpl_gen_comm_get(((void*)(&chpl_macro_tmp_197)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_196).locale), INT64(0), NULL), (chpl_macro_tmp_196).addr, sizeof(int32_t), -1, INT64(1), INT64(341), "/root/repo/modules/internal/ChapelLocale.chpl");
+      chpl_macro_tmp_198.locale = (rootLocale).locale;
+      chpl_macro_tmp_198.addr = ((chpl_macro_tmp_197 == chpl__cid_RootLocale))?(((RootLocale)((rootLocale).addr))):(((RootLocale)(NULL)));
+      call_tmp15 = chpl_macro_tmp_198;
+      T6 = call_tmp15;
+    } else {
+      T7 = ((RootLocale)(nil));
+      call_tmp16 = T7;
+      chpl_macro_tmp_199.locale = chpl_gen_getLocaleID();
+      chpl_macro_tmp_199.addr = call_tmp16;
+      T6 = chpl_macro_tmp_199;
+    }
+    chpl_check_nil((&T6)->addr, INT64(340), "/root/repo/modules/internal/ChapelLocale.chpl");
+    Locales = getDefaultLocaleArray(&T6, _ln, _fn);
+  }
+  return;
+}
+
+/* ChapelLocale.chpl:365 */
+static chpl____wide_locale chpl_localeID_to_locale(chpl_localeID_t* const id2, int64_t _ln, c_string _fn) {
+  chpl____wide_heap_locale local_dummyLocale = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_locale ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp2;
+  chpl____wide_AbstractRootLocale _formal_type_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_AbstractRootLocale T = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp4;
+  chpl____wide_AbstractRootLocale call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  AbstractRootLocale call_tmp6 = NULL;
+  AbstractRootLocale T2 = NULL;
+  chpl____wide_locale call_tmp7 = {CHPL_LOCALEID_T_INIT, NULL};
+  int32_t _virtual_method_tmp_;
+  chpl____wide_locale T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object chpl_macro_tmp_200;
+  chpl____wide_object chpl_macro_tmp_201;
+  chpl____wide__ref_int32_t chpl_macro_tmp_202;
+  int32_t chpl_macro_tmp_203;
+  chpl____wide_AbstractRootLocale chpl_macro_tmp_204;
+  chpl____wide_AbstractRootLocale chpl_macro_tmp_205;
+  chpl____wide__ref_int32_t chpl_macro_tmp_206;
+  chpl____wide__ref_locale chpl_macro_tmp_207;
+  local_dummyLocale = dummyLocale;
+  chpl_macro_tmp_200.locale = (&rootLocale)->locale;
+  chpl_macro_tmp_200.addr = ((object)((&rootLocale)->addr));
+  call_tmp = chpl_macro_tmp_200;
+  call_tmp2 = (&call_tmp)->addr != nil;
+  if (call_tmp2) {
+    chpl_macro_tmp_201.locale = (&rootLocale)->locale;
+    chpl_macro_tmp_201.addr = ((object)((&rootLocale)->addr));
+    call_tmp3 = chpl_macro_tmp_201;
+    call_tmp4 = (&call_tmp3)->addr != nil;
+    if (call_tmp4) {
+      chpl_macro_tmp_202.locale = (rootLocale).locale;
+      chpl_macro_tmp_202.addr = &(((object)((rootLocale).addr))->chpl__cid);
+      chpl_gen_comm_get(((void*)(&chpl_macro_tmp_203)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_202).locale), INT64(0), NULL), (chpl_macro_tmp_202).addr, sizeof(int32_t), -1, INT64(1), INT64(367), "/root/repo/modules/internal/ChapelLocale.chpl");
+      chpl_macro_tmp_204.locale = (rootLocale).locale;
+      chpl_macro_tmp_204.addr = (((chpl_macro_tmp_203 == chpl__cid_AbstractRootLocale) || (chpl_macro_tmp_203 == chpl__cid_RootLocale)))?(((AbstractRootLocale)((rootLocale).addr))):(((AbstractRootLocale)(NULL)));
+      call_tmp5 = chpl_macro_tmp_204;
+      T = call_tmp5;
+    } else {
+      T2 = ((AbstractRootLocale)(nil));
+      call_tmp6 = T2;
+      chpl_macro_tmp_205.locale = chpl_gen_getLocaleID();
+      chpl_macro_tmp_205.addr = call_tmp6;
+      T = chpl_macro_tmp_205;
+    }
+    chpl_check_nil((&T)->addr, INT64(367), "/root/repo/modules/internal/ChapelLocale.chpl");
+    chpl_macro_tmp_206.locale = (&T)->locale;
+    chpl_macro_tmp_206.addr = &(((object)((&T)->addr))->chpl__cid);
+    chpl_gen_comm_get(((void*)(&_virtual_method_tmp_)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_206).locale), INT64(0), NULL), (chpl_macro_tmp_206).addr, sizeof(int32_t), -1, INT64(1), INT64(367), "/root/repo/modules/internal/ChapelLocale.chpl");
+    call_tmp7 = ((chpl____wide_locale(*)(chpl____wide_AbstractRootLocale* const, chpl_localeID_t* const, int64_t, c_string))chpl_vmtable[((INT64(4) * _virtual_method_tmp_) + INT64(3))])(&T, id2, _ln, _fn);
+    ret = call_tmp7;
+    goto _end_chpl_localeID_to_locale;
+  } else {
+    chpl_check_nil((&local_dummyLocale)->addr, INT64(351), "/root/repo/modules/internal/ChapelLocale.chpl");
+    chpl_macro_tmp_207.locale = (&local_dummyLocale)->locale;
+    chpl_macro_tmp_207.addr = &(((&local_dummyLocale)->addr)->value);
+    chpl_gen_comm_get(((void*)(&T3)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_207).locale), INT64(0), NULL), (chpl_macro_tmp_207).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(351), "/root/repo/modules/internal/ChapelLocale.chpl");
+    ret = T3;
+    goto _end_chpl_localeID_to_locale;
+  }
+  _end_chpl_localeID_to_locale:;
+  return ret;
+}
+
+/* ChapelLocale.chpl:439 */
+void chpl_taskRunningCntInc(int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_relaxed;
+  chpl____wide_locale call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  int32_t call_tmp2;
+  chpl_localeID_t call_tmp3;
+  _ref_chpl_localeID_t ret_to_arg_ref_tmp_ = NULL;
+  chpl_localeID_t call_tmp4;
+  chpl____wide_locale call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp7;
+  _class_localson_fn5 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_208;
+  local_memory_order_relaxed = memory_order_relaxed;
+  call_tmp2 = chpl_task_getRequestedSubloc();
+  ret_to_arg_ref_tmp_ = &call_tmp3;
+  chpl_buildLocaleID(chpl_nodeID, call_tmp2, ret_to_arg_ref_tmp_, _ln, _fn);
+  call_tmp4 = chpl__initCopy_chpl_rt_localeID_t(call_tmp3);
+  call_tmp5 = chpl_localeID_to_locale(&call_tmp4, _ln, _fn);
+  call_tmp = call_tmp5;
+  chpl_check_nil((&call_tmp)->addr, INT64(440), "/root/repo/modules/internal/ChapelLocale.chpl");
+  chpl_macro_tmp_208.locale = (&call_tmp)->locale;
+  chpl_macro_tmp_208.addr = &(((&call_tmp)->addr)->runningTaskCounter);
+  call_tmp6 = chpl_macro_tmp_208;
+  call_tmp7 = (&call_tmp6)->locale;
+  _args_size = sizeof(chpl__class_localson_fn5_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn5)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(440), "/root/repo/modules/internal/ChapelLocale.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp7;
+  chpl_check_nil(_args_foron_fn, INT64(440), "/root/repo/modules/internal/ChapelLocale.chpl");
+  (_args_foron_fn)->_1_this = call_tmp6;
+  chpl_check_nil(_args_foron_fn, INT64(440), "/root/repo/modules/internal/ChapelLocale.chpl");
+  (_args_foron_fn)->_2_value = INT64(1);
+  chpl_check_nil(_args_foron_fn, INT64(440), "/root/repo/modules/internal/ChapelLocale.chpl");
+  (_args_foron_fn)->_3_order = local_memory_order_relaxed;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn5 ***/ chpl_executeOn(&call_tmp7, INT32(6), _args_foron_fn, sizeof(chpl__class_localson_fn5_object), INT64(1103), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  return;
+}
+
+/* ChapelLocale.chpl:445 */
+void chpl_taskRunningCntDec(int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_relaxed;
+  chpl____wide_locale call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  int32_t call_tmp2;
+  chpl_localeID_t call_tmp3;
+  _ref_chpl_localeID_t ret_to_arg_ref_tmp_ = NULL;
+  chpl_localeID_t call_tmp4;
+  chpl____wide_locale call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp7;
+  _class_localson_fn7 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_209;
+  local_memory_order_relaxed = memory_order_relaxed;
+  call_tmp2 = chpl_task_getRequestedSubloc();
+  ret_to_arg_ref_tmp_ = &call_tmp3;
+  chpl_buildLocaleID(chpl_nodeID, call_tmp2, ret_to_arg_ref_tmp_, _ln, _fn);
+  call_tmp4 = chpl__initCopy_chpl_rt_localeID_t(call_tmp3);
+  call_tmp5 = chpl_localeID_to_locale(&call_tmp4, _ln, _fn);
+  call_tmp = call_tmp5;
+  chpl_check_nil((&call_tmp)->addr, INT64(446), "/root/repo/modules/internal/ChapelLocale.chpl");
+  chpl_macro_tmp_209.locale = (&call_tmp)->locale;
+  chpl_macro_tmp_209.addr = &(((&call_tmp)->addr)->runningTaskCounter);
+  call_tmp6 = chpl_macro_tmp_209;
+  call_tmp7 = (&call_tmp6)->locale;
+  _args_size = sizeof(chpl__class_localson_fn7_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn7)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(446), "/root/repo/modules/internal/ChapelLocale.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp7;
+  chpl_check_nil(_args_foron_fn, INT64(446), "/root/repo/modules/internal/ChapelLocale.chpl");
+  (_args_foron_fn)->_1_this = call_tmp6;
+  chpl_check_nil(_args_foron_fn, INT64(446), "/root/repo/modules/internal/ChapelLocale.chpl");
+  (_args_foron_fn)->_2_value = INT64(1);
+  chpl_check_nil(_args_foron_fn, INT64(446), "/root/repo/modules/internal/ChapelLocale.chpl");
+  (_args_foron_fn)->_3_order = local_memory_order_relaxed;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn7 ***/ chpl_executeOn(&call_tmp7, INT32(8), _args_foron_fn, sizeof(chpl__class_localson_fn7_object), INT64(1111), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  return;
+}
+
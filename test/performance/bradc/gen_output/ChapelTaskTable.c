@@ -0,0 +1,52 @@
+/* ChapelTaskTable.chpl:23 */
+static void chpl__init_ChapelTaskTable(int64_t _ln, c_string _fn) {
+  c_string modFormatStr;
+  c_string modStr;
+  _ref_int32_t refIndentLevel = NULL;
+  if (chpl__init_ChapelTaskTable_p) {
+    goto _exit_chpl__init_ChapelTaskTable;
+  }
+  modFormatStr = "%*s\n";
+  modStr = "ChapelTaskTable";
+  printModuleInit(modFormatStr, modStr, INT64(15), _ln, _fn);
+  refIndentLevel = &moduleInitLevel;
+  *(refIndentLevel) += INT64(1);
+  chpl__init_ChapelTaskTable_p = true;
+  *(refIndentLevel) -= INT64(1);
+  _exit_chpl__init_ChapelTaskTable:;
+  return;
+}
+
+/* ChapelTaskTable.chpl:34 */
+void chpldev_taskTable_add(chpl_taskID_t taskID, uint32_t lineno, c_string filename, uint64_t tl_info) {
+  return;
+}
+
+/* ChapelTaskTable.chpl:41 */
+void chpldev_taskTable_remove(chpl_taskID_t taskID) {
+  return;
+}
+
+/* ChapelTaskTable.chpl:45 */
+void chpldev_taskTable_set_active(chpl_taskID_t taskID) {
+  return;
+}
+
+/* ChapelTaskTable.chpl:49 */
+void chpldev_taskTable_set_suspended(chpl_taskID_t taskID) {
+  return;
+}
+
+/* ChapelTaskTable.chpl:53 */
+void chpldev_taskTable_get_tl_info(chpl_taskID_t taskID) {
+  return;
+}
+
+/* ChapelTaskTable.chpl:57 */
+void chpldev_taskTable_print(int64_t _ln, c_string _fn) {
+  c_string T;
+  T = "To use task tracking, you must recompile with --task-tracking";
+  halt(T, _ln, _fn);
+  return;
+}
+
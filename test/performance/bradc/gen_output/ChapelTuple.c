@@ -0,0 +1,359 @@
+/* ChapelTuple.chpl:25 */
+static void chpl__init_ChapelTuple(int64_t _ln, c_string _fn) {
+  c_string modFormatStr;
+  c_string modStr;
+  _ref_int32_t refIndentLevel = NULL;
+  if (chpl__init_ChapelTuple_p) {
+    goto _exit_chpl__init_ChapelTuple;
+  }
+  modFormatStr = "%*s\n";
+  modStr = "ChapelTuple";
+  printModuleInit(modFormatStr, modStr, INT64(11), _ln, _fn);
+  refIndentLevel = &moduleInitLevel;
+  *(refIndentLevel) += INT64(1);
+  chpl__init_ChapelTuple_p = true;
+  *(refIndentLevel) -= INT64(1);
+  _exit_chpl__init_ChapelTuple:;
+  return;
+}
+
+/* ChapelTuple.chpl:109 */
+static void this5(_ref__tuple_1_star_range_int64_t_bounded_F this6, int64_t i, _ref_range_int64_t_bounded_F _retArg, int64_t _ln, c_string _fn) {
+  range_int64_t_bounded_F ret;
+  chpl_bool call_tmp;
+  chpl_bool T;
+  chpl_bool call_tmp2;
+  chpl____wide_chpl_string call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  call_tmp = (i < INT64(1));
+  if (call_tmp) {
+    T = true;
+  } else {
+    call_tmp2 = (i > INT64(1));
+    T = call_tmp2;
+  }
+  if (T) {
+    wide_string_from_c_string(&call_tmp3, "tuple access out of bounds: ", INT64(0), INT64(0), _ln, _fn);
+    halt3(call_tmp3, i, _ln, _fn);
+  }
+  ret = *(*(this6) + (i - INT64(1)));
+  *(_retArg) = ret;
+  return;
+}
+
+/* ChapelTuple.chpl:109 */
+static chpl____wide__ref_range_int64_t_bounded_F this4(_ref__tuple_1_star_range_int64_t_bounded_F this6, int64_t i, int64_t _ln, c_string _fn) {
+  chpl_bool call_tmp;
+  chpl_bool T;
+  chpl_bool call_tmp2;
+  chpl____wide_chpl_string call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_range_int64_t_bounded_F call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_range_int64_t_bounded_F chpl_macro_tmp_63;
+  call_tmp = (i < INT64(1));
+  if (call_tmp) {
+    T = true;
+  } else {
+    call_tmp2 = (i > INT64(1));
+    T = call_tmp2;
+  }
+  if (T) {
+    wide_string_from_c_string(&call_tmp3, "tuple access out of bounds: ", INT64(0), INT64(0), _ln, _fn);
+    halt3(call_tmp3, i, _ln, _fn);
+  }
+  chpl_macro_tmp_63.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_63.addr = (*(this6) + (i - INT64(1)));
+  call_tmp4 = chpl_macro_tmp_63;
+  return call_tmp4;
+}
+
+/* ChapelTuple.chpl:171 */
+static void readWriteThis(_ref__tuple_1_star_int64_t this6, Writer f, int64_t _ln, c_string _fn) {
+  int64_t local_QIO_TUPLE_FORMAT_JSON;
+  int64_t local_QIO_TUPLE_FORMAT_SPACE;
+  int64_t local_QIO_STYLE_ELEMENT_TUPLE;
+  int64_t call_tmp;
+  ioLiteral start;
+  ioLiteral this7;
+  c_string T;
+  c_string T2;
+  chpl_bool x2;
+  _ref_chpl_bool _ref_tmp_ = NULL;
+  ioLiteral wrap_call_tmp;
+  c_string T3;
+  ioLiteral comma;
+  ioLiteral this8;
+  c_string T4;
+  c_string T5;
+  chpl_bool x3;
+  _ref_chpl_bool _ref_tmp_2 = NULL;
+  ioLiteral wrap_call_tmp2;
+  c_string T6;
+  ioLiteral end;
+  ioLiteral this9;
+  c_string T7;
+  c_string T8;
+  chpl_bool x4;
+  _ref_chpl_bool _ref_tmp_3 = NULL;
+  ioLiteral wrap_call_tmp3;
+  c_string T9;
+  chpl_bool call_tmp2;
+  chpl_bool call_tmp3;
+  ioLiteral this10;
+  c_string T10;
+  c_string T11;
+  chpl_bool x5;
+  _ref_chpl_bool _ref_tmp_4 = NULL;
+  ioLiteral wrap_call_tmp4;
+  c_string T12;
+  _ref_ioLiteral _ref_tmp_5 = NULL;
+  ioLiteral this11;
+  c_string T13;
+  c_string T14;
+  chpl_bool x6;
+  _ref_chpl_bool _ref_tmp_6 = NULL;
+  ioLiteral wrap_call_tmp5;
+  c_string T15;
+  _ref_ioLiteral _ref_tmp_7 = NULL;
+  ioLiteral this12;
+  c_string T16;
+  c_string T17;
+  chpl_bool x7;
+  _ref_chpl_bool _ref_tmp_8 = NULL;
+  ioLiteral wrap_call_tmp6;
+  c_string T18;
+  _ref_ioLiteral _ref_tmp_9 = NULL;
+  chpl_bool call_tmp4;
+  ioLiteral this13;
+  c_string T19;
+  c_string T20;
+  chpl_bool x8;
+  _ref_chpl_bool _ref_tmp_10 = NULL;
+  ioLiteral wrap_call_tmp7;
+  c_string T21;
+  _ref_ioLiteral _ref_tmp_11 = NULL;
+  ioLiteral this14;
+  c_string T22;
+  c_string T23;
+  chpl_bool x9;
+  _ref_chpl_bool _ref_tmp_12 = NULL;
+  ioLiteral wrap_call_tmp8;
+  c_string T24;
+  _ref_ioLiteral _ref_tmp_13 = NULL;
+  ioLiteral this15;
+  c_string T25;
+  c_string T26;
+  chpl_bool x10;
+  _ref_chpl_bool _ref_tmp_14 = NULL;
+  ioLiteral wrap_call_tmp9;
+  c_string T27;
+  _ref_ioLiteral _ref_tmp_15 = NULL;
+  ioLiteral this16;
+  c_string T28;
+  c_string T29;
+  chpl_bool x11;
+  _ref_chpl_bool _ref_tmp_16 = NULL;
+  ioLiteral wrap_call_tmp10;
+  c_string T30;
+  _ref_ioLiteral _ref_tmp_17 = NULL;
+  ioLiteral this17;
+  c_string T31;
+  c_string T32;
+  chpl_bool x12;
+  _ref_chpl_bool _ref_tmp_18 = NULL;
+  ioLiteral wrap_call_tmp11;
+  c_string T33;
+  _ref_ioLiteral _ref_tmp_19 = NULL;
+  ioLiteral this18;
+  c_string T34;
+  c_string T35;
+  chpl_bool x13;
+  _ref_chpl_bool _ref_tmp_20 = NULL;
+  ioLiteral wrap_call_tmp12;
+  c_string T36;
+  _ref_ioLiteral _ref_tmp_21 = NULL;
+  chpl_bool call_tmp5;
+  int64_t coerce_tmp;
+  chpl_bool call_tmp6;
+  local_QIO_TUPLE_FORMAT_JSON = QIO_TUPLE_FORMAT_JSON;
+  local_QIO_TUPLE_FORMAT_SPACE = QIO_TUPLE_FORMAT_SPACE;
+  local_QIO_STYLE_ELEMENT_TUPLE = QIO_STYLE_ELEMENT_TUPLE;
+  chpl_check_nil(f, INT64(172), "/root/repo/modules/internal/ChapelTuple.chpl");
+  call_tmp = styleElement(f, local_QIO_STYLE_ELEMENT_TUPLE);
+  T = "";
+  (&this7)->val = T;
+  (&this7)->ignoreWhiteSpace = false;
+  T2 = "";
+  (&this7)->val = T2;
+  x2 = false;
+  _ref_tmp_ = &x2;
+  *(_ref_tmp_) = true;
+  (&this7)->ignoreWhiteSpace = x2;
+  T3 = "";
+  wrap_call_tmp = _construct_ioLiteral(T3, x2, &this7, _ln, _fn);
+  start = wrap_call_tmp;
+  T4 = "";
+  (&this8)->val = T4;
+  (&this8)->ignoreWhiteSpace = false;
+  T5 = "";
+  (&this8)->val = T5;
+  x3 = false;
+  _ref_tmp_2 = &x3;
+  *(_ref_tmp_2) = true;
+  (&this8)->ignoreWhiteSpace = x3;
+  T6 = "";
+  wrap_call_tmp2 = _construct_ioLiteral(T6, x3, &this8, _ln, _fn);
+  comma = wrap_call_tmp2;
+  T7 = "";
+  (&this9)->val = T7;
+  (&this9)->ignoreWhiteSpace = false;
+  T8 = "";
+  (&this9)->val = T8;
+  x4 = false;
+  _ref_tmp_3 = &x4;
+  *(_ref_tmp_3) = true;
+  (&this9)->ignoreWhiteSpace = x4;
+  T9 = "";
+  wrap_call_tmp3 = _construct_ioLiteral(T9, x4, &this9, _ln, _fn);
+  end = wrap_call_tmp3;
+  chpl_check_nil(f, INT64(176), "/root/repo/modules/internal/ChapelTuple.chpl");
+  call_tmp2 = binary(f, _ln, _fn);
+  call_tmp3 = (call_tmp == local_QIO_TUPLE_FORMAT_SPACE);
+  if (call_tmp3) {
+    T10 = "";
+    (&this10)->val = T10;
+    (&this10)->ignoreWhiteSpace = false;
+    T11 = "";
+    (&this10)->val = T11;
+    x5 = false;
+    _ref_tmp_4 = &x5;
+    *(_ref_tmp_4) = true;
+    (&this10)->ignoreWhiteSpace = x5;
+    T12 = "";
+    wrap_call_tmp4 = _construct_ioLiteral(T12, x5, &this10, _ln, _fn);
+    _ref_tmp_5 = &start;
+    chpl___ASSIGN_6(_ref_tmp_5, &wrap_call_tmp4, _ln, _fn);
+    T13 = "";
+    (&this11)->val = T13;
+    (&this11)->ignoreWhiteSpace = false;
+    T14 = " ";
+    (&this11)->val = T14;
+    x6 = false;
+    _ref_tmp_6 = &x6;
+    *(_ref_tmp_6) = true;
+    (&this11)->ignoreWhiteSpace = x6;
+    T15 = " ";
+    wrap_call_tmp5 = _construct_ioLiteral(T15, x6, &this11, _ln, _fn);
+    _ref_tmp_7 = &comma;
+    chpl___ASSIGN_6(_ref_tmp_7, &wrap_call_tmp5, _ln, _fn);
+    T16 = "";
+    (&this12)->val = T16;
+    (&this12)->ignoreWhiteSpace = false;
+    T17 = "";
+    (&this12)->val = T17;
+    x7 = false;
+    _ref_tmp_8 = &x7;
+    *(_ref_tmp_8) = true;
+    (&this12)->ignoreWhiteSpace = x7;
+    T18 = "";
+    wrap_call_tmp6 = _construct_ioLiteral(T18, x7, &this12, _ln, _fn);
+    _ref_tmp_9 = &end;
+    chpl___ASSIGN_6(_ref_tmp_9, &wrap_call_tmp6, _ln, _fn);
+  } else {
+    call_tmp4 = (call_tmp == local_QIO_TUPLE_FORMAT_JSON);
+    if (call_tmp4) {
+      T19 = "";
+      (&this13)->val = T19;
+      (&this13)->ignoreWhiteSpace = false;
+      T20 = "[";
+      (&this13)->val = T20;
+      x8 = false;
+      _ref_tmp_10 = &x8;
+      *(_ref_tmp_10) = true;
+      (&this13)->ignoreWhiteSpace = x8;
+      T21 = "[";
+      wrap_call_tmp7 = _construct_ioLiteral(T21, x8, &this13, _ln, _fn);
+      _ref_tmp_11 = &start;
+      chpl___ASSIGN_6(_ref_tmp_11, &wrap_call_tmp7, _ln, _fn);
+      T22 = "";
+      (&this14)->val = T22;
+      (&this14)->ignoreWhiteSpace = false;
+      T23 = ", ";
+      (&this14)->val = T23;
+      x9 = false;
+      _ref_tmp_12 = &x9;
+      *(_ref_tmp_12) = true;
+      (&this14)->ignoreWhiteSpace = x9;
+      T24 = ", ";
+      wrap_call_tmp8 = _construct_ioLiteral(T24, x9, &this14, _ln, _fn);
+      _ref_tmp_13 = &comma;
+      chpl___ASSIGN_6(_ref_tmp_13, &wrap_call_tmp8, _ln, _fn);
+      T25 = "";
+      (&this15)->val = T25;
+      (&this15)->ignoreWhiteSpace = false;
+      T26 = "]";
+      (&this15)->val = T26;
+      x10 = false;
+      _ref_tmp_14 = &x10;
+      *(_ref_tmp_14) = true;
+      (&this15)->ignoreWhiteSpace = x10;
+      T27 = "]";
+      wrap_call_tmp9 = _construct_ioLiteral(T27, x10, &this15, _ln, _fn);
+      _ref_tmp_15 = &end;
+      chpl___ASSIGN_6(_ref_tmp_15, &wrap_call_tmp9, _ln, _fn);
+    } else {
+      T28 = "";
+      (&this16)->val = T28;
+      (&this16)->ignoreWhiteSpace = false;
+      T29 = "(";
+      (&this16)->val = T29;
+      x11 = false;
+      _ref_tmp_16 = &x11;
+      *(_ref_tmp_16) = true;
+      (&this16)->ignoreWhiteSpace = x11;
+      T30 = "(";
+      wrap_call_tmp10 = _construct_ioLiteral(T30, x11, &this16, _ln, _fn);
+      _ref_tmp_17 = &start;
+      chpl___ASSIGN_6(_ref_tmp_17, &wrap_call_tmp10, _ln, _fn);
+      T31 = "";
+      (&this17)->val = T31;
+      (&this17)->ignoreWhiteSpace = false;
+      T32 = ", ";
+      (&this17)->val = T32;
+      x12 = false;
+      _ref_tmp_18 = &x12;
+      *(_ref_tmp_18) = true;
+      (&this17)->ignoreWhiteSpace = x12;
+      T33 = ", ";
+      wrap_call_tmp11 = _construct_ioLiteral(T33, x12, &this17, _ln, _fn);
+      _ref_tmp_19 = &comma;
+      chpl___ASSIGN_6(_ref_tmp_19, &wrap_call_tmp11, _ln, _fn);
+      T34 = "";
+      (&this18)->val = T34;
+      (&this18)->ignoreWhiteSpace = false;
+      T35 = ")";
+      (&this18)->val = T35;
+      x13 = false;
+      _ref_tmp_20 = &x13;
+      *(_ref_tmp_20) = true;
+      (&this18)->ignoreWhiteSpace = x13;
+      T36 = ")";
+      wrap_call_tmp12 = _construct_ioLiteral(T36, x13, &this18, _ln, _fn);
+      _ref_tmp_21 = &end;
+      chpl___ASSIGN_6(_ref_tmp_21, &wrap_call_tmp12, _ln, _fn);
+    }
+  }
+  call_tmp5 = (! call_tmp2);
+  if (call_tmp5) {
+    chpl_check_nil(f, INT64(193), "/root/repo/modules/internal/ChapelTuple.chpl");
+    readwrite(f, &start, _ln, _fn);
+  }
+  coerce_tmp = *(*(this6) + INT64(0));
+  chpl_check_nil(f, INT64(196), "/root/repo/modules/internal/ChapelTuple.chpl");
+  readwrite2(f, coerce_tmp, _ln, _fn);
+  call_tmp6 = (! call_tmp2);
+  if (call_tmp6) {
+    chpl_check_nil(f, INT64(205), "/root/repo/modules/internal/ChapelTuple.chpl");
+    readwrite(f, &end, _ln, _fn);
+  }
+  return;
+}
+
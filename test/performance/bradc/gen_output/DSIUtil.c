@@ -0,0 +1,30 @@
+/* DSIUtil.chpl:1 */
+static void chpl__init_DSIUtil(int64_t _ln, c_string _fn) {
+  c_string modFormatStr;
+  c_string modStr;
+  _ref_int32_t refIndentLevel = NULL;
+  if (chpl__init_DSIUtil_p) {
+    goto _exit_chpl__init_DSIUtil;
+  }
+  modFormatStr = "%*s\n";
+  modStr = "DSIUtil";
+  printModuleInit(modFormatStr, modStr, INT64(7), _ln, _fn);
+  refIndentLevel = &moduleInitLevel;
+  *(refIndentLevel) += INT64(1);
+  chpl__init_DSIUtil_p = true;
+  *(refIndentLevel) -= INT64(1);
+  _exit_chpl__init_DSIUtil:;
+  return;
+}
+
+/* DSIUtil.chpl:37 */
+static void createTuple(int64_t val, _ref__tuple_1_star_int64_t _retArg, int64_t _ln, c_string _fn) {
+  int64_t tup_x1;
+  _ref_int64_t call_tmp = NULL;
+  tup_x1 = INT64(0);
+  call_tmp = &tup_x1;
+  *(call_tmp) = val;
+  *(*(_retArg) + INT64(0)) = tup_x1;
+  return;
+}
+
@@ -0,0 +1,22 @@
+/* DefaultAssociative.chpl:23 */
+static void chpl__init_DefaultAssociative(int64_t _ln, c_string _fn) {
+  c_string modFormatStr;
+  c_string modStr;
+  _ref_int32_t refIndentLevel = NULL;
+  if (chpl__init_DefaultAssociative_p) {
+    goto _exit_chpl__init_DefaultAssociative;
+  }
+  modFormatStr = "%*s\n";
+  modStr = "DefaultAssociative";
+  printModuleInit(modFormatStr, modStr, INT64(18), _ln, _fn);
+  refIndentLevel = &moduleInitLevel;
+  *(refIndentLevel) += INT64(1);
+  chpl__init_DefaultAssociative_p = true;
+  {
+    chpl__init_DSIUtil(_ln, _fn);
+  }
+  *(refIndentLevel) -= INT64(1);
+  _exit_chpl__init_DefaultAssociative:;
+  return;
+}
+
@@ -0,0 +1,2525 @@
+/* DefaultRectangular.chpl:23 */
+static void chpl__init_DefaultRectangular(int64_t _ln, c_string _fn) {
+  c_string modFormatStr;
+  c_string modStr;
+  _ref_int32_t refIndentLevel = NULL;
+  int64_t const_tmp;
+  chpl_bool call_tmp;
+  chpl_bool call_tmp2;
+  c_string call_tmp3;
+  chpl_bool const_tmp2;
+  chpl_bool call_tmp4;
+  chpl_bool call_tmp5;
+  c_string call_tmp6;
+  int64_t const_tmp3;
+  chpl_bool call_tmp7;
+  chpl_bool call_tmp8;
+  c_string call_tmp9;
+  chpl_bool call_tmp10;
+  c_string T;
+  chpl_bool call_tmp11;
+  c_string T2;
+  DefaultDist this6 = NULL;
+  int64_t call_tmp12;
+  chpl_opaque cast_tmp;
+  DefaultDist T3 = NULL;
+  atomic_refcnt this7;
+  atomic_int64 _init_class_tmp_;
+  atomic_int64 this8;
+  atomic_int_least64_t ret;
+  atomic_int_least64_t type_tmp;
+  _ref_atomic_int_least64_t _ref_tmp_ = NULL;
+  _ref_atomic_int_least64_t T4 = NULL;
+  atomic_int64 wrap_call_tmp;
+  atomic_refcnt wrap_call_tmp2;
+  list_BaseDom this9;
+  listNode_BaseDom T5 = NULL;
+  chpl____wide_listNode_BaseDom T6 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseDom T7 = NULL;
+  chpl____wide_listNode_BaseDom T8 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseDom call_tmp13 = NULL;
+  listNode_BaseDom T9 = NULL;
+  chpl____wide_listNode_BaseDom T10 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseDom call_tmp14 = NULL;
+  listNode_BaseDom T11 = NULL;
+  chpl____wide_listNode_BaseDom T12 = {CHPL_LOCALEID_T_INIT, NULL};
+  list_BaseDom wrap_call_tmp3;
+  atomicflag this10;
+  atomic_flag ret2;
+  atomic_flag type_tmp2;
+  _ref_atomic_flag _ref_tmp_2 = NULL;
+  _ref_atomic_flag T13 = NULL;
+  atomicflag wrap_call_tmp4;
+  DefaultDist wrap_call_tmp5 = NULL;
+  _ref_DefaultDist ret_to_arg_ref_tmp_ = NULL;
+  chpl____wide_listNode_BaseDom chpl_macro_tmp_210;
+  chpl____wide_listNode_BaseDom chpl_macro_tmp_211;
+  chpl____wide_listNode_BaseDom chpl_macro_tmp_212;
+  chpl____wide_listNode_BaseDom chpl_macro_tmp_213;
+  if (chpl__init_DefaultRectangular_p) {
+    goto _exit_chpl__init_DefaultRectangular;
+  }
+  modFormatStr = "%*s\n";
+  modStr = "DefaultRectangular";
+  printModuleInit(modFormatStr, modStr, INT64(18), _ln, _fn);
+  refIndentLevel = &moduleInitLevel;
+  *(refIndentLevel) += INT64(1);
+  chpl__init_DefaultRectangular_p = true;
+  {
+    chpl__init_DSIUtil(_ln, _fn);
+    chpl__init_ChapelArray(_ln, _fn);
+  }
+  call_tmp = chpl_config_has_value("dataParTasksPerLocale", "Built-in");
+  call_tmp2 = (! call_tmp);
+  if (call_tmp2) {
+    const_tmp = INT64(0);
+  } else {
+    call_tmp3 = chpl_config_get_value("dataParTasksPerLocale", "Built-in");
+    const_tmp = _command_line_cast(call_tmp3, _ln, _fn);
+  }
+  dataParTasksPerLocale = const_tmp;
+  chpl_comm_broadcast_private(INT64(8), sizeof(int64_t), -1);
+  call_tmp4 = chpl_config_has_value("dataParIgnoreRunningTasks", "Built-in");
+  call_tmp5 = (! call_tmp4);
+  if (call_tmp5) {
+    const_tmp2 = false;
+  } else {
+    call_tmp6 = chpl_config_get_value("dataParIgnoreRunningTasks", "Built-in");
+    const_tmp2 = _command_line_cast2(call_tmp6, _ln, _fn);
+  }
+  dataParIgnoreRunningTasks = const_tmp2;
+  chpl_comm_broadcast_private(INT64(9), sizeof(chpl_bool), -1);
+  call_tmp7 = chpl_config_has_value("dataParMinGranularity", "Built-in");
+  call_tmp8 = (! call_tmp7);
+  if (call_tmp8) {
+    const_tmp3 = INT64(1);
+  } else {
+    call_tmp9 = chpl_config_get_value("dataParMinGranularity", "Built-in");
+    const_tmp3 = _command_line_cast3(call_tmp9, _ln, _fn);
+  }
+  dataParMinGranularity = const_tmp3;
+  chpl_comm_broadcast_private(INT64(10), sizeof(int64_t), -1);
+  call_tmp10 = (dataParTasksPerLocale < INT64(0));
+  if (call_tmp10) {
+    T = "dataParTasksPerLocale must be >= 0";
+    halt(T, _ln, _fn);
+  }
+  call_tmp11 = (dataParMinGranularity <= INT64(0));
+  if (call_tmp11) {
+    T2 = "dataParMinGranularity must be > 0";
+    halt(T2, _ln, _fn);
+  }
+  call_tmp12 = sizeof(chpl_DefaultDist_object);
+  cast_tmp = chpl_here_alloc(call_tmp12, INT16(4), _ln, _fn);
+  T3 = ((DefaultDist)(cast_tmp));
+  this6 = T3;
+  ((object)(this6))->chpl__cid = chpl__cid_DefaultDist;
+  (&this7)->_cnt = _init_class_tmp_;
+  ret = type_tmp;
+  _ref_tmp_ = &ret;
+  T4 = _ref_tmp_;
+  atomic_init_int_least64_t(T4, INT64(0));
+  _ref_tmp_ = T4;
+  (&this8)->_v = ret;
+  wrap_call_tmp = _construct_atomic_int64(ret, &this8, _ln, _fn);
+  (&this7)->_cnt = wrap_call_tmp;
+  wrap_call_tmp2 = _construct_atomic_refcnt(&wrap_call_tmp, &this7, _ln, _fn);
+  T5 = nil;
+  chpl_macro_tmp_210.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_210.addr = T5;
+  T6 = chpl_macro_tmp_210;
+  (&this9)->first = T6;
+  T7 = nil;
+  chpl_macro_tmp_211.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_211.addr = T7;
+  T8 = chpl_macro_tmp_211;
+  (&this9)->last = T8;
+  (&this9)->length = INT64(0);
+  T9 = ((listNode_BaseDom)(nil));
+  call_tmp13 = T9;
+  chpl_macro_tmp_212.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_212.addr = call_tmp13;
+  T10 = chpl_macro_tmp_212;
+  (&this9)->first = T10;
+  T11 = ((listNode_BaseDom)(nil));
+  call_tmp14 = T11;
+  chpl_macro_tmp_213.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_213.addr = call_tmp14;
+  T12 = chpl_macro_tmp_213;
+  (&this9)->last = T12;
+  (&this9)->length = INT64(0);
+  wrap_call_tmp3 = _construct_list2(call_tmp13, call_tmp14, INT64(0), &this9, _ln, _fn);
+  ret2 = type_tmp2;
+  _ref_tmp_2 = &ret2;
+  T13 = _ref_tmp_2;
+  atomic_init_flag(T13, false);
+  _ref_tmp_2 = T13;
+  (&this10)->_v = ret2;
+  wrap_call_tmp4 = _construct_atomicflag(ret2, &this10, _ln, _fn);
+  wrap_call_tmp5 = _construct_DefaultDist(&wrap_call_tmp2, &wrap_call_tmp3, &wrap_call_tmp4, this6, _ln, _fn);
+  ret_to_arg_ref_tmp_ = &defaultDist;
+  chpl__buildDistValue(wrap_call_tmp5, ret_to_arg_ref_tmp_, _ln, _fn);
+  *(refIndentLevel) -= INT64(1);
+  _exit_chpl__init_DefaultRectangular:;
+  return;
+}
+
+/* DefaultRectangular.chpl:106 */
+static DefaultDist _construct_DefaultDist(atomic_refcnt* const _distCnt, list_BaseDom* const _doms, atomicflag* const _domsLock, DefaultDist meme, int64_t _ln, c_string _fn) {
+  DefaultDist this6 = NULL;
+  BaseDist T = NULL;
+  this6 = meme;
+  chpl_check_nil(this6, INT64(106), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  T = &((this6)->super);
+  _construct_BaseDist(_distCnt, _doms, _domsLock, T, _ln, _fn);
+  return meme;
+}
+
+/* DefaultRectangular.chpl:106 */
+static void chpl__auto_destroy_DefaultDist(DefaultDist this6, int64_t _ln, c_string _fn) {
+  BaseDist _parent_destructor_tmp_ = NULL;
+  _ref_atomicflag _field_destructor_tmp_ = NULL;
+  _ref_atomic_flag call_tmp = NULL;
+  _ref_atomic_flag T = NULL;
+  _ref_atomic_refcnt _field_destructor_tmp_2 = NULL;
+  _ref_atomic_int64 _field_destructor_tmp_3 = NULL;
+  _ref_atomic_int_least64_t call_tmp2 = NULL;
+  _ref_atomic_int_least64_t T2 = NULL;
+  _parent_destructor_tmp_ = ((BaseDist)(this6));
+  chpl_check_nil(_parent_destructor_tmp_, INT64(106), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  _field_destructor_tmp_ = &((_parent_destructor_tmp_)->_domsLock);
+  chpl_check_nil(_field_destructor_tmp_, INT64(106), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  call_tmp = &((_field_destructor_tmp_)->_v);
+  T = call_tmp;
+  atomic_destroy_flag(T);
+  call_tmp = T;
+  chpl_check_nil(_parent_destructor_tmp_, INT64(106), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  _field_destructor_tmp_2 = &((_parent_destructor_tmp_)->_distCnt);
+  chpl_check_nil(_field_destructor_tmp_2, INT64(106), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  _field_destructor_tmp_3 = &((_field_destructor_tmp_2)->_cnt);
+  chpl_check_nil(_field_destructor_tmp_3, INT64(106), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  call_tmp2 = &((_field_destructor_tmp_3)->_v);
+  T2 = call_tmp2;
+  atomic_destroy_int_least64_t(T2);
+  call_tmp2 = T2;
+  return;
+}
+
+/* DefaultRectangular.chpl:107 */
+static DefaultRectangularDom_1_int64_t_F dsiNewRectangularDom(chpl____wide_DefaultDist* const this6, int64_t _ln, c_string _fn) {
+  DefaultRectangularDom_1_int64_t_F call_tmp = NULL;
+  call_tmp = DefaultRectangularDom(this6, _ln, _fn);
+  return call_tmp;
+}
+
+/* DefaultRectangular.chpl:123 */
+static chpl____wide_DefaultDist dsiClone(chpl____wide_DefaultDist* const this6) {
+  return *(this6);
+}
+
+/* DefaultRectangular.chpl:125 */
+static void dsiAssign(chpl____wide_DefaultDist* const this6, chpl____wide_DefaultDist* const other) {
+  return;
+}
+
+/* DefaultRectangular.chpl:140 */
+static DefaultRectangularDom_1_int64_t_F _construct_DefaultRectangularDom(atomic_refcnt* const _domCnt, list_BaseArr* const _arrs, atomicflag* const _arrsLock, DefaultDist dist2, _tuple_1_star_range_int64_t_bounded_F* const ranges, DefaultRectangularDom_1_int64_t_F meme, int64_t _ln, c_string _fn) {
+  DefaultRectangularDom_1_int64_t_F this6 = NULL;
+  BaseRectangularDom T = NULL;
+  chpl____wide_DefaultDist T2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultDist chpl_macro_tmp_214;
+  this6 = meme;
+  chpl_check_nil(this6, INT64(140), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  T = &((this6)->super);
+  _construct_BaseRectangularDom(_domCnt, _arrs, _arrsLock, T, _ln, _fn);
+  chpl_macro_tmp_214.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_214.addr = dist2;
+  T2 = chpl_macro_tmp_214;
+  chpl_check_nil(this6, INT64(144), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this6)->dist = T2;
+  chpl_check_nil(this6, INT64(145), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this6)->ranges + INT64(0)) = *(*(ranges) + INT64(0));
+  return this6;
+}
+
+/* DefaultRectangular.chpl:140 */
+static void chpl__auto_destroy_DefaultRectangularDom(DefaultRectangularDom_1_int64_t_F this6, int64_t _ln, c_string _fn) {
+  BaseRectangularDom _parent_destructor_tmp_ = NULL;
+  BaseDom _parent_destructor_tmp_2 = NULL;
+  _ref_atomicflag _field_destructor_tmp_ = NULL;
+  _ref_atomic_flag call_tmp = NULL;
+  _ref_atomic_flag T = NULL;
+  _ref_atomic_refcnt _field_destructor_tmp_2 = NULL;
+  _ref_atomic_int64 _field_destructor_tmp_3 = NULL;
+  _ref_atomic_int_least64_t call_tmp2 = NULL;
+  _ref_atomic_int_least64_t T2 = NULL;
+  _parent_destructor_tmp_ = ((BaseRectangularDom)(this6));
+  _parent_destructor_tmp_2 = ((BaseDom)(_parent_destructor_tmp_));
+  chpl_check_nil(_parent_destructor_tmp_2, INT64(140), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  _field_destructor_tmp_ = &((_parent_destructor_tmp_2)->_arrsLock);
+  chpl_check_nil(_field_destructor_tmp_, INT64(140), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  call_tmp = &((_field_destructor_tmp_)->_v);
+  T = call_tmp;
+  atomic_destroy_flag(T);
+  call_tmp = T;
+  chpl_check_nil(_parent_destructor_tmp_2, INT64(140), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  _field_destructor_tmp_2 = &((_parent_destructor_tmp_2)->_domCnt);
+  chpl_check_nil(_field_destructor_tmp_2, INT64(140), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  _field_destructor_tmp_3 = &((_field_destructor_tmp_2)->_cnt);
+  chpl_check_nil(_field_destructor_tmp_3, INT64(140), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  call_tmp2 = &((_field_destructor_tmp_3)->_v);
+  T2 = call_tmp2;
+  atomic_destroy_int_least64_t(T2);
+  call_tmp2 = T2;
+  return;
+}
+
+/* DefaultRectangular.chpl:148 */
+static chpl_bool dsiLinksDistribution2(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6) {
+  return false;
+}
+
+/* DefaultRectangular.chpl:150 */
+static DefaultRectangularDom_1_int64_t_F DefaultRectangularDom(chpl____wide_DefaultDist* const dist2, int64_t _ln, c_string _fn) {
+  DefaultRectangularDom_1_int64_t_F this6 = NULL;
+  DefaultRectangularDom_1_int64_t_F this7 = NULL;
+  int64_t call_tmp;
+  chpl_opaque cast_tmp;
+  DefaultRectangularDom_1_int64_t_F T = NULL;
+  DefaultDist T2 = NULL;
+  chpl____wide_DefaultDist T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  _tuple_1_star_range_int64_t_bounded_F _init_class_tmp_;
+  range_int64_t_bounded_F _init_class_tmp_2;
+  atomic_refcnt this8;
+  atomic_int64 _init_class_tmp_3;
+  atomic_int64 this9;
+  atomic_int_least64_t ret;
+  atomic_int_least64_t type_tmp;
+  _ref_atomic_int_least64_t _ref_tmp_ = NULL;
+  _ref_atomic_int_least64_t T4 = NULL;
+  atomic_int64 wrap_call_tmp;
+  atomic_refcnt wrap_call_tmp2;
+  list_BaseArr this10;
+  listNode_BaseArr T5 = NULL;
+  chpl____wide_listNode_BaseArr T6 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseArr T7 = NULL;
+  chpl____wide_listNode_BaseArr T8 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseArr call_tmp2 = NULL;
+  listNode_BaseArr T9 = NULL;
+  chpl____wide_listNode_BaseArr T10 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseArr call_tmp3 = NULL;
+  listNode_BaseArr T11 = NULL;
+  chpl____wide_listNode_BaseArr T12 = {CHPL_LOCALEID_T_INIT, NULL};
+  list_BaseArr wrap_call_tmp3;
+  atomicflag this11;
+  atomic_flag ret2;
+  atomic_flag type_tmp2;
+  _ref_atomic_flag _ref_tmp_2 = NULL;
+  _ref_atomic_flag T13 = NULL;
+  atomicflag wrap_call_tmp4;
+  DefaultDist call_tmp4 = NULL;
+  DefaultDist T14 = NULL;
+  chpl____wide_DefaultDist T15 = {CHPL_LOCALEID_T_INIT, NULL};
+  range_int64_t_bounded_F wrap_call_tmp5;
+  _tuple_1_star_range_int64_t_bounded_F this12;
+  DefaultRectangularDom_1_int64_t_F wrap_call_tmp6 = NULL;
+  _ref_DefaultDist call_tmp5 = NULL;
+  chpl____wide_DefaultDist chpl_macro_tmp_215;
+  chpl____wide_listNode_BaseArr chpl_macro_tmp_216;
+  chpl____wide_listNode_BaseArr chpl_macro_tmp_217;
+  chpl____wide_listNode_BaseArr chpl_macro_tmp_218;
+  chpl____wide_listNode_BaseArr chpl_macro_tmp_219;
+  chpl____wide_DefaultDist chpl_macro_tmp_220;
+  call_tmp = sizeof(chpl_DefaultRectangularDom_1_int64_t_F_object);
+  cast_tmp = chpl_here_alloc(call_tmp, INT16(5), _ln, _fn);
+  T = ((DefaultRectangularDom_1_int64_t_F)(cast_tmp));
+  this7 = T;
+  ((object)(this7))->chpl__cid = chpl__cid_DefaultRectangularDom_1_int64_t_F;
+  T2 = nil;
+  chpl_macro_tmp_215.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_215.addr = T2;
+  T3 = chpl_macro_tmp_215;
+  chpl_check_nil(this7, INT64(150), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->dist = T3;
+  (&_init_class_tmp_2)->_low = INT64(0);
+  (&_init_class_tmp_2)->_high = INT64(0);
+  (&_init_class_tmp_2)->_stride = INT64(0);
+  (&_init_class_tmp_2)->_alignment = INT64(0);
+  (&_init_class_tmp_2)->_aligned = false;
+  *(_init_class_tmp_ + INT64(0)) = _init_class_tmp_2;
+  chpl_check_nil(this7, INT64(150), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this7)->ranges + INT64(0)) = *(_init_class_tmp_ + INT64(0));
+  (&this8)->_cnt = _init_class_tmp_3;
+  ret = type_tmp;
+  _ref_tmp_ = &ret;
+  T4 = _ref_tmp_;
+  atomic_init_int_least64_t(T4, INT64(0));
+  _ref_tmp_ = T4;
+  (&this9)->_v = ret;
+  wrap_call_tmp = _construct_atomic_int64(ret, &this9, _ln, _fn);
+  (&this8)->_cnt = wrap_call_tmp;
+  wrap_call_tmp2 = _construct_atomic_refcnt(&wrap_call_tmp, &this8, _ln, _fn);
+  T5 = nil;
+  chpl_macro_tmp_216.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_216.addr = T5;
+  T6 = chpl_macro_tmp_216;
+  (&this10)->first = T6;
+  T7 = nil;
+  chpl_macro_tmp_217.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_217.addr = T7;
+  T8 = chpl_macro_tmp_217;
+  (&this10)->last = T8;
+  (&this10)->length = INT64(0);
+  T9 = ((listNode_BaseArr)(nil));
+  call_tmp2 = T9;
+  chpl_macro_tmp_218.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_218.addr = call_tmp2;
+  T10 = chpl_macro_tmp_218;
+  (&this10)->first = T10;
+  T11 = ((listNode_BaseArr)(nil));
+  call_tmp3 = T11;
+  chpl_macro_tmp_219.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_219.addr = call_tmp3;
+  T12 = chpl_macro_tmp_219;
+  (&this10)->last = T12;
+  (&this10)->length = INT64(0);
+  wrap_call_tmp3 = _construct_list(call_tmp2, call_tmp3, INT64(0), &this10, _ln, _fn);
+  ret2 = type_tmp2;
+  _ref_tmp_2 = &ret2;
+  T13 = _ref_tmp_2;
+  atomic_init_flag(T13, false);
+  _ref_tmp_2 = T13;
+  (&this11)->_v = ret2;
+  wrap_call_tmp4 = _construct_atomicflag(ret2, &this11, _ln, _fn);
+  T14 = ((DefaultDist)(nil));
+  call_tmp4 = T14;
+  chpl_macro_tmp_220.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_220.addr = call_tmp4;
+  T15 = chpl_macro_tmp_220;
+  chpl_check_nil(this7, INT64(150), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->dist = T15;
+  wrap_call_tmp5 = range(INT64(1), INT64(0), INT64(1), INT64(0), false, _ln, _fn);
+  *(this12 + INT64(0)) = wrap_call_tmp5;
+  chpl_check_nil(this7, INT64(150), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this7)->ranges + INT64(0)) = *(this12 + INT64(0));
+  wrap_call_tmp6 = _construct_DefaultRectangularDom(&wrap_call_tmp2, &wrap_call_tmp3, &wrap_call_tmp4, call_tmp4, &this12, this7, _ln, _fn);
+  this6 = wrap_call_tmp6;
+  chpl_check_nil(this6, INT64(151), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  call_tmp5 = &((this6)->dist);
+  *(call_tmp5) = *(dist2);
+  return this6;
+}
+
+/* DefaultRectangular.chpl:165 */
+static void dsiGetIndices(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, _ref__tuple_1_star_range_int64_t_bounded_F _retArg, int64_t _ln, c_string _fn) {
+  range_int64_t_bounded_F ret_x1;
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F ret_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F chpl_macro_tmp_221;
+  chpl____wide__ref_range_int64_t_bounded_F chpl_macro_tmp_222;
+  chpl_check_nil((this6)->addr, INT64(165), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_221.locale = (this6)->locale;
+  chpl_macro_tmp_221.addr = &(((this6)->addr)->ranges);
+  ret_ = chpl_macro_tmp_221;
+  chpl_macro_tmp_222.locale = (ret_).locale;
+  chpl_macro_tmp_222.addr = (*((ret_).addr) + INT64(0));
+  chpl_gen_comm_get(((void*)(&ret_x1)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_222).locale), INT64(0), NULL), (chpl_macro_tmp_222).addr, sizeof(range_int64_t_bounded_F), -1, INT64(1), INT64(165), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *(*(_retArg) + INT64(0)) = ret_x1;
+  return;
+}
+
+/* DefaultRectangular.chpl:167 */
+static void dsiSetIndices(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, _tuple_1_star_range_int64_t_bounded_F* const x2, int64_t _ln, c_string _fn) {
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F chpl_macro_tmp_223;
+  chpl_check_nil((this6)->addr, INT64(172), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_223.locale = (this6)->locale;
+  chpl_macro_tmp_223.addr = &(((this6)->addr)->ranges);
+  call_tmp = chpl_macro_tmp_223;
+  chpl_gen_comm_put(((void*)(x2)), chpl_nodeFromLocaleID(&((call_tmp).locale), INT64(0), NULL), (call_tmp).addr, sizeof(_tuple_1_star_range_int64_t_bounded_F), -1, INT64(1), INT64(172), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  return;
+}
+
+/* DefaultRectangular.chpl:446 */
+static void dsiDim(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, _ref_range_int64_t_bounded_F _retArg, int64_t _ln, c_string _fn) {
+  range_int64_t_bounded_F ret_x1;
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F ret_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F chpl_macro_tmp_224;
+  chpl____wide__ref_range_int64_t_bounded_F chpl_macro_tmp_225;
+  chpl_check_nil((this6)->addr, INT64(447), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_224.locale = (this6)->locale;
+  chpl_macro_tmp_224.addr = &(((this6)->addr)->ranges);
+  ret_ = chpl_macro_tmp_224;
+  chpl_macro_tmp_225.locale = (ret_).locale;
+  chpl_macro_tmp_225.addr = (*((ret_).addr) + INT64(0));
+  chpl_gen_comm_get(((void*)(&ret_x1)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_225).locale), INT64(0), NULL), (chpl_macro_tmp_225).addr, sizeof(range_int64_t_bounded_F), -1, INT64(1), INT64(447), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *(_retArg) = ret_x1;
+  return;
+}
+
+/* DefaultRectangular.chpl:449 */
+static int64_t dsiNumIndices(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, int64_t _ln, c_string _fn) {
+  int64_t sum;
+  chpl____wide__ref_range_int64_t_bounded_F call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F _this_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp2;
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F chpl_macro_tmp_226;
+  chpl____wide__ref_range_int64_t_bounded_F chpl_macro_tmp_227;
+  sum = INT64(1);
+  chpl_check_nil((this6)->addr, INT64(452), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_226.locale = (this6)->locale;
+  chpl_macro_tmp_226.addr = &(((this6)->addr)->ranges);
+  _this_tmp_ = chpl_macro_tmp_226;
+  chpl_macro_tmp_227.locale = (_this_tmp_).locale;
+  chpl_macro_tmp_227.addr = (*((_this_tmp_).addr) + INT64(0));
+  call_tmp = chpl_macro_tmp_227;
+  call_tmp2 = length(&call_tmp, _ln, _fn);
+  sum *= call_tmp2;
+  return sum;
+}
+
+/* DefaultRectangular.chpl:457 */
+static int64_t dsiLow(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, int64_t _ln, c_string _fn) {
+  chpl____wide__ref_range_int64_t_bounded_F call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F _this_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t ret;
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F chpl_macro_tmp_228;
+  chpl____wide__ref_range_int64_t_bounded_F chpl_macro_tmp_229;
+  chpl____wide__ref_int64_t chpl_macro_tmp_230;
+  chpl_check_nil((this6)->addr, INT64(459), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_228.locale = (this6)->locale;
+  chpl_macro_tmp_228.addr = &(((this6)->addr)->ranges);
+  _this_tmp_ = chpl_macro_tmp_228;
+  chpl_macro_tmp_229.locale = (_this_tmp_).locale;
+  chpl_macro_tmp_229.addr = (*((_this_tmp_).addr) + INT64(0));
+  call_tmp = chpl_macro_tmp_229;
+  chpl_macro_tmp_230.locale = (call_tmp).locale;
+  chpl_macro_tmp_230.addr = &(((call_tmp).addr)->_low);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_230).locale), INT64(0), NULL), (chpl_macro_tmp_230).addr, sizeof(int64_t), -1, INT64(1), INT64(459), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  return ret;
+}
+
+/* DefaultRectangular.chpl:545 */
+static DefaultRectangularArr_locale_1_int64_t_F dsiBuildArray(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, int64_t _ln, c_string _fn) {
+  DefaultRectangularArr_locale_1_int64_t_F this7 = NULL;
+  int64_t call_tmp;
+  chpl_opaque cast_tmp;
+  DefaultRectangularArr_locale_1_int64_t_F T = NULL;
+  DefaultRectangularDom_1_int64_t_F T2 = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  _tuple_1_star_int64_t _init_class_tmp_;
+  _tuple_1_star_int64_t _init_class_tmp_2;
+  _tuple_1_star_int64_t _init_class_tmp_3;
+  _ddata_locale T4 = NULL;
+  chpl____wide__ddata_locale T5 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ddata_locale T6 = NULL;
+  chpl____wide__ddata_locale T7 = {CHPL_LOCALEID_T_INIT, NULL};
+  atomic_refcnt this8;
+  atomic_int64 _init_class_tmp_4;
+  atomic_int64 this9;
+  atomic_int_least64_t ret;
+  atomic_int_least64_t type_tmp;
+  _ref_atomic_int_least64_t _ref_tmp_ = NULL;
+  _ref_atomic_int_least64_t T8 = NULL;
+  atomic_int64 wrap_call_tmp;
+  atomic_refcnt wrap_call_tmp2;
+  BaseArr call_tmp2 = NULL;
+  BaseArr T9 = NULL;
+  _tuple_1_star_int64_t this10;
+  _tuple_1_star_int64_t this11;
+  _tuple_1_star_int64_t this12;
+  _ddata_locale call_tmp3 = NULL;
+  _ddata_locale T10 = NULL;
+  chpl____wide__ddata_locale T11 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ddata_locale call_tmp4 = NULL;
+  _ddata_locale T12 = NULL;
+  chpl____wide__ddata_locale T13 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool x2;
+  _ref_chpl_bool _ref_tmp_2 = NULL;
+  DefaultRectangularArr_locale_1_int64_t_F wrap_call_tmp3 = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_231;
+  chpl____wide__ddata_locale chpl_macro_tmp_232;
+  chpl____wide__ddata_locale chpl_macro_tmp_233;
+  chpl____wide__ddata_locale chpl_macro_tmp_234;
+  chpl____wide__ddata_locale chpl_macro_tmp_235;
+  call_tmp = sizeof(chpl_DefaultRectangularArr_locale_1_int64_t_F_object);
+  cast_tmp = chpl_here_alloc(call_tmp, INT16(8), _ln, _fn);
+  T = ((DefaultRectangularArr_locale_1_int64_t_F)(cast_tmp));
+  this7 = T;
+  ((object)(this7))->chpl__cid = chpl__cid_DefaultRectangularArr_locale_1_int64_t_F;
+  T2 = nil;
+  chpl_macro_tmp_231.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_231.addr = T2;
+  T3 = chpl_macro_tmp_231;
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->dom = T3;
+  *(_init_class_tmp_ + INT64(0)) = INT64(0);
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this7)->off + INT64(0)) = *(_init_class_tmp_ + INT64(0));
+  *(_init_class_tmp_2 + INT64(0)) = INT64(0);
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this7)->blk + INT64(0)) = *(_init_class_tmp_2 + INT64(0));
+  *(_init_class_tmp_3 + INT64(0)) = INT64(0);
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this7)->str + INT64(0)) = *(_init_class_tmp_3 + INT64(0));
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->origin = INT64(0);
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->factoredOffs = INT64(0);
+  T4 = nil;
+  chpl_macro_tmp_232.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_232.addr = T4;
+  T5 = chpl_macro_tmp_232;
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->data = T5;
+  T6 = nil;
+  chpl_macro_tmp_233.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_233.addr = T6;
+  T7 = chpl_macro_tmp_233;
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->shiftedData = T7;
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->noinit_data = false;
+  (&this8)->_cnt = _init_class_tmp_4;
+  ret = type_tmp;
+  _ref_tmp_ = &ret;
+  T8 = _ref_tmp_;
+  atomic_init_int_least64_t(T8, INT64(0));
+  _ref_tmp_ = T8;
+  (&this9)->_v = ret;
+  wrap_call_tmp = _construct_atomic_int64(ret, &this9, _ln, _fn);
+  (&this8)->_cnt = wrap_call_tmp;
+  wrap_call_tmp2 = _construct_atomic_refcnt(&wrap_call_tmp, &this8, _ln, _fn);
+  T9 = ((BaseArr)(nil));
+  call_tmp2 = T9;
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->dom = *(this6);
+  *(this10 + INT64(0)) = INT64(0);
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this7)->off + INT64(0)) = *(this10 + INT64(0));
+  *(this11 + INT64(0)) = INT64(0);
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this7)->blk + INT64(0)) = *(this11 + INT64(0));
+  *(this12 + INT64(0)) = INT64(0);
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this7)->str + INT64(0)) = *(this12 + INT64(0));
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->origin = INT64(0);
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->factoredOffs = INT64(0);
+  T10 = ((_ddata_locale)(nil));
+  call_tmp3 = T10;
+  chpl_macro_tmp_234.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_234.addr = call_tmp3;
+  T11 = chpl_macro_tmp_234;
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->data = T11;
+  T12 = ((_ddata_locale)(nil));
+  call_tmp4 = T12;
+  chpl_macro_tmp_235.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_235.addr = call_tmp4;
+  T13 = chpl_macro_tmp_235;
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->shiftedData = T13;
+  x2 = false;
+  _ref_tmp_2 = &x2;
+  *(_ref_tmp_2) = false;
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->noinit_data = x2;
+  wrap_call_tmp3 = _construct_DefaultRectangularArr(&wrap_call_tmp2, call_tmp2, this6, &this10, &this11, &this12, INT64(0), INT64(0), call_tmp3, call_tmp4, x2, this7, _ln, _fn);
+  return wrap_call_tmp3;
+}
+
+/* DefaultRectangular.chpl:545 */
+static DefaultRectangularArr_localesSignal_1_int64_t_F dsiBuildArray2(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, int64_t _ln, c_string _fn) {
+  DefaultRectangularArr_localesSignal_1_int64_t_F this7 = NULL;
+  int64_t call_tmp;
+  chpl_opaque cast_tmp;
+  DefaultRectangularArr_localesSignal_1_int64_t_F T = NULL;
+  DefaultRectangularDom_1_int64_t_F T2 = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  _tuple_1_star_int64_t _init_class_tmp_;
+  _tuple_1_star_int64_t _init_class_tmp_2;
+  _tuple_1_star_int64_t _init_class_tmp_3;
+  _ddata_localesSignal T4 = NULL;
+  chpl____wide__ddata_localesSignal T5 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ddata_localesSignal T6 = NULL;
+  chpl____wide__ddata_localesSignal T7 = {CHPL_LOCALEID_T_INIT, NULL};
+  atomic_refcnt this8;
+  atomic_int64 _init_class_tmp_4;
+  atomic_int64 this9;
+  atomic_int_least64_t ret;
+  atomic_int_least64_t type_tmp;
+  _ref_atomic_int_least64_t _ref_tmp_ = NULL;
+  _ref_atomic_int_least64_t T8 = NULL;
+  atomic_int64 wrap_call_tmp;
+  atomic_refcnt wrap_call_tmp2;
+  BaseArr call_tmp2 = NULL;
+  BaseArr T9 = NULL;
+  _tuple_1_star_int64_t this10;
+  _tuple_1_star_int64_t this11;
+  _tuple_1_star_int64_t this12;
+  _ddata_localesSignal call_tmp3 = NULL;
+  _ddata_localesSignal T10 = NULL;
+  chpl____wide__ddata_localesSignal T11 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ddata_localesSignal call_tmp4 = NULL;
+  _ddata_localesSignal T12 = NULL;
+  chpl____wide__ddata_localesSignal T13 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool x2;
+  _ref_chpl_bool _ref_tmp_2 = NULL;
+  DefaultRectangularArr_localesSignal_1_int64_t_F wrap_call_tmp3 = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_236;
+  chpl____wide__ddata_localesSignal chpl_macro_tmp_237;
+  chpl____wide__ddata_localesSignal chpl_macro_tmp_238;
+  chpl____wide__ddata_localesSignal chpl_macro_tmp_239;
+  chpl____wide__ddata_localesSignal chpl_macro_tmp_240;
+  call_tmp = sizeof(chpl_DefaultRectangularArr_localesSignal_1_int64_t_F_object);
+  cast_tmp = chpl_here_alloc(call_tmp, INT16(14), _ln, _fn);
+  T = ((DefaultRectangularArr_localesSignal_1_int64_t_F)(cast_tmp));
+  this7 = T;
+  ((object)(this7))->chpl__cid = chpl__cid_DefaultRectangularArr_localesSignal_1_int64_t_F;
+  T2 = nil;
+  chpl_macro_tmp_236.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_236.addr = T2;
+  T3 = chpl_macro_tmp_236;
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->dom = T3;
+  *(_init_class_tmp_ + INT64(0)) = INT64(0);
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this7)->off + INT64(0)) = *(_init_class_tmp_ + INT64(0));
+  *(_init_class_tmp_2 + INT64(0)) = INT64(0);
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this7)->blk + INT64(0)) = *(_init_class_tmp_2 + INT64(0));
+  *(_init_class_tmp_3 + INT64(0)) = INT64(0);
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this7)->str + INT64(0)) = *(_init_class_tmp_3 + INT64(0));
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->origin = INT64(0);
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->factoredOffs = INT64(0);
+  T4 = nil;
+  chpl_macro_tmp_237.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_237.addr = T4;
+  T5 = chpl_macro_tmp_237;
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->data = T5;
+  T6 = nil;
+  chpl_macro_tmp_238.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_238.addr = T6;
+  T7 = chpl_macro_tmp_238;
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->shiftedData = T7;
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->noinit_data = false;
+  (&this8)->_cnt = _init_class_tmp_4;
+  ret = type_tmp;
+  _ref_tmp_ = &ret;
+  T8 = _ref_tmp_;
+  atomic_init_int_least64_t(T8, INT64(0));
+  _ref_tmp_ = T8;
+  (&this9)->_v = ret;
+  wrap_call_tmp = _construct_atomic_int64(ret, &this9, _ln, _fn);
+  (&this8)->_cnt = wrap_call_tmp;
+  wrap_call_tmp2 = _construct_atomic_refcnt(&wrap_call_tmp, &this8, _ln, _fn);
+  T9 = ((BaseArr)(nil));
+  call_tmp2 = T9;
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->dom = *(this6);
+  *(this10 + INT64(0)) = INT64(0);
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this7)->off + INT64(0)) = *(this10 + INT64(0));
+  *(this11 + INT64(0)) = INT64(0);
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this7)->blk + INT64(0)) = *(this11 + INT64(0));
+  *(this12 + INT64(0)) = INT64(0);
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this7)->str + INT64(0)) = *(this12 + INT64(0));
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->origin = INT64(0);
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->factoredOffs = INT64(0);
+  T10 = ((_ddata_localesSignal)(nil));
+  call_tmp3 = T10;
+  chpl_macro_tmp_239.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_239.addr = call_tmp3;
+  T11 = chpl_macro_tmp_239;
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->data = T11;
+  T12 = ((_ddata_localesSignal)(nil));
+  call_tmp4 = T12;
+  chpl_macro_tmp_240.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_240.addr = call_tmp4;
+  T13 = chpl_macro_tmp_240;
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->shiftedData = T13;
+  x2 = false;
+  _ref_tmp_2 = &x2;
+  *(_ref_tmp_2) = false;
+  chpl_check_nil(this7, INT64(546), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->noinit_data = x2;
+  wrap_call_tmp3 = _construct_DefaultRectangularArr2(&wrap_call_tmp2, call_tmp2, this6, &this10, &this11, &this12, INT64(0), INT64(0), call_tmp3, call_tmp4, x2, this7, _ln, _fn);
+  return wrap_call_tmp3;
+}
+
+/* DefaultRectangular.chpl:550 */
+static DefaultRectangularDom_1_int64_t_F dsiBuildRectangularDom(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, _tuple_1_star_range_int64_t_bounded_F* const ranges, int64_t _ln, c_string _fn) {
+  DefaultRectangularDom_1_int64_t_F dom = NULL;
+  chpl____wide_DefaultDist ret = {CHPL_LOCALEID_T_INIT, NULL};
+  range_int64_t_bounded_F call_tmp;
+  _ref_range_int64_t_bounded_F ret_to_arg_ref_tmp_ = NULL;
+  range_int64_t_bounded_F _ic__F0_this;
+  _ref_range_int64_t_bounded_F this7 = NULL;
+  int64_t i;
+  int64_t ret2;
+  int64_t end;
+  int64_t ret3;
+  chpl____wide__ref_range_int64_t_bounded_F call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref__tuple_1_star_range_int64_t_bounded_F _this_tmp_ = NULL;
+  range_int64_t_bounded_F T;
+  _ref_range_int64_t_bounded_F ret_to_arg_ref_tmp_2 = NULL;
+  _ref__tuple_1_star_range_int64_t_bounded_F _ref_tmp_ = NULL;
+  chpl____wide__ref_DefaultDist chpl_macro_tmp_241;
+  chpl_check_nil((this6)->addr, INT64(554), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_241.locale = (this6)->locale;
+  chpl_macro_tmp_241.addr = &(((this6)->addr)->dist);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_241).locale), INT64(0), NULL), (chpl_macro_tmp_241).addr, sizeof(chpl____wide_DefaultDist), -1, INT64(1), INT64(554), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  dom = DefaultRectangularDom(&ret, _ln, _fn);
+  ret_to_arg_ref_tmp_ = &call_tmp;
+  _build_range(INT64(1), INT64(1), ret_to_arg_ref_tmp_, _ln, _fn);
+  _ic__F0_this = call_tmp;
+  this7 = &_ic__F0_this;
+  checkIfIterWillOverflow(this7, true, _ln, _fn);
+  ret2 = (&_ic__F0_this)->_low;
+  ret3 = (&_ic__F0_this)->_high;
+  end = ret3;
+  for (i = ret2; ((i <= end)); i += INT64(1)) {
+    chpl_check_nil(dom, INT64(556), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    _this_tmp_ = &((dom)->ranges);
+    call_tmp2 = this4(_this_tmp_, i, _ln, _fn);
+    ret_to_arg_ref_tmp_2 = &T;
+    _ref_tmp_ = ranges;
+    this5(_ref_tmp_, i, ret_to_arg_ref_tmp_2, _ln, _fn);
+    chpl_gen_comm_put(((void*)(&T)), chpl_nodeFromLocaleID(&((call_tmp2).locale), INT64(0), NULL), (call_tmp2).addr, sizeof(range_int64_t_bounded_F), -1, INT64(1), INT64(556), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  }
+  return dom;
+}
+
+/* DefaultRectangular.chpl:595 */
+static DefaultRectangularArr_locale_1_int64_t_F _construct_DefaultRectangularArr(atomic_refcnt* const _arrCnt, BaseArr _arrAlias, chpl____wide_DefaultRectangularDom_1_int64_t_F* const dom, _tuple_1_star_int64_t* const off, _tuple_1_star_int64_t* const blk, _tuple_1_star_int64_t* const str, int64_t origin, int64_t factoredOffs, _ddata_locale data, _ddata_locale shiftedData, chpl_bool noinit_data, DefaultRectangularArr_locale_1_int64_t_F meme, int64_t _ln, c_string _fn) {
+  DefaultRectangularArr_locale_1_int64_t_F this6 = NULL;
+  BaseArr T = NULL;
+  chpl____wide__ddata_locale T2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_locale T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_locale chpl_macro_tmp_242;
+  chpl____wide__ddata_locale chpl_macro_tmp_243;
+  this6 = meme;
+  chpl_check_nil(this6, INT64(595), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  T = &((this6)->super);
+  _construct_BaseArr(_arrCnt, _arrAlias, T, _ln, _fn);
+  chpl_check_nil(this6, INT64(601), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this6)->dom = *(dom);
+  chpl_check_nil(this6, INT64(603), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this6)->off + INT64(0)) = *(*(off) + INT64(0));
+  chpl_check_nil(this6, INT64(604), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this6)->blk + INT64(0)) = *(*(blk) + INT64(0));
+  chpl_check_nil(this6, INT64(605), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this6)->str + INT64(0)) = *(*(str) + INT64(0));
+  chpl_check_nil(this6, INT64(606), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this6)->origin = origin;
+  chpl_check_nil(this6, INT64(607), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this6)->factoredOffs = factoredOffs;
+  chpl_macro_tmp_242.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_242.addr = data;
+  T2 = chpl_macro_tmp_242;
+  chpl_check_nil(this6, INT64(608), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this6)->data = T2;
+  chpl_macro_tmp_243.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_243.addr = shiftedData;
+  T3 = chpl_macro_tmp_243;
+  chpl_check_nil(this6, INT64(609), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this6)->shiftedData = T3;
+  chpl_check_nil(this6, INT64(610), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this6)->noinit_data = noinit_data;
+  chpl_check_nil(this6, INT64(595), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  initialize3(this6, _ln, _fn);
+  return this6;
+}
+
+/* DefaultRectangular.chpl:595 */
+static DefaultRectangularArr_localesSignal_1_int64_t_F _construct_DefaultRectangularArr2(atomic_refcnt* const _arrCnt, BaseArr _arrAlias, chpl____wide_DefaultRectangularDom_1_int64_t_F* const dom, _tuple_1_star_int64_t* const off, _tuple_1_star_int64_t* const blk, _tuple_1_star_int64_t* const str, int64_t origin, int64_t factoredOffs, _ddata_localesSignal data, _ddata_localesSignal shiftedData, chpl_bool noinit_data, DefaultRectangularArr_localesSignal_1_int64_t_F meme, int64_t _ln, c_string _fn) {
+  DefaultRectangularArr_localesSignal_1_int64_t_F this6 = NULL;
+  BaseArr T = NULL;
+  chpl____wide__ddata_localesSignal T2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_localesSignal T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_localesSignal chpl_macro_tmp_244;
+  chpl____wide__ddata_localesSignal chpl_macro_tmp_245;
+  this6 = meme;
+  chpl_check_nil(this6, INT64(595), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  T = &((this6)->super);
+  _construct_BaseArr(_arrCnt, _arrAlias, T, _ln, _fn);
+  chpl_check_nil(this6, INT64(601), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this6)->dom = *(dom);
+  chpl_check_nil(this6, INT64(603), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this6)->off + INT64(0)) = *(*(off) + INT64(0));
+  chpl_check_nil(this6, INT64(604), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this6)->blk + INT64(0)) = *(*(blk) + INT64(0));
+  chpl_check_nil(this6, INT64(605), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this6)->str + INT64(0)) = *(*(str) + INT64(0));
+  chpl_check_nil(this6, INT64(606), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this6)->origin = origin;
+  chpl_check_nil(this6, INT64(607), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this6)->factoredOffs = factoredOffs;
+  chpl_macro_tmp_244.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_244.addr = data;
+  T2 = chpl_macro_tmp_244;
+  chpl_check_nil(this6, INT64(608), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this6)->data = T2;
+  chpl_macro_tmp_245.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_245.addr = shiftedData;
+  T3 = chpl_macro_tmp_245;
+  chpl_check_nil(this6, INT64(609), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this6)->shiftedData = T3;
+  chpl_check_nil(this6, INT64(610), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this6)->noinit_data = noinit_data;
+  chpl_check_nil(this6, INT64(595), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  initialize4(this6, _ln, _fn);
+  return this6;
+}
+
+/* DefaultRectangular.chpl:595 */
+static void chpl__auto_destroy_DefaultRectangularArr(DefaultRectangularArr_locale_1_int64_t_F this6, int64_t _ln, c_string _fn) {
+  BaseArr _parent_destructor_tmp_ = NULL;
+  _ref_atomic_refcnt _field_destructor_tmp_ = NULL;
+  _ref_atomic_int64 _field_destructor_tmp_2 = NULL;
+  _ref_atomic_int_least64_t call_tmp = NULL;
+  _ref_atomic_int_least64_t T = NULL;
+  _parent_destructor_tmp_ = ((BaseArr)(this6));
+  chpl_check_nil(_parent_destructor_tmp_, INT64(595), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  _field_destructor_tmp_ = &((_parent_destructor_tmp_)->_arrCnt);
+  chpl_check_nil(_field_destructor_tmp_, INT64(595), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  _field_destructor_tmp_2 = &((_field_destructor_tmp_)->_cnt);
+  chpl_check_nil(_field_destructor_tmp_2, INT64(595), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  call_tmp = &((_field_destructor_tmp_2)->_v);
+  T = call_tmp;
+  atomic_destroy_int_least64_t(T);
+  call_tmp = T;
+  return;
+}
+
+/* DefaultRectangular.chpl:595 */
+static void chpl__auto_destroy_DefaultRectangularArr2(DefaultRectangularArr_localesSignal_1_int64_t_F this6, int64_t _ln, c_string _fn) {
+  BaseArr _parent_destructor_tmp_ = NULL;
+  _ref_atomic_refcnt _field_destructor_tmp_ = NULL;
+  _ref_atomic_int64 _field_destructor_tmp_2 = NULL;
+  _ref_atomic_int_least64_t call_tmp = NULL;
+  _ref_atomic_int_least64_t T = NULL;
+  _parent_destructor_tmp_ = ((BaseArr)(this6));
+  chpl_check_nil(_parent_destructor_tmp_, INT64(595), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  _field_destructor_tmp_ = &((_parent_destructor_tmp_)->_arrCnt);
+  chpl_check_nil(_field_destructor_tmp_, INT64(595), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  _field_destructor_tmp_2 = &((_field_destructor_tmp_)->_cnt);
+  chpl_check_nil(_field_destructor_tmp_2, INT64(595), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  call_tmp = &((_field_destructor_tmp_2)->_v);
+  T = call_tmp;
+  atomic_destroy_int_least64_t(T);
+  call_tmp = T;
+  return;
+}
+
+/* DefaultRectangular.chpl:625 */
+static chpl____wide_DefaultRectangularDom_1_int64_t_F dsiGetBaseDom2(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const this6, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_246;
+  chpl_check_nil((this6)->addr, INT64(625), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_246.locale = (this6)->locale;
+  chpl_macro_tmp_246.addr = &(((this6)->addr)->dom);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_246).locale), INT64(0), NULL), (chpl_macro_tmp_246).addr, sizeof(chpl____wide_DefaultRectangularDom_1_int64_t_F), -1, INT64(1), INT64(625), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  return ret;
+}
+
+/* DefaultRectangular.chpl:625 */
+static chpl____wide_DefaultRectangularDom_1_int64_t_F dsiGetBaseDom3(chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const this6, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_247;
+  chpl_check_nil((this6)->addr, INT64(625), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_247.locale = (this6)->locale;
+  chpl_macro_tmp_247.addr = &(((this6)->addr)->dom);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_247).locale), INT64(0), NULL), (chpl_macro_tmp_247).addr, sizeof(chpl____wide_DefaultRectangularDom_1_int64_t_F), -1, INT64(1), INT64(625), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  return ret;
+}
+
+/* DefaultRectangular.chpl:627 */
+static void dsiDestroyData2(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const this6, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp;
+  chpl_bool call_tmp2;
+  chpl____wide__ddata_locale ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_locale dv = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_locale ret3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_248;
+  chpl____wide__ref__ddata_locale chpl_macro_tmp_249;
+  chpl____wide__ref__ddata_locale chpl_macro_tmp_250;
+  chpl_check_nil((this6)->addr, INT64(628), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_248.locale = (this6)->locale;
+  chpl_macro_tmp_248.addr = &(((this6)->addr)->dom);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_248).locale), INT64(0), NULL), (chpl_macro_tmp_248).addr, sizeof(chpl____wide_DefaultRectangularDom_1_int64_t_F), -1, INT64(1), INT64(628), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_check_nil((&ret)->addr, INT64(628), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  call_tmp = dsiNumIndices(&ret, _ln, _fn);
+  call_tmp2 = (call_tmp > INT64(0));
+  if (call_tmp2) {
+    chpl_check_nil((this6)->addr, INT64(629), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    chpl_macro_tmp_249.locale = (this6)->locale;
+    chpl_macro_tmp_249.addr = &(((this6)->addr)->data);
+    chpl_gen_comm_get(((void*)(&ret2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_249).locale), INT64(0), NULL), (chpl_macro_tmp_249).addr, sizeof(chpl____wide__ddata_locale), -1, INT64(1), INT64(629), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    dv = ret2;
+  }
+  chpl_check_nil((this6)->addr, INT64(643), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_250.locale = (this6)->locale;
+  chpl_macro_tmp_250.addr = &(((this6)->addr)->data);
+  chpl_gen_comm_get(((void*)(&ret3)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_250).locale), INT64(0), NULL), (chpl_macro_tmp_250).addr, sizeof(chpl____wide__ddata_locale), -1, INT64(1), INT64(643), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_wide_array_free(chpl_nodeFromLocaleID(&((&ret3)->locale), INT64(0), NULL), (&ret3)->addr, _ln, _fn);
+  return;
+}
+
+/* DefaultRectangular.chpl:627 */
+static void dsiDestroyData3(chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const this6, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp;
+  chpl_bool call_tmp2;
+  chpl____wide__ddata_localesSignal ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_localesSignal dv = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_localesSignal ret3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_251;
+  chpl____wide__ref__ddata_localesSignal chpl_macro_tmp_252;
+  chpl____wide__ref__ddata_localesSignal chpl_macro_tmp_253;
+  chpl_check_nil((this6)->addr, INT64(628), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_251.locale = (this6)->locale;
+  chpl_macro_tmp_251.addr = &(((this6)->addr)->dom);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_251).locale), INT64(0), NULL), (chpl_macro_tmp_251).addr, sizeof(chpl____wide_DefaultRectangularDom_1_int64_t_F), -1, INT64(1), INT64(628), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_check_nil((&ret)->addr, INT64(628), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  call_tmp = dsiNumIndices(&ret, _ln, _fn);
+  call_tmp2 = (call_tmp > INT64(0));
+  if (call_tmp2) {
+    chpl_check_nil((this6)->addr, INT64(629), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    chpl_macro_tmp_252.locale = (this6)->locale;
+    chpl_macro_tmp_252.addr = &(((this6)->addr)->data);
+    chpl_gen_comm_get(((void*)(&ret2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_252).locale), INT64(0), NULL), (chpl_macro_tmp_252).addr, sizeof(chpl____wide__ddata_localesSignal), -1, INT64(1), INT64(629), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    dv = ret2;
+  }
+  chpl_check_nil((this6)->addr, INT64(643), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_253.locale = (this6)->locale;
+  chpl_macro_tmp_253.addr = &(((this6)->addr)->data);
+  chpl_gen_comm_get(((void*)(&ret3)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_253).locale), INT64(0), NULL), (chpl_macro_tmp_253).addr, sizeof(chpl____wide__ddata_localesSignal), -1, INT64(1), INT64(643), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_wide_array_free(chpl_nodeFromLocaleID(&((&ret3)->locale), INT64(0), NULL), (&ret3)->addr, _ln, _fn);
+  return;
+}
+
+/* DefaultRectangular.chpl:773 */
+static void computeFactoredOffs(DefaultRectangularArr_locale_1_int64_t_F this6, int64_t _ln, c_string _fn) {
+  _ref_int64_t call_tmp = NULL;
+  _ref_int64_t call_tmp2 = NULL;
+  int64_t ret;
+  int64_t ret_x1;
+  _ref__tuple_1_star_int64_t ret_ = NULL;
+  int64_t ret_x12;
+  _ref__tuple_1_star_int64_t ret_2 = NULL;
+  int64_t call_tmp3;
+  int64_t call_tmp4;
+  chpl_check_nil(this6, INT64(774), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  call_tmp = &((this6)->factoredOffs);
+  *(call_tmp) = INT64(0);
+  chpl_check_nil(this6, INT64(776), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  call_tmp2 = &((this6)->factoredOffs);
+  chpl_check_nil(this6, INT64(776), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  ret = (this6)->factoredOffs;
+  chpl_check_nil(this6, INT64(776), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  ret_ = &((this6)->blk);
+  ret_x1 = *(*(ret_) + INT64(0));
+  chpl_check_nil(this6, INT64(776), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  ret_2 = &((this6)->off);
+  ret_x12 = *(*(ret_2) + INT64(0));
+  call_tmp3 = (ret_x1 * ret_x12);
+  call_tmp4 = (ret + call_tmp3);
+  *(call_tmp2) = call_tmp4;
+  return;
+}
+
+/* DefaultRectangular.chpl:773 */
+static void computeFactoredOffs2(DefaultRectangularArr_localesSignal_1_int64_t_F this6, int64_t _ln, c_string _fn) {
+  _ref_int64_t call_tmp = NULL;
+  _ref_int64_t call_tmp2 = NULL;
+  int64_t ret;
+  int64_t ret_x1;
+  _ref__tuple_1_star_int64_t ret_ = NULL;
+  int64_t ret_x12;
+  _ref__tuple_1_star_int64_t ret_2 = NULL;
+  int64_t call_tmp3;
+  int64_t call_tmp4;
+  chpl_check_nil(this6, INT64(774), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  call_tmp = &((this6)->factoredOffs);
+  *(call_tmp) = INT64(0);
+  chpl_check_nil(this6, INT64(776), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  call_tmp2 = &((this6)->factoredOffs);
+  chpl_check_nil(this6, INT64(776), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  ret = (this6)->factoredOffs;
+  chpl_check_nil(this6, INT64(776), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  ret_ = &((this6)->blk);
+  ret_x1 = *(*(ret_) + INT64(0));
+  chpl_check_nil(this6, INT64(776), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  ret_2 = &((this6)->off);
+  ret_x12 = *(*(ret_2) + INT64(0));
+  call_tmp3 = (ret_x1 * ret_x12);
+  call_tmp4 = (ret + call_tmp3);
+  *(call_tmp2) = call_tmp4;
+  return;
+}
+
+/* DefaultRectangular.chpl:796 */
+static void initialize3(DefaultRectangularArr_locale_1_int64_t_F this6, int64_t _ln, c_string _fn) {
+  chpl_bool ret;
+  chpl_bool call_tmp;
+  chpl____wide__ref_int64_t call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref__tuple_1_star_int64_t _this_tmp_ = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  range_int64_t_bounded_F call_tmp3;
+  _ref_range_int64_t_bounded_F ret_to_arg_ref_tmp_ = NULL;
+  int64_t ret3;
+  int64_t ret4;
+  chpl____wide__ref_int64_t call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref__tuple_1_star_int64_t _this_tmp_2 = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret5 = {CHPL_LOCALEID_T_INIT, NULL};
+  range_int64_t_bounded_F call_tmp5;
+  _ref_range_int64_t_bounded_F ret_to_arg_ref_tmp_2 = NULL;
+  chpl____wide__ref_int64_t call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref__tuple_1_star_int64_t _this_tmp_3 = NULL;
+  int64_t ret_x1;
+  _ref__tuple_1_star_int64_t ret_ = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret6 = {CHPL_LOCALEID_T_INIT, NULL};
+  range_int64_t_bounded_F call_tmp7;
+  _ref_range_int64_t_bounded_F ret_to_arg_ref_tmp_3 = NULL;
+  int64_t call_tmp8;
+  _ref_range_int64_t_bounded_F _ref_tmp_ = NULL;
+  chpl____wide__ref_range_int64_t_bounded_F T = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp9;
+  _ref__ddata_locale call_tmp10 = NULL;
+  chpl____wide_locale _formal_type_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_locale call_tmp11 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ddata_locale T2 = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret7 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp12;
+  chpl_bool call_tmp13;
+  _ref__ddata_locale call_tmp14 = NULL;
+  chpl____wide__ddata_locale ret8 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t ret9;
+  int64_t ret10;
+  int64_t call_tmp15;
+  chpl____wide__ddata_locale call_tmp16 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ddata_locale T3 = NULL;
+  chpl____wide__ref_int64_t chpl_macro_tmp_254;
+  chpl____wide__ref_int64_t chpl_macro_tmp_255;
+  int64_t chpl_macro_tmp_256;
+  chpl____wide__ref_int64_t chpl_macro_tmp_257;
+  int64_t chpl_macro_tmp_258;
+  chpl____wide__ref_range_int64_t_bounded_F chpl_macro_tmp_259;
+  chpl____wide__ddata_locale chpl_macro_tmp_260;
+  chpl____wide__ddata_locale chpl_macro_tmp_261;
+  chpl____wide__ddata_locale chpl_macro_tmp_262;
+  chpl____wide__ddata_locale chpl_macro_tmp_263;
+  chpl_check_nil(this6, INT64(797), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  ret = (this6)->noinit_data;
+  call_tmp = (ret == true);
+  if (call_tmp) {
+    goto _end_initialize;
+  }
+  chpl_check_nil(this6, INT64(799), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  _this_tmp_ = &((this6)->off);
+  chpl_macro_tmp_254.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_254.addr = (*(_this_tmp_) + INT64(0));
+  call_tmp2 = chpl_macro_tmp_254;
+  chpl_check_nil(this6, INT64(799), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  ret2 = (this6)->dom;
+  ret_to_arg_ref_tmp_ = &call_tmp3;
+  chpl_check_nil((&ret2)->addr, INT64(799), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  dsiDim(&ret2, ret_to_arg_ref_tmp_, _ln, _fn);
+  ret4 = (&call_tmp3)->_low;
+  ret3 = ret4;
+  goto _end_alignedLow;
+  _end_alignedLow:;
+  chpl_gen_comm_put(((void*)(&ret3)), chpl_nodeFromLocaleID(&((call_tmp2).locale), INT64(0), NULL), (call_tmp2).addr, sizeof(int64_t), -1, INT64(1), INT64(799), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_check_nil(this6, INT64(800), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  _this_tmp_2 = &((this6)->str);
+  chpl_macro_tmp_255.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_255.addr = (*(_this_tmp_2) + INT64(0));
+  call_tmp4 = chpl_macro_tmp_255;
+  chpl_check_nil(this6, INT64(800), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  ret5 = (this6)->dom;
+  ret_to_arg_ref_tmp_2 = &call_tmp5;
+  chpl_check_nil((&ret5)->addr, INT64(800), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  dsiDim(&ret5, ret_to_arg_ref_tmp_2, _ln, _fn);
+  chpl_macro_tmp_256 = INT64(1);
+  chpl_gen_comm_put(((void*)(&chpl_macro_tmp_256)), chpl_nodeFromLocaleID(&((call_tmp4).locale), INT64(0), NULL), (call_tmp4).addr, sizeof(int64_t), -1, INT64(1), INT64(800), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_check_nil(this6, INT64(802), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  _this_tmp_3 = &((this6)->blk);
+  chpl_macro_tmp_257.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_257.addr = (*(_this_tmp_3) + INT64(0));
+  call_tmp6 = chpl_macro_tmp_257;
+  chpl_macro_tmp_258 = INT64(1);
+  chpl_gen_comm_put(((void*)(&chpl_macro_tmp_258)), chpl_nodeFromLocaleID(&((call_tmp6).locale), INT64(0), NULL), (call_tmp6).addr, sizeof(int64_t), -1, INT64(1), INT64(802), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_check_nil(this6, INT64(805), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  computeFactoredOffs(this6, _ln, _fn);
+  chpl_check_nil(this6, INT64(806), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  ret_ = &((this6)->blk);
+  ret_x1 = *(*(ret_) + INT64(0));
+  chpl_check_nil(this6, INT64(806), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  ret6 = (this6)->dom;
+  ret_to_arg_ref_tmp_3 = &call_tmp7;
+  chpl_check_nil((&ret6)->addr, INT64(806), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  dsiDim(&ret6, ret_to_arg_ref_tmp_3, _ln, _fn);
+  _ref_tmp_ = &call_tmp7;
+  chpl_macro_tmp_259.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_259.addr = _ref_tmp_;
+  T = chpl_macro_tmp_259;
+  call_tmp8 = length(&T, _ln, _fn);
+  call_tmp9 = (ret_x1 * call_tmp8);
+  chpl_check_nil(this6, INT64(810), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  call_tmp10 = &((this6)->data);
+  T2 = ((_ddata_locale)(nil));
+  chpl_macro_tmp_260.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_260.addr = T2;
+  call_tmp11 = chpl_macro_tmp_260;
+  chpl_macro_tmp_261.locale = (&call_tmp11)->locale;
+  chpl_macro_tmp_261.addr = chpl_wide_array_alloc(chpl_nodeFromLocaleID(&((&call_tmp11)->locale), INT64(0), NULL), call_tmp9, sizeof(chpl____wide_locale), _ln, _fn);
+  call_tmp11 = chpl_macro_tmp_261;
+  init_elts(&call_tmp11, call_tmp9, _ln, _fn);
+  *(call_tmp10) = call_tmp11;
+  chpl_check_nil(this6, INT64(811), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  ret7 = (this6)->dom;
+  chpl_check_nil((&ret7)->addr, INT64(811), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  call_tmp12 = dsiNumIndices(&ret7, _ln, _fn);
+  call_tmp13 = (call_tmp12 > INT64(0));
+  if (call_tmp13) {
+    chpl_check_nil(this6, INT64(811), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    call_tmp14 = &((this6)->shiftedData);
+    chpl_check_nil(this6, INT64(811), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    ret8 = (this6)->data;
+    chpl_check_nil(this6, INT64(811), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    ret9 = (this6)->origin;
+    chpl_check_nil(this6, INT64(811), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    ret10 = (this6)->factoredOffs;
+    call_tmp15 = (ret9 - ret10);
+    T3 = ((_ddata_locale)(nil));
+    chpl_macro_tmp_262.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_262.addr = T3;
+    call_tmp16 = chpl_macro_tmp_262;
+    chpl_macro_tmp_263.locale = (&ret8)->locale;
+    chpl_macro_tmp_263.addr = ((&ret8)->addr + call_tmp15);
+    call_tmp16 = chpl_macro_tmp_263;
+    *(call_tmp14) = call_tmp16;
+  }
+  _end_initialize:;
+  return;
+}
+
+/* DefaultRectangular.chpl:796 */
+static void initialize4(DefaultRectangularArr_localesSignal_1_int64_t_F this6, int64_t _ln, c_string _fn) {
+  chpl_bool ret;
+  chpl_bool call_tmp;
+  chpl____wide__ref_int64_t call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref__tuple_1_star_int64_t _this_tmp_ = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  range_int64_t_bounded_F call_tmp3;
+  _ref_range_int64_t_bounded_F ret_to_arg_ref_tmp_ = NULL;
+  int64_t ret3;
+  int64_t ret4;
+  chpl____wide__ref_int64_t call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref__tuple_1_star_int64_t _this_tmp_2 = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret5 = {CHPL_LOCALEID_T_INIT, NULL};
+  range_int64_t_bounded_F call_tmp5;
+  _ref_range_int64_t_bounded_F ret_to_arg_ref_tmp_2 = NULL;
+  chpl____wide__ref_int64_t call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref__tuple_1_star_int64_t _this_tmp_3 = NULL;
+  int64_t ret_x1;
+  _ref__tuple_1_star_int64_t ret_ = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret6 = {CHPL_LOCALEID_T_INIT, NULL};
+  range_int64_t_bounded_F call_tmp7;
+  _ref_range_int64_t_bounded_F ret_to_arg_ref_tmp_3 = NULL;
+  int64_t call_tmp8;
+  _ref_range_int64_t_bounded_F _ref_tmp_ = NULL;
+  chpl____wide__ref_range_int64_t_bounded_F T = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp9;
+  _ref__ddata_localesSignal call_tmp10 = NULL;
+  chpl____wide_localesSignal _formal_type_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_localesSignal call_tmp11 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ddata_localesSignal T2 = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret7 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp12;
+  chpl_bool call_tmp13;
+  _ref__ddata_localesSignal call_tmp14 = NULL;
+  chpl____wide__ddata_localesSignal ret8 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t ret9;
+  int64_t ret10;
+  int64_t call_tmp15;
+  chpl____wide__ddata_localesSignal call_tmp16 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ddata_localesSignal T3 = NULL;
+  chpl____wide__ref_int64_t chpl_macro_tmp_264;
+  chpl____wide__ref_int64_t chpl_macro_tmp_265;
+  int64_t chpl_macro_tmp_266;
+  chpl____wide__ref_int64_t chpl_macro_tmp_267;
+  int64_t chpl_macro_tmp_268;
+  chpl____wide__ref_range_int64_t_bounded_F chpl_macro_tmp_269;
+  chpl____wide__ddata_localesSignal chpl_macro_tmp_270;
+  chpl____wide__ddata_localesSignal chpl_macro_tmp_271;
+  chpl____wide__ddata_localesSignal chpl_macro_tmp_272;
+  chpl____wide__ddata_localesSignal chpl_macro_tmp_273;
+  chpl_check_nil(this6, INT64(797), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  ret = (this6)->noinit_data;
+  call_tmp = (ret == true);
+  if (call_tmp) {
+    goto _end_initialize;
+  }
+  chpl_check_nil(this6, INT64(799), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  _this_tmp_ = &((this6)->off);
+  chpl_macro_tmp_264.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_264.addr = (*(_this_tmp_) + INT64(0));
+  call_tmp2 = chpl_macro_tmp_264;
+  chpl_check_nil(this6, INT64(799), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  ret2 = (this6)->dom;
+  ret_to_arg_ref_tmp_ = &call_tmp3;
+  chpl_check_nil((&ret2)->addr, INT64(799), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  dsiDim(&ret2, ret_to_arg_ref_tmp_, _ln, _fn);
+  ret4 = (&call_tmp3)->_low;
+  ret3 = ret4;
+  goto _end_alignedLow;
+  _end_alignedLow:;
+  chpl_gen_comm_put(((void*)(&ret3)), chpl_nodeFromLocaleID(&((call_tmp2).locale), INT64(0), NULL), (call_tmp2).addr, sizeof(int64_t), -1, INT64(1), INT64(799), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_check_nil(this6, INT64(800), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  _this_tmp_2 = &((this6)->str);
+  chpl_macro_tmp_265.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_265.addr = (*(_this_tmp_2) + INT64(0));
+  call_tmp4 = chpl_macro_tmp_265;
+  chpl_check_nil(this6, INT64(800), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  ret5 = (this6)->dom;
+  ret_to_arg_ref_tmp_2 = &call_tmp5;
+  chpl_check_nil((&ret5)->addr, INT64(800), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  dsiDim(&ret5, ret_to_arg_ref_tmp_2, _ln, _fn);
+  chpl_macro_tmp_266 = INT64(1);
+  chpl_gen_comm_put(((void*)(&chpl_macro_tmp_266)), chpl_nodeFromLocaleID(&((call_tmp4).locale), INT64(0), NULL), (call_tmp4).addr, sizeof(int64_t), -1, INT64(1), INT64(800), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_check_nil(this6, INT64(802), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  _this_tmp_3 = &((this6)->blk);
+  chpl_macro_tmp_267.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_267.addr = (*(_this_tmp_3) + INT64(0));
+  call_tmp6 = chpl_macro_tmp_267;
+  chpl_macro_tmp_268 = INT64(1);
+  chpl_gen_comm_put(((void*)(&chpl_macro_tmp_268)), chpl_nodeFromLocaleID(&((call_tmp6).locale), INT64(0), NULL), (call_tmp6).addr, sizeof(int64_t), -1, INT64(1), INT64(802), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_check_nil(this6, INT64(805), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  computeFactoredOffs2(this6, _ln, _fn);
+  chpl_check_nil(this6, INT64(806), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  ret_ = &((this6)->blk);
+  ret_x1 = *(*(ret_) + INT64(0));
+  chpl_check_nil(this6, INT64(806), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  ret6 = (this6)->dom;
+  ret_to_arg_ref_tmp_3 = &call_tmp7;
+  chpl_check_nil((&ret6)->addr, INT64(806), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  dsiDim(&ret6, ret_to_arg_ref_tmp_3, _ln, _fn);
+  _ref_tmp_ = &call_tmp7;
+  chpl_macro_tmp_269.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_269.addr = _ref_tmp_;
+  T = chpl_macro_tmp_269;
+  call_tmp8 = length(&T, _ln, _fn);
+  call_tmp9 = (ret_x1 * call_tmp8);
+  chpl_check_nil(this6, INT64(810), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  call_tmp10 = &((this6)->data);
+  T2 = ((_ddata_localesSignal)(nil));
+  chpl_macro_tmp_270.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_270.addr = T2;
+  call_tmp11 = chpl_macro_tmp_270;
+  chpl_macro_tmp_271.locale = (&call_tmp11)->locale;
+  chpl_macro_tmp_271.addr = chpl_wide_array_alloc(chpl_nodeFromLocaleID(&((&call_tmp11)->locale), INT64(0), NULL), call_tmp9, sizeof(chpl____wide_localesSignal), _ln, _fn);
+  call_tmp11 = chpl_macro_tmp_271;
+  init_elts2(&call_tmp11, call_tmp9, _ln, _fn);
+  *(call_tmp10) = call_tmp11;
+  chpl_check_nil(this6, INT64(811), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  ret7 = (this6)->dom;
+  chpl_check_nil((&ret7)->addr, INT64(811), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  call_tmp12 = dsiNumIndices(&ret7, _ln, _fn);
+  call_tmp13 = (call_tmp12 > INT64(0));
+  if (call_tmp13) {
+    chpl_check_nil(this6, INT64(811), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    call_tmp14 = &((this6)->shiftedData);
+    chpl_check_nil(this6, INT64(811), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    ret8 = (this6)->data;
+    chpl_check_nil(this6, INT64(811), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    ret9 = (this6)->origin;
+    chpl_check_nil(this6, INT64(811), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    ret10 = (this6)->factoredOffs;
+    call_tmp15 = (ret9 - ret10);
+    T3 = ((_ddata_localesSignal)(nil));
+    chpl_macro_tmp_272.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_272.addr = T3;
+    call_tmp16 = chpl_macro_tmp_272;
+    chpl_macro_tmp_273.locale = (&ret8)->locale;
+    chpl_macro_tmp_273.addr = ((&ret8)->addr + call_tmp15);
+    call_tmp16 = chpl_macro_tmp_273;
+    *(call_tmp14) = call_tmp16;
+  }
+  _end_initialize:;
+  return;
+}
+
+/* DefaultRectangular.chpl:959 */
+static void dsiReallocate2(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const this6, chpl____wide_DefaultRectangularDom_1_int64_t_F* const d, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F copy = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  DefaultRectangularArr_locale_1_int64_t_F this7 = NULL;
+  int64_t call_tmp;
+  chpl_opaque cast_tmp;
+  DefaultRectangularArr_locale_1_int64_t_F T = NULL;
+  DefaultRectangularDom_1_int64_t_F T2 = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  _tuple_1_star_int64_t _init_class_tmp_;
+  _tuple_1_star_int64_t _init_class_tmp_2;
+  _tuple_1_star_int64_t _init_class_tmp_3;
+  _ddata_locale T4 = NULL;
+  chpl____wide__ddata_locale T5 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ddata_locale T6 = NULL;
+  chpl____wide__ddata_locale T7 = {CHPL_LOCALEID_T_INIT, NULL};
+  atomic_refcnt this8;
+  atomic_int64 _init_class_tmp_4;
+  atomic_int64 this9;
+  atomic_int_least64_t ret2;
+  atomic_int_least64_t type_tmp;
+  _ref_atomic_int_least64_t _ref_tmp_ = NULL;
+  _ref_atomic_int_least64_t T8 = NULL;
+  atomic_int64 wrap_call_tmp;
+  atomic_refcnt wrap_call_tmp2;
+  BaseArr call_tmp2 = NULL;
+  BaseArr T9 = NULL;
+  _tuple_1_star_int64_t this10;
+  _tuple_1_star_int64_t this11;
+  _tuple_1_star_int64_t this12;
+  _ddata_locale call_tmp3 = NULL;
+  _ddata_locale T10 = NULL;
+  chpl____wide__ddata_locale T11 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ddata_locale call_tmp4 = NULL;
+  _ddata_locale T12 = NULL;
+  chpl____wide__ddata_locale T13 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool x2;
+  _ref_chpl_bool _ref_tmp_2 = NULL;
+  DefaultRectangularArr_locale_1_int64_t_F wrap_call_tmp3 = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F coerce_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  range_int64_t_bounded_F ret_x1;
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F ret_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultRectangularDom_1_int64_t_F ret_to_arg_ref_tmp_ = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret4 = {CHPL_LOCALEID_T_INIT, NULL};
+  _tuple_1_star_int64_t default_argoffset;
+  _ref__tuple_1_star_int64_t ret_to_arg_ref_tmp_2 = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F this13 = {CHPL_LOCALEID_T_INIT, NULL};
+  range_int64_t_bounded_F ret_x12;
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F ret_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  range_int64_t_bounded_F _ic__F0_this;
+  _ref_range_int64_t_bounded_F this14 = NULL;
+  int64_t i;
+  int64_t ret5;
+  int64_t end;
+  int64_t ret6;
+  int64_t i2;
+  _tuple_1_star_int64_t ind;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret7 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F coerce_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool ret8;
+  chpl____wide__ref_range_int64_t_bounded_F call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F call_tmp7 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t coerce_tmp3;
+  chpl_bool ret9;
+  int64_t ret10;
+  chpl_bool call_tmp8;
+  int64_t ret11;
+  chpl_bool call_tmp9;
+  chpl_bool call_tmp10;
+  chpl_bool call_tmp11;
+  chpl____wide_chpl_string call_tmp12 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t sum;
+  int64_t ret_x13;
+  chpl____wide__ref__tuple_1_star_int64_t ret_3 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t coerce_tmp4;
+  int64_t call_tmp13;
+  chpl____wide__ddata_locale ret12 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_locale coerce_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_locale call_tmp14 = {CHPL_LOCALEID_T_INIT, NULL};
+  _tuple_1_star_int64_t ind2;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret13 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F coerce_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool ret14;
+  chpl____wide__ref_range_int64_t_bounded_F call_tmp15 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F call_tmp16 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t coerce_tmp7;
+  chpl_bool ret15;
+  int64_t ret16;
+  chpl_bool call_tmp17;
+  int64_t ret17;
+  chpl_bool call_tmp18;
+  chpl_bool call_tmp19;
+  chpl_bool call_tmp20;
+  chpl____wide_chpl_string call_tmp21 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t sum2;
+  int64_t ret_x14;
+  chpl____wide__ref__tuple_1_star_int64_t ret_4 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t coerce_tmp8;
+  int64_t call_tmp22;
+  chpl____wide__ddata_locale ret18 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_locale coerce_tmp9 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_locale ret19 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_locale call_tmp23 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref__tuple_1_star_int64_t call_tmp24 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t ret_x15;
+  chpl____wide__ref__tuple_1_star_int64_t ret_5 = {CHPL_LOCALEID_T_INIT, NULL};
+  _tuple_1_star_int64_t coerce_tmp10;
+  chpl____wide__ref__tuple_1_star_int64_t call_tmp25 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t ret_x16;
+  chpl____wide__ref__tuple_1_star_int64_t ret_6 = {CHPL_LOCALEID_T_INIT, NULL};
+  _tuple_1_star_int64_t coerce_tmp11;
+  chpl____wide__ref__tuple_1_star_int64_t call_tmp26 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t ret_x17;
+  chpl____wide__ref__tuple_1_star_int64_t ret_7 = {CHPL_LOCALEID_T_INIT, NULL};
+  _tuple_1_star_int64_t coerce_tmp12;
+  chpl____wide__ref_int64_t call_tmp27 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t ret20;
+  chpl____wide__ref_int64_t call_tmp28 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t ret21;
+  chpl____wide__ref__ddata_locale call_tmp29 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_locale ret22 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp30;
+  chpl_bool call_tmp31;
+  chpl____wide__ref__ddata_locale call_tmp32 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_locale ret23 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseArr _parent_destructor_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_refcnt _field_destructor_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 _field_destructor_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int_least64_t call_tmp33 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_int_least64_t T14 = NULL;
+  chpl_localeID_t call_tmp34;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn34 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_274;
+  chpl____wide__ddata_locale chpl_macro_tmp_275;
+  chpl____wide__ddata_locale chpl_macro_tmp_276;
+  chpl____wide__ddata_locale chpl_macro_tmp_277;
+  chpl____wide__ddata_locale chpl_macro_tmp_278;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F chpl_macro_tmp_279;
+  chpl____wide__ref_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_280;
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F chpl_macro_tmp_281;
+  chpl____wide__ref_range_int64_t_bounded_F chpl_macro_tmp_282;
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F chpl_macro_tmp_283;
+  chpl____wide__ref_range_int64_t_bounded_F chpl_macro_tmp_284;
+  chpl____wide__ref_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_285;
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F chpl_macro_tmp_286;
+  chpl____wide__ref_range_int64_t_bounded_F chpl_macro_tmp_287;
+  chpl____wide__ref_int64_t chpl_macro_tmp_288;
+  chpl____wide__ref__tuple_1_star_int64_t chpl_macro_tmp_289;
+  chpl____wide__ref__ddata_locale chpl_macro_tmp_290;
+  chpl____wide__ref__tuple_1_star_int64_t chpl_macro_tmp_291;
+  chpl____wide__ref__ddata_locale chpl_macro_tmp_292;
+  chpl____wide__ref_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_293;
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F chpl_macro_tmp_294;
+  chpl____wide__ref_range_int64_t_bounded_F chpl_macro_tmp_295;
+  chpl____wide__ref_int64_t chpl_macro_tmp_296;
+  chpl____wide__ref_int64_t chpl_macro_tmp_297;
+  chpl____wide__ref_locale chpl_macro_tmp_298;
+  chpl____wide__ref_int64_t chpl_macro_tmp_299;
+  chpl____wide__ref_int64_t chpl_macro_tmp_300;
+  chpl____wide__ref_int64_t chpl_macro_tmp_301;
+  chpl____wide__ref_locale chpl_macro_tmp_302;
+  chpl____wide__ref__tuple_1_star_int64_t chpl_macro_tmp_303;
+  chpl____wide__ref__tuple_1_star_int64_t chpl_macro_tmp_304;
+  chpl____wide__ref_int64_t chpl_macro_tmp_305;
+  chpl____wide__ref__tuple_1_star_int64_t chpl_macro_tmp_306;
+  chpl____wide__ref__tuple_1_star_int64_t chpl_macro_tmp_307;
+  chpl____wide__ref_int64_t chpl_macro_tmp_308;
+  chpl____wide__ref__tuple_1_star_int64_t chpl_macro_tmp_309;
+  chpl____wide__ref__tuple_1_star_int64_t chpl_macro_tmp_310;
+  chpl____wide__ref_int64_t chpl_macro_tmp_311;
+  chpl____wide__ref_int64_t chpl_macro_tmp_312;
+  chpl____wide__ref_int64_t chpl_macro_tmp_313;
+  chpl____wide__ref_int64_t chpl_macro_tmp_314;
+  chpl____wide__ref_int64_t chpl_macro_tmp_315;
+  chpl____wide__ref__ddata_locale chpl_macro_tmp_316;
+  chpl____wide__ref__ddata_locale chpl_macro_tmp_317;
+  chpl____wide__ref__ddata_locale chpl_macro_tmp_318;
+  chpl____wide__ref__ddata_locale chpl_macro_tmp_319;
+  chpl____wide_BaseArr chpl_macro_tmp_320;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_321;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_322;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_323;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_324;
+  ret = *(d);
+  call_tmp = sizeof(chpl_DefaultRectangularArr_locale_1_int64_t_F_object);
+  cast_tmp = chpl_here_alloc(call_tmp, INT16(8), _ln, _fn);
+  T = ((DefaultRectangularArr_locale_1_int64_t_F)(cast_tmp));
+  this7 = T;
+  ((object)(this7))->chpl__cid = chpl__cid_DefaultRectangularArr_locale_1_int64_t_F;
+  T2 = nil;
+  chpl_macro_tmp_274.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_274.addr = T2;
+  T3 = chpl_macro_tmp_274;
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->dom = T3;
+  *(_init_class_tmp_ + INT64(0)) = INT64(0);
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this7)->off + INT64(0)) = *(_init_class_tmp_ + INT64(0));
+  *(_init_class_tmp_2 + INT64(0)) = INT64(0);
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this7)->blk + INT64(0)) = *(_init_class_tmp_2 + INT64(0));
+  *(_init_class_tmp_3 + INT64(0)) = INT64(0);
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this7)->str + INT64(0)) = *(_init_class_tmp_3 + INT64(0));
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->origin = INT64(0);
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->factoredOffs = INT64(0);
+  T4 = nil;
+  chpl_macro_tmp_275.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_275.addr = T4;
+  T5 = chpl_macro_tmp_275;
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->data = T5;
+  T6 = nil;
+  chpl_macro_tmp_276.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_276.addr = T6;
+  T7 = chpl_macro_tmp_276;
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->shiftedData = T7;
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->noinit_data = false;
+  (&this8)->_cnt = _init_class_tmp_4;
+  ret2 = type_tmp;
+  _ref_tmp_ = &ret2;
+  T8 = _ref_tmp_;
+  atomic_init_int_least64_t(T8, INT64(0));
+  _ref_tmp_ = T8;
+  (&this9)->_v = ret2;
+  wrap_call_tmp = _construct_atomic_int64(ret2, &this9, _ln, _fn);
+  (&this8)->_cnt = wrap_call_tmp;
+  wrap_call_tmp2 = _construct_atomic_refcnt(&wrap_call_tmp, &this8, _ln, _fn);
+  T9 = ((BaseArr)(nil));
+  call_tmp2 = T9;
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->dom = ret;
+  *(this10 + INT64(0)) = INT64(0);
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this7)->off + INT64(0)) = *(this10 + INT64(0));
+  *(this11 + INT64(0)) = INT64(0);
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this7)->blk + INT64(0)) = *(this11 + INT64(0));
+  *(this12 + INT64(0)) = INT64(0);
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this7)->str + INT64(0)) = *(this12 + INT64(0));
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->origin = INT64(0);
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->factoredOffs = INT64(0);
+  T10 = ((_ddata_locale)(nil));
+  call_tmp3 = T10;
+  chpl_macro_tmp_277.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_277.addr = call_tmp3;
+  T11 = chpl_macro_tmp_277;
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->data = T11;
+  T12 = ((_ddata_locale)(nil));
+  call_tmp4 = T12;
+  chpl_macro_tmp_278.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_278.addr = call_tmp4;
+  T13 = chpl_macro_tmp_278;
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->shiftedData = T13;
+  x2 = false;
+  _ref_tmp_2 = &x2;
+  *(_ref_tmp_2) = false;
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->noinit_data = x2;
+  wrap_call_tmp3 = _construct_DefaultRectangularArr(&wrap_call_tmp2, call_tmp2, &ret, &this10, &this11, &this12, INT64(0), INT64(0), call_tmp3, call_tmp4, x2, this7, _ln, _fn);
+  chpl_macro_tmp_279.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_279.addr = wrap_call_tmp3;
+  copy = chpl_macro_tmp_279;
+  chpl_check_nil((this6)->addr, INT64(965), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_280.locale = (this6)->locale;
+  chpl_macro_tmp_280.addr = &(((this6)->addr)->dom);
+  chpl_gen_comm_get(((void*)(&ret3)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_280).locale), INT64(0), NULL), (chpl_macro_tmp_280).addr, sizeof(chpl____wide_DefaultRectangularDom_1_int64_t_F), -1, INT64(1), INT64(965), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  coerce_tmp = ret3;
+  chpl_check_nil((&coerce_tmp)->addr, INT64(965), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_281.locale = (&coerce_tmp)->locale;
+  chpl_macro_tmp_281.addr = &(((&coerce_tmp)->addr)->ranges);
+  ret_ = chpl_macro_tmp_281;
+  chpl_macro_tmp_282.locale = (ret_).locale;
+  chpl_macro_tmp_282.addr = (*((ret_).addr) + INT64(0));
+  chpl_gen_comm_get(((void*)(&ret_x1)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_282).locale), INT64(0), NULL), (chpl_macro_tmp_282).addr, sizeof(range_int64_t_bounded_F), -1, INT64(1), INT64(965), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  ret_to_arg_ref_tmp_ = &call_tmp5;
+  chpl_check_nil((d)->addr, INT64(965), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  this2(d, &ret_x1, ret_to_arg_ref_tmp_, _ln, _fn);
+  ret4 = call_tmp5;
+  ret_to_arg_ref_tmp_2 = &default_argoffset;
+  createTuple(INT64(0), ret_to_arg_ref_tmp_2, _ln, _fn);
+  this13 = ret4;
+  chpl_check_nil((&this13)->addr, INT64(965), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_283.locale = (&this13)->locale;
+  chpl_macro_tmp_283.addr = &(((&this13)->addr)->ranges);
+  ret_2 = chpl_macro_tmp_283;
+  chpl_macro_tmp_284.locale = (ret_2).locale;
+  chpl_macro_tmp_284.addr = (*((ret_2).addr) + INT64(0));
+  chpl_gen_comm_get(((void*)(&ret_x12)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_284).locale), INT64(0), NULL), (chpl_macro_tmp_284).addr, sizeof(range_int64_t_bounded_F), -1, INT64(1), INT64(965), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  _ic__F0_this = ret_x12;
+  this14 = &_ic__F0_this;
+  checkIfIterWillOverflow(this14, true, _ln, _fn);
+  ret5 = (&_ic__F0_this)->_low;
+  ret6 = (&_ic__F0_this)->_high;
+  end = ret6;
+  chpl_check_nil((&copy)->addr, INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_285.locale = (&copy)->locale;
+  chpl_macro_tmp_285.addr = &(((&copy)->addr)->dom);
+  chpl_gen_comm_get(((void*)(&ret7)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_285).locale), INT64(0), NULL), (chpl_macro_tmp_285).addr, sizeof(chpl____wide_DefaultRectangularDom_1_int64_t_F), -1, INT64(1), INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  coerce_tmp2 = ret7;
+  chpl_check_nil((&coerce_tmp2)->addr, INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_286.locale = (&coerce_tmp2)->locale;
+  chpl_macro_tmp_286.addr = &(((&coerce_tmp2)->addr)->ranges);
+  call_tmp7 = chpl_macro_tmp_286;
+  chpl_macro_tmp_287.locale = (call_tmp7).locale;
+  chpl_macro_tmp_287.addr = (*((call_tmp7).addr) + INT64(0));
+  call_tmp6 = chpl_macro_tmp_287;
+  chpl_macro_tmp_288.locale = (call_tmp6).locale;
+  chpl_macro_tmp_288.addr = &(((call_tmp6).addr)->_high);
+  chpl_gen_comm_get(((void*)(&ret10)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_288).locale), INT64(0), NULL), (chpl_macro_tmp_288).addr, sizeof(int64_t), -1, INT64(1), INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_check_nil((this6)->addr, INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_289.locale = (this6)->locale;
+  chpl_macro_tmp_289.addr = &(((this6)->addr)->blk);
+  ret_4 = chpl_macro_tmp_289;
+  chpl_check_nil((this6)->addr, INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_290.locale = (this6)->locale;
+  chpl_macro_tmp_290.addr = &(((this6)->addr)->shiftedData);
+  chpl_gen_comm_get(((void*)(&ret18)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_290).locale), INT64(0), NULL), (chpl_macro_tmp_290).addr, sizeof(chpl____wide__ddata_locale), -1, INT64(1), INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  coerce_tmp9 = ret18;
+  chpl_check_nil((&copy)->addr, INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_291.locale = (&copy)->locale;
+  chpl_macro_tmp_291.addr = &(((&copy)->addr)->blk);
+  ret_3 = chpl_macro_tmp_291;
+  chpl_check_nil((&copy)->addr, INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_292.locale = (&copy)->locale;
+  chpl_macro_tmp_292.addr = &(((&copy)->addr)->shiftedData);
+  chpl_gen_comm_get(((void*)(&ret12)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_292).locale), INT64(0), NULL), (chpl_macro_tmp_292).addr, sizeof(chpl____wide__ddata_locale), -1, INT64(1), INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  coerce_tmp5 = ret12;
+  chpl_check_nil((this6)->addr, INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_293.locale = (this6)->locale;
+  chpl_macro_tmp_293.addr = &(((this6)->addr)->dom);
+  chpl_gen_comm_get(((void*)(&ret13)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_293).locale), INT64(0), NULL), (chpl_macro_tmp_293).addr, sizeof(chpl____wide_DefaultRectangularDom_1_int64_t_F), -1, INT64(1), INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  coerce_tmp6 = ret13;
+  chpl_check_nil((&coerce_tmp6)->addr, INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_294.locale = (&coerce_tmp6)->locale;
+  chpl_macro_tmp_294.addr = &(((&coerce_tmp6)->addr)->ranges);
+  call_tmp16 = chpl_macro_tmp_294;
+  chpl_macro_tmp_295.locale = (call_tmp16).locale;
+  chpl_macro_tmp_295.addr = (*((call_tmp16).addr) + INT64(0));
+  call_tmp15 = chpl_macro_tmp_295;
+  for (i = ret5; ((i <= end)); i += INT64(1)) {
+    i2 = i;
+    *(ind + INT64(0)) = i;
+    coerce_tmp3 = *(ind + INT64(0));
+    call_tmp8 = (coerce_tmp3 > ret10);
+    if (call_tmp8) {
+      ret9 = false;
+      goto _end_member;
+    }
+    chpl_macro_tmp_296.locale = (call_tmp6).locale;
+    chpl_macro_tmp_296.addr = &(((call_tmp6).addr)->_low);
+    chpl_gen_comm_get(((void*)(&ret11)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_296).locale), INT64(0), NULL), (chpl_macro_tmp_296).addr, sizeof(int64_t), -1, INT64(1), INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    call_tmp9 = (coerce_tmp3 < ret11);
+    if (call_tmp9) {
+      ret9 = false;
+      goto _end_member;
+    }
+    ret9 = true;
+    _end_member:;
+    call_tmp10 = (! ret9);
+    if (call_tmp10) {
+      ret8 = false;
+      goto _end_dsiMember;
+    }
+    ret8 = true;
+    _end_dsiMember:;
+    call_tmp11 = (! ret8);
+    if (call_tmp11) {
+      wide_string_from_c_string(&call_tmp12, "array index out of bounds: ", INT64(0), INT64(0), _ln, _fn);
+      halt2(call_tmp12, &ind, _ln, _fn);
+    }
+    sum = INT64(0);
+    chpl_macro_tmp_297.locale = (ret_3).locale;
+    chpl_macro_tmp_297.addr = (*((ret_3).addr) + INT64(0));
+    chpl_gen_comm_get(((void*)(&ret_x13)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_297).locale), INT64(0), NULL), (chpl_macro_tmp_297).addr, sizeof(int64_t), -1, INT64(1), INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    coerce_tmp4 = *(ind + INT64(0));
+    call_tmp13 = (coerce_tmp4 * ret_x13);
+    sum += call_tmp13;
+    chpl_macro_tmp_298.locale = (&coerce_tmp5)->locale;
+    chpl_macro_tmp_298.addr = ((&coerce_tmp5)->addr + sum);
+    call_tmp14 = chpl_macro_tmp_298;
+    *(ind2 + INT64(0)) = i2;
+    coerce_tmp7 = *(ind2 + INT64(0));
+    chpl_macro_tmp_299.locale = (call_tmp15).locale;
+    chpl_macro_tmp_299.addr = &(((call_tmp15).addr)->_high);
+    chpl_gen_comm_get(((void*)(&ret16)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_299).locale), INT64(0), NULL), (chpl_macro_tmp_299).addr, sizeof(int64_t), -1, INT64(1), INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    call_tmp17 = (coerce_tmp7 > ret16);
+    if (call_tmp17) {
+      ret15 = false;
+      goto _end_member2;
+    }
+    chpl_macro_tmp_300.locale = (call_tmp15).locale;
+    chpl_macro_tmp_300.addr = &(((call_tmp15).addr)->_low);
+    chpl_gen_comm_get(((void*)(&ret17)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_300).locale), INT64(0), NULL), (chpl_macro_tmp_300).addr, sizeof(int64_t), -1, INT64(1), INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    call_tmp18 = (coerce_tmp7 < ret17);
+    if (call_tmp18) {
+      ret15 = false;
+      goto _end_member2;
+    }
+    ret15 = true;
+    _end_member2:;
+    call_tmp19 = (! ret15);
+    if (call_tmp19) {
+      ret14 = false;
+      goto _end_dsiMember2;
+    }
+    ret14 = true;
+    _end_dsiMember2:;
+    call_tmp20 = (! ret14);
+    if (call_tmp20) {
+      wide_string_from_c_string(&call_tmp21, "array index out of bounds: ", INT64(0), INT64(0), _ln, _fn);
+      halt2(call_tmp21, &ind2, _ln, _fn);
+    }
+    sum2 = INT64(0);
+    chpl_macro_tmp_301.locale = (ret_4).locale;
+    chpl_macro_tmp_301.addr = (*((ret_4).addr) + INT64(0));
+    chpl_gen_comm_get(((void*)(&ret_x14)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_301).locale), INT64(0), NULL), (chpl_macro_tmp_301).addr, sizeof(int64_t), -1, INT64(1), INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    coerce_tmp8 = *(ind2 + INT64(0));
+    call_tmp22 = (coerce_tmp8 * ret_x14);
+    sum2 += call_tmp22;
+    chpl_macro_tmp_302.locale = (&coerce_tmp9)->locale;
+    chpl_macro_tmp_302.addr = ((&coerce_tmp9)->addr + sum2);
+    call_tmp23 = chpl_macro_tmp_302;
+    chpl_gen_comm_get(((void*)(&ret19)), chpl_nodeFromLocaleID(&((call_tmp23).locale), INT64(0), NULL), (call_tmp23).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    chpl_gen_comm_put(((void*)(&ret19)), chpl_nodeFromLocaleID(&((call_tmp14).locale), INT64(0), NULL), (call_tmp14).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  }
+  chpl__autoDestroy2(&call_tmp5, _ln, _fn);
+  chpl_check_nil((this6)->addr, INT64(967), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_303.locale = (this6)->locale;
+  chpl_macro_tmp_303.addr = &(((this6)->addr)->off);
+  call_tmp24 = chpl_macro_tmp_303;
+  chpl_check_nil((&copy)->addr, INT64(967), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_304.locale = (&copy)->locale;
+  chpl_macro_tmp_304.addr = &(((&copy)->addr)->off);
+  ret_5 = chpl_macro_tmp_304;
+  chpl_macro_tmp_305.locale = (ret_5).locale;
+  chpl_macro_tmp_305.addr = (*((ret_5).addr) + INT64(0));
+  chpl_gen_comm_get(((void*)(&ret_x15)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_305).locale), INT64(0), NULL), (chpl_macro_tmp_305).addr, sizeof(int64_t), -1, INT64(1), INT64(967), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *(coerce_tmp10 + INT64(0)) = ret_x15;
+  chpl_gen_comm_put(((void*)(&coerce_tmp10)), chpl_nodeFromLocaleID(&((call_tmp24).locale), INT64(0), NULL), (call_tmp24).addr, sizeof(_tuple_1_star_int64_t), -1, INT64(1), INT64(967), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_check_nil((this6)->addr, INT64(968), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_306.locale = (this6)->locale;
+  chpl_macro_tmp_306.addr = &(((this6)->addr)->blk);
+  call_tmp25 = chpl_macro_tmp_306;
+  chpl_check_nil((&copy)->addr, INT64(968), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_307.locale = (&copy)->locale;
+  chpl_macro_tmp_307.addr = &(((&copy)->addr)->blk);
+  ret_6 = chpl_macro_tmp_307;
+  chpl_macro_tmp_308.locale = (ret_6).locale;
+  chpl_macro_tmp_308.addr = (*((ret_6).addr) + INT64(0));
+  chpl_gen_comm_get(((void*)(&ret_x16)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_308).locale), INT64(0), NULL), (chpl_macro_tmp_308).addr, sizeof(int64_t), -1, INT64(1), INT64(968), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *(coerce_tmp11 + INT64(0)) = ret_x16;
+  chpl_gen_comm_put(((void*)(&coerce_tmp11)), chpl_nodeFromLocaleID(&((call_tmp25).locale), INT64(0), NULL), (call_tmp25).addr, sizeof(_tuple_1_star_int64_t), -1, INT64(1), INT64(968), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_check_nil((this6)->addr, INT64(969), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_309.locale = (this6)->locale;
+  chpl_macro_tmp_309.addr = &(((this6)->addr)->str);
+  call_tmp26 = chpl_macro_tmp_309;
+  chpl_check_nil((&copy)->addr, INT64(969), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_310.locale = (&copy)->locale;
+  chpl_macro_tmp_310.addr = &(((&copy)->addr)->str);
+  ret_7 = chpl_macro_tmp_310;
+  chpl_macro_tmp_311.locale = (ret_7).locale;
+  chpl_macro_tmp_311.addr = (*((ret_7).addr) + INT64(0));
+  chpl_gen_comm_get(((void*)(&ret_x17)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_311).locale), INT64(0), NULL), (chpl_macro_tmp_311).addr, sizeof(int64_t), -1, INT64(1), INT64(969), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *(coerce_tmp12 + INT64(0)) = ret_x17;
+  chpl_gen_comm_put(((void*)(&coerce_tmp12)), chpl_nodeFromLocaleID(&((call_tmp26).locale), INT64(0), NULL), (call_tmp26).addr, sizeof(_tuple_1_star_int64_t), -1, INT64(1), INT64(969), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_check_nil((this6)->addr, INT64(970), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_312.locale = (this6)->locale;
+  chpl_macro_tmp_312.addr = &(((this6)->addr)->origin);
+  call_tmp27 = chpl_macro_tmp_312;
+  chpl_check_nil((&copy)->addr, INT64(970), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_313.locale = (&copy)->locale;
+  chpl_macro_tmp_313.addr = &(((&copy)->addr)->origin);
+  chpl_gen_comm_get(((void*)(&ret20)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_313).locale), INT64(0), NULL), (chpl_macro_tmp_313).addr, sizeof(int64_t), -1, INT64(1), INT64(970), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_gen_comm_put(((void*)(&ret20)), chpl_nodeFromLocaleID(&((call_tmp27).locale), INT64(0), NULL), (call_tmp27).addr, sizeof(int64_t), -1, INT64(1), INT64(970), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_check_nil((this6)->addr, INT64(971), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_314.locale = (this6)->locale;
+  chpl_macro_tmp_314.addr = &(((this6)->addr)->factoredOffs);
+  call_tmp28 = chpl_macro_tmp_314;
+  chpl_check_nil((&copy)->addr, INT64(971), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_315.locale = (&copy)->locale;
+  chpl_macro_tmp_315.addr = &(((&copy)->addr)->factoredOffs);
+  chpl_gen_comm_get(((void*)(&ret21)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_315).locale), INT64(0), NULL), (chpl_macro_tmp_315).addr, sizeof(int64_t), -1, INT64(1), INT64(971), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_gen_comm_put(((void*)(&ret21)), chpl_nodeFromLocaleID(&((call_tmp28).locale), INT64(0), NULL), (call_tmp28).addr, sizeof(int64_t), -1, INT64(1), INT64(971), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_check_nil((this6)->addr, INT64(972), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  dsiDestroyData2(this6, _ln, _fn);
+  chpl_check_nil((this6)->addr, INT64(973), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_316.locale = (this6)->locale;
+  chpl_macro_tmp_316.addr = &(((this6)->addr)->data);
+  call_tmp29 = chpl_macro_tmp_316;
+  chpl_check_nil((&copy)->addr, INT64(973), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_317.locale = (&copy)->locale;
+  chpl_macro_tmp_317.addr = &(((&copy)->addr)->data);
+  chpl_gen_comm_get(((void*)(&ret22)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_317).locale), INT64(0), NULL), (chpl_macro_tmp_317).addr, sizeof(chpl____wide__ddata_locale), -1, INT64(1), INT64(973), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_gen_comm_put(((void*)(&ret22)), chpl_nodeFromLocaleID(&((call_tmp29).locale), INT64(0), NULL), (call_tmp29).addr, sizeof(chpl____wide__ddata_locale), -1, INT64(1), INT64(973), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_check_nil((d)->addr, INT64(978), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  call_tmp30 = numIndices(d, _ln, _fn);
+  call_tmp31 = (call_tmp30 > INT64(0));
+  if (call_tmp31) {
+    chpl_check_nil((this6)->addr, INT64(979), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    chpl_macro_tmp_318.locale = (this6)->locale;
+    chpl_macro_tmp_318.addr = &(((this6)->addr)->shiftedData);
+    call_tmp32 = chpl_macro_tmp_318;
+    chpl_check_nil((&copy)->addr, INT64(979), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    chpl_macro_tmp_319.locale = (&copy)->locale;
+    chpl_macro_tmp_319.addr = &(((&copy)->addr)->shiftedData);
+    chpl_gen_comm_get(((void*)(&ret23)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_319).locale), INT64(0), NULL), (chpl_macro_tmp_319).addr, sizeof(chpl____wide__ddata_locale), -1, INT64(1), INT64(979), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    chpl_gen_comm_put(((void*)(&ret23)), chpl_nodeFromLocaleID(&((call_tmp32).locale), INT64(0), NULL), (call_tmp32).addr, sizeof(chpl____wide__ddata_locale), -1, INT64(1), INT64(979), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  }
+  chpl_macro_tmp_320.locale = (&copy)->locale;
+  chpl_macro_tmp_320.addr = ((BaseArr)((&copy)->addr));
+  _parent_destructor_tmp_ = chpl_macro_tmp_320;
+  chpl_check_nil((&_parent_destructor_tmp_)->addr, INT64(981), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_321.locale = (&_parent_destructor_tmp_)->locale;
+  chpl_macro_tmp_321.addr = &(((&_parent_destructor_tmp_)->addr)->_arrCnt);
+  _field_destructor_tmp_ = chpl_macro_tmp_321;
+  chpl_macro_tmp_322.locale = (_field_destructor_tmp_).locale;
+  chpl_macro_tmp_322.addr = &(((_field_destructor_tmp_).addr)->_cnt);
+  _field_destructor_tmp_2 = chpl_macro_tmp_322;
+  chpl_macro_tmp_323.locale = (_field_destructor_tmp_2).locale;
+  chpl_macro_tmp_323.addr = &(((_field_destructor_tmp_2).addr)->_v);
+  call_tmp33 = chpl_macro_tmp_323;
+  T14 = (&call_tmp33)->addr;
+  atomic_destroy_int_least64_t(T14);
+  chpl_macro_tmp_324.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_324.addr = T14;
+  call_tmp33 = chpl_macro_tmp_324;
+  call_tmp34 = (&copy)->locale;
+  rvfDerefTmp = copy;
+  _args_size = sizeof(chpl__class_localson_fn34_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn34)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(981), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp34;
+  chpl_check_nil(_args_foron_fn, INT64(981), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (_args_foron_fn)->_1_rvfDerefTmp = rvfDerefTmp;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn34 ***/ chpl_executeOn(&call_tmp34, INT32(37), _args_foron_fn, sizeof(chpl__class_localson_fn34_object), INT64(981), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  return;
+}
+
+/* DefaultRectangular.chpl:959 */
+static void dsiReallocate3(chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const this6, chpl____wide_DefaultRectangularDom_1_int64_t_F* const d, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F copy = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  DefaultRectangularArr_localesSignal_1_int64_t_F this7 = NULL;
+  int64_t call_tmp;
+  chpl_opaque cast_tmp;
+  DefaultRectangularArr_localesSignal_1_int64_t_F T = NULL;
+  DefaultRectangularDom_1_int64_t_F T2 = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  _tuple_1_star_int64_t _init_class_tmp_;
+  _tuple_1_star_int64_t _init_class_tmp_2;
+  _tuple_1_star_int64_t _init_class_tmp_3;
+  _ddata_localesSignal T4 = NULL;
+  chpl____wide__ddata_localesSignal T5 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ddata_localesSignal T6 = NULL;
+  chpl____wide__ddata_localesSignal T7 = {CHPL_LOCALEID_T_INIT, NULL};
+  atomic_refcnt this8;
+  atomic_int64 _init_class_tmp_4;
+  atomic_int64 this9;
+  atomic_int_least64_t ret2;
+  atomic_int_least64_t type_tmp;
+  _ref_atomic_int_least64_t _ref_tmp_ = NULL;
+  _ref_atomic_int_least64_t T8 = NULL;
+  atomic_int64 wrap_call_tmp;
+  atomic_refcnt wrap_call_tmp2;
+  BaseArr call_tmp2 = NULL;
+  BaseArr T9 = NULL;
+  _tuple_1_star_int64_t this10;
+  _tuple_1_star_int64_t this11;
+  _tuple_1_star_int64_t this12;
+  _ddata_localesSignal call_tmp3 = NULL;
+  _ddata_localesSignal T10 = NULL;
+  chpl____wide__ddata_localesSignal T11 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ddata_localesSignal call_tmp4 = NULL;
+  _ddata_localesSignal T12 = NULL;
+  chpl____wide__ddata_localesSignal T13 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool x2;
+  _ref_chpl_bool _ref_tmp_2 = NULL;
+  DefaultRectangularArr_localesSignal_1_int64_t_F wrap_call_tmp3 = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F coerce_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  range_int64_t_bounded_F ret_x1;
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F ret_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultRectangularDom_1_int64_t_F ret_to_arg_ref_tmp_ = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret4 = {CHPL_LOCALEID_T_INIT, NULL};
+  _tuple_1_star_int64_t default_argoffset;
+  _ref__tuple_1_star_int64_t ret_to_arg_ref_tmp_2 = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F this13 = {CHPL_LOCALEID_T_INIT, NULL};
+  range_int64_t_bounded_F ret_x12;
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F ret_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  range_int64_t_bounded_F _ic__F0_this;
+  _ref_range_int64_t_bounded_F this14 = NULL;
+  int64_t i;
+  int64_t ret5;
+  int64_t end;
+  int64_t ret6;
+  int64_t i2;
+  _tuple_1_star_int64_t ind;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret7 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F coerce_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool ret8;
+  chpl____wide__ref_range_int64_t_bounded_F call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F call_tmp7 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t coerce_tmp3;
+  chpl_bool ret9;
+  int64_t ret10;
+  chpl_bool call_tmp8;
+  int64_t ret11;
+  chpl_bool call_tmp9;
+  chpl_bool call_tmp10;
+  chpl_bool call_tmp11;
+  chpl____wide_chpl_string call_tmp12 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t sum;
+  int64_t ret_x13;
+  chpl____wide__ref__tuple_1_star_int64_t ret_3 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t coerce_tmp4;
+  int64_t call_tmp13;
+  chpl____wide__ddata_localesSignal ret12 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_localesSignal coerce_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_localesSignal call_tmp14 = {CHPL_LOCALEID_T_INIT, NULL};
+  _tuple_1_star_int64_t ind2;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret13 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F coerce_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool ret14;
+  chpl____wide__ref_range_int64_t_bounded_F call_tmp15 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F call_tmp16 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t coerce_tmp7;
+  chpl_bool ret15;
+  int64_t ret16;
+  chpl_bool call_tmp17;
+  int64_t ret17;
+  chpl_bool call_tmp18;
+  chpl_bool call_tmp19;
+  chpl_bool call_tmp20;
+  chpl____wide_chpl_string call_tmp21 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t sum2;
+  int64_t ret_x14;
+  chpl____wide__ref__tuple_1_star_int64_t ret_4 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t coerce_tmp8;
+  int64_t call_tmp22;
+  chpl____wide__ddata_localesSignal ret18 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_localesSignal coerce_tmp9 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_localesSignal ret19 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_localesSignal call_tmp23 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref__tuple_1_star_int64_t call_tmp24 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t ret_x15;
+  chpl____wide__ref__tuple_1_star_int64_t ret_5 = {CHPL_LOCALEID_T_INIT, NULL};
+  _tuple_1_star_int64_t coerce_tmp10;
+  chpl____wide__ref__tuple_1_star_int64_t call_tmp25 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t ret_x16;
+  chpl____wide__ref__tuple_1_star_int64_t ret_6 = {CHPL_LOCALEID_T_INIT, NULL};
+  _tuple_1_star_int64_t coerce_tmp11;
+  chpl____wide__ref__tuple_1_star_int64_t call_tmp26 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t ret_x17;
+  chpl____wide__ref__tuple_1_star_int64_t ret_7 = {CHPL_LOCALEID_T_INIT, NULL};
+  _tuple_1_star_int64_t coerce_tmp12;
+  chpl____wide__ref_int64_t call_tmp27 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t ret20;
+  chpl____wide__ref_int64_t call_tmp28 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t ret21;
+  chpl____wide__ref__ddata_localesSignal call_tmp29 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_localesSignal ret22 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp30;
+  chpl_bool call_tmp31;
+  chpl____wide__ref__ddata_localesSignal call_tmp32 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_localesSignal ret23 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseArr _parent_destructor_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_refcnt _field_destructor_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 _field_destructor_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int_least64_t call_tmp33 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_int_least64_t T14 = NULL;
+  chpl_localeID_t call_tmp34;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn35 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_325;
+  chpl____wide__ddata_localesSignal chpl_macro_tmp_326;
+  chpl____wide__ddata_localesSignal chpl_macro_tmp_327;
+  chpl____wide__ddata_localesSignal chpl_macro_tmp_328;
+  chpl____wide__ddata_localesSignal chpl_macro_tmp_329;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F chpl_macro_tmp_330;
+  chpl____wide__ref_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_331;
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F chpl_macro_tmp_332;
+  chpl____wide__ref_range_int64_t_bounded_F chpl_macro_tmp_333;
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F chpl_macro_tmp_334;
+  chpl____wide__ref_range_int64_t_bounded_F chpl_macro_tmp_335;
+  chpl____wide__ref_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_336;
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F chpl_macro_tmp_337;
+  chpl____wide__ref_range_int64_t_bounded_F chpl_macro_tmp_338;
+  chpl____wide__ref_int64_t chpl_macro_tmp_339;
+  chpl____wide__ref__tuple_1_star_int64_t chpl_macro_tmp_340;
+  chpl____wide__ref__ddata_localesSignal chpl_macro_tmp_341;
+  chpl____wide__ref__tuple_1_star_int64_t chpl_macro_tmp_342;
+  chpl____wide__ref__ddata_localesSignal chpl_macro_tmp_343;
+  chpl____wide__ref_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_344;
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F chpl_macro_tmp_345;
+  chpl____wide__ref_range_int64_t_bounded_F chpl_macro_tmp_346;
+  chpl____wide__ref_int64_t chpl_macro_tmp_347;
+  chpl____wide__ref_int64_t chpl_macro_tmp_348;
+  chpl____wide__ref_localesSignal chpl_macro_tmp_349;
+  chpl____wide__ref_int64_t chpl_macro_tmp_350;
+  chpl____wide__ref_int64_t chpl_macro_tmp_351;
+  chpl____wide__ref_int64_t chpl_macro_tmp_352;
+  chpl____wide__ref_localesSignal chpl_macro_tmp_353;
+  chpl____wide__ref__tuple_1_star_int64_t chpl_macro_tmp_354;
+  chpl____wide__ref__tuple_1_star_int64_t chpl_macro_tmp_355;
+  chpl____wide__ref_int64_t chpl_macro_tmp_356;
+  chpl____wide__ref__tuple_1_star_int64_t chpl_macro_tmp_357;
+  chpl____wide__ref__tuple_1_star_int64_t chpl_macro_tmp_358;
+  chpl____wide__ref_int64_t chpl_macro_tmp_359;
+  chpl____wide__ref__tuple_1_star_int64_t chpl_macro_tmp_360;
+  chpl____wide__ref__tuple_1_star_int64_t chpl_macro_tmp_361;
+  chpl____wide__ref_int64_t chpl_macro_tmp_362;
+  chpl____wide__ref_int64_t chpl_macro_tmp_363;
+  chpl____wide__ref_int64_t chpl_macro_tmp_364;
+  chpl____wide__ref_int64_t chpl_macro_tmp_365;
+  chpl____wide__ref_int64_t chpl_macro_tmp_366;
+  chpl____wide__ref__ddata_localesSignal chpl_macro_tmp_367;
+  chpl____wide__ref__ddata_localesSignal chpl_macro_tmp_368;
+  chpl____wide__ref__ddata_localesSignal chpl_macro_tmp_369;
+  chpl____wide__ref__ddata_localesSignal chpl_macro_tmp_370;
+  chpl____wide_BaseArr chpl_macro_tmp_371;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_372;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_373;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_374;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_375;
+  ret = *(d);
+  call_tmp = sizeof(chpl_DefaultRectangularArr_localesSignal_1_int64_t_F_object);
+  cast_tmp = chpl_here_alloc(call_tmp, INT16(14), _ln, _fn);
+  T = ((DefaultRectangularArr_localesSignal_1_int64_t_F)(cast_tmp));
+  this7 = T;
+  ((object)(this7))->chpl__cid = chpl__cid_DefaultRectangularArr_localesSignal_1_int64_t_F;
+  T2 = nil;
+  chpl_macro_tmp_325.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_325.addr = T2;
+  T3 = chpl_macro_tmp_325;
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->dom = T3;
+  *(_init_class_tmp_ + INT64(0)) = INT64(0);
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this7)->off + INT64(0)) = *(_init_class_tmp_ + INT64(0));
+  *(_init_class_tmp_2 + INT64(0)) = INT64(0);
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this7)->blk + INT64(0)) = *(_init_class_tmp_2 + INT64(0));
+  *(_init_class_tmp_3 + INT64(0)) = INT64(0);
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this7)->str + INT64(0)) = *(_init_class_tmp_3 + INT64(0));
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->origin = INT64(0);
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->factoredOffs = INT64(0);
+  T4 = nil;
+  chpl_macro_tmp_326.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_326.addr = T4;
+  T5 = chpl_macro_tmp_326;
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->data = T5;
+  T6 = nil;
+  chpl_macro_tmp_327.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_327.addr = T6;
+  T7 = chpl_macro_tmp_327;
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->shiftedData = T7;
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->noinit_data = false;
+  (&this8)->_cnt = _init_class_tmp_4;
+  ret2 = type_tmp;
+  _ref_tmp_ = &ret2;
+  T8 = _ref_tmp_;
+  atomic_init_int_least64_t(T8, INT64(0));
+  _ref_tmp_ = T8;
+  (&this9)->_v = ret2;
+  wrap_call_tmp = _construct_atomic_int64(ret2, &this9, _ln, _fn);
+  (&this8)->_cnt = wrap_call_tmp;
+  wrap_call_tmp2 = _construct_atomic_refcnt(&wrap_call_tmp, &this8, _ln, _fn);
+  T9 = ((BaseArr)(nil));
+  call_tmp2 = T9;
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->dom = ret;
+  *(this10 + INT64(0)) = INT64(0);
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this7)->off + INT64(0)) = *(this10 + INT64(0));
+  *(this11 + INT64(0)) = INT64(0);
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this7)->blk + INT64(0)) = *(this11 + INT64(0));
+  *(this12 + INT64(0)) = INT64(0);
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *((this7)->str + INT64(0)) = *(this12 + INT64(0));
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->origin = INT64(0);
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->factoredOffs = INT64(0);
+  T10 = ((_ddata_localesSignal)(nil));
+  call_tmp3 = T10;
+  chpl_macro_tmp_328.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_328.addr = call_tmp3;
+  T11 = chpl_macro_tmp_328;
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->data = T11;
+  T12 = ((_ddata_localesSignal)(nil));
+  call_tmp4 = T12;
+  chpl_macro_tmp_329.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_329.addr = call_tmp4;
+  T13 = chpl_macro_tmp_329;
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->shiftedData = T13;
+  x2 = false;
+  _ref_tmp_2 = &x2;
+  *(_ref_tmp_2) = false;
+  chpl_check_nil(this7, INT64(961), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (this7)->noinit_data = x2;
+  wrap_call_tmp3 = _construct_DefaultRectangularArr2(&wrap_call_tmp2, call_tmp2, &ret, &this10, &this11, &this12, INT64(0), INT64(0), call_tmp3, call_tmp4, x2, this7, _ln, _fn);
+  chpl_macro_tmp_330.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_330.addr = wrap_call_tmp3;
+  copy = chpl_macro_tmp_330;
+  chpl_check_nil((this6)->addr, INT64(965), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_331.locale = (this6)->locale;
+  chpl_macro_tmp_331.addr = &(((this6)->addr)->dom);
+  chpl_gen_comm_get(((void*)(&ret3)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_331).locale), INT64(0), NULL), (chpl_macro_tmp_331).addr, sizeof(chpl____wide_DefaultRectangularDom_1_int64_t_F), -1, INT64(1), INT64(965), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  coerce_tmp = ret3;
+  chpl_check_nil((&coerce_tmp)->addr, INT64(965), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_332.locale = (&coerce_tmp)->locale;
+  chpl_macro_tmp_332.addr = &(((&coerce_tmp)->addr)->ranges);
+  ret_ = chpl_macro_tmp_332;
+  chpl_macro_tmp_333.locale = (ret_).locale;
+  chpl_macro_tmp_333.addr = (*((ret_).addr) + INT64(0));
+  chpl_gen_comm_get(((void*)(&ret_x1)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_333).locale), INT64(0), NULL), (chpl_macro_tmp_333).addr, sizeof(range_int64_t_bounded_F), -1, INT64(1), INT64(965), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  ret_to_arg_ref_tmp_ = &call_tmp5;
+  chpl_check_nil((d)->addr, INT64(965), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  this2(d, &ret_x1, ret_to_arg_ref_tmp_, _ln, _fn);
+  ret4 = call_tmp5;
+  ret_to_arg_ref_tmp_2 = &default_argoffset;
+  createTuple(INT64(0), ret_to_arg_ref_tmp_2, _ln, _fn);
+  this13 = ret4;
+  chpl_check_nil((&this13)->addr, INT64(965), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_334.locale = (&this13)->locale;
+  chpl_macro_tmp_334.addr = &(((&this13)->addr)->ranges);
+  ret_2 = chpl_macro_tmp_334;
+  chpl_macro_tmp_335.locale = (ret_2).locale;
+  chpl_macro_tmp_335.addr = (*((ret_2).addr) + INT64(0));
+  chpl_gen_comm_get(((void*)(&ret_x12)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_335).locale), INT64(0), NULL), (chpl_macro_tmp_335).addr, sizeof(range_int64_t_bounded_F), -1, INT64(1), INT64(965), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  _ic__F0_this = ret_x12;
+  this14 = &_ic__F0_this;
+  checkIfIterWillOverflow(this14, true, _ln, _fn);
+  ret5 = (&_ic__F0_this)->_low;
+  ret6 = (&_ic__F0_this)->_high;
+  end = ret6;
+  chpl_check_nil((&copy)->addr, INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_336.locale = (&copy)->locale;
+  chpl_macro_tmp_336.addr = &(((&copy)->addr)->dom);
+  chpl_gen_comm_get(((void*)(&ret7)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_336).locale), INT64(0), NULL), (chpl_macro_tmp_336).addr, sizeof(chpl____wide_DefaultRectangularDom_1_int64_t_F), -1, INT64(1), INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  coerce_tmp2 = ret7;
+  chpl_check_nil((&coerce_tmp2)->addr, INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_337.locale = (&coerce_tmp2)->locale;
+  chpl_macro_tmp_337.addr = &(((&coerce_tmp2)->addr)->ranges);
+  call_tmp7 = chpl_macro_tmp_337;
+  chpl_macro_tmp_338.locale = (call_tmp7).locale;
+  chpl_macro_tmp_338.addr = (*((call_tmp7).addr) + INT64(0));
+  call_tmp6 = chpl_macro_tmp_338;
+  chpl_macro_tmp_339.locale = (call_tmp6).locale;
+  chpl_macro_tmp_339.addr = &(((call_tmp6).addr)->_high);
+  chpl_gen_comm_get(((void*)(&ret10)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_339).locale), INT64(0), NULL), (chpl_macro_tmp_339).addr, sizeof(int64_t), -1, INT64(1), INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_check_nil((this6)->addr, INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_340.locale = (this6)->locale;
+  chpl_macro_tmp_340.addr = &(((this6)->addr)->blk);
+  ret_4 = chpl_macro_tmp_340;
+  chpl_check_nil((this6)->addr, INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_341.locale = (this6)->locale;
+  chpl_macro_tmp_341.addr = &(((this6)->addr)->shiftedData);
+  chpl_gen_comm_get(((void*)(&ret18)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_341).locale), INT64(0), NULL), (chpl_macro_tmp_341).addr, sizeof(chpl____wide__ddata_localesSignal), -1, INT64(1), INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  coerce_tmp9 = ret18;
+  chpl_check_nil((&copy)->addr, INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_342.locale = (&copy)->locale;
+  chpl_macro_tmp_342.addr = &(((&copy)->addr)->blk);
+  ret_3 = chpl_macro_tmp_342;
+  chpl_check_nil((&copy)->addr, INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_343.locale = (&copy)->locale;
+  chpl_macro_tmp_343.addr = &(((&copy)->addr)->shiftedData);
+  chpl_gen_comm_get(((void*)(&ret12)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_343).locale), INT64(0), NULL), (chpl_macro_tmp_343).addr, sizeof(chpl____wide__ddata_localesSignal), -1, INT64(1), INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  coerce_tmp5 = ret12;
+  chpl_check_nil((this6)->addr, INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_344.locale = (this6)->locale;
+  chpl_macro_tmp_344.addr = &(((this6)->addr)->dom);
+  chpl_gen_comm_get(((void*)(&ret13)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_344).locale), INT64(0), NULL), (chpl_macro_tmp_344).addr, sizeof(chpl____wide_DefaultRectangularDom_1_int64_t_F), -1, INT64(1), INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  coerce_tmp6 = ret13;
+  chpl_check_nil((&coerce_tmp6)->addr, INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_345.locale = (&coerce_tmp6)->locale;
+  chpl_macro_tmp_345.addr = &(((&coerce_tmp6)->addr)->ranges);
+  call_tmp16 = chpl_macro_tmp_345;
+  chpl_macro_tmp_346.locale = (call_tmp16).locale;
+  chpl_macro_tmp_346.addr = (*((call_tmp16).addr) + INT64(0));
+  call_tmp15 = chpl_macro_tmp_346;
+  for (i = ret5; ((i <= end)); i += INT64(1)) {
+    i2 = i;
+    *(ind + INT64(0)) = i;
+    coerce_tmp3 = *(ind + INT64(0));
+    call_tmp8 = (coerce_tmp3 > ret10);
+    if (call_tmp8) {
+      ret9 = false;
+      goto _end_member;
+    }
+    chpl_macro_tmp_347.locale = (call_tmp6).locale;
+    chpl_macro_tmp_347.addr = &(((call_tmp6).addr)->_low);
+    chpl_gen_comm_get(((void*)(&ret11)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_347).locale), INT64(0), NULL), (chpl_macro_tmp_347).addr, sizeof(int64_t), -1, INT64(1), INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    call_tmp9 = (coerce_tmp3 < ret11);
+    if (call_tmp9) {
+      ret9 = false;
+      goto _end_member;
+    }
+    ret9 = true;
+    _end_member:;
+    call_tmp10 = (! ret9);
+    if (call_tmp10) {
+      ret8 = false;
+      goto _end_dsiMember;
+    }
+    ret8 = true;
+    _end_dsiMember:;
+    call_tmp11 = (! ret8);
+    if (call_tmp11) {
+      wide_string_from_c_string(&call_tmp12, "array index out of bounds: ", INT64(0), INT64(0), _ln, _fn);
+      halt2(call_tmp12, &ind, _ln, _fn);
+    }
+    sum = INT64(0);
+    chpl_macro_tmp_348.locale = (ret_3).locale;
+    chpl_macro_tmp_348.addr = (*((ret_3).addr) + INT64(0));
+    chpl_gen_comm_get(((void*)(&ret_x13)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_348).locale), INT64(0), NULL), (chpl_macro_tmp_348).addr, sizeof(int64_t), -1, INT64(1), INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    coerce_tmp4 = *(ind + INT64(0));
+    call_tmp13 = (coerce_tmp4 * ret_x13);
+    sum += call_tmp13;
+    chpl_macro_tmp_349.locale = (&coerce_tmp5)->locale;
+    chpl_macro_tmp_349.addr = ((&coerce_tmp5)->addr + sum);
+    call_tmp14 = chpl_macro_tmp_349;
+    *(ind2 + INT64(0)) = i2;
+    coerce_tmp7 = *(ind2 + INT64(0));
+    chpl_macro_tmp_350.locale = (call_tmp15).locale;
+    chpl_macro_tmp_350.addr = &(((call_tmp15).addr)->_high);
+    chpl_gen_comm_get(((void*)(&ret16)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_350).locale), INT64(0), NULL), (chpl_macro_tmp_350).addr, sizeof(int64_t), -1, INT64(1), INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    call_tmp17 = (coerce_tmp7 > ret16);
+    if (call_tmp17) {
+      ret15 = false;
+      goto _end_member2;
+    }
+    chpl_macro_tmp_351.locale = (call_tmp15).locale;
+    chpl_macro_tmp_351.addr = &(((call_tmp15).addr)->_low);
+    chpl_gen_comm_get(((void*)(&ret17)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_351).locale), INT64(0), NULL), (chpl_macro_tmp_351).addr, sizeof(int64_t), -1, INT64(1), INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    call_tmp18 = (coerce_tmp7 < ret17);
+    if (call_tmp18) {
+      ret15 = false;
+      goto _end_member2;
+    }
+    ret15 = true;
+    _end_member2:;
+    call_tmp19 = (! ret15);
+    if (call_tmp19) {
+      ret14 = false;
+      goto _end_dsiMember2;
+    }
+    ret14 = true;
+    _end_dsiMember2:;
+    call_tmp20 = (! ret14);
+    if (call_tmp20) {
+      wide_string_from_c_string(&call_tmp21, "array index out of bounds: ", INT64(0), INT64(0), _ln, _fn);
+      halt2(call_tmp21, &ind2, _ln, _fn);
+    }
+    sum2 = INT64(0);
+    chpl_macro_tmp_352.locale = (ret_4).locale;
+    chpl_macro_tmp_352.addr = (*((ret_4).addr) + INT64(0));
+    chpl_gen_comm_get(((void*)(&ret_x14)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_352).locale), INT64(0), NULL), (chpl_macro_tmp_352).addr, sizeof(int64_t), -1, INT64(1), INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    coerce_tmp8 = *(ind2 + INT64(0));
+    call_tmp22 = (coerce_tmp8 * ret_x14);
+    sum2 += call_tmp22;
+    chpl_macro_tmp_353.locale = (&coerce_tmp9)->locale;
+    chpl_macro_tmp_353.addr = ((&coerce_tmp9)->addr + sum2);
+    call_tmp23 = chpl_macro_tmp_353;
+    chpl_gen_comm_get(((void*)(&ret19)), chpl_nodeFromLocaleID(&((call_tmp23).locale), INT64(0), NULL), (call_tmp23).addr, sizeof(chpl____wide_localesSignal), -1, INT64(1), INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    chpl_gen_comm_put(((void*)(&ret19)), chpl_nodeFromLocaleID(&((call_tmp14).locale), INT64(0), NULL), (call_tmp14).addr, sizeof(chpl____wide_localesSignal), -1, INT64(1), INT64(966), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  }
+  chpl__autoDestroy2(&call_tmp5, _ln, _fn);
+  chpl_check_nil((this6)->addr, INT64(967), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_354.locale = (this6)->locale;
+  chpl_macro_tmp_354.addr = &(((this6)->addr)->off);
+  call_tmp24 = chpl_macro_tmp_354;
+  chpl_check_nil((&copy)->addr, INT64(967), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_355.locale = (&copy)->locale;
+  chpl_macro_tmp_355.addr = &(((&copy)->addr)->off);
+  ret_5 = chpl_macro_tmp_355;
+  chpl_macro_tmp_356.locale = (ret_5).locale;
+  chpl_macro_tmp_356.addr = (*((ret_5).addr) + INT64(0));
+  chpl_gen_comm_get(((void*)(&ret_x15)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_356).locale), INT64(0), NULL), (chpl_macro_tmp_356).addr, sizeof(int64_t), -1, INT64(1), INT64(967), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *(coerce_tmp10 + INT64(0)) = ret_x15;
+  chpl_gen_comm_put(((void*)(&coerce_tmp10)), chpl_nodeFromLocaleID(&((call_tmp24).locale), INT64(0), NULL), (call_tmp24).addr, sizeof(_tuple_1_star_int64_t), -1, INT64(1), INT64(967), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_check_nil((this6)->addr, INT64(968), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_357.locale = (this6)->locale;
+  chpl_macro_tmp_357.addr = &(((this6)->addr)->blk);
+  call_tmp25 = chpl_macro_tmp_357;
+  chpl_check_nil((&copy)->addr, INT64(968), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_358.locale = (&copy)->locale;
+  chpl_macro_tmp_358.addr = &(((&copy)->addr)->blk);
+  ret_6 = chpl_macro_tmp_358;
+  chpl_macro_tmp_359.locale = (ret_6).locale;
+  chpl_macro_tmp_359.addr = (*((ret_6).addr) + INT64(0));
+  chpl_gen_comm_get(((void*)(&ret_x16)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_359).locale), INT64(0), NULL), (chpl_macro_tmp_359).addr, sizeof(int64_t), -1, INT64(1), INT64(968), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *(coerce_tmp11 + INT64(0)) = ret_x16;
+  chpl_gen_comm_put(((void*)(&coerce_tmp11)), chpl_nodeFromLocaleID(&((call_tmp25).locale), INT64(0), NULL), (call_tmp25).addr, sizeof(_tuple_1_star_int64_t), -1, INT64(1), INT64(968), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_check_nil((this6)->addr, INT64(969), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_360.locale = (this6)->locale;
+  chpl_macro_tmp_360.addr = &(((this6)->addr)->str);
+  call_tmp26 = chpl_macro_tmp_360;
+  chpl_check_nil((&copy)->addr, INT64(969), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_361.locale = (&copy)->locale;
+  chpl_macro_tmp_361.addr = &(((&copy)->addr)->str);
+  ret_7 = chpl_macro_tmp_361;
+  chpl_macro_tmp_362.locale = (ret_7).locale;
+  chpl_macro_tmp_362.addr = (*((ret_7).addr) + INT64(0));
+  chpl_gen_comm_get(((void*)(&ret_x17)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_362).locale), INT64(0), NULL), (chpl_macro_tmp_362).addr, sizeof(int64_t), -1, INT64(1), INT64(969), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  *(coerce_tmp12 + INT64(0)) = ret_x17;
+  chpl_gen_comm_put(((void*)(&coerce_tmp12)), chpl_nodeFromLocaleID(&((call_tmp26).locale), INT64(0), NULL), (call_tmp26).addr, sizeof(_tuple_1_star_int64_t), -1, INT64(1), INT64(969), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_check_nil((this6)->addr, INT64(970), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_363.locale = (this6)->locale;
+  chpl_macro_tmp_363.addr = &(((this6)->addr)->origin);
+  call_tmp27 = chpl_macro_tmp_363;
+  chpl_check_nil((&copy)->addr, INT64(970), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_364.locale = (&copy)->locale;
+  chpl_macro_tmp_364.addr = &(((&copy)->addr)->origin);
+  chpl_gen_comm_get(((void*)(&ret20)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_364).locale), INT64(0), NULL), (chpl_macro_tmp_364).addr, sizeof(int64_t), -1, INT64(1), INT64(970), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_gen_comm_put(((void*)(&ret20)), chpl_nodeFromLocaleID(&((call_tmp27).locale), INT64(0), NULL), (call_tmp27).addr, sizeof(int64_t), -1, INT64(1), INT64(970), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_check_nil((this6)->addr, INT64(971), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_365.locale = (this6)->locale;
+  chpl_macro_tmp_365.addr = &(((this6)->addr)->factoredOffs);
+  call_tmp28 = chpl_macro_tmp_365;
+  chpl_check_nil((&copy)->addr, INT64(971), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_366.locale = (&copy)->locale;
+  chpl_macro_tmp_366.addr = &(((&copy)->addr)->factoredOffs);
+  chpl_gen_comm_get(((void*)(&ret21)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_366).locale), INT64(0), NULL), (chpl_macro_tmp_366).addr, sizeof(int64_t), -1, INT64(1), INT64(971), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_gen_comm_put(((void*)(&ret21)), chpl_nodeFromLocaleID(&((call_tmp28).locale), INT64(0), NULL), (call_tmp28).addr, sizeof(int64_t), -1, INT64(1), INT64(971), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_check_nil((this6)->addr, INT64(972), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  dsiDestroyData3(this6, _ln, _fn);
+  chpl_check_nil((this6)->addr, INT64(973), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_367.locale = (this6)->locale;
+  chpl_macro_tmp_367.addr = &(((this6)->addr)->data);
+  call_tmp29 = chpl_macro_tmp_367;
+  chpl_check_nil((&copy)->addr, INT64(973), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_368.locale = (&copy)->locale;
+  chpl_macro_tmp_368.addr = &(((&copy)->addr)->data);
+  chpl_gen_comm_get(((void*)(&ret22)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_368).locale), INT64(0), NULL), (chpl_macro_tmp_368).addr, sizeof(chpl____wide__ddata_localesSignal), -1, INT64(1), INT64(973), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_gen_comm_put(((void*)(&ret22)), chpl_nodeFromLocaleID(&((call_tmp29).locale), INT64(0), NULL), (call_tmp29).addr, sizeof(chpl____wide__ddata_localesSignal), -1, INT64(1), INT64(973), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_check_nil((d)->addr, INT64(978), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  call_tmp30 = numIndices(d, _ln, _fn);
+  call_tmp31 = (call_tmp30 > INT64(0));
+  if (call_tmp31) {
+    chpl_check_nil((this6)->addr, INT64(979), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    chpl_macro_tmp_369.locale = (this6)->locale;
+    chpl_macro_tmp_369.addr = &(((this6)->addr)->shiftedData);
+    call_tmp32 = chpl_macro_tmp_369;
+    chpl_check_nil((&copy)->addr, INT64(979), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    chpl_macro_tmp_370.locale = (&copy)->locale;
+    chpl_macro_tmp_370.addr = &(((&copy)->addr)->shiftedData);
+    chpl_gen_comm_get(((void*)(&ret23)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_370).locale), INT64(0), NULL), (chpl_macro_tmp_370).addr, sizeof(chpl____wide__ddata_localesSignal), -1, INT64(1), INT64(979), "/root/repo/modules/internal/DefaultRectangular.chpl");
+    chpl_gen_comm_put(((void*)(&ret23)), chpl_nodeFromLocaleID(&((call_tmp32).locale), INT64(0), NULL), (call_tmp32).addr, sizeof(chpl____wide__ddata_localesSignal), -1, INT64(1), INT64(979), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  }
+  chpl_macro_tmp_371.locale = (&copy)->locale;
+  chpl_macro_tmp_371.addr = ((BaseArr)((&copy)->addr));
+  _parent_destructor_tmp_ = chpl_macro_tmp_371;
+  chpl_check_nil((&_parent_destructor_tmp_)->addr, INT64(981), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_macro_tmp_372.locale = (&_parent_destructor_tmp_)->locale;
+  chpl_macro_tmp_372.addr = &(((&_parent_destructor_tmp_)->addr)->_arrCnt);
+  _field_destructor_tmp_ = chpl_macro_tmp_372;
+  chpl_macro_tmp_373.locale = (_field_destructor_tmp_).locale;
+  chpl_macro_tmp_373.addr = &(((_field_destructor_tmp_).addr)->_cnt);
+  _field_destructor_tmp_2 = chpl_macro_tmp_373;
+  chpl_macro_tmp_374.locale = (_field_destructor_tmp_2).locale;
+  chpl_macro_tmp_374.addr = &(((_field_destructor_tmp_2).addr)->_v);
+  call_tmp33 = chpl_macro_tmp_374;
+  T14 = (&call_tmp33)->addr;
+  atomic_destroy_int_least64_t(T14);
+  chpl_macro_tmp_375.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_375.addr = T14;
+  call_tmp33 = chpl_macro_tmp_375;
+  call_tmp34 = (&copy)->locale;
+  rvfDerefTmp = copy;
+  _args_size = sizeof(chpl__class_localson_fn35_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn35)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(981), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp34;
+  chpl_check_nil(_args_foron_fn, INT64(981), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  (_args_foron_fn)->_1_rvfDerefTmp = rvfDerefTmp;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn35 ***/ chpl_executeOn(&call_tmp34, INT32(38), _args_foron_fn, sizeof(chpl__class_localson_fn35_object), INT64(981), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  return;
+}
+
+/* DefaultRectangular.chpl:981 */
+static void on_fn34(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const delete_tmp, int64_t _ln, c_string _fn) {
+  chpl_opaque call_tmp;
+  call_tmp = ((void*)((delete_tmp)->addr));
+  chpl_here_free(call_tmp, _ln, _fn);
+  return;
+}
+
+/* DefaultRectangular.chpl:981 */
+static void on_fn35(chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const delete_tmp, int64_t _ln, c_string _fn) {
+  chpl_opaque call_tmp;
+  call_tmp = ((void*)((delete_tmp)->addr));
+  chpl_here_free(call_tmp, _ln, _fn);
+  return;
+}
+
+/* DefaultRectangular.chpl:981 */
+static void wrapon_fn34(_class_localson_fn34 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F _1_rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(981), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  _1_rvfDerefTmp = (c)->_1_rvfDerefTmp;
+  on_fn34(&_1_rvfDerefTmp, _ln, _fn);
+  return;
+}
+
+/* DefaultRectangular.chpl:981 */
+static void wrapon_fn35(_class_localson_fn35 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F _1_rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(981), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  _1_rvfDerefTmp = (c)->_1_rvfDerefTmp;
+  on_fn35(&_1_rvfDerefTmp, _ln, _fn);
+  return;
+}
+
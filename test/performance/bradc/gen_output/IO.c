@@ -0,0 +1,4756 @@
+/* IO.chpl:1 */
+static void chpl__init_IO(int64_t _ln, c_string _fn) {
+  c_string modFormatStr;
+  c_string modStr;
+  _ref_int32_t refIndentLevel = NULL;
+  int32_t const_tmp;
+  int32_t const_tmp2;
+  int32_t const_tmp3;
+  int32_t const_tmp4;
+  chpl____wide_chpl_string type_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_string ret;
+  _ref_chpl_string _ref_tmp_ = NULL;
+  chpl____wide_chpl_string call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_chpl_string type_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_string ret2;
+  _ref_chpl_string _ref_tmp_2 = NULL;
+  chpl____wide_chpl_string call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_chpl_string type_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_string ret3;
+  _ref_chpl_string _ref_tmp_3 = NULL;
+  chpl____wide_chpl_string call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_chpl_string type_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_string ret4;
+  _ref_chpl_string _ref_tmp_4 = NULL;
+  chpl____wide_chpl_string call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  c_string type_tmp_x1;
+  chpl____wide_chpl_string call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_c_string call_tmp6 = NULL;
+  c_string call_tmp7;
+  c_string type_tmp_x12;
+  chpl____wide_chpl_string call_tmp8 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_c_string call_tmp9 = NULL;
+  c_string call_tmp10;
+  chpl____wide_chpl_string type_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_string ret5;
+  _ref_chpl_string _ref_tmp_5 = NULL;
+  chpl____wide_chpl_string call_tmp11 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_chpl_string call_tmp12 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_chpl_string call_tmp13 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_chpl_string call_tmp14 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_chpl_string call_tmp15 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_chpl_string call_tmp16 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_chpl_string call_tmp17 = {CHPL_LOCALEID_T_INIT, NULL};
+  _tuple_6_star_chpl_string this6;
+  heap_channel_F_dynamic_T type_tmp6 = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_channel_F_dynamic_T T = NULL;
+  channel_F_dynamic_T this7;
+  locale T2 = NULL;
+  chpl____wide_locale T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  locale call_tmp18 = NULL;
+  locale T4 = NULL;
+  chpl____wide_locale T5 = {CHPL_LOCALEID_T_INIT, NULL};
+  qio_channel_ptr_t default_arg_channel_internal;
+  channel_F_dynamic_T wrap_call_tmp;
+  heap_file call_tmp19 = NULL;
+  int64_t chpl_here_alloc_size2;
+  chpl_opaque chpl_here_alloc_tmp2;
+  heap_file T6 = NULL;
+  int32_t call_tmp20;
+  int32_t default_arghints;
+  iostyle default_argstyle;
+  _ref_iostyle ret_to_arg_ref_tmp_ = NULL;
+  file wrap_call_tmp2;
+  _ref_file ret_to_arg_ref_tmp_2 = NULL;
+  file call_tmp21;
+  heap_file T7 = NULL;
+  int64_t chpl_here_alloc_size3;
+  chpl_opaque chpl_here_alloc_tmp3;
+  heap_file T8 = NULL;
+  _ref_file _ref_tmp_6 = NULL;
+  _ref_file _ref_tmp_7 = NULL;
+  int64_t default_argend;
+  int32_t default_arghints2;
+  iostyle default_argstyle2;
+  _ref_iostyle ret_to_arg_ref_tmp_3 = NULL;
+  channel_F_dynamic_T wrap_call_tmp3;
+  _ref_channel_F_dynamic_T ret_to_arg_ref_tmp_4 = NULL;
+  channel_F_dynamic_T call_tmp22;
+  heap_channel_F_dynamic_T T9 = NULL;
+  int64_t chpl_here_alloc_size4;
+  chpl_opaque chpl_here_alloc_tmp4;
+  heap_channel_F_dynamic_T T10 = NULL;
+  _ref_channel_F_dynamic_T _ref_tmp_8 = NULL;
+  _ref_channel_F_dynamic_T _ref_tmp_9 = NULL;
+  chpl____wide__ref_channel_F_dynamic_T T11 = {CHPL_LOCALEID_T_INIT, NULL};
+  channel_F_dynamic_T T12;
+  heap_channel_F_dynamic_T T13 = NULL;
+  int64_t chpl_here_alloc_size5;
+  chpl_opaque chpl_here_alloc_tmp5;
+  heap_channel_F_dynamic_T T14 = NULL;
+  _ref_channel_F_dynamic_T _ref_tmp_10 = NULL;
+  file T15;
+  heap_file T16 = NULL;
+  int64_t chpl_here_alloc_size6;
+  chpl_opaque chpl_here_alloc_tmp6;
+  heap_file T17 = NULL;
+  _ref_file _ref_tmp_11 = NULL;
+  heap_channel_T_dynamic_T type_tmp7 = NULL;
+  int64_t chpl_here_alloc_size7;
+  chpl_opaque chpl_here_alloc_tmp7;
+  heap_channel_T_dynamic_T T18 = NULL;
+  channel_T_dynamic_T this8;
+  locale T19 = NULL;
+  chpl____wide_locale T20 = {CHPL_LOCALEID_T_INIT, NULL};
+  locale call_tmp23 = NULL;
+  locale T21 = NULL;
+  chpl____wide_locale T22 = {CHPL_LOCALEID_T_INIT, NULL};
+  qio_channel_ptr_t default_arg_channel_internal2;
+  channel_T_dynamic_T wrap_call_tmp4;
+  _cfile call_tmp24;
+  heap_file call_tmp25 = NULL;
+  int64_t chpl_here_alloc_size8;
+  chpl_opaque chpl_here_alloc_tmp8;
+  heap_file T23 = NULL;
+  int32_t default_arghints3;
+  iostyle default_argstyle3;
+  _ref_iostyle ret_to_arg_ref_tmp_5 = NULL;
+  file wrap_call_tmp5;
+  _ref_file ret_to_arg_ref_tmp_6 = NULL;
+  file call_tmp26;
+  heap_file T24 = NULL;
+  int64_t chpl_here_alloc_size9;
+  chpl_opaque chpl_here_alloc_tmp9;
+  heap_file T25 = NULL;
+  _ref_file _ref_tmp_12 = NULL;
+  _ref_file _ref_tmp_13 = NULL;
+  int64_t default_argend2;
+  iostyle default_argstyle4;
+  _ref_iostyle ret_to_arg_ref_tmp_7 = NULL;
+  channel_T_dynamic_T wrap_call_tmp6;
+  int32_t call_tmp27;
+  _ref_channel_T_dynamic_T ret_to_arg_ref_tmp_8 = NULL;
+  channel_T_dynamic_T call_tmp28;
+  heap_channel_T_dynamic_T T26 = NULL;
+  int64_t chpl_here_alloc_size10;
+  chpl_opaque chpl_here_alloc_tmp10;
+  heap_channel_T_dynamic_T T27 = NULL;
+  _ref_channel_T_dynamic_T _ref_tmp_14 = NULL;
+  _ref_channel_T_dynamic_T _ref_tmp_15 = NULL;
+  chpl____wide__ref_channel_T_dynamic_T T28 = {CHPL_LOCALEID_T_INIT, NULL};
+  channel_T_dynamic_T T29;
+  heap_channel_T_dynamic_T T30 = NULL;
+  int64_t chpl_here_alloc_size11;
+  chpl_opaque chpl_here_alloc_tmp11;
+  heap_channel_T_dynamic_T T31 = NULL;
+  _ref_channel_T_dynamic_T _ref_tmp_16 = NULL;
+  file T32;
+  heap_file T33 = NULL;
+  int64_t chpl_here_alloc_size12;
+  chpl_opaque chpl_here_alloc_tmp12;
+  heap_file T34 = NULL;
+  _ref_file _ref_tmp_17 = NULL;
+  heap_channel_T_dynamic_T type_tmp8 = NULL;
+  int64_t chpl_here_alloc_size13;
+  chpl_opaque chpl_here_alloc_tmp13;
+  heap_channel_T_dynamic_T T35 = NULL;
+  channel_T_dynamic_T this9;
+  locale T36 = NULL;
+  chpl____wide_locale T37 = {CHPL_LOCALEID_T_INIT, NULL};
+  locale call_tmp29 = NULL;
+  locale T38 = NULL;
+  chpl____wide_locale T39 = {CHPL_LOCALEID_T_INIT, NULL};
+  qio_channel_ptr_t default_arg_channel_internal3;
+  channel_T_dynamic_T wrap_call_tmp7;
+  _cfile call_tmp30;
+  heap_file call_tmp31 = NULL;
+  int64_t chpl_here_alloc_size14;
+  chpl_opaque chpl_here_alloc_tmp14;
+  heap_file T40 = NULL;
+  int32_t default_arghints4;
+  iostyle default_argstyle5;
+  _ref_iostyle ret_to_arg_ref_tmp_9 = NULL;
+  file wrap_call_tmp8;
+  _ref_file ret_to_arg_ref_tmp_10 = NULL;
+  file call_tmp32;
+  heap_file T41 = NULL;
+  int64_t chpl_here_alloc_size15;
+  chpl_opaque chpl_here_alloc_tmp15;
+  heap_file T42 = NULL;
+  _ref_file _ref_tmp_18 = NULL;
+  _ref_file _ref_tmp_19 = NULL;
+  int64_t default_argend3;
+  iostyle default_argstyle6;
+  _ref_iostyle ret_to_arg_ref_tmp_11 = NULL;
+  channel_T_dynamic_T wrap_call_tmp9;
+  int32_t call_tmp33;
+  _ref_channel_T_dynamic_T ret_to_arg_ref_tmp_12 = NULL;
+  channel_T_dynamic_T call_tmp34;
+  heap_channel_T_dynamic_T T43 = NULL;
+  int64_t chpl_here_alloc_size16;
+  chpl_opaque chpl_here_alloc_tmp16;
+  heap_channel_T_dynamic_T T44 = NULL;
+  _ref_channel_T_dynamic_T _ref_tmp_20 = NULL;
+  _ref_channel_T_dynamic_T _ref_tmp_21 = NULL;
+  chpl____wide__ref_channel_T_dynamic_T T45 = {CHPL_LOCALEID_T_INIT, NULL};
+  channel_T_dynamic_T T46;
+  heap_channel_T_dynamic_T T47 = NULL;
+  int64_t chpl_here_alloc_size17;
+  chpl_opaque chpl_here_alloc_tmp17;
+  heap_channel_T_dynamic_T T48 = NULL;
+  _ref_channel_T_dynamic_T _ref_tmp_22 = NULL;
+  file T49;
+  heap_file T50 = NULL;
+  int64_t chpl_here_alloc_size18;
+  chpl_opaque chpl_here_alloc_tmp18;
+  heap_file T51 = NULL;
+  _ref_file _ref_tmp_23 = NULL;
+  chpl____wide__ref_chpl_string chpl_macro_tmp_862;
+  chpl____wide__ref_chpl_string chpl_macro_tmp_863;
+  chpl____wide__ref_chpl_string chpl_macro_tmp_864;
+  chpl____wide__ref_chpl_string chpl_macro_tmp_865;
+  chpl____wide__ref_chpl_string chpl_macro_tmp_866;
+  chpl____wide__ref__tuple_6_star_chpl_string chpl_macro_tmp_867;
+  chpl____wide_locale chpl_macro_tmp_868;
+  chpl____wide_locale chpl_macro_tmp_869;
+  chpl____wide__ref_channel_F_dynamic_T chpl_macro_tmp_870;
+  chpl____wide_locale chpl_macro_tmp_871;
+  chpl____wide_locale chpl_macro_tmp_872;
+  chpl____wide__ref_channel_T_dynamic_T chpl_macro_tmp_873;
+  chpl____wide__ref_channel_T_dynamic_T chpl_macro_tmp_874;
+  chpl____wide_locale chpl_macro_tmp_875;
+  chpl____wide_locale chpl_macro_tmp_876;
+  chpl____wide__ref_channel_T_dynamic_T chpl_macro_tmp_877;
+  if (chpl__init_IO_p) {
+    goto _exit_chpl__init_IO;
+  }
+  modFormatStr = "%*s\n";
+  modStr = "IO";
+  printModuleInit(modFormatStr, modStr, INT64(2), _ln, _fn);
+  refIndentLevel = &moduleInitLevel;
+  *(refIndentLevel) += INT64(1);
+  chpl__init_IO_p = true;
+  {
+    chpl__init_SysBasic(_ln, _fn);
+    chpl__init_Error(_ln, _fn);
+    chpl__init_Regexp(_ln, _fn);
+  }
+  IOHINT_NONE = INT32(0);
+  chpl_comm_broadcast_private(INT64(21), sizeof(int32_t), -1);
+  const_tmp = QIO_HINT_RANDOM;
+  IOHINT_RANDOM = const_tmp;
+  chpl_comm_broadcast_private(INT64(22), sizeof(int32_t), -1);
+  const_tmp2 = QIO_HINT_SEQUENTIAL;
+  IOHINT_SEQUENTIAL = const_tmp2;
+  chpl_comm_broadcast_private(INT64(23), sizeof(int32_t), -1);
+  const_tmp3 = QIO_HINT_CACHED;
+  IOHINT_CACHED = const_tmp3;
+  chpl_comm_broadcast_private(INT64(24), sizeof(int32_t), -1);
+  const_tmp4 = QIO_HINT_PARALLEL;
+  IOHINT_PARALLEL = const_tmp4;
+  chpl_comm_broadcast_private(INT64(25), sizeof(int32_t), -1);
+  ret = defaultStringValue;
+  chpl_string_widen(&type_tmp, ret, _ln, _fn);
+  _ref_tmp_ = &type_tmp;
+  wide_string_from_c_string(&call_tmp, "r", INT64(0), INT64(0), _ln, _fn);
+  *(_ref_tmp_) = call_tmp;
+  chpl_check_nil((&_r)->addr, INT64(682), "/root/repo/modules/standard/IO.chpl");
+  chpl_macro_tmp_862.locale = (&_r)->locale;
+  chpl_macro_tmp_862.addr = &(((&_r)->addr)->value);
+  chpl_gen_comm_put(((void*)(&type_tmp)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_862).locale), INT64(0), NULL), (chpl_macro_tmp_862).addr, sizeof(chpl____wide_chpl_string), -1, INT64(1), INT64(682), "/root/repo/modules/standard/IO.chpl");
+  ret2 = defaultStringValue;
+  chpl_string_widen(&type_tmp2, ret2, _ln, _fn);
+  _ref_tmp_2 = &type_tmp2;
+  wide_string_from_c_string(&call_tmp2, "r+", INT64(0), INT64(0), _ln, _fn);
+  *(_ref_tmp_2) = call_tmp2;
+  chpl_check_nil((&_rw)->addr, INT64(683), "/root/repo/modules/standard/IO.chpl");
+  chpl_macro_tmp_863.locale = (&_rw)->locale;
+  chpl_macro_tmp_863.addr = &(((&_rw)->addr)->value);
+  chpl_gen_comm_put(((void*)(&type_tmp2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_863).locale), INT64(0), NULL), (chpl_macro_tmp_863).addr, sizeof(chpl____wide_chpl_string), -1, INT64(1), INT64(683), "/root/repo/modules/standard/IO.chpl");
+  ret3 = defaultStringValue;
+  chpl_string_widen(&type_tmp3, ret3, _ln, _fn);
+  _ref_tmp_3 = &type_tmp3;
+  wide_string_from_c_string(&call_tmp3, "w", INT64(0), INT64(0), _ln, _fn);
+  *(_ref_tmp_3) = call_tmp3;
+  chpl_check_nil((&_cw)->addr, INT64(684), "/root/repo/modules/standard/IO.chpl");
+  chpl_macro_tmp_864.locale = (&_cw)->locale;
+  chpl_macro_tmp_864.addr = &(((&_cw)->addr)->value);
+  chpl_gen_comm_put(((void*)(&type_tmp3)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_864).locale), INT64(0), NULL), (chpl_macro_tmp_864).addr, sizeof(chpl____wide_chpl_string), -1, INT64(1), INT64(684), "/root/repo/modules/standard/IO.chpl");
+  ret4 = defaultStringValue;
+  chpl_string_widen(&type_tmp4, ret4, _ln, _fn);
+  _ref_tmp_4 = &type_tmp4;
+  wide_string_from_c_string(&call_tmp4, "w+", INT64(0), INT64(0), _ln, _fn);
+  *(_ref_tmp_4) = call_tmp4;
+  chpl_check_nil((&_cwr)->addr, INT64(685), "/root/repo/modules/standard/IO.chpl");
+  chpl_macro_tmp_865.locale = (&_cwr)->locale;
+  chpl_macro_tmp_865.addr = &(((&_cwr)->addr)->value);
+  chpl_gen_comm_put(((void*)(&type_tmp4)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_865).locale), INT64(0), NULL), (chpl_macro_tmp_865).addr, sizeof(chpl____wide_chpl_string), -1, INT64(1), INT64(685), "/root/repo/modules/standard/IO.chpl");
+  type_tmp_x1 = "";
+  wide_string_from_c_string(&call_tmp5, "true", INT64(0), INT64(0), _ln, _fn);
+  call_tmp6 = &type_tmp_x1;
+  c_string_from_wide_string(&call_tmp7, &call_tmp5, _ln, _fn);
+  *(call_tmp6) = call_tmp7;
+  *(_trues + INT64(0)) = type_tmp_x1;
+  chpl_comm_broadcast_private(INT64(26), sizeof(_tuple_1_star_c_string), -1);
+  type_tmp_x12 = "";
+  wide_string_from_c_string(&call_tmp8, "false", INT64(0), INT64(0), _ln, _fn);
+  call_tmp9 = &type_tmp_x12;
+  c_string_from_wide_string(&call_tmp10, &call_tmp8, _ln, _fn);
+  *(call_tmp9) = call_tmp10;
+  *(_falses + INT64(0)) = type_tmp_x12;
+  chpl_comm_broadcast_private(INT64(27), sizeof(_tuple_1_star_c_string), -1);
+  ret5 = defaultStringValue;
+  chpl_string_widen(&type_tmp5, ret5, _ln, _fn);
+  _ref_tmp_5 = &type_tmp5;
+  wide_string_from_c_string(&call_tmp11, "i", INT64(0), INT64(0), _ln, _fn);
+  *(_ref_tmp_5) = call_tmp11;
+  chpl_check_nil((&_i)->addr, INT64(1199), "/root/repo/modules/standard/IO.chpl");
+  chpl_macro_tmp_866.locale = (&_i)->locale;
+  chpl_macro_tmp_866.addr = &(((&_i)->addr)->value);
+  chpl_gen_comm_put(((void*)(&type_tmp5)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_866).locale), INT64(0), NULL), (chpl_macro_tmp_866).addr, sizeof(chpl____wide_chpl_string), -1, INT64(1), INT64(1199), "/root/repo/modules/standard/IO.chpl");
+  wide_string_from_c_string(&call_tmp12, "a", INT64(0), INT64(0), _ln, _fn);
+  wide_string_from_c_string(&call_tmp13, "b", INT64(0), INT64(0), _ln, _fn);
+  wide_string_from_c_string(&call_tmp14, "c", INT64(0), INT64(0), _ln, _fn);
+  wide_string_from_c_string(&call_tmp15, "d", INT64(0), INT64(0), _ln, _fn);
+  wide_string_from_c_string(&call_tmp16, "e", INT64(0), INT64(0), _ln, _fn);
+  wide_string_from_c_string(&call_tmp17, "f", INT64(0), INT64(0), _ln, _fn);
+  *(this6 + INT64(0)) = call_tmp12;
+  *(this6 + INT64(1)) = call_tmp13;
+  *(this6 + INT64(2)) = call_tmp14;
+  *(this6 + INT64(3)) = call_tmp15;
+  *(this6 + INT64(4)) = call_tmp16;
+  *(this6 + INT64(5)) = call_tmp17;
+  chpl_check_nil((&_arg_to_proto_names)->addr, INT64(1524), "/root/repo/modules/standard/IO.chpl");
+  chpl_macro_tmp_867.locale = (&_arg_to_proto_names)->locale;
+  chpl_macro_tmp_867.addr = &(((&_arg_to_proto_names)->addr)->value);
+  chpl_gen_comm_put(((void*)(&this6)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_867).locale), INT64(0), NULL), (chpl_macro_tmp_867).addr, sizeof(_tuple_6_star_chpl_string), -1, INT64(1), INT64(1524), "/root/repo/modules/standard/IO.chpl");
+  chpl_here_alloc_size = sizeof(chpl_heap_channel_F_dynamic_T_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T = ((heap_channel_F_dynamic_T)(chpl_here_alloc_tmp));
+  type_tmp6 = T;
+  T2 = nil;
+  chpl_macro_tmp_868.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_868.addr = T2;
+  T3 = chpl_macro_tmp_868;
+  (&this7)->home = T3;
+  T4 = ((locale)(nil));
+  call_tmp18 = T4;
+  chpl_macro_tmp_869.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_869.addr = call_tmp18;
+  T5 = chpl_macro_tmp_869;
+  (&this7)->home = T5;
+  default_arg_channel_internal = QIO_CHANNEL_PTR_NULL;
+  (&this7)->_channel_internal = default_arg_channel_internal;
+  wrap_call_tmp = _construct_channel(call_tmp18, default_arg_channel_internal, &this7, _ln, _fn);
+  chpl_check_nil(type_tmp6, INT64(2024), "/root/repo/modules/standard/IO.chpl");
+  (type_tmp6)->value = wrap_call_tmp;
+  chpl_here_alloc_size2 = sizeof(chpl_heap_file_object);
+  chpl_here_alloc_tmp2 = chpl_here_alloc(chpl_here_alloc_size2, INT16(22), _ln, _fn);
+  T6 = ((heap_file)(chpl_here_alloc_tmp2));
+  call_tmp19 = T6;
+  call_tmp20 = ((int32_t)(INT64(0)));
+  default_arghints = IOHINT_NONE;
+  ret_to_arg_ref_tmp_ = &default_argstyle;
+  defaultIOStyle(ret_to_arg_ref_tmp_, _ln, _fn);
+  ret_to_arg_ref_tmp_2 = &wrap_call_tmp2;
+  openfd2(call_tmp20, default_arghints, &default_argstyle, ret_to_arg_ref_tmp_2, _ln, _fn);
+  call_tmp21 = chpl__initCopy3(&wrap_call_tmp2, _ln, _fn);
+  chpl_check_nil(call_tmp19, INT64(2024), "/root/repo/modules/standard/IO.chpl");
+  (call_tmp19)->value = call_tmp21;
+  chpl_here_alloc_size3 = sizeof(chpl_heap_file_object);
+  chpl_here_alloc_tmp3 = chpl_here_alloc(chpl_here_alloc_size3, INT16(22), _ln, _fn);
+  T8 = ((heap_file)(chpl_here_alloc_tmp3));
+  T7 = T8;
+  chpl_check_nil(T7, INT64(2024), "/root/repo/modules/standard/IO.chpl");
+  (T7)->value = wrap_call_tmp2;
+  chpl_check_nil(T7, INT64(2024), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_6 = &((T7)->value);
+  chpl___TILDE_file(_ref_tmp_6, _ln, _fn);
+  chpl_here_free(((void*)(T7)), _ln, _fn);
+  chpl_check_nil(call_tmp19, INT64(2024), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_7 = &((call_tmp19)->value);
+  default_argend = max2(_ln, _fn);
+  default_arghints2 = IOHINT_NONE;
+  ret_to_arg_ref_tmp_3 = &default_argstyle2;
+  _style(_ref_tmp_7, ret_to_arg_ref_tmp_3, _ln, _fn);
+  ret_to_arg_ref_tmp_4 = &wrap_call_tmp3;
+  reader2(_ref_tmp_7, INT64(0), default_argend, default_arghints2, &default_argstyle2, ret_to_arg_ref_tmp_4, _ln, _fn);
+  call_tmp22 = chpl__initCopy4(&wrap_call_tmp3, _ln, _fn);
+  chpl_here_alloc_size4 = sizeof(chpl_heap_channel_F_dynamic_T_object);
+  chpl_here_alloc_tmp4 = chpl_here_alloc(chpl_here_alloc_size4, INT16(22), _ln, _fn);
+  T10 = ((heap_channel_F_dynamic_T)(chpl_here_alloc_tmp4));
+  T9 = T10;
+  chpl_check_nil(T9, INT64(2024), "/root/repo/modules/standard/IO.chpl");
+  (T9)->value = wrap_call_tmp3;
+  chpl_check_nil(T9, INT64(2024), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_8 = &((T9)->value);
+  chpl___TILDE_channel(_ref_tmp_8, _ln, _fn);
+  chpl_here_free(((void*)(T9)), _ln, _fn);
+  chpl_check_nil(type_tmp6, INT64(2024), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_9 = &((type_tmp6)->value);
+  chpl_macro_tmp_870.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_870.addr = _ref_tmp_9;
+  T11 = chpl_macro_tmp_870;
+  chpl___ASSIGN_4(&T11, &call_tmp22, _ln, _fn);
+  chpl_check_nil(type_tmp6, INT64(2024), "/root/repo/modules/standard/IO.chpl");
+  T12 = (type_tmp6)->value;
+  chpl_here_alloc_size5 = sizeof(chpl_heap_channel_F_dynamic_T_object);
+  chpl_here_alloc_tmp5 = chpl_here_alloc(chpl_here_alloc_size5, INT16(22), _ln, _fn);
+  T14 = ((heap_channel_F_dynamic_T)(chpl_here_alloc_tmp5));
+  T13 = T14;
+  chpl_check_nil(T13, INT64(2024), "/root/repo/modules/standard/IO.chpl");
+  (T13)->value = call_tmp22;
+  chpl_check_nil(T13, INT64(2024), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_10 = &((T13)->value);
+  chpl___TILDE_channel(_ref_tmp_10, _ln, _fn);
+  chpl_here_free(((void*)(T13)), _ln, _fn);
+  chpl_check_nil(call_tmp19, INT64(2024), "/root/repo/modules/standard/IO.chpl");
+  T15 = (call_tmp19)->value;
+  chpl_here_alloc_size6 = sizeof(chpl_heap_file_object);
+  chpl_here_alloc_tmp6 = chpl_here_alloc(chpl_here_alloc_size6, INT16(22), _ln, _fn);
+  T17 = ((heap_file)(chpl_here_alloc_tmp6));
+  T16 = T17;
+  chpl_check_nil(T16, INT64(2024), "/root/repo/modules/standard/IO.chpl");
+  (T16)->value = T15;
+  chpl_check_nil(T16, INT64(2024), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_11 = &((T16)->value);
+  chpl___TILDE_file(_ref_tmp_11, _ln, _fn);
+  chpl_here_free(((void*)(T16)), _ln, _fn);
+  chpl_here_free(((void*)(type_tmp6)), _ln, _fn);
+  chpl_here_free(((void*)(call_tmp19)), _ln, _fn);
+  stdin2 = T12;
+  chpl_comm_broadcast_private(INT64(28), sizeof(channel_F_dynamic_T), -1);
+  chpl_here_alloc_size7 = sizeof(chpl_heap_channel_T_dynamic_T_object);
+  chpl_here_alloc_tmp7 = chpl_here_alloc(chpl_here_alloc_size7, INT16(22), _ln, _fn);
+  T18 = ((heap_channel_T_dynamic_T)(chpl_here_alloc_tmp7));
+  type_tmp7 = T18;
+  T19 = nil;
+  chpl_macro_tmp_871.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_871.addr = T19;
+  T20 = chpl_macro_tmp_871;
+  (&this8)->home = T20;
+  T21 = ((locale)(nil));
+  call_tmp23 = T21;
+  chpl_macro_tmp_872.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_872.addr = call_tmp23;
+  T22 = chpl_macro_tmp_872;
+  (&this8)->home = T22;
+  default_arg_channel_internal2 = QIO_CHANNEL_PTR_NULL;
+  (&this8)->_channel_internal = default_arg_channel_internal2;
+  wrap_call_tmp4 = _construct_channel2(call_tmp23, default_arg_channel_internal2, &this8, _ln, _fn);
+  chpl_check_nil(type_tmp7, INT64(2025), "/root/repo/modules/standard/IO.chpl");
+  (type_tmp7)->value = wrap_call_tmp4;
+  call_tmp24 = chpl_cstdout();
+  chpl_here_alloc_size8 = sizeof(chpl_heap_file_object);
+  chpl_here_alloc_tmp8 = chpl_here_alloc(chpl_here_alloc_size8, INT16(22), _ln, _fn);
+  T23 = ((heap_file)(chpl_here_alloc_tmp8));
+  call_tmp25 = T23;
+  default_arghints3 = IOHINT_NONE;
+  ret_to_arg_ref_tmp_5 = &default_argstyle3;
+  defaultIOStyle(ret_to_arg_ref_tmp_5, _ln, _fn);
+  ret_to_arg_ref_tmp_6 = &wrap_call_tmp5;
+  openfp2(call_tmp24, default_arghints3, &default_argstyle3, ret_to_arg_ref_tmp_6, _ln, _fn);
+  call_tmp26 = chpl__initCopy3(&wrap_call_tmp5, _ln, _fn);
+  chpl_check_nil(call_tmp25, INT64(2025), "/root/repo/modules/standard/IO.chpl");
+  (call_tmp25)->value = call_tmp26;
+  chpl_here_alloc_size9 = sizeof(chpl_heap_file_object);
+  chpl_here_alloc_tmp9 = chpl_here_alloc(chpl_here_alloc_size9, INT16(22), _ln, _fn);
+  T25 = ((heap_file)(chpl_here_alloc_tmp9));
+  T24 = T25;
+  chpl_check_nil(T24, INT64(2025), "/root/repo/modules/standard/IO.chpl");
+  (T24)->value = wrap_call_tmp5;
+  chpl_check_nil(T24, INT64(2025), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_12 = &((T24)->value);
+  chpl___TILDE_file(_ref_tmp_12, _ln, _fn);
+  chpl_here_free(((void*)(T24)), _ln, _fn);
+  chpl_check_nil(call_tmp25, INT64(2025), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_13 = &((call_tmp25)->value);
+  default_argend2 = max2(_ln, _fn);
+  ret_to_arg_ref_tmp_7 = &default_argstyle4;
+  _style(_ref_tmp_13, ret_to_arg_ref_tmp_7, _ln, _fn);
+  call_tmp27 = ((int32_t)(INT64(0)));
+  ret_to_arg_ref_tmp_8 = &wrap_call_tmp6;
+  writer2(_ref_tmp_13, INT64(0), default_argend2, call_tmp27, &default_argstyle4, ret_to_arg_ref_tmp_8, _ln, _fn);
+  call_tmp28 = chpl__initCopy5(&wrap_call_tmp6, _ln, _fn);
+  chpl_here_alloc_size10 = sizeof(chpl_heap_channel_T_dynamic_T_object);
+  chpl_here_alloc_tmp10 = chpl_here_alloc(chpl_here_alloc_size10, INT16(22), _ln, _fn);
+  T27 = ((heap_channel_T_dynamic_T)(chpl_here_alloc_tmp10));
+  T26 = T27;
+  chpl_check_nil(T26, INT64(2025), "/root/repo/modules/standard/IO.chpl");
+  (T26)->value = wrap_call_tmp6;
+  chpl_check_nil(T26, INT64(2025), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_14 = &((T26)->value);
+  chpl___TILDE_channel2(_ref_tmp_14, _ln, _fn);
+  chpl_here_free(((void*)(T26)), _ln, _fn);
+  chpl_check_nil(type_tmp7, INT64(2025), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_15 = &((type_tmp7)->value);
+  chpl_macro_tmp_873.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_873.addr = _ref_tmp_15;
+  T28 = chpl_macro_tmp_873;
+  chpl___ASSIGN_5(&T28, &call_tmp28, _ln, _fn);
+  chpl_check_nil(type_tmp7, INT64(2025), "/root/repo/modules/standard/IO.chpl");
+  T29 = (type_tmp7)->value;
+  chpl_here_alloc_size11 = sizeof(chpl_heap_channel_T_dynamic_T_object);
+  chpl_here_alloc_tmp11 = chpl_here_alloc(chpl_here_alloc_size11, INT16(22), _ln, _fn);
+  T31 = ((heap_channel_T_dynamic_T)(chpl_here_alloc_tmp11));
+  T30 = T31;
+  chpl_check_nil(T30, INT64(2025), "/root/repo/modules/standard/IO.chpl");
+  (T30)->value = call_tmp28;
+  chpl_check_nil(T30, INT64(2025), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_16 = &((T30)->value);
+  chpl___TILDE_channel2(_ref_tmp_16, _ln, _fn);
+  chpl_here_free(((void*)(T30)), _ln, _fn);
+  chpl_check_nil(call_tmp25, INT64(2025), "/root/repo/modules/standard/IO.chpl");
+  T32 = (call_tmp25)->value;
+  chpl_here_alloc_size12 = sizeof(chpl_heap_file_object);
+  chpl_here_alloc_tmp12 = chpl_here_alloc(chpl_here_alloc_size12, INT16(22), _ln, _fn);
+  T34 = ((heap_file)(chpl_here_alloc_tmp12));
+  T33 = T34;
+  chpl_check_nil(T33, INT64(2025), "/root/repo/modules/standard/IO.chpl");
+  (T33)->value = T32;
+  chpl_check_nil(T33, INT64(2025), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_17 = &((T33)->value);
+  chpl___TILDE_file(_ref_tmp_17, _ln, _fn);
+  chpl_here_free(((void*)(T33)), _ln, _fn);
+  chpl_here_free(((void*)(type_tmp7)), _ln, _fn);
+  chpl_here_free(((void*)(call_tmp25)), _ln, _fn);
+  chpl_check_nil((&stdout2)->addr, INT64(2025), "/root/repo/modules/standard/IO.chpl");
+  chpl_macro_tmp_874.locale = (&stdout2)->locale;
+  chpl_macro_tmp_874.addr = &(((&stdout2)->addr)->value);
+  chpl_gen_comm_put(((void*)(&T29)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_874).locale), INT64(0), NULL), (chpl_macro_tmp_874).addr, sizeof(channel_T_dynamic_T), -1, INT64(1), INT64(2025), "/root/repo/modules/standard/IO.chpl");
+  chpl_comm_broadcast_private(INT64(29), sizeof(chpl____wide_heap_channel_T_dynamic_T), -1);
+  chpl_here_alloc_size13 = sizeof(chpl_heap_channel_T_dynamic_T_object);
+  chpl_here_alloc_tmp13 = chpl_here_alloc(chpl_here_alloc_size13, INT16(22), _ln, _fn);
+  T35 = ((heap_channel_T_dynamic_T)(chpl_here_alloc_tmp13));
+  type_tmp8 = T35;
+  T36 = nil;
+  chpl_macro_tmp_875.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_875.addr = T36;
+  T37 = chpl_macro_tmp_875;
+  (&this9)->home = T37;
+  T38 = ((locale)(nil));
+  call_tmp29 = T38;
+  chpl_macro_tmp_876.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_876.addr = call_tmp29;
+  T39 = chpl_macro_tmp_876;
+  (&this9)->home = T39;
+  default_arg_channel_internal3 = QIO_CHANNEL_PTR_NULL;
+  (&this9)->_channel_internal = default_arg_channel_internal3;
+  wrap_call_tmp7 = _construct_channel2(call_tmp29, default_arg_channel_internal3, &this9, _ln, _fn);
+  chpl_check_nil(type_tmp8, INT64(2026), "/root/repo/modules/standard/IO.chpl");
+  (type_tmp8)->value = wrap_call_tmp7;
+  call_tmp30 = chpl_cstderr();
+  chpl_here_alloc_size14 = sizeof(chpl_heap_file_object);
+  chpl_here_alloc_tmp14 = chpl_here_alloc(chpl_here_alloc_size14, INT16(22), _ln, _fn);
+  T40 = ((heap_file)(chpl_here_alloc_tmp14));
+  call_tmp31 = T40;
+  default_arghints4 = IOHINT_NONE;
+  ret_to_arg_ref_tmp_9 = &default_argstyle5;
+  defaultIOStyle(ret_to_arg_ref_tmp_9, _ln, _fn);
+  ret_to_arg_ref_tmp_10 = &wrap_call_tmp8;
+  openfp2(call_tmp30, default_arghints4, &default_argstyle5, ret_to_arg_ref_tmp_10, _ln, _fn);
+  call_tmp32 = chpl__initCopy3(&wrap_call_tmp8, _ln, _fn);
+  chpl_check_nil(call_tmp31, INT64(2026), "/root/repo/modules/standard/IO.chpl");
+  (call_tmp31)->value = call_tmp32;
+  chpl_here_alloc_size15 = sizeof(chpl_heap_file_object);
+  chpl_here_alloc_tmp15 = chpl_here_alloc(chpl_here_alloc_size15, INT16(22), _ln, _fn);
+  T42 = ((heap_file)(chpl_here_alloc_tmp15));
+  T41 = T42;
+  chpl_check_nil(T41, INT64(2026), "/root/repo/modules/standard/IO.chpl");
+  (T41)->value = wrap_call_tmp8;
+  chpl_check_nil(T41, INT64(2026), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_18 = &((T41)->value);
+  chpl___TILDE_file(_ref_tmp_18, _ln, _fn);
+  chpl_here_free(((void*)(T41)), _ln, _fn);
+  chpl_check_nil(call_tmp31, INT64(2026), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_19 = &((call_tmp31)->value);
+  default_argend3 = max2(_ln, _fn);
+  ret_to_arg_ref_tmp_11 = &default_argstyle6;
+  _style(_ref_tmp_19, ret_to_arg_ref_tmp_11, _ln, _fn);
+  call_tmp33 = ((int32_t)(INT64(0)));
+  ret_to_arg_ref_tmp_12 = &wrap_call_tmp9;
+  writer2(_ref_tmp_19, INT64(0), default_argend3, call_tmp33, &default_argstyle6, ret_to_arg_ref_tmp_12, _ln, _fn);
+  call_tmp34 = chpl__initCopy5(&wrap_call_tmp9, _ln, _fn);
+  chpl_here_alloc_size16 = sizeof(chpl_heap_channel_T_dynamic_T_object);
+  chpl_here_alloc_tmp16 = chpl_here_alloc(chpl_here_alloc_size16, INT16(22), _ln, _fn);
+  T44 = ((heap_channel_T_dynamic_T)(chpl_here_alloc_tmp16));
+  T43 = T44;
+  chpl_check_nil(T43, INT64(2026), "/root/repo/modules/standard/IO.chpl");
+  (T43)->value = wrap_call_tmp9;
+  chpl_check_nil(T43, INT64(2026), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_20 = &((T43)->value);
+  chpl___TILDE_channel2(_ref_tmp_20, _ln, _fn);
+  chpl_here_free(((void*)(T43)), _ln, _fn);
+  chpl_check_nil(type_tmp8, INT64(2026), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_21 = &((type_tmp8)->value);
+  chpl_macro_tmp_877.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_877.addr = _ref_tmp_21;
+  T45 = chpl_macro_tmp_877;
+  chpl___ASSIGN_5(&T45, &call_tmp34, _ln, _fn);
+  chpl_check_nil(type_tmp8, INT64(2026), "/root/repo/modules/standard/IO.chpl");
+  T46 = (type_tmp8)->value;
+  chpl_here_alloc_size17 = sizeof(chpl_heap_channel_T_dynamic_T_object);
+  chpl_here_alloc_tmp17 = chpl_here_alloc(chpl_here_alloc_size17, INT16(22), _ln, _fn);
+  T48 = ((heap_channel_T_dynamic_T)(chpl_here_alloc_tmp17));
+  T47 = T48;
+  chpl_check_nil(T47, INT64(2026), "/root/repo/modules/standard/IO.chpl");
+  (T47)->value = call_tmp34;
+  chpl_check_nil(T47, INT64(2026), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_22 = &((T47)->value);
+  chpl___TILDE_channel2(_ref_tmp_22, _ln, _fn);
+  chpl_here_free(((void*)(T47)), _ln, _fn);
+  chpl_check_nil(call_tmp31, INT64(2026), "/root/repo/modules/standard/IO.chpl");
+  T49 = (call_tmp31)->value;
+  chpl_here_alloc_size18 = sizeof(chpl_heap_file_object);
+  chpl_here_alloc_tmp18 = chpl_here_alloc(chpl_here_alloc_size18, INT16(22), _ln, _fn);
+  T51 = ((heap_file)(chpl_here_alloc_tmp18));
+  T50 = T51;
+  chpl_check_nil(T50, INT64(2026), "/root/repo/modules/standard/IO.chpl");
+  (T50)->value = T49;
+  chpl_check_nil(T50, INT64(2026), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_23 = &((T50)->value);
+  chpl___TILDE_file(_ref_tmp_23, _ln, _fn);
+  chpl_here_free(((void*)(T50)), _ln, _fn);
+  chpl_here_free(((void*)(type_tmp8)), _ln, _fn);
+  chpl_here_free(((void*)(call_tmp31)), _ln, _fn);
+  stderr2 = T46;
+  chpl_comm_broadcast_private(INT64(30), sizeof(channel_T_dynamic_T), -1);
+  *(refIndentLevel) -= INT64(1);
+  _exit_chpl__init_IO:;
+  return;
+}
+
+/* IO.chpl:468 */
+static void defaultIOStyle(_ref_iostyle _retArg, int64_t _ln, c_string _fn) {
+  iostyle ret;
+  iostyle type_tmp;
+  _ref_iostyle _ref_tmp_ = NULL;
+  _ref_iostyle T = NULL;
+  ret = type_tmp;
+  _ref_tmp_ = &ret;
+  T = _ref_tmp_;
+  qio_style_init_default(T);
+  _ref_tmp_ = T;
+  *(_retArg) = ret;
+  return;
+}
+
+/* IO.chpl:528 */
+static file _construct_file(chpl____wide_locale* const home, qio_file_ptr_t _file_internal, file* const meme, int64_t _ln, c_string _fn) {
+  file this6;
+  this6 = *(meme);
+  (&this6)->home = *(home);
+  (&this6)->_file_internal = _file_internal;
+  return this6;
+}
+
+/* IO.chpl:535 */
+static file chpl__initCopy3(file* const x2, int64_t _ln, c_string _fn) {
+  heap_file T = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_file T2 = NULL;
+  _ref_file _ref_tmp_ = NULL;
+  _ref_locale call_tmp = NULL;
+  chpl_localeID_t call_tmp2;
+  chpl____wide_locale T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_file T4 = NULL;
+  _class_localson_fn38 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_file T5 = {CHPL_LOCALEID_T_INIT, NULL};
+  file T6;
+  chpl____wide__ref_file chpl_macro_tmp_878;
+  chpl_here_alloc_size = sizeof(chpl_heap_file_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T2 = ((heap_file)(chpl_here_alloc_tmp));
+  T = T2;
+  chpl_check_nil(T, INT64(535), "/root/repo/modules/standard/IO.chpl");
+  (T)->value = *(x2);
+  chpl_check_nil(T, INT64(536), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_ = &((T)->value);
+  chpl_check_nil(_ref_tmp_, INT64(536), "/root/repo/modules/standard/IO.chpl");
+  call_tmp = &((_ref_tmp_)->home);
+  T3 = *(call_tmp);
+  call_tmp2 = (&T3)->locale;
+  chpl_check_nil(T, INT64(535), "/root/repo/modules/standard/IO.chpl");
+  T4 = &((T)->value);
+  _args_size = sizeof(chpl__class_localson_fn38_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn38)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(536), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp2;
+  chpl_macro_tmp_878.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_878.addr = T4;
+  T5 = chpl_macro_tmp_878;
+  chpl_check_nil(_args_foron_fn, INT64(536), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_1__tmp = T5;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn38 ***/ chpl_executeOn(&call_tmp2, INT32(41), _args_foron_fn, sizeof(chpl__class_localson_fn38_object), INT64(536), "/root/repo/modules/standard/IO.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  chpl_check_nil(T, INT64(535), "/root/repo/modules/standard/IO.chpl");
+  T6 = (T)->value;
+  chpl_here_free(((void*)(T)), _ln, _fn);
+  return T6;
+}
+
+/* IO.chpl:536 */
+static void on_fn38(chpl____wide__ref_file* const x2, int64_t _ln, c_string _fn) {
+  qio_file_ptr_t ret;
+  chpl____wide__ref_qio_file_ptr_t chpl_macro_tmp_879;
+  chpl_macro_tmp_879.locale = (*(x2)).locale;
+  chpl_macro_tmp_879.addr = &(((*(x2)).addr)->_file_internal);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_879).locale), INT64(0), NULL), (chpl_macro_tmp_879).addr, sizeof(qio_file_ptr_t), -1, INT64(1), INT64(537), "/root/repo/modules/standard/IO.chpl");
+  qio_file_retain(ret);
+  return;
+}
+
+/* IO.chpl:536 */
+static void wrapon_fn38(_class_localson_fn38 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_file _1__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(536), "/root/repo/modules/standard/IO.chpl");
+  _1__tmp = (c)->_1__tmp;
+  on_fn38(&_1__tmp, _ln, _fn);
+  return;
+}
+
+/* IO.chpl:542 */
+static void chpl___ASSIGN_3(_ref_file ret, file* const x2, int64_t _ln, c_string _fn) {
+  heap_file T = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_file T2 = NULL;
+  _ref_file _ref_tmp_ = NULL;
+  _ref_locale call_tmp = NULL;
+  chpl_localeID_t call_tmp2;
+  chpl____wide_locale T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_file T4 = NULL;
+  _class_localson_fn39 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_file T5 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_locale call_tmp3 = NULL;
+  chpl_localeID_t call_tmp4;
+  chpl____wide_locale T6 = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn40 _args_foron_fn2 = NULL;
+  int64_t _args_size2;
+  chpl_opaque _args_alloc2;
+  chpl____wide__ref_file T7 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_locale call_tmp5 = NULL;
+  _ref_file _ref_tmp_2 = NULL;
+  chpl____wide_locale ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_qio_file_ptr_t call_tmp6 = NULL;
+  _ref_file _ref_tmp_3 = NULL;
+  qio_file_ptr_t ret3;
+  chpl____wide__ref_file chpl_macro_tmp_880;
+  chpl____wide__ref_file chpl_macro_tmp_881;
+  chpl_here_alloc_size = sizeof(chpl_heap_file_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T2 = ((heap_file)(chpl_here_alloc_tmp));
+  T = T2;
+  chpl_check_nil(T, INT64(542), "/root/repo/modules/standard/IO.chpl");
+  (T)->value = *(x2);
+  chpl_check_nil(T, INT64(544), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_ = &((T)->value);
+  chpl_check_nil(_ref_tmp_, INT64(544), "/root/repo/modules/standard/IO.chpl");
+  call_tmp = &((_ref_tmp_)->home);
+  T3 = *(call_tmp);
+  call_tmp2 = (&T3)->locale;
+  chpl_check_nil(T, INT64(542), "/root/repo/modules/standard/IO.chpl");
+  T4 = &((T)->value);
+  _args_size = sizeof(chpl__class_localson_fn39_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn39)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(544), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp2;
+  chpl_macro_tmp_880.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_880.addr = T4;
+  T5 = chpl_macro_tmp_880;
+  chpl_check_nil(_args_foron_fn, INT64(544), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_1__tmp = T5;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn39 ***/ chpl_executeOn(&call_tmp2, INT32(42), _args_foron_fn, sizeof(chpl__class_localson_fn39_object), INT64(544), "/root/repo/modules/standard/IO.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  chpl_check_nil(ret, INT64(548), "/root/repo/modules/standard/IO.chpl");
+  call_tmp3 = &((ret)->home);
+  T6 = *(call_tmp3);
+  call_tmp4 = (&T6)->locale;
+  _args_size2 = sizeof(chpl__class_localson_fn40_object);
+  _args_alloc2 = chpl_mem_allocPooled(_args_size2, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn2 = ((_class_localson_fn40)(_args_alloc2));
+  chpl_check_nil(_args_foron_fn2, INT64(548), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn2)->_0__tmp = call_tmp4;
+  chpl_macro_tmp_881.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_881.addr = ret;
+  T7 = chpl_macro_tmp_881;
+  chpl_check_nil(_args_foron_fn2, INT64(548), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn2)->_1_ret = T7;
+  (_args_foron_fn2)->_ln = _ln;
+  (_args_foron_fn2)->_fn = _fn;
+  /*** wrapon_fn40 ***/ chpl_executeOn(&call_tmp4, INT32(43), _args_foron_fn2, sizeof(chpl__class_localson_fn40_object), INT64(548), "/root/repo/modules/standard/IO.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn2)), _ln, _fn);
+  chpl_check_nil(ret, INT64(553), "/root/repo/modules/standard/IO.chpl");
+  call_tmp5 = &((ret)->home);
+  chpl_check_nil(T, INT64(553), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_2 = &((T)->value);
+  chpl_check_nil(_ref_tmp_2, INT64(553), "/root/repo/modules/standard/IO.chpl");
+  ret2 = (_ref_tmp_2)->home;
+  *(call_tmp5) = ret2;
+  chpl_check_nil(ret, INT64(554), "/root/repo/modules/standard/IO.chpl");
+  call_tmp6 = &((ret)->_file_internal);
+  chpl_check_nil(T, INT64(554), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_3 = &((T)->value);
+  chpl_check_nil(_ref_tmp_3, INT64(554), "/root/repo/modules/standard/IO.chpl");
+  ret3 = (_ref_tmp_3)->_file_internal;
+  *(call_tmp6) = ret3;
+  chpl_here_free(((void*)(T)), _ln, _fn);
+  return;
+}
+
+/* IO.chpl:544 */
+static void on_fn39(chpl____wide__ref_file* const x2, int64_t _ln, c_string _fn) {
+  qio_file_ptr_t ret;
+  chpl____wide__ref_qio_file_ptr_t chpl_macro_tmp_882;
+  chpl_macro_tmp_882.locale = (*(x2)).locale;
+  chpl_macro_tmp_882.addr = &(((*(x2)).addr)->_file_internal);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_882).locale), INT64(0), NULL), (chpl_macro_tmp_882).addr, sizeof(qio_file_ptr_t), -1, INT64(1), INT64(545), "/root/repo/modules/standard/IO.chpl");
+  qio_file_retain(ret);
+  return;
+}
+
+/* IO.chpl:544 */
+static void wrapon_fn39(_class_localson_fn39 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_file _1__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(544), "/root/repo/modules/standard/IO.chpl");
+  _1__tmp = (c)->_1__tmp;
+  on_fn39(&_1__tmp, _ln, _fn);
+  return;
+}
+
+/* IO.chpl:548 */
+static void on_fn40(chpl____wide__ref_file* const ret, int64_t _ln, c_string _fn) {
+  qio_file_ptr_t ret2;
+  chpl____wide__ref_qio_file_ptr_t chpl_macro_tmp_883;
+  chpl_macro_tmp_883.locale = (*(ret)).locale;
+  chpl_macro_tmp_883.addr = &(((*(ret)).addr)->_file_internal);
+  chpl_gen_comm_get(((void*)(&ret2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_883).locale), INT64(0), NULL), (chpl_macro_tmp_883).addr, sizeof(qio_file_ptr_t), -1, INT64(1), INT64(549), "/root/repo/modules/standard/IO.chpl");
+  qio_file_release(ret2);
+  return;
+}
+
+/* IO.chpl:548 */
+static void wrapon_fn40(_class_localson_fn40 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_file _1_ret = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(548), "/root/repo/modules/standard/IO.chpl");
+  _1_ret = (c)->_1_ret;
+  on_fn40(&_1_ret, _ln, _fn);
+  return;
+}
+
+/* IO.chpl:557 */
+static void check(_ref_file this6, int64_t _ln, c_string _fn) {
+  qio_file_ptr_t ret;
+  chpl_bool call_tmp;
+  c_string T;
+  chpl_check_nil(this6, INT64(558), "/root/repo/modules/standard/IO.chpl");
+  ret = (this6)->_file_internal;
+  call_tmp = is_c_nil(ret);
+  if (call_tmp) {
+    T = "Operation attempted on an invalid file";
+    halt(T, _ln, _fn);
+  }
+  return;
+}
+
+/* IO.chpl:563 */
+static void chpl___TILDE_file(_ref_file this6, int64_t _ln, c_string _fn) {
+  _ref_locale call_tmp = NULL;
+  chpl_localeID_t call_tmp2;
+  chpl____wide_locale T = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn41 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_file T2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_file chpl_macro_tmp_884;
+  chpl_check_nil(this6, INT64(564), "/root/repo/modules/standard/IO.chpl");
+  call_tmp = &((this6)->home);
+  T = *(call_tmp);
+  call_tmp2 = (&T)->locale;
+  _args_size = sizeof(chpl__class_localson_fn41_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn41)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(564), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp2;
+  chpl_macro_tmp_884.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_884.addr = this6;
+  T2 = chpl_macro_tmp_884;
+  chpl_check_nil(_args_foron_fn, INT64(564), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_1_this = T2;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn41 ***/ chpl_executeOn(&call_tmp2, INT32(44), _args_foron_fn, sizeof(chpl__class_localson_fn41_object), INT64(564), "/root/repo/modules/standard/IO.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  return;
+}
+
+/* IO.chpl:564 */
+static void on_fn41(chpl____wide__ref_file* const this6, int64_t _ln, c_string _fn) {
+  qio_file_ptr_t local_QIO_FILE_PTR_NULL;
+  qio_file_ptr_t ret;
+  chpl____wide__ref_qio_file_ptr_t call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_qio_file_ptr_t chpl_macro_tmp_885;
+  chpl____wide__ref_qio_file_ptr_t chpl_macro_tmp_886;
+  local_QIO_FILE_PTR_NULL = QIO_FILE_PTR_NULL;
+  chpl_macro_tmp_885.locale = (*(this6)).locale;
+  chpl_macro_tmp_885.addr = &(((*(this6)).addr)->_file_internal);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_885).locale), INT64(0), NULL), (chpl_macro_tmp_885).addr, sizeof(qio_file_ptr_t), -1, INT64(1), INT64(565), "/root/repo/modules/standard/IO.chpl");
+  qio_file_release(ret);
+  chpl_macro_tmp_886.locale = (*(this6)).locale;
+  chpl_macro_tmp_886.addr = &(((*(this6)).addr)->_file_internal);
+  call_tmp = chpl_macro_tmp_886;
+  chpl_gen_comm_put(((void*)(&local_QIO_FILE_PTR_NULL)), chpl_nodeFromLocaleID(&((call_tmp).locale), INT64(0), NULL), (call_tmp).addr, sizeof(qio_file_ptr_t), -1, INT64(1), INT64(566), "/root/repo/modules/standard/IO.chpl");
+  return;
+}
+
+/* IO.chpl:564 */
+static void wrapon_fn41(_class_localson_fn41 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_file _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(564), "/root/repo/modules/standard/IO.chpl");
+  _1_this = (c)->_1_this;
+  on_fn41(&_1_this, _ln, _fn);
+  return;
+}
+
+/* IO.chpl:589 */
+static void _style(_ref_file this6, _ref_iostyle _retArg, int64_t _ln, c_string _fn) {
+  heap_iostyle ret = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_iostyle T = NULL;
+  iostyle type_tmp;
+  _ref_locale call_tmp = NULL;
+  chpl_localeID_t call_tmp2;
+  chpl____wide_locale T2 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_iostyle T3 = NULL;
+  _class_localson_fn42 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_file T4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_iostyle T5 = {CHPL_LOCALEID_T_INIT, NULL};
+  iostyle T6;
+  chpl____wide__ref_file chpl_macro_tmp_887;
+  chpl____wide__ref_iostyle chpl_macro_tmp_888;
+  check(this6, _ln, _fn);
+  chpl_here_alloc_size = sizeof(chpl_heap_iostyle_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T = ((heap_iostyle)(chpl_here_alloc_tmp));
+  ret = T;
+  chpl_check_nil(ret, INT64(592), "/root/repo/modules/standard/IO.chpl");
+  (ret)->value = type_tmp;
+  chpl_check_nil(this6, INT64(593), "/root/repo/modules/standard/IO.chpl");
+  call_tmp = &((this6)->home);
+  T2 = *(call_tmp);
+  call_tmp2 = (&T2)->locale;
+  chpl_check_nil(ret, INT64(592), "/root/repo/modules/standard/IO.chpl");
+  T3 = &((ret)->value);
+  _args_size = sizeof(chpl__class_localson_fn42_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn42)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(593), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp2;
+  chpl_macro_tmp_887.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_887.addr = this6;
+  T4 = chpl_macro_tmp_887;
+  chpl_check_nil(_args_foron_fn, INT64(593), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_1_this = T4;
+  chpl_macro_tmp_888.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_888.addr = T3;
+  T5 = chpl_macro_tmp_888;
+  chpl_check_nil(_args_foron_fn, INT64(593), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_2__tmp = T5;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn42 ***/ chpl_executeOn(&call_tmp2, INT32(45), _args_foron_fn, sizeof(chpl__class_localson_fn42_object), INT64(593), "/root/repo/modules/standard/IO.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  chpl_check_nil(ret, INT64(592), "/root/repo/modules/standard/IO.chpl");
+  T6 = (ret)->value;
+  *(_retArg) = T6;
+  chpl_here_free(((void*)(ret)), _ln, _fn);
+  return;
+}
+
+/* IO.chpl:593 */
+static void on_fn42(chpl____wide__ref_file* const this6, chpl____wide__ref_iostyle* const ret, int64_t _ln, c_string _fn) {
+  iostyle local_style;
+  iostyle type_tmp;
+  qio_file_ptr_t ret2;
+  _ref_iostyle _ref_tmp_ = NULL;
+  _ref_iostyle T = NULL;
+  chpl____wide__ref_qio_file_ptr_t chpl_macro_tmp_889;
+  local_style = type_tmp;
+  chpl_macro_tmp_889.locale = (*(this6)).locale;
+  chpl_macro_tmp_889.addr = &(((*(this6)).addr)->_file_internal);
+  chpl_gen_comm_get(((void*)(&ret2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_889).locale), INT64(0), NULL), (chpl_macro_tmp_889).addr, sizeof(qio_file_ptr_t), -1, INT64(1), INT64(595), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_ = &local_style;
+  T = _ref_tmp_;
+  qio_file_get_style(ret2, T);
+  _ref_tmp_ = T;
+  chpl_gen_comm_put(((void*)(&local_style)), chpl_nodeFromLocaleID(&((*(ret)).locale), INT64(0), NULL), (*(ret)).addr, sizeof(iostyle), -1, INT64(1), INT64(596), "/root/repo/modules/standard/IO.chpl");
+  return;
+}
+
+/* IO.chpl:593 */
+static void wrapon_fn42(_class_localson_fn42 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_file _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_iostyle _2__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(593), "/root/repo/modules/standard/IO.chpl");
+  _1_this = (c)->_1_this;
+  chpl_check_nil(c, INT64(593), "/root/repo/modules/standard/IO.chpl");
+  _2__tmp = (c)->_2__tmp;
+  on_fn42(&_1_this, &_2__tmp, _ln, _fn);
+  return;
+}
+
+/* IO.chpl:631 */
+static chpl____wide_chpl_string getPath(_ref_file this6, chpl____wide__ref_syserr* const error, int64_t _ln, c_string _fn) {
+  heap_syserr _formal_tmp_error = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_syserr T = NULL;
+  chpl____wide_chpl_string ret = {CHPL_LOCALEID_T_INIT, NULL};
+  heap_chpl_string ret2 = NULL;
+  int64_t chpl_here_alloc_size2;
+  chpl_opaque chpl_here_alloc_tmp2;
+  heap_chpl_string T2 = NULL;
+  chpl_string ret3;
+  chpl____wide_chpl_string T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_locale call_tmp = NULL;
+  chpl_localeID_t call_tmp2;
+  chpl____wide_locale T4 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_syserr T5 = NULL;
+  _ref_chpl_string T6 = NULL;
+  _class_localson_fn43 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_file T7 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_syserr T8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_chpl_string T9 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_chpl_string T10 = {CHPL_LOCALEID_T_INIT, NULL};
+  syserr T11;
+  chpl____wide__ref_file chpl_macro_tmp_890;
+  chpl____wide__ref_syserr chpl_macro_tmp_891;
+  chpl____wide__ref_chpl_string chpl_macro_tmp_892;
+  chpl_here_alloc_size = sizeof(chpl_heap_syserr_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T = ((heap_syserr)(chpl_here_alloc_tmp));
+  _formal_tmp_error = T;
+  check(this6, _ln, _fn);
+  chpl_here_alloc_size2 = sizeof(chpl_heap_chpl_string_object);
+  chpl_here_alloc_tmp2 = chpl_here_alloc(chpl_here_alloc_size2, INT16(22), _ln, _fn);
+  T2 = ((heap_chpl_string)(chpl_here_alloc_tmp2));
+  ret2 = T2;
+  ret3 = defaultStringValue;
+  chpl_string_widen(&T3, ret3, _ln, _fn);
+  chpl_check_nil(ret2, INT64(633), "/root/repo/modules/standard/IO.chpl");
+  (ret2)->value = T3;
+  chpl_check_nil(this6, INT64(634), "/root/repo/modules/standard/IO.chpl");
+  call_tmp = &((this6)->home);
+  T4 = *(call_tmp);
+  call_tmp2 = (&T4)->locale;
+  chpl_check_nil(_formal_tmp_error, INT64(631), "/root/repo/modules/standard/IO.chpl");
+  T5 = &((_formal_tmp_error)->value);
+  chpl_check_nil(ret2, INT64(633), "/root/repo/modules/standard/IO.chpl");
+  T6 = &((ret2)->value);
+  _args_size = sizeof(chpl__class_localson_fn43_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn43)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(634), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp2;
+  chpl_macro_tmp_890.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_890.addr = this6;
+  T7 = chpl_macro_tmp_890;
+  chpl_check_nil(_args_foron_fn, INT64(634), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_1_this = T7;
+  chpl_macro_tmp_891.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_891.addr = T5;
+  T8 = chpl_macro_tmp_891;
+  chpl_check_nil(_args_foron_fn, INT64(634), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_2__tmp = T8;
+  chpl_macro_tmp_892.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_892.addr = T6;
+  T9 = chpl_macro_tmp_892;
+  chpl_check_nil(_args_foron_fn, INT64(634), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_3__tmp = T9;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn43 ***/ chpl_executeOn(&call_tmp2, INT32(46), _args_foron_fn, sizeof(chpl__class_localson_fn43_object), INT64(634), "/root/repo/modules/standard/IO.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  chpl_check_nil(ret2, INT64(633), "/root/repo/modules/standard/IO.chpl");
+  T10 = (ret2)->value;
+  ret = T10;
+  chpl_check_nil(_formal_tmp_error, INT64(631), "/root/repo/modules/standard/IO.chpl");
+  T11 = (_formal_tmp_error)->value;
+  chpl_gen_comm_put(((void*)(&T11)), chpl_nodeFromLocaleID(&((*(error)).locale), INT64(0), NULL), (*(error)).addr, sizeof(syserr), -1, INT64(1), INT64(631), "/root/repo/modules/standard/IO.chpl");
+  chpl_here_free(((void*)(_formal_tmp_error)), _ln, _fn);
+  chpl_here_free(((void*)(ret2)), _ln, _fn);
+  return ret;
+}
+
+/* IO.chpl:634 */
+static void on_fn43(chpl____wide__ref_file* const this6, chpl____wide__ref_syserr* const _formal_tmp_error, chpl____wide__ref_chpl_string* const ret, int64_t _ln, c_string _fn) {
+  c_string_copy tmp;
+  c_string_copy ret2;
+  c_string_copy tmp2;
+  c_string_copy ret3;
+  qio_file_ptr_t ret4;
+  syserr call_tmp;
+  _ref_c_string_copy _ref_tmp_ = NULL;
+  _ref_c_string_copy T = NULL;
+  syserr T2;
+  int32_t call_tmp2;
+  chpl_bool call_tmp3;
+  qio_file_ptr_t ret5;
+  syserr call_tmp4;
+  c_string call_tmp5;
+  _ref_c_string_copy _ref_tmp_2 = NULL;
+  _ref_c_string_copy T3 = NULL;
+  _ref_c_string_copy _ref_tmp_3 = NULL;
+  c_string call_tmp6;
+  c_string call_tmp7;
+  int64_t call_tmp8;
+  chpl_bool call_tmp9;
+  _ref_c_string_copy T4 = NULL;
+  syserr T5;
+  int32_t call_tmp10;
+  chpl_bool call_tmp11;
+  _ref_c_string_copy _ref_tmp_4 = NULL;
+  chpl_string call_tmp12;
+  _ref_c_string_copy T6 = NULL;
+  chpl____wide_chpl_string T7 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_chpl_string call_tmp13 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_qio_file_ptr_t chpl_macro_tmp_893;
+  chpl____wide__ref_qio_file_ptr_t chpl_macro_tmp_894;
+  ret2 = NULL;
+  tmp = ret2;
+  ret3 = NULL;
+  tmp2 = ret3;
+  chpl_macro_tmp_893.locale = (*(this6)).locale;
+  chpl_macro_tmp_893.addr = &(((*(this6)).addr)->_file_internal);
+  chpl_gen_comm_get(((void*)(&ret4)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_893).locale), INT64(0), NULL), (chpl_macro_tmp_893).addr, sizeof(qio_file_ptr_t), -1, INT64(1), INT64(637), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_ = &tmp;
+  T = _ref_tmp_;
+  call_tmp = qio_file_path(ret4, T);
+  _ref_tmp_ = T;
+  chpl_gen_comm_put(((void*)(&call_tmp)), chpl_nodeFromLocaleID(&((*(_formal_tmp_error)).locale), INT64(0), NULL), (*(_formal_tmp_error)).addr, sizeof(syserr), -1, INT64(1), INT64(637), "/root/repo/modules/standard/IO.chpl");
+  chpl_gen_comm_get(((void*)(&T2)), chpl_nodeFromLocaleID(&((*(_formal_tmp_error)).locale), INT64(0), NULL), (*(_formal_tmp_error)).addr, sizeof(syserr), -1, INT64(1), INT64(638), "/root/repo/modules/standard/IO.chpl");
+  call_tmp2 = qio_err_iserr(T2);
+  call_tmp3 = (call_tmp2 == INT32(0));
+  if (call_tmp3) {
+    chpl_macro_tmp_894.locale = (*(this6)).locale;
+    chpl_macro_tmp_894.addr = &(((*(this6)).addr)->_file_internal);
+    chpl_gen_comm_get(((void*)(&ret5)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_894).locale), INT64(0), NULL), (chpl_macro_tmp_894).addr, sizeof(qio_file_ptr_t), -1, INT64(1), INT64(639), "/root/repo/modules/standard/IO.chpl");
+    call_tmp5 = ((c_string)(tmp));
+    _ref_tmp_2 = &tmp2;
+    T3 = _ref_tmp_2;
+    call_tmp4 = qio_shortest_path(ret5, T3, call_tmp5);
+    _ref_tmp_2 = T3;
+    chpl_gen_comm_put(((void*)(&call_tmp4)), chpl_nodeFromLocaleID(&((*(_formal_tmp_error)).locale), INT64(0), NULL), (*(_formal_tmp_error)).addr, sizeof(syserr), -1, INT64(1), INT64(639), "/root/repo/modules/standard/IO.chpl");
+  }
+  _ref_tmp_3 = &tmp;
+  call_tmp6 = ((c_string)(tmp));
+  call_tmp7 = ((c_string)(NULL));
+  call_tmp8 = string_compare(call_tmp6, call_tmp7);
+  call_tmp9 = (call_tmp8 != INT64(0));
+  if (call_tmp9) {
+    T4 = _ref_tmp_3;
+    chpl_rt_free_c_string(T4, _ln, _fn);
+    _ref_tmp_3 = T4;
+  }
+  chpl_gen_comm_get(((void*)(&T5)), chpl_nodeFromLocaleID(&((*(_formal_tmp_error)).locale), INT64(0), NULL), (*(_formal_tmp_error)).addr, sizeof(syserr), -1, INT64(1), INT64(642), "/root/repo/modules/standard/IO.chpl");
+  call_tmp10 = qio_err_iserr(T5);
+  call_tmp11 = (call_tmp10 == INT32(0));
+  if (call_tmp11) {
+    _ref_tmp_4 = &tmp2;
+    T6 = _ref_tmp_4;
+    call_tmp12 = string_from_c_string_copy(T6, false, INT64(0));
+    _ref_tmp_4 = T6;
+    chpl_string_widen(&T7, call_tmp12, _ln, _fn);
+    chpl_gen_comm_put(((void*)(&T7)), chpl_nodeFromLocaleID(&((*(ret)).locale), INT64(0), NULL), (*(ret)).addr, sizeof(chpl____wide_chpl_string), -1, INT64(1), INT64(645), "/root/repo/modules/standard/IO.chpl");
+  } else {
+    wide_string_from_c_string(&call_tmp13, "unknown", INT64(0), INT64(0), _ln, _fn);
+    chpl_gen_comm_put(((void*)(&call_tmp13)), chpl_nodeFromLocaleID(&((*(ret)).locale), INT64(0), NULL), (*(ret)).addr, sizeof(chpl____wide_chpl_string), -1, INT64(1), INT64(647), "/root/repo/modules/standard/IO.chpl");
+  }
+  return;
+}
+
+/* IO.chpl:634 */
+static void wrapon_fn43(_class_localson_fn43 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_file _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_syserr _2__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_chpl_string _3__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(634), "/root/repo/modules/standard/IO.chpl");
+  _1_this = (c)->_1_this;
+  chpl_check_nil(c, INT64(634), "/root/repo/modules/standard/IO.chpl");
+  _2__tmp = (c)->_2__tmp;
+  chpl_check_nil(c, INT64(634), "/root/repo/modules/standard/IO.chpl");
+  _3__tmp = (c)->_3__tmp;
+  on_fn43(&_1_this, &_2__tmp, &_3__tmp, _ln, _fn);
+  return;
+}
+
+/* IO.chpl:653 */
+static chpl____wide_chpl_string tryGetPath(_ref_file this6, int64_t _ln, c_string _fn) {
+  chpl____wide_chpl_string ret = {CHPL_LOCALEID_T_INIT, NULL};
+  syserr err;
+  syserr type_tmp;
+  _ref_syserr _ref_tmp_ = NULL;
+  syserr call_tmp;
+  chpl____wide_chpl_string call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_syserr _ref_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  int32_t call_tmp3;
+  chpl_bool call_tmp4;
+  _ref_chpl_string _ref_tmp_3 = NULL;
+  chpl____wide_chpl_string call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_syserr chpl_macro_tmp_895;
+  _ref_tmp_ = &type_tmp;
+  call_tmp = qio_int_to_err(INT32(0));
+  *(_ref_tmp_) = call_tmp;
+  err = type_tmp;
+  chpl_macro_tmp_895.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_895.addr = &err;
+  _ref_tmp_2 = chpl_macro_tmp_895;
+  call_tmp2 = getPath(this6, &_ref_tmp_2, _ln, _fn);
+  call_tmp3 = qio_err_iserr(err);
+  call_tmp4 = (call_tmp3 != INT32(0));
+  if (call_tmp4) {
+    _ref_tmp_3 = &ret;
+    wide_string_from_c_string(&call_tmp5, "unknown", INT64(0), INT64(0), _ln, _fn);
+    *(_ref_tmp_3) = call_tmp5;
+    goto _end_tryGetPath;
+  } else {
+    ret = call_tmp2;
+    goto _end_tryGetPath;
+  }
+  _end_tryGetPath:;
+  return ret;
+}
+
+/* IO.chpl:758 */
+static void openfd(int32_t fd, chpl____wide__ref_syserr* const error, int32_t hints, iostyle* const style, _ref_file _retArg, int64_t _ln, c_string _fn) {
+  qio_file_ptr_t local_QIO_FILE_PTR_NULL;
+  heap_file ret = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_file T = NULL;
+  file this6;
+  locale T2 = NULL;
+  chpl____wide_locale T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  int32_t call_tmp;
+  chpl_localeID_t call_tmp2;
+  _ref_chpl_localeID_t ret_to_arg_ref_tmp_ = NULL;
+  chpl_localeID_t call_tmp3;
+  chpl____wide_locale call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  qio_file_ptr_t default_arg_file_internal;
+  file wrap_call_tmp;
+  file T4;
+  iostyle local_style;
+  file ret2;
+  file this7;
+  locale T5 = NULL;
+  chpl____wide_locale T6 = {CHPL_LOCALEID_T_INIT, NULL};
+  int32_t call_tmp5;
+  chpl_localeID_t call_tmp6;
+  _ref_chpl_localeID_t ret_to_arg_ref_tmp_2 = NULL;
+  chpl_localeID_t call_tmp7;
+  chpl____wide_locale call_tmp8 = {CHPL_LOCALEID_T_INIT, NULL};
+  qio_file_ptr_t default_arg_file_internal2;
+  file wrap_call_tmp2;
+  _ref_locale call_tmp9 = NULL;
+  int32_t call_tmp10;
+  chpl_localeID_t call_tmp11;
+  _ref_chpl_localeID_t ret_to_arg_ref_tmp_3 = NULL;
+  chpl_localeID_t call_tmp12;
+  chpl____wide_locale call_tmp13 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_qio_file_ptr_t call_tmp14 = NULL;
+  _cfile call_tmp15;
+  syserr call_tmp16;
+  int32_t call_tmp17;
+  _ref_iostyle _ref_tmp_ = NULL;
+  _ref_qio_file_ptr_t T7 = NULL;
+  _ref_iostyle T8 = NULL;
+  _ref_file _ref_tmp_2 = NULL;
+  file T9;
+  heap_file T10 = NULL;
+  int64_t chpl_here_alloc_size2;
+  chpl_opaque chpl_here_alloc_tmp2;
+  heap_file T11 = NULL;
+  _ref_file _ref_tmp_3 = NULL;
+  file ret_to_arg_tmp_;
+  heap_file T12 = NULL;
+  int64_t chpl_here_alloc_size3;
+  chpl_opaque chpl_here_alloc_tmp3;
+  heap_file T13 = NULL;
+  _ref_file _ref_tmp_4 = NULL;
+  chpl____wide_locale chpl_macro_tmp_896;
+  chpl____wide_locale chpl_macro_tmp_897;
+  local_QIO_FILE_PTR_NULL = QIO_FILE_PTR_NULL;
+  chpl_here_alloc_size = sizeof(chpl_heap_file_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T = ((heap_file)(chpl_here_alloc_tmp));
+  ret = T;
+  T2 = nil;
+  chpl_macro_tmp_896.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_896.addr = T2;
+  T3 = chpl_macro_tmp_896;
+  (&this6)->home = T3;
+  call_tmp = chpl_task_getRequestedSubloc();
+  ret_to_arg_ref_tmp_ = &call_tmp2;
+  chpl_buildLocaleID(chpl_nodeID, call_tmp, ret_to_arg_ref_tmp_, _ln, _fn);
+  call_tmp3 = chpl__initCopy_chpl_rt_localeID_t(call_tmp2);
+  call_tmp4 = chpl_localeID_to_locale(&call_tmp3, _ln, _fn);
+  (&this6)->home = call_tmp4;
+  default_arg_file_internal = local_QIO_FILE_PTR_NULL;
+  (&this6)->_file_internal = default_arg_file_internal;
+  wrap_call_tmp = _construct_file(&call_tmp4, default_arg_file_internal, &this6, _ln, _fn);
+  chpl_check_nil(ret, INT64(758), "/root/repo/modules/standard/IO.chpl");
+  (ret)->value = wrap_call_tmp;
+  chpl_check_nil(ret, INT64(758), "/root/repo/modules/standard/IO.chpl");
+  T4 = (ret)->value;
+  *(_retArg) = chpl__initCopy3(&T4, _ln, _fn);
+  local_style = *(style);
+  T5 = nil;
+  chpl_macro_tmp_897.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_897.addr = T5;
+  T6 = chpl_macro_tmp_897;
+  (&this7)->home = T6;
+  call_tmp5 = chpl_task_getRequestedSubloc();
+  ret_to_arg_ref_tmp_2 = &call_tmp6;
+  chpl_buildLocaleID(chpl_nodeID, call_tmp5, ret_to_arg_ref_tmp_2, _ln, _fn);
+  call_tmp7 = chpl__initCopy_chpl_rt_localeID_t(call_tmp6);
+  call_tmp8 = chpl_localeID_to_locale(&call_tmp7, _ln, _fn);
+  (&this7)->home = call_tmp8;
+  default_arg_file_internal2 = local_QIO_FILE_PTR_NULL;
+  (&this7)->_file_internal = default_arg_file_internal2;
+  wrap_call_tmp2 = _construct_file(&call_tmp8, default_arg_file_internal2, &this7, _ln, _fn);
+  ret2 = wrap_call_tmp2;
+  call_tmp9 = &((&ret2)->home);
+  call_tmp10 = chpl_task_getRequestedSubloc();
+  ret_to_arg_ref_tmp_3 = &call_tmp11;
+  chpl_buildLocaleID(chpl_nodeID, call_tmp10, ret_to_arg_ref_tmp_3, _ln, _fn);
+  call_tmp12 = chpl__initCopy_chpl_rt_localeID_t(call_tmp11);
+  call_tmp13 = chpl_localeID_to_locale(&call_tmp12, _ln, _fn);
+  *(call_tmp9) = call_tmp13;
+  call_tmp14 = &((&ret2)->_file_internal);
+  call_tmp15 = chpl_cnullfile();
+  call_tmp17 = ((int32_t)(INT64(0)));
+  _ref_tmp_ = &local_style;
+  T7 = call_tmp14;
+  T8 = _ref_tmp_;
+  call_tmp16 = qio_file_init(T7, call_tmp15, fd, hints, T8, call_tmp17);
+  _ref_tmp_ = T8;
+  call_tmp14 = T7;
+  chpl_check_nil(ret, INT64(765), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_2 = &((ret)->value);
+  chpl___ASSIGN_3(_ref_tmp_2, &ret2, _ln, _fn);
+  chpl_check_nil(ret, INT64(758), "/root/repo/modules/standard/IO.chpl");
+  T9 = (ret)->value;
+  *(_retArg) = chpl__initCopy3(&T9, _ln, _fn);
+  chpl_gen_comm_put(((void*)(&call_tmp16)), chpl_nodeFromLocaleID(&((*(error)).locale), INT64(0), NULL), (*(error)).addr, sizeof(syserr), -1, INT64(1), INT64(758), "/root/repo/modules/standard/IO.chpl");
+  chpl_here_alloc_size2 = sizeof(chpl_heap_file_object);
+  chpl_here_alloc_tmp2 = chpl_here_alloc(chpl_here_alloc_size2, INT16(22), _ln, _fn);
+  T11 = ((heap_file)(chpl_here_alloc_tmp2));
+  T10 = T11;
+  chpl_check_nil(T10, INT64(760), "/root/repo/modules/standard/IO.chpl");
+  (T10)->value = ret2;
+  chpl_check_nil(T10, INT64(760), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_3 = &((T10)->value);
+  chpl___TILDE_file(_ref_tmp_3, _ln, _fn);
+  chpl_here_free(((void*)(T10)), _ln, _fn);
+  ret_to_arg_tmp_ = *(_retArg);
+  chpl_here_alloc_size3 = sizeof(chpl_heap_file_object);
+  chpl_here_alloc_tmp3 = chpl_here_alloc(chpl_here_alloc_size3, INT16(22), _ln, _fn);
+  T13 = ((heap_file)(chpl_here_alloc_tmp3));
+  T12 = T13;
+  chpl_check_nil(T12, INT64(758), "/root/repo/modules/standard/IO.chpl");
+  (T12)->value = ret_to_arg_tmp_;
+  chpl_check_nil(T12, INT64(758), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_4 = &((T12)->value);
+  chpl___TILDE_file(_ref_tmp_4, _ln, _fn);
+  chpl_here_free(((void*)(T12)), _ln, _fn);
+  chpl_here_free(((void*)(ret)), _ln, _fn);
+  return;
+}
+
+/* IO.chpl:767 */
+static void openfd2(int32_t fd, int32_t hints, iostyle* const style, _ref_file _retArg, int64_t _ln, c_string _fn) {
+  qio_file_ptr_t local_QIO_FILE_PTR_NULL;
+  heap_file ret = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_file T = NULL;
+  file this6;
+  locale T2 = NULL;
+  chpl____wide_locale T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  int32_t call_tmp;
+  chpl_localeID_t call_tmp2;
+  _ref_chpl_localeID_t ret_to_arg_ref_tmp_ = NULL;
+  chpl_localeID_t call_tmp3;
+  chpl____wide_locale call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  qio_file_ptr_t default_arg_file_internal;
+  file wrap_call_tmp;
+  file T4;
+  file call_tmp5;
+  syserr err;
+  syserr type_tmp;
+  _ref_syserr _ref_tmp_ = NULL;
+  syserr call_tmp6;
+  file ret2;
+  _ref_file ret_to_arg_ref_tmp_2 = NULL;
+  chpl____wide__ref_syserr _ref_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  int32_t call_tmp7;
+  chpl_bool call_tmp8;
+  c_string_copy path;
+  c_string_copy ret3;
+  syserr type_tmp2;
+  _ref_syserr _ref_tmp_3 = NULL;
+  syserr call_tmp9;
+  syserr call_tmp10;
+  _ref_c_string_copy _ref_tmp_4 = NULL;
+  _ref_c_string_copy T5 = NULL;
+  int32_t call_tmp11;
+  chpl_bool call_tmp12;
+  chpl____wide_chpl_string call_tmp13 = {CHPL_LOCALEID_T_INIT, NULL};
+  c_string call_tmp14;
+  _ref_c_string_copy _ref_tmp_5 = NULL;
+  c_string call_tmp15;
+  c_string call_tmp16;
+  int64_t call_tmp17;
+  chpl_bool call_tmp18;
+  _ref_c_string_copy T6 = NULL;
+  c_string_copy call_tmp19;
+  _ref_c_string_copy _ref_tmp_6 = NULL;
+  chpl_string call_tmp20;
+  _ref_c_string_copy T7 = NULL;
+  chpl____wide_chpl_string call_tmp21 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_chpl_string T8 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_file _ref_tmp_7 = NULL;
+  file T9;
+  file call_tmp22;
+  heap_file T10 = NULL;
+  int64_t chpl_here_alloc_size2;
+  chpl_opaque chpl_here_alloc_tmp2;
+  heap_file T11 = NULL;
+  _ref_file _ref_tmp_8 = NULL;
+  file ret_to_arg_tmp_;
+  heap_file T12 = NULL;
+  int64_t chpl_here_alloc_size3;
+  chpl_opaque chpl_here_alloc_tmp3;
+  heap_file T13 = NULL;
+  _ref_file _ref_tmp_9 = NULL;
+  chpl____wide_locale chpl_macro_tmp_898;
+  chpl____wide__ref_syserr chpl_macro_tmp_899;
+  local_QIO_FILE_PTR_NULL = QIO_FILE_PTR_NULL;
+  chpl_here_alloc_size = sizeof(chpl_heap_file_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T = ((heap_file)(chpl_here_alloc_tmp));
+  ret = T;
+  T2 = nil;
+  chpl_macro_tmp_898.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_898.addr = T2;
+  T3 = chpl_macro_tmp_898;
+  (&this6)->home = T3;
+  call_tmp = chpl_task_getRequestedSubloc();
+  ret_to_arg_ref_tmp_ = &call_tmp2;
+  chpl_buildLocaleID(chpl_nodeID, call_tmp, ret_to_arg_ref_tmp_, _ln, _fn);
+  call_tmp3 = chpl__initCopy_chpl_rt_localeID_t(call_tmp2);
+  call_tmp4 = chpl_localeID_to_locale(&call_tmp3, _ln, _fn);
+  (&this6)->home = call_tmp4;
+  default_arg_file_internal = local_QIO_FILE_PTR_NULL;
+  (&this6)->_file_internal = default_arg_file_internal;
+  wrap_call_tmp = _construct_file(&call_tmp4, default_arg_file_internal, &this6, _ln, _fn);
+  chpl_check_nil(ret, INT64(767), "/root/repo/modules/standard/IO.chpl");
+  (ret)->value = wrap_call_tmp;
+  chpl_check_nil(ret, INT64(767), "/root/repo/modules/standard/IO.chpl");
+  T4 = (ret)->value;
+  call_tmp5 = chpl__initCopy3(&T4, _ln, _fn);
+  *(_retArg) = call_tmp5;
+  _ref_tmp_ = &type_tmp;
+  call_tmp6 = qio_int_to_err(INT32(0));
+  *(_ref_tmp_) = call_tmp6;
+  err = type_tmp;
+  ret_to_arg_ref_tmp_2 = &ret2;
+  chpl_macro_tmp_899.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_899.addr = &err;
+  _ref_tmp_2 = chpl_macro_tmp_899;
+  openfd(fd, &_ref_tmp_2, hints, style, ret_to_arg_ref_tmp_2, _ln, _fn);
+  call_tmp7 = qio_err_iserr(err);
+  call_tmp8 = (call_tmp7 != INT32(0));
+  if (call_tmp8) {
+    ret3 = NULL;
+    path = ret3;
+    _ref_tmp_3 = &type_tmp2;
+    call_tmp9 = qio_int_to_err(INT32(0));
+    *(_ref_tmp_3) = call_tmp9;
+    _ref_tmp_4 = &path;
+    T5 = _ref_tmp_4;
+    call_tmp10 = qio_file_path_for_fd(fd, T5);
+    _ref_tmp_4 = T5;
+    call_tmp11 = qio_err_iserr(call_tmp10);
+    call_tmp12 = (call_tmp11 != INT32(0));
+    if (call_tmp12) {
+      wide_string_from_c_string(&call_tmp13, "unknown", INT64(0), INT64(0), _ln, _fn);
+      c_string_from_wide_string(&call_tmp14, &call_tmp13, _ln, _fn);
+      _ref_tmp_5 = &path;
+      call_tmp15 = ((c_string)(path));
+      call_tmp16 = ((c_string)(NULL));
+      call_tmp17 = string_compare(call_tmp15, call_tmp16);
+      call_tmp18 = (call_tmp17 != INT64(0));
+      if (call_tmp18) {
+        T6 = _ref_tmp_5;
+        chpl_rt_free_c_string(T6, _ln, _fn);
+        _ref_tmp_5 = T6;
+      }
+      call_tmp19 = string_copy(call_tmp14, _ln, _fn);
+      *(_ref_tmp_5) = call_tmp19;
+    }
+    _ref_tmp_6 = &path;
+    T7 = _ref_tmp_6;
+    call_tmp20 = string_from_c_string_copy(T7, false, INT64(0));
+    _ref_tmp_6 = T7;
+    wide_string_from_c_string(&call_tmp21, "in openfd", INT64(0), INT64(0), _ln, _fn);
+    chpl_string_widen(&T8, call_tmp20, _ln, _fn);
+    ioerror(err, call_tmp21, T8, _ln, _fn);
+  }
+  chpl_check_nil(ret, INT64(778), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_7 = &((ret)->value);
+  chpl___ASSIGN_3(_ref_tmp_7, &ret2, _ln, _fn);
+  chpl_check_nil(ret, INT64(767), "/root/repo/modules/standard/IO.chpl");
+  T9 = (ret)->value;
+  call_tmp22 = chpl__initCopy3(&T9, _ln, _fn);
+  *(_retArg) = call_tmp22;
+  chpl_here_alloc_size2 = sizeof(chpl_heap_file_object);
+  chpl_here_alloc_tmp2 = chpl_here_alloc(chpl_here_alloc_size2, INT16(22), _ln, _fn);
+  T11 = ((heap_file)(chpl_here_alloc_tmp2));
+  T10 = T11;
+  chpl_check_nil(T10, INT64(769), "/root/repo/modules/standard/IO.chpl");
+  (T10)->value = ret2;
+  chpl_check_nil(T10, INT64(769), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_8 = &((T10)->value);
+  chpl___TILDE_file(_ref_tmp_8, _ln, _fn);
+  chpl_here_free(((void*)(T10)), _ln, _fn);
+  ret_to_arg_tmp_ = *(_retArg);
+  chpl_here_alloc_size3 = sizeof(chpl_heap_file_object);
+  chpl_here_alloc_tmp3 = chpl_here_alloc(chpl_here_alloc_size3, INT16(22), _ln, _fn);
+  T13 = ((heap_file)(chpl_here_alloc_tmp3));
+  T12 = T13;
+  chpl_check_nil(T12, INT64(767), "/root/repo/modules/standard/IO.chpl");
+  (T12)->value = ret_to_arg_tmp_;
+  chpl_check_nil(T12, INT64(767), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_9 = &((T12)->value);
+  chpl___TILDE_file(_ref_tmp_9, _ln, _fn);
+  chpl_here_free(((void*)(T12)), _ln, _fn);
+  chpl_here_free(((void*)(ret)), _ln, _fn);
+  return;
+}
+
+/* IO.chpl:780 */
+static void openfp(_cfile fp, chpl____wide__ref_syserr* const error, int32_t hints, iostyle* const style, _ref_file _retArg, int64_t _ln, c_string _fn) {
+  qio_file_ptr_t local_QIO_FILE_PTR_NULL;
+  heap_file ret = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_file T = NULL;
+  file this6;
+  locale T2 = NULL;
+  chpl____wide_locale T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  int32_t call_tmp;
+  chpl_localeID_t call_tmp2;
+  _ref_chpl_localeID_t ret_to_arg_ref_tmp_ = NULL;
+  chpl_localeID_t call_tmp3;
+  chpl____wide_locale call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  qio_file_ptr_t default_arg_file_internal;
+  file wrap_call_tmp;
+  file T4;
+  iostyle local_style;
+  file ret2;
+  file this7;
+  locale T5 = NULL;
+  chpl____wide_locale T6 = {CHPL_LOCALEID_T_INIT, NULL};
+  int32_t call_tmp5;
+  chpl_localeID_t call_tmp6;
+  _ref_chpl_localeID_t ret_to_arg_ref_tmp_2 = NULL;
+  chpl_localeID_t call_tmp7;
+  chpl____wide_locale call_tmp8 = {CHPL_LOCALEID_T_INIT, NULL};
+  qio_file_ptr_t default_arg_file_internal2;
+  file wrap_call_tmp2;
+  _ref_locale call_tmp9 = NULL;
+  int32_t call_tmp10;
+  chpl_localeID_t call_tmp11;
+  _ref_chpl_localeID_t ret_to_arg_ref_tmp_3 = NULL;
+  chpl_localeID_t call_tmp12;
+  chpl____wide_locale call_tmp13 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_qio_file_ptr_t call_tmp14 = NULL;
+  syserr call_tmp15;
+  int32_t call_tmp16;
+  int32_t call_tmp17;
+  _ref_iostyle _ref_tmp_ = NULL;
+  _ref_qio_file_ptr_t T7 = NULL;
+  _ref_iostyle T8 = NULL;
+  _ref_file _ref_tmp_2 = NULL;
+  file T9;
+  heap_file T10 = NULL;
+  int64_t chpl_here_alloc_size2;
+  chpl_opaque chpl_here_alloc_tmp2;
+  heap_file T11 = NULL;
+  _ref_file _ref_tmp_3 = NULL;
+  file ret_to_arg_tmp_;
+  heap_file T12 = NULL;
+  int64_t chpl_here_alloc_size3;
+  chpl_opaque chpl_here_alloc_tmp3;
+  heap_file T13 = NULL;
+  _ref_file _ref_tmp_4 = NULL;
+  chpl____wide_locale chpl_macro_tmp_900;
+  chpl____wide_locale chpl_macro_tmp_901;
+  local_QIO_FILE_PTR_NULL = QIO_FILE_PTR_NULL;
+  chpl_here_alloc_size = sizeof(chpl_heap_file_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T = ((heap_file)(chpl_here_alloc_tmp));
+  ret = T;
+  T2 = nil;
+  chpl_macro_tmp_900.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_900.addr = T2;
+  T3 = chpl_macro_tmp_900;
+  (&this6)->home = T3;
+  call_tmp = chpl_task_getRequestedSubloc();
+  ret_to_arg_ref_tmp_ = &call_tmp2;
+  chpl_buildLocaleID(chpl_nodeID, call_tmp, ret_to_arg_ref_tmp_, _ln, _fn);
+  call_tmp3 = chpl__initCopy_chpl_rt_localeID_t(call_tmp2);
+  call_tmp4 = chpl_localeID_to_locale(&call_tmp3, _ln, _fn);
+  (&this6)->home = call_tmp4;
+  default_arg_file_internal = local_QIO_FILE_PTR_NULL;
+  (&this6)->_file_internal = default_arg_file_internal;
+  wrap_call_tmp = _construct_file(&call_tmp4, default_arg_file_internal, &this6, _ln, _fn);
+  chpl_check_nil(ret, INT64(780), "/root/repo/modules/standard/IO.chpl");
+  (ret)->value = wrap_call_tmp;
+  chpl_check_nil(ret, INT64(780), "/root/repo/modules/standard/IO.chpl");
+  T4 = (ret)->value;
+  *(_retArg) = chpl__initCopy3(&T4, _ln, _fn);
+  local_style = *(style);
+  T5 = nil;
+  chpl_macro_tmp_901.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_901.addr = T5;
+  T6 = chpl_macro_tmp_901;
+  (&this7)->home = T6;
+  call_tmp5 = chpl_task_getRequestedSubloc();
+  ret_to_arg_ref_tmp_2 = &call_tmp6;
+  chpl_buildLocaleID(chpl_nodeID, call_tmp5, ret_to_arg_ref_tmp_2, _ln, _fn);
+  call_tmp7 = chpl__initCopy_chpl_rt_localeID_t(call_tmp6);
+  call_tmp8 = chpl_localeID_to_locale(&call_tmp7, _ln, _fn);
+  (&this7)->home = call_tmp8;
+  default_arg_file_internal2 = local_QIO_FILE_PTR_NULL;
+  (&this7)->_file_internal = default_arg_file_internal2;
+  wrap_call_tmp2 = _construct_file(&call_tmp8, default_arg_file_internal2, &this7, _ln, _fn);
+  ret2 = wrap_call_tmp2;
+  call_tmp9 = &((&ret2)->home);
+  call_tmp10 = chpl_task_getRequestedSubloc();
+  ret_to_arg_ref_tmp_3 = &call_tmp11;
+  chpl_buildLocaleID(chpl_nodeID, call_tmp10, ret_to_arg_ref_tmp_3, _ln, _fn);
+  call_tmp12 = chpl__initCopy_chpl_rt_localeID_t(call_tmp11);
+  call_tmp13 = chpl_localeID_to_locale(&call_tmp12, _ln, _fn);
+  *(call_tmp9) = call_tmp13;
+  call_tmp14 = &((&ret2)->_file_internal);
+  call_tmp16 = ((int32_t)(INT64(-1)));
+  call_tmp17 = ((int32_t)(INT64(1)));
+  _ref_tmp_ = &local_style;
+  T7 = call_tmp14;
+  T8 = _ref_tmp_;
+  call_tmp15 = qio_file_init(T7, fp, call_tmp16, hints, T8, call_tmp17);
+  _ref_tmp_ = T8;
+  call_tmp14 = T7;
+  chpl_check_nil(ret, INT64(787), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_2 = &((ret)->value);
+  chpl___ASSIGN_3(_ref_tmp_2, &ret2, _ln, _fn);
+  chpl_check_nil(ret, INT64(780), "/root/repo/modules/standard/IO.chpl");
+  T9 = (ret)->value;
+  *(_retArg) = chpl__initCopy3(&T9, _ln, _fn);
+  chpl_gen_comm_put(((void*)(&call_tmp15)), chpl_nodeFromLocaleID(&((*(error)).locale), INT64(0), NULL), (*(error)).addr, sizeof(syserr), -1, INT64(1), INT64(780), "/root/repo/modules/standard/IO.chpl");
+  chpl_here_alloc_size2 = sizeof(chpl_heap_file_object);
+  chpl_here_alloc_tmp2 = chpl_here_alloc(chpl_here_alloc_size2, INT16(22), _ln, _fn);
+  T11 = ((heap_file)(chpl_here_alloc_tmp2));
+  T10 = T11;
+  chpl_check_nil(T10, INT64(782), "/root/repo/modules/standard/IO.chpl");
+  (T10)->value = ret2;
+  chpl_check_nil(T10, INT64(782), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_3 = &((T10)->value);
+  chpl___TILDE_file(_ref_tmp_3, _ln, _fn);
+  chpl_here_free(((void*)(T10)), _ln, _fn);
+  ret_to_arg_tmp_ = *(_retArg);
+  chpl_here_alloc_size3 = sizeof(chpl_heap_file_object);
+  chpl_here_alloc_tmp3 = chpl_here_alloc(chpl_here_alloc_size3, INT16(22), _ln, _fn);
+  T13 = ((heap_file)(chpl_here_alloc_tmp3));
+  T12 = T13;
+  chpl_check_nil(T12, INT64(780), "/root/repo/modules/standard/IO.chpl");
+  (T12)->value = ret_to_arg_tmp_;
+  chpl_check_nil(T12, INT64(780), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_4 = &((T12)->value);
+  chpl___TILDE_file(_ref_tmp_4, _ln, _fn);
+  chpl_here_free(((void*)(T12)), _ln, _fn);
+  chpl_here_free(((void*)(ret)), _ln, _fn);
+  return;
+}
+
+/* IO.chpl:789 */
+static void openfp2(_cfile fp, int32_t hints, iostyle* const style, _ref_file _retArg, int64_t _ln, c_string _fn) {
+  qio_file_ptr_t local_QIO_FILE_PTR_NULL;
+  heap_file ret = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_file T = NULL;
+  file this6;
+  locale T2 = NULL;
+  chpl____wide_locale T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  int32_t call_tmp;
+  chpl_localeID_t call_tmp2;
+  _ref_chpl_localeID_t ret_to_arg_ref_tmp_ = NULL;
+  chpl_localeID_t call_tmp3;
+  chpl____wide_locale call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  qio_file_ptr_t default_arg_file_internal;
+  file wrap_call_tmp;
+  file T4;
+  file call_tmp5;
+  syserr err;
+  syserr type_tmp;
+  _ref_syserr _ref_tmp_ = NULL;
+  syserr call_tmp6;
+  file ret2;
+  _ref_file ret_to_arg_ref_tmp_2 = NULL;
+  chpl____wide__ref_syserr _ref_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  int32_t call_tmp7;
+  chpl_bool call_tmp8;
+  c_string_copy path;
+  c_string_copy ret3;
+  syserr type_tmp2;
+  _ref_syserr _ref_tmp_3 = NULL;
+  syserr call_tmp9;
+  syserr call_tmp10;
+  _ref_c_string_copy _ref_tmp_4 = NULL;
+  _ref_c_string_copy T5 = NULL;
+  int32_t call_tmp11;
+  chpl_bool call_tmp12;
+  chpl____wide_chpl_string call_tmp13 = {CHPL_LOCALEID_T_INIT, NULL};
+  c_string call_tmp14;
+  _ref_c_string_copy _ref_tmp_5 = NULL;
+  c_string call_tmp15;
+  c_string call_tmp16;
+  int64_t call_tmp17;
+  chpl_bool call_tmp18;
+  _ref_c_string_copy T6 = NULL;
+  c_string_copy call_tmp19;
+  _ref_c_string_copy _ref_tmp_6 = NULL;
+  chpl_string call_tmp20;
+  _ref_c_string_copy T7 = NULL;
+  chpl____wide_chpl_string call_tmp21 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_chpl_string T8 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_file _ref_tmp_7 = NULL;
+  file T9;
+  file call_tmp22;
+  heap_file T10 = NULL;
+  int64_t chpl_here_alloc_size2;
+  chpl_opaque chpl_here_alloc_tmp2;
+  heap_file T11 = NULL;
+  _ref_file _ref_tmp_8 = NULL;
+  file ret_to_arg_tmp_;
+  heap_file T12 = NULL;
+  int64_t chpl_here_alloc_size3;
+  chpl_opaque chpl_here_alloc_tmp3;
+  heap_file T13 = NULL;
+  _ref_file _ref_tmp_9 = NULL;
+  chpl____wide_locale chpl_macro_tmp_902;
+  chpl____wide__ref_syserr chpl_macro_tmp_903;
+  local_QIO_FILE_PTR_NULL = QIO_FILE_PTR_NULL;
+  chpl_here_alloc_size = sizeof(chpl_heap_file_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T = ((heap_file)(chpl_here_alloc_tmp));
+  ret = T;
+  T2 = nil;
+  chpl_macro_tmp_902.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_902.addr = T2;
+  T3 = chpl_macro_tmp_902;
+  (&this6)->home = T3;
+  call_tmp = chpl_task_getRequestedSubloc();
+  ret_to_arg_ref_tmp_ = &call_tmp2;
+  chpl_buildLocaleID(chpl_nodeID, call_tmp, ret_to_arg_ref_tmp_, _ln, _fn);
+  call_tmp3 = chpl__initCopy_chpl_rt_localeID_t(call_tmp2);
+  call_tmp4 = chpl_localeID_to_locale(&call_tmp3, _ln, _fn);
+  (&this6)->home = call_tmp4;
+  default_arg_file_internal = local_QIO_FILE_PTR_NULL;
+  (&this6)->_file_internal = default_arg_file_internal;
+  wrap_call_tmp = _construct_file(&call_tmp4, default_arg_file_internal, &this6, _ln, _fn);
+  chpl_check_nil(ret, INT64(789), "/root/repo/modules/standard/IO.chpl");
+  (ret)->value = wrap_call_tmp;
+  chpl_check_nil(ret, INT64(789), "/root/repo/modules/standard/IO.chpl");
+  T4 = (ret)->value;
+  call_tmp5 = chpl__initCopy3(&T4, _ln, _fn);
+  *(_retArg) = call_tmp5;
+  _ref_tmp_ = &type_tmp;
+  call_tmp6 = qio_int_to_err(INT32(0));
+  *(_ref_tmp_) = call_tmp6;
+  err = type_tmp;
+  ret_to_arg_ref_tmp_2 = &ret2;
+  chpl_macro_tmp_903.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_903.addr = &err;
+  _ref_tmp_2 = chpl_macro_tmp_903;
+  openfp(fp, &_ref_tmp_2, hints, style, ret_to_arg_ref_tmp_2, _ln, _fn);
+  call_tmp7 = qio_err_iserr(err);
+  call_tmp8 = (call_tmp7 != INT32(0));
+  if (call_tmp8) {
+    ret3 = NULL;
+    path = ret3;
+    _ref_tmp_3 = &type_tmp2;
+    call_tmp9 = qio_int_to_err(INT32(0));
+    *(_ref_tmp_3) = call_tmp9;
+    _ref_tmp_4 = &path;
+    T5 = _ref_tmp_4;
+    call_tmp10 = qio_file_path_for_fp(fp, T5);
+    _ref_tmp_4 = T5;
+    call_tmp11 = qio_err_iserr(call_tmp10);
+    call_tmp12 = (call_tmp11 != INT32(0));
+    if (call_tmp12) {
+      wide_string_from_c_string(&call_tmp13, "unknown", INT64(0), INT64(0), _ln, _fn);
+      c_string_from_wide_string(&call_tmp14, &call_tmp13, _ln, _fn);
+      _ref_tmp_5 = &path;
+      call_tmp15 = ((c_string)(path));
+      call_tmp16 = ((c_string)(NULL));
+      call_tmp17 = string_compare(call_tmp15, call_tmp16);
+      call_tmp18 = (call_tmp17 != INT64(0));
+      if (call_tmp18) {
+        T6 = _ref_tmp_5;
+        chpl_rt_free_c_string(T6, _ln, _fn);
+        _ref_tmp_5 = T6;
+      }
+      call_tmp19 = string_copy(call_tmp14, _ln, _fn);
+      *(_ref_tmp_5) = call_tmp19;
+    }
+    _ref_tmp_6 = &path;
+    T7 = _ref_tmp_6;
+    call_tmp20 = string_from_c_string_copy(T7, false, INT64(0));
+    _ref_tmp_6 = T7;
+    wide_string_from_c_string(&call_tmp21, "in openfp", INT64(0), INT64(0), _ln, _fn);
+    chpl_string_widen(&T8, call_tmp20, _ln, _fn);
+    ioerror(err, call_tmp21, T8, _ln, _fn);
+  }
+  chpl_check_nil(ret, INT64(800), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_7 = &((ret)->value);
+  chpl___ASSIGN_3(_ref_tmp_7, &ret2, _ln, _fn);
+  chpl_check_nil(ret, INT64(789), "/root/repo/modules/standard/IO.chpl");
+  T9 = (ret)->value;
+  call_tmp22 = chpl__initCopy3(&T9, _ln, _fn);
+  *(_retArg) = call_tmp22;
+  chpl_here_alloc_size2 = sizeof(chpl_heap_file_object);
+  chpl_here_alloc_tmp2 = chpl_here_alloc(chpl_here_alloc_size2, INT16(22), _ln, _fn);
+  T11 = ((heap_file)(chpl_here_alloc_tmp2));
+  T10 = T11;
+  chpl_check_nil(T10, INT64(791), "/root/repo/modules/standard/IO.chpl");
+  (T10)->value = ret2;
+  chpl_check_nil(T10, INT64(791), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_8 = &((T10)->value);
+  chpl___TILDE_file(_ref_tmp_8, _ln, _fn);
+  chpl_here_free(((void*)(T10)), _ln, _fn);
+  ret_to_arg_tmp_ = *(_retArg);
+  chpl_here_alloc_size3 = sizeof(chpl_heap_file_object);
+  chpl_here_alloc_tmp3 = chpl_here_alloc(chpl_here_alloc_size3, INT16(22), _ln, _fn);
+  T13 = ((heap_file)(chpl_here_alloc_tmp3));
+  T12 = T13;
+  chpl_check_nil(T12, INT64(789), "/root/repo/modules/standard/IO.chpl");
+  (T12)->value = ret_to_arg_tmp_;
+  chpl_check_nil(T12, INT64(789), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_9 = &((T12)->value);
+  chpl___TILDE_file(_ref_tmp_9, _ln, _fn);
+  chpl_here_free(((void*)(T12)), _ln, _fn);
+  chpl_here_free(((void*)(ret)), _ln, _fn);
+  return;
+}
+
+/* IO.chpl:836 */
+static channel_F_dynamic_T _construct_channel(locale home, qio_channel_ptr_t _channel_internal, channel_F_dynamic_T* const meme, int64_t _ln, c_string _fn) {
+  channel_F_dynamic_T this6;
+  chpl____wide_locale T = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_locale chpl_macro_tmp_904;
+  this6 = *(meme);
+  chpl_macro_tmp_904.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_904.addr = home;
+  T = chpl_macro_tmp_904;
+  (&this6)->home = T;
+  (&this6)->_channel_internal = _channel_internal;
+  return this6;
+}
+
+/* IO.chpl:836 */
+static channel_T_dynamic_T _construct_channel2(locale home, qio_channel_ptr_t _channel_internal, channel_T_dynamic_T* const meme, int64_t _ln, c_string _fn) {
+  channel_T_dynamic_T this6;
+  chpl____wide_locale T = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_locale chpl_macro_tmp_905;
+  this6 = *(meme);
+  chpl_macro_tmp_905.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_905.addr = home;
+  T = chpl_macro_tmp_905;
+  (&this6)->home = T;
+  (&this6)->_channel_internal = _channel_internal;
+  return this6;
+}
+
+/* IO.chpl:846 */
+static channel_F_dynamic_T chpl__initCopy4(channel_F_dynamic_T* const x2, int64_t _ln, c_string _fn) {
+  heap_channel_F_dynamic_T T = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_channel_F_dynamic_T T2 = NULL;
+  _ref_channel_F_dynamic_T _ref_tmp_ = NULL;
+  _ref_locale call_tmp = NULL;
+  chpl_localeID_t call_tmp2;
+  chpl____wide_locale T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_channel_F_dynamic_T T4 = NULL;
+  _class_localson_fn44 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_channel_F_dynamic_T T5 = {CHPL_LOCALEID_T_INIT, NULL};
+  channel_F_dynamic_T T6;
+  chpl____wide__ref_channel_F_dynamic_T chpl_macro_tmp_906;
+  chpl_here_alloc_size = sizeof(chpl_heap_channel_F_dynamic_T_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T2 = ((heap_channel_F_dynamic_T)(chpl_here_alloc_tmp));
+  T = T2;
+  chpl_check_nil(T, INT64(846), "/root/repo/modules/standard/IO.chpl");
+  (T)->value = *(x2);
+  chpl_check_nil(T, INT64(847), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_ = &((T)->value);
+  chpl_check_nil(_ref_tmp_, INT64(847), "/root/repo/modules/standard/IO.chpl");
+  call_tmp = &((_ref_tmp_)->home);
+  T3 = *(call_tmp);
+  call_tmp2 = (&T3)->locale;
+  chpl_check_nil(T, INT64(846), "/root/repo/modules/standard/IO.chpl");
+  T4 = &((T)->value);
+  _args_size = sizeof(chpl__class_localson_fn44_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn44)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(847), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp2;
+  chpl_macro_tmp_906.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_906.addr = T4;
+  T5 = chpl_macro_tmp_906;
+  chpl_check_nil(_args_foron_fn, INT64(847), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_1__tmp = T5;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn44 ***/ chpl_executeOn(&call_tmp2, INT32(47), _args_foron_fn, sizeof(chpl__class_localson_fn44_object), INT64(847), "/root/repo/modules/standard/IO.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  chpl_check_nil(T, INT64(846), "/root/repo/modules/standard/IO.chpl");
+  T6 = (T)->value;
+  chpl_here_free(((void*)(T)), _ln, _fn);
+  return T6;
+}
+
+/* IO.chpl:846 */
+static channel_T_dynamic_T chpl__initCopy5(channel_T_dynamic_T* const x2, int64_t _ln, c_string _fn) {
+  heap_channel_T_dynamic_T T = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_channel_T_dynamic_T T2 = NULL;
+  _ref_channel_T_dynamic_T _ref_tmp_ = NULL;
+  _ref_locale call_tmp = NULL;
+  chpl_localeID_t call_tmp2;
+  chpl____wide_locale T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_channel_T_dynamic_T T4 = NULL;
+  _class_localson_fn45 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_channel_T_dynamic_T T5 = {CHPL_LOCALEID_T_INIT, NULL};
+  channel_T_dynamic_T T6;
+  chpl____wide__ref_channel_T_dynamic_T chpl_macro_tmp_907;
+  chpl_here_alloc_size = sizeof(chpl_heap_channel_T_dynamic_T_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T2 = ((heap_channel_T_dynamic_T)(chpl_here_alloc_tmp));
+  T = T2;
+  chpl_check_nil(T, INT64(846), "/root/repo/modules/standard/IO.chpl");
+  (T)->value = *(x2);
+  chpl_check_nil(T, INT64(847), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_ = &((T)->value);
+  chpl_check_nil(_ref_tmp_, INT64(847), "/root/repo/modules/standard/IO.chpl");
+  call_tmp = &((_ref_tmp_)->home);
+  T3 = *(call_tmp);
+  call_tmp2 = (&T3)->locale;
+  chpl_check_nil(T, INT64(846), "/root/repo/modules/standard/IO.chpl");
+  T4 = &((T)->value);
+  _args_size = sizeof(chpl__class_localson_fn45_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn45)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(847), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp2;
+  chpl_macro_tmp_907.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_907.addr = T4;
+  T5 = chpl_macro_tmp_907;
+  chpl_check_nil(_args_foron_fn, INT64(847), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_1__tmp = T5;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn45 ***/ chpl_executeOn(&call_tmp2, INT32(48), _args_foron_fn, sizeof(chpl__class_localson_fn45_object), INT64(847), "/root/repo/modules/standard/IO.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  chpl_check_nil(T, INT64(846), "/root/repo/modules/standard/IO.chpl");
+  T6 = (T)->value;
+  chpl_here_free(((void*)(T)), _ln, _fn);
+  return T6;
+}
+
+/* IO.chpl:847 */
+static void on_fn44(chpl____wide__ref_channel_F_dynamic_T* const x2, int64_t _ln, c_string _fn) {
+  qio_channel_ptr_t ret;
+  chpl____wide__ref_qio_channel_ptr_t chpl_macro_tmp_908;
+  chpl_macro_tmp_908.locale = (*(x2)).locale;
+  chpl_macro_tmp_908.addr = &(((*(x2)).addr)->_channel_internal);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_908).locale), INT64(0), NULL), (chpl_macro_tmp_908).addr, sizeof(qio_channel_ptr_t), -1, INT64(1), INT64(848), "/root/repo/modules/standard/IO.chpl");
+  qio_channel_retain(ret);
+  return;
+}
+
+/* IO.chpl:847 */
+static void on_fn45(chpl____wide__ref_channel_T_dynamic_T* const x2, int64_t _ln, c_string _fn) {
+  qio_channel_ptr_t ret;
+  chpl____wide__ref_qio_channel_ptr_t chpl_macro_tmp_909;
+  chpl_macro_tmp_909.locale = (*(x2)).locale;
+  chpl_macro_tmp_909.addr = &(((*(x2)).addr)->_channel_internal);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_909).locale), INT64(0), NULL), (chpl_macro_tmp_909).addr, sizeof(qio_channel_ptr_t), -1, INT64(1), INT64(848), "/root/repo/modules/standard/IO.chpl");
+  qio_channel_retain(ret);
+  return;
+}
+
+/* IO.chpl:847 */
+static void wrapon_fn44(_class_localson_fn44 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_channel_F_dynamic_T _1__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(847), "/root/repo/modules/standard/IO.chpl");
+  _1__tmp = (c)->_1__tmp;
+  on_fn44(&_1__tmp, _ln, _fn);
+  return;
+}
+
+/* IO.chpl:847 */
+static void wrapon_fn45(_class_localson_fn45 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_channel_T_dynamic_T _1__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(847), "/root/repo/modules/standard/IO.chpl");
+  _1__tmp = (c)->_1__tmp;
+  on_fn45(&_1__tmp, _ln, _fn);
+  return;
+}
+
+/* IO.chpl:853 */
+static void chpl___ASSIGN_4(chpl____wide__ref_channel_F_dynamic_T* const ret, channel_F_dynamic_T* const x2, int64_t _ln, c_string _fn) {
+  heap_channel_F_dynamic_T T = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_channel_F_dynamic_T T2 = NULL;
+  _ref_channel_F_dynamic_T _ref_tmp_ = NULL;
+  _ref_locale call_tmp = NULL;
+  chpl_localeID_t call_tmp2;
+  chpl____wide_locale T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_channel_F_dynamic_T T4 = NULL;
+  _class_localson_fn46 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_channel_F_dynamic_T T5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_locale call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp4;
+  chpl____wide_locale T6 = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn48 _args_foron_fn2 = NULL;
+  int64_t _args_size2;
+  chpl_opaque _args_alloc2;
+  chpl____wide__ref_locale call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_channel_F_dynamic_T _ref_tmp_2 = NULL;
+  chpl____wide_locale ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_qio_channel_ptr_t call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_channel_F_dynamic_T _ref_tmp_3 = NULL;
+  qio_channel_ptr_t ret3;
+  chpl____wide__ref_channel_F_dynamic_T chpl_macro_tmp_910;
+  chpl____wide__ref_locale chpl_macro_tmp_911;
+  chpl____wide__ref_locale chpl_macro_tmp_912;
+  chpl____wide__ref_qio_channel_ptr_t chpl_macro_tmp_913;
+  chpl_here_alloc_size = sizeof(chpl_heap_channel_F_dynamic_T_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T2 = ((heap_channel_F_dynamic_T)(chpl_here_alloc_tmp));
+  T = T2;
+  chpl_check_nil(T, INT64(853), "/root/repo/modules/standard/IO.chpl");
+  (T)->value = *(x2);
+  chpl_check_nil(T, INT64(855), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_ = &((T)->value);
+  chpl_check_nil(_ref_tmp_, INT64(855), "/root/repo/modules/standard/IO.chpl");
+  call_tmp = &((_ref_tmp_)->home);
+  T3 = *(call_tmp);
+  call_tmp2 = (&T3)->locale;
+  chpl_check_nil(T, INT64(853), "/root/repo/modules/standard/IO.chpl");
+  T4 = &((T)->value);
+  _args_size = sizeof(chpl__class_localson_fn46_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn46)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(855), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp2;
+  chpl_macro_tmp_910.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_910.addr = T4;
+  T5 = chpl_macro_tmp_910;
+  chpl_check_nil(_args_foron_fn, INT64(855), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_1__tmp = T5;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn46 ***/ chpl_executeOn(&call_tmp2, INT32(49), _args_foron_fn, sizeof(chpl__class_localson_fn46_object), INT64(855), "/root/repo/modules/standard/IO.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  chpl_macro_tmp_911.locale = (*(ret)).locale;
+  chpl_macro_tmp_911.addr = &(((*(ret)).addr)->home);
+  call_tmp3 = chpl_macro_tmp_911;
+  chpl_gen_comm_get(((void*)(&T6)), chpl_nodeFromLocaleID(&((call_tmp3).locale), INT64(0), NULL), (call_tmp3).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(859), "/root/repo/modules/standard/IO.chpl");
+  call_tmp4 = (&T6)->locale;
+  _args_size2 = sizeof(chpl__class_localson_fn48_object);
+  _args_alloc2 = chpl_mem_allocPooled(_args_size2, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn2 = ((_class_localson_fn48)(_args_alloc2));
+  chpl_check_nil(_args_foron_fn2, INT64(859), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn2)->_0__tmp = call_tmp4;
+  chpl_check_nil(_args_foron_fn2, INT64(859), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn2)->_1_ret = *(ret);
+  (_args_foron_fn2)->_ln = _ln;
+  (_args_foron_fn2)->_fn = _fn;
+  /*** wrapon_fn48 ***/ chpl_executeOn(&call_tmp4, INT32(51), _args_foron_fn2, sizeof(chpl__class_localson_fn48_object), INT64(859), "/root/repo/modules/standard/IO.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn2)), _ln, _fn);
+  chpl_macro_tmp_912.locale = (*(ret)).locale;
+  chpl_macro_tmp_912.addr = &(((*(ret)).addr)->home);
+  call_tmp5 = chpl_macro_tmp_912;
+  chpl_check_nil(T, INT64(863), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_2 = &((T)->value);
+  chpl_check_nil(_ref_tmp_2, INT64(863), "/root/repo/modules/standard/IO.chpl");
+  ret2 = (_ref_tmp_2)->home;
+  chpl_gen_comm_put(((void*)(&ret2)), chpl_nodeFromLocaleID(&((call_tmp5).locale), INT64(0), NULL), (call_tmp5).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(863), "/root/repo/modules/standard/IO.chpl");
+  chpl_macro_tmp_913.locale = (*(ret)).locale;
+  chpl_macro_tmp_913.addr = &(((*(ret)).addr)->_channel_internal);
+  call_tmp6 = chpl_macro_tmp_913;
+  chpl_check_nil(T, INT64(864), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_3 = &((T)->value);
+  chpl_check_nil(_ref_tmp_3, INT64(864), "/root/repo/modules/standard/IO.chpl");
+  ret3 = (_ref_tmp_3)->_channel_internal;
+  chpl_gen_comm_put(((void*)(&ret3)), chpl_nodeFromLocaleID(&((call_tmp6).locale), INT64(0), NULL), (call_tmp6).addr, sizeof(qio_channel_ptr_t), -1, INT64(1), INT64(864), "/root/repo/modules/standard/IO.chpl");
+  chpl_here_free(((void*)(T)), _ln, _fn);
+  return;
+}
+
+/* IO.chpl:853 */
+static void chpl___ASSIGN_5(chpl____wide__ref_channel_T_dynamic_T* const ret, channel_T_dynamic_T* const x2, int64_t _ln, c_string _fn) {
+  heap_channel_T_dynamic_T T = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_channel_T_dynamic_T T2 = NULL;
+  _ref_channel_T_dynamic_T _ref_tmp_ = NULL;
+  _ref_locale call_tmp = NULL;
+  chpl_localeID_t call_tmp2;
+  chpl____wide_locale T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_channel_T_dynamic_T T4 = NULL;
+  _class_localson_fn47 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_channel_T_dynamic_T T5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_locale call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp4;
+  chpl____wide_locale T6 = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn49 _args_foron_fn2 = NULL;
+  int64_t _args_size2;
+  chpl_opaque _args_alloc2;
+  chpl____wide__ref_locale call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_channel_T_dynamic_T _ref_tmp_2 = NULL;
+  chpl____wide_locale ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_qio_channel_ptr_t call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_channel_T_dynamic_T _ref_tmp_3 = NULL;
+  qio_channel_ptr_t ret3;
+  chpl____wide__ref_channel_T_dynamic_T chpl_macro_tmp_914;
+  chpl____wide__ref_locale chpl_macro_tmp_915;
+  chpl____wide__ref_locale chpl_macro_tmp_916;
+  chpl____wide__ref_qio_channel_ptr_t chpl_macro_tmp_917;
+  chpl_here_alloc_size = sizeof(chpl_heap_channel_T_dynamic_T_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T2 = ((heap_channel_T_dynamic_T)(chpl_here_alloc_tmp));
+  T = T2;
+  chpl_check_nil(T, INT64(853), "/root/repo/modules/standard/IO.chpl");
+  (T)->value = *(x2);
+  chpl_check_nil(T, INT64(855), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_ = &((T)->value);
+  chpl_check_nil(_ref_tmp_, INT64(855), "/root/repo/modules/standard/IO.chpl");
+  call_tmp = &((_ref_tmp_)->home);
+  T3 = *(call_tmp);
+  call_tmp2 = (&T3)->locale;
+  chpl_check_nil(T, INT64(853), "/root/repo/modules/standard/IO.chpl");
+  T4 = &((T)->value);
+  _args_size = sizeof(chpl__class_localson_fn47_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn47)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(855), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp2;
+  chpl_macro_tmp_914.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_914.addr = T4;
+  T5 = chpl_macro_tmp_914;
+  chpl_check_nil(_args_foron_fn, INT64(855), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_1__tmp = T5;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn47 ***/ chpl_executeOn(&call_tmp2, INT32(50), _args_foron_fn, sizeof(chpl__class_localson_fn47_object), INT64(855), "/root/repo/modules/standard/IO.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  chpl_macro_tmp_915.locale = (*(ret)).locale;
+  chpl_macro_tmp_915.addr = &(((*(ret)).addr)->home);
+  call_tmp3 = chpl_macro_tmp_915;
+  chpl_gen_comm_get(((void*)(&T6)), chpl_nodeFromLocaleID(&((call_tmp3).locale), INT64(0), NULL), (call_tmp3).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(859), "/root/repo/modules/standard/IO.chpl");
+  call_tmp4 = (&T6)->locale;
+  _args_size2 = sizeof(chpl__class_localson_fn49_object);
+  _args_alloc2 = chpl_mem_allocPooled(_args_size2, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn2 = ((_class_localson_fn49)(_args_alloc2));
+  chpl_check_nil(_args_foron_fn2, INT64(859), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn2)->_0__tmp = call_tmp4;
+  chpl_check_nil(_args_foron_fn2, INT64(859), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn2)->_1_ret = *(ret);
+  (_args_foron_fn2)->_ln = _ln;
+  (_args_foron_fn2)->_fn = _fn;
+  /*** wrapon_fn49 ***/ chpl_executeOn(&call_tmp4, INT32(52), _args_foron_fn2, sizeof(chpl__class_localson_fn49_object), INT64(859), "/root/repo/modules/standard/IO.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn2)), _ln, _fn);
+  chpl_macro_tmp_916.locale = (*(ret)).locale;
+  chpl_macro_tmp_916.addr = &(((*(ret)).addr)->home);
+  call_tmp5 = chpl_macro_tmp_916;
+  chpl_check_nil(T, INT64(863), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_2 = &((T)->value);
+  chpl_check_nil(_ref_tmp_2, INT64(863), "/root/repo/modules/standard/IO.chpl");
+  ret2 = (_ref_tmp_2)->home;
+  chpl_gen_comm_put(((void*)(&ret2)), chpl_nodeFromLocaleID(&((call_tmp5).locale), INT64(0), NULL), (call_tmp5).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(863), "/root/repo/modules/standard/IO.chpl");
+  chpl_macro_tmp_917.locale = (*(ret)).locale;
+  chpl_macro_tmp_917.addr = &(((*(ret)).addr)->_channel_internal);
+  call_tmp6 = chpl_macro_tmp_917;
+  chpl_check_nil(T, INT64(864), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_3 = &((T)->value);
+  chpl_check_nil(_ref_tmp_3, INT64(864), "/root/repo/modules/standard/IO.chpl");
+  ret3 = (_ref_tmp_3)->_channel_internal;
+  chpl_gen_comm_put(((void*)(&ret3)), chpl_nodeFromLocaleID(&((call_tmp6).locale), INT64(0), NULL), (call_tmp6).addr, sizeof(qio_channel_ptr_t), -1, INT64(1), INT64(864), "/root/repo/modules/standard/IO.chpl");
+  chpl_here_free(((void*)(T)), _ln, _fn);
+  return;
+}
+
+/* IO.chpl:855 */
+static void on_fn46(chpl____wide__ref_channel_F_dynamic_T* const x2, int64_t _ln, c_string _fn) {
+  qio_channel_ptr_t ret;
+  chpl____wide__ref_qio_channel_ptr_t chpl_macro_tmp_918;
+  chpl_macro_tmp_918.locale = (*(x2)).locale;
+  chpl_macro_tmp_918.addr = &(((*(x2)).addr)->_channel_internal);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_918).locale), INT64(0), NULL), (chpl_macro_tmp_918).addr, sizeof(qio_channel_ptr_t), -1, INT64(1), INT64(856), "/root/repo/modules/standard/IO.chpl");
+  qio_channel_retain(ret);
+  return;
+}
+
+/* IO.chpl:855 */
+static void on_fn47(chpl____wide__ref_channel_T_dynamic_T* const x2, int64_t _ln, c_string _fn) {
+  qio_channel_ptr_t ret;
+  chpl____wide__ref_qio_channel_ptr_t chpl_macro_tmp_919;
+  chpl_macro_tmp_919.locale = (*(x2)).locale;
+  chpl_macro_tmp_919.addr = &(((*(x2)).addr)->_channel_internal);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_919).locale), INT64(0), NULL), (chpl_macro_tmp_919).addr, sizeof(qio_channel_ptr_t), -1, INT64(1), INT64(856), "/root/repo/modules/standard/IO.chpl");
+  qio_channel_retain(ret);
+  return;
+}
+
+/* IO.chpl:855 */
+static void wrapon_fn46(_class_localson_fn46 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_channel_F_dynamic_T _1__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(855), "/root/repo/modules/standard/IO.chpl");
+  _1__tmp = (c)->_1__tmp;
+  on_fn46(&_1__tmp, _ln, _fn);
+  return;
+}
+
+/* IO.chpl:855 */
+static void wrapon_fn47(_class_localson_fn47 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_channel_T_dynamic_T _1__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(855), "/root/repo/modules/standard/IO.chpl");
+  _1__tmp = (c)->_1__tmp;
+  on_fn47(&_1__tmp, _ln, _fn);
+  return;
+}
+
+/* IO.chpl:859 */
+static void on_fn48(chpl____wide__ref_channel_F_dynamic_T* const ret, int64_t _ln, c_string _fn) {
+  qio_channel_ptr_t ret2;
+  chpl____wide__ref_qio_channel_ptr_t chpl_macro_tmp_920;
+  chpl_macro_tmp_920.locale = (*(ret)).locale;
+  chpl_macro_tmp_920.addr = &(((*(ret)).addr)->_channel_internal);
+  chpl_gen_comm_get(((void*)(&ret2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_920).locale), INT64(0), NULL), (chpl_macro_tmp_920).addr, sizeof(qio_channel_ptr_t), -1, INT64(1), INT64(860), "/root/repo/modules/standard/IO.chpl");
+  qio_channel_release(ret2);
+  return;
+}
+
+/* IO.chpl:859 */
+static void on_fn49(chpl____wide__ref_channel_T_dynamic_T* const ret, int64_t _ln, c_string _fn) {
+  qio_channel_ptr_t ret2;
+  chpl____wide__ref_qio_channel_ptr_t chpl_macro_tmp_921;
+  chpl_macro_tmp_921.locale = (*(ret)).locale;
+  chpl_macro_tmp_921.addr = &(((*(ret)).addr)->_channel_internal);
+  chpl_gen_comm_get(((void*)(&ret2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_921).locale), INT64(0), NULL), (chpl_macro_tmp_921).addr, sizeof(qio_channel_ptr_t), -1, INT64(1), INT64(860), "/root/repo/modules/standard/IO.chpl");
+  qio_channel_release(ret2);
+  return;
+}
+
+/* IO.chpl:859 */
+static void wrapon_fn48(_class_localson_fn48 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_channel_F_dynamic_T _1_ret = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(859), "/root/repo/modules/standard/IO.chpl");
+  _1_ret = (c)->_1_ret;
+  on_fn48(&_1_ret, _ln, _fn);
+  return;
+}
+
+/* IO.chpl:859 */
+static void wrapon_fn49(_class_localson_fn49 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_channel_T_dynamic_T _1_ret = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(859), "/root/repo/modules/standard/IO.chpl");
+  _1_ret = (c)->_1_ret;
+  on_fn49(&_1_ret, _ln, _fn);
+  return;
+}
+
+/* IO.chpl:867 */
+static channel_F_dynamic_T channel(file* const f, chpl____wide__ref_syserr* const error, int32_t hints, int64_t start, int64_t end, iostyle* const local_style, int64_t _ln, c_string _fn) {
+  qio_channel_ptr_t local_QIO_CHANNEL_PTR_NULL;
+  heap_file T = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_file T2 = NULL;
+  heap_syserr _formal_tmp_error = NULL;
+  int64_t chpl_here_alloc_size2;
+  chpl_opaque chpl_here_alloc_tmp2;
+  heap_syserr T3 = NULL;
+  heap_channel_F_dynamic_T this6 = NULL;
+  int64_t chpl_here_alloc_size3;
+  chpl_opaque chpl_here_alloc_tmp3;
+  heap_channel_F_dynamic_T T4 = NULL;
+  channel_F_dynamic_T this7;
+  locale T5 = NULL;
+  chpl____wide_locale T6 = {CHPL_LOCALEID_T_INIT, NULL};
+  locale call_tmp = NULL;
+  locale T7 = NULL;
+  chpl____wide_locale T8 = {CHPL_LOCALEID_T_INIT, NULL};
+  qio_channel_ptr_t default_arg_channel_internal;
+  channel_F_dynamic_T wrap_call_tmp;
+  _ref_file _ref_tmp_ = NULL;
+  _ref_locale call_tmp2 = NULL;
+  chpl_localeID_t call_tmp3;
+  chpl____wide_locale T9 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_channel_F_dynamic_T T10 = NULL;
+  _ref_syserr T11 = NULL;
+  _ref_file T12 = NULL;
+  _class_localson_fn50 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_channel_F_dynamic_T T13 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_syserr T14 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_file T15 = {CHPL_LOCALEID_T_INIT, NULL};
+  syserr T16;
+  channel_F_dynamic_T T17;
+  chpl____wide_locale chpl_macro_tmp_922;
+  chpl____wide_locale chpl_macro_tmp_923;
+  chpl____wide__ref_channel_F_dynamic_T chpl_macro_tmp_924;
+  chpl____wide__ref_syserr chpl_macro_tmp_925;
+  chpl____wide__ref_file chpl_macro_tmp_926;
+  local_QIO_CHANNEL_PTR_NULL = QIO_CHANNEL_PTR_NULL;
+  chpl_here_alloc_size = sizeof(chpl_heap_file_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T2 = ((heap_file)(chpl_here_alloc_tmp));
+  T = T2;
+  chpl_check_nil(T, INT64(867), "/root/repo/modules/standard/IO.chpl");
+  (T)->value = *(f);
+  chpl_here_alloc_size2 = sizeof(chpl_heap_syserr_object);
+  chpl_here_alloc_tmp2 = chpl_here_alloc(chpl_here_alloc_size2, INT16(22), _ln, _fn);
+  T3 = ((heap_syserr)(chpl_here_alloc_tmp2));
+  _formal_tmp_error = T3;
+  chpl_here_alloc_size3 = sizeof(chpl_heap_channel_F_dynamic_T_object);
+  chpl_here_alloc_tmp3 = chpl_here_alloc(chpl_here_alloc_size3, INT16(22), _ln, _fn);
+  T4 = ((heap_channel_F_dynamic_T)(chpl_here_alloc_tmp3));
+  this6 = T4;
+  T5 = nil;
+  chpl_macro_tmp_922.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_922.addr = T5;
+  T6 = chpl_macro_tmp_922;
+  (&this7)->home = T6;
+  T7 = ((locale)(nil));
+  call_tmp = T7;
+  chpl_macro_tmp_923.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_923.addr = call_tmp;
+  T8 = chpl_macro_tmp_923;
+  (&this7)->home = T8;
+  default_arg_channel_internal = local_QIO_CHANNEL_PTR_NULL;
+  (&this7)->_channel_internal = default_arg_channel_internal;
+  wrap_call_tmp = _construct_channel(call_tmp, default_arg_channel_internal, &this7, _ln, _fn);
+  chpl_check_nil(this6, INT64(867), "/root/repo/modules/standard/IO.chpl");
+  (this6)->value = wrap_call_tmp;
+  chpl_check_nil(T, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_ = &((T)->value);
+  chpl_check_nil(_ref_tmp_, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  call_tmp2 = &((_ref_tmp_)->home);
+  T9 = *(call_tmp2);
+  call_tmp3 = (&T9)->locale;
+  chpl_check_nil(this6, INT64(867), "/root/repo/modules/standard/IO.chpl");
+  T10 = &((this6)->value);
+  chpl_check_nil(_formal_tmp_error, INT64(867), "/root/repo/modules/standard/IO.chpl");
+  T11 = &((_formal_tmp_error)->value);
+  chpl_check_nil(T, INT64(867), "/root/repo/modules/standard/IO.chpl");
+  T12 = &((T)->value);
+  _args_size = sizeof(chpl__class_localson_fn50_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn50)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp3;
+  chpl_macro_tmp_924.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_924.addr = T10;
+  T13 = chpl_macro_tmp_924;
+  chpl_check_nil(_args_foron_fn, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_1__tmp = T13;
+  chpl_check_nil(_args_foron_fn, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_2_hints = hints;
+  chpl_check_nil(_args_foron_fn, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_3_rvfDerefTmp = *(local_style);
+  chpl_check_nil(_args_foron_fn, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_4_end = end;
+  chpl_check_nil(_args_foron_fn, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_5_start = start;
+  chpl_macro_tmp_925.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_925.addr = T11;
+  T14 = chpl_macro_tmp_925;
+  chpl_check_nil(_args_foron_fn, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_6__tmp = T14;
+  chpl_macro_tmp_926.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_926.addr = T12;
+  T15 = chpl_macro_tmp_926;
+  chpl_check_nil(_args_foron_fn, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_7__tmp = T15;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn50 ***/ chpl_executeOn(&call_tmp3, INT32(53), _args_foron_fn, sizeof(chpl__class_localson_fn50_object), INT64(868), "/root/repo/modules/standard/IO.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  chpl_check_nil(_formal_tmp_error, INT64(867), "/root/repo/modules/standard/IO.chpl");
+  T16 = (_formal_tmp_error)->value;
+  chpl_gen_comm_put(((void*)(&T16)), chpl_nodeFromLocaleID(&((*(error)).locale), INT64(0), NULL), (*(error)).addr, sizeof(syserr), -1, INT64(1), INT64(867), "/root/repo/modules/standard/IO.chpl");
+  chpl_check_nil(this6, INT64(867), "/root/repo/modules/standard/IO.chpl");
+  T17 = (this6)->value;
+  chpl_here_free(((void*)(this6)), _ln, _fn);
+  chpl_here_free(((void*)(_formal_tmp_error)), _ln, _fn);
+  chpl_here_free(((void*)(T)), _ln, _fn);
+  return T17;
+}
+
+/* IO.chpl:867 */
+static channel_T_dynamic_T channel2(file* const f, chpl____wide__ref_syserr* const error, int32_t hints, int64_t start, int64_t end, iostyle* const local_style, int64_t _ln, c_string _fn) {
+  qio_channel_ptr_t local_QIO_CHANNEL_PTR_NULL;
+  heap_file T = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_file T2 = NULL;
+  heap_syserr _formal_tmp_error = NULL;
+  int64_t chpl_here_alloc_size2;
+  chpl_opaque chpl_here_alloc_tmp2;
+  heap_syserr T3 = NULL;
+  heap_channel_T_dynamic_T this6 = NULL;
+  int64_t chpl_here_alloc_size3;
+  chpl_opaque chpl_here_alloc_tmp3;
+  heap_channel_T_dynamic_T T4 = NULL;
+  channel_T_dynamic_T this7;
+  locale T5 = NULL;
+  chpl____wide_locale T6 = {CHPL_LOCALEID_T_INIT, NULL};
+  locale call_tmp = NULL;
+  locale T7 = NULL;
+  chpl____wide_locale T8 = {CHPL_LOCALEID_T_INIT, NULL};
+  qio_channel_ptr_t default_arg_channel_internal;
+  channel_T_dynamic_T wrap_call_tmp;
+  _ref_file _ref_tmp_ = NULL;
+  _ref_locale call_tmp2 = NULL;
+  chpl_localeID_t call_tmp3;
+  chpl____wide_locale T9 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_file T10 = NULL;
+  _ref_syserr T11 = NULL;
+  _ref_channel_T_dynamic_T T12 = NULL;
+  _class_localson_fn51 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_file T13 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_syserr T14 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_channel_T_dynamic_T T15 = {CHPL_LOCALEID_T_INIT, NULL};
+  syserr T16;
+  channel_T_dynamic_T T17;
+  chpl____wide_locale chpl_macro_tmp_927;
+  chpl____wide_locale chpl_macro_tmp_928;
+  chpl____wide__ref_file chpl_macro_tmp_929;
+  chpl____wide__ref_syserr chpl_macro_tmp_930;
+  chpl____wide__ref_channel_T_dynamic_T chpl_macro_tmp_931;
+  local_QIO_CHANNEL_PTR_NULL = QIO_CHANNEL_PTR_NULL;
+  chpl_here_alloc_size = sizeof(chpl_heap_file_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T2 = ((heap_file)(chpl_here_alloc_tmp));
+  T = T2;
+  chpl_check_nil(T, INT64(867), "/root/repo/modules/standard/IO.chpl");
+  (T)->value = *(f);
+  chpl_here_alloc_size2 = sizeof(chpl_heap_syserr_object);
+  chpl_here_alloc_tmp2 = chpl_here_alloc(chpl_here_alloc_size2, INT16(22), _ln, _fn);
+  T3 = ((heap_syserr)(chpl_here_alloc_tmp2));
+  _formal_tmp_error = T3;
+  chpl_here_alloc_size3 = sizeof(chpl_heap_channel_T_dynamic_T_object);
+  chpl_here_alloc_tmp3 = chpl_here_alloc(chpl_here_alloc_size3, INT16(22), _ln, _fn);
+  T4 = ((heap_channel_T_dynamic_T)(chpl_here_alloc_tmp3));
+  this6 = T4;
+  T5 = nil;
+  chpl_macro_tmp_927.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_927.addr = T5;
+  T6 = chpl_macro_tmp_927;
+  (&this7)->home = T6;
+  T7 = ((locale)(nil));
+  call_tmp = T7;
+  chpl_macro_tmp_928.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_928.addr = call_tmp;
+  T8 = chpl_macro_tmp_928;
+  (&this7)->home = T8;
+  default_arg_channel_internal = local_QIO_CHANNEL_PTR_NULL;
+  (&this7)->_channel_internal = default_arg_channel_internal;
+  wrap_call_tmp = _construct_channel2(call_tmp, default_arg_channel_internal, &this7, _ln, _fn);
+  chpl_check_nil(this6, INT64(867), "/root/repo/modules/standard/IO.chpl");
+  (this6)->value = wrap_call_tmp;
+  chpl_check_nil(T, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_ = &((T)->value);
+  chpl_check_nil(_ref_tmp_, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  call_tmp2 = &((_ref_tmp_)->home);
+  T9 = *(call_tmp2);
+  call_tmp3 = (&T9)->locale;
+  chpl_check_nil(T, INT64(867), "/root/repo/modules/standard/IO.chpl");
+  T10 = &((T)->value);
+  chpl_check_nil(_formal_tmp_error, INT64(867), "/root/repo/modules/standard/IO.chpl");
+  T11 = &((_formal_tmp_error)->value);
+  chpl_check_nil(this6, INT64(867), "/root/repo/modules/standard/IO.chpl");
+  T12 = &((this6)->value);
+  _args_size = sizeof(chpl__class_localson_fn51_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn51)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp3;
+  chpl_check_nil(_args_foron_fn, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_1_rvfDerefTmp = *(local_style);
+  chpl_check_nil(_args_foron_fn, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_2_start = start;
+  chpl_macro_tmp_929.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_929.addr = T10;
+  T13 = chpl_macro_tmp_929;
+  chpl_check_nil(_args_foron_fn, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_3__tmp = T13;
+  chpl_macro_tmp_930.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_930.addr = T11;
+  T14 = chpl_macro_tmp_930;
+  chpl_check_nil(_args_foron_fn, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_4__tmp = T14;
+  chpl_check_nil(_args_foron_fn, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_5_hints = hints;
+  chpl_macro_tmp_931.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_931.addr = T12;
+  T15 = chpl_macro_tmp_931;
+  chpl_check_nil(_args_foron_fn, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_6__tmp = T15;
+  chpl_check_nil(_args_foron_fn, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_7_end = end;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn51 ***/ chpl_executeOn(&call_tmp3, INT32(54), _args_foron_fn, sizeof(chpl__class_localson_fn51_object), INT64(868), "/root/repo/modules/standard/IO.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  chpl_check_nil(_formal_tmp_error, INT64(867), "/root/repo/modules/standard/IO.chpl");
+  T16 = (_formal_tmp_error)->value;
+  chpl_gen_comm_put(((void*)(&T16)), chpl_nodeFromLocaleID(&((*(error)).locale), INT64(0), NULL), (*(error)).addr, sizeof(syserr), -1, INT64(1), INT64(867), "/root/repo/modules/standard/IO.chpl");
+  chpl_check_nil(this6, INT64(867), "/root/repo/modules/standard/IO.chpl");
+  T17 = (this6)->value;
+  chpl_here_free(((void*)(_formal_tmp_error)), _ln, _fn);
+  chpl_here_free(((void*)(this6)), _ln, _fn);
+  chpl_here_free(((void*)(T)), _ln, _fn);
+  return T17;
+}
+
+/* IO.chpl:868 */
+static void on_fn50(chpl____wide__ref_channel_F_dynamic_T* const this6, int32_t hints, iostyle* const _formal_tmp_local_style, int64_t end, int64_t start, chpl____wide__ref_syserr* const _formal_tmp_error, chpl____wide__ref_file* const f, int64_t _ln, c_string _fn) {
+  chpl____wide__ref_locale call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_locale ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_qio_channel_ptr_t call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  qio_file_ptr_t ret2;
+  syserr call_tmp3;
+  int32_t call_tmp4;
+  int32_t call_tmp5;
+  _ref_iostyle rvfRerefTmp = NULL;
+  _ref_qio_channel_ptr_t T = NULL;
+  _ref_iostyle T2 = NULL;
+  chpl____wide__ref_locale chpl_macro_tmp_932;
+  chpl____wide__ref_locale chpl_macro_tmp_933;
+  chpl____wide__ref_qio_channel_ptr_t chpl_macro_tmp_934;
+  chpl____wide__ref_qio_file_ptr_t chpl_macro_tmp_935;
+  chpl____wide__ref_qio_channel_ptr_t chpl_macro_tmp_936;
+  chpl_macro_tmp_932.locale = (*(this6)).locale;
+  chpl_macro_tmp_932.addr = &(((*(this6)).addr)->home);
+  call_tmp = chpl_macro_tmp_932;
+  chpl_macro_tmp_933.locale = (*(f)).locale;
+  chpl_macro_tmp_933.addr = &(((*(f)).addr)->home);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_933).locale), INT64(0), NULL), (chpl_macro_tmp_933).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(869), "/root/repo/modules/standard/IO.chpl");
+  chpl_gen_comm_put(((void*)(&ret)), chpl_nodeFromLocaleID(&((call_tmp).locale), INT64(0), NULL), (call_tmp).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(869), "/root/repo/modules/standard/IO.chpl");
+  chpl_macro_tmp_934.locale = (*(this6)).locale;
+  chpl_macro_tmp_934.addr = &(((*(this6)).addr)->_channel_internal);
+  call_tmp2 = chpl_macro_tmp_934;
+  chpl_macro_tmp_935.locale = (*(f)).locale;
+  chpl_macro_tmp_935.addr = &(((*(f)).addr)->_file_internal);
+  chpl_gen_comm_get(((void*)(&ret2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_935).locale), INT64(0), NULL), (chpl_macro_tmp_935).addr, sizeof(qio_file_ptr_t), -1, INT64(1), INT64(874), "/root/repo/modules/standard/IO.chpl");
+  call_tmp4 = ((int32_t)(true));
+  call_tmp5 = ((int32_t)(false));
+  rvfRerefTmp = _formal_tmp_local_style;
+  T = (&call_tmp2)->addr;
+  T2 = rvfRerefTmp;
+  call_tmp3 = qio_channel_create(T, ret2, hints, call_tmp4, call_tmp5, start, end, T2);
+  rvfRerefTmp = T2;
+  chpl_macro_tmp_936.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_936.addr = T;
+  call_tmp2 = chpl_macro_tmp_936;
+  chpl_gen_comm_put(((void*)(&call_tmp3)), chpl_nodeFromLocaleID(&((*(_formal_tmp_error)).locale), INT64(0), NULL), (*(_formal_tmp_error)).addr, sizeof(syserr), -1, INT64(1), INT64(874), "/root/repo/modules/standard/IO.chpl");
+  return;
+}
+
+/* IO.chpl:868 */
+static void on_fn51(iostyle* const _formal_tmp_local_style, int64_t start, chpl____wide__ref_file* const f, chpl____wide__ref_syserr* const _formal_tmp_error, int32_t hints, chpl____wide__ref_channel_T_dynamic_T* const this6, int64_t end, int64_t _ln, c_string _fn) {
+  chpl____wide__ref_locale call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_locale ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_qio_channel_ptr_t call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  qio_file_ptr_t ret2;
+  syserr call_tmp3;
+  int32_t call_tmp4;
+  int32_t call_tmp5;
+  _ref_iostyle rvfRerefTmp = NULL;
+  _ref_qio_channel_ptr_t T = NULL;
+  _ref_iostyle T2 = NULL;
+  chpl____wide__ref_locale chpl_macro_tmp_937;
+  chpl____wide__ref_locale chpl_macro_tmp_938;
+  chpl____wide__ref_qio_channel_ptr_t chpl_macro_tmp_939;
+  chpl____wide__ref_qio_file_ptr_t chpl_macro_tmp_940;
+  chpl____wide__ref_qio_channel_ptr_t chpl_macro_tmp_941;
+  chpl_macro_tmp_937.locale = (*(this6)).locale;
+  chpl_macro_tmp_937.addr = &(((*(this6)).addr)->home);
+  call_tmp = chpl_macro_tmp_937;
+  chpl_macro_tmp_938.locale = (*(f)).locale;
+  chpl_macro_tmp_938.addr = &(((*(f)).addr)->home);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_938).locale), INT64(0), NULL), (chpl_macro_tmp_938).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(869), "/root/repo/modules/standard/IO.chpl");
+  chpl_gen_comm_put(((void*)(&ret)), chpl_nodeFromLocaleID(&((call_tmp).locale), INT64(0), NULL), (call_tmp).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(869), "/root/repo/modules/standard/IO.chpl");
+  chpl_macro_tmp_939.locale = (*(this6)).locale;
+  chpl_macro_tmp_939.addr = &(((*(this6)).addr)->_channel_internal);
+  call_tmp2 = chpl_macro_tmp_939;
+  chpl_macro_tmp_940.locale = (*(f)).locale;
+  chpl_macro_tmp_940.addr = &(((*(f)).addr)->_file_internal);
+  chpl_gen_comm_get(((void*)(&ret2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_940).locale), INT64(0), NULL), (chpl_macro_tmp_940).addr, sizeof(qio_file_ptr_t), -1, INT64(1), INT64(874), "/root/repo/modules/standard/IO.chpl");
+  call_tmp4 = ((int32_t)(false));
+  call_tmp5 = ((int32_t)(true));
+  rvfRerefTmp = _formal_tmp_local_style;
+  T = (&call_tmp2)->addr;
+  T2 = rvfRerefTmp;
+  call_tmp3 = qio_channel_create(T, ret2, hints, call_tmp4, call_tmp5, start, end, T2);
+  rvfRerefTmp = T2;
+  chpl_macro_tmp_941.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_941.addr = T;
+  call_tmp2 = chpl_macro_tmp_941;
+  chpl_gen_comm_put(((void*)(&call_tmp3)), chpl_nodeFromLocaleID(&((*(_formal_tmp_error)).locale), INT64(0), NULL), (*(_formal_tmp_error)).addr, sizeof(syserr), -1, INT64(1), INT64(874), "/root/repo/modules/standard/IO.chpl");
+  return;
+}
+
+/* IO.chpl:868 */
+static void wrapon_fn50(_class_localson_fn50 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_channel_F_dynamic_T _1__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  int32_t _2_hints;
+  iostyle _3_rvfDerefTmp;
+  int64_t _4_end;
+  int64_t _5_start;
+  chpl____wide__ref_syserr _6__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_file _7__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  _1__tmp = (c)->_1__tmp;
+  chpl_check_nil(c, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  _2_hints = (c)->_2_hints;
+  chpl_check_nil(c, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  _3_rvfDerefTmp = (c)->_3_rvfDerefTmp;
+  chpl_check_nil(c, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  _4_end = (c)->_4_end;
+  chpl_check_nil(c, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  _5_start = (c)->_5_start;
+  chpl_check_nil(c, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  _6__tmp = (c)->_6__tmp;
+  chpl_check_nil(c, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  _7__tmp = (c)->_7__tmp;
+  on_fn50(&_1__tmp, _2_hints, &_3_rvfDerefTmp, _4_end, _5_start, &_6__tmp, &_7__tmp, _ln, _fn);
+  return;
+}
+
+/* IO.chpl:868 */
+static void wrapon_fn51(_class_localson_fn51 c) {
+  int64_t _ln;
+  c_string _fn;
+  iostyle _1_rvfDerefTmp;
+  int64_t _2_start;
+  chpl____wide__ref_file _3__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_syserr _4__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  int32_t _5_hints;
+  chpl____wide__ref_channel_T_dynamic_T _6__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t _7_end;
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  _1_rvfDerefTmp = (c)->_1_rvfDerefTmp;
+  chpl_check_nil(c, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  _2_start = (c)->_2_start;
+  chpl_check_nil(c, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  _3__tmp = (c)->_3__tmp;
+  chpl_check_nil(c, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  _4__tmp = (c)->_4__tmp;
+  chpl_check_nil(c, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  _5_hints = (c)->_5_hints;
+  chpl_check_nil(c, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  _6__tmp = (c)->_6__tmp;
+  chpl_check_nil(c, INT64(868), "/root/repo/modules/standard/IO.chpl");
+  _7_end = (c)->_7_end;
+  on_fn51(&_1_rvfDerefTmp, _2_start, &_3__tmp, &_4__tmp, _5_hints, &_6__tmp, _7_end, _ln, _fn);
+  return;
+}
+
+/* IO.chpl:880 */
+static void chpl___TILDE_channel(_ref_channel_F_dynamic_T this6, int64_t _ln, c_string _fn) {
+  _ref_locale call_tmp = NULL;
+  chpl_localeID_t call_tmp2;
+  chpl____wide_locale T = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn52 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_channel_F_dynamic_T T2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_channel_F_dynamic_T chpl_macro_tmp_942;
+  chpl_check_nil(this6, INT64(881), "/root/repo/modules/standard/IO.chpl");
+  call_tmp = &((this6)->home);
+  T = *(call_tmp);
+  call_tmp2 = (&T)->locale;
+  _args_size = sizeof(chpl__class_localson_fn52_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn52)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(881), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp2;
+  chpl_macro_tmp_942.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_942.addr = this6;
+  T2 = chpl_macro_tmp_942;
+  chpl_check_nil(_args_foron_fn, INT64(881), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_1_this = T2;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn52 ***/ chpl_executeOn(&call_tmp2, INT32(55), _args_foron_fn, sizeof(chpl__class_localson_fn52_object), INT64(881), "/root/repo/modules/standard/IO.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  return;
+}
+
+/* IO.chpl:880 */
+static void chpl___TILDE_channel2(_ref_channel_T_dynamic_T this6, int64_t _ln, c_string _fn) {
+  _ref_locale call_tmp = NULL;
+  chpl_localeID_t call_tmp2;
+  chpl____wide_locale T = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn53 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_channel_T_dynamic_T T2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_channel_T_dynamic_T chpl_macro_tmp_943;
+  chpl_check_nil(this6, INT64(881), "/root/repo/modules/standard/IO.chpl");
+  call_tmp = &((this6)->home);
+  T = *(call_tmp);
+  call_tmp2 = (&T)->locale;
+  _args_size = sizeof(chpl__class_localson_fn53_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn53)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(881), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp2;
+  chpl_macro_tmp_943.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_943.addr = this6;
+  T2 = chpl_macro_tmp_943;
+  chpl_check_nil(_args_foron_fn, INT64(881), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_1_this = T2;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn53 ***/ chpl_executeOn(&call_tmp2, INT32(56), _args_foron_fn, sizeof(chpl__class_localson_fn53_object), INT64(881), "/root/repo/modules/standard/IO.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  return;
+}
+
+/* IO.chpl:881 */
+static void on_fn52(chpl____wide__ref_channel_F_dynamic_T* const this6, int64_t _ln, c_string _fn) {
+  qio_channel_ptr_t local_QIO_CHANNEL_PTR_NULL;
+  qio_channel_ptr_t ret;
+  chpl____wide__ref_qio_channel_ptr_t call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_qio_channel_ptr_t chpl_macro_tmp_944;
+  chpl____wide__ref_qio_channel_ptr_t chpl_macro_tmp_945;
+  local_QIO_CHANNEL_PTR_NULL = QIO_CHANNEL_PTR_NULL;
+  chpl_macro_tmp_944.locale = (*(this6)).locale;
+  chpl_macro_tmp_944.addr = &(((*(this6)).addr)->_channel_internal);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_944).locale), INT64(0), NULL), (chpl_macro_tmp_944).addr, sizeof(qio_channel_ptr_t), -1, INT64(1), INT64(882), "/root/repo/modules/standard/IO.chpl");
+  qio_channel_release(ret);
+  chpl_macro_tmp_945.locale = (*(this6)).locale;
+  chpl_macro_tmp_945.addr = &(((*(this6)).addr)->_channel_internal);
+  call_tmp = chpl_macro_tmp_945;
+  chpl_gen_comm_put(((void*)(&local_QIO_CHANNEL_PTR_NULL)), chpl_nodeFromLocaleID(&((call_tmp).locale), INT64(0), NULL), (call_tmp).addr, sizeof(qio_channel_ptr_t), -1, INT64(1), INT64(883), "/root/repo/modules/standard/IO.chpl");
+  return;
+}
+
+/* IO.chpl:881 */
+static void on_fn53(chpl____wide__ref_channel_T_dynamic_T* const this6, int64_t _ln, c_string _fn) {
+  qio_channel_ptr_t local_QIO_CHANNEL_PTR_NULL;
+  qio_channel_ptr_t ret;
+  chpl____wide__ref_qio_channel_ptr_t call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_qio_channel_ptr_t chpl_macro_tmp_946;
+  chpl____wide__ref_qio_channel_ptr_t chpl_macro_tmp_947;
+  local_QIO_CHANNEL_PTR_NULL = QIO_CHANNEL_PTR_NULL;
+  chpl_macro_tmp_946.locale = (*(this6)).locale;
+  chpl_macro_tmp_946.addr = &(((*(this6)).addr)->_channel_internal);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_946).locale), INT64(0), NULL), (chpl_macro_tmp_946).addr, sizeof(qio_channel_ptr_t), -1, INT64(1), INT64(882), "/root/repo/modules/standard/IO.chpl");
+  qio_channel_release(ret);
+  chpl_macro_tmp_947.locale = (*(this6)).locale;
+  chpl_macro_tmp_947.addr = &(((*(this6)).addr)->_channel_internal);
+  call_tmp = chpl_macro_tmp_947;
+  chpl_gen_comm_put(((void*)(&local_QIO_CHANNEL_PTR_NULL)), chpl_nodeFromLocaleID(&((call_tmp).locale), INT64(0), NULL), (call_tmp).addr, sizeof(qio_channel_ptr_t), -1, INT64(1), INT64(883), "/root/repo/modules/standard/IO.chpl");
+  return;
+}
+
+/* IO.chpl:881 */
+static void wrapon_fn52(_class_localson_fn52 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_channel_F_dynamic_T _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(881), "/root/repo/modules/standard/IO.chpl");
+  _1_this = (c)->_1_this;
+  on_fn52(&_1_this, _ln, _fn);
+  return;
+}
+
+/* IO.chpl:881 */
+static void wrapon_fn53(_class_localson_fn53 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_channel_T_dynamic_T _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(881), "/root/repo/modules/standard/IO.chpl");
+  _1_this = (c)->_1_this;
+  on_fn53(&_1_this, _ln, _fn);
+  return;
+}
+
+/* IO.chpl:903 */
+static ioNewline _construct_ioNewline(chpl_bool skipWhitespaceOnly, ioNewline* const meme, int64_t _ln, c_string _fn) {
+  ioNewline this6;
+  this6 = *(meme);
+  (&this6)->skipWhitespaceOnly = skipWhitespaceOnly;
+  return this6;
+}
+
+/* IO.chpl:923 */
+static ioLiteral _construct_ioLiteral(c_string val, chpl_bool ignoreWhiteSpace, ioLiteral* const meme, int64_t _ln, c_string _fn) {
+  ioLiteral this6;
+  this6 = *(meme);
+  (&this6)->val = val;
+  (&this6)->ignoreWhiteSpace = ignoreWhiteSpace;
+  return this6;
+}
+
+/* IO.chpl:923 */
+static void chpl___ASSIGN_6(_ref_ioLiteral _arg1, ioLiteral* const _arg2, int64_t _ln, c_string _fn) {
+  _ref_c_string call_tmp = NULL;
+  c_string ret;
+  _ref_chpl_bool call_tmp2 = NULL;
+  chpl_bool ret2;
+  chpl_check_nil(_arg1, INT64(923), "/root/repo/modules/standard/IO.chpl");
+  call_tmp = &((_arg1)->val);
+  ret = (_arg2)->val;
+  *(call_tmp) = ret;
+  chpl_check_nil(_arg1, INT64(923), "/root/repo/modules/standard/IO.chpl");
+  call_tmp2 = &((_arg1)->ignoreWhiteSpace);
+  ret2 = (_arg2)->ignoreWhiteSpace;
+  *(call_tmp2) = ret2;
+  return;
+}
+
+/* IO.chpl:957 */
+static void _ch_ioerror(chpl____wide__ref_channel_T_dynamic_T* const this6, syserr error, chpl____wide_chpl_string msg, int64_t _ln, c_string _fn) {
+  heap_chpl_string path = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_chpl_string T = NULL;
+  chpl____wide_chpl_string type_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_string ret;
+  _ref_chpl_string _ref_tmp_ = NULL;
+  chpl____wide_chpl_string call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  heap_int64_t offset = NULL;
+  int64_t chpl_here_alloc_size2;
+  chpl_opaque chpl_here_alloc_tmp2;
+  heap_int64_t T2 = NULL;
+  chpl____wide__ref_locale call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp3;
+  chpl____wide_locale T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_chpl_string T4 = NULL;
+  _ref_int64_t T5 = NULL;
+  _class_localson_fn54 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_chpl_string T6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_int64_t T7 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_chpl_string T8 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t T9;
+  chpl____wide__ref_locale chpl_macro_tmp_948;
+  chpl____wide__ref_chpl_string chpl_macro_tmp_949;
+  chpl____wide__ref_int64_t chpl_macro_tmp_950;
+  chpl_here_alloc_size = sizeof(chpl_heap_chpl_string_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T = ((heap_chpl_string)(chpl_here_alloc_tmp));
+  path = T;
+  ret = defaultStringValue;
+  chpl_string_widen(&type_tmp, ret, _ln, _fn);
+  _ref_tmp_ = &type_tmp;
+  wide_string_from_c_string(&call_tmp, "unknown", INT64(0), INT64(0), _ln, _fn);
+  *(_ref_tmp_) = call_tmp;
+  chpl_check_nil(path, INT64(958), "/root/repo/modules/standard/IO.chpl");
+  (path)->value = type_tmp;
+  chpl_here_alloc_size2 = sizeof(chpl_heap_int64_t_object);
+  chpl_here_alloc_tmp2 = chpl_here_alloc(chpl_here_alloc_size2, INT16(22), _ln, _fn);
+  T2 = ((heap_int64_t)(chpl_here_alloc_tmp2));
+  offset = T2;
+  chpl_check_nil(offset, INT64(959), "/root/repo/modules/standard/IO.chpl");
+  (offset)->value = INT64(-1);
+  chpl_macro_tmp_948.locale = (*(this6)).locale;
+  chpl_macro_tmp_948.addr = &(((*(this6)).addr)->home);
+  call_tmp2 = chpl_macro_tmp_948;
+  chpl_gen_comm_get(((void*)(&T3)), chpl_nodeFromLocaleID(&((call_tmp2).locale), INT64(0), NULL), (call_tmp2).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(960), "/root/repo/modules/standard/IO.chpl");
+  call_tmp3 = (&T3)->locale;
+  chpl_check_nil(path, INT64(958), "/root/repo/modules/standard/IO.chpl");
+  T4 = &((path)->value);
+  chpl_check_nil(offset, INT64(959), "/root/repo/modules/standard/IO.chpl");
+  T5 = &((offset)->value);
+  _args_size = sizeof(chpl__class_localson_fn54_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn54)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(960), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp3;
+  chpl_check_nil(_args_foron_fn, INT64(960), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_1_this = *(this6);
+  chpl_macro_tmp_949.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_949.addr = T4;
+  T6 = chpl_macro_tmp_949;
+  chpl_check_nil(_args_foron_fn, INT64(960), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_2__tmp = T6;
+  chpl_macro_tmp_950.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_950.addr = T5;
+  T7 = chpl_macro_tmp_950;
+  chpl_check_nil(_args_foron_fn, INT64(960), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_3__tmp = T7;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn54 ***/ chpl_executeOn(&call_tmp3, INT32(57), _args_foron_fn, sizeof(chpl__class_localson_fn54_object), INT64(960), "/root/repo/modules/standard/IO.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  chpl_check_nil(path, INT64(958), "/root/repo/modules/standard/IO.chpl");
+  T8 = (path)->value;
+  chpl_check_nil(offset, INT64(959), "/root/repo/modules/standard/IO.chpl");
+  T9 = (offset)->value;
+  ioerror2(error, msg, T8, T9, _ln, _fn);
+  chpl_here_free(((void*)(path)), _ln, _fn);
+  chpl_here_free(((void*)(offset)), _ln, _fn);
+  return;
+}
+
+/* IO.chpl:960 */
+static void on_fn54(chpl____wide__ref_channel_T_dynamic_T* const this6, chpl____wide__ref_chpl_string* const path, chpl____wide__ref_int64_t* const offset, int64_t _ln, c_string _fn) {
+  c_string tmp_path;
+  int64_t tmp_offset;
+  syserr type_tmp;
+  _ref_syserr _ref_tmp_ = NULL;
+  syserr call_tmp;
+  qio_channel_ptr_t ret;
+  syserr call_tmp2;
+  int32_t call_tmp3;
+  _ref_c_string _ref_tmp_2 = NULL;
+  _ref_int64_t _ref_tmp_3 = NULL;
+  _ref_c_string T = NULL;
+  _ref_int64_t T2 = NULL;
+  int32_t call_tmp4;
+  chpl_bool call_tmp5;
+  chpl____wide_chpl_string call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_qio_channel_ptr_t chpl_macro_tmp_951;
+  tmp_path = "";
+  tmp_offset = INT64(0);
+  _ref_tmp_ = &type_tmp;
+  call_tmp = qio_int_to_err(INT32(0));
+  *(_ref_tmp_) = call_tmp;
+  chpl_macro_tmp_951.locale = (*(this6)).locale;
+  chpl_macro_tmp_951.addr = &(((*(this6)).addr)->_channel_internal);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_951).locale), INT64(0), NULL), (chpl_macro_tmp_951).addr, sizeof(qio_channel_ptr_t), -1, INT64(1), INT64(964), "/root/repo/modules/standard/IO.chpl");
+  call_tmp3 = ((int32_t)(true));
+  _ref_tmp_2 = &tmp_path;
+  _ref_tmp_3 = &tmp_offset;
+  T = _ref_tmp_2;
+  T2 = _ref_tmp_3;
+  call_tmp2 = qio_channel_path_offset(call_tmp3, ret, T, T2);
+  _ref_tmp_3 = T2;
+  _ref_tmp_2 = T;
+  call_tmp4 = qio_err_iserr(call_tmp2);
+  call_tmp5 = (call_tmp4 == INT32(0));
+  if (call_tmp5) {
+    wide_string_from_c_string(&call_tmp6, tmp_path, INT64(0), INT64(0), _ln, _fn);
+    chpl_gen_comm_put(((void*)(&call_tmp6)), chpl_nodeFromLocaleID(&((*(path)).locale), INT64(0), NULL), (*(path)).addr, sizeof(chpl____wide_chpl_string), -1, INT64(1), INT64(966), "/root/repo/modules/standard/IO.chpl");
+    chpl_gen_comm_put(((void*)(&tmp_offset)), chpl_nodeFromLocaleID(&((*(offset)).locale), INT64(0), NULL), (*(offset)).addr, sizeof(int64_t), -1, INT64(1), INT64(967), "/root/repo/modules/standard/IO.chpl");
+  }
+  return;
+}
+
+/* IO.chpl:960 */
+static void wrapon_fn54(_class_localson_fn54 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_channel_T_dynamic_T _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_chpl_string _2__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_int64_t _3__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(960), "/root/repo/modules/standard/IO.chpl");
+  _1_this = (c)->_1_this;
+  chpl_check_nil(c, INT64(960), "/root/repo/modules/standard/IO.chpl");
+  _2__tmp = (c)->_2__tmp;
+  chpl_check_nil(c, INT64(960), "/root/repo/modules/standard/IO.chpl");
+  _3__tmp = (c)->_3__tmp;
+  on_fn54(&_1_this, &_2__tmp, &_3__tmp, _ln, _fn);
+  return;
+}
+
+/* IO.chpl:994 */
+static void on_fn55(chpl____wide__ref_channel_T_dynamic_T* const this6, chpl____wide__ref_syserr* const _formal_tmp_error, int64_t _ln, c_string _fn) {
+  qio_channel_ptr_t ret;
+  syserr call_tmp;
+  chpl____wide__ref_qio_channel_ptr_t chpl_macro_tmp_952;
+  chpl_macro_tmp_952.locale = (*(this6)).locale;
+  chpl_macro_tmp_952.addr = &(((*(this6)).addr)->_channel_internal);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_952).locale), INT64(0), NULL), (chpl_macro_tmp_952).addr, sizeof(qio_channel_ptr_t), -1, INT64(1), INT64(995), "/root/repo/modules/standard/IO.chpl");
+  call_tmp = qio_channel_lock(ret);
+  chpl_gen_comm_put(((void*)(&call_tmp)), chpl_nodeFromLocaleID(&((*(_formal_tmp_error)).locale), INT64(0), NULL), (*(_formal_tmp_error)).addr, sizeof(syserr), -1, INT64(1), INT64(995), "/root/repo/modules/standard/IO.chpl");
+  return;
+}
+
+/* IO.chpl:994 */
+static void wrapon_fn55(_class_localson_fn55 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_channel_T_dynamic_T _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_syserr _2__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(994), "/root/repo/modules/standard/IO.chpl");
+  _1_this = (c)->_1_this;
+  chpl_check_nil(c, INT64(994), "/root/repo/modules/standard/IO.chpl");
+  _2__tmp = (c)->_2__tmp;
+  on_fn55(&_1_this, &_2__tmp, _ln, _fn);
+  return;
+}
+
+/* IO.chpl:1007 */
+static void on_fn56(chpl____wide__ref_channel_T_dynamic_T* const this6, int64_t _ln, c_string _fn) {
+  qio_channel_ptr_t ret;
+  chpl____wide__ref_qio_channel_ptr_t chpl_macro_tmp_953;
+  chpl_macro_tmp_953.locale = (*(this6)).locale;
+  chpl_macro_tmp_953.addr = &(((*(this6)).addr)->_channel_internal);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_953).locale), INT64(0), NULL), (chpl_macro_tmp_953).addr, sizeof(qio_channel_ptr_t), -1, INT64(1), INT64(1008), "/root/repo/modules/standard/IO.chpl");
+  qio_channel_unlock(ret);
+  return;
+}
+
+/* IO.chpl:1007 */
+static void wrapon_fn56(_class_localson_fn56 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_channel_T_dynamic_T _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(1007), "/root/repo/modules/standard/IO.chpl");
+  _1_this = (c)->_1_this;
+  on_fn56(&_1_this, _ln, _fn);
+  return;
+}
+
+/* IO.chpl:1126 */
+static void reader(_ref_file this6, chpl____wide__ref_syserr* const error, int64_t start, int64_t end, int32_t hints, iostyle* const style, _ref_channel_F_dynamic_T _retArg, int64_t _ln, c_string _fn) {
+  qio_channel_ptr_t local_QIO_CHANNEL_PTR_NULL;
+  heap_syserr _formal_tmp_error = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_syserr T = NULL;
+  heap_channel_F_dynamic_T ret = NULL;
+  int64_t chpl_here_alloc_size2;
+  chpl_opaque chpl_here_alloc_tmp2;
+  heap_channel_F_dynamic_T T2 = NULL;
+  channel_F_dynamic_T this7;
+  locale T3 = NULL;
+  chpl____wide_locale T4 = {CHPL_LOCALEID_T_INIT, NULL};
+  locale call_tmp = NULL;
+  locale T5 = NULL;
+  chpl____wide_locale T6 = {CHPL_LOCALEID_T_INIT, NULL};
+  qio_channel_ptr_t default_arg_channel_internal;
+  channel_F_dynamic_T wrap_call_tmp;
+  channel_F_dynamic_T T7;
+  heap_channel_F_dynamic_T ret2 = NULL;
+  int64_t chpl_here_alloc_size3;
+  chpl_opaque chpl_here_alloc_tmp3;
+  heap_channel_F_dynamic_T T8 = NULL;
+  channel_F_dynamic_T this8;
+  locale T9 = NULL;
+  chpl____wide_locale T10 = {CHPL_LOCALEID_T_INIT, NULL};
+  locale call_tmp2 = NULL;
+  locale T11 = NULL;
+  chpl____wide_locale T12 = {CHPL_LOCALEID_T_INIT, NULL};
+  qio_channel_ptr_t default_arg_channel_internal2;
+  channel_F_dynamic_T wrap_call_tmp2;
+  _ref_locale call_tmp3 = NULL;
+  chpl_localeID_t call_tmp4;
+  chpl____wide_locale T13 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_syserr T14 = NULL;
+  _ref_channel_F_dynamic_T T15 = NULL;
+  file rvfDerefTmp;
+  _class_localson_fn57 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_syserr T16 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_channel_F_dynamic_T T17 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_channel_F_dynamic_T _ref_tmp_ = NULL;
+  channel_F_dynamic_T T18;
+  chpl____wide__ref_channel_F_dynamic_T T19 = {CHPL_LOCALEID_T_INIT, NULL};
+  channel_F_dynamic_T T20;
+  syserr T21;
+  channel_F_dynamic_T T22;
+  heap_channel_F_dynamic_T T23 = NULL;
+  int64_t chpl_here_alloc_size4;
+  chpl_opaque chpl_here_alloc_tmp4;
+  heap_channel_F_dynamic_T T24 = NULL;
+  _ref_channel_F_dynamic_T _ref_tmp_2 = NULL;
+  channel_F_dynamic_T ret_to_arg_tmp_;
+  heap_channel_F_dynamic_T T25 = NULL;
+  int64_t chpl_here_alloc_size5;
+  chpl_opaque chpl_here_alloc_tmp5;
+  heap_channel_F_dynamic_T T26 = NULL;
+  _ref_channel_F_dynamic_T _ref_tmp_3 = NULL;
+  chpl____wide_locale chpl_macro_tmp_954;
+  chpl____wide_locale chpl_macro_tmp_955;
+  chpl____wide_locale chpl_macro_tmp_956;
+  chpl____wide_locale chpl_macro_tmp_957;
+  chpl____wide__ref_syserr chpl_macro_tmp_958;
+  chpl____wide__ref_channel_F_dynamic_T chpl_macro_tmp_959;
+  chpl____wide__ref_channel_F_dynamic_T chpl_macro_tmp_960;
+  local_QIO_CHANNEL_PTR_NULL = QIO_CHANNEL_PTR_NULL;
+  chpl_here_alloc_size = sizeof(chpl_heap_syserr_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T = ((heap_syserr)(chpl_here_alloc_tmp));
+  _formal_tmp_error = T;
+  chpl_here_alloc_size2 = sizeof(chpl_heap_channel_F_dynamic_T_object);
+  chpl_here_alloc_tmp2 = chpl_here_alloc(chpl_here_alloc_size2, INT16(22), _ln, _fn);
+  T2 = ((heap_channel_F_dynamic_T)(chpl_here_alloc_tmp2));
+  ret = T2;
+  T3 = nil;
+  chpl_macro_tmp_954.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_954.addr = T3;
+  T4 = chpl_macro_tmp_954;
+  (&this7)->home = T4;
+  T5 = ((locale)(nil));
+  call_tmp = T5;
+  chpl_macro_tmp_955.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_955.addr = call_tmp;
+  T6 = chpl_macro_tmp_955;
+  (&this7)->home = T6;
+  default_arg_channel_internal = local_QIO_CHANNEL_PTR_NULL;
+  (&this7)->_channel_internal = default_arg_channel_internal;
+  wrap_call_tmp = _construct_channel(call_tmp, default_arg_channel_internal, &this7, _ln, _fn);
+  chpl_check_nil(ret, INT64(1126), "/root/repo/modules/standard/IO.chpl");
+  (ret)->value = wrap_call_tmp;
+  chpl_check_nil(ret, INT64(1126), "/root/repo/modules/standard/IO.chpl");
+  T7 = (ret)->value;
+  *(_retArg) = chpl__initCopy4(&T7, _ln, _fn);
+  check(this6, _ln, _fn);
+  chpl_here_alloc_size3 = sizeof(chpl_heap_channel_F_dynamic_T_object);
+  chpl_here_alloc_tmp3 = chpl_here_alloc(chpl_here_alloc_size3, INT16(22), _ln, _fn);
+  T8 = ((heap_channel_F_dynamic_T)(chpl_here_alloc_tmp3));
+  ret2 = T8;
+  T9 = nil;
+  chpl_macro_tmp_956.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_956.addr = T9;
+  T10 = chpl_macro_tmp_956;
+  (&this8)->home = T10;
+  T11 = ((locale)(nil));
+  call_tmp2 = T11;
+  chpl_macro_tmp_957.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_957.addr = call_tmp2;
+  T12 = chpl_macro_tmp_957;
+  (&this8)->home = T12;
+  default_arg_channel_internal2 = local_QIO_CHANNEL_PTR_NULL;
+  (&this8)->_channel_internal = default_arg_channel_internal2;
+  wrap_call_tmp2 = _construct_channel(call_tmp2, default_arg_channel_internal2, &this8, _ln, _fn);
+  chpl_check_nil(ret2, INT64(1129), "/root/repo/modules/standard/IO.chpl");
+  (ret2)->value = wrap_call_tmp2;
+  chpl_check_nil(this6, INT64(1130), "/root/repo/modules/standard/IO.chpl");
+  call_tmp3 = &((this6)->home);
+  T13 = *(call_tmp3);
+  call_tmp4 = (&T13)->locale;
+  chpl_check_nil(_formal_tmp_error, INT64(1126), "/root/repo/modules/standard/IO.chpl");
+  T14 = &((_formal_tmp_error)->value);
+  chpl_check_nil(ret2, INT64(1129), "/root/repo/modules/standard/IO.chpl");
+  T15 = &((ret2)->value);
+  rvfDerefTmp = *(this6);
+  _args_size = sizeof(chpl__class_localson_fn57_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn57)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(1130), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp4;
+  chpl_macro_tmp_958.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_958.addr = T14;
+  T16 = chpl_macro_tmp_958;
+  chpl_check_nil(_args_foron_fn, INT64(1130), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_1__tmp = T16;
+  chpl_check_nil(_args_foron_fn, INT64(1130), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_2_end = end;
+  chpl_macro_tmp_959.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_959.addr = T15;
+  T17 = chpl_macro_tmp_959;
+  chpl_check_nil(_args_foron_fn, INT64(1130), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_3__tmp = T17;
+  chpl_check_nil(_args_foron_fn, INT64(1130), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_4_rvfDerefTmp = rvfDerefTmp;
+  chpl_check_nil(_args_foron_fn, INT64(1130), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_5_start = start;
+  chpl_check_nil(_args_foron_fn, INT64(1130), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_6_hints = hints;
+  chpl_check_nil(_args_foron_fn, INT64(1130), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_7_rvfDerefTmp = *(style);
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn57 ***/ chpl_executeOn(&call_tmp4, INT32(60), _args_foron_fn, sizeof(chpl__class_localson_fn57_object), INT64(1130), "/root/repo/modules/standard/IO.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  chpl_check_nil(ret, INT64(1133), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_ = &((ret)->value);
+  chpl_check_nil(ret2, INT64(1129), "/root/repo/modules/standard/IO.chpl");
+  T18 = (ret2)->value;
+  chpl_macro_tmp_960.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_960.addr = _ref_tmp_;
+  T19 = chpl_macro_tmp_960;
+  chpl___ASSIGN_4(&T19, &T18, _ln, _fn);
+  chpl_check_nil(ret, INT64(1126), "/root/repo/modules/standard/IO.chpl");
+  T20 = (ret)->value;
+  *(_retArg) = chpl__initCopy4(&T20, _ln, _fn);
+  chpl_check_nil(_formal_tmp_error, INT64(1126), "/root/repo/modules/standard/IO.chpl");
+  T21 = (_formal_tmp_error)->value;
+  chpl_gen_comm_put(((void*)(&T21)), chpl_nodeFromLocaleID(&((*(error)).locale), INT64(0), NULL), (*(error)).addr, sizeof(syserr), -1, INT64(1), INT64(1126), "/root/repo/modules/standard/IO.chpl");
+  chpl_check_nil(ret2, INT64(1129), "/root/repo/modules/standard/IO.chpl");
+  T22 = (ret2)->value;
+  chpl_here_alloc_size4 = sizeof(chpl_heap_channel_F_dynamic_T_object);
+  chpl_here_alloc_tmp4 = chpl_here_alloc(chpl_here_alloc_size4, INT16(22), _ln, _fn);
+  T24 = ((heap_channel_F_dynamic_T)(chpl_here_alloc_tmp4));
+  T23 = T24;
+  chpl_check_nil(T23, INT64(1129), "/root/repo/modules/standard/IO.chpl");
+  (T23)->value = T22;
+  chpl_check_nil(T23, INT64(1129), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_2 = &((T23)->value);
+  chpl___TILDE_channel(_ref_tmp_2, _ln, _fn);
+  chpl_here_free(((void*)(T23)), _ln, _fn);
+  ret_to_arg_tmp_ = *(_retArg);
+  chpl_here_alloc_size5 = sizeof(chpl_heap_channel_F_dynamic_T_object);
+  chpl_here_alloc_tmp5 = chpl_here_alloc(chpl_here_alloc_size5, INT16(22), _ln, _fn);
+  T26 = ((heap_channel_F_dynamic_T)(chpl_here_alloc_tmp5));
+  T25 = T26;
+  chpl_check_nil(T25, INT64(1126), "/root/repo/modules/standard/IO.chpl");
+  (T25)->value = ret_to_arg_tmp_;
+  chpl_check_nil(T25, INT64(1126), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_3 = &((T25)->value);
+  chpl___TILDE_channel(_ref_tmp_3, _ln, _fn);
+  chpl_here_free(((void*)(T25)), _ln, _fn);
+  chpl_here_free(((void*)(_formal_tmp_error)), _ln, _fn);
+  chpl_here_free(((void*)(ret2)), _ln, _fn);
+  chpl_here_free(((void*)(ret)), _ln, _fn);
+  return;
+}
+
+/* IO.chpl:1130 */
+static void on_fn57(chpl____wide__ref_syserr* const _formal_tmp_error, int64_t end, chpl____wide__ref_channel_F_dynamic_T* const ret, file* const this6, int64_t start, int32_t hints, iostyle* const style, int64_t _ln, c_string _fn) {
+  channel_F_dynamic_T call_tmp;
+  heap_channel_F_dynamic_T T = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_channel_F_dynamic_T T2 = NULL;
+  _ref_channel_F_dynamic_T _ref_tmp_ = NULL;
+  call_tmp = channel(this6, _formal_tmp_error, hints, start, end, style, _ln, _fn);
+  chpl___ASSIGN_4(ret, &call_tmp, _ln, _fn);
+  chpl_here_alloc_size = sizeof(chpl_heap_channel_F_dynamic_T_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T2 = ((heap_channel_F_dynamic_T)(chpl_here_alloc_tmp));
+  T = T2;
+  chpl_check_nil(T, INT64(1131), "/root/repo/modules/standard/IO.chpl");
+  (T)->value = call_tmp;
+  chpl_check_nil(T, INT64(1131), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_ = &((T)->value);
+  chpl___TILDE_channel(_ref_tmp_, _ln, _fn);
+  chpl_here_free(((void*)(T)), _ln, _fn);
+  return;
+}
+
+/* IO.chpl:1130 */
+static void wrapon_fn57(_class_localson_fn57 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_syserr _1__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t _2_end;
+  chpl____wide__ref_channel_F_dynamic_T _3__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  file _4_rvfDerefTmp;
+  int64_t _5_start;
+  int32_t _6_hints;
+  iostyle _7_rvfDerefTmp;
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(1130), "/root/repo/modules/standard/IO.chpl");
+  _1__tmp = (c)->_1__tmp;
+  chpl_check_nil(c, INT64(1130), "/root/repo/modules/standard/IO.chpl");
+  _2_end = (c)->_2_end;
+  chpl_check_nil(c, INT64(1130), "/root/repo/modules/standard/IO.chpl");
+  _3__tmp = (c)->_3__tmp;
+  chpl_check_nil(c, INT64(1130), "/root/repo/modules/standard/IO.chpl");
+  _4_rvfDerefTmp = (c)->_4_rvfDerefTmp;
+  chpl_check_nil(c, INT64(1130), "/root/repo/modules/standard/IO.chpl");
+  _5_start = (c)->_5_start;
+  chpl_check_nil(c, INT64(1130), "/root/repo/modules/standard/IO.chpl");
+  _6_hints = (c)->_6_hints;
+  chpl_check_nil(c, INT64(1130), "/root/repo/modules/standard/IO.chpl");
+  _7_rvfDerefTmp = (c)->_7_rvfDerefTmp;
+  on_fn57(&_1__tmp, _2_end, &_3__tmp, &_4_rvfDerefTmp, _5_start, _6_hints, &_7_rvfDerefTmp, _ln, _fn);
+  return;
+}
+
+/* IO.chpl:1136 */
+static void reader2(_ref_file this6, int64_t start, int64_t end, int32_t hints, iostyle* const style, _ref_channel_F_dynamic_T _retArg, int64_t _ln, c_string _fn) {
+  qio_channel_ptr_t local_QIO_CHANNEL_PTR_NULL;
+  heap_channel_F_dynamic_T ret = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_channel_F_dynamic_T T = NULL;
+  channel_F_dynamic_T this7;
+  locale T2 = NULL;
+  chpl____wide_locale T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  locale call_tmp = NULL;
+  locale T4 = NULL;
+  chpl____wide_locale T5 = {CHPL_LOCALEID_T_INIT, NULL};
+  qio_channel_ptr_t default_arg_channel_internal;
+  channel_F_dynamic_T wrap_call_tmp;
+  channel_F_dynamic_T T6;
+  channel_F_dynamic_T call_tmp2;
+  syserr err;
+  syserr type_tmp;
+  _ref_syserr _ref_tmp_ = NULL;
+  syserr call_tmp3;
+  channel_F_dynamic_T ret2;
+  _ref_channel_F_dynamic_T ret_to_arg_ref_tmp_ = NULL;
+  chpl____wide__ref_syserr _ref_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  int32_t call_tmp4;
+  chpl_bool call_tmp5;
+  chpl____wide_chpl_string call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_chpl_string call_tmp7 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_channel_F_dynamic_T _ref_tmp_3 = NULL;
+  chpl____wide__ref_channel_F_dynamic_T T7 = {CHPL_LOCALEID_T_INIT, NULL};
+  channel_F_dynamic_T T8;
+  channel_F_dynamic_T call_tmp8;
+  heap_channel_F_dynamic_T T9 = NULL;
+  int64_t chpl_here_alloc_size2;
+  chpl_opaque chpl_here_alloc_tmp2;
+  heap_channel_F_dynamic_T T10 = NULL;
+  _ref_channel_F_dynamic_T _ref_tmp_4 = NULL;
+  channel_F_dynamic_T ret_to_arg_tmp_;
+  heap_channel_F_dynamic_T T11 = NULL;
+  int64_t chpl_here_alloc_size3;
+  chpl_opaque chpl_here_alloc_tmp3;
+  heap_channel_F_dynamic_T T12 = NULL;
+  _ref_channel_F_dynamic_T _ref_tmp_5 = NULL;
+  chpl____wide_locale chpl_macro_tmp_961;
+  chpl____wide_locale chpl_macro_tmp_962;
+  chpl____wide__ref_syserr chpl_macro_tmp_963;
+  chpl____wide__ref_channel_F_dynamic_T chpl_macro_tmp_964;
+  local_QIO_CHANNEL_PTR_NULL = QIO_CHANNEL_PTR_NULL;
+  chpl_here_alloc_size = sizeof(chpl_heap_channel_F_dynamic_T_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T = ((heap_channel_F_dynamic_T)(chpl_here_alloc_tmp));
+  ret = T;
+  T2 = nil;
+  chpl_macro_tmp_961.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_961.addr = T2;
+  T3 = chpl_macro_tmp_961;
+  (&this7)->home = T3;
+  T4 = ((locale)(nil));
+  call_tmp = T4;
+  chpl_macro_tmp_962.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_962.addr = call_tmp;
+  T5 = chpl_macro_tmp_962;
+  (&this7)->home = T5;
+  default_arg_channel_internal = local_QIO_CHANNEL_PTR_NULL;
+  (&this7)->_channel_internal = default_arg_channel_internal;
+  wrap_call_tmp = _construct_channel(call_tmp, default_arg_channel_internal, &this7, _ln, _fn);
+  chpl_check_nil(ret, INT64(1136), "/root/repo/modules/standard/IO.chpl");
+  (ret)->value = wrap_call_tmp;
+  chpl_check_nil(ret, INT64(1136), "/root/repo/modules/standard/IO.chpl");
+  T6 = (ret)->value;
+  call_tmp2 = chpl__initCopy4(&T6, _ln, _fn);
+  *(_retArg) = call_tmp2;
+  _ref_tmp_ = &type_tmp;
+  call_tmp3 = qio_int_to_err(INT32(0));
+  *(_ref_tmp_) = call_tmp3;
+  err = type_tmp;
+  ret_to_arg_ref_tmp_ = &ret2;
+  chpl_macro_tmp_963.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_963.addr = &err;
+  _ref_tmp_2 = chpl_macro_tmp_963;
+  reader(this6, &_ref_tmp_2, start, end, hints, style, ret_to_arg_ref_tmp_, _ln, _fn);
+  call_tmp4 = qio_err_iserr(err);
+  call_tmp5 = (call_tmp4 != INT32(0));
+  if (call_tmp5) {
+    call_tmp6 = tryGetPath(this6, _ln, _fn);
+    wide_string_from_c_string(&call_tmp7, "in file.reader", INT64(0), INT64(0), _ln, _fn);
+    ioerror(err, call_tmp7, call_tmp6, _ln, _fn);
+  }
+  chpl_check_nil(ret, INT64(1140), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_3 = &((ret)->value);
+  chpl_macro_tmp_964.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_964.addr = _ref_tmp_3;
+  T7 = chpl_macro_tmp_964;
+  chpl___ASSIGN_4(&T7, &ret2, _ln, _fn);
+  chpl_check_nil(ret, INT64(1136), "/root/repo/modules/standard/IO.chpl");
+  T8 = (ret)->value;
+  call_tmp8 = chpl__initCopy4(&T8, _ln, _fn);
+  *(_retArg) = call_tmp8;
+  chpl_here_alloc_size2 = sizeof(chpl_heap_channel_F_dynamic_T_object);
+  chpl_here_alloc_tmp2 = chpl_here_alloc(chpl_here_alloc_size2, INT16(22), _ln, _fn);
+  T10 = ((heap_channel_F_dynamic_T)(chpl_here_alloc_tmp2));
+  T9 = T10;
+  chpl_check_nil(T9, INT64(1138), "/root/repo/modules/standard/IO.chpl");
+  (T9)->value = ret2;
+  chpl_check_nil(T9, INT64(1138), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_4 = &((T9)->value);
+  chpl___TILDE_channel(_ref_tmp_4, _ln, _fn);
+  chpl_here_free(((void*)(T9)), _ln, _fn);
+  ret_to_arg_tmp_ = *(_retArg);
+  chpl_here_alloc_size3 = sizeof(chpl_heap_channel_F_dynamic_T_object);
+  chpl_here_alloc_tmp3 = chpl_here_alloc(chpl_here_alloc_size3, INT16(22), _ln, _fn);
+  T12 = ((heap_channel_F_dynamic_T)(chpl_here_alloc_tmp3));
+  T11 = T12;
+  chpl_check_nil(T11, INT64(1136), "/root/repo/modules/standard/IO.chpl");
+  (T11)->value = ret_to_arg_tmp_;
+  chpl_check_nil(T11, INT64(1136), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_5 = &((T11)->value);
+  chpl___TILDE_channel(_ref_tmp_5, _ln, _fn);
+  chpl_here_free(((void*)(T11)), _ln, _fn);
+  chpl_here_free(((void*)(ret)), _ln, _fn);
+  return;
+}
+
+/* IO.chpl:1169 */
+static void writer(_ref_file this6, chpl____wide__ref_syserr* const error, int64_t start, int64_t end, int32_t hints, iostyle* const style, _ref_channel_T_dynamic_T _retArg, int64_t _ln, c_string _fn) {
+  qio_channel_ptr_t local_QIO_CHANNEL_PTR_NULL;
+  heap_syserr _formal_tmp_error = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_syserr T = NULL;
+  heap_channel_T_dynamic_T ret = NULL;
+  int64_t chpl_here_alloc_size2;
+  chpl_opaque chpl_here_alloc_tmp2;
+  heap_channel_T_dynamic_T T2 = NULL;
+  channel_T_dynamic_T this7;
+  locale T3 = NULL;
+  chpl____wide_locale T4 = {CHPL_LOCALEID_T_INIT, NULL};
+  locale call_tmp = NULL;
+  locale T5 = NULL;
+  chpl____wide_locale T6 = {CHPL_LOCALEID_T_INIT, NULL};
+  qio_channel_ptr_t default_arg_channel_internal;
+  channel_T_dynamic_T wrap_call_tmp;
+  channel_T_dynamic_T T7;
+  heap_channel_T_dynamic_T ret2 = NULL;
+  int64_t chpl_here_alloc_size3;
+  chpl_opaque chpl_here_alloc_tmp3;
+  heap_channel_T_dynamic_T T8 = NULL;
+  channel_T_dynamic_T this8;
+  locale T9 = NULL;
+  chpl____wide_locale T10 = {CHPL_LOCALEID_T_INIT, NULL};
+  locale call_tmp2 = NULL;
+  locale T11 = NULL;
+  chpl____wide_locale T12 = {CHPL_LOCALEID_T_INIT, NULL};
+  qio_channel_ptr_t default_arg_channel_internal2;
+  channel_T_dynamic_T wrap_call_tmp2;
+  _ref_locale call_tmp3 = NULL;
+  chpl_localeID_t call_tmp4;
+  chpl____wide_locale T13 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_syserr T14 = NULL;
+  _ref_channel_T_dynamic_T T15 = NULL;
+  file rvfDerefTmp;
+  _class_localson_fn58 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_syserr T16 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_channel_T_dynamic_T T17 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_channel_T_dynamic_T _ref_tmp_ = NULL;
+  channel_T_dynamic_T T18;
+  chpl____wide__ref_channel_T_dynamic_T T19 = {CHPL_LOCALEID_T_INIT, NULL};
+  channel_T_dynamic_T T20;
+  syserr T21;
+  channel_T_dynamic_T T22;
+  heap_channel_T_dynamic_T T23 = NULL;
+  int64_t chpl_here_alloc_size4;
+  chpl_opaque chpl_here_alloc_tmp4;
+  heap_channel_T_dynamic_T T24 = NULL;
+  _ref_channel_T_dynamic_T _ref_tmp_2 = NULL;
+  channel_T_dynamic_T ret_to_arg_tmp_;
+  heap_channel_T_dynamic_T T25 = NULL;
+  int64_t chpl_here_alloc_size5;
+  chpl_opaque chpl_here_alloc_tmp5;
+  heap_channel_T_dynamic_T T26 = NULL;
+  _ref_channel_T_dynamic_T _ref_tmp_3 = NULL;
+  chpl____wide_locale chpl_macro_tmp_965;
+  chpl____wide_locale chpl_macro_tmp_966;
+  chpl____wide_locale chpl_macro_tmp_967;
+  chpl____wide_locale chpl_macro_tmp_968;
+  chpl____wide__ref_syserr chpl_macro_tmp_969;
+  chpl____wide__ref_channel_T_dynamic_T chpl_macro_tmp_970;
+  chpl____wide__ref_channel_T_dynamic_T chpl_macro_tmp_971;
+  local_QIO_CHANNEL_PTR_NULL = QIO_CHANNEL_PTR_NULL;
+  chpl_here_alloc_size = sizeof(chpl_heap_syserr_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T = ((heap_syserr)(chpl_here_alloc_tmp));
+  _formal_tmp_error = T;
+  chpl_here_alloc_size2 = sizeof(chpl_heap_channel_T_dynamic_T_object);
+  chpl_here_alloc_tmp2 = chpl_here_alloc(chpl_here_alloc_size2, INT16(22), _ln, _fn);
+  T2 = ((heap_channel_T_dynamic_T)(chpl_here_alloc_tmp2));
+  ret = T2;
+  T3 = nil;
+  chpl_macro_tmp_965.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_965.addr = T3;
+  T4 = chpl_macro_tmp_965;
+  (&this7)->home = T4;
+  T5 = ((locale)(nil));
+  call_tmp = T5;
+  chpl_macro_tmp_966.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_966.addr = call_tmp;
+  T6 = chpl_macro_tmp_966;
+  (&this7)->home = T6;
+  default_arg_channel_internal = local_QIO_CHANNEL_PTR_NULL;
+  (&this7)->_channel_internal = default_arg_channel_internal;
+  wrap_call_tmp = _construct_channel2(call_tmp, default_arg_channel_internal, &this7, _ln, _fn);
+  chpl_check_nil(ret, INT64(1169), "/root/repo/modules/standard/IO.chpl");
+  (ret)->value = wrap_call_tmp;
+  chpl_check_nil(ret, INT64(1169), "/root/repo/modules/standard/IO.chpl");
+  T7 = (ret)->value;
+  *(_retArg) = chpl__initCopy5(&T7, _ln, _fn);
+  check(this6, _ln, _fn);
+  chpl_here_alloc_size3 = sizeof(chpl_heap_channel_T_dynamic_T_object);
+  chpl_here_alloc_tmp3 = chpl_here_alloc(chpl_here_alloc_size3, INT16(22), _ln, _fn);
+  T8 = ((heap_channel_T_dynamic_T)(chpl_here_alloc_tmp3));
+  ret2 = T8;
+  T9 = nil;
+  chpl_macro_tmp_967.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_967.addr = T9;
+  T10 = chpl_macro_tmp_967;
+  (&this8)->home = T10;
+  T11 = ((locale)(nil));
+  call_tmp2 = T11;
+  chpl_macro_tmp_968.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_968.addr = call_tmp2;
+  T12 = chpl_macro_tmp_968;
+  (&this8)->home = T12;
+  default_arg_channel_internal2 = local_QIO_CHANNEL_PTR_NULL;
+  (&this8)->_channel_internal = default_arg_channel_internal2;
+  wrap_call_tmp2 = _construct_channel2(call_tmp2, default_arg_channel_internal2, &this8, _ln, _fn);
+  chpl_check_nil(ret2, INT64(1172), "/root/repo/modules/standard/IO.chpl");
+  (ret2)->value = wrap_call_tmp2;
+  chpl_check_nil(this6, INT64(1173), "/root/repo/modules/standard/IO.chpl");
+  call_tmp3 = &((this6)->home);
+  T13 = *(call_tmp3);
+  call_tmp4 = (&T13)->locale;
+  chpl_check_nil(_formal_tmp_error, INT64(1169), "/root/repo/modules/standard/IO.chpl");
+  T14 = &((_formal_tmp_error)->value);
+  chpl_check_nil(ret2, INT64(1172), "/root/repo/modules/standard/IO.chpl");
+  T15 = &((ret2)->value);
+  rvfDerefTmp = *(this6);
+  _args_size = sizeof(chpl__class_localson_fn58_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn58)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(1173), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp4;
+  chpl_check_nil(_args_foron_fn, INT64(1173), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_1_rvfDerefTmp = rvfDerefTmp;
+  chpl_check_nil(_args_foron_fn, INT64(1173), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_2_start = start;
+  chpl_check_nil(_args_foron_fn, INT64(1173), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_3_hints = hints;
+  chpl_check_nil(_args_foron_fn, INT64(1173), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_4_rvfDerefTmp = *(style);
+  chpl_macro_tmp_969.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_969.addr = T14;
+  T16 = chpl_macro_tmp_969;
+  chpl_check_nil(_args_foron_fn, INT64(1173), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_5__tmp = T16;
+  chpl_check_nil(_args_foron_fn, INT64(1173), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_6_end = end;
+  chpl_macro_tmp_970.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_970.addr = T15;
+  T17 = chpl_macro_tmp_970;
+  chpl_check_nil(_args_foron_fn, INT64(1173), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_7__tmp = T17;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn58 ***/ chpl_executeOn(&call_tmp4, INT32(61), _args_foron_fn, sizeof(chpl__class_localson_fn58_object), INT64(1173), "/root/repo/modules/standard/IO.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  chpl_check_nil(ret, INT64(1176), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_ = &((ret)->value);
+  chpl_check_nil(ret2, INT64(1172), "/root/repo/modules/standard/IO.chpl");
+  T18 = (ret2)->value;
+  chpl_macro_tmp_971.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_971.addr = _ref_tmp_;
+  T19 = chpl_macro_tmp_971;
+  chpl___ASSIGN_5(&T19, &T18, _ln, _fn);
+  chpl_check_nil(ret, INT64(1169), "/root/repo/modules/standard/IO.chpl");
+  T20 = (ret)->value;
+  *(_retArg) = chpl__initCopy5(&T20, _ln, _fn);
+  chpl_check_nil(_formal_tmp_error, INT64(1169), "/root/repo/modules/standard/IO.chpl");
+  T21 = (_formal_tmp_error)->value;
+  chpl_gen_comm_put(((void*)(&T21)), chpl_nodeFromLocaleID(&((*(error)).locale), INT64(0), NULL), (*(error)).addr, sizeof(syserr), -1, INT64(1), INT64(1169), "/root/repo/modules/standard/IO.chpl");
+  chpl_check_nil(ret2, INT64(1172), "/root/repo/modules/standard/IO.chpl");
+  T22 = (ret2)->value;
+  chpl_here_alloc_size4 = sizeof(chpl_heap_channel_T_dynamic_T_object);
+  chpl_here_alloc_tmp4 = chpl_here_alloc(chpl_here_alloc_size4, INT16(22), _ln, _fn);
+  T24 = ((heap_channel_T_dynamic_T)(chpl_here_alloc_tmp4));
+  T23 = T24;
+  chpl_check_nil(T23, INT64(1172), "/root/repo/modules/standard/IO.chpl");
+  (T23)->value = T22;
+  chpl_check_nil(T23, INT64(1172), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_2 = &((T23)->value);
+  chpl___TILDE_channel2(_ref_tmp_2, _ln, _fn);
+  chpl_here_free(((void*)(T23)), _ln, _fn);
+  ret_to_arg_tmp_ = *(_retArg);
+  chpl_here_alloc_size5 = sizeof(chpl_heap_channel_T_dynamic_T_object);
+  chpl_here_alloc_tmp5 = chpl_here_alloc(chpl_here_alloc_size5, INT16(22), _ln, _fn);
+  T26 = ((heap_channel_T_dynamic_T)(chpl_here_alloc_tmp5));
+  T25 = T26;
+  chpl_check_nil(T25, INT64(1169), "/root/repo/modules/standard/IO.chpl");
+  (T25)->value = ret_to_arg_tmp_;
+  chpl_check_nil(T25, INT64(1169), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_3 = &((T25)->value);
+  chpl___TILDE_channel2(_ref_tmp_3, _ln, _fn);
+  chpl_here_free(((void*)(T25)), _ln, _fn);
+  chpl_here_free(((void*)(_formal_tmp_error)), _ln, _fn);
+  chpl_here_free(((void*)(ret2)), _ln, _fn);
+  chpl_here_free(((void*)(ret)), _ln, _fn);
+  return;
+}
+
+/* IO.chpl:1173 */
+static void on_fn58(file* const this6, int64_t start, int32_t hints, iostyle* const style, chpl____wide__ref_syserr* const _formal_tmp_error, int64_t end, chpl____wide__ref_channel_T_dynamic_T* const ret, int64_t _ln, c_string _fn) {
+  channel_T_dynamic_T call_tmp;
+  heap_channel_T_dynamic_T T = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_channel_T_dynamic_T T2 = NULL;
+  _ref_channel_T_dynamic_T _ref_tmp_ = NULL;
+  call_tmp = channel2(this6, _formal_tmp_error, hints, start, end, style, _ln, _fn);
+  chpl___ASSIGN_5(ret, &call_tmp, _ln, _fn);
+  chpl_here_alloc_size = sizeof(chpl_heap_channel_T_dynamic_T_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T2 = ((heap_channel_T_dynamic_T)(chpl_here_alloc_tmp));
+  T = T2;
+  chpl_check_nil(T, INT64(1174), "/root/repo/modules/standard/IO.chpl");
+  (T)->value = call_tmp;
+  chpl_check_nil(T, INT64(1174), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_ = &((T)->value);
+  chpl___TILDE_channel2(_ref_tmp_, _ln, _fn);
+  chpl_here_free(((void*)(T)), _ln, _fn);
+  return;
+}
+
+/* IO.chpl:1173 */
+static void wrapon_fn58(_class_localson_fn58 c) {
+  int64_t _ln;
+  c_string _fn;
+  file _1_rvfDerefTmp;
+  int64_t _2_start;
+  int32_t _3_hints;
+  iostyle _4_rvfDerefTmp;
+  chpl____wide__ref_syserr _5__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t _6_end;
+  chpl____wide__ref_channel_T_dynamic_T _7__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(1173), "/root/repo/modules/standard/IO.chpl");
+  _1_rvfDerefTmp = (c)->_1_rvfDerefTmp;
+  chpl_check_nil(c, INT64(1173), "/root/repo/modules/standard/IO.chpl");
+  _2_start = (c)->_2_start;
+  chpl_check_nil(c, INT64(1173), "/root/repo/modules/standard/IO.chpl");
+  _3_hints = (c)->_3_hints;
+  chpl_check_nil(c, INT64(1173), "/root/repo/modules/standard/IO.chpl");
+  _4_rvfDerefTmp = (c)->_4_rvfDerefTmp;
+  chpl_check_nil(c, INT64(1173), "/root/repo/modules/standard/IO.chpl");
+  _5__tmp = (c)->_5__tmp;
+  chpl_check_nil(c, INT64(1173), "/root/repo/modules/standard/IO.chpl");
+  _6_end = (c)->_6_end;
+  chpl_check_nil(c, INT64(1173), "/root/repo/modules/standard/IO.chpl");
+  _7__tmp = (c)->_7__tmp;
+  on_fn58(&_1_rvfDerefTmp, _2_start, _3_hints, &_4_rvfDerefTmp, &_5__tmp, _6_end, &_7__tmp, _ln, _fn);
+  return;
+}
+
+/* IO.chpl:1179 */
+static void writer2(_ref_file this6, int64_t start, int64_t end, int32_t hints, iostyle* const style, _ref_channel_T_dynamic_T _retArg, int64_t _ln, c_string _fn) {
+  qio_channel_ptr_t local_QIO_CHANNEL_PTR_NULL;
+  heap_channel_T_dynamic_T ret = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_channel_T_dynamic_T T = NULL;
+  channel_T_dynamic_T this7;
+  locale T2 = NULL;
+  chpl____wide_locale T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  locale call_tmp = NULL;
+  locale T4 = NULL;
+  chpl____wide_locale T5 = {CHPL_LOCALEID_T_INIT, NULL};
+  qio_channel_ptr_t default_arg_channel_internal;
+  channel_T_dynamic_T wrap_call_tmp;
+  channel_T_dynamic_T T6;
+  channel_T_dynamic_T call_tmp2;
+  syserr err;
+  syserr type_tmp;
+  _ref_syserr _ref_tmp_ = NULL;
+  syserr call_tmp3;
+  channel_T_dynamic_T ret2;
+  _ref_channel_T_dynamic_T ret_to_arg_ref_tmp_ = NULL;
+  chpl____wide__ref_syserr _ref_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  int32_t call_tmp4;
+  chpl_bool call_tmp5;
+  chpl____wide_chpl_string call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_chpl_string call_tmp7 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_channel_T_dynamic_T _ref_tmp_3 = NULL;
+  chpl____wide__ref_channel_T_dynamic_T T7 = {CHPL_LOCALEID_T_INIT, NULL};
+  channel_T_dynamic_T T8;
+  channel_T_dynamic_T call_tmp8;
+  heap_channel_T_dynamic_T T9 = NULL;
+  int64_t chpl_here_alloc_size2;
+  chpl_opaque chpl_here_alloc_tmp2;
+  heap_channel_T_dynamic_T T10 = NULL;
+  _ref_channel_T_dynamic_T _ref_tmp_4 = NULL;
+  channel_T_dynamic_T ret_to_arg_tmp_;
+  heap_channel_T_dynamic_T T11 = NULL;
+  int64_t chpl_here_alloc_size3;
+  chpl_opaque chpl_here_alloc_tmp3;
+  heap_channel_T_dynamic_T T12 = NULL;
+  _ref_channel_T_dynamic_T _ref_tmp_5 = NULL;
+  chpl____wide_locale chpl_macro_tmp_972;
+  chpl____wide_locale chpl_macro_tmp_973;
+  chpl____wide__ref_syserr chpl_macro_tmp_974;
+  chpl____wide__ref_channel_T_dynamic_T chpl_macro_tmp_975;
+  local_QIO_CHANNEL_PTR_NULL = QIO_CHANNEL_PTR_NULL;
+  chpl_here_alloc_size = sizeof(chpl_heap_channel_T_dynamic_T_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T = ((heap_channel_T_dynamic_T)(chpl_here_alloc_tmp));
+  ret = T;
+  T2 = nil;
+  chpl_macro_tmp_972.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_972.addr = T2;
+  T3 = chpl_macro_tmp_972;
+  (&this7)->home = T3;
+  T4 = ((locale)(nil));
+  call_tmp = T4;
+  chpl_macro_tmp_973.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_973.addr = call_tmp;
+  T5 = chpl_macro_tmp_973;
+  (&this7)->home = T5;
+  default_arg_channel_internal = local_QIO_CHANNEL_PTR_NULL;
+  (&this7)->_channel_internal = default_arg_channel_internal;
+  wrap_call_tmp = _construct_channel2(call_tmp, default_arg_channel_internal, &this7, _ln, _fn);
+  chpl_check_nil(ret, INT64(1179), "/root/repo/modules/standard/IO.chpl");
+  (ret)->value = wrap_call_tmp;
+  chpl_check_nil(ret, INT64(1179), "/root/repo/modules/standard/IO.chpl");
+  T6 = (ret)->value;
+  call_tmp2 = chpl__initCopy5(&T6, _ln, _fn);
+  *(_retArg) = call_tmp2;
+  _ref_tmp_ = &type_tmp;
+  call_tmp3 = qio_int_to_err(INT32(0));
+  *(_ref_tmp_) = call_tmp3;
+  err = type_tmp;
+  ret_to_arg_ref_tmp_ = &ret2;
+  chpl_macro_tmp_974.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_974.addr = &err;
+  _ref_tmp_2 = chpl_macro_tmp_974;
+  writer(this6, &_ref_tmp_2, start, end, hints, style, ret_to_arg_ref_tmp_, _ln, _fn);
+  call_tmp4 = qio_err_iserr(err);
+  call_tmp5 = (call_tmp4 != INT32(0));
+  if (call_tmp5) {
+    call_tmp6 = tryGetPath(this6, _ln, _fn);
+    wide_string_from_c_string(&call_tmp7, "in file.writer", INT64(0), INT64(0), _ln, _fn);
+    ioerror(err, call_tmp7, call_tmp6, _ln, _fn);
+  }
+  chpl_check_nil(ret, INT64(1185), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_3 = &((ret)->value);
+  chpl_macro_tmp_975.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_975.addr = _ref_tmp_3;
+  T7 = chpl_macro_tmp_975;
+  chpl___ASSIGN_5(&T7, &ret2, _ln, _fn);
+  chpl_check_nil(ret, INT64(1179), "/root/repo/modules/standard/IO.chpl");
+  T8 = (ret)->value;
+  call_tmp8 = chpl__initCopy5(&T8, _ln, _fn);
+  *(_retArg) = call_tmp8;
+  chpl_here_alloc_size2 = sizeof(chpl_heap_channel_T_dynamic_T_object);
+  chpl_here_alloc_tmp2 = chpl_here_alloc(chpl_here_alloc_size2, INT16(22), _ln, _fn);
+  T10 = ((heap_channel_T_dynamic_T)(chpl_here_alloc_tmp2));
+  T9 = T10;
+  chpl_check_nil(T9, INT64(1182), "/root/repo/modules/standard/IO.chpl");
+  (T9)->value = ret2;
+  chpl_check_nil(T9, INT64(1182), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_4 = &((T9)->value);
+  chpl___TILDE_channel2(_ref_tmp_4, _ln, _fn);
+  chpl_here_free(((void*)(T9)), _ln, _fn);
+  ret_to_arg_tmp_ = *(_retArg);
+  chpl_here_alloc_size3 = sizeof(chpl_heap_channel_T_dynamic_T_object);
+  chpl_here_alloc_tmp3 = chpl_here_alloc(chpl_here_alloc_size3, INT16(22), _ln, _fn);
+  T12 = ((heap_channel_T_dynamic_T)(chpl_here_alloc_tmp3));
+  T11 = T12;
+  chpl_check_nil(T11, INT64(1179), "/root/repo/modules/standard/IO.chpl");
+  (T11)->value = ret_to_arg_tmp_;
+  chpl_check_nil(T11, INT64(1179), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_5 = &((T11)->value);
+  chpl___TILDE_channel2(_ref_tmp_5, _ln, _fn);
+  chpl_here_free(((void*)(T11)), _ln, _fn);
+  chpl_here_free(((void*)(ret)), _ln, _fn);
+  return;
+}
+
+/* IO.chpl:1288 */
+static syserr _write_text_internal(qio_channel_ptr_t _channel_internal, chpl____wide_chpl_string x2, int64_t _ln, c_string _fn) {
+  syserr ret;
+  c_string call_tmp;
+  c_string call_tmp2;
+  int64_t call_tmp3;
+  syserr call_tmp4;
+  int32_t call_tmp5;
+  c_string_from_wide_string(&call_tmp, &x2, _ln, _fn);
+  c_string_from_wide_string(&call_tmp2, &x2, _ln, _fn);
+  call_tmp3 = string_length(call_tmp2);
+  call_tmp5 = ((int32_t)(false));
+  call_tmp4 = qio_channel_print_string(call_tmp5, _channel_internal, call_tmp, call_tmp3);
+  ret = call_tmp4;
+  goto _end__write_text_internal;
+  _end__write_text_internal:;
+  return ret;
+}
+
+/* IO.chpl:1288 */
+static syserr _write_text_internal2(qio_channel_ptr_t _channel_internal, int64_t x2, int64_t _ln, c_string _fn) {
+  syserr ret;
+  syserr call_tmp;
+  int32_t call_tmp2;
+  uint64_t call_tmp3;
+  int32_t call_tmp4;
+  _ref_int64_t _ref_tmp_ = NULL;
+  _ref_int64_t T = NULL;
+  call_tmp2 = ((int32_t)(false));
+  call_tmp3 = ((uint64_t)(INT64(8)));
+  call_tmp4 = ((int32_t)(true));
+  _ref_tmp_ = &x2;
+  T = _ref_tmp_;
+  call_tmp = qio_channel_print_int(call_tmp2, _channel_internal, T, call_tmp3, call_tmp4);
+  _ref_tmp_ = T;
+  ret = call_tmp;
+  goto _end__write_text_internal;
+  _end__write_text_internal:;
+  return ret;
+}
+
+/* IO.chpl:1525 */
+static chpl____wide_chpl_string _args_to_proto(chpl____wide_chpl_string _e0_args, int64_t _e1_args, ioNewline* const _e2_args, chpl____wide_chpl_string preArg, int64_t _ln, c_string _fn) {
+  chpl____wide_chpl_string ret = {CHPL_LOCALEID_T_INIT, NULL};
+  c_string err_args;
+  c_string name;
+  chpl____wide__ref__tuple_6_star_chpl_string T = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_chpl_string coerce_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_c_string _ref_tmp_ = NULL;
+  c_string call_tmp;
+  c_string_copy cs;
+  c_string call_tmp2;
+  c_string_copy call_tmp3;
+  _ref_c_string_copy _ref_tmp_2 = NULL;
+  chpl____wide_chpl_string call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_c_string_copy T2 = NULL;
+  c_string_copy cs2;
+  c_string call_tmp5;
+  c_string_copy call_tmp6;
+  _ref_c_string_copy _ref_tmp_3 = NULL;
+  chpl____wide_chpl_string call_tmp7 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_c_string_copy T3 = NULL;
+  c_string_copy cs3;
+  c_string call_tmp8;
+  c_string_copy call_tmp9;
+  _ref_c_string_copy _ref_tmp_4 = NULL;
+  chpl____wide_chpl_string call_tmp10 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_c_string_copy T4 = NULL;
+  _ref_c_string _ref_tmp_5 = NULL;
+  c_string_copy cs4;
+  c_string call_tmp11;
+  c_string_copy call_tmp12;
+  _ref_c_string_copy _ref_tmp_6 = NULL;
+  chpl____wide_chpl_string call_tmp13 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_c_string_copy T5 = NULL;
+  c_string call_tmp14;
+  chpl____wide_chpl_string call_tmp15 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_c_string _ref_tmp_7 = NULL;
+  c_string_copy cs5;
+  c_string call_tmp16;
+  c_string_copy call_tmp17;
+  _ref_c_string_copy _ref_tmp_8 = NULL;
+  chpl____wide_chpl_string call_tmp18 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_c_string_copy T6 = NULL;
+  c_string call_tmp19;
+  c_string name2;
+  chpl____wide__ref__tuple_6_star_chpl_string T7 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_chpl_string coerce_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_c_string _ref_tmp_9 = NULL;
+  c_string call_tmp20;
+  c_string_copy cs6;
+  c_string call_tmp21;
+  c_string_copy call_tmp22;
+  _ref_c_string_copy _ref_tmp_10 = NULL;
+  chpl____wide_chpl_string call_tmp23 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_c_string_copy T8 = NULL;
+  c_string_copy cs7;
+  c_string call_tmp24;
+  c_string_copy call_tmp25;
+  _ref_c_string_copy _ref_tmp_11 = NULL;
+  chpl____wide_chpl_string call_tmp26 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_c_string_copy T9 = NULL;
+  c_string_copy cs8;
+  c_string call_tmp27;
+  c_string_copy call_tmp28;
+  _ref_c_string_copy _ref_tmp_12 = NULL;
+  chpl____wide_chpl_string call_tmp29 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_c_string_copy T10 = NULL;
+  _ref_c_string _ref_tmp_13 = NULL;
+  c_string_copy cs9;
+  c_string call_tmp30;
+  c_string_copy call_tmp31;
+  _ref_c_string_copy _ref_tmp_14 = NULL;
+  chpl____wide_chpl_string call_tmp32 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_c_string_copy T11 = NULL;
+  c_string call_tmp33;
+  chpl____wide_chpl_string call_tmp34 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_c_string _ref_tmp_15 = NULL;
+  c_string_copy cs10;
+  c_string call_tmp35;
+  c_string_copy call_tmp36;
+  _ref_c_string_copy _ref_tmp_16 = NULL;
+  chpl____wide_chpl_string call_tmp37 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_c_string_copy T12 = NULL;
+  c_string call_tmp38;
+  c_string name3;
+  chpl____wide__ref__tuple_6_star_chpl_string T13 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_chpl_string coerce_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_c_string _ref_tmp_17 = NULL;
+  c_string call_tmp39;
+  c_string_copy cs11;
+  c_string call_tmp40;
+  c_string_copy call_tmp41;
+  _ref_c_string_copy _ref_tmp_18 = NULL;
+  chpl____wide_chpl_string call_tmp42 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_c_string_copy T14 = NULL;
+  c_string_copy cs12;
+  c_string call_tmp43;
+  c_string_copy call_tmp44;
+  _ref_c_string_copy _ref_tmp_19 = NULL;
+  chpl____wide_chpl_string call_tmp45 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_c_string_copy T15 = NULL;
+  c_string_copy cs13;
+  c_string call_tmp46;
+  c_string_copy call_tmp47;
+  _ref_c_string_copy _ref_tmp_20 = NULL;
+  chpl____wide_chpl_string call_tmp48 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_c_string_copy T16 = NULL;
+  _ref_c_string _ref_tmp_21 = NULL;
+  c_string_copy cs14;
+  c_string call_tmp49;
+  c_string_copy call_tmp50;
+  _ref_c_string_copy _ref_tmp_22 = NULL;
+  chpl____wide_chpl_string call_tmp51 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_c_string_copy T17 = NULL;
+  c_string call_tmp52;
+  chpl____wide_chpl_string call_tmp53 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref__tuple_6_star_chpl_string chpl_macro_tmp_976;
+  chpl____wide__ref_chpl_string chpl_macro_tmp_977;
+  chpl____wide__ref__tuple_6_star_chpl_string chpl_macro_tmp_978;
+  chpl____wide__ref_chpl_string chpl_macro_tmp_979;
+  chpl____wide__ref__tuple_6_star_chpl_string chpl_macro_tmp_980;
+  chpl____wide__ref_chpl_string chpl_macro_tmp_981;
+  err_args = "";
+  name = "";
+  chpl_check_nil((&_arg_to_proto_names)->addr, INT64(1524), "/root/repo/modules/standard/IO.chpl");
+  chpl_macro_tmp_976.locale = (&_arg_to_proto_names)->locale;
+  chpl_macro_tmp_976.addr = &(((&_arg_to_proto_names)->addr)->value);
+  T = chpl_macro_tmp_976;
+  chpl_macro_tmp_977.locale = (T).locale;
+  chpl_macro_tmp_977.addr = (*((T).addr) + INT64(0));
+  chpl_gen_comm_wide_string_get(((void*)(&coerce_tmp)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_977).locale), INT64(0), NULL), (chpl_macro_tmp_977).addr, sizeof(chpl____wide_chpl_string), -1, INT64(1), INT64(1532), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_ = &name;
+  c_string_from_wide_string(&call_tmp, &coerce_tmp, _ln, _fn);
+  *(_ref_tmp_) = call_tmp;
+  c_string_from_wide_string(&call_tmp2, &preArg, _ln, _fn);
+  call_tmp3 = string_concat(call_tmp2, name, _ln, _fn);
+  cs = call_tmp3;
+  _ref_tmp_2 = &cs;
+  T2 = _ref_tmp_2;
+  chpl_string_widen(&call_tmp4, string_from_c_string_copy(T2, false, INT64(0)), _ln, _fn);
+  _ref_tmp_2 = T2;
+  c_string_from_wide_string(&call_tmp5, &call_tmp4, _ln, _fn);
+  call_tmp6 = string_concat(call_tmp5, ":", _ln, _fn);
+  cs2 = call_tmp6;
+  _ref_tmp_3 = &cs2;
+  T3 = _ref_tmp_3;
+  chpl_string_widen(&call_tmp7, string_from_c_string_copy(T3, false, INT64(0)), _ln, _fn);
+  _ref_tmp_3 = T3;
+  c_string_from_wide_string(&call_tmp8, &call_tmp7, _ln, _fn);
+  call_tmp9 = string_concat(call_tmp8, "string", _ln, _fn);
+  cs3 = call_tmp9;
+  _ref_tmp_4 = &cs3;
+  T4 = _ref_tmp_4;
+  chpl_string_widen(&call_tmp10, string_from_c_string_copy(T4, false, INT64(0)), _ln, _fn);
+  _ref_tmp_4 = T4;
+  _ref_tmp_5 = &err_args;
+  c_string_from_wide_string(&call_tmp11, &call_tmp10, _ln, _fn);
+  call_tmp12 = string_concat(err_args, call_tmp11, _ln, _fn);
+  cs4 = call_tmp12;
+  _ref_tmp_6 = &cs4;
+  T5 = _ref_tmp_6;
+  chpl_string_widen(&call_tmp13, string_from_c_string_copy(T5, false, INT64(0)), _ln, _fn);
+  _ref_tmp_6 = T5;
+  c_string_from_wide_string(&call_tmp14, &call_tmp13, _ln, _fn);
+  *(_ref_tmp_5) = call_tmp14;
+  wide_string_from_c_string(&call_tmp15, ", ", INT64(0), INT64(0), _ln, _fn);
+  _ref_tmp_7 = &err_args;
+  c_string_from_wide_string(&call_tmp16, &call_tmp15, _ln, _fn);
+  call_tmp17 = string_concat(err_args, call_tmp16, _ln, _fn);
+  cs5 = call_tmp17;
+  _ref_tmp_8 = &cs5;
+  T6 = _ref_tmp_8;
+  chpl_string_widen(&call_tmp18, string_from_c_string_copy(T6, false, INT64(0)), _ln, _fn);
+  _ref_tmp_8 = T6;
+  c_string_from_wide_string(&call_tmp19, &call_tmp18, _ln, _fn);
+  *(_ref_tmp_7) = call_tmp19;
+  name2 = "";
+  chpl_check_nil((&_arg_to_proto_names)->addr, INT64(1524), "/root/repo/modules/standard/IO.chpl");
+  chpl_macro_tmp_978.locale = (&_arg_to_proto_names)->locale;
+  chpl_macro_tmp_978.addr = &(((&_arg_to_proto_names)->addr)->value);
+  T7 = chpl_macro_tmp_978;
+  chpl_macro_tmp_979.locale = (T7).locale;
+  chpl_macro_tmp_979.addr = (*((T7).addr) + INT64(1));
+  chpl_gen_comm_wide_string_get(((void*)(&coerce_tmp2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_979).locale), INT64(0), NULL), (chpl_macro_tmp_979).addr, sizeof(chpl____wide_chpl_string), -1, INT64(1), INT64(1532), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_9 = &name2;
+  c_string_from_wide_string(&call_tmp20, &coerce_tmp2, _ln, _fn);
+  *(_ref_tmp_9) = call_tmp20;
+  c_string_from_wide_string(&call_tmp21, &preArg, _ln, _fn);
+  call_tmp22 = string_concat(call_tmp21, name2, _ln, _fn);
+  cs6 = call_tmp22;
+  _ref_tmp_10 = &cs6;
+  T8 = _ref_tmp_10;
+  chpl_string_widen(&call_tmp23, string_from_c_string_copy(T8, false, INT64(0)), _ln, _fn);
+  _ref_tmp_10 = T8;
+  c_string_from_wide_string(&call_tmp24, &call_tmp23, _ln, _fn);
+  call_tmp25 = string_concat(call_tmp24, ":", _ln, _fn);
+  cs7 = call_tmp25;
+  _ref_tmp_11 = &cs7;
+  T9 = _ref_tmp_11;
+  chpl_string_widen(&call_tmp26, string_from_c_string_copy(T9, false, INT64(0)), _ln, _fn);
+  _ref_tmp_11 = T9;
+  c_string_from_wide_string(&call_tmp27, &call_tmp26, _ln, _fn);
+  call_tmp28 = string_concat(call_tmp27, "int(64)", _ln, _fn);
+  cs8 = call_tmp28;
+  _ref_tmp_12 = &cs8;
+  T10 = _ref_tmp_12;
+  chpl_string_widen(&call_tmp29, string_from_c_string_copy(T10, false, INT64(0)), _ln, _fn);
+  _ref_tmp_12 = T10;
+  _ref_tmp_13 = &err_args;
+  c_string_from_wide_string(&call_tmp30, &call_tmp29, _ln, _fn);
+  call_tmp31 = string_concat(err_args, call_tmp30, _ln, _fn);
+  cs9 = call_tmp31;
+  _ref_tmp_14 = &cs9;
+  T11 = _ref_tmp_14;
+  chpl_string_widen(&call_tmp32, string_from_c_string_copy(T11, false, INT64(0)), _ln, _fn);
+  _ref_tmp_14 = T11;
+  c_string_from_wide_string(&call_tmp33, &call_tmp32, _ln, _fn);
+  *(_ref_tmp_13) = call_tmp33;
+  wide_string_from_c_string(&call_tmp34, ", ", INT64(0), INT64(0), _ln, _fn);
+  _ref_tmp_15 = &err_args;
+  c_string_from_wide_string(&call_tmp35, &call_tmp34, _ln, _fn);
+  call_tmp36 = string_concat(err_args, call_tmp35, _ln, _fn);
+  cs10 = call_tmp36;
+  _ref_tmp_16 = &cs10;
+  T12 = _ref_tmp_16;
+  chpl_string_widen(&call_tmp37, string_from_c_string_copy(T12, false, INT64(0)), _ln, _fn);
+  _ref_tmp_16 = T12;
+  c_string_from_wide_string(&call_tmp38, &call_tmp37, _ln, _fn);
+  *(_ref_tmp_15) = call_tmp38;
+  name3 = "";
+  chpl_check_nil((&_arg_to_proto_names)->addr, INT64(1524), "/root/repo/modules/standard/IO.chpl");
+  chpl_macro_tmp_980.locale = (&_arg_to_proto_names)->locale;
+  chpl_macro_tmp_980.addr = &(((&_arg_to_proto_names)->addr)->value);
+  T13 = chpl_macro_tmp_980;
+  chpl_macro_tmp_981.locale = (T13).locale;
+  chpl_macro_tmp_981.addr = (*((T13).addr) + INT64(2));
+  chpl_gen_comm_wide_string_get(((void*)(&coerce_tmp3)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_981).locale), INT64(0), NULL), (chpl_macro_tmp_981).addr, sizeof(chpl____wide_chpl_string), -1, INT64(1), INT64(1532), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_17 = &name3;
+  c_string_from_wide_string(&call_tmp39, &coerce_tmp3, _ln, _fn);
+  *(_ref_tmp_17) = call_tmp39;
+  c_string_from_wide_string(&call_tmp40, &preArg, _ln, _fn);
+  call_tmp41 = string_concat(call_tmp40, name3, _ln, _fn);
+  cs11 = call_tmp41;
+  _ref_tmp_18 = &cs11;
+  T14 = _ref_tmp_18;
+  chpl_string_widen(&call_tmp42, string_from_c_string_copy(T14, false, INT64(0)), _ln, _fn);
+  _ref_tmp_18 = T14;
+  c_string_from_wide_string(&call_tmp43, &call_tmp42, _ln, _fn);
+  call_tmp44 = string_concat(call_tmp43, ":", _ln, _fn);
+  cs12 = call_tmp44;
+  _ref_tmp_19 = &cs12;
+  T15 = _ref_tmp_19;
+  chpl_string_widen(&call_tmp45, string_from_c_string_copy(T15, false, INT64(0)), _ln, _fn);
+  _ref_tmp_19 = T15;
+  c_string_from_wide_string(&call_tmp46, &call_tmp45, _ln, _fn);
+  call_tmp47 = string_concat(call_tmp46, "ioNewline", _ln, _fn);
+  cs13 = call_tmp47;
+  _ref_tmp_20 = &cs13;
+  T16 = _ref_tmp_20;
+  chpl_string_widen(&call_tmp48, string_from_c_string_copy(T16, false, INT64(0)), _ln, _fn);
+  _ref_tmp_20 = T16;
+  _ref_tmp_21 = &err_args;
+  c_string_from_wide_string(&call_tmp49, &call_tmp48, _ln, _fn);
+  call_tmp50 = string_concat(err_args, call_tmp49, _ln, _fn);
+  cs14 = call_tmp50;
+  _ref_tmp_22 = &cs14;
+  T17 = _ref_tmp_22;
+  chpl_string_widen(&call_tmp51, string_from_c_string_copy(T17, false, INT64(0)), _ln, _fn);
+  _ref_tmp_22 = T17;
+  c_string_from_wide_string(&call_tmp52, &call_tmp51, _ln, _fn);
+  *(_ref_tmp_21) = call_tmp52;
+  wide_string_from_c_string(&call_tmp53, err_args, INT64(0), INT64(0), _ln, _fn);
+  ret = call_tmp53;
+  return ret;
+}
+
+/* IO.chpl:1832 */
+static void on_fn59(chpl____wide__ref_channel_T_dynamic_T* const this6, chpl____wide__ref_syserr* const _formal_tmp_error, chpl____wide__ref__tuple_3_chpl_string_int64_t_ioNewline* const args, int64_t _ln, c_string _fn) {
+  syserr err;
+  syserr type_tmp;
+  _ref_syserr _ref_tmp_ = NULL;
+  syserr call_tmp;
+  _ref_syserr _ref_tmp_2 = NULL;
+  heap_syserr _formal_tmp_error2 = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_syserr T = NULL;
+  _ref_syserr _ref_tmp_3 = NULL;
+  syserr call_tmp2;
+  chpl____wide__ref_locale call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp4;
+  chpl____wide_locale T2 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_syserr T3 = NULL;
+  _class_localson_fn55 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_syserr T4 = {CHPL_LOCALEID_T_INIT, NULL};
+  syserr T5;
+  int32_t call_tmp5;
+  chpl_bool call_tmp6;
+  chpl____wide_chpl_string call_tmp7 = {CHPL_LOCALEID_T_INIT, NULL};
+  syserr T6;
+  int32_t call_tmp8;
+  chpl_bool call_tmp9;
+  qio_channel_ptr_t ret;
+  chpl____wide_chpl_string coerce_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  syserr e;
+  syserr type_tmp2;
+  _ref_syserr _ref_tmp_4 = NULL;
+  syserr call_tmp10;
+  uint8_t call_tmp11;
+  uint8_t call_tmp12;
+  chpl_bool call_tmp13;
+  int16_t call_tmp14;
+  int16_t call_tmp15;
+  chpl_bool call_tmp16;
+  syserr ret2;
+  int64_t call_tmp17;
+  c_string call_tmp18;
+  c_string call_tmp19;
+  int64_t call_tmp20;
+  syserr call_tmp21;
+  int32_t call_tmp22;
+  int32_t call_tmp23;
+  int16_t call_tmp24;
+  int16_t call_tmp25;
+  chpl_bool call_tmp26;
+  syserr ret3;
+  int64_t call_tmp27;
+  c_string call_tmp28;
+  c_string call_tmp29;
+  int64_t call_tmp30;
+  syserr call_tmp31;
+  int32_t call_tmp32;
+  int32_t call_tmp33;
+  syserr ret4;
+  int64_t call_tmp34;
+  c_string call_tmp35;
+  c_string call_tmp36;
+  int64_t call_tmp37;
+  syserr call_tmp38;
+  int32_t call_tmp39;
+  int32_t call_tmp40;
+  syserr call_tmp41;
+  syserr T7;
+  int32_t call_tmp42;
+  chpl_bool call_tmp43;
+  qio_channel_ptr_t ret5;
+  int64_t coerce_tmp2;
+  syserr e2;
+  syserr type_tmp3;
+  _ref_syserr _ref_tmp_5 = NULL;
+  syserr call_tmp44;
+  uint8_t call_tmp45;
+  uint8_t call_tmp46;
+  chpl_bool call_tmp47;
+  int16_t call_tmp48;
+  int16_t call_tmp49;
+  chpl_bool call_tmp50;
+  syserr ret6;
+  syserr call_tmp51;
+  int32_t call_tmp52;
+  int32_t call_tmp53;
+  uint64_t call_tmp54;
+  int32_t call_tmp55;
+  _ref_int64_t _ref_tmp_6 = NULL;
+  _ref_int64_t T8 = NULL;
+  int16_t call_tmp56;
+  int16_t call_tmp57;
+  chpl_bool call_tmp58;
+  syserr ret7;
+  syserr call_tmp59;
+  int32_t call_tmp60;
+  int32_t call_tmp61;
+  uint64_t call_tmp62;
+  int32_t call_tmp63;
+  _ref_int64_t _ref_tmp_7 = NULL;
+  _ref_int64_t T9 = NULL;
+  syserr ret8;
+  syserr call_tmp64;
+  int32_t call_tmp65;
+  int32_t call_tmp66;
+  uint64_t call_tmp67;
+  int32_t call_tmp68;
+  _ref_int64_t _ref_tmp_8 = NULL;
+  _ref_int64_t T10 = NULL;
+  syserr call_tmp69;
+  syserr T11;
+  int32_t call_tmp70;
+  chpl_bool call_tmp71;
+  qio_channel_ptr_t ret9;
+  syserr ret10;
+  syserr type_tmp4;
+  _ref_syserr _ref_tmp_9 = NULL;
+  syserr call_tmp72;
+  syserr call_tmp73;
+  int32_t call_tmp74;
+  chpl____wide__ref_locale call_tmp75 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp76;
+  chpl____wide_locale T12 = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn56 _args_foron_fn2 = NULL;
+  int64_t _args_size2;
+  chpl_opaque _args_alloc2;
+  chpl____wide__ref_locale chpl_macro_tmp_982;
+  chpl____wide__ref_syserr chpl_macro_tmp_983;
+  chpl____wide__ref_qio_channel_ptr_t chpl_macro_tmp_984;
+  chpl____wide__ref_chpl_string chpl_macro_tmp_985;
+  chpl____wide__ref_qio_channel_ptr_t chpl_macro_tmp_986;
+  chpl____wide__ref_int64_t chpl_macro_tmp_987;
+  chpl____wide__ref_qio_channel_ptr_t chpl_macro_tmp_988;
+  chpl____wide__ref_locale chpl_macro_tmp_989;
+  _ref_tmp_ = &type_tmp;
+  call_tmp = qio_int_to_err(INT32(0));
+  *(_ref_tmp_) = call_tmp;
+  err = type_tmp;
+  _ref_tmp_2 = &err;
+  chpl_here_alloc_size = sizeof(chpl_heap_syserr_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T = ((heap_syserr)(chpl_here_alloc_tmp));
+  _formal_tmp_error2 = T;
+  chpl_check_nil(_formal_tmp_error2, INT64(1833), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_3 = &((_formal_tmp_error2)->value);
+  call_tmp2 = qio_int_to_err(INT32(0));
+  *(_ref_tmp_3) = call_tmp2;
+  chpl_macro_tmp_982.locale = (*(this6)).locale;
+  chpl_macro_tmp_982.addr = &(((*(this6)).addr)->home);
+  call_tmp3 = chpl_macro_tmp_982;
+  chpl_gen_comm_get(((void*)(&T2)), chpl_nodeFromLocaleID(&((call_tmp3).locale), INT64(0), NULL), (call_tmp3).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(1833), "/root/repo/modules/standard/IO.chpl");
+  call_tmp4 = (&T2)->locale;
+  chpl_check_nil(_formal_tmp_error2, INT64(1833), "/root/repo/modules/standard/IO.chpl");
+  T3 = &((_formal_tmp_error2)->value);
+  _args_size = sizeof(chpl__class_localson_fn55_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn55)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(1833), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp4;
+  chpl_check_nil(_args_foron_fn, INT64(1833), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_1_this = *(this6);
+  chpl_macro_tmp_983.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_983.addr = T3;
+  T4 = chpl_macro_tmp_983;
+  chpl_check_nil(_args_foron_fn, INT64(1833), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_2__tmp = T4;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn55 ***/ chpl_executeOn(&call_tmp4, INT32(58), _args_foron_fn, sizeof(chpl__class_localson_fn55_object), INT64(994), "/root/repo/modules/standard/IO.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  chpl_check_nil(_formal_tmp_error2, INT64(1833), "/root/repo/modules/standard/IO.chpl");
+  T5 = (_formal_tmp_error2)->value;
+  *(_ref_tmp_2) = T5;
+  chpl_here_free(((void*)(_formal_tmp_error2)), _ln, _fn);
+  call_tmp5 = qio_err_iserr(err);
+  call_tmp6 = (call_tmp5 != INT32(0));
+  if (call_tmp6) {
+    wide_string_from_c_string(&call_tmp7, "in lock", INT64(0), INT64(0), _ln, _fn);
+    _ch_ioerror(this6, err, call_tmp7, _ln, _fn);
+  }
+  chpl_gen_comm_get(((void*)(&T6)), chpl_nodeFromLocaleID(&((*(_formal_tmp_error)).locale), INT64(0), NULL), (*(_formal_tmp_error)).addr, sizeof(syserr), -1, INT64(1), INT64(1835), "/root/repo/modules/standard/IO.chpl");
+  call_tmp8 = qio_err_iserr(T6);
+  call_tmp9 = (call_tmp8 == INT32(0));
+  if (call_tmp9) {
+    chpl_macro_tmp_984.locale = (*(this6)).locale;
+    chpl_macro_tmp_984.addr = &(((*(this6)).addr)->_channel_internal);
+    chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_984).locale), INT64(0), NULL), (chpl_macro_tmp_984).addr, sizeof(qio_channel_ptr_t), -1, INT64(1), INT64(1836), "/root/repo/modules/standard/IO.chpl");
+    chpl_macro_tmp_985.locale = (*(args)).locale;
+    chpl_macro_tmp_985.addr = &(((*(args)).addr)->x1);
+    chpl_gen_comm_wide_string_get(((void*)(&coerce_tmp)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_985).locale), INT64(0), NULL), (chpl_macro_tmp_985).addr, sizeof(chpl____wide_chpl_string), -1, INT64(1), INT64(1836), "/root/repo/modules/standard/IO.chpl");
+    _ref_tmp_4 = &type_tmp2;
+    call_tmp10 = qio_int_to_err(INT32(0));
+    *(_ref_tmp_4) = call_tmp10;
+    call_tmp11 = qio_channel_binary(ret);
+    call_tmp12 = qio_channel_byteorder(ret);
+    call_tmp13 = (call_tmp11 != UINT8(0));
+    if (call_tmp13) {
+      call_tmp14 = ((int16_t)(call_tmp12));
+      call_tmp15 = ((int16_t)(iokind_big));
+      call_tmp16 = (call_tmp14 == call_tmp15);
+      if (call_tmp16) {
+        call_tmp17 = qio_channel_str_style(ret);
+        c_string_from_wide_string(&call_tmp18, &coerce_tmp, _ln, _fn);
+        c_string_from_wide_string(&call_tmp19, &coerce_tmp, _ln, _fn);
+        call_tmp20 = string_length(call_tmp19);
+        call_tmp22 = ((int32_t)(false));
+        call_tmp23 = ((int32_t)(iokind_big));
+        call_tmp21 = qio_channel_write_string(call_tmp22, call_tmp23, call_tmp17, ret, call_tmp18, call_tmp20);
+        ret2 = call_tmp21;
+        goto _end__write_binary_internal;
+        _end__write_binary_internal:;
+        e = ret2;
+      } else {
+        call_tmp24 = ((int16_t)(call_tmp12));
+        call_tmp25 = ((int16_t)(iokind_little));
+        call_tmp26 = (call_tmp24 == call_tmp25);
+        if (call_tmp26) {
+          call_tmp27 = qio_channel_str_style(ret);
+          c_string_from_wide_string(&call_tmp28, &coerce_tmp, _ln, _fn);
+          c_string_from_wide_string(&call_tmp29, &coerce_tmp, _ln, _fn);
+          call_tmp30 = string_length(call_tmp29);
+          call_tmp32 = ((int32_t)(false));
+          call_tmp33 = ((int32_t)(iokind_little));
+          call_tmp31 = qio_channel_write_string(call_tmp32, call_tmp33, call_tmp27, ret, call_tmp28, call_tmp30);
+          ret3 = call_tmp31;
+          goto _end__write_binary_internal2;
+          _end__write_binary_internal2:;
+          e = ret3;
+        } else {
+          call_tmp34 = qio_channel_str_style(ret);
+          c_string_from_wide_string(&call_tmp35, &coerce_tmp, _ln, _fn);
+          c_string_from_wide_string(&call_tmp36, &coerce_tmp, _ln, _fn);
+          call_tmp37 = string_length(call_tmp36);
+          call_tmp39 = ((int32_t)(false));
+          call_tmp40 = ((int32_t)(iokind_native));
+          call_tmp38 = qio_channel_write_string(call_tmp39, call_tmp40, call_tmp34, ret, call_tmp35, call_tmp37);
+          ret4 = call_tmp38;
+          goto _end__write_binary_internal3;
+          _end__write_binary_internal3:;
+          e = ret4;
+        }
+      }
+    } else {
+      call_tmp41 = _write_text_internal(ret, coerce_tmp, _ln, _fn);
+      e = call_tmp41;
+    }
+    chpl_gen_comm_put(((void*)(&e)), chpl_nodeFromLocaleID(&((*(_formal_tmp_error)).locale), INT64(0), NULL), (*(_formal_tmp_error)).addr, sizeof(syserr), -1, INT64(1), INT64(1836), "/root/repo/modules/standard/IO.chpl");
+  }
+  chpl_gen_comm_get(((void*)(&T7)), chpl_nodeFromLocaleID(&((*(_formal_tmp_error)).locale), INT64(0), NULL), (*(_formal_tmp_error)).addr, sizeof(syserr), -1, INT64(1), INT64(1835), "/root/repo/modules/standard/IO.chpl");
+  call_tmp42 = qio_err_iserr(T7);
+  call_tmp43 = (call_tmp42 == INT32(0));
+  if (call_tmp43) {
+    chpl_macro_tmp_986.locale = (*(this6)).locale;
+    chpl_macro_tmp_986.addr = &(((*(this6)).addr)->_channel_internal);
+    chpl_gen_comm_get(((void*)(&ret5)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_986).locale), INT64(0), NULL), (chpl_macro_tmp_986).addr, sizeof(qio_channel_ptr_t), -1, INT64(1), INT64(1836), "/root/repo/modules/standard/IO.chpl");
+    chpl_macro_tmp_987.locale = (*(args)).locale;
+    chpl_macro_tmp_987.addr = &(((*(args)).addr)->x2);
+    chpl_gen_comm_get(((void*)(&coerce_tmp2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_987).locale), INT64(0), NULL), (chpl_macro_tmp_987).addr, sizeof(int64_t), -1, INT64(1), INT64(1836), "/root/repo/modules/standard/IO.chpl");
+    _ref_tmp_5 = &type_tmp3;
+    call_tmp44 = qio_int_to_err(INT32(0));
+    *(_ref_tmp_5) = call_tmp44;
+    call_tmp45 = qio_channel_binary(ret5);
+    call_tmp46 = qio_channel_byteorder(ret5);
+    call_tmp47 = (call_tmp45 != UINT8(0));
+    if (call_tmp47) {
+      call_tmp48 = ((int16_t)(call_tmp46));
+      call_tmp49 = ((int16_t)(iokind_big));
+      call_tmp50 = (call_tmp48 == call_tmp49);
+      if (call_tmp50) {
+        call_tmp52 = ((int32_t)(false));
+        call_tmp53 = ((int32_t)(iokind_big));
+        call_tmp54 = ((uint64_t)(INT64(8)));
+        call_tmp55 = ((int32_t)(true));
+        _ref_tmp_6 = &coerce_tmp2;
+        T8 = _ref_tmp_6;
+        call_tmp51 = qio_channel_write_int(call_tmp52, call_tmp53, ret5, T8, call_tmp54, call_tmp55);
+        _ref_tmp_6 = T8;
+        ret6 = call_tmp51;
+        goto _end__write_binary_internal4;
+        _end__write_binary_internal4:;
+        e2 = ret6;
+      } else {
+        call_tmp56 = ((int16_t)(call_tmp46));
+        call_tmp57 = ((int16_t)(iokind_little));
+        call_tmp58 = (call_tmp56 == call_tmp57);
+        if (call_tmp58) {
+          call_tmp60 = ((int32_t)(false));
+          call_tmp61 = ((int32_t)(iokind_little));
+          call_tmp62 = ((uint64_t)(INT64(8)));
+          call_tmp63 = ((int32_t)(true));
+          _ref_tmp_7 = &coerce_tmp2;
+          T9 = _ref_tmp_7;
+          call_tmp59 = qio_channel_write_int(call_tmp60, call_tmp61, ret5, T9, call_tmp62, call_tmp63);
+          _ref_tmp_7 = T9;
+          ret7 = call_tmp59;
+          goto _end__write_binary_internal5;
+          _end__write_binary_internal5:;
+          e2 = ret7;
+        } else {
+          call_tmp65 = ((int32_t)(false));
+          call_tmp66 = ((int32_t)(iokind_native));
+          call_tmp67 = ((uint64_t)(INT64(8)));
+          call_tmp68 = ((int32_t)(true));
+          _ref_tmp_8 = &coerce_tmp2;
+          T10 = _ref_tmp_8;
+          call_tmp64 = qio_channel_write_int(call_tmp65, call_tmp66, ret5, T10, call_tmp67, call_tmp68);
+          _ref_tmp_8 = T10;
+          ret8 = call_tmp64;
+          goto _end__write_binary_internal6;
+          _end__write_binary_internal6:;
+          e2 = ret8;
+        }
+      }
+    } else {
+      call_tmp69 = _write_text_internal2(ret5, coerce_tmp2, _ln, _fn);
+      e2 = call_tmp69;
+    }
+    chpl_gen_comm_put(((void*)(&e2)), chpl_nodeFromLocaleID(&((*(_formal_tmp_error)).locale), INT64(0), NULL), (*(_formal_tmp_error)).addr, sizeof(syserr), -1, INT64(1), INT64(1836), "/root/repo/modules/standard/IO.chpl");
+  }
+  chpl_gen_comm_get(((void*)(&T11)), chpl_nodeFromLocaleID(&((*(_formal_tmp_error)).locale), INT64(0), NULL), (*(_formal_tmp_error)).addr, sizeof(syserr), -1, INT64(1), INT64(1835), "/root/repo/modules/standard/IO.chpl");
+  call_tmp70 = qio_err_iserr(T11);
+  call_tmp71 = (call_tmp70 == INT32(0));
+  if (call_tmp71) {
+    chpl_macro_tmp_988.locale = (*(this6)).locale;
+    chpl_macro_tmp_988.addr = &(((*(this6)).addr)->_channel_internal);
+    chpl_gen_comm_get(((void*)(&ret9)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_988).locale), INT64(0), NULL), (chpl_macro_tmp_988).addr, sizeof(qio_channel_ptr_t), -1, INT64(1), INT64(1836), "/root/repo/modules/standard/IO.chpl");
+    _ref_tmp_9 = &type_tmp4;
+    call_tmp72 = qio_int_to_err(INT32(0));
+    *(_ref_tmp_9) = call_tmp72;
+    call_tmp74 = ((int32_t)(false));
+    call_tmp73 = qio_channel_write_newline(call_tmp74, ret9);
+    ret10 = call_tmp73;
+    goto _end__write_one_internal;
+    _end__write_one_internal:;
+    chpl_gen_comm_put(((void*)(&ret10)), chpl_nodeFromLocaleID(&((*(_formal_tmp_error)).locale), INT64(0), NULL), (*(_formal_tmp_error)).addr, sizeof(syserr), -1, INT64(1), INT64(1836), "/root/repo/modules/standard/IO.chpl");
+  }
+  chpl_macro_tmp_989.locale = (*(this6)).locale;
+  chpl_macro_tmp_989.addr = &(((*(this6)).addr)->home);
+  call_tmp75 = chpl_macro_tmp_989;
+  chpl_gen_comm_get(((void*)(&T12)), chpl_nodeFromLocaleID(&((call_tmp75).locale), INT64(0), NULL), (call_tmp75).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(1839), "/root/repo/modules/standard/IO.chpl");
+  call_tmp76 = (&T12)->locale;
+  _args_size2 = sizeof(chpl__class_localson_fn56_object);
+  _args_alloc2 = chpl_mem_allocPooled(_args_size2, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn2 = ((_class_localson_fn56)(_args_alloc2));
+  chpl_check_nil(_args_foron_fn2, INT64(1839), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn2)->_0__tmp = call_tmp76;
+  chpl_check_nil(_args_foron_fn2, INT64(1839), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn2)->_1_this = *(this6);
+  (_args_foron_fn2)->_ln = _ln;
+  (_args_foron_fn2)->_fn = _fn;
+  /*** wrapon_fn56 ***/ chpl_executeOn(&call_tmp76, INT32(59), _args_foron_fn2, sizeof(chpl__class_localson_fn56_object), INT64(1007), "/root/repo/modules/standard/IO.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn2)), _ln, _fn);
+  return;
+}
+
+/* IO.chpl:1832 */
+static void wrapon_fn59(_class_localson_fn59 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_channel_T_dynamic_T _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_syserr _2__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref__tuple_3_chpl_string_int64_t_ioNewline _3__tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(1832), "/root/repo/modules/standard/IO.chpl");
+  _1_this = (c)->_1_this;
+  chpl_check_nil(c, INT64(1832), "/root/repo/modules/standard/IO.chpl");
+  _2__tmp = (c)->_2__tmp;
+  chpl_check_nil(c, INT64(1832), "/root/repo/modules/standard/IO.chpl");
+  _3__tmp = (c)->_3__tmp;
+  on_fn59(&_1_this, &_2__tmp, &_3__tmp, _ln, _fn);
+  return;
+}
+
+/* IO.chpl:1897 */
+static chpl_bool writeln(chpl____wide__ref_channel_T_dynamic_T* const this6, chpl____wide_chpl_string _e0_args, int64_t _e1_args, int64_t _ln, c_string _fn) {
+  chpl_bool ret;
+  ioNewline this7;
+  chpl_bool x2;
+  _ref_chpl_bool _ref_tmp_ = NULL;
+  ioNewline wrap_call_tmp;
+  chpl_bool ret2;
+  syserr e;
+  syserr type_tmp;
+  _ref_syserr _ref_tmp_2 = NULL;
+  syserr call_tmp;
+  _ref_syserr _ref_tmp_3 = NULL;
+  heap_syserr _formal_tmp_error = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_syserr T = NULL;
+  heap__tuple_3_chpl_string_int64_t_ioNewline args = NULL;
+  int64_t chpl_here_alloc_size2;
+  chpl_opaque chpl_here_alloc_tmp2;
+  heap__tuple_3_chpl_string_int64_t_ioNewline T2 = NULL;
+  _tuple_3_chpl_string_int64_t_ioNewline this8;
+  chpl_bool ret3;
+  _ref_syserr _ref_tmp_4 = NULL;
+  syserr call_tmp2;
+  chpl____wide__ref_locale call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp4;
+  chpl____wide_locale T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_syserr T4 = NULL;
+  _ref__tuple_3_chpl_string_int64_t_ioNewline T5 = NULL;
+  _class_localson_fn59 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_syserr T6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref__tuple_3_chpl_string_int64_t_ioNewline T7 = {CHPL_LOCALEID_T_INIT, NULL};
+  syserr T8;
+  int32_t call_tmp5;
+  chpl_bool call_tmp6;
+  _ref_chpl_bool _ref_tmp_5 = NULL;
+  syserr T9;
+  int32_t call_tmp7;
+  chpl_bool call_tmp8;
+  _ref_chpl_bool _ref_tmp_6 = NULL;
+  chpl____wide_chpl_string call_tmp9 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_chpl_string call_tmp10 = {CHPL_LOCALEID_T_INIT, NULL};
+  c_string_copy cs;
+  c_string call_tmp11;
+  c_string_copy call_tmp12;
+  _ref_c_string_copy _ref_tmp_7 = NULL;
+  chpl____wide_chpl_string call_tmp13 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_c_string_copy T10 = NULL;
+  c_string_copy cs2;
+  c_string call_tmp14;
+  c_string_copy call_tmp15;
+  _ref_c_string_copy _ref_tmp_8 = NULL;
+  chpl_string call_tmp16;
+  _ref_c_string_copy T11 = NULL;
+  chpl____wide_chpl_string T12 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_chpl_bool _ref_tmp_9 = NULL;
+  _ref_chpl_bool _ref_tmp_10 = NULL;
+  chpl____wide__ref_locale chpl_macro_tmp_990;
+  chpl____wide__ref_syserr chpl_macro_tmp_991;
+  chpl____wide__ref__tuple_3_chpl_string_int64_t_ioNewline chpl_macro_tmp_992;
+  (&this7)->skipWhitespaceOnly = false;
+  x2 = false;
+  _ref_tmp_ = &x2;
+  *(_ref_tmp_) = false;
+  (&this7)->skipWhitespaceOnly = x2;
+  wrap_call_tmp = _construct_ioNewline(x2, &this7, _ln, _fn);
+  _ref_tmp_2 = &type_tmp;
+  call_tmp = qio_int_to_err(INT32(0));
+  *(_ref_tmp_2) = call_tmp;
+  e = type_tmp;
+  _ref_tmp_3 = &e;
+  chpl_here_alloc_size = sizeof(chpl_heap_syserr_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T = ((heap_syserr)(chpl_here_alloc_tmp));
+  _formal_tmp_error = T;
+  chpl_here_alloc_size2 = sizeof(chpl_heap__tuple_3_chpl_string_int64_t_ioNewline_object);
+  chpl_here_alloc_tmp2 = chpl_here_alloc(chpl_here_alloc_size2, INT16(22), _ln, _fn);
+  T2 = ((heap__tuple_3_chpl_string_int64_t_ioNewline)(chpl_here_alloc_tmp2));
+  args = T2;
+  (&this8)->x1 = _e0_args;
+  (&this8)->x2 = _e1_args;
+  (&this8)->x3 = wrap_call_tmp;
+  chpl_check_nil(args, INT64(1898), "/root/repo/modules/standard/IO.chpl");
+  (args)->value = this8;
+  chpl_check_nil(_formal_tmp_error, INT64(1898), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_4 = &((_formal_tmp_error)->value);
+  call_tmp2 = qio_int_to_err(INT32(0));
+  *(_ref_tmp_4) = call_tmp2;
+  chpl_macro_tmp_990.locale = (*(this6)).locale;
+  chpl_macro_tmp_990.addr = &(((*(this6)).addr)->home);
+  call_tmp3 = chpl_macro_tmp_990;
+  chpl_gen_comm_get(((void*)(&T3)), chpl_nodeFromLocaleID(&((call_tmp3).locale), INT64(0), NULL), (call_tmp3).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(1898), "/root/repo/modules/standard/IO.chpl");
+  call_tmp4 = (&T3)->locale;
+  chpl_check_nil(_formal_tmp_error, INT64(1898), "/root/repo/modules/standard/IO.chpl");
+  T4 = &((_formal_tmp_error)->value);
+  chpl_check_nil(args, INT64(1898), "/root/repo/modules/standard/IO.chpl");
+  T5 = &((args)->value);
+  _args_size = sizeof(chpl__class_localson_fn59_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn59)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(1898), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp4;
+  chpl_check_nil(_args_foron_fn, INT64(1898), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_1_this = *(this6);
+  chpl_macro_tmp_991.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_991.addr = T4;
+  T6 = chpl_macro_tmp_991;
+  chpl_check_nil(_args_foron_fn, INT64(1898), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_2__tmp = T6;
+  chpl_macro_tmp_992.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_992.addr = T5;
+  T7 = chpl_macro_tmp_992;
+  chpl_check_nil(_args_foron_fn, INT64(1898), "/root/repo/modules/standard/IO.chpl");
+  (_args_foron_fn)->_3__tmp = T7;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn59 ***/ chpl_executeOn(&call_tmp4, INT32(62), _args_foron_fn, sizeof(chpl__class_localson_fn59_object), INT64(1832), "/root/repo/modules/standard/IO.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  chpl_check_nil(_formal_tmp_error, INT64(1898), "/root/repo/modules/standard/IO.chpl");
+  T8 = (_formal_tmp_error)->value;
+  call_tmp5 = qio_err_iserr(T8);
+  call_tmp6 = (call_tmp5 == INT32(0));
+  _ref_tmp_5 = &ret3;
+  *(_ref_tmp_5) = call_tmp6;
+  chpl_check_nil(_formal_tmp_error, INT64(1898), "/root/repo/modules/standard/IO.chpl");
+  T9 = (_formal_tmp_error)->value;
+  *(_ref_tmp_3) = T9;
+  chpl_here_free(((void*)(_formal_tmp_error)), _ln, _fn);
+  chpl_here_free(((void*)(args)), _ln, _fn);
+  call_tmp7 = qio_err_iserr(e);
+  call_tmp8 = (call_tmp7 == INT32(0));
+  if (call_tmp8) {
+    _ref_tmp_6 = &ret2;
+    *(_ref_tmp_6) = true;
+    goto _end_write;
+  } else {
+    wide_string_from_c_string(&call_tmp10, "", INT64(0), INT64(0), _ln, _fn);
+    call_tmp9 = _args_to_proto(_e0_args, _e1_args, &wrap_call_tmp, call_tmp10, _ln, _fn);
+    c_string_from_wide_string(&call_tmp11, &call_tmp9, _ln, _fn);
+    call_tmp12 = string_concat("in channel.write(", call_tmp11, _ln, _fn);
+    cs = call_tmp12;
+    _ref_tmp_7 = &cs;
+    T10 = _ref_tmp_7;
+    chpl_string_widen(&call_tmp13, string_from_c_string_copy(T10, false, INT64(0)), _ln, _fn);
+    _ref_tmp_7 = T10;
+    c_string_from_wide_string(&call_tmp14, &call_tmp13, _ln, _fn);
+    call_tmp15 = string_concat(call_tmp14, ")", _ln, _fn);
+    cs2 = call_tmp15;
+    _ref_tmp_8 = &cs2;
+    T11 = _ref_tmp_8;
+    call_tmp16 = string_from_c_string_copy(T11, false, INT64(0));
+    _ref_tmp_8 = T11;
+    chpl_string_widen(&T12, call_tmp16, _ln, _fn);
+    _ch_ioerror(this6, e, T12, _ln, _fn);
+    _ref_tmp_9 = &ret2;
+    *(_ref_tmp_9) = false;
+    goto _end_write;
+  }
+  _end_write:;
+  _ref_tmp_10 = &ret;
+  *(_ref_tmp_10) = ret2;
+  return ret;
+}
+
+/* IO.chpl:2031 */
+static void writeln2(chpl____wide_chpl_string _e0_args, int64_t _e1_args, int64_t _ln, c_string _fn) {
+  chpl____wide_heap_channel_T_dynamic_T local_stdout = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_channel_T_dynamic_T _ref_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_channel_T_dynamic_T chpl_macro_tmp_993;
+  local_stdout = stdout2;
+  chpl_check_nil((&local_stdout)->addr, INT64(2032), "/root/repo/modules/standard/IO.chpl");
+  chpl_macro_tmp_993.locale = (&local_stdout)->locale;
+  chpl_macro_tmp_993.addr = &(((&local_stdout)->addr)->value);
+  _ref_tmp_ = chpl_macro_tmp_993;
+  writeln(&_ref_tmp_, _e0_args, _e1_args, _ln, _fn);
+  return;
+}
+
@@ -0,0 +1,1200 @@
+/* List.chpl:1 */
+static void chpl__init_List(int64_t _ln, c_string _fn) {
+  c_string modFormatStr;
+  c_string modStr;
+  _ref_int32_t refIndentLevel = NULL;
+  if (chpl__init_List_p) {
+    goto _exit_chpl__init_List;
+  }
+  modFormatStr = "%*s\n";
+  modStr = "List";
+  printModuleInit(modFormatStr, modStr, INT64(4), _ln, _fn);
+  refIndentLevel = &moduleInitLevel;
+  *(refIndentLevel) += INT64(1);
+  chpl__init_List_p = true;
+  *(refIndentLevel) -= INT64(1);
+  _exit_chpl__init_List:;
+  return;
+}
+
+/* List.chpl:20 */
+static listNode_BaseArr _construct_listNode(chpl____wide_BaseArr* const data, listNode_BaseArr next, listNode_BaseArr meme, int64_t _ln, c_string _fn) {
+  listNode_BaseArr this6 = NULL;
+  object T = NULL;
+  chpl____wide_listNode_BaseArr T2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_listNode_BaseArr chpl_macro_tmp_759;
+  this6 = meme;
+  chpl_check_nil(this6, INT64(20), "/root/repo/modules/standard/List.chpl");
+  T = &((this6)->super);
+  _construct_object(T);
+  chpl_check_nil(this6, INT64(22), "/root/repo/modules/standard/List.chpl");
+  (this6)->data = *(data);
+  chpl_macro_tmp_759.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_759.addr = next;
+  T2 = chpl_macro_tmp_759;
+  chpl_check_nil(this6, INT64(23), "/root/repo/modules/standard/List.chpl");
+  (this6)->next = T2;
+  return this6;
+}
+
+/* List.chpl:20 */
+static void chpl__auto_destroy_listNode(listNode_BaseArr this6, int64_t _ln, c_string _fn) {
+  return;
+}
+
+/* List.chpl:20 */
+static void chpl__auto_destroy_listNode2(listNode_BaseDom this6, int64_t _ln, c_string _fn) {
+  return;
+}
+
+/* List.chpl:26 */
+static list_BaseArr _construct_list(listNode_BaseArr first, listNode_BaseArr last, int64_t length2, list_BaseArr* const meme, int64_t _ln, c_string _fn) {
+  list_BaseArr this6;
+  chpl____wide_listNode_BaseArr T = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_listNode_BaseArr T2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_listNode_BaseArr chpl_macro_tmp_760;
+  chpl____wide_listNode_BaseArr chpl_macro_tmp_761;
+  this6 = *(meme);
+  chpl_macro_tmp_760.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_760.addr = first;
+  T = chpl_macro_tmp_760;
+  (&this6)->first = T;
+  chpl_macro_tmp_761.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_761.addr = last;
+  T2 = chpl_macro_tmp_761;
+  (&this6)->last = T2;
+  (&this6)->length = length2;
+  return this6;
+}
+
+/* List.chpl:26 */
+static list_BaseDom _construct_list2(listNode_BaseDom first, listNode_BaseDom last, int64_t length2, list_BaseDom* const meme, int64_t _ln, c_string _fn) {
+  list_BaseDom this6;
+  chpl____wide_listNode_BaseDom T = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_listNode_BaseDom T2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_listNode_BaseDom chpl_macro_tmp_762;
+  chpl____wide_listNode_BaseDom chpl_macro_tmp_763;
+  this6 = *(meme);
+  chpl_macro_tmp_762.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_762.addr = first;
+  T = chpl_macro_tmp_762;
+  (&this6)->first = T;
+  chpl_macro_tmp_763.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_763.addr = last;
+  T2 = chpl_macro_tmp_763;
+  (&this6)->last = T2;
+  (&this6)->length = length2;
+  return this6;
+}
+
+/* List.chpl:41 */
+static void _local_remove(_ref_list_BaseDom this6, chpl____wide_BaseDom* const x2, int64_t _ln, c_string _fn) {
+  chpl____wide_listNode_BaseDom tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_listNode_BaseDom ret = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_list_BaseDom local_this = NULL;
+  chpl____wide_listNode_BaseDom prev = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseDom type_tmp = NULL;
+  chpl_bool T;
+  chpl____wide_object call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp2;
+  chpl_bool T2;
+  chpl____wide_listNode_BaseDom T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDom ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseDom local__tmp = NULL;
+  chpl____wide_object call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp5;
+  chpl____wide_listNode_BaseDom ret3 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseDom local_tmp = NULL;
+  chpl____wide_object call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp7;
+  chpl_bool T4;
+  chpl____wide_listNode_BaseDom T5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDom ret4 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseDom local__tmp2 = NULL;
+  chpl____wide_object call_tmp8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp9 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp10;
+  chpl____wide_object call_tmp11 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp12;
+  chpl____wide_object call_tmp13 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp14;
+  _ref_listNode_BaseDom call_tmp15 = NULL;
+  listNode_BaseDom local_prev = NULL;
+  chpl____wide_listNode_BaseDom ret5 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseDom local_tmp2 = NULL;
+  _ref_listNode_BaseDom local_call_tmp = NULL;
+  chpl____wide_listNode_BaseDom ret6 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_list_BaseDom local_this2 = NULL;
+  chpl____wide_object call_tmp16 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp17 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp18;
+  _ref_listNode_BaseDom call_tmp19 = NULL;
+  _ref_list_BaseDom local_this3 = NULL;
+  chpl____wide_listNode_BaseDom ret7 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseDom local_tmp3 = NULL;
+  _ref_listNode_BaseDom local_call_tmp2 = NULL;
+  chpl____wide_listNode_BaseDom ret8 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_list_BaseDom local_this4 = NULL;
+  chpl____wide_object call_tmp20 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp21 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp22;
+  _ref_listNode_BaseDom call_tmp23 = NULL;
+  _ref_list_BaseDom local_this5 = NULL;
+  _ref_listNode_BaseDom local_call_tmp3 = NULL;
+  chpl_localeID_t call_tmp24;
+  chpl____wide_listNode_BaseDom rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn60 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  _ref_int64_t call_tmp25 = NULL;
+  _ref_list_BaseDom local_this6 = NULL;
+  chpl____wide_listNode_BaseDom chpl_macro_tmp_764;
+  chpl____wide_object chpl_macro_tmp_765;
+  chpl____wide_object chpl_macro_tmp_766;
+  chpl____wide_object chpl_macro_tmp_767;
+  chpl____wide_object chpl_macro_tmp_768;
+  chpl____wide_object chpl_macro_tmp_769;
+  chpl____wide_object chpl_macro_tmp_770;
+  chpl____wide_object chpl_macro_tmp_771;
+  chpl____wide_object chpl_macro_tmp_772;
+  chpl____wide_object chpl_macro_tmp_773;
+  chpl____wide_object chpl_macro_tmp_774;
+  chpl____wide_object chpl_macro_tmp_775;
+  chpl____wide_object chpl_macro_tmp_776;
+  local_this = this6;
+  chpl_check_nil(local_this, INT64(42), "/root/repo/modules/standard/List.chpl");
+  ret = (local_this)->first;
+  tmp = ret;
+  type_tmp = nil;
+  chpl_macro_tmp_764.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_764.addr = type_tmp;
+  prev = chpl_macro_tmp_764;
+  chpl_macro_tmp_765.locale = (&ret)->locale;
+  chpl_macro_tmp_765.addr = ((object)((&ret)->addr));
+  call_tmp = chpl_macro_tmp_765;
+  call_tmp2 = (&call_tmp)->addr != nil;
+  if (call_tmp2) {
+    T3 = ret;
+    chpl_check_local(chpl_nodeFromLocaleID(&((&T3)->locale), INT64(0), NULL), _ln, _fn, "cannot access remote data in local block");
+    local__tmp = (&T3)->addr;
+    chpl_check_nil(local__tmp, INT64(44), "/root/repo/modules/standard/List.chpl");
+    ret2 = (local__tmp)->data;
+    chpl_macro_tmp_766.locale = (&ret2)->locale;
+    chpl_macro_tmp_766.addr = ((object)((&ret2)->addr));
+    call_tmp3 = chpl_macro_tmp_766;
+    chpl_macro_tmp_767.locale = (x2)->locale;
+    chpl_macro_tmp_767.addr = ((object)((x2)->addr));
+    call_tmp4 = chpl_macro_tmp_767;
+    call_tmp5 = (((&call_tmp3)->addr != (&call_tmp4)->addr) || ((!(! (&call_tmp3)->addr)) && (chpl_nodeFromLocaleID(&((&call_tmp3)->locale), INT64(0), NULL) != chpl_nodeFromLocaleID(&((&call_tmp4)->locale), INT64(0), NULL))));
+    T2 = call_tmp5;
+  } else {
+    T2 = false;
+  }
+  T = T2;
+  while (T) {
+    prev = tmp;
+    chpl_check_local(chpl_nodeFromLocaleID(&((&tmp)->locale), INT64(0), NULL), _ln, _fn, "cannot access remote data in local block");
+    local_tmp = (&tmp)->addr;
+    chpl_check_nil(local_tmp, INT64(46), "/root/repo/modules/standard/List.chpl");
+    ret3 = (local_tmp)->next;
+    tmp = ret3;
+    chpl_macro_tmp_768.locale = (&ret3)->locale;
+    chpl_macro_tmp_768.addr = ((object)((&ret3)->addr));
+    call_tmp6 = chpl_macro_tmp_768;
+    call_tmp7 = (&call_tmp6)->addr != nil;
+    if (call_tmp7) {
+      T5 = ret3;
+      chpl_check_local(chpl_nodeFromLocaleID(&((&T5)->locale), INT64(0), NULL), _ln, _fn, "cannot access remote data in local block");
+      local__tmp2 = (&T5)->addr;
+      chpl_check_nil(local__tmp2, INT64(44), "/root/repo/modules/standard/List.chpl");
+      ret4 = (local__tmp2)->data;
+      chpl_macro_tmp_769.locale = (&ret4)->locale;
+      chpl_macro_tmp_769.addr = ((object)((&ret4)->addr));
+      call_tmp8 = chpl_macro_tmp_769;
+      chpl_macro_tmp_770.locale = (x2)->locale;
+      chpl_macro_tmp_770.addr = ((object)((x2)->addr));
+      call_tmp9 = chpl_macro_tmp_770;
+      call_tmp10 = (((&call_tmp8)->addr != (&call_tmp9)->addr) || ((!(! (&call_tmp8)->addr)) && (chpl_nodeFromLocaleID(&((&call_tmp8)->locale), INT64(0), NULL) != chpl_nodeFromLocaleID(&((&call_tmp9)->locale), INT64(0), NULL))));
+      T4 = call_tmp10;
+    } else {
+      T4 = false;
+    }
+    T = T4;
+  }
+  chpl_macro_tmp_771.locale = (&tmp)->locale;
+  chpl_macro_tmp_771.addr = ((object)((&tmp)->addr));
+  call_tmp11 = chpl_macro_tmp_771;
+  call_tmp12 = (&call_tmp11)->addr != nil;
+  if (call_tmp12) {
+    chpl_macro_tmp_772.locale = (&prev)->locale;
+    chpl_macro_tmp_772.addr = ((object)((&prev)->addr));
+    call_tmp13 = chpl_macro_tmp_772;
+    call_tmp14 = (&call_tmp13)->addr != nil;
+    if (call_tmp14) {
+      chpl_check_local(chpl_nodeFromLocaleID(&((&prev)->locale), INT64(0), NULL), _ln, _fn, "cannot access remote data in local block");
+      local_prev = (&prev)->addr;
+      chpl_check_nil(local_prev, INT64(50), "/root/repo/modules/standard/List.chpl");
+      call_tmp15 = &((local_prev)->next);
+      chpl_check_local(chpl_nodeFromLocaleID(&((&tmp)->locale), INT64(0), NULL), _ln, _fn, "cannot access remote data in local block");
+      local_tmp2 = (&tmp)->addr;
+      chpl_check_nil(local_tmp2, INT64(50), "/root/repo/modules/standard/List.chpl");
+      ret5 = (local_tmp2)->next;
+      local_call_tmp = call_tmp15;
+      *(local_call_tmp) = ret5;
+    }
+    local_this2 = this6;
+    chpl_check_nil(local_this2, INT64(51), "/root/repo/modules/standard/List.chpl");
+    ret6 = (local_this2)->first;
+    chpl_macro_tmp_773.locale = (&ret6)->locale;
+    chpl_macro_tmp_773.addr = ((object)((&ret6)->addr));
+    call_tmp16 = chpl_macro_tmp_773;
+    chpl_macro_tmp_774.locale = (&tmp)->locale;
+    chpl_macro_tmp_774.addr = ((object)((&tmp)->addr));
+    call_tmp17 = chpl_macro_tmp_774;
+    call_tmp18 = (! (((&call_tmp16)->addr != (&call_tmp17)->addr) || ((!(! (&call_tmp16)->addr)) && (chpl_nodeFromLocaleID(&((&call_tmp16)->locale), INT64(0), NULL) != chpl_nodeFromLocaleID(&((&call_tmp17)->locale), INT64(0), NULL)))));
+    if (call_tmp18) {
+      local_this3 = this6;
+      chpl_check_nil(local_this3, INT64(52), "/root/repo/modules/standard/List.chpl");
+      call_tmp19 = &((local_this3)->first);
+      chpl_check_local(chpl_nodeFromLocaleID(&((&tmp)->locale), INT64(0), NULL), _ln, _fn, "cannot access remote data in local block");
+      local_tmp3 = (&tmp)->addr;
+      chpl_check_nil(local_tmp3, INT64(52), "/root/repo/modules/standard/List.chpl");
+      ret7 = (local_tmp3)->next;
+      local_call_tmp2 = call_tmp19;
+      *(local_call_tmp2) = ret7;
+    }
+    local_this4 = this6;
+    chpl_check_nil(local_this4, INT64(53), "/root/repo/modules/standard/List.chpl");
+    ret8 = (local_this4)->last;
+    chpl_macro_tmp_775.locale = (&ret8)->locale;
+    chpl_macro_tmp_775.addr = ((object)((&ret8)->addr));
+    call_tmp20 = chpl_macro_tmp_775;
+    chpl_macro_tmp_776.locale = (&tmp)->locale;
+    chpl_macro_tmp_776.addr = ((object)((&tmp)->addr));
+    call_tmp21 = chpl_macro_tmp_776;
+    call_tmp22 = (! (((&call_tmp20)->addr != (&call_tmp21)->addr) || ((!(! (&call_tmp20)->addr)) && (chpl_nodeFromLocaleID(&((&call_tmp20)->locale), INT64(0), NULL) != chpl_nodeFromLocaleID(&((&call_tmp21)->locale), INT64(0), NULL)))));
+    if (call_tmp22) {
+      local_this5 = this6;
+      chpl_check_nil(local_this5, INT64(54), "/root/repo/modules/standard/List.chpl");
+      call_tmp23 = &((local_this5)->last);
+      local_call_tmp3 = call_tmp23;
+      *(local_call_tmp3) = prev;
+    }
+    call_tmp24 = (&tmp)->locale;
+    rvfDerefTmp = tmp;
+    _args_size = sizeof(chpl__class_localson_fn60_object);
+    _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn = ((_class_localson_fn60)(_args_alloc));
+    chpl_check_nil(_args_foron_fn, INT64(55), "/root/repo/modules/standard/List.chpl");
+    (_args_foron_fn)->_0__tmp = call_tmp24;
+    chpl_check_nil(_args_foron_fn, INT64(55), "/root/repo/modules/standard/List.chpl");
+    (_args_foron_fn)->_1_rvfDerefTmp = rvfDerefTmp;
+    (_args_foron_fn)->_ln2 = _ln;
+    (_args_foron_fn)->_fn2 = _fn;
+    /*** _local_wrapon_fn5 ***/ chpl_executeOn(&call_tmp24, INT32(63), _args_foron_fn, sizeof(chpl__class_localson_fn60_object), INT64(55), "/root/repo/modules/standard/List.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+    local_this6 = this6;
+    chpl_check_nil(local_this6, INT64(56), "/root/repo/modules/standard/List.chpl");
+    call_tmp25 = &((local_this6)->length);
+    *(call_tmp25) -= INT64(1);
+  }
+  return;
+}
+
+/* List.chpl:41 */
+static void remove2(chpl____wide__ref_list_BaseDom* const this6, chpl____wide_BaseDom* const x2, int64_t _ln, c_string _fn) {
+  chpl____wide_listNode_BaseDom tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_listNode_BaseDom ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_listNode_BaseDom prev = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseDom type_tmp = NULL;
+  chpl_bool T;
+  chpl____wide_object call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp2;
+  chpl_bool T2;
+  chpl____wide_listNode_BaseDom T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDom ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp5;
+  chpl____wide_listNode_BaseDom ret3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp7;
+  chpl_bool T4;
+  chpl____wide_listNode_BaseDom T5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseDom ret4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp9 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp10;
+  chpl____wide_object call_tmp11 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp12;
+  chpl____wide_object call_tmp13 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp14;
+  chpl____wide__ref_listNode_BaseDom call_tmp15 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_listNode_BaseDom ret5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_listNode_BaseDom ret6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp16 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp17 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp18;
+  chpl____wide__ref_listNode_BaseDom call_tmp19 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_listNode_BaseDom ret7 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_listNode_BaseDom ret8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp20 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp21 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp22;
+  chpl____wide__ref_listNode_BaseDom call_tmp23 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp24;
+  chpl____wide_listNode_BaseDom rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn60 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_int64_t call_tmp25 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_listNode_BaseDom chpl_macro_tmp_777;
+  chpl____wide_listNode_BaseDom chpl_macro_tmp_778;
+  chpl____wide_object chpl_macro_tmp_779;
+  chpl____wide__ref_BaseDom chpl_macro_tmp_780;
+  chpl____wide_object chpl_macro_tmp_781;
+  chpl____wide_object chpl_macro_tmp_782;
+  chpl____wide__ref_listNode_BaseDom chpl_macro_tmp_783;
+  chpl____wide_object chpl_macro_tmp_784;
+  chpl____wide__ref_BaseDom chpl_macro_tmp_785;
+  chpl____wide_object chpl_macro_tmp_786;
+  chpl____wide_object chpl_macro_tmp_787;
+  chpl____wide_object chpl_macro_tmp_788;
+  chpl____wide_object chpl_macro_tmp_789;
+  chpl____wide__ref_listNode_BaseDom chpl_macro_tmp_790;
+  chpl____wide__ref_listNode_BaseDom chpl_macro_tmp_791;
+  chpl____wide__ref_listNode_BaseDom chpl_macro_tmp_792;
+  chpl____wide_object chpl_macro_tmp_793;
+  chpl____wide_object chpl_macro_tmp_794;
+  chpl____wide__ref_listNode_BaseDom chpl_macro_tmp_795;
+  chpl____wide__ref_listNode_BaseDom chpl_macro_tmp_796;
+  chpl____wide__ref_listNode_BaseDom chpl_macro_tmp_797;
+  chpl____wide_object chpl_macro_tmp_798;
+  chpl____wide_object chpl_macro_tmp_799;
+  chpl____wide__ref_listNode_BaseDom chpl_macro_tmp_800;
+  chpl____wide__ref_int64_t chpl_macro_tmp_801;
+  int64_t chpl_macro_tmp_802;
+  chpl_macro_tmp_777.locale = (*(this6)).locale;
+  chpl_macro_tmp_777.addr = &(((*(this6)).addr)->first);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_777).locale), INT64(0), NULL), (chpl_macro_tmp_777).addr, sizeof(chpl____wide_listNode_BaseDom), -1, INT64(1), INT64(42), "/root/repo/modules/standard/List.chpl");
+  tmp = ret;
+  type_tmp = nil;
+  chpl_macro_tmp_778.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_778.addr = type_tmp;
+  prev = chpl_macro_tmp_778;
+  chpl_macro_tmp_779.locale = (&ret)->locale;
+  chpl_macro_tmp_779.addr = ((object)((&ret)->addr));
+  call_tmp = chpl_macro_tmp_779;
+  call_tmp2 = (&call_tmp)->addr != nil;
+  if (call_tmp2) {
+    T3 = ret;
+    chpl_check_nil((&T3)->addr, INT64(44), "/root/repo/modules/standard/List.chpl");
+    chpl_macro_tmp_780.locale = (&T3)->locale;
+    chpl_macro_tmp_780.addr = &(((&T3)->addr)->data);
+    chpl_gen_comm_get(((void*)(&ret2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_780).locale), INT64(0), NULL), (chpl_macro_tmp_780).addr, sizeof(chpl____wide_BaseDom), -1, INT64(1), INT64(44), "/root/repo/modules/standard/List.chpl");
+    chpl_macro_tmp_781.locale = (&ret2)->locale;
+    chpl_macro_tmp_781.addr = ((object)((&ret2)->addr));
+    call_tmp3 = chpl_macro_tmp_781;
+    chpl_macro_tmp_782.locale = (x2)->locale;
+    chpl_macro_tmp_782.addr = ((object)((x2)->addr));
+    call_tmp4 = chpl_macro_tmp_782;
+    call_tmp5 = (((&call_tmp3)->addr != (&call_tmp4)->addr) || ((!(! (&call_tmp3)->addr)) && (chpl_nodeFromLocaleID(&((&call_tmp3)->locale), INT64(0), NULL) != chpl_nodeFromLocaleID(&((&call_tmp4)->locale), INT64(0), NULL))));
+    T2 = call_tmp5;
+  } else {
+    T2 = false;
+  }
+  T = T2;
+  while (T) {
+    prev = tmp;
+    chpl_check_nil((&tmp)->addr, INT64(46), "/root/repo/modules/standard/List.chpl");
+    chpl_macro_tmp_783.locale = (&tmp)->locale;
+    chpl_macro_tmp_783.addr = &(((&tmp)->addr)->next);
+    chpl_gen_comm_get(((void*)(&ret3)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_783).locale), INT64(0), NULL), (chpl_macro_tmp_783).addr, sizeof(chpl____wide_listNode_BaseDom), -1, INT64(1), INT64(46), "/root/repo/modules/standard/List.chpl");
+    tmp = ret3;
+    chpl_macro_tmp_784.locale = (&ret3)->locale;
+    chpl_macro_tmp_784.addr = ((object)((&ret3)->addr));
+    call_tmp6 = chpl_macro_tmp_784;
+    call_tmp7 = (&call_tmp6)->addr != nil;
+    if (call_tmp7) {
+      T5 = ret3;
+      chpl_check_nil((&T5)->addr, INT64(44), "/root/repo/modules/standard/List.chpl");
+      chpl_macro_tmp_785.locale = (&T5)->locale;
+      chpl_macro_tmp_785.addr = &(((&T5)->addr)->data);
+      chpl_gen_comm_get(((void*)(&ret4)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_785).locale), INT64(0), NULL), (chpl_macro_tmp_785).addr, sizeof(chpl____wide_BaseDom), -1, INT64(1), INT64(44), "/root/repo/modules/standard/List.chpl");
+      chpl_macro_tmp_786.locale = (&ret4)->locale;
+      chpl_macro_tmp_786.addr = ((object)((&ret4)->addr));
+      call_tmp8 = chpl_macro_tmp_786;
+      chpl_macro_tmp_787.locale = (x2)->locale;
+      chpl_macro_tmp_787.addr = ((object)((x2)->addr));
+      call_tmp9 = chpl_macro_tmp_787;
+      call_tmp10 = (((&call_tmp8)->addr != (&call_tmp9)->addr) || ((!(! (&call_tmp8)->addr)) && (chpl_nodeFromLocaleID(&((&call_tmp8)->locale), INT64(0), NULL) != chpl_nodeFromLocaleID(&((&call_tmp9)->locale), INT64(0), NULL))));
+      T4 = call_tmp10;
+    } else {
+      T4 = false;
+    }
+    T = T4;
+  }
+  chpl_macro_tmp_788.locale = (&tmp)->locale;
+  chpl_macro_tmp_788.addr = ((object)((&tmp)->addr));
+  call_tmp11 = chpl_macro_tmp_788;
+  call_tmp12 = (&call_tmp11)->addr != nil;
+  if (call_tmp12) {
+    chpl_macro_tmp_789.locale = (&prev)->locale;
+    chpl_macro_tmp_789.addr = ((object)((&prev)->addr));
+    call_tmp13 = chpl_macro_tmp_789;
+    call_tmp14 = (&call_tmp13)->addr != nil;
+    if (call_tmp14) {
+      chpl_check_nil((&prev)->addr, INT64(50), "/root/repo/modules/standard/List.chpl");
+      chpl_macro_tmp_790.locale = (&prev)->locale;
+      chpl_macro_tmp_790.addr = &(((&prev)->addr)->next);
+      call_tmp15 = chpl_macro_tmp_790;
+      chpl_check_nil((&tmp)->addr, INT64(50), "/root/repo/modules/standard/List.chpl");
+      chpl_macro_tmp_791.locale = (&tmp)->locale;
+      chpl_macro_tmp_791.addr = &(((&tmp)->addr)->next);
+      chpl_gen_comm_get(((void*)(&ret5)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_791).locale), INT64(0), NULL), (chpl_macro_tmp_791).addr, sizeof(chpl____wide_listNode_BaseDom), -1, INT64(1), INT64(50), "/root/repo/modules/standard/List.chpl");
+      chpl_gen_comm_put(((void*)(&ret5)), chpl_nodeFromLocaleID(&((call_tmp15).locale), INT64(0), NULL), (call_tmp15).addr, sizeof(chpl____wide_listNode_BaseDom), -1, INT64(1), INT64(50), "/root/repo/modules/standard/List.chpl");
+    }
+    chpl_macro_tmp_792.locale = (*(this6)).locale;
+    chpl_macro_tmp_792.addr = &(((*(this6)).addr)->first);
+    chpl_gen_comm_get(((void*)(&ret6)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_792).locale), INT64(0), NULL), (chpl_macro_tmp_792).addr, sizeof(chpl____wide_listNode_BaseDom), -1, INT64(1), INT64(51), "/root/repo/modules/standard/List.chpl");
+    chpl_macro_tmp_793.locale = (&ret6)->locale;
+    chpl_macro_tmp_793.addr = ((object)((&ret6)->addr));
+    call_tmp16 = chpl_macro_tmp_793;
+    chpl_macro_tmp_794.locale = (&tmp)->locale;
+    chpl_macro_tmp_794.addr = ((object)((&tmp)->addr));
+    call_tmp17 = chpl_macro_tmp_794;
+    call_tmp18 = (! (((&call_tmp16)->addr != (&call_tmp17)->addr) || ((!(! (&call_tmp16)->addr)) && (chpl_nodeFromLocaleID(&((&call_tmp16)->locale), INT64(0), NULL) != chpl_nodeFromLocaleID(&((&call_tmp17)->locale), INT64(0), NULL)))));
+    if (call_tmp18) {
+      chpl_macro_tmp_795.locale = (*(this6)).locale;
+      chpl_macro_tmp_795.addr = &(((*(this6)).addr)->first);
+      call_tmp19 = chpl_macro_tmp_795;
+      chpl_check_nil((&tmp)->addr, INT64(52), "/root/repo/modules/standard/List.chpl");
+      chpl_macro_tmp_796.locale = (&tmp)->locale;
+      chpl_macro_tmp_796.addr = &(((&tmp)->addr)->next);
+      chpl_gen_comm_get(((void*)(&ret7)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_796).locale), INT64(0), NULL), (chpl_macro_tmp_796).addr, sizeof(chpl____wide_listNode_BaseDom), -1, INT64(1), INT64(52), "/root/repo/modules/standard/List.chpl");
+      chpl_gen_comm_put(((void*)(&ret7)), chpl_nodeFromLocaleID(&((call_tmp19).locale), INT64(0), NULL), (call_tmp19).addr, sizeof(chpl____wide_listNode_BaseDom), -1, INT64(1), INT64(52), "/root/repo/modules/standard/List.chpl");
+    }
+    chpl_macro_tmp_797.locale = (*(this6)).locale;
+    chpl_macro_tmp_797.addr = &(((*(this6)).addr)->last);
+    chpl_gen_comm_get(((void*)(&ret8)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_797).locale), INT64(0), NULL), (chpl_macro_tmp_797).addr, sizeof(chpl____wide_listNode_BaseDom), -1, INT64(1), INT64(53), "/root/repo/modules/standard/List.chpl");
+    chpl_macro_tmp_798.locale = (&ret8)->locale;
+    chpl_macro_tmp_798.addr = ((object)((&ret8)->addr));
+    call_tmp20 = chpl_macro_tmp_798;
+    chpl_macro_tmp_799.locale = (&tmp)->locale;
+    chpl_macro_tmp_799.addr = ((object)((&tmp)->addr));
+    call_tmp21 = chpl_macro_tmp_799;
+    call_tmp22 = (! (((&call_tmp20)->addr != (&call_tmp21)->addr) || ((!(! (&call_tmp20)->addr)) && (chpl_nodeFromLocaleID(&((&call_tmp20)->locale), INT64(0), NULL) != chpl_nodeFromLocaleID(&((&call_tmp21)->locale), INT64(0), NULL)))));
+    if (call_tmp22) {
+      chpl_macro_tmp_800.locale = (*(this6)).locale;
+      chpl_macro_tmp_800.addr = &(((*(this6)).addr)->last);
+      call_tmp23 = chpl_macro_tmp_800;
+      chpl_gen_comm_put(((void*)(&prev)), chpl_nodeFromLocaleID(&((call_tmp23).locale), INT64(0), NULL), (call_tmp23).addr, sizeof(chpl____wide_listNode_BaseDom), -1, INT64(1), INT64(54), "/root/repo/modules/standard/List.chpl");
+    }
+    call_tmp24 = (&tmp)->locale;
+    rvfDerefTmp = tmp;
+    _args_size = sizeof(chpl__class_localson_fn60_object);
+    _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn = ((_class_localson_fn60)(_args_alloc));
+    chpl_check_nil(_args_foron_fn, INT64(55), "/root/repo/modules/standard/List.chpl");
+    (_args_foron_fn)->_0__tmp = call_tmp24;
+    chpl_check_nil(_args_foron_fn, INT64(55), "/root/repo/modules/standard/List.chpl");
+    (_args_foron_fn)->_1_rvfDerefTmp = rvfDerefTmp;
+    (_args_foron_fn)->_ln = _ln;
+    (_args_foron_fn)->_fn = _fn;
+    /*** wrapon_fn60 ***/ chpl_executeOn(&call_tmp24, INT32(65), _args_foron_fn, sizeof(chpl__class_localson_fn60_object), INT64(55), "/root/repo/modules/standard/List.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+    chpl_macro_tmp_801.locale = (*(this6)).locale;
+    chpl_macro_tmp_801.addr = &(((*(this6)).addr)->length);
+    call_tmp25 = chpl_macro_tmp_801;
+    chpl_gen_comm_get(((void*)(&chpl_macro_tmp_802)), chpl_nodeFromLocaleID(&((call_tmp25).locale), INT64(0), NULL), (call_tmp25).addr, sizeof(int64_t), -1, INT64(1), INT64(56), "/root/repo/modules/standard/List.chpl");
+    chpl_macro_tmp_802 -= INT64(1);
+    chpl_gen_comm_put(((void*)(&chpl_macro_tmp_802)), chpl_nodeFromLocaleID(&((call_tmp25).locale), INT64(0), NULL), (call_tmp25).addr, sizeof(int64_t), -1, INT64(1), INT64(56), "/root/repo/modules/standard/List.chpl");
+  }
+  return;
+}
+
+/* List.chpl:41 */
+static void _local_remove2(_ref_list_BaseArr this6, chpl____wide_BaseArr* const x2, int64_t _ln, c_string _fn) {
+  chpl____wide_listNode_BaseArr tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_listNode_BaseArr ret = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_list_BaseArr local_this = NULL;
+  chpl____wide_listNode_BaseArr prev = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseArr type_tmp = NULL;
+  chpl_bool T;
+  chpl____wide_object call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp2;
+  chpl_bool T2;
+  chpl____wide_listNode_BaseArr T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseArr ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseArr local__tmp = NULL;
+  chpl____wide_object call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp5;
+  chpl____wide_listNode_BaseArr ret3 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseArr local_tmp = NULL;
+  chpl____wide_object call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp7;
+  chpl_bool T4;
+  chpl____wide_listNode_BaseArr T5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseArr ret4 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseArr local__tmp2 = NULL;
+  chpl____wide_object call_tmp8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp9 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp10;
+  chpl____wide_object call_tmp11 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp12;
+  chpl____wide_object call_tmp13 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp14;
+  _ref_listNode_BaseArr call_tmp15 = NULL;
+  listNode_BaseArr local_prev = NULL;
+  chpl____wide_listNode_BaseArr ret5 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseArr local_tmp2 = NULL;
+  _ref_listNode_BaseArr local_call_tmp = NULL;
+  chpl____wide_listNode_BaseArr ret6 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_list_BaseArr local_this2 = NULL;
+  chpl____wide_object call_tmp16 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp17 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp18;
+  _ref_listNode_BaseArr call_tmp19 = NULL;
+  _ref_list_BaseArr local_this3 = NULL;
+  chpl____wide_listNode_BaseArr ret7 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseArr local_tmp3 = NULL;
+  _ref_listNode_BaseArr local_call_tmp2 = NULL;
+  chpl____wide_listNode_BaseArr ret8 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_list_BaseArr local_this4 = NULL;
+  chpl____wide_object call_tmp20 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp21 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp22;
+  _ref_listNode_BaseArr call_tmp23 = NULL;
+  _ref_list_BaseArr local_this5 = NULL;
+  _ref_listNode_BaseArr local_call_tmp3 = NULL;
+  chpl_localeID_t call_tmp24;
+  chpl____wide_listNode_BaseArr rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn61 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  _ref_int64_t call_tmp25 = NULL;
+  _ref_list_BaseArr local_this6 = NULL;
+  chpl____wide_listNode_BaseArr chpl_macro_tmp_803;
+  chpl____wide_object chpl_macro_tmp_804;
+  chpl____wide_object chpl_macro_tmp_805;
+  chpl____wide_object chpl_macro_tmp_806;
+  chpl____wide_object chpl_macro_tmp_807;
+  chpl____wide_object chpl_macro_tmp_808;
+  chpl____wide_object chpl_macro_tmp_809;
+  chpl____wide_object chpl_macro_tmp_810;
+  chpl____wide_object chpl_macro_tmp_811;
+  chpl____wide_object chpl_macro_tmp_812;
+  chpl____wide_object chpl_macro_tmp_813;
+  chpl____wide_object chpl_macro_tmp_814;
+  chpl____wide_object chpl_macro_tmp_815;
+  local_this = this6;
+  chpl_check_nil(local_this, INT64(42), "/root/repo/modules/standard/List.chpl");
+  ret = (local_this)->first;
+  tmp = ret;
+  type_tmp = nil;
+  chpl_macro_tmp_803.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_803.addr = type_tmp;
+  prev = chpl_macro_tmp_803;
+  chpl_macro_tmp_804.locale = (&ret)->locale;
+  chpl_macro_tmp_804.addr = ((object)((&ret)->addr));
+  call_tmp = chpl_macro_tmp_804;
+  call_tmp2 = (&call_tmp)->addr != nil;
+  if (call_tmp2) {
+    T3 = ret;
+    chpl_check_local(chpl_nodeFromLocaleID(&((&T3)->locale), INT64(0), NULL), _ln, _fn, "cannot access remote data in local block");
+    local__tmp = (&T3)->addr;
+    chpl_check_nil(local__tmp, INT64(44), "/root/repo/modules/standard/List.chpl");
+    ret2 = (local__tmp)->data;
+    chpl_macro_tmp_805.locale = (&ret2)->locale;
+    chpl_macro_tmp_805.addr = ((object)((&ret2)->addr));
+    call_tmp3 = chpl_macro_tmp_805;
+    chpl_macro_tmp_806.locale = (x2)->locale;
+    chpl_macro_tmp_806.addr = ((object)((x2)->addr));
+    call_tmp4 = chpl_macro_tmp_806;
+    call_tmp5 = (((&call_tmp3)->addr != (&call_tmp4)->addr) || ((!(! (&call_tmp3)->addr)) && (chpl_nodeFromLocaleID(&((&call_tmp3)->locale), INT64(0), NULL) != chpl_nodeFromLocaleID(&((&call_tmp4)->locale), INT64(0), NULL))));
+    T2 = call_tmp5;
+  } else {
+    T2 = false;
+  }
+  T = T2;
+  while (T) {
+    prev = tmp;
+    chpl_check_local(chpl_nodeFromLocaleID(&((&tmp)->locale), INT64(0), NULL), _ln, _fn, "cannot access remote data in local block");
+    local_tmp = (&tmp)->addr;
+    chpl_check_nil(local_tmp, INT64(46), "/root/repo/modules/standard/List.chpl");
+    ret3 = (local_tmp)->next;
+    tmp = ret3;
+    chpl_macro_tmp_807.locale = (&ret3)->locale;
+    chpl_macro_tmp_807.addr = ((object)((&ret3)->addr));
+    call_tmp6 = chpl_macro_tmp_807;
+    call_tmp7 = (&call_tmp6)->addr != nil;
+    if (call_tmp7) {
+      T5 = ret3;
+      chpl_check_local(chpl_nodeFromLocaleID(&((&T5)->locale), INT64(0), NULL), _ln, _fn, "cannot access remote data in local block");
+      local__tmp2 = (&T5)->addr;
+      chpl_check_nil(local__tmp2, INT64(44), "/root/repo/modules/standard/List.chpl");
+      ret4 = (local__tmp2)->data;
+      chpl_macro_tmp_808.locale = (&ret4)->locale;
+      chpl_macro_tmp_808.addr = ((object)((&ret4)->addr));
+      call_tmp8 = chpl_macro_tmp_808;
+      chpl_macro_tmp_809.locale = (x2)->locale;
+      chpl_macro_tmp_809.addr = ((object)((x2)->addr));
+      call_tmp9 = chpl_macro_tmp_809;
+      call_tmp10 = (((&call_tmp8)->addr != (&call_tmp9)->addr) || ((!(! (&call_tmp8)->addr)) && (chpl_nodeFromLocaleID(&((&call_tmp8)->locale), INT64(0), NULL) != chpl_nodeFromLocaleID(&((&call_tmp9)->locale), INT64(0), NULL))));
+      T4 = call_tmp10;
+    } else {
+      T4 = false;
+    }
+    T = T4;
+  }
+  chpl_macro_tmp_810.locale = (&tmp)->locale;
+  chpl_macro_tmp_810.addr = ((object)((&tmp)->addr));
+  call_tmp11 = chpl_macro_tmp_810;
+  call_tmp12 = (&call_tmp11)->addr != nil;
+  if (call_tmp12) {
+    chpl_macro_tmp_811.locale = (&prev)->locale;
+    chpl_macro_tmp_811.addr = ((object)((&prev)->addr));
+    call_tmp13 = chpl_macro_tmp_811;
+    call_tmp14 = (&call_tmp13)->addr != nil;
+    if (call_tmp14) {
+      chpl_check_local(chpl_nodeFromLocaleID(&((&prev)->locale), INT64(0), NULL), _ln, _fn, "cannot access remote data in local block");
+      local_prev = (&prev)->addr;
+      chpl_check_nil(local_prev, INT64(50), "/root/repo/modules/standard/List.chpl");
+      call_tmp15 = &((local_prev)->next);
+      chpl_check_local(chpl_nodeFromLocaleID(&((&tmp)->locale), INT64(0), NULL), _ln, _fn, "cannot access remote data in local block");
+      local_tmp2 = (&tmp)->addr;
+      chpl_check_nil(local_tmp2, INT64(50), "/root/repo/modules/standard/List.chpl");
+      ret5 = (local_tmp2)->next;
+      local_call_tmp = call_tmp15;
+      *(local_call_tmp) = ret5;
+    }
+    local_this2 = this6;
+    chpl_check_nil(local_this2, INT64(51), "/root/repo/modules/standard/List.chpl");
+    ret6 = (local_this2)->first;
+    chpl_macro_tmp_812.locale = (&ret6)->locale;
+    chpl_macro_tmp_812.addr = ((object)((&ret6)->addr));
+    call_tmp16 = chpl_macro_tmp_812;
+    chpl_macro_tmp_813.locale = (&tmp)->locale;
+    chpl_macro_tmp_813.addr = ((object)((&tmp)->addr));
+    call_tmp17 = chpl_macro_tmp_813;
+    call_tmp18 = (! (((&call_tmp16)->addr != (&call_tmp17)->addr) || ((!(! (&call_tmp16)->addr)) && (chpl_nodeFromLocaleID(&((&call_tmp16)->locale), INT64(0), NULL) != chpl_nodeFromLocaleID(&((&call_tmp17)->locale), INT64(0), NULL)))));
+    if (call_tmp18) {
+      local_this3 = this6;
+      chpl_check_nil(local_this3, INT64(52), "/root/repo/modules/standard/List.chpl");
+      call_tmp19 = &((local_this3)->first);
+      chpl_check_local(chpl_nodeFromLocaleID(&((&tmp)->locale), INT64(0), NULL), _ln, _fn, "cannot access remote data in local block");
+      local_tmp3 = (&tmp)->addr;
+      chpl_check_nil(local_tmp3, INT64(52), "/root/repo/modules/standard/List.chpl");
+      ret7 = (local_tmp3)->next;
+      local_call_tmp2 = call_tmp19;
+      *(local_call_tmp2) = ret7;
+    }
+    local_this4 = this6;
+    chpl_check_nil(local_this4, INT64(53), "/root/repo/modules/standard/List.chpl");
+    ret8 = (local_this4)->last;
+    chpl_macro_tmp_814.locale = (&ret8)->locale;
+    chpl_macro_tmp_814.addr = ((object)((&ret8)->addr));
+    call_tmp20 = chpl_macro_tmp_814;
+    chpl_macro_tmp_815.locale = (&tmp)->locale;
+    chpl_macro_tmp_815.addr = ((object)((&tmp)->addr));
+    call_tmp21 = chpl_macro_tmp_815;
+    call_tmp22 = (! (((&call_tmp20)->addr != (&call_tmp21)->addr) || ((!(! (&call_tmp20)->addr)) && (chpl_nodeFromLocaleID(&((&call_tmp20)->locale), INT64(0), NULL) != chpl_nodeFromLocaleID(&((&call_tmp21)->locale), INT64(0), NULL)))));
+    if (call_tmp22) {
+      local_this5 = this6;
+      chpl_check_nil(local_this5, INT64(54), "/root/repo/modules/standard/List.chpl");
+      call_tmp23 = &((local_this5)->last);
+      local_call_tmp3 = call_tmp23;
+      *(local_call_tmp3) = prev;
+    }
+    call_tmp24 = (&tmp)->locale;
+    rvfDerefTmp = tmp;
+    _args_size = sizeof(chpl__class_localson_fn61_object);
+    _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn = ((_class_localson_fn61)(_args_alloc));
+    chpl_check_nil(_args_foron_fn, INT64(55), "/root/repo/modules/standard/List.chpl");
+    (_args_foron_fn)->_0__tmp = call_tmp24;
+    chpl_check_nil(_args_foron_fn, INT64(55), "/root/repo/modules/standard/List.chpl");
+    (_args_foron_fn)->_1_rvfDerefTmp = rvfDerefTmp;
+    (_args_foron_fn)->_ln2 = _ln;
+    (_args_foron_fn)->_fn2 = _fn;
+    /*** _local_wrapon_fn6 ***/ chpl_executeOn(&call_tmp24, INT32(64), _args_foron_fn, sizeof(chpl__class_localson_fn61_object), INT64(55), "/root/repo/modules/standard/List.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+    local_this6 = this6;
+    chpl_check_nil(local_this6, INT64(56), "/root/repo/modules/standard/List.chpl");
+    call_tmp25 = &((local_this6)->length);
+    *(call_tmp25) -= INT64(1);
+  }
+  return;
+}
+
+/* List.chpl:41 */
+static void remove3(chpl____wide__ref_list_BaseArr* const this6, chpl____wide_BaseArr* const x2, int64_t _ln, c_string _fn) {
+  chpl____wide_listNode_BaseArr tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_listNode_BaseArr ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_listNode_BaseArr prev = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseArr type_tmp = NULL;
+  chpl_bool T;
+  chpl____wide_object call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp2;
+  chpl_bool T2;
+  chpl____wide_listNode_BaseArr T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseArr ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp5;
+  chpl____wide_listNode_BaseArr ret3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp7;
+  chpl_bool T4;
+  chpl____wide_listNode_BaseArr T5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_BaseArr ret4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp9 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp10;
+  chpl____wide_object call_tmp11 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp12;
+  chpl____wide_object call_tmp13 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp14;
+  chpl____wide__ref_listNode_BaseArr call_tmp15 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_listNode_BaseArr ret5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_listNode_BaseArr ret6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp16 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp17 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp18;
+  chpl____wide__ref_listNode_BaseArr call_tmp19 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_listNode_BaseArr ret7 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_listNode_BaseArr ret8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp20 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp21 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp22;
+  chpl____wide__ref_listNode_BaseArr call_tmp23 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp24;
+  chpl____wide_listNode_BaseArr rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn61 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref_int64_t call_tmp25 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_listNode_BaseArr chpl_macro_tmp_816;
+  chpl____wide_listNode_BaseArr chpl_macro_tmp_817;
+  chpl____wide_object chpl_macro_tmp_818;
+  chpl____wide__ref_BaseArr chpl_macro_tmp_819;
+  chpl____wide_object chpl_macro_tmp_820;
+  chpl____wide_object chpl_macro_tmp_821;
+  chpl____wide__ref_listNode_BaseArr chpl_macro_tmp_822;
+  chpl____wide_object chpl_macro_tmp_823;
+  chpl____wide__ref_BaseArr chpl_macro_tmp_824;
+  chpl____wide_object chpl_macro_tmp_825;
+  chpl____wide_object chpl_macro_tmp_826;
+  chpl____wide_object chpl_macro_tmp_827;
+  chpl____wide_object chpl_macro_tmp_828;
+  chpl____wide__ref_listNode_BaseArr chpl_macro_tmp_829;
+  chpl____wide__ref_listNode_BaseArr chpl_macro_tmp_830;
+  chpl____wide__ref_listNode_BaseArr chpl_macro_tmp_831;
+  chpl____wide_object chpl_macro_tmp_832;
+  chpl____wide_object chpl_macro_tmp_833;
+  chpl____wide__ref_listNode_BaseArr chpl_macro_tmp_834;
+  chpl____wide__ref_listNode_BaseArr chpl_macro_tmp_835;
+  chpl____wide__ref_listNode_BaseArr chpl_macro_tmp_836;
+  chpl____wide_object chpl_macro_tmp_837;
+  chpl____wide_object chpl_macro_tmp_838;
+  chpl____wide__ref_listNode_BaseArr chpl_macro_tmp_839;
+  chpl____wide__ref_int64_t chpl_macro_tmp_840;
+  int64_t chpl_macro_tmp_841;
+  chpl_macro_tmp_816.locale = (*(this6)).locale;
+  chpl_macro_tmp_816.addr = &(((*(this6)).addr)->first);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_816).locale), INT64(0), NULL), (chpl_macro_tmp_816).addr, sizeof(chpl____wide_listNode_BaseArr), -1, INT64(1), INT64(42), "/root/repo/modules/standard/List.chpl");
+  tmp = ret;
+  type_tmp = nil;
+  chpl_macro_tmp_817.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_817.addr = type_tmp;
+  prev = chpl_macro_tmp_817;
+  chpl_macro_tmp_818.locale = (&ret)->locale;
+  chpl_macro_tmp_818.addr = ((object)((&ret)->addr));
+  call_tmp = chpl_macro_tmp_818;
+  call_tmp2 = (&call_tmp)->addr != nil;
+  if (call_tmp2) {
+    T3 = ret;
+    chpl_check_nil((&T3)->addr, INT64(44), "/root/repo/modules/standard/List.chpl");
+    chpl_macro_tmp_819.locale = (&T3)->locale;
+    chpl_macro_tmp_819.addr = &(((&T3)->addr)->data);
+    chpl_gen_comm_get(((void*)(&ret2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_819).locale), INT64(0), NULL), (chpl_macro_tmp_819).addr, sizeof(chpl____wide_BaseArr), -1, INT64(1), INT64(44), "/root/repo/modules/standard/List.chpl");
+    chpl_macro_tmp_820.locale = (&ret2)->locale;
+    chpl_macro_tmp_820.addr = ((object)((&ret2)->addr));
+    call_tmp3 = chpl_macro_tmp_820;
+    chpl_macro_tmp_821.locale = (x2)->locale;
+    chpl_macro_tmp_821.addr = ((object)((x2)->addr));
+    call_tmp4 = chpl_macro_tmp_821;
+    call_tmp5 = (((&call_tmp3)->addr != (&call_tmp4)->addr) || ((!(! (&call_tmp3)->addr)) && (chpl_nodeFromLocaleID(&((&call_tmp3)->locale), INT64(0), NULL) != chpl_nodeFromLocaleID(&((&call_tmp4)->locale), INT64(0), NULL))));
+    T2 = call_tmp5;
+  } else {
+    T2 = false;
+  }
+  T = T2;
+  while (T) {
+    prev = tmp;
+    chpl_check_nil((&tmp)->addr, INT64(46), "/root/repo/modules/standard/List.chpl");
+    chpl_macro_tmp_822.locale = (&tmp)->locale;
+    chpl_macro_tmp_822.addr = &(((&tmp)->addr)->next);
+    chpl_gen_comm_get(((void*)(&ret3)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_822).locale), INT64(0), NULL), (chpl_macro_tmp_822).addr, sizeof(chpl____wide_listNode_BaseArr), -1, INT64(1), INT64(46), "/root/repo/modules/standard/List.chpl");
+    tmp = ret3;
+    chpl_macro_tmp_823.locale = (&ret3)->locale;
+    chpl_macro_tmp_823.addr = ((object)((&ret3)->addr));
+    call_tmp6 = chpl_macro_tmp_823;
+    call_tmp7 = (&call_tmp6)->addr != nil;
+    if (call_tmp7) {
+      T5 = ret3;
+      chpl_check_nil((&T5)->addr, INT64(44), "/root/repo/modules/standard/List.chpl");
+      chpl_macro_tmp_824.locale = (&T5)->locale;
+      chpl_macro_tmp_824.addr = &(((&T5)->addr)->data);
+      chpl_gen_comm_get(((void*)(&ret4)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_824).locale), INT64(0), NULL), (chpl_macro_tmp_824).addr, sizeof(chpl____wide_BaseArr), -1, INT64(1), INT64(44), "/root/repo/modules/standard/List.chpl");
+      chpl_macro_tmp_825.locale = (&ret4)->locale;
+      chpl_macro_tmp_825.addr = ((object)((&ret4)->addr));
+      call_tmp8 = chpl_macro_tmp_825;
+      chpl_macro_tmp_826.locale = (x2)->locale;
+      chpl_macro_tmp_826.addr = ((object)((x2)->addr));
+      call_tmp9 = chpl_macro_tmp_826;
+      call_tmp10 = (((&call_tmp8)->addr != (&call_tmp9)->addr) || ((!(! (&call_tmp8)->addr)) && (chpl_nodeFromLocaleID(&((&call_tmp8)->locale), INT64(0), NULL) != chpl_nodeFromLocaleID(&((&call_tmp9)->locale), INT64(0), NULL))));
+      T4 = call_tmp10;
+    } else {
+      T4 = false;
+    }
+    T = T4;
+  }
+  chpl_macro_tmp_827.locale = (&tmp)->locale;
+  chpl_macro_tmp_827.addr = ((object)((&tmp)->addr));
+  call_tmp11 = chpl_macro_tmp_827;
+  call_tmp12 = (&call_tmp11)->addr != nil;
+  if (call_tmp12) {
+    chpl_macro_tmp_828.locale = (&prev)->locale;
+    chpl_macro_tmp_828.addr = ((object)((&prev)->addr));
+    call_tmp13 = chpl_macro_tmp_828;
+    call_tmp14 = (&call_tmp13)->addr != nil;
+    if (call_tmp14) {
+      chpl_check_nil((&prev)->addr, INT64(50), "/root/repo/modules/standard/List.chpl");
+      chpl_macro_tmp_829.locale = (&prev)->locale;
+      chpl_macro_tmp_829.addr = &(((&prev)->addr)->next);
+      call_tmp15 = chpl_macro_tmp_829;
+      chpl_check_nil((&tmp)->addr, INT64(50), "/root/repo/modules/standard/List.chpl");
+      chpl_macro_tmp_830.locale = (&tmp)->locale;
+      chpl_macro_tmp_830.addr = &(((&tmp)->addr)->next);
+      chpl_gen_comm_get(((void*)(&ret5)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_830).locale), INT64(0), NULL), (chpl_macro_tmp_830).addr, sizeof(chpl____wide_listNode_BaseArr), -1, INT64(1), INT64(50), "/root/repo/modules/standard/List.chpl");
+      chpl_gen_comm_put(((void*)(&ret5)), chpl_nodeFromLocaleID(&((call_tmp15).locale), INT64(0), NULL), (call_tmp15).addr, sizeof(chpl____wide_listNode_BaseArr), -1, INT64(1), INT64(50), "/root/repo/modules/standard/List.chpl");
+    }
+    chpl_macro_tmp_831.locale = (*(this6)).locale;
+    chpl_macro_tmp_831.addr = &(((*(this6)).addr)->first);
+    chpl_gen_comm_get(((void*)(&ret6)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_831).locale), INT64(0), NULL), (chpl_macro_tmp_831).addr, sizeof(chpl____wide_listNode_BaseArr), -1, INT64(1), INT64(51), "/root/repo/modules/standard/List.chpl");
+    chpl_macro_tmp_832.locale = (&ret6)->locale;
+    chpl_macro_tmp_832.addr = ((object)((&ret6)->addr));
+    call_tmp16 = chpl_macro_tmp_832;
+    chpl_macro_tmp_833.locale = (&tmp)->locale;
+    chpl_macro_tmp_833.addr = ((object)((&tmp)->addr));
+    call_tmp17 = chpl_macro_tmp_833;
+    call_tmp18 = (! (((&call_tmp16)->addr != (&call_tmp17)->addr) || ((!(! (&call_tmp16)->addr)) && (chpl_nodeFromLocaleID(&((&call_tmp16)->locale), INT64(0), NULL) != chpl_nodeFromLocaleID(&((&call_tmp17)->locale), INT64(0), NULL)))));
+    if (call_tmp18) {
+      chpl_macro_tmp_834.locale = (*(this6)).locale;
+      chpl_macro_tmp_834.addr = &(((*(this6)).addr)->first);
+      call_tmp19 = chpl_macro_tmp_834;
+      chpl_check_nil((&tmp)->addr, INT64(52), "/root/repo/modules/standard/List.chpl");
+      chpl_macro_tmp_835.locale = (&tmp)->locale;
+      chpl_macro_tmp_835.addr = &(((&tmp)->addr)->next);
+      chpl_gen_comm_get(((void*)(&ret7)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_835).locale), INT64(0), NULL), (chpl_macro_tmp_835).addr, sizeof(chpl____wide_listNode_BaseArr), -1, INT64(1), INT64(52), "/root/repo/modules/standard/List.chpl");
+      chpl_gen_comm_put(((void*)(&ret7)), chpl_nodeFromLocaleID(&((call_tmp19).locale), INT64(0), NULL), (call_tmp19).addr, sizeof(chpl____wide_listNode_BaseArr), -1, INT64(1), INT64(52), "/root/repo/modules/standard/List.chpl");
+    }
+    chpl_macro_tmp_836.locale = (*(this6)).locale;
+    chpl_macro_tmp_836.addr = &(((*(this6)).addr)->last);
+    chpl_gen_comm_get(((void*)(&ret8)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_836).locale), INT64(0), NULL), (chpl_macro_tmp_836).addr, sizeof(chpl____wide_listNode_BaseArr), -1, INT64(1), INT64(53), "/root/repo/modules/standard/List.chpl");
+    chpl_macro_tmp_837.locale = (&ret8)->locale;
+    chpl_macro_tmp_837.addr = ((object)((&ret8)->addr));
+    call_tmp20 = chpl_macro_tmp_837;
+    chpl_macro_tmp_838.locale = (&tmp)->locale;
+    chpl_macro_tmp_838.addr = ((object)((&tmp)->addr));
+    call_tmp21 = chpl_macro_tmp_838;
+    call_tmp22 = (! (((&call_tmp20)->addr != (&call_tmp21)->addr) || ((!(! (&call_tmp20)->addr)) && (chpl_nodeFromLocaleID(&((&call_tmp20)->locale), INT64(0), NULL) != chpl_nodeFromLocaleID(&((&call_tmp21)->locale), INT64(0), NULL)))));
+    if (call_tmp22) {
+      chpl_macro_tmp_839.locale = (*(this6)).locale;
+      chpl_macro_tmp_839.addr = &(((*(this6)).addr)->last);
+      call_tmp23 = chpl_macro_tmp_839;
+      chpl_gen_comm_put(((void*)(&prev)), chpl_nodeFromLocaleID(&((call_tmp23).locale), INT64(0), NULL), (call_tmp23).addr, sizeof(chpl____wide_listNode_BaseArr), -1, INT64(1), INT64(54), "/root/repo/modules/standard/List.chpl");
+    }
+    call_tmp24 = (&tmp)->locale;
+    rvfDerefTmp = tmp;
+    _args_size = sizeof(chpl__class_localson_fn61_object);
+    _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn = ((_class_localson_fn61)(_args_alloc));
+    chpl_check_nil(_args_foron_fn, INT64(55), "/root/repo/modules/standard/List.chpl");
+    (_args_foron_fn)->_0__tmp = call_tmp24;
+    chpl_check_nil(_args_foron_fn, INT64(55), "/root/repo/modules/standard/List.chpl");
+    (_args_foron_fn)->_1_rvfDerefTmp = rvfDerefTmp;
+    (_args_foron_fn)->_ln = _ln;
+    (_args_foron_fn)->_fn = _fn;
+    /*** wrapon_fn61 ***/ chpl_executeOn(&call_tmp24, INT32(66), _args_foron_fn, sizeof(chpl__class_localson_fn61_object), INT64(55), "/root/repo/modules/standard/List.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+    chpl_macro_tmp_840.locale = (*(this6)).locale;
+    chpl_macro_tmp_840.addr = &(((*(this6)).addr)->length);
+    call_tmp25 = chpl_macro_tmp_840;
+    chpl_gen_comm_get(((void*)(&chpl_macro_tmp_841)), chpl_nodeFromLocaleID(&((call_tmp25).locale), INT64(0), NULL), (call_tmp25).addr, sizeof(int64_t), -1, INT64(1), INT64(56), "/root/repo/modules/standard/List.chpl");
+    chpl_macro_tmp_841 -= INT64(1);
+    chpl_gen_comm_put(((void*)(&chpl_macro_tmp_841)), chpl_nodeFromLocaleID(&((call_tmp25).locale), INT64(0), NULL), (call_tmp25).addr, sizeof(int64_t), -1, INT64(1), INT64(56), "/root/repo/modules/standard/List.chpl");
+  }
+  return;
+}
+
+/* List.chpl:55 */
+static void _local_on_fn5(chpl____wide_listNode_BaseDom* const delete_tmp, int64_t _ln, c_string _fn) {
+  chpl_opaque call_tmp;
+  call_tmp = ((void*)((delete_tmp)->addr));
+  _local_chpl_here_free(call_tmp, _ln, _fn);
+  return;
+}
+
+/* List.chpl:55 */
+static void on_fn60(chpl____wide_listNode_BaseDom* const delete_tmp, int64_t _ln, c_string _fn) {
+  chpl_opaque call_tmp;
+  call_tmp = ((void*)((delete_tmp)->addr));
+  chpl_here_free(call_tmp, _ln, _fn);
+  return;
+}
+
+/* List.chpl:55 */
+static void _local_on_fn6(chpl____wide_listNode_BaseArr* const delete_tmp, int64_t _ln, c_string _fn) {
+  chpl_opaque call_tmp;
+  call_tmp = ((void*)((delete_tmp)->addr));
+  _local_chpl_here_free(call_tmp, _ln, _fn);
+  return;
+}
+
+/* List.chpl:55 */
+static void on_fn61(chpl____wide_listNode_BaseArr* const delete_tmp, int64_t _ln, c_string _fn) {
+  chpl_opaque call_tmp;
+  call_tmp = ((void*)((delete_tmp)->addr));
+  chpl_here_free(call_tmp, _ln, _fn);
+  return;
+}
+
+/* List.chpl:55 */
+static void _local_wrapon_fn5(_class_localson_fn60 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_listNode_BaseDom _1_rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln2;
+  _fn = (c)->_fn2;
+  chpl_check_nil(c, INT64(55), "/root/repo/modules/standard/List.chpl");
+  _1_rvfDerefTmp = (c)->_1_rvfDerefTmp;
+  _local_on_fn5(&_1_rvfDerefTmp, _ln, _fn);
+  return;
+}
+
+/* List.chpl:55 */
+static void wrapon_fn60(_class_localson_fn60 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_listNode_BaseDom _1_rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(55), "/root/repo/modules/standard/List.chpl");
+  _1_rvfDerefTmp = (c)->_1_rvfDerefTmp;
+  on_fn60(&_1_rvfDerefTmp, _ln, _fn);
+  return;
+}
+
+/* List.chpl:55 */
+static void _local_wrapon_fn6(_class_localson_fn61 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_listNode_BaseArr _1_rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln2;
+  _fn = (c)->_fn2;
+  chpl_check_nil(c, INT64(55), "/root/repo/modules/standard/List.chpl");
+  _1_rvfDerefTmp = (c)->_1_rvfDerefTmp;
+  _local_on_fn6(&_1_rvfDerefTmp, _ln, _fn);
+  return;
+}
+
+/* List.chpl:55 */
+static void wrapon_fn61(_class_localson_fn61 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_listNode_BaseArr _1_rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(55), "/root/repo/modules/standard/List.chpl");
+  _1_rvfDerefTmp = (c)->_1_rvfDerefTmp;
+  on_fn61(&_1_rvfDerefTmp, _ln, _fn);
+  return;
+}
+
+/* List.chpl:68 */
+static void append(chpl____wide__ref_list_BaseArr* const this6, chpl____wide_BaseArr* const e, int64_t _ln, c_string _fn) {
+  chpl____wide_listNode_BaseArr ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp2;
+  chpl____wide_listNode_BaseArr ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_listNode_BaseArr coerce_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_listNode_BaseArr call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseArr this7 = NULL;
+  int64_t call_tmp4;
+  chpl_opaque cast_tmp;
+  listNode_BaseArr T = NULL;
+  BaseArr T2 = NULL;
+  chpl____wide_BaseArr T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseArr T4 = NULL;
+  chpl____wide_listNode_BaseArr T5 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseArr call_tmp5 = NULL;
+  listNode_BaseArr T6 = NULL;
+  chpl____wide_listNode_BaseArr T7 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseArr wrap_call_tmp = NULL;
+  chpl____wide_listNode_BaseArr T8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_listNode_BaseArr call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_listNode_BaseArr ret3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_listNode_BaseArr coerce_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_listNode_BaseArr ret4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_listNode_BaseArr call_tmp7 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseArr this8 = NULL;
+  int64_t call_tmp8;
+  chpl_opaque cast_tmp2;
+  listNode_BaseArr T9 = NULL;
+  BaseArr T10 = NULL;
+  chpl____wide_BaseArr T11 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseArr T12 = NULL;
+  chpl____wide_listNode_BaseArr T13 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseArr call_tmp9 = NULL;
+  listNode_BaseArr T14 = NULL;
+  chpl____wide_listNode_BaseArr T15 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseArr wrap_call_tmp2 = NULL;
+  chpl____wide_listNode_BaseArr T16 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_listNode_BaseArr call_tmp10 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_listNode_BaseArr ret5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_int64_t call_tmp11 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_listNode_BaseArr chpl_macro_tmp_842;
+  chpl____wide_object chpl_macro_tmp_843;
+  chpl____wide__ref_listNode_BaseArr chpl_macro_tmp_844;
+  chpl____wide__ref_listNode_BaseArr chpl_macro_tmp_845;
+  chpl____wide_BaseArr chpl_macro_tmp_846;
+  chpl____wide_listNode_BaseArr chpl_macro_tmp_847;
+  chpl____wide_listNode_BaseArr chpl_macro_tmp_848;
+  chpl____wide_listNode_BaseArr chpl_macro_tmp_849;
+  chpl____wide__ref_listNode_BaseArr chpl_macro_tmp_850;
+  chpl____wide__ref_listNode_BaseArr chpl_macro_tmp_851;
+  chpl____wide__ref_listNode_BaseArr chpl_macro_tmp_852;
+  chpl____wide__ref_listNode_BaseArr chpl_macro_tmp_853;
+  chpl____wide_BaseArr chpl_macro_tmp_854;
+  chpl____wide_listNode_BaseArr chpl_macro_tmp_855;
+  chpl____wide_listNode_BaseArr chpl_macro_tmp_856;
+  chpl____wide_listNode_BaseArr chpl_macro_tmp_857;
+  chpl____wide__ref_listNode_BaseArr chpl_macro_tmp_858;
+  chpl____wide__ref_listNode_BaseArr chpl_macro_tmp_859;
+  chpl____wide__ref_int64_t chpl_macro_tmp_860;
+  int64_t chpl_macro_tmp_861;
+  chpl_macro_tmp_842.locale = (*(this6)).locale;
+  chpl_macro_tmp_842.addr = &(((*(this6)).addr)->last);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_842).locale), INT64(0), NULL), (chpl_macro_tmp_842).addr, sizeof(chpl____wide_listNode_BaseArr), -1, INT64(1), INT64(69), "/root/repo/modules/standard/List.chpl");
+  chpl_macro_tmp_843.locale = (&ret)->locale;
+  chpl_macro_tmp_843.addr = ((object)((&ret)->addr));
+  call_tmp = chpl_macro_tmp_843;
+  call_tmp2 = (&call_tmp)->addr != nil;
+  if (call_tmp2) {
+    chpl_macro_tmp_844.locale = (*(this6)).locale;
+    chpl_macro_tmp_844.addr = &(((*(this6)).addr)->last);
+    chpl_gen_comm_get(((void*)(&ret2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_844).locale), INT64(0), NULL), (chpl_macro_tmp_844).addr, sizeof(chpl____wide_listNode_BaseArr), -1, INT64(1), INT64(70), "/root/repo/modules/standard/List.chpl");
+    coerce_tmp = ret2;
+    chpl_check_nil((&coerce_tmp)->addr, INT64(70), "/root/repo/modules/standard/List.chpl");
+    chpl_macro_tmp_845.locale = (&coerce_tmp)->locale;
+    chpl_macro_tmp_845.addr = &(((&coerce_tmp)->addr)->next);
+    call_tmp3 = chpl_macro_tmp_845;
+    call_tmp4 = sizeof(chpl_listNode_BaseArr_object);
+    cast_tmp = chpl_here_alloc(call_tmp4, INT16(2), _ln, _fn);
+    T = ((listNode_BaseArr)(cast_tmp));
+    this7 = T;
+    ((object)(this7))->chpl__cid = chpl__cid_listNode_BaseArr;
+    T2 = nil;
+    chpl_macro_tmp_846.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_846.addr = T2;
+    T3 = chpl_macro_tmp_846;
+    chpl_check_nil(this7, INT64(70), "/root/repo/modules/standard/List.chpl");
+    (this7)->data = T3;
+    T4 = nil;
+    chpl_macro_tmp_847.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_847.addr = T4;
+    T5 = chpl_macro_tmp_847;
+    chpl_check_nil(this7, INT64(70), "/root/repo/modules/standard/List.chpl");
+    (this7)->next = T5;
+    chpl_check_nil(this7, INT64(70), "/root/repo/modules/standard/List.chpl");
+    (this7)->data = *(e);
+    T6 = ((listNode_BaseArr)(nil));
+    call_tmp5 = T6;
+    chpl_macro_tmp_848.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_848.addr = call_tmp5;
+    T7 = chpl_macro_tmp_848;
+    chpl_check_nil(this7, INT64(70), "/root/repo/modules/standard/List.chpl");
+    (this7)->next = T7;
+    wrap_call_tmp = _construct_listNode(e, call_tmp5, this7, _ln, _fn);
+    chpl_macro_tmp_849.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_849.addr = wrap_call_tmp;
+    T8 = chpl_macro_tmp_849;
+    chpl_gen_comm_put(((void*)(&T8)), chpl_nodeFromLocaleID(&((call_tmp3).locale), INT64(0), NULL), (call_tmp3).addr, sizeof(chpl____wide_listNode_BaseArr), -1, INT64(1), INT64(70), "/root/repo/modules/standard/List.chpl");
+    chpl_macro_tmp_850.locale = (*(this6)).locale;
+    chpl_macro_tmp_850.addr = &(((*(this6)).addr)->last);
+    call_tmp6 = chpl_macro_tmp_850;
+    chpl_macro_tmp_851.locale = (*(this6)).locale;
+    chpl_macro_tmp_851.addr = &(((*(this6)).addr)->last);
+    chpl_gen_comm_get(((void*)(&ret3)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_851).locale), INT64(0), NULL), (chpl_macro_tmp_851).addr, sizeof(chpl____wide_listNode_BaseArr), -1, INT64(1), INT64(71), "/root/repo/modules/standard/List.chpl");
+    coerce_tmp2 = ret3;
+    chpl_check_nil((&coerce_tmp2)->addr, INT64(71), "/root/repo/modules/standard/List.chpl");
+    chpl_macro_tmp_852.locale = (&coerce_tmp2)->locale;
+    chpl_macro_tmp_852.addr = &(((&coerce_tmp2)->addr)->next);
+    chpl_gen_comm_get(((void*)(&ret4)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_852).locale), INT64(0), NULL), (chpl_macro_tmp_852).addr, sizeof(chpl____wide_listNode_BaseArr), -1, INT64(1), INT64(71), "/root/repo/modules/standard/List.chpl");
+    chpl_gen_comm_put(((void*)(&ret4)), chpl_nodeFromLocaleID(&((call_tmp6).locale), INT64(0), NULL), (call_tmp6).addr, sizeof(chpl____wide_listNode_BaseArr), -1, INT64(1), INT64(71), "/root/repo/modules/standard/List.chpl");
+  } else {
+    chpl_macro_tmp_853.locale = (*(this6)).locale;
+    chpl_macro_tmp_853.addr = &(((*(this6)).addr)->first);
+    call_tmp7 = chpl_macro_tmp_853;
+    call_tmp8 = sizeof(chpl_listNode_BaseArr_object);
+    cast_tmp2 = chpl_here_alloc(call_tmp8, INT16(2), _ln, _fn);
+    T9 = ((listNode_BaseArr)(cast_tmp2));
+    this8 = T9;
+    ((object)(this8))->chpl__cid = chpl__cid_listNode_BaseArr;
+    T10 = nil;
+    chpl_macro_tmp_854.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_854.addr = T10;
+    T11 = chpl_macro_tmp_854;
+    chpl_check_nil(this8, INT64(73), "/root/repo/modules/standard/List.chpl");
+    (this8)->data = T11;
+    T12 = nil;
+    chpl_macro_tmp_855.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_855.addr = T12;
+    T13 = chpl_macro_tmp_855;
+    chpl_check_nil(this8, INT64(73), "/root/repo/modules/standard/List.chpl");
+    (this8)->next = T13;
+    chpl_check_nil(this8, INT64(73), "/root/repo/modules/standard/List.chpl");
+    (this8)->data = *(e);
+    T14 = ((listNode_BaseArr)(nil));
+    call_tmp9 = T14;
+    chpl_macro_tmp_856.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_856.addr = call_tmp9;
+    T15 = chpl_macro_tmp_856;
+    chpl_check_nil(this8, INT64(73), "/root/repo/modules/standard/List.chpl");
+    (this8)->next = T15;
+    wrap_call_tmp2 = _construct_listNode(e, call_tmp9, this8, _ln, _fn);
+    chpl_macro_tmp_857.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_857.addr = wrap_call_tmp2;
+    T16 = chpl_macro_tmp_857;
+    chpl_gen_comm_put(((void*)(&T16)), chpl_nodeFromLocaleID(&((call_tmp7).locale), INT64(0), NULL), (call_tmp7).addr, sizeof(chpl____wide_listNode_BaseArr), -1, INT64(1), INT64(73), "/root/repo/modules/standard/List.chpl");
+    chpl_macro_tmp_858.locale = (*(this6)).locale;
+    chpl_macro_tmp_858.addr = &(((*(this6)).addr)->last);
+    call_tmp10 = chpl_macro_tmp_858;
+    chpl_macro_tmp_859.locale = (*(this6)).locale;
+    chpl_macro_tmp_859.addr = &(((*(this6)).addr)->first);
+    chpl_gen_comm_get(((void*)(&ret5)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_859).locale), INT64(0), NULL), (chpl_macro_tmp_859).addr, sizeof(chpl____wide_listNode_BaseArr), -1, INT64(1), INT64(74), "/root/repo/modules/standard/List.chpl");
+    chpl_gen_comm_put(((void*)(&ret5)), chpl_nodeFromLocaleID(&((call_tmp10).locale), INT64(0), NULL), (call_tmp10).addr, sizeof(chpl____wide_listNode_BaseArr), -1, INT64(1), INT64(74), "/root/repo/modules/standard/List.chpl");
+  }
+  chpl_macro_tmp_860.locale = (*(this6)).locale;
+  chpl_macro_tmp_860.addr = &(((*(this6)).addr)->length);
+  call_tmp11 = chpl_macro_tmp_860;
+  chpl_gen_comm_get(((void*)(&chpl_macro_tmp_861)), chpl_nodeFromLocaleID(&((call_tmp11).locale), INT64(0), NULL), (call_tmp11).addr, sizeof(int64_t), -1, INT64(1), INT64(76), "/root/repo/modules/standard/List.chpl");
+  chpl_macro_tmp_861 += INT64(1);
+  chpl_gen_comm_put(((void*)(&chpl_macro_tmp_861)), chpl_nodeFromLocaleID(&((call_tmp11).locale), INT64(0), NULL), (call_tmp11).addr, sizeof(int64_t), -1, INT64(1), INT64(76), "/root/repo/modules/standard/List.chpl");
+  return;
+}
+
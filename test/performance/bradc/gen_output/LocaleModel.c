@@ -0,0 +1,1535 @@
+/* LocaleModel.chpl:30 */
+static void chpl__init_LocaleModel(int64_t _ln, c_string _fn) {
+  c_string modFormatStr;
+  c_string modStr;
+  _ref_int32_t refIndentLevel = NULL;
+  chpl_bool type_tmp;
+  _ref_chpl_bool _ref_tmp_ = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F type_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl___RuntimeTypeInfo call_tmp;
+  chpl___RuntimeTypeInfo wrap_call_tmp;
+  chpl____wide_DefaultDist _runtime_type_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultRectangularDom_1_int64_t_F ret_to_arg_ref_tmp_ = NULL;
+  range_int64_t_bounded_F call_tmp2;
+  _ref_range_int64_t_bounded_F ret_to_arg_ref_tmp_2 = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultRectangularDom_1_int64_t_F ret_to_arg_ref_tmp_3 = NULL;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F type_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultRectangularDom_1_int64_t_F ret_to_arg_ref_tmp_4 = NULL;
+  chpl___RuntimeTypeInfo2 call_tmp5;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F _runtime_type_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultRectangularArr_locale_1_int64_t_F ret_to_arg_ref_tmp_5 = NULL;
+  chpl____wide__ref_chpl_bool chpl_macro_tmp_68;
+  if (chpl__init_LocaleModel_p) {
+    goto _exit_chpl__init_LocaleModel;
+  }
+  modFormatStr = "%*s\n";
+  modStr = "LocaleModel";
+  printModuleInit(modFormatStr, modStr, INT64(11), _ln, _fn);
+  refIndentLevel = &moduleInitLevel;
+  *(refIndentLevel) += INT64(1);
+  chpl__init_LocaleModel_p = true;
+  {
+    chpl__init_ChapelLocale(_ln, _fn);
+    chpl__init_DefaultRectangular(_ln, _fn);
+    chpl__init_ChapelNumLocales(_ln, _fn);
+    chpl__init_Sys(_ln, _fn);
+  }
+  type_tmp = false;
+  _ref_tmp_ = &type_tmp;
+  *(_ref_tmp_) = false;
+  chpl_check_nil((&doneCreatingLocales)->addr, INT64(45), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_68.locale = (&doneCreatingLocales)->locale;
+  chpl_macro_tmp_68.addr = &(((&doneCreatingLocales)->addr)->value);
+  chpl_gen_comm_put(((void*)(&type_tmp)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_68).locale), INT64(0), NULL), (chpl_macro_tmp_68).addr, sizeof(chpl_bool), -1, INT64(1), INT64(45), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  wrap_call_tmp = chpl__buildDomainRuntimeType(&defaultDist, _ln, _fn);
+  call_tmp = wrap_call_tmp;
+  _runtime_type_tmp_ = (&call_tmp)->d;
+  ret_to_arg_ref_tmp_ = &type_tmp2;
+  chpl__convertRuntimeTypeToValue(&_runtime_type_tmp_, ret_to_arg_ref_tmp_, _ln, _fn);
+  ret_to_arg_ref_tmp_2 = &call_tmp2;
+  _build_range(INT64(1), INT64(0), ret_to_arg_ref_tmp_2, _ln, _fn);
+  ret_to_arg_ref_tmp_3 = &call_tmp3;
+  chpl__buildDomainExpr(&call_tmp2, ret_to_arg_ref_tmp_3, _ln, _fn);
+  chpl___ASSIGN_2(&type_tmp2, &call_tmp3, _ln, _fn);
+  chpl__autoDestroy2(&call_tmp3, _ln, _fn);
+  chpl_emptyLocaleSpace = type_tmp2;
+  chpl_comm_broadcast_private(INT64(6), sizeof(chpl____wide_DefaultRectangularDom_1_int64_t_F), -1);
+  ret_to_arg_ref_tmp_4 = &call_tmp4;
+  chpl__ensureDomainExpr(&chpl_emptyLocaleSpace, ret_to_arg_ref_tmp_4, _ln, _fn);
+  call_tmp5 = chpl__buildArrayRuntimeType(&call_tmp4, _ln, _fn);
+  _runtime_type_tmp_2 = (&call_tmp5)->dom;
+  ret_to_arg_ref_tmp_5 = &type_tmp3;
+  chpl__convertRuntimeTypeToValue2(&_runtime_type_tmp_2, ret_to_arg_ref_tmp_5, _ln, _fn);
+  chpl__autoDestroy2(&call_tmp4, _ln, _fn);
+  chpl_emptyLocales = type_tmp3;
+  chpl_comm_broadcast_private(INT64(7), sizeof(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F), -1);
+  *(refIndentLevel) -= INT64(1);
+  _exit_chpl__init_LocaleModel:;
+  return;
+}
+
+/* LocaleModel.chpl:82 */
+static void chpl_buildLocaleID(int32_t node, int32_t subloc, _ref_chpl_localeID_t _retArg, int64_t _ln, c_string _fn) {
+  chpl_localeID_t _autoCopy_tmp_;
+  chpl_localeID_t call_tmp;
+  chpl_localeID_t call_tmp2;
+  _autoCopy_tmp_ = chpl_rt_buildLocaleID(node, subloc);
+  call_tmp = chpl__initCopy_chpl_rt_localeID_t(_autoCopy_tmp_);
+  call_tmp2 = chpl__initCopy_chpl_rt_localeID_t(call_tmp);
+  *(_retArg) = call_tmp2;
+  return;
+}
+
+/* LocaleModel.chpl:86 */
+static int32_t chpl_nodeFromLocaleID(chpl_localeID_t* const loc, int64_t _ln, c_string _fn) {
+  int32_t call_tmp;
+  call_tmp = chpl_rt_nodeFromLocaleID(*(loc));
+  return call_tmp;
+}
+
+/* LocaleModel.chpl:90 */
+static int32_t chpl_sublocFromLocaleID(chpl_localeID_t* const loc, int64_t _ln, c_string _fn) {
+  int32_t call_tmp;
+  call_tmp = chpl_rt_sublocFromLocaleID(*(loc));
+  return call_tmp;
+}
+
+/* LocaleModel.chpl:99 */
+static LocaleModel _construct_LocaleModel(locale parent, int64_t numCores, int64_t maxTaskPar, atomic_int64* const runningTaskCounter, uint64_t callStackSize, int64_t _node_id, chpl_string local_name, LocaleModel meme, int64_t _ln, c_string _fn) {
+  LocaleModel this6 = NULL;
+  AbstractLocaleModel T = NULL;
+  chpl____wide_chpl_string T2 = {CHPL_LOCALEID_T_INIT, NULL};
+  this6 = meme;
+  chpl_check_nil(this6, INT64(99), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  T = &((this6)->super);
+  _construct_AbstractLocaleModel(parent, numCores, maxTaskPar, runningTaskCounter, T, _ln, _fn);
+  chpl_check_nil(this6, INT64(100), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (this6)->callStackSize = callStackSize;
+  chpl_check_nil(this6, INT64(101), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (this6)->_node_id = _node_id;
+  chpl_string_widen(&T2, local_name, _ln, _fn);
+  chpl_check_nil(this6, INT64(102), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (this6)->local_name = T2;
+  return this6;
+}
+
+/* LocaleModel.chpl:99 */
+static void chpl__auto_destroy_LocaleModel(LocaleModel this6, int64_t _ln, c_string _fn) {
+  AbstractLocaleModel _parent_destructor_tmp_ = NULL;
+  locale _parent_destructor_tmp_2 = NULL;
+  _ref_atomic_int64 _field_destructor_tmp_ = NULL;
+  _ref_atomic_int_least64_t call_tmp = NULL;
+  _ref_atomic_int_least64_t T = NULL;
+  _parent_destructor_tmp_ = ((AbstractLocaleModel)(this6));
+  _parent_destructor_tmp_2 = ((locale)(_parent_destructor_tmp_));
+  chpl_check_nil(_parent_destructor_tmp_2, INT64(99), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  _field_destructor_tmp_ = &((_parent_destructor_tmp_2)->runningTaskCounter);
+  chpl_check_nil(_field_destructor_tmp_, INT64(99), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  call_tmp = &((_field_destructor_tmp_)->_v);
+  T = call_tmp;
+  atomic_destroy_int_least64_t(T);
+  call_tmp = T;
+  return;
+}
+
+/* LocaleModel.chpl:115 */
+static LocaleModel LocaleModel2(chpl____wide_locale* const parent_loc, int64_t _ln, c_string _fn) {
+  LocaleModel this6 = NULL;
+  LocaleModel this7 = NULL;
+  int64_t call_tmp;
+  chpl_opaque cast_tmp;
+  LocaleModel T = NULL;
+  chpl_string T2;
+  chpl____wide_chpl_string T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  locale call_tmp2 = NULL;
+  locale T4 = NULL;
+  atomic_int64 this8;
+  atomic_int_least64_t ret;
+  atomic_int_least64_t type_tmp;
+  _ref_atomic_int_least64_t _ref_tmp_ = NULL;
+  _ref_atomic_int_least64_t T5 = NULL;
+  atomic_int64 wrap_call_tmp;
+  chpl_string ret2;
+  chpl____wide_chpl_string T6 = {CHPL_LOCALEID_T_INIT, NULL};
+  LocaleModel wrap_call_tmp2 = NULL;
+  chpl_bool T7;
+  c_string T8;
+  locale coerce_tmp = NULL;
+  locale call_tmp3 = NULL;
+  _ref_locale call_tmp4 = NULL;
+  chpl____wide__ref_chpl_bool chpl_macro_tmp_69;
+  call_tmp = sizeof(chpl_LocaleModel_object);
+  cast_tmp = chpl_here_alloc(call_tmp, INT16(19), _ln, _fn);
+  T = ((LocaleModel)(cast_tmp));
+  this7 = T;
+  ((object)(this7))->chpl__cid = chpl__cid_LocaleModel;
+  chpl_check_nil(this7, INT64(115), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (this7)->callStackSize = UINT64(0);
+  chpl_check_nil(this7, INT64(115), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (this7)->_node_id = INT64(0);
+  T2 = defaultStringValue;
+  chpl_string_widen(&T3, T2, _ln, _fn);
+  chpl_check_nil(this7, INT64(115), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (this7)->local_name = T3;
+  T4 = ((locale)(nil));
+  call_tmp2 = T4;
+  ret = type_tmp;
+  _ref_tmp_ = &ret;
+  T5 = _ref_tmp_;
+  atomic_init_int_least64_t(T5, INT64(0));
+  _ref_tmp_ = T5;
+  (&this8)->_v = ret;
+  wrap_call_tmp = _construct_atomic_int64(ret, &this8, _ln, _fn);
+  chpl_check_nil(this7, INT64(115), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (this7)->callStackSize = UINT64(0);
+  chpl_check_nil(this7, INT64(115), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (this7)->_node_id = INT64(0);
+  ret2 = defaultStringValue;
+  chpl_string_widen(&T6, ret2, _ln, _fn);
+  chpl_check_nil(this7, INT64(115), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (this7)->local_name = T6;
+  wrap_call_tmp2 = _construct_LocaleModel(call_tmp2, INT64(0), INT64(0), &wrap_call_tmp, UINT64(0), INT64(0), ret2, this7, _ln, _fn);
+  this6 = wrap_call_tmp2;
+  chpl_check_nil((&doneCreatingLocales)->addr, INT64(45), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_69.locale = (&doneCreatingLocales)->locale;
+  chpl_macro_tmp_69.addr = &(((&doneCreatingLocales)->addr)->value);
+  chpl_gen_comm_get(((void*)(&T7)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_69).locale), INT64(0), NULL), (chpl_macro_tmp_69).addr, sizeof(chpl_bool), -1, INT64(1), INT64(45), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  if (T7) {
+    T8 = "Cannot create additional LocaleModel instances";
+    halt(T8, _ln, _fn);
+  }
+  call_tmp3 = ((locale)(wrap_call_tmp2));
+  coerce_tmp = call_tmp3;
+  chpl_check_nil(coerce_tmp, INT64(119), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  call_tmp4 = &((coerce_tmp)->parent);
+  *(call_tmp4) = *(parent_loc);
+  chpl_check_nil(wrap_call_tmp2, INT64(120), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  init(wrap_call_tmp2, _ln, _fn);
+  return this6;
+}
+
+/* LocaleModel.chpl:123 */
+static int64_t chpl_id2(chpl____wide_LocaleModel* const this6, int64_t _ln, c_string _fn) {
+  int64_t ret;
+  chpl____wide__ref_int64_t chpl_macro_tmp_70;
+  chpl_check_nil((this6)->addr, INT64(123), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_70.locale = (this6)->locale;
+  chpl_macro_tmp_70.addr = &(((this6)->addr)->_node_id);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_70).locale), INT64(0), NULL), (chpl_macro_tmp_70).addr, sizeof(int64_t), -1, INT64(1), INT64(123), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  return ret;
+}
+
+/* LocaleModel.chpl:147 */
+static chpl____wide_locale getChild2(chpl____wide_LocaleModel* const this6, int64_t idx, int64_t _ln, c_string _fn) {
+  chpl____wide_locale ret = {CHPL_LOCALEID_T_INIT, NULL};
+  c_string T;
+  chpl____wide__nilType chpl_macro_tmp_71;
+  chpl____wide_locale chpl_macro_tmp_72;
+  T = "requesting a child from a LocaleModel locale";
+  halt(T, _ln, _fn);
+  chpl_macro_tmp_71.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_71.addr = nil;
+  chpl_macro_tmp_72.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_72.addr = NULL;
+  ret = chpl_macro_tmp_72;
+  return ret;
+}
+
+/* LocaleModel.chpl:165 */
+static void init(LocaleModel this6, int64_t _ln, c_string _fn) {
+  _ref_int64_t call_tmp = NULL;
+  int64_t call_tmp2;
+  c_string comm;
+  c_string spawnfn;
+  _ref_c_string T = NULL;
+  _ref_c_string T2 = NULL;
+  chpl____wide_chpl_string call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  c_string call_tmp4;
+  int32_t call_tmp5;
+  _ref_c_string T3 = NULL;
+  int32_t call_tmp6;
+  chpl_bool call_tmp7;
+  chpl_bool T4;
+  int64_t call_tmp8;
+  chpl_bool call_tmp9;
+  chpl_bool T5;
+  chpl____wide_chpl_string call_tmp10 = {CHPL_LOCALEID_T_INIT, NULL};
+  c_string call_tmp11;
+  int32_t call_tmp12;
+  _ref_c_string T6 = NULL;
+  int32_t call_tmp13;
+  chpl_bool call_tmp14;
+  chpl_bool T7;
+  int64_t call_tmp15;
+  chpl_bool call_tmp16;
+  c_string call_tmp17;
+  chpl____wide_chpl_string call_tmp18 = {CHPL_LOCALEID_T_INIT, NULL};
+  c_string_copy cs;
+  c_string call_tmp19;
+  c_string_copy call_tmp20;
+  _ref_c_string_copy _ref_tmp_ = NULL;
+  chpl____wide_chpl_string call_tmp21 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_c_string_copy T8 = NULL;
+  int64_t ret;
+  c_string_copy cs2;
+  c_string_copy call_tmp22;
+  uint32_t call_tmp23;
+  _ref_c_string_copy _ref_tmp_2 = NULL;
+  chpl____wide_chpl_string call_tmp24 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_c_string_copy T9 = NULL;
+  c_string_copy cs3;
+  c_string call_tmp25;
+  c_string call_tmp26;
+  c_string_copy call_tmp27;
+  _ref_c_string_copy _ref_tmp_3 = NULL;
+  chpl_string call_tmp28;
+  _ref_c_string_copy T10 = NULL;
+  chpl____wide_chpl_string T11 = {CHPL_LOCALEID_T_INIT, NULL};
+  c_string call_tmp29;
+  chpl____wide_chpl_string call_tmp30 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_uint64_t call_tmp31 = NULL;
+  uint64_t call_tmp32;
+  locale coerce_tmp = NULL;
+  locale call_tmp33 = NULL;
+  _ref_int64_t call_tmp34 = NULL;
+  int32_t call_tmp35;
+  int64_t call_tmp36;
+  locale coerce_tmp2 = NULL;
+  locale call_tmp37 = NULL;
+  _ref_int64_t call_tmp38 = NULL;
+  uint32_t call_tmp39;
+  int64_t call_tmp40;
+  chpl_check_nil(this6, INT64(166), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  call_tmp = &((this6)->_node_id);
+  call_tmp2 = ((int64_t)(chpl_nodeID));
+  *(call_tmp) = call_tmp2;
+  comm = "";
+  spawnfn = "";
+  T = &comm;
+  T2 = &spawnfn;
+  wide_string_from_c_string(&call_tmp3, "CHPL_COMM", INT64(0), INT64(0), _ln, _fn);
+  c_string_from_wide_string(&call_tmp4, &call_tmp3, _ln, _fn);
+  T3 = T;
+  call_tmp5 = sys_getenv(call_tmp4, T3);
+  T = T3;
+  call_tmp6 = ((int32_t)(INT64(0)));
+  call_tmp7 = (call_tmp5 == call_tmp6);
+  if (call_tmp7) {
+    call_tmp8 = string_compare(comm, "gasnet");
+    call_tmp9 = (call_tmp8 == INT64(0));
+    T4 = call_tmp9;
+  } else {
+    T4 = false;
+  }
+  if (T4) {
+    wide_string_from_c_string(&call_tmp10, "GASNET_SPAWNFN", INT64(0), INT64(0), _ln, _fn);
+    c_string_from_wide_string(&call_tmp11, &call_tmp10, _ln, _fn);
+    T6 = T2;
+    call_tmp12 = sys_getenv(call_tmp11, T6);
+    T2 = T6;
+    call_tmp13 = ((int32_t)(INT64(0)));
+    call_tmp14 = (call_tmp12 == call_tmp13);
+    T5 = call_tmp14;
+  } else {
+    T5 = false;
+  }
+  if (T5) {
+    call_tmp15 = string_compare(spawnfn, "L");
+    call_tmp16 = (call_tmp15 == INT64(0));
+    T7 = call_tmp16;
+  } else {
+    T7 = false;
+  }
+  if (T7) {
+    call_tmp17 = chpl_nodeName();
+    wide_string_from_c_string(&call_tmp18, call_tmp17, INT64(0), INT64(0), _ln, _fn);
+    c_string_from_wide_string(&call_tmp19, &call_tmp18, _ln, _fn);
+    call_tmp20 = string_concat(call_tmp19, "-", _ln, _fn);
+    cs = call_tmp20;
+    _ref_tmp_ = &cs;
+    T8 = _ref_tmp_;
+    chpl_string_widen(&call_tmp21, string_from_c_string_copy(T8, false, INT64(0)), _ln, _fn);
+    _ref_tmp_ = T8;
+    chpl_check_nil(this6, INT64(178), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+    ret = (this6)->_node_id;
+    call_tmp23 = ((uint32_t)(INT64(8)));
+    call_tmp22 = integral_to_c_string_copy(ret, call_tmp23, true);
+    cs2 = call_tmp22;
+    _ref_tmp_2 = &cs2;
+    T9 = _ref_tmp_2;
+    chpl_string_widen(&call_tmp24, string_from_c_string_copy(T9, false, INT64(0)), _ln, _fn);
+    _ref_tmp_2 = T9;
+    c_string_from_wide_string(&call_tmp25, &call_tmp21, _ln, _fn);
+    c_string_from_wide_string(&call_tmp26, &call_tmp24, _ln, _fn);
+    call_tmp27 = string_concat(call_tmp25, call_tmp26, _ln, _fn);
+    cs3 = call_tmp27;
+    _ref_tmp_3 = &cs3;
+    T10 = _ref_tmp_3;
+    call_tmp28 = string_from_c_string_copy(T10, false, INT64(0));
+    _ref_tmp_3 = T10;
+    chpl_string_widen(&T11, call_tmp28, _ln, _fn);
+    chpl_check_nil(this6, INT64(178), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+    (this6)->local_name = T11;
+  } else {
+    call_tmp29 = chpl_nodeName();
+    wide_string_from_c_string(&call_tmp30, call_tmp29, INT64(0), INT64(0), _ln, _fn);
+    chpl_check_nil(this6, INT64(179), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+    (this6)->local_name = call_tmp30;
+  }
+  chpl_check_nil(this6, INT64(182), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  call_tmp31 = &((this6)->callStackSize);
+  call_tmp32 = chpl_task_getCallStackSize();
+  *(call_tmp31) = call_tmp32;
+  call_tmp33 = ((locale)(this6));
+  coerce_tmp = call_tmp33;
+  chpl_check_nil(coerce_tmp, INT64(185), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  call_tmp34 = &((coerce_tmp)->numCores);
+  call_tmp35 = chpl_getNumLogicalCpus(true);
+  call_tmp36 = ((int64_t)(call_tmp35));
+  *(call_tmp34) = call_tmp36;
+  call_tmp37 = ((locale)(this6));
+  coerce_tmp2 = call_tmp37;
+  chpl_check_nil(coerce_tmp2, INT64(188), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  call_tmp38 = &((coerce_tmp2)->maxTaskPar);
+  call_tmp39 = chpl_task_getMaxPar();
+  call_tmp40 = ((int64_t)(call_tmp39));
+  *(call_tmp38) = call_tmp40;
+  return;
+}
+
+/* LocaleModel.chpl:200 */
+static RootLocale _construct_RootLocale(locale parent, int64_t numCores, int64_t maxTaskPar, atomic_int64* const runningTaskCounter, chpl____wide_DefaultRectangularDom_1_int64_t_F* const myLocaleSpace, chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const myLocales, RootLocale meme, int64_t _ln, c_string _fn) {
+  RootLocale this6 = NULL;
+  AbstractRootLocale T = NULL;
+  this6 = meme;
+  chpl_check_nil(this6, INT64(200), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  T = &((this6)->super);
+  _construct_AbstractRootLocale(parent, numCores, maxTaskPar, runningTaskCounter, T, _ln, _fn);
+  chpl_check_nil(this6, INT64(202), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (this6)->myLocaleSpace = *(myLocaleSpace);
+  chpl_check_nil(this6, INT64(203), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (this6)->myLocales = *(myLocales);
+  return this6;
+}
+
+/* LocaleModel.chpl:200 */
+static void chpl__auto_destroy_RootLocale(RootLocale this6, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F _field_destructor_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F _field_destructor_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  AbstractRootLocale _parent_destructor_tmp_ = NULL;
+  locale _parent_destructor_tmp_2 = NULL;
+  _ref_atomic_int64 _field_destructor_tmp_3 = NULL;
+  _ref_atomic_int_least64_t call_tmp = NULL;
+  _ref_atomic_int_least64_t T = NULL;
+  chpl_check_nil(this6, INT64(203), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  _field_destructor_tmp_ = (this6)->myLocales;
+  chpl__autoDestroy3(&_field_destructor_tmp_, _ln, _fn);
+  chpl_check_nil(this6, INT64(202), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  _field_destructor_tmp_2 = (this6)->myLocaleSpace;
+  chpl__autoDestroy2(&_field_destructor_tmp_2, _ln, _fn);
+  _parent_destructor_tmp_ = ((AbstractRootLocale)(this6));
+  _parent_destructor_tmp_2 = ((locale)(_parent_destructor_tmp_));
+  chpl_check_nil(_parent_destructor_tmp_2, INT64(200), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  _field_destructor_tmp_3 = &((_parent_destructor_tmp_2)->runningTaskCounter);
+  chpl_check_nil(_field_destructor_tmp_3, INT64(200), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  call_tmp = &((_field_destructor_tmp_3)->_v);
+  T = call_tmp;
+  atomic_destroy_int_least64_t(T);
+  call_tmp = T;
+  return;
+}
+
+/* LocaleModel.chpl:205 */
+static RootLocale RootLocale2(int64_t _ln, c_string _fn) {
+  int64_t local_numLocales;
+  RootLocale this6 = NULL;
+  RootLocale this7 = NULL;
+  int64_t call_tmp;
+  chpl_opaque cast_tmp;
+  RootLocale T = NULL;
+  DefaultRectangularDom_1_int64_t_F _init_class_tmp_ = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F T2 = {CHPL_LOCALEID_T_INIT, NULL};
+  DefaultRectangularArr_locale_1_int64_t_F _init_class_tmp_2 = NULL;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  locale call_tmp2 = NULL;
+  locale T4 = NULL;
+  atomic_int64 this8;
+  atomic_int_least64_t ret;
+  atomic_int_least64_t type_tmp;
+  _ref_atomic_int_least64_t _ref_tmp_ = NULL;
+  _ref_atomic_int_least64_t T5 = NULL;
+  atomic_int64 wrap_call_tmp;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F default_argmyLocaleSpace = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl___RuntimeTypeInfo call_tmp3;
+  chpl___RuntimeTypeInfo wrap_call_tmp2;
+  int64_t call_tmp4;
+  range_int64_t_bounded_F call_tmp5;
+  _ref_range_int64_t_bounded_F ret_to_arg_ref_tmp_ = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultRectangularDom_1_int64_t_F ret_to_arg_ref_tmp_2 = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F x2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F type_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultDist _runtime_type_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultRectangularDom_1_int64_t_F ret_to_arg_ref_tmp_3 = NULL;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F default_argmyLocales = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F call_tmp7 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultRectangularDom_1_int64_t_F ret_to_arg_ref_tmp_4 = NULL;
+  chpl___RuntimeTypeInfo2 call_tmp8;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F _runtime_type_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultRectangularArr_locale_1_int64_t_F ret_to_arg_ref_tmp_5 = NULL;
+  RootLocale wrap_call_tmp3 = NULL;
+  locale coerce_tmp = NULL;
+  locale call_tmp9 = NULL;
+  _ref_locale call_tmp10 = NULL;
+  locale coerce_tmp2 = NULL;
+  locale call_tmp11 = NULL;
+  _ref_int64_t call_tmp12 = NULL;
+  locale coerce_tmp3 = NULL;
+  locale call_tmp13 = NULL;
+  _ref_int64_t call_tmp14 = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_73;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F chpl_macro_tmp_74;
+  chpl____wide_locale chpl_macro_tmp_75;
+  local_numLocales = numLocales;
+  call_tmp = sizeof(chpl_RootLocale_object);
+  cast_tmp = chpl_here_alloc(call_tmp, INT16(10), _ln, _fn);
+  T = ((RootLocale)(cast_tmp));
+  this7 = T;
+  ((object)(this7))->chpl__cid = chpl__cid_RootLocale;
+  _init_class_tmp_ = nil;
+  chpl_macro_tmp_73.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_73.addr = _init_class_tmp_;
+  T2 = chpl_macro_tmp_73;
+  chpl_check_nil(this7, INT64(205), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (this7)->myLocaleSpace = T2;
+  _init_class_tmp_2 = nil;
+  chpl_macro_tmp_74.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_74.addr = _init_class_tmp_2;
+  T3 = chpl_macro_tmp_74;
+  chpl_check_nil(this7, INT64(205), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (this7)->myLocales = T3;
+  T4 = ((locale)(nil));
+  call_tmp2 = T4;
+  ret = type_tmp;
+  _ref_tmp_ = &ret;
+  T5 = _ref_tmp_;
+  atomic_init_int_least64_t(T5, INT64(0));
+  _ref_tmp_ = T5;
+  (&this8)->_v = ret;
+  wrap_call_tmp = _construct_atomic_int64(ret, &this8, _ln, _fn);
+  wrap_call_tmp2 = chpl__buildDomainRuntimeType(&defaultDist, _ln, _fn);
+  call_tmp3 = wrap_call_tmp2;
+  call_tmp4 = (local_numLocales - INT64(1));
+  ret_to_arg_ref_tmp_ = &call_tmp5;
+  _build_range(INT64(0), call_tmp4, ret_to_arg_ref_tmp_, _ln, _fn);
+  ret_to_arg_ref_tmp_2 = &call_tmp6;
+  chpl__buildDomainExpr(&call_tmp5, ret_to_arg_ref_tmp_2, _ln, _fn);
+  _runtime_type_tmp_ = (&call_tmp3)->d;
+  ret_to_arg_ref_tmp_3 = &type_tmp2;
+  chpl__convertRuntimeTypeToValue(&_runtime_type_tmp_, ret_to_arg_ref_tmp_3, _ln, _fn);
+  x2 = type_tmp2;
+  chpl___ASSIGN_2(&type_tmp2, &call_tmp6, _ln, _fn);
+  default_argmyLocaleSpace = chpl__autoCopy2(&x2, _ln, _fn);
+  chpl_check_nil(this7, INT64(205), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (this7)->myLocaleSpace = default_argmyLocaleSpace;
+  ret_to_arg_ref_tmp_4 = &call_tmp7;
+  chpl__ensureDomainExpr(&default_argmyLocaleSpace, ret_to_arg_ref_tmp_4, _ln, _fn);
+  call_tmp8 = chpl__buildArrayRuntimeType(&call_tmp7, _ln, _fn);
+  _runtime_type_tmp_2 = (&call_tmp8)->dom;
+  ret_to_arg_ref_tmp_5 = &default_argmyLocales;
+  chpl__convertRuntimeTypeToValue2(&_runtime_type_tmp_2, ret_to_arg_ref_tmp_5, _ln, _fn);
+  chpl_check_nil(this7, INT64(205), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (this7)->myLocales = default_argmyLocales;
+  wrap_call_tmp3 = _construct_RootLocale(call_tmp2, INT64(0), INT64(0), &wrap_call_tmp, &default_argmyLocaleSpace, &default_argmyLocales, this7, _ln, _fn);
+  chpl__autoDestroy2(&call_tmp7, _ln, _fn);
+  chpl__autoDestroy2(&call_tmp6, _ln, _fn);
+  call_tmp9 = ((locale)(wrap_call_tmp3));
+  coerce_tmp = call_tmp9;
+  chpl_check_nil(coerce_tmp, INT64(206), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  call_tmp10 = &((coerce_tmp)->parent);
+  chpl_macro_tmp_75.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_75.addr = NULL;
+  *(call_tmp10) = chpl_macro_tmp_75;
+  call_tmp11 = ((locale)(wrap_call_tmp3));
+  coerce_tmp2 = call_tmp11;
+  chpl_check_nil(coerce_tmp2, INT64(207), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  call_tmp12 = &((coerce_tmp2)->numCores);
+  *(call_tmp12) = INT64(0);
+  call_tmp13 = ((locale)(wrap_call_tmp3));
+  coerce_tmp3 = call_tmp13;
+  chpl_check_nil(coerce_tmp3, INT64(208), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  call_tmp14 = &((coerce_tmp3)->maxTaskPar);
+  *(call_tmp14) = INT64(0);
+  return wrap_call_tmp3;
+}
+
+/* LocaleModel.chpl:214 */
+static void init2(chpl____wide_RootLocale* const this6, int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_relaxed;
+  int64_t local_numLocales;
+  chpl____wide_AbstractRootLocale chpl__iter_F0_this = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_AbstractRootLocale call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  localesBarrier b;
+  localesBarrier this7;
+  localesBarrier wrap_call_tmp;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F flags = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F type_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  range_int64_t_boundedLow_F call_tmp2;
+  _ref_range_int64_t_boundedLow_F ret_to_arg_ref_tmp_ = NULL;
+  int64_t call_tmp3;
+  range_int64_t_bounded_F call_tmp4;
+  _ref_range_int64_t_bounded_F ret_to_arg_ref_tmp_2 = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultRectangularDom_1_int64_t_F ret_to_arg_ref_tmp_3 = NULL;
+  chpl___RuntimeTypeInfo3 call_tmp6;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F _runtime_type_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultRectangularArr_localesSignal_1_int64_t_F ret_to_arg_ref_tmp_4 = NULL;
+  chpl___EndCount _coforallCount = NULL;
+  chpl___EndCount this8 = NULL;
+  int64_t call_tmp7;
+  chpl_opaque cast_tmp;
+  chpl___EndCount T = NULL;
+  atomic_int64 _init_class_tmp_;
+  atomic_int64 this9;
+  atomic_int_least64_t ret;
+  atomic_int_least64_t type_tmp2;
+  _ref_atomic_int_least64_t _ref_tmp_ = NULL;
+  _ref_atomic_int_least64_t T2 = NULL;
+  atomic_int64 wrap_call_tmp2;
+  chpl_task_list_p ret2;
+  chpl___EndCount wrap_call_tmp3 = NULL;
+  range_int64_t_boundedLow_F call_tmp8;
+  _ref_range_int64_t_boundedLow_F ret_to_arg_ref_tmp_5 = NULL;
+  range_int64_t_bounded_F call_tmp9;
+  _ref_range_int64_t_bounded_F ret_to_arg_ref_tmp_6 = NULL;
+  range_int64_t_bounded_F _ic__F0_this;
+  _ref_range_int64_t_bounded_F this10 = NULL;
+  int64_t i;
+  int64_t ret3;
+  int64_t end;
+  int64_t ret4;
+  _ref_int64_t call_tmp10 = NULL;
+  int32_t call_tmp11;
+  chpl_localeID_t call_tmp12;
+  _ref_chpl_localeID_t ret_to_arg_ref_tmp_7 = NULL;
+  chpl_localeID_t call_tmp13;
+  chpl___EndCount rvfDerefTmp = NULL;
+  _ir_initOnLocales_AbstractRootLocale rvfDerefTmp2;
+  _class_localson_fn36 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__EndCount T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__EndCount delete_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 _field_destructor_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int_least64_t call_tmp14 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_int_least64_t T4 = NULL;
+  chpl_localeID_t call_tmp15;
+  chpl____wide__EndCount rvfDerefTmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn19 _args_foron_fn2 = NULL;
+  int64_t _args_size2;
+  chpl_opaque _args_alloc2;
+  chpl____wide_locale call_tmp16 = {CHPL_LOCALEID_T_INIT, NULL};
+  int32_t call_tmp17;
+  chpl_localeID_t call_tmp18;
+  _ref_chpl_localeID_t ret_to_arg_ref_tmp_8 = NULL;
+  chpl_localeID_t call_tmp19;
+  chpl____wide_locale call_tmp20 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 call_tmp21 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp22;
+  _class_localson_fn4 _args_foron_fn3 = NULL;
+  int64_t _args_size3;
+  chpl_opaque _args_alloc3;
+  chpl____wide_AbstractRootLocale chpl_macro_tmp_76;
+  chpl____wide__EndCount chpl_macro_tmp_77;
+  chpl____wide__EndCount chpl_macro_tmp_78;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_79;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_80;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_81;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_82;
+  local_memory_order_relaxed = memory_order_relaxed;
+  local_numLocales = numLocales;
+  chpl_macro_tmp_76.locale = (this6)->locale;
+  chpl_macro_tmp_76.addr = ((AbstractRootLocale)((this6)->addr));
+  call_tmp = chpl_macro_tmp_76;
+  chpl__iter_F0_this = call_tmp;
+  wrap_call_tmp = _construct_localesBarrier(&this7);
+  b = wrap_call_tmp;
+  ret_to_arg_ref_tmp_ = &call_tmp2;
+  _build_range2(INT64(1), ret_to_arg_ref_tmp_, _ln, _fn);
+  call_tmp3 = (local_numLocales - INT64(1));
+  ret_to_arg_ref_tmp_2 = &call_tmp4;
+  chpl___POUND_(&call_tmp2, call_tmp3, ret_to_arg_ref_tmp_2, _ln, _fn);
+  ret_to_arg_ref_tmp_3 = &call_tmp5;
+  chpl__ensureDomainExpr2(&call_tmp4, ret_to_arg_ref_tmp_3, _ln, _fn);
+  call_tmp6 = chpl__buildArrayRuntimeType2(&call_tmp5, _ln, _fn);
+  _runtime_type_tmp_ = (&call_tmp6)->dom;
+  ret_to_arg_ref_tmp_4 = &type_tmp;
+  chpl__convertRuntimeTypeToValue3(&_runtime_type_tmp_, ret_to_arg_ref_tmp_4, _ln, _fn);
+  flags = type_tmp;
+  chpl__autoDestroy2(&call_tmp5, _ln, _fn);
+  call_tmp7 = sizeof(chpl_chpl___EndCount_object);
+  cast_tmp = chpl_here_alloc(call_tmp7, INT16(15), _ln, _fn);
+  T = ((chpl___EndCount)(cast_tmp));
+  this8 = T;
+  ((object)(this8))->chpl__cid = chpl__cid_chpl___EndCount;
+  chpl_check_nil(this8, INT64(215), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (this8)->i = _init_class_tmp_;
+  chpl_check_nil(this8, INT64(215), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (this8)->taskCnt = INT64(0);
+  chpl_check_nil(this8, INT64(215), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (this8)->taskList = NULL;
+  chpl_check_nil(this8, INT64(215), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (this8)->numDeferred = INT64(0);
+  ret = type_tmp2;
+  _ref_tmp_ = &ret;
+  T2 = _ref_tmp_;
+  atomic_init_int_least64_t(T2, INT64(0));
+  _ref_tmp_ = T2;
+  (&this9)->_v = ret;
+  wrap_call_tmp2 = _construct_atomic_int64(ret, &this9, _ln, _fn);
+  chpl_check_nil(this8, INT64(215), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (this8)->i = wrap_call_tmp2;
+  chpl_check_nil(this8, INT64(215), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (this8)->taskCnt = INT64(0);
+  ret2 = NULL;
+  chpl_check_nil(this8, INT64(215), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (this8)->taskList = ret2;
+  chpl_check_nil(this8, INT64(215), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (this8)->numDeferred = INT64(0);
+  wrap_call_tmp3 = _construct__EndCount(&wrap_call_tmp2, INT64(0), ret2, INT64(0), this8, _ln, _fn);
+  _coforallCount = wrap_call_tmp3;
+  ret_to_arg_ref_tmp_5 = &call_tmp8;
+  _build_range2(INT64(0), ret_to_arg_ref_tmp_5, _ln, _fn);
+  ret_to_arg_ref_tmp_6 = &call_tmp9;
+  chpl___POUND_(&call_tmp8, local_numLocales, ret_to_arg_ref_tmp_6, _ln, _fn);
+  _ic__F0_this = call_tmp9;
+  this10 = &_ic__F0_this;
+  checkIfIterWillOverflow(this10, true, _ln, _fn);
+  ret3 = (&_ic__F0_this)->_low;
+  ret4 = (&_ic__F0_this)->_high;
+  end = ret4;
+  rvfDerefTmp = _coforallCount;
+  for (i = ret3; ((i <= end)); i += INT64(1)) {
+    chpl_check_nil(_coforallCount, INT64(215), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+    call_tmp10 = &((_coforallCount)->numDeferred);
+    *(call_tmp10) += INT64(1);
+    call_tmp11 = ((int32_t)(i));
+    ret_to_arg_ref_tmp_7 = &call_tmp12;
+    chpl_buildLocaleID(call_tmp11, c_sublocid_any, ret_to_arg_ref_tmp_7, _ln, _fn);
+    call_tmp13 = call_tmp12;
+    (&rvfDerefTmp2)->F0_this = chpl__iter_F0_this;
+    _args_size = sizeof(chpl__class_localson_fn36_object);
+    _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn = ((_class_localson_fn36)(_args_alloc));
+    chpl_check_nil(_args_foron_fn, INT64(215), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+    (_args_foron_fn)->_0_call_tmp = call_tmp13;
+    chpl_check_nil(_args_foron_fn, INT64(215), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+    (_args_foron_fn)->_1__yieldedIndex = i;
+    chpl_check_nil(_args_foron_fn, INT64(215), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+    (_args_foron_fn)->_2_b = b;
+    chpl_check_nil(_args_foron_fn, INT64(215), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+    (_args_foron_fn)->_3_flags = flags;
+    chpl_macro_tmp_77.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_77.addr = rvfDerefTmp;
+    T3 = chpl_macro_tmp_77;
+    chpl_check_nil(_args_foron_fn, INT64(215), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+    (_args_foron_fn)->_4_rvfDerefTmp = T3;
+    chpl_check_nil(_args_foron_fn, INT64(215), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+    (_args_foron_fn)->_5_rvfDerefTmp = rvfDerefTmp2;
+    chpl_check_nil(_args_foron_fn, INT64(215), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+    (_args_foron_fn)->_6_this = *(this6);
+    (_args_foron_fn)->_ln = _ln;
+    (_args_foron_fn)->_fn = _fn;
+    /*** wrapon_fn36 ***/ chpl_executeOnNB(&call_tmp13, INT32(39), _args_foron_fn, sizeof(chpl__class_localson_fn36_object), INT64(215), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  }
+  _upEndCountFlush(_coforallCount, _ln, _fn);
+  _waitEndCount(_coforallCount, _ln, _fn);
+  chpl_macro_tmp_78.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_78.addr = _coforallCount;
+  delete_tmp = chpl_macro_tmp_78;
+  chpl_check_nil((&delete_tmp)->addr, INT64(215), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_79.locale = (&delete_tmp)->locale;
+  chpl_macro_tmp_79.addr = &(((&delete_tmp)->addr)->i);
+  _field_destructor_tmp_ = chpl_macro_tmp_79;
+  chpl_macro_tmp_80.locale = (_field_destructor_tmp_).locale;
+  chpl_macro_tmp_80.addr = &(((_field_destructor_tmp_).addr)->_v);
+  call_tmp14 = chpl_macro_tmp_80;
+  T4 = (&call_tmp14)->addr;
+  atomic_destroy_int_least64_t(T4);
+  chpl_macro_tmp_81.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_81.addr = T4;
+  call_tmp14 = chpl_macro_tmp_81;
+  call_tmp15 = (&delete_tmp)->locale;
+  rvfDerefTmp3 = delete_tmp;
+  _args_size2 = sizeof(chpl__class_localson_fn19_object);
+  _args_alloc2 = chpl_mem_allocPooled(_args_size2, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn2 = ((_class_localson_fn19)(_args_alloc2));
+  chpl_check_nil(_args_foron_fn2, INT64(215), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (_args_foron_fn2)->_0__tmp = call_tmp15;
+  chpl_check_nil(_args_foron_fn2, INT64(215), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (_args_foron_fn2)->_1_rvfDerefTmp = rvfDerefTmp3;
+  (_args_foron_fn2)->_ln = _ln;
+  (_args_foron_fn2)->_fn = _fn;
+  /*** wrapon_fn19 ***/ chpl_executeOn(&call_tmp15, INT32(20), _args_foron_fn2, sizeof(chpl__class_localson_fn19_object), INT64(796), "/root/repo/modules/internal/ChapelBase.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn2)), _ln, _fn);
+  chpl__autoDestroy4(&flags, _ln, _fn);
+  call_tmp17 = chpl_task_getRequestedSubloc();
+  ret_to_arg_ref_tmp_8 = &call_tmp18;
+  chpl_buildLocaleID(chpl_nodeID, call_tmp17, ret_to_arg_ref_tmp_8, _ln, _fn);
+  call_tmp19 = chpl__initCopy_chpl_rt_localeID_t(call_tmp18);
+  call_tmp20 = chpl_localeID_to_locale(&call_tmp19, _ln, _fn);
+  call_tmp16 = call_tmp20;
+  chpl_check_nil((&call_tmp16)->addr, INT64(222), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_82.locale = (&call_tmp16)->locale;
+  chpl_macro_tmp_82.addr = &(((&call_tmp16)->addr)->runningTaskCounter);
+  call_tmp21 = chpl_macro_tmp_82;
+  call_tmp22 = (&call_tmp21)->locale;
+  _args_size3 = sizeof(chpl__class_localson_fn4_object);
+  _args_alloc3 = chpl_mem_allocPooled(_args_size3, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn3 = ((_class_localson_fn4)(_args_alloc3));
+  chpl_check_nil(_args_foron_fn3, INT64(222), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (_args_foron_fn3)->_0__tmp = call_tmp22;
+  chpl_check_nil(_args_foron_fn3, INT64(222), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (_args_foron_fn3)->_1_this = call_tmp21;
+  chpl_check_nil(_args_foron_fn3, INT64(222), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (_args_foron_fn3)->_2_value = INT64(0);
+  chpl_check_nil(_args_foron_fn3, INT64(222), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  (_args_foron_fn3)->_3_order = local_memory_order_relaxed;
+  (_args_foron_fn3)->_ln = _ln;
+  (_args_foron_fn3)->_fn = _fn;
+  /*** wrapon_fn4 ***/ chpl_executeOn(&call_tmp22, INT32(5), _args_foron_fn3, sizeof(chpl__class_localson_fn4_object), INT64(1077), "/root/repo/modules/internal/Atomics.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn3)), _ln, _fn);
+  return;
+}
+
+/* LocaleModel.chpl:215 */
+static void wrapon_fn36(_class_localson_fn36 c) {
+  int64_t _ln;
+  c_string _fn;
+  int64_t _1__yieldedIndex;
+  localesBarrier _2_b;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F _3_flags = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__EndCount _4_rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ir_initOnLocales_AbstractRootLocale _5_rvfDerefTmp;
+  chpl____wide_RootLocale _6_this = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(215), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  _1__yieldedIndex = (c)->_1__yieldedIndex;
+  chpl_check_nil(c, INT64(215), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  _2_b = (c)->_2_b;
+  chpl_check_nil(c, INT64(215), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  _3_flags = (c)->_3_flags;
+  chpl_check_nil(c, INT64(215), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  _4_rvfDerefTmp = (c)->_4_rvfDerefTmp;
+  chpl_check_nil(c, INT64(215), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  _5_rvfDerefTmp = (c)->_5_rvfDerefTmp;
+  chpl_check_nil(c, INT64(215), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  _6_this = (c)->_6_this;
+  on_fn36(_1__yieldedIndex, &_2_b, &_3_flags, &_4_rvfDerefTmp, &_5_rvfDerefTmp, &_6_this, _ln, _fn);
+  return;
+}
+
+/* ChapelLocale.chpl:224 */
+static void on_fn36(int64_t locIdx, localesBarrier* const b, chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const flags, chpl____wide__EndCount* const _coforallCount, _ir_initOnLocales_AbstractRootLocale* const chpl__iter, chpl____wide_RootLocale* const this6, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultDist ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp2;
+  DefaultDist this7 = NULL;
+  int64_t call_tmp3;
+  chpl_opaque cast_tmp;
+  DefaultDist T = NULL;
+  atomic_refcnt this8;
+  atomic_int64 _init_class_tmp_;
+  atomic_int64 this9;
+  atomic_int_least64_t ret2;
+  atomic_int_least64_t type_tmp;
+  _ref_atomic_int_least64_t _ref_tmp_ = NULL;
+  _ref_atomic_int_least64_t T2 = NULL;
+  atomic_int64 wrap_call_tmp;
+  atomic_refcnt wrap_call_tmp2;
+  list_BaseDom this10;
+  listNode_BaseDom T3 = NULL;
+  chpl____wide_listNode_BaseDom T4 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseDom T5 = NULL;
+  chpl____wide_listNode_BaseDom T6 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseDom call_tmp4 = NULL;
+  listNode_BaseDom T7 = NULL;
+  chpl____wide_listNode_BaseDom T8 = {CHPL_LOCALEID_T_INIT, NULL};
+  listNode_BaseDom call_tmp5 = NULL;
+  listNode_BaseDom T9 = NULL;
+  chpl____wide_listNode_BaseDom T10 = {CHPL_LOCALEID_T_INIT, NULL};
+  list_BaseDom wrap_call_tmp3;
+  atomicflag this11;
+  atomic_flag ret3;
+  atomic_flag type_tmp2;
+  _ref_atomic_flag _ref_tmp_2 = NULL;
+  _ref_atomic_flag T11 = NULL;
+  atomicflag wrap_call_tmp4;
+  DefaultDist wrap_call_tmp5 = NULL;
+  chpl____wide_DefaultDist call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_DefaultDist ret_to_arg_ref_tmp_ = NULL;
+  LocaleModel const_tmp = NULL;
+  LocaleModel node = NULL;
+  chpl____wide_locale call_tmp7 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F call_tmp8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F coerce_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _tuple_1_star_int64_t i;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F call_tmp9 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F ret4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F coerce_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool ret6;
+  chpl____wide__ref_range_int64_t_bounded_F call_tmp10 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F call_tmp11 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t coerce_tmp3;
+  chpl_bool ret7;
+  int64_t ret8;
+  chpl_bool call_tmp12;
+  int64_t ret9;
+  chpl_bool call_tmp13;
+  chpl_bool call_tmp14;
+  chpl_bool call_tmp15;
+  chpl____wide_chpl_string call_tmp16 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t sum;
+  int64_t ret_x1;
+  chpl____wide__ref__tuple_1_star_int64_t ret_ = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t coerce_tmp4;
+  int64_t call_tmp17;
+  chpl____wide__ddata_locale ret10 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_locale coerce_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_locale call_tmp18 = {CHPL_LOCALEID_T_INIT, NULL};
+  locale call_tmp19 = NULL;
+  chpl____wide_locale T12 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_locale coerce_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_locale call_tmp20 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_int64_t call_tmp21 = {CHPL_LOCALEID_T_INIT, NULL};
+  locale coerce_tmp7 = NULL;
+  locale call_tmp22 = NULL;
+  int64_t ret11;
+  chpl____wide_locale coerce_tmp8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_locale call_tmp23 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_int64_t call_tmp24 = {CHPL_LOCALEID_T_INIT, NULL};
+  locale coerce_tmp9 = NULL;
+  locale call_tmp25 = NULL;
+  int64_t ret12;
+  _ref_localesBarrier _ref_tmp_3 = NULL;
+  chpl____wide_object chpl_macro_tmp_83;
+  chpl____wide_listNode_BaseDom chpl_macro_tmp_84;
+  chpl____wide_listNode_BaseDom chpl_macro_tmp_85;
+  chpl____wide_listNode_BaseDom chpl_macro_tmp_86;
+  chpl____wide_listNode_BaseDom chpl_macro_tmp_87;
+  chpl____wide_locale chpl_macro_tmp_88;
+  chpl____wide__ref_DefaultRectangularArr_locale_1_int64_t_F chpl_macro_tmp_89;
+  chpl____wide__ref_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_90;
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F chpl_macro_tmp_91;
+  chpl____wide__ref_range_int64_t_bounded_F chpl_macro_tmp_92;
+  chpl____wide__ref_int64_t chpl_macro_tmp_93;
+  chpl____wide__ref_int64_t chpl_macro_tmp_94;
+  chpl____wide__ref__tuple_1_star_int64_t chpl_macro_tmp_95;
+  chpl____wide__ref_int64_t chpl_macro_tmp_96;
+  chpl____wide__ref__ddata_locale chpl_macro_tmp_97;
+  chpl____wide__ref_locale chpl_macro_tmp_98;
+  chpl____wide_locale chpl_macro_tmp_99;
+  chpl____wide_locale chpl_macro_tmp_100;
+  chpl____wide__ref_int64_t chpl_macro_tmp_101;
+  int64_t chpl_macro_tmp_102;
+  chpl____wide_locale chpl_macro_tmp_103;
+  chpl____wide__ref_int64_t chpl_macro_tmp_104;
+  int64_t chpl_macro_tmp_105;
+  ret = defaultDist;
+  chpl_macro_tmp_83.locale = (&ret)->locale;
+  chpl_macro_tmp_83.addr = ((object)((&ret)->addr));
+  call_tmp = chpl_macro_tmp_83;
+  call_tmp2 = (&call_tmp)->addr == nil;
+  if (call_tmp2) {
+    call_tmp3 = sizeof(chpl_DefaultDist_object);
+    cast_tmp = chpl_here_alloc(call_tmp3, INT16(4), _ln, _fn);
+    T = ((DefaultDist)(cast_tmp));
+    this7 = T;
+    ((object)(this7))->chpl__cid = chpl__cid_DefaultDist;
+    (&this8)->_cnt = _init_class_tmp_;
+    ret2 = type_tmp;
+    _ref_tmp_ = &ret2;
+    T2 = _ref_tmp_;
+    atomic_init_int_least64_t(T2, INT64(0));
+    _ref_tmp_ = T2;
+    (&this9)->_v = ret2;
+    wrap_call_tmp = _construct_atomic_int64(ret2, &this9, _ln, _fn);
+    (&this8)->_cnt = wrap_call_tmp;
+    wrap_call_tmp2 = _construct_atomic_refcnt(&wrap_call_tmp, &this8, _ln, _fn);
+    T3 = nil;
+    chpl_macro_tmp_84.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_84.addr = T3;
+    T4 = chpl_macro_tmp_84;
+    (&this10)->first = T4;
+    T5 = nil;
+    chpl_macro_tmp_85.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_85.addr = T5;
+    T6 = chpl_macro_tmp_85;
+    (&this10)->last = T6;
+    (&this10)->length = INT64(0);
+    T7 = ((listNode_BaseDom)(nil));
+    call_tmp4 = T7;
+    chpl_macro_tmp_86.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_86.addr = call_tmp4;
+    T8 = chpl_macro_tmp_86;
+    (&this10)->first = T8;
+    T9 = ((listNode_BaseDom)(nil));
+    call_tmp5 = T9;
+    chpl_macro_tmp_87.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_87.addr = call_tmp5;
+    T10 = chpl_macro_tmp_87;
+    (&this10)->last = T10;
+    (&this10)->length = INT64(0);
+    wrap_call_tmp3 = _construct_list2(call_tmp4, call_tmp5, INT64(0), &this10, _ln, _fn);
+    ret3 = type_tmp2;
+    _ref_tmp_2 = &ret3;
+    T11 = _ref_tmp_2;
+    atomic_init_flag(T11, false);
+    _ref_tmp_2 = T11;
+    (&this11)->_v = ret3;
+    wrap_call_tmp4 = _construct_atomicflag(ret3, &this11, _ln, _fn);
+    wrap_call_tmp5 = _construct_DefaultDist(&wrap_call_tmp2, &wrap_call_tmp3, &wrap_call_tmp4, this7, _ln, _fn);
+    ret_to_arg_ref_tmp_ = &call_tmp6;
+    chpl__buildDistValue2(wrap_call_tmp5, ret_to_arg_ref_tmp_, _ln, _fn);
+    chpl___ASSIGN_(&defaultDist, &call_tmp6, _ln, _fn);
+    chpl__autoDestroy(&call_tmp6, _ln, _fn);
+  }
+  chpl_macro_tmp_88.locale = (this6)->locale;
+  chpl_macro_tmp_88.addr = ((locale)((this6)->addr));
+  call_tmp7 = chpl_macro_tmp_88;
+  const_tmp = LocaleModel2(&call_tmp7, _ln, _fn);
+  node = const_tmp;
+  chpl_check_nil((this6)->addr, INT64(217), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_89.locale = (this6)->locale;
+  chpl_macro_tmp_89.addr = &(((this6)->addr)->myLocales);
+  chpl_gen_comm_get(((void*)(&call_tmp8)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_89).locale), INT64(0), NULL), (chpl_macro_tmp_89).addr, sizeof(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F), -1, INT64(1), INT64(217), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  coerce_tmp = call_tmp8;
+  *(i + INT64(0)) = locIdx;
+  ret4 = coerce_tmp;
+  call_tmp9 = ret4;
+  chpl_check_nil((&call_tmp9)->addr, INT64(217), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_90.locale = (&call_tmp9)->locale;
+  chpl_macro_tmp_90.addr = &(((&call_tmp9)->addr)->dom);
+  chpl_gen_comm_get(((void*)(&ret5)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_90).locale), INT64(0), NULL), (chpl_macro_tmp_90).addr, sizeof(chpl____wide_DefaultRectangularDom_1_int64_t_F), -1, INT64(1), INT64(217), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  coerce_tmp2 = ret5;
+  chpl_check_nil((&coerce_tmp2)->addr, INT64(217), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_91.locale = (&coerce_tmp2)->locale;
+  chpl_macro_tmp_91.addr = &(((&coerce_tmp2)->addr)->ranges);
+  call_tmp11 = chpl_macro_tmp_91;
+  chpl_macro_tmp_92.locale = (call_tmp11).locale;
+  chpl_macro_tmp_92.addr = (*((call_tmp11).addr) + INT64(0));
+  call_tmp10 = chpl_macro_tmp_92;
+  coerce_tmp3 = *(i + INT64(0));
+  chpl_macro_tmp_93.locale = (call_tmp10).locale;
+  chpl_macro_tmp_93.addr = &(((call_tmp10).addr)->_high);
+  chpl_gen_comm_get(((void*)(&ret8)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_93).locale), INT64(0), NULL), (chpl_macro_tmp_93).addr, sizeof(int64_t), -1, INT64(1), INT64(217), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  call_tmp12 = (coerce_tmp3 > ret8);
+  if (call_tmp12) {
+    ret7 = false;
+    goto _end_member;
+  }
+  chpl_macro_tmp_94.locale = (call_tmp10).locale;
+  chpl_macro_tmp_94.addr = &(((call_tmp10).addr)->_low);
+  chpl_gen_comm_get(((void*)(&ret9)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_94).locale), INT64(0), NULL), (chpl_macro_tmp_94).addr, sizeof(int64_t), -1, INT64(1), INT64(217), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  call_tmp13 = (coerce_tmp3 < ret9);
+  if (call_tmp13) {
+    ret7 = false;
+    goto _end_member;
+  }
+  ret7 = true;
+  _end_member:;
+  call_tmp14 = (! ret7);
+  if (call_tmp14) {
+    ret6 = false;
+    goto _end_dsiMember;
+  }
+  ret6 = true;
+  _end_dsiMember:;
+  call_tmp15 = (! ret6);
+  if (call_tmp15) {
+    wide_string_from_c_string(&call_tmp16, "array index out of bounds: ", INT64(0), INT64(0), _ln, _fn);
+    halt2(call_tmp16, &i, _ln, _fn);
+  }
+  sum = INT64(0);
+  chpl_check_nil((&call_tmp9)->addr, INT64(217), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_95.locale = (&call_tmp9)->locale;
+  chpl_macro_tmp_95.addr = &(((&call_tmp9)->addr)->blk);
+  ret_ = chpl_macro_tmp_95;
+  chpl_macro_tmp_96.locale = (ret_).locale;
+  chpl_macro_tmp_96.addr = (*((ret_).addr) + INT64(0));
+  chpl_gen_comm_get(((void*)(&ret_x1)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_96).locale), INT64(0), NULL), (chpl_macro_tmp_96).addr, sizeof(int64_t), -1, INT64(1), INT64(217), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  coerce_tmp4 = *(i + INT64(0));
+  call_tmp17 = (coerce_tmp4 * ret_x1);
+  sum += call_tmp17;
+  chpl_check_nil((&call_tmp9)->addr, INT64(217), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_97.locale = (&call_tmp9)->locale;
+  chpl_macro_tmp_97.addr = &(((&call_tmp9)->addr)->shiftedData);
+  chpl_gen_comm_get(((void*)(&ret10)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_97).locale), INT64(0), NULL), (chpl_macro_tmp_97).addr, sizeof(chpl____wide__ddata_locale), -1, INT64(1), INT64(217), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  coerce_tmp5 = ret10;
+  chpl_macro_tmp_98.locale = (&coerce_tmp5)->locale;
+  chpl_macro_tmp_98.addr = ((&coerce_tmp5)->addr + sum);
+  call_tmp18 = chpl_macro_tmp_98;
+  call_tmp19 = ((locale)(node));
+  chpl_macro_tmp_99.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_99.addr = call_tmp19;
+  T12 = chpl_macro_tmp_99;
+  chpl_gen_comm_put(((void*)(&T12)), chpl_nodeFromLocaleID(&((call_tmp18).locale), INT64(0), NULL), (call_tmp18).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(217), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_100.locale = (this6)->locale;
+  chpl_macro_tmp_100.addr = ((locale)((this6)->addr));
+  call_tmp20 = chpl_macro_tmp_100;
+  coerce_tmp6 = call_tmp20;
+  chpl_check_nil((&coerce_tmp6)->addr, INT64(218), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_101.locale = (&coerce_tmp6)->locale;
+  chpl_macro_tmp_101.addr = &(((&coerce_tmp6)->addr)->numCores);
+  call_tmp21 = chpl_macro_tmp_101;
+  call_tmp22 = ((locale)(node));
+  coerce_tmp7 = call_tmp22;
+  chpl_check_nil(coerce_tmp7, INT64(218), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  ret11 = (coerce_tmp7)->numCores;
+  chpl_gen_comm_get(((void*)(&chpl_macro_tmp_102)), chpl_nodeFromLocaleID(&((call_tmp21).locale), INT64(0), NULL), (call_tmp21).addr, sizeof(int64_t), -1, INT64(1), INT64(218), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_102 += ret11;
+  chpl_gen_comm_put(((void*)(&chpl_macro_tmp_102)), chpl_nodeFromLocaleID(&((call_tmp21).locale), INT64(0), NULL), (call_tmp21).addr, sizeof(int64_t), -1, INT64(1), INT64(218), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_103.locale = (this6)->locale;
+  chpl_macro_tmp_103.addr = ((locale)((this6)->addr));
+  call_tmp23 = chpl_macro_tmp_103;
+  coerce_tmp8 = call_tmp23;
+  chpl_check_nil((&coerce_tmp8)->addr, INT64(219), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_104.locale = (&coerce_tmp8)->locale;
+  chpl_macro_tmp_104.addr = &(((&coerce_tmp8)->addr)->maxTaskPar);
+  call_tmp24 = chpl_macro_tmp_104;
+  call_tmp25 = ((locale)(node));
+  coerce_tmp9 = call_tmp25;
+  chpl_check_nil(coerce_tmp9, INT64(219), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  ret12 = (coerce_tmp9)->maxTaskPar;
+  chpl_gen_comm_get(((void*)(&chpl_macro_tmp_105)), chpl_nodeFromLocaleID(&((call_tmp24).locale), INT64(0), NULL), (call_tmp24).addr, sizeof(int64_t), -1, INT64(1), INT64(219), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_105 += ret12;
+  chpl_gen_comm_put(((void*)(&chpl_macro_tmp_105)), chpl_nodeFromLocaleID(&((call_tmp24).locale), INT64(0), NULL), (call_tmp24).addr, sizeof(int64_t), -1, INT64(1), INT64(219), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  _ref_tmp_3 = b;
+  chpl_check_nil(_ref_tmp_3, INT64(229), "/root/repo/modules/internal/ChapelLocale.chpl");
+  wait5(_ref_tmp_3, locIdx, flags, _ln, _fn);
+  chpl_rootLocaleInitPrivate(locIdx, _ln, _fn);
+  _downEndCount(_coforallCount, _ln, _fn);
+  return;
+}
+
+/* LocaleModel.chpl:229 */
+static int64_t chpl_id3(chpl____wide_RootLocale* const this6, int64_t _ln, c_string _fn) {
+  int64_t local_numLocales;
+  int64_t ret;
+  local_numLocales = numLocales;
+  ret = local_numLocales;
+  return ret;
+}
+
+/* LocaleModel.chpl:250 */
+static chpl____wide_locale getChild3(chpl____wide_RootLocale* const this6, int64_t idx, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F coerce_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _tuple_1_star_int64_t i;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F coerce_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool ret3;
+  chpl____wide__ref_range_int64_t_bounded_F call_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t coerce_tmp3;
+  chpl_bool ret4;
+  int64_t ret5;
+  chpl_bool call_tmp5;
+  int64_t ret6;
+  chpl_bool call_tmp6;
+  chpl_bool call_tmp7;
+  chpl_bool call_tmp8;
+  chpl____wide_chpl_string call_tmp9 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t sum;
+  int64_t ret_x1;
+  chpl____wide__ref__tuple_1_star_int64_t ret_ = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t coerce_tmp4;
+  int64_t call_tmp10;
+  chpl____wide__ddata_locale ret7 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_locale coerce_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_locale ret8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_locale call_tmp11 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_DefaultRectangularArr_locale_1_int64_t_F chpl_macro_tmp_106;
+  chpl____wide__ref_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_107;
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F chpl_macro_tmp_108;
+  chpl____wide__ref_range_int64_t_bounded_F chpl_macro_tmp_109;
+  chpl____wide__ref_int64_t chpl_macro_tmp_110;
+  chpl____wide__ref_int64_t chpl_macro_tmp_111;
+  chpl____wide__ref__tuple_1_star_int64_t chpl_macro_tmp_112;
+  chpl____wide__ref_int64_t chpl_macro_tmp_113;
+  chpl____wide__ref__ddata_locale chpl_macro_tmp_114;
+  chpl____wide__ref_locale chpl_macro_tmp_115;
+  chpl_check_nil((this6)->addr, INT64(250), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_106.locale = (this6)->locale;
+  chpl_macro_tmp_106.addr = &(((this6)->addr)->myLocales);
+  chpl_gen_comm_get(((void*)(&call_tmp)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_106).locale), INT64(0), NULL), (chpl_macro_tmp_106).addr, sizeof(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F), -1, INT64(1), INT64(250), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  coerce_tmp = call_tmp;
+  *(i + INT64(0)) = idx;
+  ret = coerce_tmp;
+  call_tmp2 = ret;
+  chpl_check_nil((&call_tmp2)->addr, INT64(250), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_107.locale = (&call_tmp2)->locale;
+  chpl_macro_tmp_107.addr = &(((&call_tmp2)->addr)->dom);
+  chpl_gen_comm_get(((void*)(&ret2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_107).locale), INT64(0), NULL), (chpl_macro_tmp_107).addr, sizeof(chpl____wide_DefaultRectangularDom_1_int64_t_F), -1, INT64(1), INT64(250), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  coerce_tmp2 = ret2;
+  chpl_check_nil((&coerce_tmp2)->addr, INT64(250), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_108.locale = (&coerce_tmp2)->locale;
+  chpl_macro_tmp_108.addr = &(((&coerce_tmp2)->addr)->ranges);
+  call_tmp4 = chpl_macro_tmp_108;
+  chpl_macro_tmp_109.locale = (call_tmp4).locale;
+  chpl_macro_tmp_109.addr = (*((call_tmp4).addr) + INT64(0));
+  call_tmp3 = chpl_macro_tmp_109;
+  coerce_tmp3 = *(i + INT64(0));
+  chpl_macro_tmp_110.locale = (call_tmp3).locale;
+  chpl_macro_tmp_110.addr = &(((call_tmp3).addr)->_high);
+  chpl_gen_comm_get(((void*)(&ret5)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_110).locale), INT64(0), NULL), (chpl_macro_tmp_110).addr, sizeof(int64_t), -1, INT64(1), INT64(250), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  call_tmp5 = (coerce_tmp3 > ret5);
+  if (call_tmp5) {
+    ret4 = false;
+    goto _end_member;
+  }
+  chpl_macro_tmp_111.locale = (call_tmp3).locale;
+  chpl_macro_tmp_111.addr = &(((call_tmp3).addr)->_low);
+  chpl_gen_comm_get(((void*)(&ret6)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_111).locale), INT64(0), NULL), (chpl_macro_tmp_111).addr, sizeof(int64_t), -1, INT64(1), INT64(250), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  call_tmp6 = (coerce_tmp3 < ret6);
+  if (call_tmp6) {
+    ret4 = false;
+    goto _end_member;
+  }
+  ret4 = true;
+  _end_member:;
+  call_tmp7 = (! ret4);
+  if (call_tmp7) {
+    ret3 = false;
+    goto _end_dsiMember;
+  }
+  ret3 = true;
+  _end_dsiMember:;
+  call_tmp8 = (! ret3);
+  if (call_tmp8) {
+    wide_string_from_c_string(&call_tmp9, "array index out of bounds: ", INT64(0), INT64(0), _ln, _fn);
+    halt2(call_tmp9, &i, _ln, _fn);
+  }
+  sum = INT64(0);
+  chpl_check_nil((&call_tmp2)->addr, INT64(250), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_112.locale = (&call_tmp2)->locale;
+  chpl_macro_tmp_112.addr = &(((&call_tmp2)->addr)->blk);
+  ret_ = chpl_macro_tmp_112;
+  chpl_macro_tmp_113.locale = (ret_).locale;
+  chpl_macro_tmp_113.addr = (*((ret_).addr) + INT64(0));
+  chpl_gen_comm_get(((void*)(&ret_x1)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_113).locale), INT64(0), NULL), (chpl_macro_tmp_113).addr, sizeof(int64_t), -1, INT64(1), INT64(250), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  coerce_tmp4 = *(i + INT64(0));
+  call_tmp10 = (coerce_tmp4 * ret_x1);
+  sum += call_tmp10;
+  chpl_check_nil((&call_tmp2)->addr, INT64(250), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_114.locale = (&call_tmp2)->locale;
+  chpl_macro_tmp_114.addr = &(((&call_tmp2)->addr)->shiftedData);
+  chpl_gen_comm_get(((void*)(&ret7)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_114).locale), INT64(0), NULL), (chpl_macro_tmp_114).addr, sizeof(chpl____wide__ddata_locale), -1, INT64(1), INT64(250), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  coerce_tmp5 = ret7;
+  chpl_macro_tmp_115.locale = (&coerce_tmp5)->locale;
+  chpl_macro_tmp_115.addr = ((&coerce_tmp5)->addr + sum);
+  call_tmp11 = chpl_macro_tmp_115;
+  chpl_gen_comm_get(((void*)(&ret8)), chpl_nodeFromLocaleID(&((call_tmp11).locale), INT64(0), NULL), (call_tmp11).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(250), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  return ret8;
+}
+
+/* LocaleModel.chpl:258 */
+static void getDefaultLocaleArray2(chpl____wide_RootLocale* const this6, _ref_DefaultRectangularArr_locale_1_int64_t_F _retArg, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_DefaultRectangularArr_locale_1_int64_t_F chpl_macro_tmp_116;
+  chpl_check_nil((this6)->addr, INT64(258), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_116.locale = (this6)->locale;
+  chpl_macro_tmp_116.addr = &(((this6)->addr)->myLocales);
+  chpl_gen_comm_get(((void*)(&call_tmp)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_116).locale), INT64(0), NULL), (chpl_macro_tmp_116).addr, sizeof(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F), -1, INT64(1), INT64(258), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  *(_retArg) = chpl__autoCopy3(&call_tmp, _ln, _fn);
+  return;
+}
+
+/* LocaleModel.chpl:258 */
+static chpl____wide_DefaultRectangularArr_locale_1_int64_t_F getDefaultLocaleArray(chpl____wide_RootLocale* const this6, int64_t _ln, c_string _fn) {
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_DefaultRectangularArr_locale_1_int64_t_F chpl_macro_tmp_117;
+  chpl_check_nil((this6)->addr, INT64(258), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_117.locale = (this6)->locale;
+  chpl_macro_tmp_117.addr = &(((this6)->addr)->myLocales);
+  chpl_gen_comm_get(((void*)(&call_tmp)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_117).locale), INT64(0), NULL), (chpl_macro_tmp_117).addr, sizeof(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F), -1, INT64(1), INT64(258), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  return call_tmp;
+}
+
+/* LocaleModel.chpl:260 */
+static chpl____wide_locale localeIDtoLocale2(chpl____wide_RootLocale* const this6, chpl_localeID_t* const id2, int64_t _ln, c_string _fn) {
+  int32_t call_tmp;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F coerce_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp3;
+  _tuple_1_star_int64_t i;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F coerce_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool ret3;
+  chpl____wide__ref_range_int64_t_bounded_F call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t coerce_tmp3;
+  chpl_bool ret4;
+  int64_t ret5;
+  chpl_bool call_tmp7;
+  int64_t ret6;
+  chpl_bool call_tmp8;
+  chpl_bool call_tmp9;
+  chpl_bool call_tmp10;
+  chpl____wide_chpl_string call_tmp11 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t sum;
+  int64_t ret_x1;
+  chpl____wide__ref__tuple_1_star_int64_t ret_ = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t coerce_tmp4;
+  int64_t call_tmp12;
+  chpl____wide__ddata_locale ret7 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ddata_locale coerce_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_locale ret8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_locale call_tmp13 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_DefaultRectangularArr_locale_1_int64_t_F chpl_macro_tmp_118;
+  chpl____wide__ref_DefaultRectangularDom_1_int64_t_F chpl_macro_tmp_119;
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F chpl_macro_tmp_120;
+  chpl____wide__ref_range_int64_t_bounded_F chpl_macro_tmp_121;
+  chpl____wide__ref_int64_t chpl_macro_tmp_122;
+  chpl____wide__ref_int64_t chpl_macro_tmp_123;
+  chpl____wide__ref__tuple_1_star_int64_t chpl_macro_tmp_124;
+  chpl____wide__ref_int64_t chpl_macro_tmp_125;
+  chpl____wide__ref__ddata_locale chpl_macro_tmp_126;
+  chpl____wide__ref_locale chpl_macro_tmp_127;
+  call_tmp = chpl_rt_nodeFromLocaleID(*(id2));
+  chpl_check_nil((this6)->addr, INT64(265), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_118.locale = (this6)->locale;
+  chpl_macro_tmp_118.addr = &(((this6)->addr)->myLocales);
+  chpl_gen_comm_get(((void*)(&call_tmp2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_118).locale), INT64(0), NULL), (chpl_macro_tmp_118).addr, sizeof(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F), -1, INT64(1), INT64(265), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  coerce_tmp = call_tmp2;
+  call_tmp3 = ((int64_t)(call_tmp));
+  *(i + INT64(0)) = call_tmp3;
+  ret = coerce_tmp;
+  call_tmp4 = ret;
+  chpl_check_nil((&call_tmp4)->addr, INT64(265), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_119.locale = (&call_tmp4)->locale;
+  chpl_macro_tmp_119.addr = &(((&call_tmp4)->addr)->dom);
+  chpl_gen_comm_get(((void*)(&ret2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_119).locale), INT64(0), NULL), (chpl_macro_tmp_119).addr, sizeof(chpl____wide_DefaultRectangularDom_1_int64_t_F), -1, INT64(1), INT64(265), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  coerce_tmp2 = ret2;
+  chpl_check_nil((&coerce_tmp2)->addr, INT64(265), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_120.locale = (&coerce_tmp2)->locale;
+  chpl_macro_tmp_120.addr = &(((&coerce_tmp2)->addr)->ranges);
+  call_tmp6 = chpl_macro_tmp_120;
+  chpl_macro_tmp_121.locale = (call_tmp6).locale;
+  chpl_macro_tmp_121.addr = (*((call_tmp6).addr) + INT64(0));
+  call_tmp5 = chpl_macro_tmp_121;
+  coerce_tmp3 = *(i + INT64(0));
+  chpl_macro_tmp_122.locale = (call_tmp5).locale;
+  chpl_macro_tmp_122.addr = &(((call_tmp5).addr)->_high);
+  chpl_gen_comm_get(((void*)(&ret5)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_122).locale), INT64(0), NULL), (chpl_macro_tmp_122).addr, sizeof(int64_t), -1, INT64(1), INT64(265), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  call_tmp7 = (coerce_tmp3 > ret5);
+  if (call_tmp7) {
+    ret4 = false;
+    goto _end_member;
+  }
+  chpl_macro_tmp_123.locale = (call_tmp5).locale;
+  chpl_macro_tmp_123.addr = &(((call_tmp5).addr)->_low);
+  chpl_gen_comm_get(((void*)(&ret6)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_123).locale), INT64(0), NULL), (chpl_macro_tmp_123).addr, sizeof(int64_t), -1, INT64(1), INT64(265), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  call_tmp8 = (coerce_tmp3 < ret6);
+  if (call_tmp8) {
+    ret4 = false;
+    goto _end_member;
+  }
+  ret4 = true;
+  _end_member:;
+  call_tmp9 = (! ret4);
+  if (call_tmp9) {
+    ret3 = false;
+    goto _end_dsiMember;
+  }
+  ret3 = true;
+  _end_dsiMember:;
+  call_tmp10 = (! ret3);
+  if (call_tmp10) {
+    wide_string_from_c_string(&call_tmp11, "array index out of bounds: ", INT64(0), INT64(0), _ln, _fn);
+    halt2(call_tmp11, &i, _ln, _fn);
+  }
+  sum = INT64(0);
+  chpl_check_nil((&call_tmp4)->addr, INT64(265), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_124.locale = (&call_tmp4)->locale;
+  chpl_macro_tmp_124.addr = &(((&call_tmp4)->addr)->blk);
+  ret_ = chpl_macro_tmp_124;
+  chpl_macro_tmp_125.locale = (ret_).locale;
+  chpl_macro_tmp_125.addr = (*((ret_).addr) + INT64(0));
+  chpl_gen_comm_get(((void*)(&ret_x1)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_125).locale), INT64(0), NULL), (chpl_macro_tmp_125).addr, sizeof(int64_t), -1, INT64(1), INT64(265), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  coerce_tmp4 = *(i + INT64(0));
+  call_tmp12 = (coerce_tmp4 * ret_x1);
+  sum += call_tmp12;
+  chpl_check_nil((&call_tmp4)->addr, INT64(265), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl_macro_tmp_126.locale = (&call_tmp4)->locale;
+  chpl_macro_tmp_126.addr = &(((&call_tmp4)->addr)->shiftedData);
+  chpl_gen_comm_get(((void*)(&ret7)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_126).locale), INT64(0), NULL), (chpl_macro_tmp_126).addr, sizeof(chpl____wide__ddata_locale), -1, INT64(1), INT64(265), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  coerce_tmp5 = ret7;
+  chpl_macro_tmp_127.locale = (&coerce_tmp5)->locale;
+  chpl_macro_tmp_127.addr = ((&coerce_tmp5)->addr + sum);
+  call_tmp13 = chpl_macro_tmp_127;
+  chpl_gen_comm_get(((void*)(&ret8)), chpl_nodeFromLocaleID(&((call_tmp13).locale), INT64(0), NULL), (call_tmp13).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(265), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  return ret8;
+}
+
+/* LocaleModel.chpl:277 */
+static chpl_opaque _local_chpl_here_alloc(int64_t size, int16_t md, int64_t _ln, c_string _fn) {
+  int16_t call_tmp;
+  int16_t call_tmp2;
+  chpl_opaque call_tmp3;
+  call_tmp = chpl_memhook_md_num();
+  call_tmp2 = (md + call_tmp);
+  call_tmp3 = chpl_mem_alloc(size, call_tmp2, _ln, _fn);
+  return call_tmp3;
+}
+
+/* LocaleModel.chpl:277 */
+static chpl_opaque chpl_here_alloc(int64_t size, int16_t md, int64_t _ln, c_string _fn) {
+  int16_t call_tmp;
+  int16_t call_tmp2;
+  chpl_opaque call_tmp3;
+  call_tmp = chpl_memhook_md_num();
+  call_tmp2 = (md + call_tmp);
+  call_tmp3 = chpl_mem_alloc(size, call_tmp2, _ln, _fn);
+  return call_tmp3;
+}
+
+/* LocaleModel.chpl:298 */
+static void _local_chpl_here_free(chpl_opaque ptr, int64_t _ln, c_string _fn) {
+  chpl_mem_free(ptr, _ln, _fn);
+  return;
+}
+
+/* LocaleModel.chpl:298 */
+static void chpl_here_free(chpl_opaque ptr, int64_t _ln, c_string _fn) {
+  chpl_mem_free(ptr, _ln, _fn);
+  return;
+}
+
+/* LocaleModel.chpl:325 */
+void chpl_executeOn(chpl_localeID_t* const loc, int64_t fn, c_void_ptr args, int32_t args_size, int64_t _ln, c_string _fn) {
+  int32_t call_tmp;
+  chpl_bool call_tmp2;
+  int32_t call_tmp3;
+  int64_t call_tmp4;
+  int64_t call_tmp5;
+  call_tmp = chpl_nodeFromLocaleID(loc, _ln, _fn);
+  call_tmp2 = (call_tmp == chpl_nodeID);
+  if (call_tmp2) {
+    chpl_ftable_call(fn, args);
+  } else {
+    call_tmp3 = chpl_sublocFromLocaleID(loc, _ln, _fn);
+    call_tmp4 = ((int64_t)(call_tmp));
+    call_tmp5 = ((int64_t)(call_tmp3));
+    chpl_comm_fork(call_tmp4, call_tmp5, fn, args, args_size);
+  }
+  return;
+}
+
+/* LocaleModel.chpl:346 */
+void chpl_executeOnFast(chpl_localeID_t* const loc, int64_t fn, c_void_ptr args, int32_t args_size, int64_t _ln, c_string _fn) {
+  int32_t call_tmp;
+  chpl_bool call_tmp2;
+  int32_t call_tmp3;
+  int64_t call_tmp4;
+  int64_t call_tmp5;
+  call_tmp = chpl_nodeFromLocaleID(loc, _ln, _fn);
+  call_tmp2 = (call_tmp == chpl_nodeID);
+  if (call_tmp2) {
+    chpl_ftable_call(fn, args);
+  } else {
+    call_tmp3 = chpl_sublocFromLocaleID(loc, _ln, _fn);
+    call_tmp4 = ((int64_t)(call_tmp));
+    call_tmp5 = ((int64_t)(call_tmp3));
+    chpl_comm_fork_fast(call_tmp4, call_tmp5, fn, args, args_size);
+  }
+  return;
+}
+
+/* LocaleModel.chpl:366 */
+void chpl_executeOnNB(chpl_localeID_t* const loc, int64_t fn, c_void_ptr args, int32_t args_size, int64_t _ln, c_string _fn) {
+  int32_t call_tmp;
+  chpl_bool call_tmp2;
+  chpl_bool call_tmp3;
+  int32_t call_tmp4;
+  int64_t call_tmp5;
+  int64_t call_tmp6;
+  int32_t call_tmp7;
+  chpl_bool call_tmp8;
+  int64_t call_tmp9;
+  int64_t call_tmp10;
+  int64_t call_tmp11;
+  int64_t call_tmp12;
+  call_tmp = chpl_nodeFromLocaleID(loc, _ln, _fn);
+  call_tmp2 = (call_tmp == chpl_nodeID);
+  if (call_tmp2) {
+    call_tmp3 = chpl_task_getSerial();
+    if (call_tmp3) {
+      chpl_ftable_call(fn, args);
+    } else {
+      call_tmp4 = chpl_sublocFromLocaleID(loc, _ln, _fn);
+      call_tmp5 = ((int64_t)(call_tmp));
+      call_tmp6 = ((int64_t)(call_tmp4));
+      chpl_comm_fork_nb(call_tmp5, call_tmp6, fn, args, args_size);
+    }
+  } else {
+    call_tmp7 = chpl_sublocFromLocaleID(loc, _ln, _fn);
+    call_tmp8 = chpl_task_getSerial();
+    if (call_tmp8) {
+      call_tmp9 = ((int64_t)(call_tmp));
+      call_tmp10 = ((int64_t)(call_tmp7));
+      chpl_comm_fork(call_tmp9, call_tmp10, fn, args, args_size);
+    } else {
+      call_tmp11 = ((int64_t)(call_tmp));
+      call_tmp12 = ((int64_t)(call_tmp7));
+      chpl_comm_fork_nb(call_tmp11, call_tmp12, fn, args, args_size);
+    }
+  }
+  return;
+}
+
+/* LocaleModel.chpl:416 */
+void chpl_taskListAddBegin(int64_t subloc_id, int64_t fn, c_void_ptr args, _ref_chpl_task_list_p tlist, int64_t tlist_node_id, int64_t _ln, c_string _fn) {
+  _ref_chpl_task_list_p T = NULL;
+  T = tlist;
+  chpl_task_addToTaskList(fn, args, subloc_id, T, tlist_node_id, true, _ln, _fn);
+  tlist = T;
+  return;
+}
+
+/* LocaleModel.chpl:431 */
+void chpl_taskListAddCoStmt(int64_t subloc_id, int64_t fn, c_void_ptr args, _ref_chpl_task_list_p tlist, int64_t tlist_node_id, int64_t _ln, c_string _fn) {
+  _ref_chpl_task_list_p T = NULL;
+  T = tlist;
+  chpl_task_addToTaskList(fn, args, subloc_id, T, tlist_node_id, false, _ln, _fn);
+  tlist = T;
+  return;
+}
+
+/* LocaleModel.chpl:445 */
+void chpl_taskListProcess(chpl_task_list_p task_list, int64_t _ln, c_string _fn) {
+  chpl_task_processTaskList(task_list);
+  return;
+}
+
+/* LocaleModel.chpl:454 */
+void chpl_taskListExecute(chpl_task_list_p task_list, int64_t _ln, c_string _fn) {
+  chpl_task_executeTasksInList(task_list);
+  return;
+}
+
+/* LocaleModel.chpl:463 */
+void chpl_taskListFree(chpl_task_list_p task_list, int64_t _ln, c_string _fn) {
+  chpl_task_freeTaskList(task_list);
+  return;
+}
+
@@ -0,0 +1,230 @@
+/* LocaleTree.chpl:25 */
+static void chpl__init_LocaleTree(int64_t _ln, c_string _fn) {
+  c_string modFormatStr;
+  c_string modStr;
+  _ref_int32_t refIndentLevel = NULL;
+  chpl_localeTreeRecord this6;
+  locale T = NULL;
+  chpl____wide_locale T2 = {CHPL_LOCALEID_T_INIT, NULL};
+  locale T3 = NULL;
+  chpl____wide_locale T4 = {CHPL_LOCALEID_T_INIT, NULL};
+  locale call_tmp = NULL;
+  locale T5 = NULL;
+  chpl____wide_locale T6 = {CHPL_LOCALEID_T_INIT, NULL};
+  locale call_tmp2 = NULL;
+  locale T7 = NULL;
+  chpl____wide_locale T8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeTreeRecord wrap_call_tmp;
+  chpl____wide_locale chpl_macro_tmp_637;
+  chpl____wide_locale chpl_macro_tmp_638;
+  chpl____wide_locale chpl_macro_tmp_639;
+  chpl____wide_locale chpl_macro_tmp_640;
+  if (chpl__init_LocaleTree_p) {
+    goto _exit_chpl__init_LocaleTree;
+  }
+  modFormatStr = "%*s\n";
+  modStr = "LocaleTree";
+  printModuleInit(modFormatStr, modStr, INT64(10), _ln, _fn);
+  refIndentLevel = &moduleInitLevel;
+  *(refIndentLevel) += INT64(1);
+  chpl__init_LocaleTree_p = true;
+  {
+    chpl__init_ChapelLocale(_ln, _fn);
+  }
+  T = nil;
+  chpl_macro_tmp_637.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_637.addr = T;
+  T2 = chpl_macro_tmp_637;
+  (&this6)->left = T2;
+  T3 = nil;
+  chpl_macro_tmp_638.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_638.addr = T3;
+  T4 = chpl_macro_tmp_638;
+  (&this6)->right = T4;
+  T5 = ((locale)(nil));
+  call_tmp = T5;
+  chpl_macro_tmp_639.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_639.addr = call_tmp;
+  T6 = chpl_macro_tmp_639;
+  (&this6)->left = T6;
+  T7 = ((locale)(nil));
+  call_tmp2 = T7;
+  chpl_macro_tmp_640.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_640.addr = call_tmp2;
+  T8 = chpl_macro_tmp_640;
+  (&this6)->right = T8;
+  wrap_call_tmp = _construct_chpl_localeTreeRecord(call_tmp, call_tmp2, &this6, _ln, _fn);
+  chpl_localeTree = wrap_call_tmp;
+  chpl_initLocaleTree(_ln, _fn);
+  *(refIndentLevel) -= INT64(1);
+  _exit_chpl__init_LocaleTree:;
+  return;
+}
+
+/* LocaleTree.chpl:29 */
+static chpl_localeTreeRecord _construct_chpl_localeTreeRecord(locale left, locale right, chpl_localeTreeRecord* const meme, int64_t _ln, c_string _fn) {
+  chpl_localeTreeRecord this6;
+  chpl____wide_locale T = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_locale T2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_locale chpl_macro_tmp_641;
+  chpl____wide_locale chpl_macro_tmp_642;
+  this6 = *(meme);
+  chpl_macro_tmp_641.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_641.addr = left;
+  T = chpl_macro_tmp_641;
+  (&this6)->left = T;
+  chpl_macro_tmp_642.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_642.addr = right;
+  T2 = chpl_macro_tmp_642;
+  (&this6)->right = T2;
+  return this6;
+}
+
+/* LocaleTree.chpl:35 */
+static void chpl_initLocaleTree(int64_t _ln, c_string _fn) {
+  int64_t local_numLocales;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F local_LocaleSpace = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F ret = {CHPL_LOCALEID_T_INIT, NULL};
+  _tuple_1_star_int64_t default_argoffset;
+  _ref__tuple_1_star_int64_t ret_to_arg_ref_tmp_ = NULL;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F this6 = {CHPL_LOCALEID_T_INIT, NULL};
+  range_int64_t_bounded_F ret_x1;
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F ret_ = {CHPL_LOCALEID_T_INIT, NULL};
+  range_int64_t_bounded_F _ic__F0_this;
+  _ref_range_int64_t_bounded_F this7 = NULL;
+  int64_t i;
+  int64_t ret2;
+  int64_t end;
+  int64_t ret3;
+  chpl____wide_locale left = {CHPL_LOCALEID_T_INIT, NULL};
+  locale type_tmp = NULL;
+  chpl____wide_locale right = {CHPL_LOCALEID_T_INIT, NULL};
+  locale type_tmp2 = NULL;
+  int64_t child;
+  int64_t call_tmp;
+  int64_t call_tmp2;
+  int64_t call_tmp3;
+  chpl_bool call_tmp4;
+  chpl____wide_locale call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  int32_t _virtual_method_tmp_;
+  chpl_bool call_tmp6;
+  chpl____wide_locale call_tmp7 = {CHPL_LOCALEID_T_INIT, NULL};
+  int32_t _virtual_method_tmp_2;
+  chpl____wide_locale call_tmp8 = {CHPL_LOCALEID_T_INIT, NULL};
+  int32_t _virtual_method_tmp_3;
+  chpl_localeID_t call_tmp9;
+  chpl____wide_locale rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_locale rvfDerefTmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn37 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F chpl_macro_tmp_643;
+  chpl____wide__ref_range_int64_t_bounded_F chpl_macro_tmp_644;
+  chpl____wide_locale chpl_macro_tmp_645;
+  chpl____wide_locale chpl_macro_tmp_646;
+  chpl____wide__ref_int32_t chpl_macro_tmp_647;
+  chpl____wide__ref_int32_t chpl_macro_tmp_648;
+  chpl____wide__ref_int32_t chpl_macro_tmp_649;
+  local_numLocales = numLocales;
+  local_LocaleSpace = LocaleSpace;
+  ret = local_LocaleSpace;
+  ret_to_arg_ref_tmp_ = &default_argoffset;
+  createTuple(INT64(0), ret_to_arg_ref_tmp_, _ln, _fn);
+  this6 = ret;
+  chpl_check_nil((&this6)->addr, INT64(36), "/root/repo/modules/internal/LocaleTree.chpl");
+  chpl_macro_tmp_643.locale = (&this6)->locale;
+  chpl_macro_tmp_643.addr = &(((&this6)->addr)->ranges);
+  ret_ = chpl_macro_tmp_643;
+  chpl_macro_tmp_644.locale = (ret_).locale;
+  chpl_macro_tmp_644.addr = (*((ret_).addr) + INT64(0));
+  chpl_gen_comm_get(((void*)(&ret_x1)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_644).locale), INT64(0), NULL), (chpl_macro_tmp_644).addr, sizeof(range_int64_t_bounded_F), -1, INT64(1), INT64(36), "/root/repo/modules/internal/LocaleTree.chpl");
+  _ic__F0_this = ret_x1;
+  this7 = &_ic__F0_this;
+  checkIfIterWillOverflow(this7, true, _ln, _fn);
+  ret2 = (&_ic__F0_this)->_low;
+  ret3 = (&_ic__F0_this)->_high;
+  end = ret3;
+  for (i = ret2; ((i <= end)); i += INT64(1)) {
+    type_tmp = nil;
+    chpl_macro_tmp_645.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_645.addr = type_tmp;
+    left = chpl_macro_tmp_645;
+    type_tmp2 = nil;
+    chpl_macro_tmp_646.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_646.addr = type_tmp2;
+    right = chpl_macro_tmp_646;
+    call_tmp = (i + INT64(1));
+    call_tmp2 = (call_tmp * INT64(2));
+    call_tmp3 = (call_tmp2 - INT64(1));
+    child = call_tmp3;
+    call_tmp4 = (call_tmp3 < local_numLocales);
+    if (call_tmp4) {
+      chpl_check_nil((&rootLocale)->addr, INT64(41), "/root/repo/modules/internal/LocaleTree.chpl");
+      chpl_macro_tmp_647.locale = (&rootLocale)->locale;
+      chpl_macro_tmp_647.addr = &(((object)((&rootLocale)->addr))->chpl__cid);
+      chpl_gen_comm_get(((void*)(&_virtual_method_tmp_)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_647).locale), INT64(0), NULL), (chpl_macro_tmp_647).addr, sizeof(int32_t), -1, INT64(1), INT64(41), "/root/repo/modules/internal/LocaleTree.chpl");
+      call_tmp5 = ((chpl____wide_locale(*)(chpl____wide_locale* const, int64_t, int64_t, c_string))chpl_vmtable[((INT64(4) * _virtual_method_tmp_) + INT64(1))])(&rootLocale, call_tmp3, _ln, _fn);
+      left = call_tmp5;
+      child += INT64(1);
+      call_tmp6 = (child < local_numLocales);
+      if (call_tmp6) {
+        chpl_check_nil((&rootLocale)->addr, INT64(44), "/root/repo/modules/internal/LocaleTree.chpl");
+        chpl_macro_tmp_648.locale = (&rootLocale)->locale;
+        chpl_macro_tmp_648.addr = &(((object)((&rootLocale)->addr))->chpl__cid);
+        chpl_gen_comm_get(((void*)(&_virtual_method_tmp_2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_648).locale), INT64(0), NULL), (chpl_macro_tmp_648).addr, sizeof(int32_t), -1, INT64(1), INT64(44), "/root/repo/modules/internal/LocaleTree.chpl");
+        call_tmp7 = ((chpl____wide_locale(*)(chpl____wide_locale* const, int64_t, int64_t, c_string))chpl_vmtable[((INT64(4) * _virtual_method_tmp_2) + INT64(1))])(&rootLocale, child, _ln, _fn);
+        right = call_tmp7;
+      }
+    }
+    chpl_check_nil((&rootLocale)->addr, INT64(46), "/root/repo/modules/internal/LocaleTree.chpl");
+    chpl_macro_tmp_649.locale = (&rootLocale)->locale;
+    chpl_macro_tmp_649.addr = &(((object)((&rootLocale)->addr))->chpl__cid);
+    chpl_gen_comm_get(((void*)(&_virtual_method_tmp_3)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_649).locale), INT64(0), NULL), (chpl_macro_tmp_649).addr, sizeof(int32_t), -1, INT64(1), INT64(46), "/root/repo/modules/internal/LocaleTree.chpl");
+    call_tmp8 = ((chpl____wide_locale(*)(chpl____wide_locale* const, int64_t, int64_t, c_string))chpl_vmtable[((INT64(4) * _virtual_method_tmp_3) + INT64(1))])(&rootLocale, i, _ln, _fn);
+    call_tmp9 = (&call_tmp8)->locale;
+    rvfDerefTmp = left;
+    rvfDerefTmp2 = right;
+    _args_size = sizeof(chpl__class_localson_fn37_object);
+    _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn = ((_class_localson_fn37)(_args_alloc));
+    chpl_check_nil(_args_foron_fn, INT64(46), "/root/repo/modules/internal/LocaleTree.chpl");
+    (_args_foron_fn)->_0__tmp = call_tmp9;
+    chpl_check_nil(_args_foron_fn, INT64(46), "/root/repo/modules/internal/LocaleTree.chpl");
+    (_args_foron_fn)->_1_rvfDerefTmp = rvfDerefTmp;
+    chpl_check_nil(_args_foron_fn, INT64(46), "/root/repo/modules/internal/LocaleTree.chpl");
+    (_args_foron_fn)->_2_rvfDerefTmp = rvfDerefTmp2;
+    (_args_foron_fn)->_ln = _ln;
+    (_args_foron_fn)->_fn = _fn;
+    /*** wrapon_fn37 ***/ chpl_executeOnFast(&call_tmp9, INT32(40), _args_foron_fn, sizeof(chpl__class_localson_fn37_object), INT64(46), "/root/repo/modules/internal/LocaleTree.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  }
+  return;
+}
+
+/* LocaleTree.chpl:46 */
+static void on_fn37(chpl____wide_locale* const left, chpl____wide_locale* const right, int64_t _ln, c_string _fn) {
+  _ref_locale call_tmp = NULL;
+  _ref_locale call_tmp2 = NULL;
+  call_tmp = &((&chpl_localeTree)->left);
+  *(call_tmp) = *(left);
+  call_tmp2 = &((&chpl_localeTree)->right);
+  *(call_tmp2) = *(right);
+  return;
+}
+
+/* LocaleTree.chpl:46 */
+static void wrapon_fn37(_class_localson_fn37 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_locale _1_rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_locale _2_rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(46), "/root/repo/modules/internal/LocaleTree.chpl");
+  _1_rvfDerefTmp = (c)->_1_rvfDerefTmp;
+  chpl_check_nil(c, INT64(46), "/root/repo/modules/internal/LocaleTree.chpl");
+  _2_rvfDerefTmp = (c)->_2_rvfDerefTmp;
+  on_fn37(&_1_rvfDerefTmp, &_2_rvfDerefTmp, _ln, _fn);
+  return;
+}
+
@@ -0,0 +1,337 @@
+/* MemTracking.chpl:23 */
+static void chpl__init_MemTracking(int64_t _ln, c_string _fn) {
+  c_string modFormatStr;
+  c_string modStr;
+  _ref_int32_t refIndentLevel = NULL;
+  chpl_bool const_tmp;
+  chpl_bool call_tmp;
+  chpl_bool call_tmp2;
+  chpl_bool type_tmp;
+  _ref_chpl_bool _ref_tmp_ = NULL;
+  c_string call_tmp3;
+  chpl_bool const_tmp2;
+  chpl_bool call_tmp4;
+  chpl_bool call_tmp5;
+  chpl_bool type_tmp2;
+  _ref_chpl_bool _ref_tmp_2 = NULL;
+  c_string call_tmp6;
+  chpl_bool const_tmp3;
+  chpl_bool call_tmp7;
+  chpl_bool call_tmp8;
+  chpl_bool type_tmp3;
+  _ref_chpl_bool _ref_tmp_3 = NULL;
+  c_string call_tmp9;
+  chpl_bool const_tmp4;
+  chpl_bool call_tmp10;
+  chpl_bool call_tmp11;
+  chpl_bool type_tmp4;
+  _ref_chpl_bool _ref_tmp_4 = NULL;
+  c_string call_tmp12;
+  uint64_t const_tmp5;
+  chpl_bool call_tmp13;
+  chpl_bool call_tmp14;
+  uint64_t call_tmp15;
+  c_string call_tmp16;
+  uint64_t const_tmp6;
+  chpl_bool call_tmp17;
+  chpl_bool call_tmp18;
+  uint64_t call_tmp19;
+  c_string call_tmp20;
+  c_string const_tmp7;
+  chpl_bool call_tmp21;
+  chpl_bool call_tmp22;
+  c_string call_tmp23;
+  c_string const_tmp8;
+  chpl_bool call_tmp24;
+  chpl_bool call_tmp25;
+  c_string call_tmp26;
+  heap_string_rec type_tmp5 = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_string_rec T = NULL;
+  string_rec call_tmp27;
+  _ref_string_rec _ref_tmp_5 = NULL;
+  c_string T2;
+  chpl____wide__ref_string_rec T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  string_rec T4;
+  heap_string_rec type_tmp6 = NULL;
+  int64_t chpl_here_alloc_size2;
+  chpl_opaque chpl_here_alloc_tmp2;
+  heap_string_rec T5 = NULL;
+  string_rec call_tmp28;
+  _ref_string_rec _ref_tmp_6 = NULL;
+  c_string T6;
+  chpl____wide__ref_string_rec T7 = {CHPL_LOCALEID_T_INIT, NULL};
+  string_rec T8;
+  chpl____wide__ref_c_string chpl_macro_tmp_650;
+  chpl____wide__ref_c_string chpl_macro_tmp_651;
+  chpl____wide__ref_c_string chpl_macro_tmp_652;
+  chpl____wide__ref_string_rec chpl_macro_tmp_653;
+  chpl____wide__ref_c_string chpl_macro_tmp_654;
+  chpl____wide__ref_string_rec chpl_macro_tmp_655;
+  if (chpl__init_MemTracking_p) {
+    goto _exit_chpl__init_MemTracking;
+  }
+  modFormatStr = "%*s\n";
+  modStr = "MemTracking";
+  printModuleInit(modFormatStr, modStr, INT64(11), _ln, _fn);
+  refIndentLevel = &moduleInitLevel;
+  *(refIndentLevel) += INT64(1);
+  chpl__init_MemTracking_p = true;
+  {
+    chpl__init_NewString(_ln, _fn);
+  }
+  call_tmp = chpl_config_has_value("memTrack", "Built-in");
+  call_tmp2 = (! call_tmp);
+  if (call_tmp2) {
+    type_tmp = false;
+    _ref_tmp_ = &type_tmp;
+    *(_ref_tmp_) = false;
+    const_tmp = type_tmp;
+  } else {
+    call_tmp3 = chpl_config_get_value("memTrack", "Built-in");
+    const_tmp = _command_line_cast5(call_tmp3, _ln, _fn);
+  }
+  memTrack = const_tmp;
+  chpl_comm_broadcast_private(INT64(12), sizeof(chpl_bool), -1);
+  call_tmp4 = chpl_config_has_value("memStats", "Built-in");
+  call_tmp5 = (! call_tmp4);
+  if (call_tmp5) {
+    type_tmp2 = false;
+    _ref_tmp_2 = &type_tmp2;
+    *(_ref_tmp_2) = false;
+    const_tmp2 = type_tmp2;
+  } else {
+    call_tmp6 = chpl_config_get_value("memStats", "Built-in");
+    const_tmp2 = _command_line_cast6(call_tmp6, _ln, _fn);
+  }
+  memStats = const_tmp2;
+  chpl_comm_broadcast_private(INT64(13), sizeof(chpl_bool), -1);
+  call_tmp7 = chpl_config_has_value("memLeaks", "Built-in");
+  call_tmp8 = (! call_tmp7);
+  if (call_tmp8) {
+    type_tmp3 = false;
+    _ref_tmp_3 = &type_tmp3;
+    *(_ref_tmp_3) = false;
+    const_tmp3 = type_tmp3;
+  } else {
+    call_tmp9 = chpl_config_get_value("memLeaks", "Built-in");
+    const_tmp3 = _command_line_cast7(call_tmp9, _ln, _fn);
+  }
+  memLeaks = const_tmp3;
+  chpl_comm_broadcast_private(INT64(14), sizeof(chpl_bool), -1);
+  call_tmp10 = chpl_config_has_value("memLeaksTable", "Built-in");
+  call_tmp11 = (! call_tmp10);
+  if (call_tmp11) {
+    type_tmp4 = false;
+    _ref_tmp_4 = &type_tmp4;
+    *(_ref_tmp_4) = false;
+    const_tmp4 = type_tmp4;
+  } else {
+    call_tmp12 = chpl_config_get_value("memLeaksTable", "Built-in");
+    const_tmp4 = _command_line_cast8(call_tmp12, _ln, _fn);
+  }
+  memLeaksTable = const_tmp4;
+  chpl_comm_broadcast_private(INT64(15), sizeof(chpl_bool), -1);
+  call_tmp13 = chpl_config_has_value("memMax", "Built-in");
+  call_tmp14 = (! call_tmp13);
+  if (call_tmp14) {
+    call_tmp15 = ((uint64_t)(INT64(0)));
+    const_tmp5 = call_tmp15;
+  } else {
+    call_tmp16 = chpl_config_get_value("memMax", "Built-in");
+    const_tmp5 = _command_line_cast9(call_tmp16, _ln, _fn);
+  }
+  memMax = const_tmp5;
+  chpl_comm_broadcast_private(INT64(16), sizeof(uint64_t), -1);
+  call_tmp17 = chpl_config_has_value("memThreshold", "Built-in");
+  call_tmp18 = (! call_tmp17);
+  if (call_tmp18) {
+    call_tmp19 = ((uint64_t)(INT64(0)));
+    const_tmp6 = call_tmp19;
+  } else {
+    call_tmp20 = chpl_config_get_value("memThreshold", "Built-in");
+    const_tmp6 = _command_line_cast10(call_tmp20, _ln, _fn);
+  }
+  memThreshold = const_tmp6;
+  chpl_comm_broadcast_private(INT64(17), sizeof(uint64_t), -1);
+  call_tmp21 = chpl_config_has_value("memLog", "Built-in");
+  call_tmp22 = (! call_tmp21);
+  if (call_tmp22) {
+    const_tmp7 = "";
+  } else {
+    call_tmp23 = chpl_config_get_value("memLog", "Built-in");
+    const_tmp7 = _command_line_cast11(call_tmp23, _ln, _fn);
+  }
+  chpl_check_nil((&memLog)->addr, INT64(32), "/root/repo/modules/internal/MemTracking.chpl");
+  chpl_macro_tmp_650.locale = (&memLog)->locale;
+  chpl_macro_tmp_650.addr = &(((&memLog)->addr)->value);
+  chpl_gen_comm_put(((void*)(&const_tmp7)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_650).locale), INT64(0), NULL), (chpl_macro_tmp_650).addr, sizeof(c_string), -1, INT64(1), INT64(32), "/root/repo/modules/internal/MemTracking.chpl");
+  call_tmp24 = chpl_config_has_value("memLeaksLog", "Built-in");
+  call_tmp25 = (! call_tmp24);
+  if (call_tmp25) {
+    const_tmp8 = "";
+  } else {
+    call_tmp26 = chpl_config_get_value("memLeaksLog", "Built-in");
+    const_tmp8 = _command_line_cast12(call_tmp26, _ln, _fn);
+  }
+  chpl_check_nil((&memLeaksLog)->addr, INT64(36), "/root/repo/modules/internal/MemTracking.chpl");
+  chpl_macro_tmp_651.locale = (&memLeaksLog)->locale;
+  chpl_macro_tmp_651.addr = &(((&memLeaksLog)->addr)->value);
+  chpl_gen_comm_put(((void*)(&const_tmp8)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_651).locale), INT64(0), NULL), (chpl_macro_tmp_651).addr, sizeof(c_string), -1, INT64(1), INT64(36), "/root/repo/modules/internal/MemTracking.chpl");
+  chpl_here_alloc_size = sizeof(chpl_heap_string_rec_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+  T = ((heap_string_rec)(chpl_here_alloc_tmp));
+  type_tmp5 = T;
+  call_tmp27 = string_rec2(_ln, _fn);
+  chpl_check_nil(type_tmp5, INT64(40), "/root/repo/modules/internal/MemTracking.chpl");
+  (type_tmp5)->value = call_tmp27;
+  chpl_check_nil(type_tmp5, INT64(40), "/root/repo/modules/internal/MemTracking.chpl");
+  _ref_tmp_5 = &((type_tmp5)->value);
+  chpl_check_nil((&memLog)->addr, INT64(32), "/root/repo/modules/internal/MemTracking.chpl");
+  chpl_macro_tmp_652.locale = (&memLog)->locale;
+  chpl_macro_tmp_652.addr = &(((&memLog)->addr)->value);
+  chpl_gen_comm_get(((void*)(&T2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_652).locale), INT64(0), NULL), (chpl_macro_tmp_652).addr, sizeof(c_string), -1, INT64(1), INT64(32), "/root/repo/modules/internal/MemTracking.chpl");
+  chpl_macro_tmp_653.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_653.addr = _ref_tmp_5;
+  T3 = chpl_macro_tmp_653;
+  chpl___ASSIGN_7(&T3, T2, _ln, _fn);
+  chpl_check_nil(type_tmp5, INT64(40), "/root/repo/modules/internal/MemTracking.chpl");
+  T4 = (type_tmp5)->value;
+  chpl_here_free(((void*)(type_tmp5)), _ln, _fn);
+  s_memLog = T4;
+  chpl_comm_broadcast_private(INT64(18), sizeof(string_rec), -1);
+  chpl_here_alloc_size2 = sizeof(chpl_heap_string_rec_object);
+  chpl_here_alloc_tmp2 = chpl_here_alloc(chpl_here_alloc_size2, INT16(22), _ln, _fn);
+  T5 = ((heap_string_rec)(chpl_here_alloc_tmp2));
+  type_tmp6 = T5;
+  call_tmp28 = string_rec2(_ln, _fn);
+  chpl_check_nil(type_tmp6, INT64(41), "/root/repo/modules/internal/MemTracking.chpl");
+  (type_tmp6)->value = call_tmp28;
+  chpl_check_nil(type_tmp6, INT64(41), "/root/repo/modules/internal/MemTracking.chpl");
+  _ref_tmp_6 = &((type_tmp6)->value);
+  chpl_check_nil((&memLeaksLog)->addr, INT64(36), "/root/repo/modules/internal/MemTracking.chpl");
+  chpl_macro_tmp_654.locale = (&memLeaksLog)->locale;
+  chpl_macro_tmp_654.addr = &(((&memLeaksLog)->addr)->value);
+  chpl_gen_comm_get(((void*)(&T6)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_654).locale), INT64(0), NULL), (chpl_macro_tmp_654).addr, sizeof(c_string), -1, INT64(1), INT64(36), "/root/repo/modules/internal/MemTracking.chpl");
+  chpl_macro_tmp_655.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_655.addr = _ref_tmp_6;
+  T7 = chpl_macro_tmp_655;
+  chpl___ASSIGN_7(&T7, T6, _ln, _fn);
+  chpl_check_nil(type_tmp6, INT64(41), "/root/repo/modules/internal/MemTracking.chpl");
+  T8 = (type_tmp6)->value;
+  chpl_here_free(((void*)(type_tmp6)), _ln, _fn);
+  s_memLeaksLog = T8;
+  chpl_comm_broadcast_private(INT64(19), sizeof(string_rec), -1);
+  *(refIndentLevel) -= INT64(1);
+  _exit_chpl__init_MemTracking:;
+  return;
+}
+
+/* MemTracking.chpl:56 */
+void chpl_memTracking_returnConfigVals(_ref_chpl_bool ret_memTrack, _ref_chpl_bool ret_memStats, _ref_chpl_bool ret_memLeaks, _ref_chpl_bool ret_memLeaksTable, _ref_uint64_t ret_memMax, _ref_uint64_t ret_memThreshold, _ref_c_string ret_memLog, _ref_c_string ret_memLeaksLog, int64_t _ln, c_string _fn) {
+  chpl____wide_heap_c_string local_memLeaksLog = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_heap_c_string local_memLog = {CHPL_LOCALEID_T_INIT, NULL};
+  string_rec local_s_memLeaksLog;
+  string_rec local_s_memLog;
+  uint64_t local_memThreshold;
+  uint64_t local_memMax;
+  chpl_bool local_memLeaksTable;
+  chpl_bool local_memLeaks;
+  chpl_bool local_memStats;
+  chpl_bool local_memTrack;
+  int32_t call_tmp;
+  chpl_localeID_t call_tmp2;
+  _ref_chpl_localeID_t ret_to_arg_ref_tmp_ = NULL;
+  chpl_localeID_t call_tmp3;
+  chpl____wide_locale call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp5;
+  chpl_bool call_tmp6;
+  int64_t ret;
+  chpl_bool call_tmp7;
+  chpl____wide_locale ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp8;
+  c_string ret3;
+  int64_t ret4;
+  c_string_copy call_tmp9;
+  c_string call_tmp10;
+  int64_t ret5;
+  chpl_bool call_tmp11;
+  chpl____wide_locale ret6 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp12;
+  c_string ret7;
+  int64_t ret8;
+  c_string_copy call_tmp13;
+  c_string call_tmp14;
+  c_string T;
+  c_string T2;
+  chpl____wide__ref_c_string chpl_macro_tmp_656;
+  chpl____wide__ref_c_string chpl_macro_tmp_657;
+  local_memLeaksLog = memLeaksLog;
+  local_memLog = memLog;
+  local_s_memLeaksLog = s_memLeaksLog;
+  local_s_memLog = s_memLog;
+  local_memThreshold = memThreshold;
+  local_memMax = memMax;
+  local_memLeaksTable = memLeaksTable;
+  local_memLeaks = memLeaks;
+  local_memStats = memStats;
+  local_memTrack = memTrack;
+  *(ret_memTrack) = local_memTrack;
+  *(ret_memStats) = local_memStats;
+  *(ret_memLeaks) = local_memLeaks;
+  *(ret_memLeaksTable) = local_memLeaksTable;
+  *(ret_memMax) = local_memMax;
+  *(ret_memThreshold) = local_memThreshold;
+  call_tmp = chpl_task_getRequestedSubloc();
+  ret_to_arg_ref_tmp_ = &call_tmp2;
+  chpl_buildLocaleID(chpl_nodeID, call_tmp, ret_to_arg_ref_tmp_, _ln, _fn);
+  call_tmp3 = chpl__initCopy_chpl_rt_localeID_t(call_tmp2);
+  call_tmp4 = chpl_localeID_to_locale(&call_tmp3, _ln, _fn);
+  chpl_check_nil((&call_tmp4)->addr, INT64(71), "/root/repo/modules/internal/MemTracking.chpl");
+  call_tmp5 = id(&call_tmp4, _ln, _fn);
+  call_tmp6 = (call_tmp5 != INT64(0));
+  if (call_tmp6) {
+    ret = (&local_s_memLog)->len;
+    call_tmp7 = (ret != INT64(0));
+    if (call_tmp7) {
+      ret2 = (&local_s_memLog)->home;
+      chpl_check_nil((&ret2)->addr, INT64(74), "/root/repo/modules/internal/MemTracking.chpl");
+      call_tmp8 = id(&ret2, _ln, _fn);
+      ret3 = (&local_s_memLog)->base;
+      ret4 = (&local_s_memLog)->len;
+      call_tmp9 = remoteStringCopy(call_tmp8, ret3, ret4, _ln, _fn);
+      call_tmp10 = ((c_string)(call_tmp9));
+      *(ret_memLog) = call_tmp10;
+    } else {
+      *(ret_memLog) = "";
+    }
+    ret5 = (&local_s_memLeaksLog)->len;
+    call_tmp11 = (ret5 != INT64(0));
+    if (call_tmp11) {
+      ret6 = (&local_s_memLeaksLog)->home;
+      chpl_check_nil((&ret6)->addr, INT64(79), "/root/repo/modules/internal/MemTracking.chpl");
+      call_tmp12 = id(&ret6, _ln, _fn);
+      ret7 = (&local_s_memLeaksLog)->base;
+      ret8 = (&local_s_memLeaksLog)->len;
+      call_tmp13 = remoteStringCopy(call_tmp12, ret7, ret8, _ln, _fn);
+      call_tmp14 = ((c_string)(call_tmp13));
+      *(ret_memLeaksLog) = call_tmp14;
+    } else {
+      *(ret_memLeaksLog) = "";
+    }
+  } else {
+    chpl_check_nil((&local_memLog)->addr, INT64(32), "/root/repo/modules/internal/MemTracking.chpl");
+    chpl_macro_tmp_656.locale = (&local_memLog)->locale;
+    chpl_macro_tmp_656.addr = &(((&local_memLog)->addr)->value);
+    chpl_gen_comm_get(((void*)(&T)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_656).locale), INT64(0), NULL), (chpl_macro_tmp_656).addr, sizeof(c_string), -1, INT64(1), INT64(32), "/root/repo/modules/internal/MemTracking.chpl");
+    *(ret_memLog) = T;
+    chpl_check_nil((&local_memLeaksLog)->addr, INT64(36), "/root/repo/modules/internal/MemTracking.chpl");
+    chpl_macro_tmp_657.locale = (&local_memLeaksLog)->locale;
+    chpl_macro_tmp_657.addr = &(((&local_memLeaksLog)->addr)->value);
+    chpl_gen_comm_get(((void*)(&T2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_657).locale), INT64(0), NULL), (chpl_macro_tmp_657).addr, sizeof(c_string), -1, INT64(1), INT64(36), "/root/repo/modules/internal/MemTracking.chpl");
+    *(ret_memLeaksLog) = T2;
+  }
+  return;
+}
+
@@ -0,0 +1,1237 @@
+/* NewString.chpl:108 */
+static void chpl__init_NewString(int64_t _ln, c_string _fn) {
+  c_string modFormatStr;
+  c_string modStr;
+  _ref_int32_t refIndentLevel = NULL;
+  if (chpl__init_NewString_p) {
+    goto _exit_chpl__init_NewString;
+  }
+  modFormatStr = "%*s\n";
+  modStr = "NewString";
+  printModuleInit(modFormatStr, modStr, INT64(9), _ln, _fn);
+  refIndentLevel = &moduleInitLevel;
+  *(refIndentLevel) += INT64(1);
+  chpl__init_NewString_p = true;
+  {
+    chpl__init_BaseStringType(_ln, _fn);
+  }
+  *(refIndentLevel) -= INT64(1);
+  _exit_chpl__init_NewString:;
+  return;
+}
+
+/* NewString.chpl:111 */
+static string_refcnt _construct_string_refcnt(atomic_refcnt* const val, string_refcnt meme, int64_t _ln, c_string _fn) {
+  string_refcnt this6 = NULL;
+  object T = NULL;
+  this6 = meme;
+  chpl_check_nil(this6, INT64(111), "/root/repo/modules/standard/NewString.chpl");
+  T = &((this6)->super);
+  _construct_object(T);
+  chpl_check_nil(this6, INT64(112), "/root/repo/modules/standard/NewString.chpl");
+  (this6)->val = *(val);
+  return this6;
+}
+
+/* NewString.chpl:111 */
+static void chpl__auto_destroy_string_refcnt(string_refcnt this6, int64_t _ln, c_string _fn) {
+  _ref_atomic_refcnt _field_destructor_tmp_ = NULL;
+  _ref_atomic_int64 _field_destructor_tmp_2 = NULL;
+  _ref_atomic_int_least64_t call_tmp = NULL;
+  _ref_atomic_int_least64_t T = NULL;
+  chpl_check_nil(this6, INT64(112), "/root/repo/modules/standard/NewString.chpl");
+  _field_destructor_tmp_ = &((this6)->val);
+  chpl_check_nil(_field_destructor_tmp_, INT64(112), "/root/repo/modules/standard/NewString.chpl");
+  _field_destructor_tmp_2 = &((_field_destructor_tmp_)->_cnt);
+  chpl_check_nil(_field_destructor_tmp_2, INT64(112), "/root/repo/modules/standard/NewString.chpl");
+  call_tmp = &((_field_destructor_tmp_2)->_v);
+  T = call_tmp;
+  atomic_destroy_int_least64_t(T);
+  call_tmp = T;
+  return;
+}
+
+/* NewString.chpl:121 */
+static string_rec _construct_string_rec(c_string base, int64_t len, locale home, string_refcnt refCnt, string_refcnt aliasRefCnt, string_rec* const meme, int64_t _ln, c_string _fn) {
+  string_rec this6;
+  chpl____wide_locale T = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_string_refcnt T2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_string_refcnt T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_locale chpl_macro_tmp_666;
+  chpl____wide_string_refcnt chpl_macro_tmp_667;
+  chpl____wide_string_refcnt chpl_macro_tmp_668;
+  this6 = *(meme);
+  (&this6)->base = base;
+  (&this6)->len = len;
+  chpl_macro_tmp_666.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_666.addr = home;
+  T = chpl_macro_tmp_666;
+  (&this6)->home = T;
+  chpl_macro_tmp_667.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_667.addr = refCnt;
+  T2 = chpl_macro_tmp_667;
+  (&this6)->refCnt = T2;
+  chpl_macro_tmp_668.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_668.addr = aliasRefCnt;
+  T3 = chpl_macro_tmp_668;
+  (&this6)->aliasRefCnt = T3;
+  return this6;
+}
+
+/* NewString.chpl:128 */
+static string_rec string_rec2(int64_t _ln, c_string _fn) {
+  string_rec this6;
+  string_rec this7;
+  c_string T;
+  locale T2 = NULL;
+  chpl____wide_locale T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  string_refcnt T4 = NULL;
+  chpl____wide_string_refcnt T5 = {CHPL_LOCALEID_T_INIT, NULL};
+  string_refcnt T6 = NULL;
+  chpl____wide_string_refcnt T7 = {CHPL_LOCALEID_T_INIT, NULL};
+  c_string T8;
+  locale call_tmp = NULL;
+  locale T9 = NULL;
+  chpl____wide_locale T10 = {CHPL_LOCALEID_T_INIT, NULL};
+  string_refcnt call_tmp2 = NULL;
+  string_refcnt T11 = NULL;
+  chpl____wide_string_refcnt T12 = {CHPL_LOCALEID_T_INIT, NULL};
+  string_refcnt call_tmp3 = NULL;
+  string_refcnt T13 = NULL;
+  chpl____wide_string_refcnt T14 = {CHPL_LOCALEID_T_INIT, NULL};
+  string_rec wrap_call_tmp;
+  c_string T15;
+  _ref_locale call_tmp4 = NULL;
+  int32_t call_tmp5;
+  chpl_localeID_t call_tmp6;
+  _ref_chpl_localeID_t ret_to_arg_ref_tmp_ = NULL;
+  chpl_localeID_t call_tmp7;
+  chpl____wide_locale call_tmp8 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_string_refcnt call_tmp9 = NULL;
+  string_refcnt this8 = NULL;
+  int64_t call_tmp10;
+  chpl_opaque cast_tmp;
+  string_refcnt T16 = NULL;
+  atomic_refcnt _init_class_tmp_;
+  atomic_int64 _init_class_tmp_2;
+  atomic_refcnt this9;
+  atomic_int64 _init_class_tmp_3;
+  atomic_int64 this10;
+  atomic_int_least64_t ret;
+  atomic_int_least64_t type_tmp;
+  _ref_atomic_int_least64_t _ref_tmp_ = NULL;
+  _ref_atomic_int_least64_t T17 = NULL;
+  atomic_int64 wrap_call_tmp2;
+  atomic_refcnt wrap_call_tmp3;
+  string_refcnt wrap_call_tmp4 = NULL;
+  chpl____wide_string_refcnt T18 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_string_refcnt call_tmp11 = NULL;
+  chpl____wide_string_refcnt ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_locale chpl_macro_tmp_669;
+  chpl____wide_string_refcnt chpl_macro_tmp_670;
+  chpl____wide_string_refcnt chpl_macro_tmp_671;
+  chpl____wide_locale chpl_macro_tmp_672;
+  chpl____wide_string_refcnt chpl_macro_tmp_673;
+  chpl____wide_string_refcnt chpl_macro_tmp_674;
+  chpl____wide_string_refcnt chpl_macro_tmp_675;
+  T = "";
+  (&this7)->base = T;
+  (&this7)->len = INT64(0);
+  T2 = nil;
+  chpl_macro_tmp_669.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_669.addr = T2;
+  T3 = chpl_macro_tmp_669;
+  (&this7)->home = T3;
+  T4 = nil;
+  chpl_macro_tmp_670.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_670.addr = T4;
+  T5 = chpl_macro_tmp_670;
+  (&this7)->refCnt = T5;
+  T6 = nil;
+  chpl_macro_tmp_671.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_671.addr = T6;
+  T7 = chpl_macro_tmp_671;
+  (&this7)->aliasRefCnt = T7;
+  T8 = "";
+  (&this7)->base = T8;
+  (&this7)->len = INT64(0);
+  T9 = ((locale)(nil));
+  call_tmp = T9;
+  chpl_macro_tmp_672.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_672.addr = call_tmp;
+  T10 = chpl_macro_tmp_672;
+  (&this7)->home = T10;
+  T11 = ((string_refcnt)(nil));
+  call_tmp2 = T11;
+  chpl_macro_tmp_673.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_673.addr = call_tmp2;
+  T12 = chpl_macro_tmp_673;
+  (&this7)->refCnt = T12;
+  T13 = ((string_refcnt)(nil));
+  call_tmp3 = T13;
+  chpl_macro_tmp_674.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_674.addr = call_tmp3;
+  T14 = chpl_macro_tmp_674;
+  (&this7)->aliasRefCnt = T14;
+  T15 = "";
+  wrap_call_tmp = _construct_string_rec(T15, INT64(0), call_tmp, call_tmp2, call_tmp3, &this7, _ln, _fn);
+  this6 = wrap_call_tmp;
+  call_tmp4 = &((&this6)->home);
+  call_tmp5 = chpl_task_getRequestedSubloc();
+  ret_to_arg_ref_tmp_ = &call_tmp6;
+  chpl_buildLocaleID(chpl_nodeID, call_tmp5, ret_to_arg_ref_tmp_, _ln, _fn);
+  call_tmp7 = chpl__initCopy_chpl_rt_localeID_t(call_tmp6);
+  call_tmp8 = chpl_localeID_to_locale(&call_tmp7, _ln, _fn);
+  *(call_tmp4) = call_tmp8;
+  call_tmp9 = &((&this6)->refCnt);
+  call_tmp10 = sizeof(chpl_string_refcnt_object);
+  cast_tmp = chpl_here_alloc(call_tmp10, INT16(20), _ln, _fn);
+  T16 = ((string_refcnt)(cast_tmp));
+  this8 = T16;
+  ((object)(this8))->chpl__cid = chpl__cid_string_refcnt;
+  (&_init_class_tmp_)->_cnt = _init_class_tmp_2;
+  chpl_check_nil(this8, INT64(131), "/root/repo/modules/standard/NewString.chpl");
+  (this8)->val = _init_class_tmp_;
+  (&this9)->_cnt = _init_class_tmp_3;
+  ret = type_tmp;
+  _ref_tmp_ = &ret;
+  T17 = _ref_tmp_;
+  atomic_init_int_least64_t(T17, INT64(0));
+  _ref_tmp_ = T17;
+  (&this10)->_v = ret;
+  wrap_call_tmp2 = _construct_atomic_int64(ret, &this10, _ln, _fn);
+  (&this9)->_cnt = wrap_call_tmp2;
+  wrap_call_tmp3 = _construct_atomic_refcnt(&wrap_call_tmp2, &this9, _ln, _fn);
+  chpl_check_nil(this8, INT64(131), "/root/repo/modules/standard/NewString.chpl");
+  (this8)->val = wrap_call_tmp3;
+  wrap_call_tmp4 = _construct_string_refcnt(&wrap_call_tmp3, this8, _ln, _fn);
+  chpl_macro_tmp_675.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_675.addr = wrap_call_tmp4;
+  T18 = chpl_macro_tmp_675;
+  *(call_tmp9) = T18;
+  call_tmp11 = &((&this6)->aliasRefCnt);
+  ret2 = (&this6)->refCnt;
+  *(call_tmp11) = ret2;
+  return this6;
+}
+
+/* NewString.chpl:136 */
+static void chpl___TILDE_string_rec(chpl____wide__ref_string_rec* const this6, int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_seq_cst;
+  chpl_bool ret;
+  chpl____wide_string_refcnt ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_string_refcnt ret3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp3;
+  int64_t ret4;
+  chpl_bool call_tmp4;
+  chpl____wide__ref_string_refcnt call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_string_refcnt coerce_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_refcnt _field_destructor_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 _field_destructor_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int_least64_t call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_int_least64_t T = NULL;
+  chpl_localeID_t call_tmp7;
+  chpl____wide_string_refcnt T2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_string_refcnt rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn62 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  int64_t ret5;
+  chpl____wide_string_refcnt ret6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_string_refcnt ret7 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp9 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp10;
+  chpl_bool call_tmp11;
+  chpl____wide_string_refcnt ret8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_string_refcnt coerce_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_refcnt call_tmp12 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 call_tmp13 = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder;
+  heap_int64_t ret9 = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_int64_t T3 = NULL;
+  chpl_localeID_t call_tmp14;
+  _ref_int64_t T4 = NULL;
+  _class_localson_fn6 _args_foron_fn2 = NULL;
+  int64_t _args_size2;
+  chpl_opaque _args_alloc2;
+  chpl____wide__ref_int64_t T5 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t T6;
+  int64_t call_tmp15;
+  chpl____wide_string_refcnt ret10 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_string_refcnt coerce_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_refcnt call_tmp16 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 call_tmp17 = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder2;
+  heap_int64_t ret11 = NULL;
+  int64_t chpl_here_alloc_size2;
+  chpl_opaque chpl_here_alloc_tmp2;
+  heap_int64_t T7 = NULL;
+  chpl_localeID_t call_tmp18;
+  _ref_int64_t T8 = NULL;
+  _class_localson_fn6 _args_foron_fn3 = NULL;
+  int64_t _args_size3;
+  chpl_opaque _args_alloc3;
+  chpl____wide__ref_int64_t T9 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t T10;
+  int64_t call_tmp19;
+  chpl_bool call_tmp20;
+  c_string T11;
+  chpl_bool call_tmp21;
+  chpl____wide__ref_locale call_tmp22 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp23;
+  chpl____wide_locale T12 = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn63 _args_foron_fn4 = NULL;
+  int64_t _args_size4;
+  chpl_opaque _args_alloc4;
+  chpl____wide_string_refcnt ret12 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_string_refcnt ret13 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp24 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp25 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp26;
+  chpl____wide__ref_string_refcnt call_tmp27 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_string_refcnt coerce_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_refcnt _field_destructor_tmp_3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 _field_destructor_tmp_4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int_least64_t call_tmp28 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_int_least64_t T13 = NULL;
+  chpl_localeID_t call_tmp29;
+  chpl____wide_string_refcnt T14 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_string_refcnt rvfDerefTmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn64 _args_foron_fn5 = NULL;
+  int64_t _args_size5;
+  chpl_opaque _args_alloc5;
+  chpl____wide__ref_string_refcnt chpl_macro_tmp_676;
+  chpl____wide__ref_string_refcnt chpl_macro_tmp_677;
+  chpl____wide_object chpl_macro_tmp_678;
+  chpl____wide_object chpl_macro_tmp_679;
+  chpl____wide__ref_int64_t chpl_macro_tmp_680;
+  chpl____wide__ref_string_refcnt chpl_macro_tmp_681;
+  chpl____wide__ref_string_refcnt chpl_macro_tmp_682;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_683;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_684;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_685;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_686;
+  chpl____wide__ref_string_refcnt chpl_macro_tmp_687;
+  chpl____wide__ref_string_refcnt chpl_macro_tmp_688;
+  chpl____wide__ref_string_refcnt chpl_macro_tmp_689;
+  chpl____wide_object chpl_macro_tmp_690;
+  chpl____wide_object chpl_macro_tmp_691;
+  chpl____wide__ref_string_refcnt chpl_macro_tmp_692;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_693;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_694;
+  chpl____wide__ref_int64_t chpl_macro_tmp_695;
+  chpl____wide__ref_string_refcnt chpl_macro_tmp_696;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_697;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_698;
+  chpl____wide__ref_int64_t chpl_macro_tmp_699;
+  chpl____wide__ref_locale chpl_macro_tmp_700;
+  chpl____wide__ref_string_refcnt chpl_macro_tmp_701;
+  chpl____wide__ref_string_refcnt chpl_macro_tmp_702;
+  chpl____wide_object chpl_macro_tmp_703;
+  chpl____wide_object chpl_macro_tmp_704;
+  chpl____wide__ref_string_refcnt chpl_macro_tmp_705;
+  chpl____wide__ref_string_refcnt chpl_macro_tmp_706;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_707;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_708;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_709;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_710;
+  chpl____wide__ref_string_refcnt chpl_macro_tmp_711;
+  local_memory_order_seq_cst = memory_order_seq_cst;
+  chpl_macro_tmp_676.locale = (*(this6)).locale;
+  chpl_macro_tmp_676.addr = &(((*(this6)).addr)->refCnt);
+  chpl_gen_comm_get(((void*)(&ret2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_676).locale), INT64(0), NULL), (chpl_macro_tmp_676).addr, sizeof(chpl____wide_string_refcnt), -1, INT64(1), INT64(138), "/root/repo/modules/standard/NewString.chpl");
+  chpl_macro_tmp_677.locale = (*(this6)).locale;
+  chpl_macro_tmp_677.addr = &(((*(this6)).addr)->aliasRefCnt);
+  chpl_gen_comm_get(((void*)(&ret3)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_677).locale), INT64(0), NULL), (chpl_macro_tmp_677).addr, sizeof(chpl____wide_string_refcnt), -1, INT64(1), INT64(138), "/root/repo/modules/standard/NewString.chpl");
+  chpl_macro_tmp_678.locale = (&ret2)->locale;
+  chpl_macro_tmp_678.addr = ((object)((&ret2)->addr));
+  call_tmp = chpl_macro_tmp_678;
+  chpl_macro_tmp_679.locale = (&ret3)->locale;
+  chpl_macro_tmp_679.addr = ((object)((&ret3)->addr));
+  call_tmp2 = chpl_macro_tmp_679;
+  call_tmp3 = (((&call_tmp)->addr != (&call_tmp2)->addr) || ((!(! (&call_tmp)->addr)) && (chpl_nodeFromLocaleID(&((&call_tmp)->locale), INT64(0), NULL) != chpl_nodeFromLocaleID(&((&call_tmp2)->locale), INT64(0), NULL))));
+  if (call_tmp3) {
+    ret = false;
+    goto _end_isEmptyString;
+  } else {
+    chpl_macro_tmp_680.locale = (*(this6)).locale;
+    chpl_macro_tmp_680.addr = &(((*(this6)).addr)->len);
+    chpl_gen_comm_get(((void*)(&ret4)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_680).locale), INT64(0), NULL), (chpl_macro_tmp_680).addr, sizeof(int64_t), -1, INT64(1), INT64(138), "/root/repo/modules/standard/NewString.chpl");
+    call_tmp4 = (ret4 == INT64(0));
+    ret = call_tmp4;
+    goto _end_isEmptyString;
+  }
+  _end_isEmptyString:;
+  if (ret) {
+    chpl_macro_tmp_681.locale = (*(this6)).locale;
+    chpl_macro_tmp_681.addr = &(((*(this6)).addr)->refCnt);
+    call_tmp5 = chpl_macro_tmp_681;
+    chpl_macro_tmp_682.locale = (*(this6)).locale;
+    chpl_macro_tmp_682.addr = &(((*(this6)).addr)->refCnt);
+    chpl_gen_comm_get(((void*)(&coerce_tmp)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_682).locale), INT64(0), NULL), (chpl_macro_tmp_682).addr, sizeof(chpl____wide_string_refcnt), -1, INT64(1), INT64(139), "/root/repo/modules/standard/NewString.chpl");
+    chpl_check_nil((&coerce_tmp)->addr, INT64(139), "/root/repo/modules/standard/NewString.chpl");
+    chpl_macro_tmp_683.locale = (&coerce_tmp)->locale;
+    chpl_macro_tmp_683.addr = &(((&coerce_tmp)->addr)->val);
+    _field_destructor_tmp_ = chpl_macro_tmp_683;
+    chpl_macro_tmp_684.locale = (_field_destructor_tmp_).locale;
+    chpl_macro_tmp_684.addr = &(((_field_destructor_tmp_).addr)->_cnt);
+    _field_destructor_tmp_2 = chpl_macro_tmp_684;
+    chpl_macro_tmp_685.locale = (_field_destructor_tmp_2).locale;
+    chpl_macro_tmp_685.addr = &(((_field_destructor_tmp_2).addr)->_v);
+    call_tmp6 = chpl_macro_tmp_685;
+    T = (&call_tmp6)->addr;
+    atomic_destroy_int_least64_t(T);
+    chpl_macro_tmp_686.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_686.addr = T;
+    call_tmp6 = chpl_macro_tmp_686;
+    chpl_gen_comm_get(((void*)(&T2)), chpl_nodeFromLocaleID(&((call_tmp5).locale), INT64(0), NULL), (call_tmp5).addr, sizeof(chpl____wide_string_refcnt), -1, INT64(1), INT64(139), "/root/repo/modules/standard/NewString.chpl");
+    call_tmp7 = (&T2)->locale;
+    chpl_macro_tmp_687.locale = (*(this6)).locale;
+    chpl_macro_tmp_687.addr = &(((*(this6)).addr)->refCnt);
+    chpl_gen_comm_get(((void*)(&rvfDerefTmp)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_687).locale), INT64(0), NULL), (chpl_macro_tmp_687).addr, sizeof(chpl____wide_string_refcnt), -1, INT64(1), INT64(139), "/root/repo/modules/standard/NewString.chpl");
+    _args_size = sizeof(chpl__class_localson_fn62_object);
+    _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn = ((_class_localson_fn62)(_args_alloc));
+    chpl_check_nil(_args_foron_fn, INT64(139), "/root/repo/modules/standard/NewString.chpl");
+    (_args_foron_fn)->_0__tmp = call_tmp7;
+    chpl_check_nil(_args_foron_fn, INT64(139), "/root/repo/modules/standard/NewString.chpl");
+    (_args_foron_fn)->_1_rvfDerefTmp = rvfDerefTmp;
+    (_args_foron_fn)->_ln = _ln;
+    (_args_foron_fn)->_fn = _fn;
+    /*** wrapon_fn62 ***/ chpl_executeOn(&call_tmp7, INT32(67), _args_foron_fn, sizeof(chpl__class_localson_fn62_object), INT64(139), "/root/repo/modules/standard/NewString.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  } else {
+    chpl_macro_tmp_688.locale = (*(this6)).locale;
+    chpl_macro_tmp_688.addr = &(((*(this6)).addr)->refCnt);
+    chpl_gen_comm_get(((void*)(&ret6)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_688).locale), INT64(0), NULL), (chpl_macro_tmp_688).addr, sizeof(chpl____wide_string_refcnt), -1, INT64(1), INT64(141), "/root/repo/modules/standard/NewString.chpl");
+    chpl_macro_tmp_689.locale = (*(this6)).locale;
+    chpl_macro_tmp_689.addr = &(((*(this6)).addr)->aliasRefCnt);
+    chpl_gen_comm_get(((void*)(&ret7)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_689).locale), INT64(0), NULL), (chpl_macro_tmp_689).addr, sizeof(chpl____wide_string_refcnt), -1, INT64(1), INT64(141), "/root/repo/modules/standard/NewString.chpl");
+    chpl_macro_tmp_690.locale = (&ret6)->locale;
+    chpl_macro_tmp_690.addr = ((object)((&ret6)->addr));
+    call_tmp8 = chpl_macro_tmp_690;
+    chpl_macro_tmp_691.locale = (&ret7)->locale;
+    chpl_macro_tmp_691.addr = ((object)((&ret7)->addr));
+    call_tmp9 = chpl_macro_tmp_691;
+    call_tmp10 = (((&call_tmp8)->addr != (&call_tmp9)->addr) || ((!(! (&call_tmp8)->addr)) && (chpl_nodeFromLocaleID(&((&call_tmp8)->locale), INT64(0), NULL) != chpl_nodeFromLocaleID(&((&call_tmp9)->locale), INT64(0), NULL))));
+    call_tmp11 = (! call_tmp10);
+    if (call_tmp11) {
+      chpl_macro_tmp_692.locale = (*(this6)).locale;
+      chpl_macro_tmp_692.addr = &(((*(this6)).addr)->refCnt);
+      chpl_gen_comm_get(((void*)(&ret8)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_692).locale), INT64(0), NULL), (chpl_macro_tmp_692).addr, sizeof(chpl____wide_string_refcnt), -1, INT64(1), INT64(141), "/root/repo/modules/standard/NewString.chpl");
+      coerce_tmp2 = ret8;
+      chpl_check_nil((&coerce_tmp2)->addr, INT64(141), "/root/repo/modules/standard/NewString.chpl");
+      chpl_macro_tmp_693.locale = (&coerce_tmp2)->locale;
+      chpl_macro_tmp_693.addr = &(((&coerce_tmp2)->addr)->val);
+      call_tmp12 = chpl_macro_tmp_693;
+      chpl_macro_tmp_694.locale = (call_tmp12).locale;
+      chpl_macro_tmp_694.addr = &(((call_tmp12).addr)->_cnt);
+      call_tmp13 = chpl_macro_tmp_694;
+      default_argorder = local_memory_order_seq_cst;
+      chpl_here_alloc_size = sizeof(chpl_heap_int64_t_object);
+      chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), _ln, _fn);
+      T3 = ((heap_int64_t)(chpl_here_alloc_tmp));
+      ret9 = T3;
+      chpl_check_nil(ret9, INT64(141), "/root/repo/modules/standard/NewString.chpl");
+      (ret9)->value = INT64(0);
+      call_tmp14 = (&call_tmp13)->locale;
+      chpl_check_nil(ret9, INT64(141), "/root/repo/modules/standard/NewString.chpl");
+      T4 = &((ret9)->value);
+      _args_size2 = sizeof(chpl__class_localson_fn6_object);
+      _args_alloc2 = chpl_mem_allocPooled(_args_size2, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+      _args_foron_fn2 = ((_class_localson_fn6)(_args_alloc2));
+      chpl_check_nil(_args_foron_fn2, INT64(141), "/root/repo/modules/standard/NewString.chpl");
+      (_args_foron_fn2)->_0__tmp = call_tmp14;
+      chpl_check_nil(_args_foron_fn2, INT64(141), "/root/repo/modules/standard/NewString.chpl");
+      (_args_foron_fn2)->_1_this = call_tmp13;
+      chpl_check_nil(_args_foron_fn2, INT64(141), "/root/repo/modules/standard/NewString.chpl");
+      (_args_foron_fn2)->_2_value = INT64(1);
+      chpl_check_nil(_args_foron_fn2, INT64(141), "/root/repo/modules/standard/NewString.chpl");
+      (_args_foron_fn2)->_3_order = default_argorder;
+      chpl_macro_tmp_695.locale = chpl_gen_getLocaleID();
+      chpl_macro_tmp_695.addr = T4;
+      T5 = chpl_macro_tmp_695;
+      chpl_check_nil(_args_foron_fn2, INT64(141), "/root/repo/modules/standard/NewString.chpl");
+      (_args_foron_fn2)->_4__tmp = T5;
+      (_args_foron_fn2)->_ln = _ln;
+      (_args_foron_fn2)->_fn = _fn;
+      /*** wrapon_fn6 ***/ chpl_executeOn(&call_tmp14, INT32(7), _args_foron_fn2, sizeof(chpl__class_localson_fn6_object), INT64(1107), "/root/repo/modules/internal/Atomics.chpl");
+      chpl_mem_freePooled(((void*)(_args_foron_fn2)), _ln, _fn);
+      chpl_check_nil(ret9, INT64(141), "/root/repo/modules/standard/NewString.chpl");
+      T6 = (ret9)->value;
+      chpl_here_free(((void*)(ret9)), _ln, _fn);
+      call_tmp15 = (T6 - INT64(1));
+      ret5 = call_tmp15;
+      goto _end_decRefCnt;
+    } else {
+      chpl_macro_tmp_696.locale = (*(this6)).locale;
+      chpl_macro_tmp_696.addr = &(((*(this6)).addr)->aliasRefCnt);
+      chpl_gen_comm_get(((void*)(&ret10)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_696).locale), INT64(0), NULL), (chpl_macro_tmp_696).addr, sizeof(chpl____wide_string_refcnt), -1, INT64(1), INT64(141), "/root/repo/modules/standard/NewString.chpl");
+      coerce_tmp3 = ret10;
+      chpl_check_nil((&coerce_tmp3)->addr, INT64(141), "/root/repo/modules/standard/NewString.chpl");
+      chpl_macro_tmp_697.locale = (&coerce_tmp3)->locale;
+      chpl_macro_tmp_697.addr = &(((&coerce_tmp3)->addr)->val);
+      call_tmp16 = chpl_macro_tmp_697;
+      chpl_macro_tmp_698.locale = (call_tmp16).locale;
+      chpl_macro_tmp_698.addr = &(((call_tmp16).addr)->_cnt);
+      call_tmp17 = chpl_macro_tmp_698;
+      default_argorder2 = local_memory_order_seq_cst;
+      chpl_here_alloc_size2 = sizeof(chpl_heap_int64_t_object);
+      chpl_here_alloc_tmp2 = chpl_here_alloc(chpl_here_alloc_size2, INT16(22), _ln, _fn);
+      T7 = ((heap_int64_t)(chpl_here_alloc_tmp2));
+      ret11 = T7;
+      chpl_check_nil(ret11, INT64(141), "/root/repo/modules/standard/NewString.chpl");
+      (ret11)->value = INT64(0);
+      call_tmp18 = (&call_tmp17)->locale;
+      chpl_check_nil(ret11, INT64(141), "/root/repo/modules/standard/NewString.chpl");
+      T8 = &((ret11)->value);
+      _args_size3 = sizeof(chpl__class_localson_fn6_object);
+      _args_alloc3 = chpl_mem_allocPooled(_args_size3, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+      _args_foron_fn3 = ((_class_localson_fn6)(_args_alloc3));
+      chpl_check_nil(_args_foron_fn3, INT64(141), "/root/repo/modules/standard/NewString.chpl");
+      (_args_foron_fn3)->_0__tmp = call_tmp18;
+      chpl_check_nil(_args_foron_fn3, INT64(141), "/root/repo/modules/standard/NewString.chpl");
+      (_args_foron_fn3)->_1_this = call_tmp17;
+      chpl_check_nil(_args_foron_fn3, INT64(141), "/root/repo/modules/standard/NewString.chpl");
+      (_args_foron_fn3)->_2_value = INT64(1);
+      chpl_check_nil(_args_foron_fn3, INT64(141), "/root/repo/modules/standard/NewString.chpl");
+      (_args_foron_fn3)->_3_order = default_argorder2;
+      chpl_macro_tmp_699.locale = chpl_gen_getLocaleID();
+      chpl_macro_tmp_699.addr = T8;
+      T9 = chpl_macro_tmp_699;
+      chpl_check_nil(_args_foron_fn3, INT64(141), "/root/repo/modules/standard/NewString.chpl");
+      (_args_foron_fn3)->_4__tmp = T9;
+      (_args_foron_fn3)->_ln = _ln;
+      (_args_foron_fn3)->_fn = _fn;
+      /*** wrapon_fn6 ***/ chpl_executeOn(&call_tmp18, INT32(7), _args_foron_fn3, sizeof(chpl__class_localson_fn6_object), INT64(1107), "/root/repo/modules/internal/Atomics.chpl");
+      chpl_mem_freePooled(((void*)(_args_foron_fn3)), _ln, _fn);
+      chpl_check_nil(ret11, INT64(141), "/root/repo/modules/standard/NewString.chpl");
+      T10 = (ret11)->value;
+      chpl_here_free(((void*)(ret11)), _ln, _fn);
+      call_tmp19 = (T10 - INT64(1));
+      ret5 = call_tmp19;
+      goto _end_decRefCnt;
+    }
+    _end_decRefCnt:;
+    call_tmp20 = (ret5 < INT64(0));
+    if (call_tmp20) {
+      T11 = "string reference count is negative!";
+      halt(T11, _ln, _fn);
+    }
+    call_tmp21 = (ret5 == INT64(0));
+    if (call_tmp21) {
+      chpl_macro_tmp_700.locale = (*(this6)).locale;
+      chpl_macro_tmp_700.addr = &(((*(this6)).addr)->home);
+      call_tmp22 = chpl_macro_tmp_700;
+      chpl_gen_comm_get(((void*)(&T12)), chpl_nodeFromLocaleID(&((call_tmp22).locale), INT64(0), NULL), (call_tmp22).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(145), "/root/repo/modules/standard/NewString.chpl");
+      call_tmp23 = (&T12)->locale;
+      _args_size4 = sizeof(chpl__class_localson_fn63_object);
+      _args_alloc4 = chpl_mem_allocPooled(_args_size4, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+      _args_foron_fn4 = ((_class_localson_fn63)(_args_alloc4));
+      chpl_check_nil(_args_foron_fn4, INT64(145), "/root/repo/modules/standard/NewString.chpl");
+      (_args_foron_fn4)->_0__tmp = call_tmp23;
+      chpl_check_nil(_args_foron_fn4, INT64(145), "/root/repo/modules/standard/NewString.chpl");
+      (_args_foron_fn4)->_1_this = *(this6);
+      (_args_foron_fn4)->_ln = _ln;
+      (_args_foron_fn4)->_fn = _fn;
+      /*** wrapon_fn63 ***/ chpl_executeOn(&call_tmp23, INT32(68), _args_foron_fn4, sizeof(chpl__class_localson_fn63_object), INT64(145), "/root/repo/modules/standard/NewString.chpl");
+      chpl_mem_freePooled(((void*)(_args_foron_fn4)), _ln, _fn);
+    } else {
+      chpl_macro_tmp_701.locale = (*(this6)).locale;
+      chpl_macro_tmp_701.addr = &(((*(this6)).addr)->refCnt);
+      chpl_gen_comm_get(((void*)(&ret12)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_701).locale), INT64(0), NULL), (chpl_macro_tmp_701).addr, sizeof(chpl____wide_string_refcnt), -1, INT64(1), INT64(151), "/root/repo/modules/standard/NewString.chpl");
+      chpl_macro_tmp_702.locale = (*(this6)).locale;
+      chpl_macro_tmp_702.addr = &(((*(this6)).addr)->aliasRefCnt);
+      chpl_gen_comm_get(((void*)(&ret13)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_702).locale), INT64(0), NULL), (chpl_macro_tmp_702).addr, sizeof(chpl____wide_string_refcnt), -1, INT64(1), INT64(151), "/root/repo/modules/standard/NewString.chpl");
+      chpl_macro_tmp_703.locale = (&ret12)->locale;
+      chpl_macro_tmp_703.addr = ((object)((&ret12)->addr));
+      call_tmp24 = chpl_macro_tmp_703;
+      chpl_macro_tmp_704.locale = (&ret13)->locale;
+      chpl_macro_tmp_704.addr = ((object)((&ret13)->addr));
+      call_tmp25 = chpl_macro_tmp_704;
+      call_tmp26 = (((&call_tmp24)->addr != (&call_tmp25)->addr) || ((!(! (&call_tmp24)->addr)) && (chpl_nodeFromLocaleID(&((&call_tmp24)->locale), INT64(0), NULL) != chpl_nodeFromLocaleID(&((&call_tmp25)->locale), INT64(0), NULL))));
+      if (call_tmp26) {
+        chpl_macro_tmp_705.locale = (*(this6)).locale;
+        chpl_macro_tmp_705.addr = &(((*(this6)).addr)->refCnt);
+        call_tmp27 = chpl_macro_tmp_705;
+        chpl_macro_tmp_706.locale = (*(this6)).locale;
+        chpl_macro_tmp_706.addr = &(((*(this6)).addr)->refCnt);
+        chpl_gen_comm_get(((void*)(&coerce_tmp4)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_706).locale), INT64(0), NULL), (chpl_macro_tmp_706).addr, sizeof(chpl____wide_string_refcnt), -1, INT64(1), INT64(151), "/root/repo/modules/standard/NewString.chpl");
+        chpl_check_nil((&coerce_tmp4)->addr, INT64(151), "/root/repo/modules/standard/NewString.chpl");
+        chpl_macro_tmp_707.locale = (&coerce_tmp4)->locale;
+        chpl_macro_tmp_707.addr = &(((&coerce_tmp4)->addr)->val);
+        _field_destructor_tmp_3 = chpl_macro_tmp_707;
+        chpl_macro_tmp_708.locale = (_field_destructor_tmp_3).locale;
+        chpl_macro_tmp_708.addr = &(((_field_destructor_tmp_3).addr)->_cnt);
+        _field_destructor_tmp_4 = chpl_macro_tmp_708;
+        chpl_macro_tmp_709.locale = (_field_destructor_tmp_4).locale;
+        chpl_macro_tmp_709.addr = &(((_field_destructor_tmp_4).addr)->_v);
+        call_tmp28 = chpl_macro_tmp_709;
+        T13 = (&call_tmp28)->addr;
+        atomic_destroy_int_least64_t(T13);
+        chpl_macro_tmp_710.locale = chpl_gen_getLocaleID();
+        chpl_macro_tmp_710.addr = T13;
+        call_tmp28 = chpl_macro_tmp_710;
+        chpl_gen_comm_get(((void*)(&T14)), chpl_nodeFromLocaleID(&((call_tmp27).locale), INT64(0), NULL), (call_tmp27).addr, sizeof(chpl____wide_string_refcnt), -1, INT64(1), INT64(151), "/root/repo/modules/standard/NewString.chpl");
+        call_tmp29 = (&T14)->locale;
+        chpl_macro_tmp_711.locale = (*(this6)).locale;
+        chpl_macro_tmp_711.addr = &(((*(this6)).addr)->refCnt);
+        chpl_gen_comm_get(((void*)(&rvfDerefTmp2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_711).locale), INT64(0), NULL), (chpl_macro_tmp_711).addr, sizeof(chpl____wide_string_refcnt), -1, INT64(1), INT64(151), "/root/repo/modules/standard/NewString.chpl");
+        _args_size5 = sizeof(chpl__class_localson_fn64_object);
+        _args_alloc5 = chpl_mem_allocPooled(_args_size5, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+        _args_foron_fn5 = ((_class_localson_fn64)(_args_alloc5));
+        chpl_check_nil(_args_foron_fn5, INT64(151), "/root/repo/modules/standard/NewString.chpl");
+        (_args_foron_fn5)->_0__tmp = call_tmp29;
+        chpl_check_nil(_args_foron_fn5, INT64(151), "/root/repo/modules/standard/NewString.chpl");
+        (_args_foron_fn5)->_1_rvfDerefTmp = rvfDerefTmp2;
+        (_args_foron_fn5)->_ln = _ln;
+        (_args_foron_fn5)->_fn = _fn;
+        /*** wrapon_fn64 ***/ chpl_executeOn(&call_tmp29, INT32(69), _args_foron_fn5, sizeof(chpl__class_localson_fn64_object), INT64(151), "/root/repo/modules/standard/NewString.chpl");
+        chpl_mem_freePooled(((void*)(_args_foron_fn5)), _ln, _fn);
+      }
+    }
+  }
+  return;
+}
+
+/* NewString.chpl:139 */
+static void on_fn62(chpl____wide_string_refcnt* const delete_tmp, int64_t _ln, c_string _fn) {
+  chpl_opaque call_tmp;
+  call_tmp = ((void*)((delete_tmp)->addr));
+  chpl_here_free(call_tmp, _ln, _fn);
+  return;
+}
+
+/* NewString.chpl:139 */
+static void wrapon_fn62(_class_localson_fn62 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_string_refcnt _1_rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(139), "/root/repo/modules/standard/NewString.chpl");
+  _1_rvfDerefTmp = (c)->_1_rvfDerefTmp;
+  on_fn62(&_1_rvfDerefTmp, _ln, _fn);
+  return;
+}
+
+/* NewString.chpl:145 */
+static void on_fn63(chpl____wide__ref_string_rec* const this6, int64_t _ln, c_string _fn) {
+  chpl____wide__ref_c_string call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  c_string coerce_tmp;
+  c_string call_tmp2;
+  int64_t call_tmp3;
+  chpl_bool call_tmp4;
+  _ref_c_string T = NULL;
+  chpl____wide__ref_string_refcnt call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_string_refcnt coerce_tmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_refcnt _field_destructor_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 _field_destructor_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int_least64_t call_tmp6 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_int_least64_t T2 = NULL;
+  chpl_localeID_t call_tmp7;
+  chpl____wide_string_refcnt T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_string_refcnt rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn66 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  chpl____wide_string_refcnt ret = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_string_refcnt ret2 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp8 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp9 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp10;
+  chpl____wide__ref_string_refcnt call_tmp11 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_string_refcnt coerce_tmp3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_refcnt _field_destructor_tmp_3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 _field_destructor_tmp_4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int_least64_t call_tmp12 = {CHPL_LOCALEID_T_INIT, NULL};
+  _ref_atomic_int_least64_t T4 = NULL;
+  chpl_localeID_t call_tmp13;
+  chpl____wide_string_refcnt T5 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_string_refcnt rvfDerefTmp2 = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn67 _args_foron_fn2 = NULL;
+  int64_t _args_size2;
+  chpl_opaque _args_alloc2;
+  chpl____wide__ref_c_string chpl_macro_tmp_712;
+  chpl____wide__ref_c_string chpl_macro_tmp_713;
+  chpl____wide__ref_c_string chpl_macro_tmp_714;
+  chpl____wide__ref_string_refcnt chpl_macro_tmp_715;
+  chpl____wide__ref_string_refcnt chpl_macro_tmp_716;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_717;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_718;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_719;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_720;
+  chpl____wide__ref_string_refcnt chpl_macro_tmp_721;
+  chpl____wide__ref_string_refcnt chpl_macro_tmp_722;
+  chpl____wide__ref_string_refcnt chpl_macro_tmp_723;
+  chpl____wide_object chpl_macro_tmp_724;
+  chpl____wide_object chpl_macro_tmp_725;
+  chpl____wide__ref_string_refcnt chpl_macro_tmp_726;
+  chpl____wide__ref_string_refcnt chpl_macro_tmp_727;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_728;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_729;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_730;
+  chpl____wide__ref_atomic_int_least64_t chpl_macro_tmp_731;
+  chpl____wide__ref_string_refcnt chpl_macro_tmp_732;
+  chpl_macro_tmp_712.locale = (*(this6)).locale;
+  chpl_macro_tmp_712.addr = &(((*(this6)).addr)->base);
+  call_tmp = chpl_macro_tmp_712;
+  chpl_macro_tmp_713.locale = (*(this6)).locale;
+  chpl_macro_tmp_713.addr = &(((*(this6)).addr)->base);
+  chpl_gen_comm_get(((void*)(&coerce_tmp)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_713).locale), INT64(0), NULL), (chpl_macro_tmp_713).addr, sizeof(c_string), -1, INT64(1), INT64(146), "/root/repo/modules/standard/NewString.chpl");
+  call_tmp2 = ((c_string)(NULL));
+  call_tmp3 = string_compare(coerce_tmp, call_tmp2);
+  call_tmp4 = (call_tmp3 == INT64(0));
+  if (call_tmp4) {
+    goto _end_free_baseType;
+  }
+  T = (&call_tmp)->addr;
+  chpl_rt_free_c_string(T, _ln, _fn);
+  chpl_macro_tmp_714.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_714.addr = T;
+  call_tmp = chpl_macro_tmp_714;
+  _end_free_baseType:;
+  chpl_macro_tmp_715.locale = (*(this6)).locale;
+  chpl_macro_tmp_715.addr = &(((*(this6)).addr)->refCnt);
+  call_tmp5 = chpl_macro_tmp_715;
+  chpl_macro_tmp_716.locale = (*(this6)).locale;
+  chpl_macro_tmp_716.addr = &(((*(this6)).addr)->refCnt);
+  chpl_gen_comm_get(((void*)(&coerce_tmp2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_716).locale), INT64(0), NULL), (chpl_macro_tmp_716).addr, sizeof(chpl____wide_string_refcnt), -1, INT64(1), INT64(147), "/root/repo/modules/standard/NewString.chpl");
+  chpl_check_nil((&coerce_tmp2)->addr, INT64(147), "/root/repo/modules/standard/NewString.chpl");
+  chpl_macro_tmp_717.locale = (&coerce_tmp2)->locale;
+  chpl_macro_tmp_717.addr = &(((&coerce_tmp2)->addr)->val);
+  _field_destructor_tmp_ = chpl_macro_tmp_717;
+  chpl_macro_tmp_718.locale = (_field_destructor_tmp_).locale;
+  chpl_macro_tmp_718.addr = &(((_field_destructor_tmp_).addr)->_cnt);
+  _field_destructor_tmp_2 = chpl_macro_tmp_718;
+  chpl_macro_tmp_719.locale = (_field_destructor_tmp_2).locale;
+  chpl_macro_tmp_719.addr = &(((_field_destructor_tmp_2).addr)->_v);
+  call_tmp6 = chpl_macro_tmp_719;
+  T2 = (&call_tmp6)->addr;
+  atomic_destroy_int_least64_t(T2);
+  chpl_macro_tmp_720.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_720.addr = T2;
+  call_tmp6 = chpl_macro_tmp_720;
+  chpl_gen_comm_get(((void*)(&T3)), chpl_nodeFromLocaleID(&((call_tmp5).locale), INT64(0), NULL), (call_tmp5).addr, sizeof(chpl____wide_string_refcnt), -1, INT64(1), INT64(147), "/root/repo/modules/standard/NewString.chpl");
+  call_tmp7 = (&T3)->locale;
+  chpl_macro_tmp_721.locale = (*(this6)).locale;
+  chpl_macro_tmp_721.addr = &(((*(this6)).addr)->refCnt);
+  chpl_gen_comm_get(((void*)(&rvfDerefTmp)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_721).locale), INT64(0), NULL), (chpl_macro_tmp_721).addr, sizeof(chpl____wide_string_refcnt), -1, INT64(1), INT64(147), "/root/repo/modules/standard/NewString.chpl");
+  _args_size = sizeof(chpl__class_localson_fn66_object);
+  _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+  _args_foron_fn = ((_class_localson_fn66)(_args_alloc));
+  chpl_check_nil(_args_foron_fn, INT64(147), "/root/repo/modules/standard/NewString.chpl");
+  (_args_foron_fn)->_0__tmp = call_tmp7;
+  chpl_check_nil(_args_foron_fn, INT64(147), "/root/repo/modules/standard/NewString.chpl");
+  (_args_foron_fn)->_1_rvfDerefTmp = rvfDerefTmp;
+  (_args_foron_fn)->_ln = _ln;
+  (_args_foron_fn)->_fn = _fn;
+  /*** wrapon_fn66 ***/ chpl_executeOn(&call_tmp7, INT32(71), _args_foron_fn, sizeof(chpl__class_localson_fn66_object), INT64(294), "/root/repo/modules/standard/NewString.chpl");
+  chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+  chpl_macro_tmp_722.locale = (*(this6)).locale;
+  chpl_macro_tmp_722.addr = &(((*(this6)).addr)->refCnt);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_722).locale), INT64(0), NULL), (chpl_macro_tmp_722).addr, sizeof(chpl____wide_string_refcnt), -1, INT64(1), INT64(147), "/root/repo/modules/standard/NewString.chpl");
+  chpl_macro_tmp_723.locale = (*(this6)).locale;
+  chpl_macro_tmp_723.addr = &(((*(this6)).addr)->aliasRefCnt);
+  chpl_gen_comm_get(((void*)(&ret2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_723).locale), INT64(0), NULL), (chpl_macro_tmp_723).addr, sizeof(chpl____wide_string_refcnt), -1, INT64(1), INT64(147), "/root/repo/modules/standard/NewString.chpl");
+  chpl_macro_tmp_724.locale = (&ret)->locale;
+  chpl_macro_tmp_724.addr = ((object)((&ret)->addr));
+  call_tmp8 = chpl_macro_tmp_724;
+  chpl_macro_tmp_725.locale = (&ret2)->locale;
+  chpl_macro_tmp_725.addr = ((object)((&ret2)->addr));
+  call_tmp9 = chpl_macro_tmp_725;
+  call_tmp10 = (((&call_tmp8)->addr != (&call_tmp9)->addr) || ((!(! (&call_tmp8)->addr)) && (chpl_nodeFromLocaleID(&((&call_tmp8)->locale), INT64(0), NULL) != chpl_nodeFromLocaleID(&((&call_tmp9)->locale), INT64(0), NULL))));
+  if (call_tmp10) {
+    chpl_macro_tmp_726.locale = (*(this6)).locale;
+    chpl_macro_tmp_726.addr = &(((*(this6)).addr)->aliasRefCnt);
+    call_tmp11 = chpl_macro_tmp_726;
+    chpl_macro_tmp_727.locale = (*(this6)).locale;
+    chpl_macro_tmp_727.addr = &(((*(this6)).addr)->aliasRefCnt);
+    chpl_gen_comm_get(((void*)(&coerce_tmp3)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_727).locale), INT64(0), NULL), (chpl_macro_tmp_727).addr, sizeof(chpl____wide_string_refcnt), -1, INT64(1), INT64(147), "/root/repo/modules/standard/NewString.chpl");
+    chpl_check_nil((&coerce_tmp3)->addr, INT64(147), "/root/repo/modules/standard/NewString.chpl");
+    chpl_macro_tmp_728.locale = (&coerce_tmp3)->locale;
+    chpl_macro_tmp_728.addr = &(((&coerce_tmp3)->addr)->val);
+    _field_destructor_tmp_3 = chpl_macro_tmp_728;
+    chpl_macro_tmp_729.locale = (_field_destructor_tmp_3).locale;
+    chpl_macro_tmp_729.addr = &(((_field_destructor_tmp_3).addr)->_cnt);
+    _field_destructor_tmp_4 = chpl_macro_tmp_729;
+    chpl_macro_tmp_730.locale = (_field_destructor_tmp_4).locale;
+    chpl_macro_tmp_730.addr = &(((_field_destructor_tmp_4).addr)->_v);
+    call_tmp12 = chpl_macro_tmp_730;
+    T4 = (&call_tmp12)->addr;
+    atomic_destroy_int_least64_t(T4);
+    chpl_macro_tmp_731.locale = chpl_gen_getLocaleID();
+    chpl_macro_tmp_731.addr = T4;
+    call_tmp12 = chpl_macro_tmp_731;
+    chpl_gen_comm_get(((void*)(&T5)), chpl_nodeFromLocaleID(&((call_tmp11).locale), INT64(0), NULL), (call_tmp11).addr, sizeof(chpl____wide_string_refcnt), -1, INT64(1), INT64(147), "/root/repo/modules/standard/NewString.chpl");
+    call_tmp13 = (&T5)->locale;
+    chpl_macro_tmp_732.locale = (*(this6)).locale;
+    chpl_macro_tmp_732.addr = &(((*(this6)).addr)->aliasRefCnt);
+    chpl_gen_comm_get(((void*)(&rvfDerefTmp2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_732).locale), INT64(0), NULL), (chpl_macro_tmp_732).addr, sizeof(chpl____wide_string_refcnt), -1, INT64(1), INT64(147), "/root/repo/modules/standard/NewString.chpl");
+    _args_size2 = sizeof(chpl__class_localson_fn67_object);
+    _args_alloc2 = chpl_mem_allocPooled(_args_size2, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+    _args_foron_fn2 = ((_class_localson_fn67)(_args_alloc2));
+    chpl_check_nil(_args_foron_fn2, INT64(147), "/root/repo/modules/standard/NewString.chpl");
+    (_args_foron_fn2)->_0__tmp = call_tmp13;
+    chpl_check_nil(_args_foron_fn2, INT64(147), "/root/repo/modules/standard/NewString.chpl");
+    (_args_foron_fn2)->_1_rvfDerefTmp = rvfDerefTmp2;
+    (_args_foron_fn2)->_ln = _ln;
+    (_args_foron_fn2)->_fn = _fn;
+    /*** wrapon_fn67 ***/ chpl_executeOn(&call_tmp13, INT32(72), _args_foron_fn2, sizeof(chpl__class_localson_fn67_object), INT64(295), "/root/repo/modules/standard/NewString.chpl");
+    chpl_mem_freePooled(((void*)(_args_foron_fn2)), _ln, _fn);
+  }
+  return;
+}
+
+/* NewString.chpl:145 */
+static void wrapon_fn63(_class_localson_fn63 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_string_rec _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(145), "/root/repo/modules/standard/NewString.chpl");
+  _1_this = (c)->_1_this;
+  on_fn63(&_1_this, _ln, _fn);
+  return;
+}
+
+/* NewString.chpl:151 */
+static void on_fn64(chpl____wide_string_refcnt* const delete_tmp, int64_t _ln, c_string _fn) {
+  chpl_opaque call_tmp;
+  call_tmp = ((void*)((delete_tmp)->addr));
+  chpl_here_free(call_tmp, _ln, _fn);
+  return;
+}
+
+/* NewString.chpl:151 */
+static void wrapon_fn64(_class_localson_fn64 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_string_refcnt _1_rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(151), "/root/repo/modules/standard/NewString.chpl");
+  _1_rvfDerefTmp = (c)->_1_rvfDerefTmp;
+  on_fn64(&_1_rvfDerefTmp, _ln, _fn);
+  return;
+}
+
+/* NewString.chpl:158 */
+static void reinitString(chpl____wide__ref_string_rec* const this6, c_string s, int64_t slen, int64_t _ln, c_string _fn) {
+  memory_order local_memory_order_seq_cst;
+  int32_t call_tmp;
+  int32_t call_tmp2;
+  chpl_localeID_t call_tmp3;
+  _ref_chpl_localeID_t ret_to_arg_ref_tmp_ = NULL;
+  chpl_localeID_t call_tmp4;
+  chpl____wide_locale call_tmp5 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp6;
+  int64_t call_tmp7;
+  chpl_bool call_tmp8;
+  chpl____wide_locale ret = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp9;
+  int32_t call_tmp10;
+  chpl_localeID_t call_tmp11;
+  _ref_chpl_localeID_t ret_to_arg_ref_tmp_2 = NULL;
+  chpl_localeID_t call_tmp12;
+  chpl____wide_locale call_tmp13 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp14;
+  chpl_bool call_tmp15;
+  chpl_bool ret2;
+  chpl____wide_string_refcnt ret3 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_string_refcnt ret4 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp16 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_object call_tmp17 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_bool call_tmp18;
+  int64_t ret5;
+  chpl_bool call_tmp19;
+  chpl_bool call_tmp20;
+  chpl_bool T;
+  int64_t call_tmp21;
+  chpl_bool call_tmp22;
+  chpl____wide_string_refcnt ret6 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_string_refcnt coerce_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_refcnt call_tmp23 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_atomic_int64 call_tmp24 = {CHPL_LOCALEID_T_INIT, NULL};
+  memory_order default_argorder;
+  chpl_localeID_t call_tmp25;
+  _class_localson_fn5 _args_foron_fn = NULL;
+  int64_t _args_size;
+  chpl_opaque _args_alloc;
+  int64_t new_len;
+  int64_t T2;
+  chpl_bool call_tmp26;
+  int64_t call_tmp27;
+  chpl_bool call_tmp28;
+  int64_t ret7;
+  chpl_bool call_tmp29;
+  chpl____wide__ref_c_string call_tmp30 = {CHPL_LOCALEID_T_INIT, NULL};
+  c_string ret8;
+  c_string call_tmp31;
+  int64_t ret9;
+  chpl_bool call_tmp32;
+  chpl____wide__ref_locale call_tmp33 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl_localeID_t call_tmp34;
+  chpl____wide_locale T3 = {CHPL_LOCALEID_T_INIT, NULL};
+  _class_localson_fn65 _args_foron_fn2 = NULL;
+  int64_t _args_size2;
+  chpl_opaque _args_alloc2;
+  chpl____wide__ref_c_string call_tmp35 = {CHPL_LOCALEID_T_INIT, NULL};
+  c_string call_tmp36;
+  int64_t ret10;
+  chpl_bool call_tmp37;
+  chpl____wide__ref_c_string call_tmp38 = {CHPL_LOCALEID_T_INIT, NULL};
+  c_string coerce_tmp2;
+  c_string call_tmp39;
+  int64_t call_tmp40;
+  chpl_bool call_tmp41;
+  _ref_c_string T4 = NULL;
+  chpl____wide__ref_c_string call_tmp42 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_int64_t call_tmp43 = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide__ref_locale chpl_macro_tmp_733;
+  chpl____wide__ref_string_refcnt chpl_macro_tmp_734;
+  chpl____wide__ref_string_refcnt chpl_macro_tmp_735;
+  chpl____wide_object chpl_macro_tmp_736;
+  chpl____wide_object chpl_macro_tmp_737;
+  chpl____wide__ref_int64_t chpl_macro_tmp_738;
+  chpl____wide__ref_string_refcnt chpl_macro_tmp_739;
+  chpl____wide__ref_atomic_refcnt chpl_macro_tmp_740;
+  chpl____wide__ref_atomic_int64 chpl_macro_tmp_741;
+  chpl____wide__ref_int64_t chpl_macro_tmp_742;
+  chpl____wide__ref_c_string chpl_macro_tmp_743;
+  chpl____wide__ref_c_string chpl_macro_tmp_744;
+  chpl____wide__ref_int64_t chpl_macro_tmp_745;
+  chpl____wide__ref_locale chpl_macro_tmp_746;
+  chpl____wide__ref_c_string chpl_macro_tmp_747;
+  chpl____wide__ref_int64_t chpl_macro_tmp_748;
+  chpl____wide__ref_c_string chpl_macro_tmp_749;
+  chpl____wide__ref_c_string chpl_macro_tmp_750;
+  chpl____wide__ref_c_string chpl_macro_tmp_751;
+  chpl____wide__ref_c_string chpl_macro_tmp_752;
+  c_string chpl_macro_tmp_753;
+  chpl____wide__ref_int64_t chpl_macro_tmp_754;
+  local_memory_order_seq_cst = memory_order_seq_cst;
+  call_tmp = chpl_nodeID;
+  call_tmp2 = chpl_task_getRequestedSubloc();
+  ret_to_arg_ref_tmp_ = &call_tmp3;
+  chpl_buildLocaleID(chpl_nodeID, call_tmp2, ret_to_arg_ref_tmp_, _ln, _fn);
+  call_tmp4 = chpl__initCopy_chpl_rt_localeID_t(call_tmp3);
+  call_tmp5 = chpl_localeID_to_locale(&call_tmp4, _ln, _fn);
+  chpl_check_nil((&call_tmp5)->addr, INT64(159), "/root/repo/modules/standard/NewString.chpl");
+  call_tmp6 = id(&call_tmp5, _ln, _fn);
+  call_tmp7 = ((int64_t)(call_tmp));
+  call_tmp8 = (call_tmp7 == call_tmp6);
+  assert2(call_tmp8, _ln, _fn);
+  chpl_macro_tmp_733.locale = (*(this6)).locale;
+  chpl_macro_tmp_733.addr = &(((*(this6)).addr)->home);
+  chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_733).locale), INT64(0), NULL), (chpl_macro_tmp_733).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(160), "/root/repo/modules/standard/NewString.chpl");
+  chpl_check_nil((&ret)->addr, INT64(160), "/root/repo/modules/standard/NewString.chpl");
+  call_tmp9 = id(&ret, _ln, _fn);
+  call_tmp10 = chpl_task_getRequestedSubloc();
+  ret_to_arg_ref_tmp_2 = &call_tmp11;
+  chpl_buildLocaleID(chpl_nodeID, call_tmp10, ret_to_arg_ref_tmp_2, _ln, _fn);
+  call_tmp12 = chpl__initCopy_chpl_rt_localeID_t(call_tmp11);
+  call_tmp13 = chpl_localeID_to_locale(&call_tmp12, _ln, _fn);
+  chpl_check_nil((&call_tmp13)->addr, INT64(160), "/root/repo/modules/standard/NewString.chpl");
+  call_tmp14 = id(&call_tmp13, _ln, _fn);
+  call_tmp15 = (call_tmp9 == call_tmp14);
+  assert2(call_tmp15, _ln, _fn);
+  chpl_macro_tmp_734.locale = (*(this6)).locale;
+  chpl_macro_tmp_734.addr = &(((*(this6)).addr)->refCnt);
+  chpl_gen_comm_get(((void*)(&ret3)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_734).locale), INT64(0), NULL), (chpl_macro_tmp_734).addr, sizeof(chpl____wide_string_refcnt), -1, INT64(1), INT64(162), "/root/repo/modules/standard/NewString.chpl");
+  chpl_macro_tmp_735.locale = (*(this6)).locale;
+  chpl_macro_tmp_735.addr = &(((*(this6)).addr)->aliasRefCnt);
+  chpl_gen_comm_get(((void*)(&ret4)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_735).locale), INT64(0), NULL), (chpl_macro_tmp_735).addr, sizeof(chpl____wide_string_refcnt), -1, INT64(1), INT64(162), "/root/repo/modules/standard/NewString.chpl");
+  chpl_macro_tmp_736.locale = (&ret3)->locale;
+  chpl_macro_tmp_736.addr = ((object)((&ret3)->addr));
+  call_tmp16 = chpl_macro_tmp_736;
+  chpl_macro_tmp_737.locale = (&ret4)->locale;
+  chpl_macro_tmp_737.addr = ((object)((&ret4)->addr));
+  call_tmp17 = chpl_macro_tmp_737;
+  call_tmp18 = (((&call_tmp16)->addr != (&call_tmp17)->addr) || ((!(! (&call_tmp16)->addr)) && (chpl_nodeFromLocaleID(&((&call_tmp16)->locale), INT64(0), NULL) != chpl_nodeFromLocaleID(&((&call_tmp17)->locale), INT64(0), NULL))));
+  if (call_tmp18) {
+    ret2 = false;
+    goto _end_isEmptyString;
+  } else {
+    chpl_macro_tmp_738.locale = (*(this6)).locale;
+    chpl_macro_tmp_738.addr = &(((*(this6)).addr)->len);
+    chpl_gen_comm_get(((void*)(&ret5)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_738).locale), INT64(0), NULL), (chpl_macro_tmp_738).addr, sizeof(int64_t), -1, INT64(1), INT64(162), "/root/repo/modules/standard/NewString.chpl");
+    call_tmp19 = (ret5 == INT64(0));
+    ret2 = call_tmp19;
+    goto _end_isEmptyString;
+  }
+  _end_isEmptyString:;
+  if (ret2) {
+    call_tmp20 = (slen == INT64(0));
+    if (call_tmp20) {
+      T = true;
+    } else {
+      call_tmp21 = string_compare(s, "");
+      call_tmp22 = (call_tmp21 == INT64(0));
+      T = call_tmp22;
+    }
+    if (T) {
+      goto _end_reinitString;
+    } else {
+      chpl_macro_tmp_739.locale = (*(this6)).locale;
+      chpl_macro_tmp_739.addr = &(((*(this6)).addr)->refCnt);
+      chpl_gen_comm_get(((void*)(&ret6)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_739).locale), INT64(0), NULL), (chpl_macro_tmp_739).addr, sizeof(chpl____wide_string_refcnt), -1, INT64(1), INT64(164), "/root/repo/modules/standard/NewString.chpl");
+      coerce_tmp = ret6;
+      chpl_check_nil((&coerce_tmp)->addr, INT64(164), "/root/repo/modules/standard/NewString.chpl");
+      chpl_macro_tmp_740.locale = (&coerce_tmp)->locale;
+      chpl_macro_tmp_740.addr = &(((&coerce_tmp)->addr)->val);
+      call_tmp23 = chpl_macro_tmp_740;
+      chpl_macro_tmp_741.locale = (call_tmp23).locale;
+      chpl_macro_tmp_741.addr = &(((call_tmp23).addr)->_cnt);
+      call_tmp24 = chpl_macro_tmp_741;
+      default_argorder = local_memory_order_seq_cst;
+      call_tmp25 = (&call_tmp24)->locale;
+      _args_size = sizeof(chpl__class_localson_fn5_object);
+      _args_alloc = chpl_mem_allocPooled(_args_size, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+      _args_foron_fn = ((_class_localson_fn5)(_args_alloc));
+      chpl_check_nil(_args_foron_fn, INT64(164), "/root/repo/modules/standard/NewString.chpl");
+      (_args_foron_fn)->_0__tmp = call_tmp25;
+      chpl_check_nil(_args_foron_fn, INT64(164), "/root/repo/modules/standard/NewString.chpl");
+      (_args_foron_fn)->_1_this = call_tmp24;
+      chpl_check_nil(_args_foron_fn, INT64(164), "/root/repo/modules/standard/NewString.chpl");
+      (_args_foron_fn)->_2_value = INT64(1);
+      chpl_check_nil(_args_foron_fn, INT64(164), "/root/repo/modules/standard/NewString.chpl");
+      (_args_foron_fn)->_3_order = default_argorder;
+      (_args_foron_fn)->_ln = _ln;
+      (_args_foron_fn)->_fn = _fn;
+      /*** wrapon_fn5 ***/ chpl_executeOn(&call_tmp25, INT32(6), _args_foron_fn, sizeof(chpl__class_localson_fn5_object), INT64(1103), "/root/repo/modules/internal/Atomics.chpl");
+      chpl_mem_freePooled(((void*)(_args_foron_fn)), _ln, _fn);
+    }
+  }
+  call_tmp26 = (slen == INT64(-1));
+  if (call_tmp26) {
+    call_tmp27 = string_length(s);
+    T2 = call_tmp27;
+  } else {
+    T2 = slen;
+  }
+  new_len = T2;
+  call_tmp28 = (T2 != INT64(0));
+  if (call_tmp28) {
+    chpl_macro_tmp_742.locale = (*(this6)).locale;
+    chpl_macro_tmp_742.addr = &(((*(this6)).addr)->len);
+    chpl_gen_comm_get(((void*)(&ret7)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_742).locale), INT64(0), NULL), (chpl_macro_tmp_742).addr, sizeof(int64_t), -1, INT64(1), INT64(169), "/root/repo/modules/standard/NewString.chpl");
+    call_tmp29 = (T2 < ret7);
+    if (call_tmp29) {
+      chpl_macro_tmp_743.locale = (*(this6)).locale;
+      chpl_macro_tmp_743.addr = &(((*(this6)).addr)->base);
+      call_tmp30 = chpl_macro_tmp_743;
+      chpl_macro_tmp_744.locale = (*(this6)).locale;
+      chpl_macro_tmp_744.addr = &(((*(this6)).addr)->base);
+      chpl_gen_comm_get(((void*)(&ret8)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_744).locale), INT64(0), NULL), (chpl_macro_tmp_744).addr, sizeof(c_string), -1, INT64(1), INT64(171), "/root/repo/modules/standard/NewString.chpl");
+      call_tmp31 = stringMove(ret8, s, T2, _ln, _fn);
+      chpl_gen_comm_put(((void*)(&call_tmp31)), chpl_nodeFromLocaleID(&((call_tmp30).locale), INT64(0), NULL), (call_tmp30).addr, sizeof(c_string), -1, INT64(1), INT64(171), "/root/repo/modules/standard/NewString.chpl");
+    } else {
+      chpl_macro_tmp_745.locale = (*(this6)).locale;
+      chpl_macro_tmp_745.addr = &(((*(this6)).addr)->len);
+      chpl_gen_comm_get(((void*)(&ret9)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_745).locale), INT64(0), NULL), (chpl_macro_tmp_745).addr, sizeof(int64_t), -1, INT64(1), INT64(174), "/root/repo/modules/standard/NewString.chpl");
+      call_tmp32 = (ret9 != INT64(0));
+      if (call_tmp32) {
+        chpl_macro_tmp_746.locale = (*(this6)).locale;
+        chpl_macro_tmp_746.addr = &(((*(this6)).addr)->home);
+        call_tmp33 = chpl_macro_tmp_746;
+        chpl_gen_comm_get(((void*)(&T3)), chpl_nodeFromLocaleID(&((call_tmp33).locale), INT64(0), NULL), (call_tmp33).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(175), "/root/repo/modules/standard/NewString.chpl");
+        call_tmp34 = (&T3)->locale;
+        _args_size2 = sizeof(chpl__class_localson_fn65_object);
+        _args_alloc2 = chpl_mem_allocPooled(_args_size2, (INT16(23) + chpl_memhook_md_num()), _ln, _fn);
+        _args_foron_fn2 = ((_class_localson_fn65)(_args_alloc2));
+        chpl_check_nil(_args_foron_fn2, INT64(175), "/root/repo/modules/standard/NewString.chpl");
+        (_args_foron_fn2)->_0__tmp = call_tmp34;
+        chpl_check_nil(_args_foron_fn2, INT64(175), "/root/repo/modules/standard/NewString.chpl");
+        (_args_foron_fn2)->_1_this = *(this6);
+        (_args_foron_fn2)->_ln = _ln;
+        (_args_foron_fn2)->_fn = _fn;
+        /*** wrapon_fn65 ***/ chpl_executeOn(&call_tmp34, INT32(70), _args_foron_fn2, sizeof(chpl__class_localson_fn65_object), INT64(175), "/root/repo/modules/standard/NewString.chpl");
+        chpl_mem_freePooled(((void*)(_args_foron_fn2)), _ln, _fn);
+      }
+      chpl_macro_tmp_747.locale = (*(this6)).locale;
+      chpl_macro_tmp_747.addr = &(((*(this6)).addr)->base);
+      call_tmp35 = chpl_macro_tmp_747;
+      call_tmp36 = stringMove("", s, T2, _ln, _fn);
+      chpl_gen_comm_put(((void*)(&call_tmp36)), chpl_nodeFromLocaleID(&((call_tmp35).locale), INT64(0), NULL), (call_tmp35).addr, sizeof(c_string), -1, INT64(1), INT64(177), "/root/repo/modules/standard/NewString.chpl");
+    }
+  } else {
+    chpl_macro_tmp_748.locale = (*(this6)).locale;
+    chpl_macro_tmp_748.addr = &(((*(this6)).addr)->len);
+    chpl_gen_comm_get(((void*)(&ret10)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_748).locale), INT64(0), NULL), (chpl_macro_tmp_748).addr, sizeof(int64_t), -1, INT64(1), INT64(181), "/root/repo/modules/standard/NewString.chpl");
+    call_tmp37 = (ret10 != INT64(0));
+    if (call_tmp37) {
+      chpl_macro_tmp_749.locale = (*(this6)).locale;
+      chpl_macro_tmp_749.addr = &(((*(this6)).addr)->base);
+      call_tmp38 = chpl_macro_tmp_749;
+      chpl_macro_tmp_750.locale = (*(this6)).locale;
+      chpl_macro_tmp_750.addr = &(((*(this6)).addr)->base);
+      chpl_gen_comm_get(((void*)(&coerce_tmp2)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_750).locale), INT64(0), NULL), (chpl_macro_tmp_750).addr, sizeof(c_string), -1, INT64(1), INT64(181), "/root/repo/modules/standard/NewString.chpl");
+      call_tmp39 = ((c_string)(NULL));
+      call_tmp40 = string_compare(coerce_tmp2, call_tmp39);
+      call_tmp41 = (call_tmp40 == INT64(0));
+      if (call_tmp41) {
+        goto _end_free_baseType;
+      }
+      T4 = (&call_tmp38)->addr;
+      chpl_rt_free_c_string(T4, _ln, _fn);
+      chpl_macro_tmp_751.locale = chpl_gen_getLocaleID();
+      chpl_macro_tmp_751.addr = T4;
+      call_tmp38 = chpl_macro_tmp_751;
+      _end_free_baseType:;
+    }
+    chpl_macro_tmp_752.locale = (*(this6)).locale;
+    chpl_macro_tmp_752.addr = &(((*(this6)).addr)->base);
+    call_tmp42 = chpl_macro_tmp_752;
+    chpl_macro_tmp_753 = "";
+    chpl_gen_comm_put(((void*)(&chpl_macro_tmp_753)), chpl_nodeFromLocaleID(&((call_tmp42).locale), INT64(0), NULL), (call_tmp42).addr, sizeof(c_string), -1, INT64(1), INT64(182), "/root/repo/modules/standard/NewString.chpl");
+  }
+  chpl_macro_tmp_754.locale = (*(this6)).locale;
+  chpl_macro_tmp_754.addr = &(((*(this6)).addr)->len);
+  call_tmp43 = chpl_macro_tmp_754;
+  chpl_gen_comm_put(((void*)(&new_len)), chpl_nodeFromLocaleID(&((call_tmp43).locale), INT64(0), NULL), (call_tmp43).addr, sizeof(int64_t), -1, INT64(1), INT64(184), "/root/repo/modules/standard/NewString.chpl");
+  _end_reinitString:;
+  return;
+}
+
+/* NewString.chpl:175 */
+static void on_fn65(chpl____wide__ref_string_rec* const this6, int64_t _ln, c_string _fn) {
+  chpl____wide__ref_c_string call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  c_string coerce_tmp;
+  c_string call_tmp2;
+  int64_t call_tmp3;
+  chpl_bool call_tmp4;
+  _ref_c_string T = NULL;
+  chpl____wide__ref_c_string chpl_macro_tmp_755;
+  chpl____wide__ref_c_string chpl_macro_tmp_756;
+  chpl____wide__ref_c_string chpl_macro_tmp_757;
+  chpl_macro_tmp_755.locale = (*(this6)).locale;
+  chpl_macro_tmp_755.addr = &(((*(this6)).addr)->base);
+  call_tmp = chpl_macro_tmp_755;
+  chpl_macro_tmp_756.locale = (*(this6)).locale;
+  chpl_macro_tmp_756.addr = &(((*(this6)).addr)->base);
+  chpl_gen_comm_get(((void*)(&coerce_tmp)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_756).locale), INT64(0), NULL), (chpl_macro_tmp_756).addr, sizeof(c_string), -1, INT64(1), INT64(175), "/root/repo/modules/standard/NewString.chpl");
+  call_tmp2 = ((c_string)(NULL));
+  call_tmp3 = string_compare(coerce_tmp, call_tmp2);
+  call_tmp4 = (call_tmp3 == INT64(0));
+  if (call_tmp4) {
+    goto _end_free_baseType;
+  }
+  T = (&call_tmp)->addr;
+  chpl_rt_free_c_string(T, _ln, _fn);
+  chpl_macro_tmp_757.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_757.addr = T;
+  call_tmp = chpl_macro_tmp_757;
+  _end_free_baseType:;
+  return;
+}
+
+/* NewString.chpl:175 */
+static void wrapon_fn65(_class_localson_fn65 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide__ref_string_rec _1_this = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(175), "/root/repo/modules/standard/NewString.chpl");
+  _1_this = (c)->_1_this;
+  on_fn65(&_1_this, _ln, _fn);
+  return;
+}
+
+/* NewString.chpl:294 */
+static void on_fn66(chpl____wide_string_refcnt* const delete_tmp, int64_t _ln, c_string _fn) {
+  chpl_opaque call_tmp;
+  call_tmp = ((void*)((delete_tmp)->addr));
+  chpl_here_free(call_tmp, _ln, _fn);
+  return;
+}
+
+/* NewString.chpl:294 */
+static void wrapon_fn66(_class_localson_fn66 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_string_refcnt _1_rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(294), "/root/repo/modules/standard/NewString.chpl");
+  _1_rvfDerefTmp = (c)->_1_rvfDerefTmp;
+  on_fn66(&_1_rvfDerefTmp, _ln, _fn);
+  return;
+}
+
+/* NewString.chpl:295 */
+static void on_fn67(chpl____wide_string_refcnt* const delete_tmp, int64_t _ln, c_string _fn) {
+  chpl_opaque call_tmp;
+  call_tmp = ((void*)((delete_tmp)->addr));
+  chpl_here_free(call_tmp, _ln, _fn);
+  return;
+}
+
+/* NewString.chpl:295 */
+static void wrapon_fn67(_class_localson_fn67 c) {
+  int64_t _ln;
+  c_string _fn;
+  chpl____wide_string_refcnt _1_rvfDerefTmp = {CHPL_LOCALEID_T_INIT, NULL};
+  _ln = (c)->_ln;
+  _fn = (c)->_fn;
+  chpl_check_nil(c, INT64(295), "/root/repo/modules/standard/NewString.chpl");
+  _1_rvfDerefTmp = (c)->_1_rvfDerefTmp;
+  on_fn67(&_1_rvfDerefTmp, _ln, _fn);
+  return;
+}
+
+/* NewString.chpl:397 */
+static void chpl___ASSIGN_7(chpl____wide__ref_string_rec* const lhs, c_string rhs_c, int64_t _ln, c_string _fn) {
+  int32_t call_tmp;
+  chpl_localeID_t call_tmp2;
+  _ref_chpl_localeID_t ret_to_arg_ref_tmp_ = NULL;
+  chpl_localeID_t call_tmp3;
+  chpl____wide_locale call_tmp4 = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp5;
+  int32_t call_tmp6;
+  int64_t call_tmp7;
+  chpl_bool call_tmp8;
+  chpl_bool T;
+  chpl____wide_locale ret = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t call_tmp9;
+  chpl_bool call_tmp10;
+  c_string T2;
+  int64_t call_tmp11;
+  chpl____wide__ref_locale chpl_macro_tmp_758;
+  call_tmp = chpl_task_getRequestedSubloc();
+  ret_to_arg_ref_tmp_ = &call_tmp2;
+  chpl_buildLocaleID(chpl_nodeID, call_tmp, ret_to_arg_ref_tmp_, _ln, _fn);
+  call_tmp3 = chpl__initCopy_chpl_rt_localeID_t(call_tmp2);
+  call_tmp4 = chpl_localeID_to_locale(&call_tmp3, _ln, _fn);
+  chpl_check_nil((&call_tmp4)->addr, INT64(399), "/root/repo/modules/standard/NewString.chpl");
+  call_tmp5 = id(&call_tmp4, _ln, _fn);
+  call_tmp6 = chpl_nodeID;
+  call_tmp7 = ((int64_t)(call_tmp6));
+  call_tmp8 = (call_tmp7 != call_tmp5);
+  if (call_tmp8) {
+    T = true;
+  } else {
+    chpl_macro_tmp_758.locale = (*(lhs)).locale;
+    chpl_macro_tmp_758.addr = &(((*(lhs)).addr)->home);
+    chpl_gen_comm_get(((void*)(&ret)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_758).locale), INT64(0), NULL), (chpl_macro_tmp_758).addr, sizeof(chpl____wide_locale), -1, INT64(1), INT64(401), "/root/repo/modules/standard/NewString.chpl");
+    chpl_check_nil((&ret)->addr, INT64(401), "/root/repo/modules/standard/NewString.chpl");
+    call_tmp9 = id(&ret, _ln, _fn);
+    call_tmp10 = (call_tmp9 != call_tmp5);
+    T = call_tmp10;
+  }
+  if (T) {
+    T2 = "Cannot assign a remote c_string to a string.";
+    halt(T2, _ln, _fn);
+  }
+  call_tmp11 = string_length(rhs_c);
+  reinitString(lhs, rhs_c, call_tmp11, _ln, _fn);
+  return;
+}
+
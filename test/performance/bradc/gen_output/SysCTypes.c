@@ -0,0 +1,123 @@
+/* SysCTypes.chpl:1 */
+static void chpl__init_SysCTypes(int64_t _ln, c_string _fn) {
+  c_string modFormatStr;
+  c_string modStr;
+  _ref_int32_t refIndentLevel = NULL;
+  uint64_t call_tmp;
+  int32_t call_tmp2;
+  uint64_t call_tmp3;
+  chpl_bool call_tmp4;
+  uint64_t call_tmp5;
+  uint32_t call_tmp6;
+  uint64_t call_tmp7;
+  chpl_bool call_tmp8;
+  uint64_t call_tmp9;
+  int64_t call_tmp10;
+  uint64_t call_tmp11;
+  chpl_bool call_tmp12;
+  uint64_t call_tmp13;
+  uint64_t call_tmp14;
+  uint64_t call_tmp15;
+  chpl_bool call_tmp16;
+  uint64_t call_tmp17;
+  int64_t call_tmp18;
+  uint64_t call_tmp19;
+  chpl_bool call_tmp20;
+  uint64_t call_tmp21;
+  uint64_t call_tmp22;
+  uint64_t call_tmp23;
+  chpl_bool call_tmp24;
+  uint64_t call_tmp25;
+  int8_t call_tmp26;
+  uint64_t call_tmp27;
+  chpl_bool call_tmp28;
+  uint64_t call_tmp29;
+  int8_t call_tmp30;
+  uint64_t call_tmp31;
+  chpl_bool call_tmp32;
+  uint64_t call_tmp33;
+  uint8_t call_tmp34;
+  uint64_t call_tmp35;
+  chpl_bool call_tmp36;
+  uint64_t call_tmp37;
+  int16_t call_tmp38;
+  uint64_t call_tmp39;
+  chpl_bool call_tmp40;
+  uint64_t call_tmp41;
+  uint16_t call_tmp42;
+  uint64_t call_tmp43;
+  chpl_bool call_tmp44;
+  uint64_t call_tmp45;
+  int64_t call_tmp46;
+  uint64_t call_tmp47;
+  chpl_bool call_tmp48;
+  uint64_t call_tmp49;
+  uint64_t call_tmp50;
+  uint64_t call_tmp51;
+  chpl_bool call_tmp52;
+  if (chpl__init_SysCTypes_p) {
+    goto _exit_chpl__init_SysCTypes;
+  }
+  modFormatStr = "%*s\n";
+  modStr = "SysCTypes";
+  printModuleInit(modFormatStr, modStr, INT64(9), _ln, _fn);
+  refIndentLevel = &moduleInitLevel;
+  *(refIndentLevel) += INT64(1);
+  chpl__init_SysCTypes_p = true;
+  call_tmp = sizeof(c_int);
+  call_tmp3 = sizeof(call_tmp2);
+  call_tmp4 = (call_tmp == call_tmp3);
+  assert2(call_tmp4, _ln, _fn);
+  call_tmp5 = sizeof(c_uint);
+  call_tmp7 = sizeof(call_tmp6);
+  call_tmp8 = (call_tmp5 == call_tmp7);
+  assert2(call_tmp8, _ln, _fn);
+  call_tmp9 = sizeof(c_long);
+  call_tmp11 = sizeof(call_tmp10);
+  call_tmp12 = (call_tmp9 == call_tmp11);
+  assert2(call_tmp12, _ln, _fn);
+  call_tmp13 = sizeof(c_ulong);
+  call_tmp15 = sizeof(call_tmp14);
+  call_tmp16 = (call_tmp13 == call_tmp15);
+  assert2(call_tmp16, _ln, _fn);
+  call_tmp17 = sizeof(c_longlong);
+  call_tmp19 = sizeof(call_tmp18);
+  call_tmp20 = (call_tmp17 == call_tmp19);
+  assert2(call_tmp20, _ln, _fn);
+  call_tmp21 = sizeof(c_ulonglong);
+  call_tmp23 = sizeof(call_tmp22);
+  call_tmp24 = (call_tmp21 == call_tmp23);
+  assert2(call_tmp24, _ln, _fn);
+  call_tmp25 = sizeof(c_char);
+  call_tmp27 = sizeof(call_tmp26);
+  call_tmp28 = (call_tmp25 == call_tmp27);
+  assert2(call_tmp28, _ln, _fn);
+  call_tmp29 = sizeof(c_schar);
+  call_tmp31 = sizeof(call_tmp30);
+  call_tmp32 = (call_tmp29 == call_tmp31);
+  assert2(call_tmp32, _ln, _fn);
+  call_tmp33 = sizeof(c_uchar);
+  call_tmp35 = sizeof(call_tmp34);
+  call_tmp36 = (call_tmp33 == call_tmp35);
+  assert2(call_tmp36, _ln, _fn);
+  call_tmp37 = sizeof(c_short);
+  call_tmp39 = sizeof(call_tmp38);
+  call_tmp40 = (call_tmp37 == call_tmp39);
+  assert2(call_tmp40, _ln, _fn);
+  call_tmp41 = sizeof(c_ushort);
+  call_tmp43 = sizeof(call_tmp42);
+  call_tmp44 = (call_tmp41 == call_tmp43);
+  assert2(call_tmp44, _ln, _fn);
+  call_tmp45 = sizeof(ssize_t);
+  call_tmp47 = sizeof(call_tmp46);
+  call_tmp48 = (call_tmp45 == call_tmp47);
+  assert2(call_tmp48, _ln, _fn);
+  call_tmp49 = sizeof(size_t);
+  call_tmp51 = sizeof(call_tmp50);
+  call_tmp52 = (call_tmp49 == call_tmp51);
+  assert2(call_tmp52, _ln, _fn);
+  *(refIndentLevel) -= INT64(1);
+  _exit_chpl__init_SysCTypes:;
+  return;
+}
+
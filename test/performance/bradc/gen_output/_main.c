@@ -0,0 +1,42 @@
+#include "chpl__header.h"
+#include "_config.c"
+#include "chpl__Program.c"
+#include "ChapelBase.c"
+#include "ChapelStandard.c"
+#include "PrintModuleInitOrder.c"
+#include "String.c"
+#include "CString.c"
+#include "MemConsistency.c"
+#include "Atomics.c"
+#include "NetworkAtomics.c"
+#include "AtomicsCommon.c"
+#include "ChapelThreads.c"
+#include "ChapelTuple.c"
+#include "ChapelRange.c"
+#include "LocaleModel.c"
+#include "ChapelLocale.c"
+#include "DefaultRectangular.c"
+#include "LocalesArray.c"
+#include "ChapelArray.c"
+#include "ChapelDistribution.c"
+#include "ChapelIO.c"
+#include "LocaleTree.c"
+#include "DefaultAssociative.c"
+#include "ChapelTaskTable.c"
+#include "MemTracking.c"
+#include "ChapelUtil.c"
+#include "ChapelDynDispHack.c"
+#include "ChapelNumLocales.c"
+#include "refArgIsWide.c"
+#include "BaseStringType.c"
+#include "NewString.c"
+#include "Types.c"
+#include "Sys.c"
+#include "DSIUtil.c"
+#include "List.c"
+#include "SysBasic.c"
+#include "IO.c"
+#include "CommDiagnostics.c"
+#include "SysCTypes.c"
+#include "Error.c"
+#include "Regexp.c"
@@ -0,0 +1,2993 @@
+
+#define CHPL_GEN_CODE
+
+#include "sys_basic.h"
+#include "stdchpl.h"
+#include "chpl_compilation_config.c"
+/*** Class Type Identification Numbers ***/
+
+const chpl__class_id chpl__cid__class_localson_fn = 0;
+const chpl__class_id chpl__cid__class_localson_fn2 = 1;
+const chpl__class_id chpl__cid__class_localson_fn3 = 2;
+const chpl__class_id chpl__cid__class_localson_fn4 = 3;
+const chpl__class_id chpl__cid__class_localson_fn5 = 4;
+const chpl__class_id chpl__cid__class_localson_fn6 = 5;
+const chpl__class_id chpl__cid__class_localson_fn7 = 6;
+const chpl__class_id chpl__cid__class_localson_fn8 = 7;
+const chpl__class_id chpl__cid__class_localson_fn9 = 8;
+const chpl__class_id chpl__cid__class_localson_fn10 = 9;
+const chpl__class_id chpl__cid__class_localson_fn11 = 10;
+const chpl__class_id chpl__cid__class_localson_fn12 = 11;
+const chpl__class_id chpl__cid__class_localson_fn13 = 12;
+const chpl__class_id chpl__cid__class_localson_fn14 = 13;
+const chpl__class_id chpl__cid__class_localson_fn15 = 14;
+const chpl__class_id chpl__cid__class_localson_fn16 = 15;
+const chpl__class_id chpl__cid__class_localson_fn17 = 16;
+const chpl__class_id chpl__cid__class_localson_fn18 = 17;
+const chpl__class_id chpl__cid__ddata_chpl_string = 18;
+const chpl__class_id chpl__cid__ddata_locale = 19;
+const chpl__class_id chpl__cid__ddata_localesSignal = 20;
+const chpl__class_id chpl__cid_chpl___EndCount = 21;
+const chpl__class_id chpl__cid__class_localson_fn19 = 22;
+const chpl__class_id chpl__cid__class_localson_fn20 = 23;
+const chpl__class_id chpl__cid_BaseDist = 24;
+const chpl__class_id chpl__cid__class_localson_fn21 = 25;
+const chpl__class_id chpl__cid_BaseDom = 26;
+const chpl__class_id chpl__cid__class_localson_fn22 = 27;
+const chpl__class_id chpl__cid__class_localson_fn23 = 28;
+const chpl__class_id chpl__cid__class_localson_fn24 = 29;
+const chpl__class_id chpl__cid__class_localson_fn25 = 30;
+const chpl__class_id chpl__cid__class_localson_fn26 = 31;
+const chpl__class_id chpl__cid_BaseRectangularDom = 32;
+const chpl__class_id chpl__cid_BaseArr = 33;
+const chpl__class_id chpl__cid__class_localson_fn27 = 34;
+const chpl__class_id chpl__cid__class_localson_fn28 = 35;
+const chpl__class_id chpl__cid__class_localson_fn29 = 36;
+const chpl__class_id chpl__cid__class_localson_fn30 = 37;
+const chpl__class_id chpl__cid_Writer = 38;
+const chpl__class_id chpl__cid_Reader = 39;
+const chpl__class_id chpl__cid_StringWriter = 40;
+const chpl__class_id chpl__cid__class_localson_fn31 = 41;
+const chpl__class_id chpl__cid__class_localson_fn32 = 42;
+const chpl__class_id chpl__cid_locale = 43;
+const chpl__class_id chpl__cid_AbstractLocaleModel = 44;
+const chpl__class_id chpl__cid_AbstractRootLocale = 45;
+const chpl__class_id chpl__cid_localesSignal = 46;
+const chpl__class_id chpl__cid__class_localson_fn33 = 47;
+const chpl__class_id chpl__cid_DefaultDist = 48;
+const chpl__class_id chpl__cid_DefaultRectangularDom_1_int64_t_F = 49;
+const chpl__class_id chpl__cid_DefaultRectangularArr_locale_1_int64_t_F = 50;
+const chpl__class_id chpl__cid_DefaultRectangularArr_localesSignal_1_int64_t_F = 51;
+const chpl__class_id chpl__cid__class_localson_fn34 = 52;
+const chpl__class_id chpl__cid__class_localson_fn35 = 53;
+const chpl__class_id chpl__cid_LocaleModel = 54;
+const chpl__class_id chpl__cid_RootLocale = 55;
+const chpl__class_id chpl__cid__class_localson_fn36 = 56;
+const chpl__class_id chpl__cid__class_localson_fn37 = 57;
+const chpl__class_id chpl__cid_heap_c_string = 58;
+const chpl__class_id chpl__cid_heap_chpl_bool = 59;
+const chpl__class_id chpl__cid_heap_chpl_string = 60;
+const chpl__class_id chpl__cid_heap_int64_t = 61;
+const chpl__class_id chpl__cid_object = 62;
+const chpl__class_id chpl__cid_heap__tuple_3_chpl_string_int64_t_ioNewline = 63;
+const chpl__class_id chpl__cid_heap__tuple_6_star_chpl_string = 64;
+const chpl__class_id chpl__cid_heap_locale = 65;
+const chpl__class_id chpl__cid_heap_syserr = 66;
+const chpl__class_id chpl__cid_heap_string_rec = 67;
+const chpl__class_id chpl__cid_heap_iostyle = 68;
+const chpl__class_id chpl__cid_heap_file = 69;
+const chpl__class_id chpl__cid_heap_channel_F_dynamic_T = 70;
+const chpl__class_id chpl__cid_heap_channel_T_dynamic_T = 71;
+const chpl__class_id chpl__cid_heap_atomic_int64 = 72;
+const chpl__class_id chpl__cid__class_localson_fn38 = 73;
+const chpl__class_id chpl__cid__class_localson_fn39 = 74;
+const chpl__class_id chpl__cid__class_localson_fn40 = 75;
+const chpl__class_id chpl__cid__class_localson_fn41 = 76;
+const chpl__class_id chpl__cid__class_localson_fn42 = 77;
+const chpl__class_id chpl__cid__class_localson_fn43 = 78;
+const chpl__class_id chpl__cid__class_localson_fn44 = 79;
+const chpl__class_id chpl__cid__class_localson_fn45 = 80;
+const chpl__class_id chpl__cid__class_localson_fn46 = 81;
+const chpl__class_id chpl__cid__class_localson_fn47 = 82;
+const chpl__class_id chpl__cid__class_localson_fn48 = 83;
+const chpl__class_id chpl__cid__class_localson_fn49 = 84;
+const chpl__class_id chpl__cid__class_localson_fn50 = 85;
+const chpl__class_id chpl__cid__class_localson_fn51 = 86;
+const chpl__class_id chpl__cid__class_localson_fn52 = 87;
+const chpl__class_id chpl__cid__class_localson_fn53 = 88;
+const chpl__class_id chpl__cid__class_localson_fn54 = 89;
+const chpl__class_id chpl__cid__class_localson_fn55 = 90;
+const chpl__class_id chpl__cid__class_localson_fn56 = 91;
+const chpl__class_id chpl__cid__class_localson_fn57 = 92;
+const chpl__class_id chpl__cid__class_localson_fn58 = 93;
+const chpl__class_id chpl__cid__class_localson_fn59 = 94;
+const chpl__class_id chpl__cid_listNode_BaseArr = 95;
+const chpl__class_id chpl__cid_listNode_BaseDom = 96;
+const chpl__class_id chpl__cid__class_localson_fn60 = 97;
+const chpl__class_id chpl__cid__class_localson_fn61 = 98;
+const chpl__class_id chpl__cid_string_refcnt = 99;
+const chpl__class_id chpl__cid__class_localson_fn62 = 100;
+const chpl__class_id chpl__cid__class_localson_fn63 = 101;
+const chpl__class_id chpl__cid__class_localson_fn64 = 102;
+const chpl__class_id chpl__cid__class_localson_fn65 = 103;
+const chpl__class_id chpl__cid__class_localson_fn66 = 104;
+const chpl__class_id chpl__cid__class_localson_fn67 = 105;
+/*** Class Prototypes ***/
+
+typedef struct chpl__class_localson_fn_s* _class_localson_fn;
+typedef struct chpl__class_localson_fn2_s* _class_localson_fn2;
+typedef struct chpl__class_localson_fn3_s* _class_localson_fn3;
+typedef struct chpl__class_localson_fn4_s* _class_localson_fn4;
+typedef struct chpl__class_localson_fn5_s* _class_localson_fn5;
+typedef struct chpl__class_localson_fn6_s* _class_localson_fn6;
+typedef struct chpl__class_localson_fn7_s* _class_localson_fn7;
+typedef struct chpl__class_localson_fn8_s* _class_localson_fn8;
+typedef struct chpl__class_localson_fn9_s* _class_localson_fn9;
+typedef struct chpl__class_localson_fn10_s* _class_localson_fn10;
+typedef struct chpl__class_localson_fn11_s* _class_localson_fn11;
+typedef struct chpl__class_localson_fn12_s* _class_localson_fn12;
+typedef struct chpl__class_localson_fn13_s* _class_localson_fn13;
+typedef struct chpl__class_localson_fn14_s* _class_localson_fn14;
+typedef struct chpl__class_localson_fn15_s* _class_localson_fn15;
+typedef struct chpl__class_localson_fn16_s* _class_localson_fn16;
+typedef struct chpl__class_localson_fn17_s* _class_localson_fn17;
+typedef struct chpl__class_localson_fn18_s* _class_localson_fn18;
+typedef struct chpl_chpl___EndCount_s* chpl___EndCount;
+typedef struct chpl__class_localson_fn19_s* _class_localson_fn19;
+typedef struct chpl__class_localson_fn20_s* _class_localson_fn20;
+typedef struct chpl_BaseDist_s* BaseDist;
+typedef struct chpl__class_localson_fn21_s* _class_localson_fn21;
+typedef struct chpl_BaseDom_s* BaseDom;
+typedef struct chpl__class_localson_fn22_s* _class_localson_fn22;
+typedef struct chpl__class_localson_fn23_s* _class_localson_fn23;
+typedef struct chpl__class_localson_fn24_s* _class_localson_fn24;
+typedef struct chpl__class_localson_fn25_s* _class_localson_fn25;
+typedef struct chpl__class_localson_fn26_s* _class_localson_fn26;
+typedef struct chpl_BaseRectangularDom_s* BaseRectangularDom;
+typedef struct chpl_BaseArr_s* BaseArr;
+typedef struct chpl__class_localson_fn27_s* _class_localson_fn27;
+typedef struct chpl__class_localson_fn28_s* _class_localson_fn28;
+typedef struct chpl__class_localson_fn29_s* _class_localson_fn29;
+typedef struct chpl__class_localson_fn30_s* _class_localson_fn30;
+typedef struct chpl_Writer_s* Writer;
+typedef struct chpl_Reader_s* Reader;
+typedef struct chpl_StringWriter_s* StringWriter;
+typedef struct chpl__class_localson_fn31_s* _class_localson_fn31;
+typedef struct chpl__class_localson_fn32_s* _class_localson_fn32;
+typedef struct chpl_locale_s* locale;
+typedef struct chpl_AbstractLocaleModel_s* AbstractLocaleModel;
+typedef struct chpl_AbstractRootLocale_s* AbstractRootLocale;
+typedef struct chpl_localesSignal_s* localesSignal;
+typedef struct chpl__class_localson_fn33_s* _class_localson_fn33;
+typedef struct chpl_DefaultDist_s* DefaultDist;
+typedef struct chpl_DefaultRectangularDom_1_int64_t_F_s* DefaultRectangularDom_1_int64_t_F;
+typedef struct chpl_DefaultRectangularArr_locale_1_int64_t_F_s* DefaultRectangularArr_locale_1_int64_t_F;
+typedef struct chpl_DefaultRectangularArr_localesSignal_1_int64_t_F_s* DefaultRectangularArr_localesSignal_1_int64_t_F;
+typedef struct chpl__class_localson_fn34_s* _class_localson_fn34;
+typedef struct chpl__class_localson_fn35_s* _class_localson_fn35;
+typedef struct chpl_LocaleModel_s* LocaleModel;
+typedef struct chpl_RootLocale_s* RootLocale;
+typedef struct chpl__class_localson_fn36_s* _class_localson_fn36;
+typedef struct chpl__class_localson_fn37_s* _class_localson_fn37;
+typedef struct chpl_heap_c_string_s* heap_c_string;
+typedef struct chpl_heap_chpl_bool_s* heap_chpl_bool;
+typedef struct chpl_heap_chpl_string_s* heap_chpl_string;
+typedef struct chpl_heap_int64_t_s* heap_int64_t;
+typedef struct chpl_object_s* object;
+typedef struct chpl_heap__tuple_3_chpl_string_int64_t_ioNewline_s* heap__tuple_3_chpl_string_int64_t_ioNewline;
+typedef struct chpl_heap__tuple_6_star_chpl_string_s* heap__tuple_6_star_chpl_string;
+typedef struct chpl_heap_locale_s* heap_locale;
+typedef struct chpl_heap_syserr_s* heap_syserr;
+typedef struct chpl_heap_string_rec_s* heap_string_rec;
+typedef struct chpl_heap_iostyle_s* heap_iostyle;
+typedef struct chpl_heap_file_s* heap_file;
+typedef struct chpl_heap_channel_F_dynamic_T_s* heap_channel_F_dynamic_T;
+typedef struct chpl_heap_channel_T_dynamic_T_s* heap_channel_T_dynamic_T;
+typedef struct chpl_heap_atomic_int64_s* heap_atomic_int64;
+typedef struct chpl__class_localson_fn38_s* _class_localson_fn38;
+typedef struct chpl__class_localson_fn39_s* _class_localson_fn39;
+typedef struct chpl__class_localson_fn40_s* _class_localson_fn40;
+typedef struct chpl__class_localson_fn41_s* _class_localson_fn41;
+typedef struct chpl__class_localson_fn42_s* _class_localson_fn42;
+typedef struct chpl__class_localson_fn43_s* _class_localson_fn43;
+typedef struct chpl__class_localson_fn44_s* _class_localson_fn44;
+typedef struct chpl__class_localson_fn45_s* _class_localson_fn45;
+typedef struct chpl__class_localson_fn46_s* _class_localson_fn46;
+typedef struct chpl__class_localson_fn47_s* _class_localson_fn47;
+typedef struct chpl__class_localson_fn48_s* _class_localson_fn48;
+typedef struct chpl__class_localson_fn49_s* _class_localson_fn49;
+typedef struct chpl__class_localson_fn50_s* _class_localson_fn50;
+typedef struct chpl__class_localson_fn51_s* _class_localson_fn51;
+typedef struct chpl__class_localson_fn52_s* _class_localson_fn52;
+typedef struct chpl__class_localson_fn53_s* _class_localson_fn53;
+typedef struct chpl__class_localson_fn54_s* _class_localson_fn54;
+typedef struct chpl__class_localson_fn55_s* _class_localson_fn55;
+typedef struct chpl__class_localson_fn56_s* _class_localson_fn56;
+typedef struct chpl__class_localson_fn57_s* _class_localson_fn57;
+typedef struct chpl__class_localson_fn58_s* _class_localson_fn58;
+typedef struct chpl__class_localson_fn59_s* _class_localson_fn59;
+typedef struct chpl_listNode_BaseArr_s* listNode_BaseArr;
+typedef struct chpl_listNode_BaseDom_s* listNode_BaseDom;
+typedef struct chpl__class_localson_fn60_s* _class_localson_fn60;
+typedef struct chpl__class_localson_fn61_s* _class_localson_fn61;
+typedef struct chpl_string_refcnt_s* string_refcnt;
+typedef struct chpl__class_localson_fn62_s* _class_localson_fn62;
+typedef struct chpl__class_localson_fn63_s* _class_localson_fn63;
+typedef struct chpl__class_localson_fn64_s* _class_localson_fn64;
+typedef struct chpl__class_localson_fn65_s* _class_localson_fn65;
+typedef struct chpl__class_localson_fn66_s* _class_localson_fn66;
+typedef struct chpl__class_localson_fn67_s* _class_localson_fn67;
+/*** Enumerated Types ***/
+
+typedef enum {iterKind_leader = UINT32(1), iterKind_follower = UINT32(2), iterKind_standalone = UINT32(3)} iterKind;
+typedef enum {BoundedRangeType_bounded = UINT32(1), BoundedRangeType_boundedLow = UINT32(2), BoundedRangeType_boundedHigh = UINT32(3), BoundedRangeType_boundedNone = UINT32(4)} BoundedRangeType;
+typedef enum {chpl__hash_status_empty = UINT32(1), chpl__hash_status_full = UINT32(2), chpl__hash_status_deleted = UINT32(3)} chpl__hash_status;
+typedef enum {iomode_r = INT64(1), iomode_cw = INT64(2), iomode_rw = INT64(3), iomode_cwr = INT64(4)} iomode;
+typedef enum {iokind_dynamic = INT64(0), iokind_native = INT64(1), iokind_big = INT64(2), iokind_little = INT64(3)} iokind;
+typedef enum {iostringstyle_len1b_data = INT64(-1), iostringstyle_len2b_data = INT64(-2), iostringstyle_len4b_data = INT64(-4), iostringstyle_len8b_data = INT64(-8), iostringstyle_lenVb_data = INT64(-10), iostringstyle_data_toeof = INT64(-65280), iostringstyle_data_null = INT64(-256)} iostringstyle;
+typedef enum {relType_eq = INT64(1), relType_neq = UINT32(2), relType_lt = UINT32(3), relType_lte = UINT32(4), relType_gt = UINT32(5), relType_gte = UINT32(6)} relType;
+/*** Records, Unions, Data Class, References (Hierarchically) ***/
+
+typedef struct chpl_atomicflag_s {
+  atomic_flag _v;
+} atomicflag;
+
+typedef struct chpl_atomic_int64_s {
+  atomic_int_least64_t _v;
+} atomic_int64;
+
+typedef struct chpl_atomic_refcnt_s {
+  atomic_int64 _cnt;
+} atomic_refcnt;
+
+typedef struct chpl_chpl____wide_chpl_string_s {
+  chpl_localeID_t locale;
+  chpl_string addr;
+  int64_t size;
+} chpl____wide_chpl_string;
+
+typedef chpl____wide_chpl_string *_ddata_chpl_string;
+typedef struct chpl_chpl____wide_locale_s {
+  chpl_localeID_t locale;
+  locale addr;
+} chpl____wide_locale;
+
+typedef chpl____wide_locale *_ddata_locale;
+typedef struct chpl_chpl____wide_localesSignal_s {
+  chpl_localeID_t locale;
+  localesSignal addr;
+} chpl____wide_localesSignal;
+
+typedef chpl____wide_localesSignal *_ddata_localesSignal;
+typedef struct chpl_chpl____wide_AbstractLocaleModel_s {
+  chpl_localeID_t locale;
+  AbstractLocaleModel addr;
+} chpl____wide_AbstractLocaleModel;
+
+typedef chpl____wide_AbstractLocaleModel *_ref_AbstractLocaleModel;
+typedef struct chpl_chpl____wide_AbstractRootLocale_s {
+  chpl_localeID_t locale;
+  AbstractRootLocale addr;
+} chpl____wide_AbstractRootLocale;
+
+typedef chpl____wide_AbstractRootLocale *_ref_AbstractRootLocale;
+typedef struct chpl_chpl____wide_BaseArr_s {
+  chpl_localeID_t locale;
+  BaseArr addr;
+} chpl____wide_BaseArr;
+
+typedef chpl____wide_BaseArr *_ref_BaseArr;
+typedef struct chpl_chpl____wide_BaseDist_s {
+  chpl_localeID_t locale;
+  BaseDist addr;
+} chpl____wide_BaseDist;
+
+typedef chpl____wide_BaseDist *_ref_BaseDist;
+typedef struct chpl_chpl____wide_BaseDom_s {
+  chpl_localeID_t locale;
+  BaseDom addr;
+} chpl____wide_BaseDom;
+
+typedef chpl____wide_BaseDom *_ref_BaseDom;
+typedef struct chpl_chpl____wide_BaseRectangularDom_s {
+  chpl_localeID_t locale;
+  BaseRectangularDom addr;
+} chpl____wide_BaseRectangularDom;
+
+typedef chpl____wide_BaseRectangularDom *_ref_BaseRectangularDom;
+typedef struct chpl_chpl____wide_DefaultDist_s {
+  chpl_localeID_t locale;
+  DefaultDist addr;
+} chpl____wide_DefaultDist;
+
+typedef chpl____wide_DefaultDist *_ref_DefaultDist;
+typedef struct chpl_chpl____wide_DefaultRectangularArr_locale_1_int64_t_F_s {
+  chpl_localeID_t locale;
+  DefaultRectangularArr_locale_1_int64_t_F addr;
+} chpl____wide_DefaultRectangularArr_locale_1_int64_t_F;
+
+typedef chpl____wide_DefaultRectangularArr_locale_1_int64_t_F *_ref_DefaultRectangularArr_locale_1_int64_t_F;
+typedef struct chpl_chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F_s {
+  chpl_localeID_t locale;
+  DefaultRectangularArr_localesSignal_1_int64_t_F addr;
+} chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F;
+
+typedef chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F *_ref_DefaultRectangularArr_localesSignal_1_int64_t_F;
+typedef struct chpl_chpl____wide_DefaultRectangularDom_1_int64_t_F_s {
+  chpl_localeID_t locale;
+  DefaultRectangularDom_1_int64_t_F addr;
+} chpl____wide_DefaultRectangularDom_1_int64_t_F;
+
+typedef chpl____wide_DefaultRectangularDom_1_int64_t_F *_ref_DefaultRectangularDom_1_int64_t_F;
+typedef struct chpl_chpl____wide_LocaleModel_s {
+  chpl_localeID_t locale;
+  LocaleModel addr;
+} chpl____wide_LocaleModel;
+
+typedef chpl____wide_LocaleModel *_ref_LocaleModel;
+typedef struct chpl_chpl____wide_Reader_s {
+  chpl_localeID_t locale;
+  Reader addr;
+} chpl____wide_Reader;
+
+typedef chpl____wide_Reader *_ref_Reader;
+typedef struct chpl_chpl____wide_RootLocale_s {
+  chpl_localeID_t locale;
+  RootLocale addr;
+} chpl____wide_RootLocale;
+
+typedef chpl____wide_RootLocale *_ref_RootLocale;
+typedef struct chpl_chpl____wide_StringWriter_s {
+  chpl_localeID_t locale;
+  StringWriter addr;
+} chpl____wide_StringWriter;
+
+typedef chpl____wide_StringWriter *_ref_StringWriter;
+typedef struct chpl_chpl____wide_Writer_s {
+  chpl_localeID_t locale;
+  Writer addr;
+} chpl____wide_Writer;
+
+typedef chpl____wide_Writer *_ref_Writer;
+typedef struct chpl_chpl____wide__EndCount_s {
+  chpl_localeID_t locale;
+  chpl___EndCount addr;
+} chpl____wide__EndCount;
+
+typedef chpl____wide__EndCount *_ref__EndCount;
+typedef struct chpl_chpl___RuntimeTypeInfo_s {
+  chpl____wide_DefaultDist d;
+} chpl___RuntimeTypeInfo;
+
+typedef chpl___RuntimeTypeInfo *_ref__RuntimeTypeInfo;
+typedef struct chpl_chpl___RuntimeTypeInfo2_s {
+  chpl____wide_DefaultRectangularDom_1_int64_t_F dom;
+} chpl___RuntimeTypeInfo2;
+
+typedef chpl___RuntimeTypeInfo2 *_ref__RuntimeTypeInfo2;
+typedef struct chpl_chpl___RuntimeTypeInfo3_s {
+  chpl____wide_DefaultRectangularDom_1_int64_t_F dom;
+} chpl___RuntimeTypeInfo3;
+
+typedef chpl___RuntimeTypeInfo3 *_ref__RuntimeTypeInfo3;
+typedef struct chpl_chpl____wide__ddata_chpl_string_s {
+  chpl_localeID_t locale;
+  _ddata_chpl_string addr;
+} chpl____wide__ddata_chpl_string;
+
+typedef chpl____wide__ddata_chpl_string *_ref__ddata_chpl_string;
+typedef struct chpl_chpl____wide__ddata_locale_s {
+  chpl_localeID_t locale;
+  _ddata_locale addr;
+} chpl____wide__ddata_locale;
+
+typedef chpl____wide__ddata_locale *_ref__ddata_locale;
+typedef struct chpl_chpl____wide__ddata_localesSignal_s {
+  chpl_localeID_t locale;
+  _ddata_localesSignal addr;
+} chpl____wide__ddata_localesSignal;
+
+typedef chpl____wide__ddata_localesSignal *_ref__ddata_localesSignal;
+typedef struct chpl__ir_initOnLocales_AbstractRootLocale_s {
+  chpl____wide_AbstractRootLocale F0_this;
+} _ir_initOnLocales_AbstractRootLocale;
+
+typedef _ir_initOnLocales_AbstractRootLocale *_ref__ir_initOnLocales_AbstractRootLocale;
+typedef _nilType *_ref__nilType;
+typedef c_string _tuple_1_star_c_string[1];
+
+typedef _tuple_1_star_c_string *_ref__tuple_1_star_c_string;
+typedef int64_t _tuple_1_star_int64_t[1];
+
+typedef _tuple_1_star_int64_t *_ref__tuple_1_star_int64_t;
+typedef struct chpl_range_int64_t_bounded_F_s {
+  int64_t _low;
+  int64_t _high;
+  int64_t _stride;
+  int64_t _alignment;
+  chpl_bool _aligned;
+} range_int64_t_bounded_F;
+
+typedef range_int64_t_bounded_F _tuple_1_star_range_int64_t_bounded_F[1];
+
+typedef _tuple_1_star_range_int64_t_bounded_F *_ref__tuple_1_star_range_int64_t_bounded_F;
+typedef struct chpl_ioNewline_s {
+  chpl_bool skipWhitespaceOnly;
+} ioNewline;
+
+typedef struct chpl__tuple_3_chpl_string_int64_t_ioNewline_s {
+  chpl____wide_chpl_string x1;
+  int64_t x2;
+  ioNewline x3;
+} _tuple_3_chpl_string_int64_t_ioNewline;
+
+typedef _tuple_3_chpl_string_int64_t_ioNewline *_ref__tuple_3_chpl_string_int64_t_ioNewline;
+typedef chpl____wide_chpl_string _tuple_6_star_chpl_string[6];
+
+typedef _tuple_6_star_chpl_string *_ref__tuple_6_star_chpl_string;
+typedef atomic_flag *_ref_atomic_flag;
+typedef atomic_int64 *_ref_atomic_int64;
+typedef atomic_int_least64_t *_ref_atomic_int_least64_t;
+typedef atomic_refcnt *_ref_atomic_refcnt;
+typedef atomicflag *_ref_atomicflag;
+typedef c_string *_ref_c_string;
+typedef c_string_copy *_ref_c_string_copy;
+typedef struct chpl_channel_F_dynamic_T_s {
+  chpl____wide_locale home;
+  qio_channel_ptr_t _channel_internal;
+} channel_F_dynamic_T;
+
+typedef channel_F_dynamic_T *_ref_channel_F_dynamic_T;
+typedef struct chpl_channel_T_dynamic_T_s {
+  chpl____wide_locale home;
+  qio_channel_ptr_t _channel_internal;
+} channel_T_dynamic_T;
+
+typedef channel_T_dynamic_T *_ref_channel_T_dynamic_T;
+typedef chpl_bool *_ref_chpl_bool;
+typedef chpl_localeID_t *_ref_chpl_localeID_t;
+typedef struct chpl_chpl_localeTreeRecord_s {
+  chpl____wide_locale left;
+  chpl____wide_locale right;
+} chpl_localeTreeRecord;
+
+typedef chpl_localeTreeRecord *_ref_chpl_localeTreeRecord;
+typedef chpl_main_argument *_ref_chpl_main_argument;
+typedef chpl____wide_chpl_string *_ref_chpl_string;
+typedef chpl_task_list_p *_ref_chpl_task_list_p;
+typedef struct chpl_file_s {
+  chpl____wide_locale home;
+  qio_file_ptr_t _file_internal;
+} file;
+
+typedef file *_ref_file;
+typedef int32_t *_ref_int32_t;
+typedef int64_t *_ref_int64_t;
+typedef struct chpl_ioLiteral_s {
+  c_string val;
+  chpl_bool ignoreWhiteSpace;
+} ioLiteral;
+
+typedef ioLiteral *_ref_ioLiteral;
+typedef ioNewline *_ref_ioNewline;
+typedef iostyle *_ref_iostyle;
+typedef struct chpl_chpl____wide_listNode_BaseArr_s {
+  chpl_localeID_t locale;
+  listNode_BaseArr addr;
+} chpl____wide_listNode_BaseArr;
+
+typedef chpl____wide_listNode_BaseArr *_ref_listNode_BaseArr;
+typedef struct chpl_chpl____wide_listNode_BaseDom_s {
+  chpl_localeID_t locale;
+  listNode_BaseDom addr;
+} chpl____wide_listNode_BaseDom;
+
+typedef chpl____wide_listNode_BaseDom *_ref_listNode_BaseDom;
+typedef struct chpl_list_BaseArr_s {
+  chpl____wide_listNode_BaseArr first;
+  chpl____wide_listNode_BaseArr last;
+  int64_t length;
+} list_BaseArr;
+
+typedef list_BaseArr *_ref_list_BaseArr;
+typedef struct chpl_list_BaseDom_s {
+  chpl____wide_listNode_BaseDom first;
+  chpl____wide_listNode_BaseDom last;
+  int64_t length;
+} list_BaseDom;
+
+typedef list_BaseDom *_ref_list_BaseDom;
+typedef chpl____wide_locale *_ref_locale;
+typedef struct chpl_localesBarrier_s {
+  int dummyFieldToAvoidWarning;
+} localesBarrier;
+
+typedef localesBarrier *_ref_localesBarrier;
+typedef chpl____wide_localesSignal *_ref_localesSignal;
+typedef struct chpl_chpl____wide_object_s {
+  chpl_localeID_t locale;
+  object addr;
+} chpl____wide_object;
+
+typedef chpl____wide_object *_ref_object;
+typedef qio_channel_ptr_t *_ref_qio_channel_ptr_t;
+typedef qio_file_ptr_t *_ref_qio_file_ptr_t;
+typedef struct chpl_range_int64_t_boundedLow_F_s {
+  int64_t _low;
+  int64_t _high;
+  int64_t _stride;
+  int64_t _alignment;
+  chpl_bool _aligned;
+} range_int64_t_boundedLow_F;
+
+typedef range_int64_t_boundedLow_F *_ref_range_int64_t_boundedLow_F;
+typedef range_int64_t_bounded_F *_ref_range_int64_t_bounded_F;
+typedef struct chpl_chpl____wide_string_refcnt_s {
+  chpl_localeID_t locale;
+  string_refcnt addr;
+} chpl____wide_string_refcnt;
+
+typedef struct chpl_string_rec_s {
+  c_string base;
+  int64_t len;
+  chpl____wide_locale home;
+  chpl____wide_string_refcnt refCnt;
+  chpl____wide_string_refcnt aliasRefCnt;
+} string_rec;
+
+typedef string_rec *_ref_string_rec;
+typedef chpl____wide_string_refcnt *_ref_string_refcnt;
+typedef syserr *_ref_syserr;
+typedef uint64_t *_ref_uint64_t;
+typedef struct chpl_chpl____wide_heap_c_string_s {
+  chpl_localeID_t locale;
+  heap_c_string addr;
+} chpl____wide_heap_c_string;
+
+typedef struct chpl_chpl____wide_heap_chpl_bool_s {
+  chpl_localeID_t locale;
+  heap_chpl_bool addr;
+} chpl____wide_heap_chpl_bool;
+
+typedef struct chpl_chpl____wide_heap_chpl_string_s {
+  chpl_localeID_t locale;
+  heap_chpl_string addr;
+} chpl____wide_heap_chpl_string;
+
+typedef struct chpl_chpl____wide_heap_int64_t_s {
+  chpl_localeID_t locale;
+  heap_int64_t addr;
+} chpl____wide_heap_int64_t;
+
+typedef struct chpl_chpl____wide_heap__tuple_3_chpl_string_int64_t_ioNewline_s {
+  chpl_localeID_t locale;
+  heap__tuple_3_chpl_string_int64_t_ioNewline addr;
+} chpl____wide_heap__tuple_3_chpl_string_int64_t_ioNewline;
+
+typedef struct chpl_chpl____wide_heap__tuple_6_star_chpl_string_s {
+  chpl_localeID_t locale;
+  heap__tuple_6_star_chpl_string addr;
+} chpl____wide_heap__tuple_6_star_chpl_string;
+
+typedef struct chpl_chpl____wide_heap_locale_s {
+  chpl_localeID_t locale;
+  heap_locale addr;
+} chpl____wide_heap_locale;
+
+typedef struct chpl_chpl____wide_heap_syserr_s {
+  chpl_localeID_t locale;
+  heap_syserr addr;
+} chpl____wide_heap_syserr;
+
+typedef struct chpl_chpl____wide_heap_string_rec_s {
+  chpl_localeID_t locale;
+  heap_string_rec addr;
+} chpl____wide_heap_string_rec;
+
+typedef struct chpl_chpl____wide_heap_iostyle_s {
+  chpl_localeID_t locale;
+  heap_iostyle addr;
+} chpl____wide_heap_iostyle;
+
+typedef struct chpl_chpl____wide_heap_file_s {
+  chpl_localeID_t locale;
+  heap_file addr;
+} chpl____wide_heap_file;
+
+typedef struct chpl_chpl____wide__ref_AbstractLocaleModel_s {
+  chpl_localeID_t locale;
+  _ref_AbstractLocaleModel addr;
+} chpl____wide__ref_AbstractLocaleModel;
+
+typedef struct chpl_chpl____wide__ref_AbstractRootLocale_s {
+  chpl_localeID_t locale;
+  _ref_AbstractRootLocale addr;
+} chpl____wide__ref_AbstractRootLocale;
+
+typedef struct chpl_chpl____wide__ref_BaseArr_s {
+  chpl_localeID_t locale;
+  _ref_BaseArr addr;
+} chpl____wide__ref_BaseArr;
+
+typedef struct chpl_chpl____wide__ref_BaseDist_s {
+  chpl_localeID_t locale;
+  _ref_BaseDist addr;
+} chpl____wide__ref_BaseDist;
+
+typedef struct chpl_chpl____wide__ref_BaseDom_s {
+  chpl_localeID_t locale;
+  _ref_BaseDom addr;
+} chpl____wide__ref_BaseDom;
+
+typedef struct chpl_chpl____wide__ref_BaseRectangularDom_s {
+  chpl_localeID_t locale;
+  _ref_BaseRectangularDom addr;
+} chpl____wide__ref_BaseRectangularDom;
+
+typedef struct chpl_chpl____wide__ref_DefaultDist_s {
+  chpl_localeID_t locale;
+  _ref_DefaultDist addr;
+} chpl____wide__ref_DefaultDist;
+
+typedef struct chpl_chpl____wide__ref_DefaultRectangularArr_locale_1_int64_t_F_s {
+  chpl_localeID_t locale;
+  _ref_DefaultRectangularArr_locale_1_int64_t_F addr;
+} chpl____wide__ref_DefaultRectangularArr_locale_1_int64_t_F;
+
+typedef struct chpl_chpl____wide__ref_DefaultRectangularArr_localesSignal_1_int64_t_F_s {
+  chpl_localeID_t locale;
+  _ref_DefaultRectangularArr_localesSignal_1_int64_t_F addr;
+} chpl____wide__ref_DefaultRectangularArr_localesSignal_1_int64_t_F;
+
+typedef struct chpl_chpl____wide__ref_DefaultRectangularDom_1_int64_t_F_s {
+  chpl_localeID_t locale;
+  _ref_DefaultRectangularDom_1_int64_t_F addr;
+} chpl____wide__ref_DefaultRectangularDom_1_int64_t_F;
+
+typedef struct chpl_chpl____wide__ref_LocaleModel_s {
+  chpl_localeID_t locale;
+  _ref_LocaleModel addr;
+} chpl____wide__ref_LocaleModel;
+
+typedef struct chpl_chpl____wide__ref_Reader_s {
+  chpl_localeID_t locale;
+  _ref_Reader addr;
+} chpl____wide__ref_Reader;
+
+typedef struct chpl_chpl____wide__ref_RootLocale_s {
+  chpl_localeID_t locale;
+  _ref_RootLocale addr;
+} chpl____wide__ref_RootLocale;
+
+typedef struct chpl_chpl____wide__ref_StringWriter_s {
+  chpl_localeID_t locale;
+  _ref_StringWriter addr;
+} chpl____wide__ref_StringWriter;
+
+typedef struct chpl_chpl____wide__ref_Writer_s {
+  chpl_localeID_t locale;
+  _ref_Writer addr;
+} chpl____wide__ref_Writer;
+
+typedef struct chpl_chpl____wide__ref__EndCount_s {
+  chpl_localeID_t locale;
+  _ref__EndCount addr;
+} chpl____wide__ref__EndCount;
+
+typedef struct chpl_chpl____wide__ref__RuntimeTypeInfo_s {
+  chpl_localeID_t locale;
+  _ref__RuntimeTypeInfo addr;
+} chpl____wide__ref__RuntimeTypeInfo;
+
+typedef struct chpl_chpl____wide__ref__RuntimeTypeInfo2_s {
+  chpl_localeID_t locale;
+  _ref__RuntimeTypeInfo2 addr;
+} chpl____wide__ref__RuntimeTypeInfo2;
+
+typedef struct chpl_chpl____wide__ref__RuntimeTypeInfo3_s {
+  chpl_localeID_t locale;
+  _ref__RuntimeTypeInfo3 addr;
+} chpl____wide__ref__RuntimeTypeInfo3;
+
+typedef struct chpl_chpl____wide__ref__ddata_chpl_string_s {
+  chpl_localeID_t locale;
+  _ref__ddata_chpl_string addr;
+} chpl____wide__ref__ddata_chpl_string;
+
+typedef struct chpl_chpl____wide__ref__ddata_locale_s {
+  chpl_localeID_t locale;
+  _ref__ddata_locale addr;
+} chpl____wide__ref__ddata_locale;
+
+typedef struct chpl_chpl____wide__ref__ddata_localesSignal_s {
+  chpl_localeID_t locale;
+  _ref__ddata_localesSignal addr;
+} chpl____wide__ref__ddata_localesSignal;
+
+typedef struct chpl_chpl____wide__ref__ir_initOnLocales_AbstractRootLocale_s {
+  chpl_localeID_t locale;
+  _ref__ir_initOnLocales_AbstractRootLocale addr;
+} chpl____wide__ref__ir_initOnLocales_AbstractRootLocale;
+
+typedef struct chpl_chpl____wide__ref__nilType_s {
+  chpl_localeID_t locale;
+  _ref__nilType addr;
+} chpl____wide__ref__nilType;
+
+typedef struct chpl_chpl____wide__ref__tuple_1_star_c_string_s {
+  chpl_localeID_t locale;
+  _ref__tuple_1_star_c_string addr;
+} chpl____wide__ref__tuple_1_star_c_string;
+
+typedef struct chpl_chpl____wide__ref__tuple_1_star_int64_t_s {
+  chpl_localeID_t locale;
+  _ref__tuple_1_star_int64_t addr;
+} chpl____wide__ref__tuple_1_star_int64_t;
+
+typedef struct chpl_chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F_s {
+  chpl_localeID_t locale;
+  _ref__tuple_1_star_range_int64_t_bounded_F addr;
+} chpl____wide__ref__tuple_1_star_range_int64_t_bounded_F;
+
+typedef struct chpl_chpl____wide__ref__tuple_3_chpl_string_int64_t_ioNewline_s {
+  chpl_localeID_t locale;
+  _ref__tuple_3_chpl_string_int64_t_ioNewline addr;
+} chpl____wide__ref__tuple_3_chpl_string_int64_t_ioNewline;
+
+typedef struct chpl_chpl____wide__ref__tuple_6_star_chpl_string_s {
+  chpl_localeID_t locale;
+  _ref__tuple_6_star_chpl_string addr;
+} chpl____wide__ref__tuple_6_star_chpl_string;
+
+typedef struct chpl_chpl____wide__ref_atomic_flag_s {
+  chpl_localeID_t locale;
+  _ref_atomic_flag addr;
+} chpl____wide__ref_atomic_flag;
+
+typedef struct chpl_chpl____wide__ref_atomic_int64_s {
+  chpl_localeID_t locale;
+  _ref_atomic_int64 addr;
+} chpl____wide__ref_atomic_int64;
+
+typedef struct chpl_chpl____wide__ref_atomic_int_least64_t_s {
+  chpl_localeID_t locale;
+  _ref_atomic_int_least64_t addr;
+} chpl____wide__ref_atomic_int_least64_t;
+
+typedef struct chpl_chpl____wide__ref_atomic_refcnt_s {
+  chpl_localeID_t locale;
+  _ref_atomic_refcnt addr;
+} chpl____wide__ref_atomic_refcnt;
+
+typedef struct chpl_chpl____wide__ref_atomicflag_s {
+  chpl_localeID_t locale;
+  _ref_atomicflag addr;
+} chpl____wide__ref_atomicflag;
+
+typedef struct chpl_chpl____wide__ref_c_string_s {
+  chpl_localeID_t locale;
+  _ref_c_string addr;
+} chpl____wide__ref_c_string;
+
+typedef struct chpl_chpl____wide__ref_c_string_copy_s {
+  chpl_localeID_t locale;
+  _ref_c_string_copy addr;
+} chpl____wide__ref_c_string_copy;
+
+typedef struct chpl_chpl____wide__ref_channel_F_dynamic_T_s {
+  chpl_localeID_t locale;
+  _ref_channel_F_dynamic_T addr;
+} chpl____wide__ref_channel_F_dynamic_T;
+
+typedef struct chpl_chpl____wide__ref_channel_T_dynamic_T_s {
+  chpl_localeID_t locale;
+  _ref_channel_T_dynamic_T addr;
+} chpl____wide__ref_channel_T_dynamic_T;
+
+typedef struct chpl_chpl____wide__ref_chpl_bool_s {
+  chpl_localeID_t locale;
+  _ref_chpl_bool addr;
+} chpl____wide__ref_chpl_bool;
+
+typedef struct chpl_chpl____wide__ref_chpl_localeID_t_s {
+  chpl_localeID_t locale;
+  _ref_chpl_localeID_t addr;
+} chpl____wide__ref_chpl_localeID_t;
+
+typedef struct chpl_chpl____wide__ref_chpl_localeTreeRecord_s {
+  chpl_localeID_t locale;
+  _ref_chpl_localeTreeRecord addr;
+} chpl____wide__ref_chpl_localeTreeRecord;
+
+typedef struct chpl_chpl____wide__ref_chpl_main_argument_s {
+  chpl_localeID_t locale;
+  _ref_chpl_main_argument addr;
+} chpl____wide__ref_chpl_main_argument;
+
+typedef struct chpl_chpl____wide__ref_chpl_string_s {
+  chpl_localeID_t locale;
+  _ref_chpl_string addr;
+} chpl____wide__ref_chpl_string;
+
+typedef struct chpl_chpl____wide__ref_chpl_task_list_p_s {
+  chpl_localeID_t locale;
+  _ref_chpl_task_list_p addr;
+} chpl____wide__ref_chpl_task_list_p;
+
+typedef struct chpl_chpl____wide__ref_file_s {
+  chpl_localeID_t locale;
+  _ref_file addr;
+} chpl____wide__ref_file;
+
+typedef struct chpl_chpl____wide__ref_int32_t_s {
+  chpl_localeID_t locale;
+  _ref_int32_t addr;
+} chpl____wide__ref_int32_t;
+
+typedef struct chpl_chpl____wide__ref_int64_t_s {
+  chpl_localeID_t locale;
+  _ref_int64_t addr;
+} chpl____wide__ref_int64_t;
+
+typedef struct chpl_chpl____wide__ref_ioLiteral_s {
+  chpl_localeID_t locale;
+  _ref_ioLiteral addr;
+} chpl____wide__ref_ioLiteral;
+
+typedef struct chpl_chpl____wide__ref_ioNewline_s {
+  chpl_localeID_t locale;
+  _ref_ioNewline addr;
+} chpl____wide__ref_ioNewline;
+
+typedef struct chpl_chpl____wide__ref_iostyle_s {
+  chpl_localeID_t locale;
+  _ref_iostyle addr;
+} chpl____wide__ref_iostyle;
+
+typedef struct chpl_chpl____wide__ref_listNode_BaseArr_s {
+  chpl_localeID_t locale;
+  _ref_listNode_BaseArr addr;
+} chpl____wide__ref_listNode_BaseArr;
+
+typedef struct chpl_chpl____wide__ref_listNode_BaseDom_s {
+  chpl_localeID_t locale;
+  _ref_listNode_BaseDom addr;
+} chpl____wide__ref_listNode_BaseDom;
+
+typedef struct chpl_chpl____wide__ref_list_BaseArr_s {
+  chpl_localeID_t locale;
+  _ref_list_BaseArr addr;
+} chpl____wide__ref_list_BaseArr;
+
+typedef struct chpl_chpl____wide__ref_list_BaseDom_s {
+  chpl_localeID_t locale;
+  _ref_list_BaseDom addr;
+} chpl____wide__ref_list_BaseDom;
+
+typedef struct chpl_chpl____wide__ref_locale_s {
+  chpl_localeID_t locale;
+  _ref_locale addr;
+} chpl____wide__ref_locale;
+
+typedef struct chpl_chpl____wide__ref_localesBarrier_s {
+  chpl_localeID_t locale;
+  _ref_localesBarrier addr;
+} chpl____wide__ref_localesBarrier;
+
+typedef struct chpl_chpl____wide__ref_localesSignal_s {
+  chpl_localeID_t locale;
+  _ref_localesSignal addr;
+} chpl____wide__ref_localesSignal;
+
+typedef struct chpl_chpl____wide__ref_object_s {
+  chpl_localeID_t locale;
+  _ref_object addr;
+} chpl____wide__ref_object;
+
+typedef struct chpl_chpl____wide__ref_qio_channel_ptr_t_s {
+  chpl_localeID_t locale;
+  _ref_qio_channel_ptr_t addr;
+} chpl____wide__ref_qio_channel_ptr_t;
+
+typedef struct chpl_chpl____wide__ref_qio_file_ptr_t_s {
+  chpl_localeID_t locale;
+  _ref_qio_file_ptr_t addr;
+} chpl____wide__ref_qio_file_ptr_t;
+
+typedef struct chpl_chpl____wide__ref_range_int64_t_boundedLow_F_s {
+  chpl_localeID_t locale;
+  _ref_range_int64_t_boundedLow_F addr;
+} chpl____wide__ref_range_int64_t_boundedLow_F;
+
+typedef struct chpl_chpl____wide__ref_range_int64_t_bounded_F_s {
+  chpl_localeID_t locale;
+  _ref_range_int64_t_bounded_F addr;
+} chpl____wide__ref_range_int64_t_bounded_F;
+
+typedef struct chpl_chpl____wide__ref_string_rec_s {
+  chpl_localeID_t locale;
+  _ref_string_rec addr;
+} chpl____wide__ref_string_rec;
+
+typedef struct chpl_chpl____wide__ref_string_refcnt_s {
+  chpl_localeID_t locale;
+  _ref_string_refcnt addr;
+} chpl____wide__ref_string_refcnt;
+
+typedef struct chpl_chpl____wide__ref_syserr_s {
+  chpl_localeID_t locale;
+  _ref_syserr addr;
+} chpl____wide__ref_syserr;
+
+typedef struct chpl_chpl____wide__ref_uint64_t_s {
+  chpl_localeID_t locale;
+  _ref_uint64_t addr;
+} chpl____wide__ref_uint64_t;
+
+typedef struct chpl_chpl____wide_heap_channel_F_dynamic_T_s {
+  chpl_localeID_t locale;
+  heap_channel_F_dynamic_T addr;
+} chpl____wide_heap_channel_F_dynamic_T;
+
+typedef struct chpl_chpl____wide_heap_channel_T_dynamic_T_s {
+  chpl_localeID_t locale;
+  heap_channel_T_dynamic_T addr;
+} chpl____wide_heap_channel_T_dynamic_T;
+
+typedef struct chpl_chpl____wide_heap_atomic_int64_s {
+  chpl_localeID_t locale;
+  heap_atomic_int64 addr;
+} chpl____wide_heap_atomic_int64;
+
+/*** Classes ***/
+
+typedef struct chpl__class_localson_fn_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_atomicflag _1_this;
+  memory_order _2_order;
+  chpl____wide__ref_chpl_bool _3__tmp;
+  int64_t _ln;
+  c_string _fn;
+  int64_t _ln2;
+  c_string _fn2;
+} chpl__class_localson_fn_object;
+
+typedef struct chpl__class_localson_fn2_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_atomicflag _1_this;
+  memory_order _2_order;
+  int64_t _ln;
+  c_string _fn;
+  int64_t _ln2;
+  c_string _fn2;
+} chpl__class_localson_fn2_object;
+
+typedef struct chpl__class_localson_fn3_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_atomicflag _1_this;
+  chpl_bool _2_val;
+  memory_order _3_order;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn3_object;
+
+typedef struct chpl__class_localson_fn4_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_atomic_int64 _1_this;
+  int64_t _2_value;
+  memory_order _3_order;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn4_object;
+
+typedef struct chpl__class_localson_fn5_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_atomic_int64 _1_this;
+  int64_t _2_value;
+  memory_order _3_order;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn5_object;
+
+typedef struct chpl__class_localson_fn6_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_atomic_int64 _1_this;
+  int64_t _2_value;
+  memory_order _3_order;
+  chpl____wide__ref_int64_t _4__tmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn6_object;
+
+typedef struct chpl__class_localson_fn7_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_atomic_int64 _1_this;
+  int64_t _2_value;
+  memory_order _3_order;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn7_object;
+
+typedef struct chpl__class_localson_fn8_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_atomic_int64 _1_this;
+  int64_t _2_val;
+  memory_order _3_order;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn8_object;
+
+typedef struct chpl__class_localson_fn9_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_DefaultDist _1_this;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn9_object;
+
+typedef struct chpl__class_localson_fn10_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_DefaultDist _1_rvfDerefTmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn10_object;
+
+typedef struct chpl__class_localson_fn11_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F _1_this;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn11_object;
+
+typedef struct chpl__class_localson_fn12_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F _1_rvfDerefTmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn12_object;
+
+typedef struct chpl__class_localson_fn13_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F _1_this;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn13_object;
+
+typedef struct chpl__class_localson_fn14_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F _1_this;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn14_object;
+
+typedef struct chpl__class_localson_fn15_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F _1_rvfDerefTmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn15_object;
+
+typedef struct chpl__class_localson_fn16_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F _1_rvfDerefTmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn16_object;
+
+typedef struct chpl__class_localson_fn17_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_BaseArr _1_e;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F _2__tmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn17_object;
+
+typedef struct chpl__class_localson_fn18_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_BaseArr _1_e;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn18_object;
+
+typedef struct chpl__class_localson_fn19_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__EndCount _1_rvfDerefTmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn19_object;
+
+typedef struct chpl__class_localson_fn20_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__EndCount _1_e;
+  int64_t _2_numTasks;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn20_object;
+
+typedef struct chpl__class_localson_fn21_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_BaseDist _1_this;
+  chpl____wide_BaseDom _2_x;
+  int64_t _ln;
+  c_string _fn;
+  int64_t _ln2;
+  c_string _fn2;
+} chpl__class_localson_fn21_object;
+
+typedef struct chpl__class_localson_fn22_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_BaseDist _1_rvfDerefTmp;
+  chpl____wide_BaseDom _2_this;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn22_object;
+
+typedef struct chpl__class_localson_fn23_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_BaseDist _1_rvfDerefTmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn23_object;
+
+typedef struct chpl__class_localson_fn24_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_BaseDom _1_this;
+  chpl____wide_BaseArr _2_x;
+  int64_t _ln;
+  c_string _fn;
+  int64_t _ln2;
+  c_string _fn2;
+} chpl__class_localson_fn24_object;
+
+typedef struct chpl__class_localson_fn25_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_BaseDom _1_this;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F _2_x;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn25_object;
+
+typedef struct chpl__class_localson_fn26_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_BaseDom _1_this;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F _2_x;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn26_object;
+
+typedef struct chpl__class_localson_fn27_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_BaseArr _1_this;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn27_object;
+
+typedef struct chpl__class_localson_fn28_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_BaseArr _1_rvfDerefTmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn28_object;
+
+typedef struct chpl__class_localson_fn29_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_BaseDom _1_rvfDerefTmp;
+  chpl____wide_BaseArr _2_this;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn29_object;
+
+typedef struct chpl__class_localson_fn30_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_BaseDom _1_rvfDerefTmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn30_object;
+
+typedef struct chpl__class_localson_fn31_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_StringWriter _1_rvfDerefTmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn31_object;
+
+typedef struct chpl__class_localson_fn32_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_StringWriter _1_rvfDerefTmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn32_object;
+
+typedef struct chpl__class_localson_fn33_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_localesSignal _1_rvfDerefTmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn33_object;
+
+typedef struct chpl__class_localson_fn34_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F _1_rvfDerefTmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn34_object;
+
+typedef struct chpl__class_localson_fn35_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F _1_rvfDerefTmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn35_object;
+
+typedef struct chpl__class_localson_fn36_s {
+  chpl_localeID_t _0_call_tmp;
+  int64_t _1__yieldedIndex;
+  localesBarrier _2_b;
+  chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F _3_flags;
+  chpl____wide__EndCount _4_rvfDerefTmp;
+  _ir_initOnLocales_AbstractRootLocale _5_rvfDerefTmp;
+  chpl____wide_RootLocale _6_this;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn36_object;
+
+typedef struct chpl__class_localson_fn37_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_locale _1_rvfDerefTmp;
+  chpl____wide_locale _2_rvfDerefTmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn37_object;
+
+typedef struct chpl_heap_c_string_s {
+  c_string value;
+} chpl_heap_c_string_object;
+
+typedef struct chpl_heap_chpl_bool_s {
+  chpl_bool value;
+} chpl_heap_chpl_bool_object;
+
+typedef struct chpl_heap_chpl_string_s {
+  chpl____wide_chpl_string value;
+} chpl_heap_chpl_string_object;
+
+typedef struct chpl_heap_int64_t_s {
+  int64_t value;
+} chpl_heap_int64_t_object;
+
+typedef struct chpl_heap__tuple_3_chpl_string_int64_t_ioNewline_s {
+  _tuple_3_chpl_string_int64_t_ioNewline value;
+} chpl_heap__tuple_3_chpl_string_int64_t_ioNewline_object;
+
+typedef struct chpl_heap__tuple_6_star_chpl_string_s {
+  _tuple_6_star_chpl_string value;
+} chpl_heap__tuple_6_star_chpl_string_object;
+
+typedef struct chpl_heap_locale_s {
+  chpl____wide_locale value;
+} chpl_heap_locale_object;
+
+typedef struct chpl_heap_syserr_s {
+  syserr value;
+} chpl_heap_syserr_object;
+
+typedef struct chpl_heap_string_rec_s {
+  string_rec value;
+} chpl_heap_string_rec_object;
+
+typedef struct chpl_heap_iostyle_s {
+  iostyle value;
+} chpl_heap_iostyle_object;
+
+typedef struct chpl_heap_file_s {
+  file value;
+} chpl_heap_file_object;
+
+typedef struct chpl_heap_channel_F_dynamic_T_s {
+  channel_F_dynamic_T value;
+} chpl_heap_channel_F_dynamic_T_object;
+
+typedef struct chpl_heap_channel_T_dynamic_T_s {
+  channel_T_dynamic_T value;
+} chpl_heap_channel_T_dynamic_T_object;
+
+typedef struct chpl_heap_atomic_int64_s {
+  atomic_int64 value;
+} chpl_heap_atomic_int64_object;
+
+typedef struct chpl__class_localson_fn38_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_file _1__tmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn38_object;
+
+typedef struct chpl__class_localson_fn39_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_file _1__tmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn39_object;
+
+typedef struct chpl__class_localson_fn40_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_file _1_ret;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn40_object;
+
+typedef struct chpl__class_localson_fn41_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_file _1_this;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn41_object;
+
+typedef struct chpl__class_localson_fn42_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_file _1_this;
+  chpl____wide__ref_iostyle _2__tmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn42_object;
+
+typedef struct chpl__class_localson_fn43_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_file _1_this;
+  chpl____wide__ref_syserr _2__tmp;
+  chpl____wide__ref_chpl_string _3__tmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn43_object;
+
+typedef struct chpl__class_localson_fn44_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_channel_F_dynamic_T _1__tmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn44_object;
+
+typedef struct chpl__class_localson_fn45_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_channel_T_dynamic_T _1__tmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn45_object;
+
+typedef struct chpl__class_localson_fn46_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_channel_F_dynamic_T _1__tmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn46_object;
+
+typedef struct chpl__class_localson_fn47_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_channel_T_dynamic_T _1__tmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn47_object;
+
+typedef struct chpl__class_localson_fn48_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_channel_F_dynamic_T _1_ret;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn48_object;
+
+typedef struct chpl__class_localson_fn49_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_channel_T_dynamic_T _1_ret;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn49_object;
+
+typedef struct chpl__class_localson_fn50_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_channel_F_dynamic_T _1__tmp;
+  int32_t _2_hints;
+  iostyle _3_rvfDerefTmp;
+  int64_t _4_end;
+  int64_t _5_start;
+  chpl____wide__ref_syserr _6__tmp;
+  chpl____wide__ref_file _7__tmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn50_object;
+
+typedef struct chpl__class_localson_fn51_s {
+  chpl_localeID_t _0__tmp;
+  iostyle _1_rvfDerefTmp;
+  int64_t _2_start;
+  chpl____wide__ref_file _3__tmp;
+  chpl____wide__ref_syserr _4__tmp;
+  int32_t _5_hints;
+  chpl____wide__ref_channel_T_dynamic_T _6__tmp;
+  int64_t _7_end;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn51_object;
+
+typedef struct chpl__class_localson_fn52_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_channel_F_dynamic_T _1_this;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn52_object;
+
+typedef struct chpl__class_localson_fn53_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_channel_T_dynamic_T _1_this;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn53_object;
+
+typedef struct chpl__class_localson_fn54_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_channel_T_dynamic_T _1_this;
+  chpl____wide__ref_chpl_string _2__tmp;
+  chpl____wide__ref_int64_t _3__tmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn54_object;
+
+typedef struct chpl__class_localson_fn55_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_channel_T_dynamic_T _1_this;
+  chpl____wide__ref_syserr _2__tmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn55_object;
+
+typedef struct chpl__class_localson_fn56_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_channel_T_dynamic_T _1_this;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn56_object;
+
+typedef struct chpl__class_localson_fn57_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_syserr _1__tmp;
+  int64_t _2_end;
+  chpl____wide__ref_channel_F_dynamic_T _3__tmp;
+  file _4_rvfDerefTmp;
+  int64_t _5_start;
+  int32_t _6_hints;
+  iostyle _7_rvfDerefTmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn57_object;
+
+typedef struct chpl__class_localson_fn58_s {
+  chpl_localeID_t _0__tmp;
+  file _1_rvfDerefTmp;
+  int64_t _2_start;
+  int32_t _3_hints;
+  iostyle _4_rvfDerefTmp;
+  chpl____wide__ref_syserr _5__tmp;
+  int64_t _6_end;
+  chpl____wide__ref_channel_T_dynamic_T _7__tmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn58_object;
+
+typedef struct chpl__class_localson_fn59_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_channel_T_dynamic_T _1_this;
+  chpl____wide__ref_syserr _2__tmp;
+  chpl____wide__ref__tuple_3_chpl_string_int64_t_ioNewline _3__tmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn59_object;
+
+typedef struct chpl__class_localson_fn60_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_listNode_BaseDom _1_rvfDerefTmp;
+  int64_t _ln;
+  c_string _fn;
+  int64_t _ln2;
+  c_string _fn2;
+} chpl__class_localson_fn60_object;
+
+typedef struct chpl__class_localson_fn61_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_listNode_BaseArr _1_rvfDerefTmp;
+  int64_t _ln;
+  c_string _fn;
+  int64_t _ln2;
+  c_string _fn2;
+} chpl__class_localson_fn61_object;
+
+typedef struct chpl__class_localson_fn62_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_string_refcnt _1_rvfDerefTmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn62_object;
+
+typedef struct chpl__class_localson_fn63_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_string_rec _1_this;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn63_object;
+
+typedef struct chpl__class_localson_fn64_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_string_refcnt _1_rvfDerefTmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn64_object;
+
+typedef struct chpl__class_localson_fn65_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide__ref_string_rec _1_this;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn65_object;
+
+typedef struct chpl__class_localson_fn66_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_string_refcnt _1_rvfDerefTmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn66_object;
+
+typedef struct chpl__class_localson_fn67_s {
+  chpl_localeID_t _0__tmp;
+  chpl____wide_string_refcnt _1_rvfDerefTmp;
+  int64_t _ln;
+  c_string _fn;
+} chpl__class_localson_fn67_object;
+
+typedef struct chpl_object_s {
+  chpl__class_id chpl__cid;
+} chpl_object_object;
+
+typedef struct chpl_chpl___EndCount_s /* : object */ {
+  chpl_object_object super;
+  atomic_int64 i;
+  int64_t taskCnt;
+  chpl_task_list_p taskList;
+  int64_t numDeferred;
+} chpl_chpl___EndCount_object;
+
+typedef struct chpl_BaseDist_s /* : object */ {
+  chpl_object_object super;
+  atomic_refcnt _distCnt;
+  list_BaseDom _doms;
+  atomicflag _domsLock;
+} chpl_BaseDist_object;
+
+typedef struct chpl_BaseDom_s /* : object */ {
+  chpl_object_object super;
+  atomic_refcnt _domCnt;
+  list_BaseArr _arrs;
+  atomicflag _arrsLock;
+} chpl_BaseDom_object;
+
+typedef struct chpl_BaseArr_s /* : object */ {
+  chpl_object_object super;
+  atomic_refcnt _arrCnt;
+  chpl____wide_BaseArr _arrAlias;
+} chpl_BaseArr_object;
+
+typedef struct chpl_Writer_s /* : object */ {
+  chpl_object_object super;
+} chpl_Writer_object;
+
+typedef struct chpl_Reader_s /* : object */ {
+  chpl_object_object super;
+} chpl_Reader_object;
+
+typedef struct chpl_locale_s /* : object */ {
+  chpl_object_object super;
+  chpl____wide_locale parent;
+  int64_t numCores;
+  int64_t maxTaskPar;
+  atomic_int64 runningTaskCounter;
+} chpl_locale_object;
+
+typedef struct chpl_localesSignal_s /* : object */ {
+  chpl_object_object super;
+  atomicflag s;
+} chpl_localesSignal_object;
+
+typedef struct chpl_listNode_BaseArr_s /* : object */ {
+  chpl_object_object super;
+  chpl____wide_BaseArr data;
+  chpl____wide_listNode_BaseArr next;
+} chpl_listNode_BaseArr_object;
+
+typedef struct chpl_listNode_BaseDom_s /* : object */ {
+  chpl_object_object super;
+  chpl____wide_BaseDom data;
+  chpl____wide_listNode_BaseDom next;
+} chpl_listNode_BaseDom_object;
+
+typedef struct chpl_string_refcnt_s /* : object */ {
+  chpl_object_object super;
+  atomic_refcnt val;
+} chpl_string_refcnt_object;
+
+typedef struct chpl_BaseRectangularDom_s /* : BaseDom */ {
+  chpl_BaseDom_object super;
+} chpl_BaseRectangularDom_object;
+
+typedef struct chpl_StringWriter_s /* : Writer */ {
+  chpl_Writer_object super;
+  c_string_copy s;
+} chpl_StringWriter_object;
+
+typedef struct chpl_AbstractLocaleModel_s /* : locale */ {
+  chpl_locale_object super;
+} chpl_AbstractLocaleModel_object;
+
+typedef struct chpl_AbstractRootLocale_s /* : locale */ {
+  chpl_locale_object super;
+} chpl_AbstractRootLocale_object;
+
+typedef struct chpl_DefaultDist_s /* : BaseDist */ {
+  chpl_BaseDist_object super;
+} chpl_DefaultDist_object;
+
+typedef struct chpl_DefaultRectangularArr_locale_1_int64_t_F_s /* : BaseArr */ {
+  chpl_BaseArr_object super;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F dom;
+  _tuple_1_star_int64_t off;
+  _tuple_1_star_int64_t blk;
+  _tuple_1_star_int64_t str;
+  int64_t origin;
+  int64_t factoredOffs;
+  chpl____wide__ddata_locale data;
+  chpl____wide__ddata_locale shiftedData;
+  chpl_bool noinit_data;
+} chpl_DefaultRectangularArr_locale_1_int64_t_F_object;
+
+typedef struct chpl_DefaultRectangularArr_localesSignal_1_int64_t_F_s /* : BaseArr */ {
+  chpl_BaseArr_object super;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F dom;
+  _tuple_1_star_int64_t off;
+  _tuple_1_star_int64_t blk;
+  _tuple_1_star_int64_t str;
+  int64_t origin;
+  int64_t factoredOffs;
+  chpl____wide__ddata_localesSignal data;
+  chpl____wide__ddata_localesSignal shiftedData;
+  chpl_bool noinit_data;
+} chpl_DefaultRectangularArr_localesSignal_1_int64_t_F_object;
+
+typedef struct chpl_DefaultRectangularDom_1_int64_t_F_s /* : BaseRectangularDom */ {
+  chpl_BaseRectangularDom_object super;
+  chpl____wide_DefaultDist dist;
+  _tuple_1_star_range_int64_t_bounded_F ranges;
+} chpl_DefaultRectangularDom_1_int64_t_F_object;
+
+typedef struct chpl_LocaleModel_s /* : AbstractLocaleModel */ {
+  chpl_AbstractLocaleModel_object super;
+  uint64_t callStackSize;
+  int64_t _node_id;
+  chpl____wide_chpl_string local_name;
+} chpl_LocaleModel_object;
+
+typedef struct chpl_RootLocale_s /* : AbstractRootLocale */ {
+  chpl_AbstractRootLocale_object super;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F myLocaleSpace;
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F myLocales;
+} chpl_RootLocale_object;
+
+/*** Function Prototypes ***/
+
+static void chpl__init_Atomics(int64_t _ln, c_string _fn);
+static void atomic_fence(memory_order order, int64_t _ln, c_string _fn);
+static atomicflag _construct_atomicflag(atomic_flag _v, atomicflag* const meme, int64_t _ln, c_string _fn);
+static void _local_on_fn(chpl____wide__ref_atomicflag* const this6, memory_order order, chpl____wide__ref_chpl_bool* const ret, int64_t _ln, c_string _fn);
+static void _local_wrapon_fn(_class_localson_fn c);
+static void on_fn(chpl____wide__ref_atomicflag* const this6, memory_order order, chpl____wide__ref_chpl_bool* const ret, int64_t _ln, c_string _fn);
+static void wrapon_fn(_class_localson_fn c);
+static void _local_on_fn2(chpl____wide__ref_atomicflag* const this6, memory_order order, int64_t _ln, c_string _fn);
+static void _local_wrapon_fn2(_class_localson_fn2 c);
+static void on_fn2(chpl____wide__ref_atomicflag* const this6, memory_order order, int64_t _ln, c_string _fn);
+static void wrapon_fn2(_class_localson_fn2 c);
+static void on_fn3(chpl____wide__ref_atomicflag* const this6, chpl_bool val, memory_order order, int64_t _ln, c_string _fn);
+static void wrapon_fn3(_class_localson_fn3 c);
+static atomic_int64 _construct_atomic_int64(atomic_int_least64_t _v, atomic_int64* const meme, int64_t _ln, c_string _fn);
+static void on_fn4(chpl____wide__ref_atomic_int64* const this6, int64_t value, memory_order order, int64_t _ln, c_string _fn);
+static void wrapon_fn4(_class_localson_fn4 c);
+static void on_fn5(chpl____wide__ref_atomic_int64* const this6, int64_t value, memory_order order, int64_t _ln, c_string _fn);
+static void wrapon_fn5(_class_localson_fn5 c);
+static void on_fn6(chpl____wide__ref_atomic_int64* const this6, int64_t value, memory_order order, chpl____wide__ref_int64_t* const ret, int64_t _ln, c_string _fn);
+static void wrapon_fn6(_class_localson_fn6 c);
+static void on_fn7(chpl____wide__ref_atomic_int64* const this6, int64_t value, memory_order order, int64_t _ln, c_string _fn);
+static void wrapon_fn7(_class_localson_fn7 c);
+static void on_fn8(chpl____wide__ref_atomic_int64* const this6, int64_t val, memory_order order, int64_t _ln, c_string _fn);
+static void wrapon_fn8(_class_localson_fn8 c);
+static void chpl__init_AtomicsCommon(int64_t _ln, c_string _fn);
+static atomic_refcnt _construct_atomic_refcnt(atomic_int64* const _cnt, atomic_refcnt* const meme, int64_t _ln, c_string _fn);
+static void chpl__init_CString(int64_t _ln, c_string _fn);
+static void chpl__init_ChapelArray(int64_t _ln, c_string _fn);
+static void _newArray(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const value, _ref_DefaultRectangularArr_locale_1_int64_t_F _retArg, int64_t _ln, c_string _fn);
+static void _newArray2(chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const value, _ref_DefaultRectangularArr_localesSignal_1_int64_t_F _retArg, int64_t _ln, c_string _fn);
+static void _newDomain(DefaultRectangularDom_1_int64_t_F value, _ref_DefaultRectangularDom_1_int64_t_F _retArg, int64_t _ln, c_string _fn);
+static void _getDomain(chpl____wide_DefaultRectangularDom_1_int64_t_F* const value, _ref_DefaultRectangularDom_1_int64_t_F _retArg, int64_t _ln, c_string _fn);
+static void _newDistribution(chpl____wide_DefaultDist* const value, _ref_DefaultDist _retArg, int64_t _ln, c_string _fn);
+static void _getDistribution(chpl____wide_DefaultDist* const value, _ref_DefaultDist _retArg, int64_t _ln, c_string _fn);
+static chpl___RuntimeTypeInfo chpl__buildDomainRuntimeType(chpl____wide_DefaultDist* const d, int64_t _ln, c_string _fn);
+static void chpl__convertRuntimeTypeToValue(chpl____wide_DefaultDist* const d, _ref_DefaultRectangularDom_1_int64_t_F _retArg, int64_t _ln, c_string _fn);
+static chpl___RuntimeTypeInfo chpl__convertValueToRuntimeType(chpl____wide_DefaultRectangularDom_1_int64_t_F* const dom, int64_t _ln, c_string _fn);
+static chpl___RuntimeTypeInfo2 chpl__buildArrayRuntimeType(chpl____wide_DefaultRectangularDom_1_int64_t_F* const dom, int64_t _ln, c_string _fn);
+static chpl___RuntimeTypeInfo3 chpl__buildArrayRuntimeType2(chpl____wide_DefaultRectangularDom_1_int64_t_F* const dom, int64_t _ln, c_string _fn);
+static void chpl__convertRuntimeTypeToValue2(chpl____wide_DefaultRectangularDom_1_int64_t_F* const dom, _ref_DefaultRectangularArr_locale_1_int64_t_F _retArg, int64_t _ln, c_string _fn);
+static void chpl__convertRuntimeTypeToValue3(chpl____wide_DefaultRectangularDom_1_int64_t_F* const dom, _ref_DefaultRectangularArr_localesSignal_1_int64_t_F _retArg, int64_t _ln, c_string _fn);
+static void chpl_incRefCountsForDomainsInArrayEltTypes(void);
+static void chpl_incRefCountsForDomainsInArrayEltTypes2(void);
+static void chpl_decRefCountsForDomainsInArrayEltTypes(void);
+static void chpl_decRefCountsForDomainsInArrayEltTypes2(void);
+static void chpl__buildDomainExpr(range_int64_t_bounded_F* const _e0_ranges, _ref_DefaultRectangularDom_1_int64_t_F _retArg, int64_t _ln, c_string _fn);
+static void chpl__ensureDomainExpr(chpl____wide_DefaultRectangularDom_1_int64_t_F* const x2, _ref_DefaultRectangularDom_1_int64_t_F _retArg, int64_t _ln, c_string _fn);
+static void chpl__ensureDomainExpr2(range_int64_t_bounded_F* const _e0_x, _ref_DefaultRectangularDom_1_int64_t_F _retArg, int64_t _ln, c_string _fn);
+static void chpl__buildDistValue(DefaultDist x2, _ref_DefaultDist _retArg, int64_t _ln, c_string _fn);
+static void chpl__buildDistValue2(DefaultDist x2, _ref_DefaultDist _retArg, int64_t _ln, c_string _fn);
+static chpl____wide_DefaultDist _construct__distribution(chpl____wide_DefaultDist* const _value, chpl____wide_DefaultDist* const meme, int64_t _ln, c_string _fn);
+static chpl____wide_DefaultDist _distribution(chpl____wide_DefaultDist* const _value, int64_t _ln, c_string _fn);
+static void chpl___TILDE__distribution(chpl____wide_DefaultDist* const this6, int64_t _ln, c_string _fn);
+static void on_fn9(chpl____wide_DefaultDist* const this6, int64_t _ln, c_string _fn);
+static void wrapon_fn9(_class_localson_fn9 c);
+static void on_fn10(chpl____wide_DefaultDist* const delete_tmp, int64_t _ln, c_string _fn);
+static void wrapon_fn10(_class_localson_fn10 c);
+static void clone2(chpl____wide_DefaultDist* const this6, _ref_DefaultDist _retArg, int64_t _ln, c_string _fn);
+static DefaultRectangularDom_1_int64_t_F newRectangularDom(chpl____wide_DefaultDist* const this6, int64_t _ln, c_string _fn);
+static chpl____wide_DefaultRectangularDom_1_int64_t_F _construct__domain(chpl____wide_DefaultRectangularDom_1_int64_t_F* const _value, chpl____wide_DefaultRectangularDom_1_int64_t_F* const meme, int64_t _ln, c_string _fn);
+static void chpl___TILDE__domain(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, int64_t _ln, c_string _fn);
+static void on_fn11(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, int64_t _ln, c_string _fn);
+static void wrapon_fn11(_class_localson_fn11 c);
+static void on_fn12(chpl____wide_DefaultRectangularDom_1_int64_t_F* const delete_tmp, int64_t _ln, c_string _fn);
+static void wrapon_fn12(_class_localson_fn12 c);
+static void dist(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, _ref_DefaultDist _retArg, int64_t _ln, c_string _fn);
+static void this2(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, range_int64_t_bounded_F* const _e0_ranges, _ref_DefaultRectangularDom_1_int64_t_F _retArg, int64_t _ln, c_string _fn);
+static void buildArray(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, _ref_DefaultRectangularArr_locale_1_int64_t_F _retArg, int64_t _ln, c_string _fn);
+static void buildArray2(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, _ref_DefaultRectangularArr_localesSignal_1_int64_t_F _retArg, int64_t _ln, c_string _fn);
+static void help(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, _ref_DefaultRectangularArr_locale_1_int64_t_F x2, int64_t _ln, c_string _fn);
+static void help2(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, _ref_DefaultRectangularArr_localesSignal_1_int64_t_F x2, int64_t _ln, c_string _fn);
+static int64_t numIndices(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, int64_t _ln, c_string _fn);
+static void setIndices(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, _tuple_1_star_range_int64_t_bounded_F* const x2, int64_t _ln, c_string _fn);
+static void getIndices(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, _ref__tuple_1_star_range_int64_t_bounded_F _retArg, int64_t _ln, c_string _fn);
+static chpl____wide_DefaultRectangularArr_locale_1_int64_t_F _construct__array(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const _value, chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const meme, int64_t _ln, c_string _fn);
+static chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F _construct__array2(chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const _value, chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const meme, int64_t _ln, c_string _fn);
+static void initialize(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const this6);
+static void initialize2(chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const this6);
+static void chpl___TILDE__array(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const this6, int64_t _ln, c_string _fn);
+static void chpl___TILDE__array2(chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const this6, int64_t _ln, c_string _fn);
+static void on_fn13(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const this6, int64_t _ln, c_string _fn);
+static void on_fn14(chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const this6, int64_t _ln, c_string _fn);
+static void wrapon_fn13(_class_localson_fn13 c);
+static void wrapon_fn14(_class_localson_fn14 c);
+static void on_fn15(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const delete_tmp, int64_t _ln, c_string _fn);
+static void on_fn16(chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const delete_tmp, int64_t _ln, c_string _fn);
+static void wrapon_fn15(_class_localson_fn15 c);
+static void wrapon_fn16(_class_localson_fn16 c);
+static void _dom(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const this6, _ref_DefaultRectangularDom_1_int64_t_F _retArg, int64_t _ln, c_string _fn);
+static void newAlias(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const this6, _ref_DefaultRectangularArr_locale_1_int64_t_F _retArg, int64_t _ln, c_string _fn);
+static void chpl___ASSIGN_(chpl____wide_DefaultDist* const a, chpl____wide_DefaultDist* const b, int64_t _ln, c_string _fn);
+static void chpl___ASSIGN_2(chpl____wide_DefaultRectangularDom_1_int64_t_F* const a, chpl____wide_DefaultRectangularDom_1_int64_t_F* const b, int64_t _ln, c_string _fn);
+static void on_fn17(chpl____wide_BaseArr* const e, chpl____wide_DefaultRectangularDom_1_int64_t_F* const b, int64_t _ln, c_string _fn);
+static void wrapon_fn17(_class_localson_fn17 c);
+static void on_fn18(chpl____wide_BaseArr* const e, int64_t _ln, c_string _fn);
+static void wrapon_fn18(_class_localson_fn18 c);
+static chpl____wide_DefaultDist chpl__initCopy(chpl____wide_DefaultDist* const a, int64_t _ln, c_string _fn);
+static chpl____wide_DefaultRectangularDom_1_int64_t_F chpl__initCopy2(chpl____wide_DefaultRectangularDom_1_int64_t_F* const a, int64_t _ln, c_string _fn);
+static void chpl__init_ChapelBase(int64_t _ln, c_string _fn);
+static void compilerAssert(void);
+static void init_elts(chpl____wide__ddata_locale* const x2, int64_t s, int64_t _ln, c_string _fn);
+static void init_elts2(chpl____wide__ddata_localesSignal* const x2, int64_t s, int64_t _ln, c_string _fn);
+static chpl___EndCount _construct__EndCount(atomic_int64* const i, int64_t taskCnt, chpl_task_list_p taskList, int64_t numDeferred, chpl___EndCount meme, int64_t _ln, c_string _fn);
+static void chpl__auto_destroy__EndCount(chpl___EndCount this6, int64_t _ln, c_string _fn);
+static void on_fn19(chpl____wide__EndCount* const delete_tmp, int64_t _ln, c_string _fn);
+static void wrapon_fn19(_class_localson_fn19 c);
+static void _upEndCount(chpl____wide__EndCount* const e, int64_t numTasks, int64_t _ln, c_string _fn);
+static void on_fn20(chpl____wide__EndCount* const e, int64_t numTasks, int64_t _ln, c_string _fn);
+static void wrapon_fn20(_class_localson_fn20 c);
+static void _upEndCountFlush(chpl___EndCount e, int64_t _ln, c_string _fn);
+static void _downEndCount(chpl____wide__EndCount* const e, int64_t _ln, c_string _fn);
+static void _waitEndCount(chpl___EndCount e, int64_t _ln, c_string _fn);
+static void _waitEndCount2(chpl___EndCount _endCount, int64_t _ln, c_string _fn);
+static int64_t _command_line_cast(c_string x2, int64_t _ln, c_string _fn);
+static chpl_bool _command_line_cast2(c_string x2, int64_t _ln, c_string _fn);
+static int64_t _command_line_cast3(c_string x2, int64_t _ln, c_string _fn);
+static int64_t _command_line_cast4(c_string x2, int64_t _ln, c_string _fn);
+static chpl_bool _command_line_cast5(c_string x2, int64_t _ln, c_string _fn);
+static chpl_bool _command_line_cast6(c_string x2, int64_t _ln, c_string _fn);
+static chpl_bool _command_line_cast7(c_string x2, int64_t _ln, c_string _fn);
+static chpl_bool _command_line_cast8(c_string x2, int64_t _ln, c_string _fn);
+static uint64_t _command_line_cast9(c_string x2, int64_t _ln, c_string _fn);
+static uint64_t _command_line_cast10(c_string x2, int64_t _ln, c_string _fn);
+static c_string _command_line_cast11(c_string x2, int64_t _ln, c_string _fn);
+static c_string _command_line_cast12(c_string x2, int64_t _ln, c_string _fn);
+static chpl_bool _command_line_cast13(c_string x2, int64_t _ln, c_string _fn);
+static chpl____wide_DefaultDist chpl__autoCopy(chpl____wide_DefaultDist* const x2, int64_t _ln, c_string _fn);
+static chpl____wide_DefaultRectangularDom_1_int64_t_F chpl__autoCopy2(chpl____wide_DefaultRectangularDom_1_int64_t_F* const x2, int64_t _ln, c_string _fn);
+static chpl____wide_DefaultRectangularArr_locale_1_int64_t_F chpl__autoCopy3(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const x2, int64_t _ln, c_string _fn);
+static chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F chpl__autoCopy4(chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const x2, int64_t _ln, c_string _fn);
+static void chpl__autoDestroy(chpl____wide_DefaultDist* const x2, int64_t _ln, c_string _fn);
+static void chpl__autoDestroy2(chpl____wide_DefaultRectangularDom_1_int64_t_F* const x2, int64_t _ln, c_string _fn);
+static void chpl__autoDestroy3(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const x2, int64_t _ln, c_string _fn);
+static void chpl__autoDestroy4(chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const x2, int64_t _ln, c_string _fn);
+static void chpl__init_ChapelDistribution(int64_t _ln, c_string _fn);
+static BaseDist _construct_BaseDist(atomic_refcnt* const _distCnt, list_BaseDom* const _doms, atomicflag* const _domsLock, BaseDist meme, int64_t _ln, c_string _fn);
+static void chpl__auto_destroy_BaseDist(BaseDist this6, int64_t _ln, c_string _fn);
+static int64_t destroyDist(chpl____wide_BaseDist* const this6, int64_t _ln, c_string _fn);
+static void _local_on_fn3(chpl____wide_BaseDist* const this6, chpl____wide_BaseDom* const x2, int64_t _ln, c_string _fn);
+static void _local_wrapon_fn3(_class_localson_fn21 c);
+static void on_fn21(chpl____wide_BaseDist* const this6, chpl____wide_BaseDom* const x2, int64_t _ln, c_string _fn);
+static void wrapon_fn21(_class_localson_fn21 c);
+static void dsiDestroyDistClass(chpl____wide_BaseDist* const this6);
+static BaseDom _construct_BaseDom(atomic_refcnt* const _domCnt, list_BaseArr* const _arrs, atomicflag* const _arrsLock, BaseDom meme, int64_t _ln, c_string _fn);
+static void chpl__auto_destroy_BaseDom(BaseDom this6, int64_t _ln, c_string _fn);
+static BaseDist dsiMyDist(chpl____wide_BaseDom* const this6, int64_t _ln, c_string _fn);
+static int64_t destroyDom(chpl____wide_BaseDom* const this6, int64_t _ln, c_string _fn);
+static void on_fn22(chpl____wide_BaseDist* const dist2, chpl____wide_BaseDom* const this6, int64_t _ln, c_string _fn);
+static void wrapon_fn22(_class_localson_fn22 c);
+static void on_fn23(chpl____wide_BaseDist* const delete_tmp, int64_t _ln, c_string _fn);
+static void wrapon_fn23(_class_localson_fn23 c);
+static void _local_on_fn4(chpl____wide_BaseDom* const this6, chpl____wide_BaseArr* const x2, int64_t _ln, c_string _fn);
+static void _local_wrapon_fn4(_class_localson_fn24 c);
+static void on_fn24(chpl____wide_BaseDom* const this6, chpl____wide_BaseArr* const x2, int64_t _ln, c_string _fn);
+static void wrapon_fn24(_class_localson_fn24 c);
+static void on_fn25(chpl____wide_BaseDom* const this6, chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const x2, int64_t _ln, c_string _fn);
+static void on_fn26(chpl____wide_BaseDom* const this6, chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const x2, int64_t _ln, c_string _fn);
+static void wrapon_fn25(_class_localson_fn25 c);
+static void wrapon_fn26(_class_localson_fn26 c);
+static chpl_bool dsiLinksDistribution(chpl____wide_BaseDom* const this6);
+static BaseRectangularDom _construct_BaseRectangularDom(atomic_refcnt* const _domCnt, list_BaseArr* const _arrs, atomicflag* const _arrsLock, BaseRectangularDom meme, int64_t _ln, c_string _fn);
+static void chpl__auto_destroy_BaseRectangularDom(BaseRectangularDom this6, int64_t _ln, c_string _fn);
+static BaseArr _construct_BaseArr(atomic_refcnt* const _arrCnt, BaseArr _arrAlias, BaseArr meme, int64_t _ln, c_string _fn);
+static void chpl__auto_destroy_BaseArr(BaseArr this6, int64_t _ln, c_string _fn);
+static chpl____wide_BaseDom dsiGetBaseDom(chpl____wide_BaseArr* const this6, int64_t _ln, c_string _fn);
+static int64_t destroyArr(chpl____wide_BaseArr* const this6, int64_t _ln, c_string _fn);
+static void on_fn27(chpl____wide_BaseArr* const this6, int64_t _ln, c_string _fn);
+static void wrapon_fn27(_class_localson_fn27 c);
+static void on_fn28(chpl____wide_BaseArr* const delete_tmp, int64_t _ln, c_string _fn);
+static void wrapon_fn28(_class_localson_fn28 c);
+static void on_fn29(chpl____wide_BaseDom* const dom, chpl____wide_BaseArr* const this6, int64_t _ln, c_string _fn);
+static void wrapon_fn29(_class_localson_fn29 c);
+static void on_fn30(chpl____wide_BaseDom* const delete_tmp, int64_t _ln, c_string _fn);
+static void wrapon_fn30(_class_localson_fn30 c);
+static void dsiDestroyData(chpl____wide_BaseArr* const this6, int64_t _ln, c_string _fn);
+static void dsiReallocate(chpl____wide_BaseArr* const this6, chpl____wide_DefaultRectangularDom_1_int64_t_F* const d, int64_t _ln, c_string _fn);
+static void dsiPostReallocate(chpl____wide_BaseArr* const this6);
+static void chpl__init_ChapelDynDispHack(int64_t _ln, c_string _fn);
+static void chpl__init_ChapelIO(int64_t _ln, c_string _fn);
+static Writer _construct_Writer(Writer meme, int64_t _ln, c_string _fn);
+static void chpl__auto_destroy_Writer(Writer this6, int64_t _ln, c_string _fn);
+static chpl_bool binary(Writer this6, int64_t _ln, c_string _fn);
+static int64_t styleElement(Writer this6, int64_t element);
+static void writePrimitive(chpl____wide_Writer* const this6, chpl____wide_chpl_string x2, int64_t _ln, c_string _fn);
+static void writePrimitive2(chpl____wide_Writer* const this6, ioLiteral* const x2, int64_t _ln, c_string _fn);
+static void writePrimitive3(chpl____wide_Writer* const this6, int64_t x2, int64_t _ln, c_string _fn);
+static void writeIt(chpl____wide_Writer* const this6, chpl____wide_chpl_string x2, int64_t _ln, c_string _fn);
+static void writeIt2(Writer this6, _tuple_1_star_int64_t* const x2, int64_t _ln, c_string _fn);
+static void writeIt3(chpl____wide_Writer* const this6, ioLiteral* const x2, int64_t _ln, c_string _fn);
+static void writeIt4(chpl____wide_Writer* const this6, int64_t x2, int64_t _ln, c_string _fn);
+static void readwrite(Writer this6, ioLiteral* const x2, int64_t _ln, c_string _fn);
+static void readwrite2(Writer this6, int64_t x2, int64_t _ln, c_string _fn);
+static void write2(Writer this6, chpl____wide_chpl_string _e0_args, _tuple_1_star_int64_t* const _e1_args, int64_t _ln, c_string _fn);
+static void write3(Writer this6, chpl____wide_chpl_string _e0_args, int64_t _e1_args, int64_t _ln, c_string _fn);
+static void chpl__auto_destroy_Reader(Reader this6, int64_t _ln, c_string _fn);
+static void assert2(chpl_bool test, int64_t _ln, c_string _fn);
+static void halt(c_string s, int64_t _ln, c_string _fn);
+static void halt2(chpl____wide_chpl_string _e0_args, _tuple_1_star_int64_t* const _e1_args, int64_t _ln, c_string _fn);
+static void halt3(chpl____wide_chpl_string _e0_args, int64_t _e1_args, int64_t _ln, c_string _fn);
+static StringWriter _construct_StringWriter(c_string_copy s, StringWriter meme, int64_t _ln, c_string _fn);
+static StringWriter StringWriter2(c_string x2, int64_t _ln, c_string _fn);
+static void writePrimitive4(chpl____wide_StringWriter* const this6, chpl____wide_chpl_string x2, int64_t _ln, c_string _fn);
+static void writePrimitive5(chpl____wide_StringWriter* const this6, ioLiteral* const x2, int64_t _ln, c_string _fn);
+static void writePrimitive6(chpl____wide_StringWriter* const this6, int64_t x2, int64_t _ln, c_string _fn);
+static void chpl___TILDE_StringWriter(StringWriter this6, int64_t _ln, c_string _fn);
+static void write4(chpl____wide__ref_c_string* const this6, chpl____wide_chpl_string _e0_args, _tuple_1_star_int64_t* const _e1_args, int64_t _ln, c_string _fn);
+static void write5(chpl____wide__ref_c_string* const this6, chpl____wide_chpl_string _e0_args, int64_t _e1_args, int64_t _ln, c_string _fn);
+static void on_fn31(chpl____wide_StringWriter* const delete_tmp, int64_t _ln, c_string _fn);
+static void on_fn32(chpl____wide_StringWriter* const delete_tmp, int64_t _ln, c_string _fn);
+static void wrapon_fn31(_class_localson_fn31 c);
+static void wrapon_fn32(_class_localson_fn32 c);
+static void chpl__init_ChapelLocale(int64_t _ln, c_string _fn);
+static locale _construct_locale(locale parent, int64_t numCores, int64_t maxTaskPar, atomic_int64* const runningTaskCounter, locale meme, int64_t _ln, c_string _fn);
+static void chpl__auto_destroy_locale(locale this6, int64_t _ln, c_string _fn);
+static locale locale2(int64_t _ln, c_string _fn);
+static int64_t id(chpl____wide_locale* const this6, int64_t _ln, c_string _fn);
+static int64_t chpl_id(chpl____wide_locale* const this6, int64_t _ln, c_string _fn);
+static chpl____wide_locale getChild(chpl____wide_locale* const this6, int64_t idx, int64_t _ln, c_string _fn);
+static AbstractLocaleModel _construct_AbstractLocaleModel(locale parent, int64_t numCores, int64_t maxTaskPar, atomic_int64* const runningTaskCounter, AbstractLocaleModel meme, int64_t _ln, c_string _fn);
+static void chpl__auto_destroy_AbstractLocaleModel(AbstractLocaleModel this6, int64_t _ln, c_string _fn);
+static AbstractRootLocale _construct_AbstractRootLocale(locale parent, int64_t numCores, int64_t maxTaskPar, atomic_int64* const runningTaskCounter, AbstractRootLocale meme, int64_t _ln, c_string _fn);
+static void chpl__auto_destroy_AbstractRootLocale(AbstractRootLocale this6, int64_t _ln, c_string _fn);
+static chpl____wide_locale localeIDtoLocale(chpl____wide_AbstractRootLocale* const this6, chpl_localeID_t* const id2, int64_t _ln, c_string _fn);
+static localesSignal _construct_localesSignal(atomicflag* const s, localesSignal meme, int64_t _ln, c_string _fn);
+static void chpl__auto_destroy_localesSignal(localesSignal this6, int64_t _ln, c_string _fn);
+static localesBarrier _construct_localesBarrier(localesBarrier* const meme);
+static void wait5(_ref_localesBarrier this6, int64_t locIdx, chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const flags, int64_t _ln, c_string _fn);
+static void on_fn33(chpl____wide_localesSignal* const delete_tmp, int64_t _ln, c_string _fn);
+static void wrapon_fn33(_class_localson_fn33 c);
+static void chpl_init_rootLocale(int64_t _ln, c_string _fn);
+static void chpl_rootLocaleInitPrivate(int64_t locIdx, int64_t _ln, c_string _fn);
+static chpl____wide_locale chpl_localeID_to_locale(chpl_localeID_t* const id2, int64_t _ln, c_string _fn);
+void chpl_taskRunningCntInc(int64_t _ln, c_string _fn);
+void chpl_taskRunningCntDec(int64_t _ln, c_string _fn);
+static void chpl__init_ChapelNumLocales(int64_t _ln, c_string _fn);
+static void chpl__init_ChapelRange(int64_t _ln, c_string _fn);
+static range_int64_t_bounded_F _construct_range(int64_t _low, int64_t _high, int64_t _stride, int64_t _alignment, chpl_bool _aligned, range_int64_t_bounded_F* const meme, int64_t _ln, c_string _fn);
+static range_int64_t_boundedLow_F _construct_range2(int64_t _low, int64_t _high, int64_t _stride, int64_t _alignment, chpl_bool _aligned, range_int64_t_boundedLow_F* const meme, int64_t _ln, c_string _fn);
+static range_int64_t_bounded_F range(int64_t _low, int64_t _high, int64_t _stride, int64_t _alignment, chpl_bool _aligned, int64_t _ln, c_string _fn);
+static range_int64_t_boundedLow_F range2(int64_t _low, int64_t _high, int64_t _stride, int64_t _alignment, chpl_bool _aligned, int64_t _ln, c_string _fn);
+static void _build_range(int64_t low, int64_t high, _ref_range_int64_t_bounded_F _retArg, int64_t _ln, c_string _fn);
+static void _build_range2(int64_t bound, _ref_range_int64_t_boundedLow_F _retArg, int64_t _ln, c_string _fn);
+static int64_t length(chpl____wide__ref_range_int64_t_bounded_F* const this6, int64_t _ln, c_string _fn);
+static void this3(_ref_range_int64_t_bounded_F this6, range_int64_t_bounded_F* const other, _ref_range_int64_t_bounded_F _retArg, int64_t _ln, c_string _fn);
+static void chpl_count_help(range_int64_t_boundedLow_F* const r, int64_t count, _ref_range_int64_t_bounded_F _retArg, int64_t _ln, c_string _fn);
+static void chpl___POUND_(range_int64_t_boundedLow_F* const r, int64_t count, _ref_range_int64_t_bounded_F _retArg, int64_t _ln, c_string _fn);
+static chpl_bool checkIfIterWillOverflow(_ref_range_int64_t_bounded_F this6, chpl_bool shouldHalt, int64_t _ln, c_string _fn);
+static int64_t chpl__add(int64_t a, int64_t b, int64_t _ln, c_string _fn);
+void chpl__init_ChapelStandard(int64_t _ln, c_string _fn);
+static void chpl__init_ChapelTaskTable(int64_t _ln, c_string _fn);
+void chpldev_taskTable_add(chpl_taskID_t taskID, uint32_t lineno, c_string filename, uint64_t tl_info);
+void chpldev_taskTable_remove(chpl_taskID_t taskID);
+void chpldev_taskTable_set_active(chpl_taskID_t taskID);
+void chpldev_taskTable_set_suspended(chpl_taskID_t taskID);
+void chpldev_taskTable_get_tl_info(chpl_taskID_t taskID);
+void chpldev_taskTable_print(int64_t _ln, c_string _fn);
+static void chpl__init_ChapelThreads(int64_t _ln, c_string _fn);
+static void chpl__init_ChapelTuple(int64_t _ln, c_string _fn);
+static chpl____wide__ref_range_int64_t_bounded_F this4(_ref__tuple_1_star_range_int64_t_bounded_F this6, int64_t i, int64_t _ln, c_string _fn);
+static void this5(_ref__tuple_1_star_range_int64_t_bounded_F this6, int64_t i, _ref_range_int64_t_bounded_F _retArg, int64_t _ln, c_string _fn);
+static void readWriteThis(_ref__tuple_1_star_int64_t this6, Writer f, int64_t _ln, c_string _fn);
+static void chpl__init_ChapelUtil(int64_t _ln, c_string _fn);
+static void chpl__init_DefaultAssociative(int64_t _ln, c_string _fn);
+static void chpl__init_DefaultRectangular(int64_t _ln, c_string _fn);
+static DefaultDist _construct_DefaultDist(atomic_refcnt* const _distCnt, list_BaseDom* const _doms, atomicflag* const _domsLock, DefaultDist meme, int64_t _ln, c_string _fn);
+static void chpl__auto_destroy_DefaultDist(DefaultDist this6, int64_t _ln, c_string _fn);
+static DefaultRectangularDom_1_int64_t_F dsiNewRectangularDom(chpl____wide_DefaultDist* const this6, int64_t _ln, c_string _fn);
+static chpl____wide_DefaultDist dsiClone(chpl____wide_DefaultDist* const this6);
+static void dsiAssign(chpl____wide_DefaultDist* const this6, chpl____wide_DefaultDist* const other);
+static DefaultRectangularDom_1_int64_t_F _construct_DefaultRectangularDom(atomic_refcnt* const _domCnt, list_BaseArr* const _arrs, atomicflag* const _arrsLock, DefaultDist dist2, _tuple_1_star_range_int64_t_bounded_F* const ranges, DefaultRectangularDom_1_int64_t_F meme, int64_t _ln, c_string _fn);
+static void chpl__auto_destroy_DefaultRectangularDom(DefaultRectangularDom_1_int64_t_F this6, int64_t _ln, c_string _fn);
+static chpl_bool dsiLinksDistribution2(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6);
+static DefaultRectangularDom_1_int64_t_F DefaultRectangularDom(chpl____wide_DefaultDist* const dist2, int64_t _ln, c_string _fn);
+static void dsiGetIndices(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, _ref__tuple_1_star_range_int64_t_bounded_F _retArg, int64_t _ln, c_string _fn);
+static void dsiSetIndices(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, _tuple_1_star_range_int64_t_bounded_F* const x2, int64_t _ln, c_string _fn);
+static void dsiDim(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, _ref_range_int64_t_bounded_F _retArg, int64_t _ln, c_string _fn);
+static int64_t dsiNumIndices(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, int64_t _ln, c_string _fn);
+static int64_t dsiLow(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, int64_t _ln, c_string _fn);
+static DefaultRectangularArr_locale_1_int64_t_F dsiBuildArray(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, int64_t _ln, c_string _fn);
+static DefaultRectangularArr_localesSignal_1_int64_t_F dsiBuildArray2(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, int64_t _ln, c_string _fn);
+static DefaultRectangularDom_1_int64_t_F dsiBuildRectangularDom(chpl____wide_DefaultRectangularDom_1_int64_t_F* const this6, _tuple_1_star_range_int64_t_bounded_F* const ranges, int64_t _ln, c_string _fn);
+static DefaultRectangularArr_locale_1_int64_t_F _construct_DefaultRectangularArr(atomic_refcnt* const _arrCnt, BaseArr _arrAlias, chpl____wide_DefaultRectangularDom_1_int64_t_F* const dom, _tuple_1_star_int64_t* const off, _tuple_1_star_int64_t* const blk, _tuple_1_star_int64_t* const str, int64_t origin, int64_t factoredOffs, _ddata_locale data, _ddata_locale shiftedData, chpl_bool noinit_data, DefaultRectangularArr_locale_1_int64_t_F meme, int64_t _ln, c_string _fn);
+static DefaultRectangularArr_localesSignal_1_int64_t_F _construct_DefaultRectangularArr2(atomic_refcnt* const _arrCnt, BaseArr _arrAlias, chpl____wide_DefaultRectangularDom_1_int64_t_F* const dom, _tuple_1_star_int64_t* const off, _tuple_1_star_int64_t* const blk, _tuple_1_star_int64_t* const str, int64_t origin, int64_t factoredOffs, _ddata_localesSignal data, _ddata_localesSignal shiftedData, chpl_bool noinit_data, DefaultRectangularArr_localesSignal_1_int64_t_F meme, int64_t _ln, c_string _fn);
+static void chpl__auto_destroy_DefaultRectangularArr(DefaultRectangularArr_locale_1_int64_t_F this6, int64_t _ln, c_string _fn);
+static void chpl__auto_destroy_DefaultRectangularArr2(DefaultRectangularArr_localesSignal_1_int64_t_F this6, int64_t _ln, c_string _fn);
+static chpl____wide_DefaultRectangularDom_1_int64_t_F dsiGetBaseDom2(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const this6, int64_t _ln, c_string _fn);
+static chpl____wide_DefaultRectangularDom_1_int64_t_F dsiGetBaseDom3(chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const this6, int64_t _ln, c_string _fn);
+static void dsiDestroyData2(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const this6, int64_t _ln, c_string _fn);
+static void dsiDestroyData3(chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const this6, int64_t _ln, c_string _fn);
+static void computeFactoredOffs(DefaultRectangularArr_locale_1_int64_t_F this6, int64_t _ln, c_string _fn);
+static void computeFactoredOffs2(DefaultRectangularArr_localesSignal_1_int64_t_F this6, int64_t _ln, c_string _fn);
+static void initialize3(DefaultRectangularArr_locale_1_int64_t_F this6, int64_t _ln, c_string _fn);
+static void initialize4(DefaultRectangularArr_localesSignal_1_int64_t_F this6, int64_t _ln, c_string _fn);
+static void dsiReallocate2(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const this6, chpl____wide_DefaultRectangularDom_1_int64_t_F* const d, int64_t _ln, c_string _fn);
+static void dsiReallocate3(chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const this6, chpl____wide_DefaultRectangularDom_1_int64_t_F* const d, int64_t _ln, c_string _fn);
+static void on_fn34(chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const delete_tmp, int64_t _ln, c_string _fn);
+static void on_fn35(chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const delete_tmp, int64_t _ln, c_string _fn);
+static void wrapon_fn34(_class_localson_fn34 c);
+static void wrapon_fn35(_class_localson_fn35 c);
+static void chpl__init_LocaleModel(int64_t _ln, c_string _fn);
+static void chpl_buildLocaleID(int32_t node, int32_t subloc, _ref_chpl_localeID_t _retArg, int64_t _ln, c_string _fn);
+static int32_t chpl_nodeFromLocaleID(chpl_localeID_t* const loc, int64_t _ln, c_string _fn);
+static int32_t chpl_sublocFromLocaleID(chpl_localeID_t* const loc, int64_t _ln, c_string _fn);
+static LocaleModel _construct_LocaleModel(locale parent, int64_t numCores, int64_t maxTaskPar, atomic_int64* const runningTaskCounter, uint64_t callStackSize, int64_t _node_id, chpl_string local_name, LocaleModel meme, int64_t _ln, c_string _fn);
+static void chpl__auto_destroy_LocaleModel(LocaleModel this6, int64_t _ln, c_string _fn);
+static LocaleModel LocaleModel2(chpl____wide_locale* const parent_loc, int64_t _ln, c_string _fn);
+static int64_t chpl_id2(chpl____wide_LocaleModel* const this6, int64_t _ln, c_string _fn);
+static chpl____wide_locale getChild2(chpl____wide_LocaleModel* const this6, int64_t idx, int64_t _ln, c_string _fn);
+static void init(LocaleModel this6, int64_t _ln, c_string _fn);
+static RootLocale _construct_RootLocale(locale parent, int64_t numCores, int64_t maxTaskPar, atomic_int64* const runningTaskCounter, chpl____wide_DefaultRectangularDom_1_int64_t_F* const myLocaleSpace, chpl____wide_DefaultRectangularArr_locale_1_int64_t_F* const myLocales, RootLocale meme, int64_t _ln, c_string _fn);
+static void chpl__auto_destroy_RootLocale(RootLocale this6, int64_t _ln, c_string _fn);
+static RootLocale RootLocale2(int64_t _ln, c_string _fn);
+static void init2(chpl____wide_RootLocale* const this6, int64_t _ln, c_string _fn);
+static void wrapon_fn36(_class_localson_fn36 c);
+static void on_fn36(int64_t locIdx, localesBarrier* const b, chpl____wide_DefaultRectangularArr_localesSignal_1_int64_t_F* const flags, chpl____wide__EndCount* const _coforallCount, _ir_initOnLocales_AbstractRootLocale* const chpl__iter, chpl____wide_RootLocale* const this6, int64_t _ln, c_string _fn);
+static int64_t chpl_id3(chpl____wide_RootLocale* const this6, int64_t _ln, c_string _fn);
+static chpl____wide_locale getChild3(chpl____wide_RootLocale* const this6, int64_t idx, int64_t _ln, c_string _fn);
+static chpl____wide_DefaultRectangularArr_locale_1_int64_t_F getDefaultLocaleArray(chpl____wide_RootLocale* const this6, int64_t _ln, c_string _fn);
+static void getDefaultLocaleArray2(chpl____wide_RootLocale* const this6, _ref_DefaultRectangularArr_locale_1_int64_t_F _retArg, int64_t _ln, c_string _fn);
+static chpl____wide_locale localeIDtoLocale2(chpl____wide_RootLocale* const this6, chpl_localeID_t* const id2, int64_t _ln, c_string _fn);
+static chpl_opaque _local_chpl_here_alloc(int64_t size, int16_t md, int64_t _ln, c_string _fn);
+static chpl_opaque chpl_here_alloc(int64_t size, int16_t md, int64_t _ln, c_string _fn);
+static void _local_chpl_here_free(chpl_opaque ptr, int64_t _ln, c_string _fn);
+static void chpl_here_free(chpl_opaque ptr, int64_t _ln, c_string _fn);
+void chpl_executeOn(chpl_localeID_t* const loc, int64_t fn, c_void_ptr args, int32_t args_size, int64_t _ln, c_string _fn);
+void chpl_executeOnFast(chpl_localeID_t* const loc, int64_t fn, c_void_ptr args, int32_t args_size, int64_t _ln, c_string _fn);
+void chpl_executeOnNB(chpl_localeID_t* const loc, int64_t fn, c_void_ptr args, int32_t args_size, int64_t _ln, c_string _fn);
+void chpl_taskListAddBegin(int64_t subloc_id, int64_t fn, c_void_ptr args, _ref_chpl_task_list_p tlist, int64_t tlist_node_id, int64_t _ln, c_string _fn);
+void chpl_taskListAddCoStmt(int64_t subloc_id, int64_t fn, c_void_ptr args, _ref_chpl_task_list_p tlist, int64_t tlist_node_id, int64_t _ln, c_string _fn);
+void chpl_taskListProcess(chpl_task_list_p task_list, int64_t _ln, c_string _fn);
+void chpl_taskListExecute(chpl_task_list_p task_list, int64_t _ln, c_string _fn);
+void chpl_taskListFree(chpl_task_list_p task_list, int64_t _ln, c_string _fn);
+static void chpl__init_LocaleTree(int64_t _ln, c_string _fn);
+static chpl_localeTreeRecord _construct_chpl_localeTreeRecord(locale left, locale right, chpl_localeTreeRecord* const meme, int64_t _ln, c_string _fn);
+static void chpl_initLocaleTree(int64_t _ln, c_string _fn);
+static void on_fn37(chpl____wide_locale* const left, chpl____wide_locale* const right, int64_t _ln, c_string _fn);
+static void wrapon_fn37(_class_localson_fn37 c);
+static void chpl__init_LocalesArray(int64_t _ln, c_string _fn);
+static void chpl__init_MemConsistency(int64_t _ln, c_string _fn);
+static void chpl__init_MemTracking(int64_t _ln, c_string _fn);
+void chpl_memTracking_returnConfigVals(_ref_chpl_bool ret_memTrack, _ref_chpl_bool ret_memStats, _ref_chpl_bool ret_memLeaks, _ref_chpl_bool ret_memLeaksTable, _ref_uint64_t ret_memMax, _ref_uint64_t ret_memThreshold, _ref_c_string ret_memLog, _ref_c_string ret_memLeaksLog, int64_t _ln, c_string _fn);
+static void chpl__init_NetworkAtomics(int64_t _ln, c_string _fn);
+void chpl__init_PrintModuleInitOrder(int64_t _ln, c_string _fn);
+static void printModuleInit(c_string s1, c_string s2, int64_t len, int64_t _ln, c_string _fn);
+static void initPrint(void);
+static void chpl__init_String(int64_t _ln, c_string _fn);
+static object _construct_object(object meme);
+static void chpl__auto_destroy_object(object this6, int64_t _ln, c_string _fn);
+void chpl__heapAllocateGlobals(void);
+void chpl__init_preInit(int64_t _ln, c_string _fn);
+static void chpl__init_BaseStringType(int64_t _ln, c_string _fn);
+static void chpl__init_CommDiagnostics(int64_t _ln, c_string _fn);
+static void chpl__init_DSIUtil(int64_t _ln, c_string _fn);
+static void createTuple(int64_t val, _ref__tuple_1_star_int64_t _retArg, int64_t _ln, c_string _fn);
+static void chpl__init_Error(int64_t _ln, c_string _fn);
+static c_string quote_string(chpl____wide_chpl_string s, int64_t len, int64_t _ln, c_string _fn);
+static void ioerror(syserr error, chpl____wide_chpl_string msg, chpl____wide_chpl_string path, int64_t _ln, c_string _fn);
+static void ioerror2(syserr error, chpl____wide_chpl_string msg, chpl____wide_chpl_string path, int64_t offset, int64_t _ln, c_string _fn);
+static void chpl__init_IO(int64_t _ln, c_string _fn);
+static void defaultIOStyle(_ref_iostyle _retArg, int64_t _ln, c_string _fn);
+static file _construct_file(chpl____wide_locale* const home, qio_file_ptr_t _file_internal, file* const meme, int64_t _ln, c_string _fn);
+static file chpl__initCopy3(file* const x2, int64_t _ln, c_string _fn);
+static void on_fn38(chpl____wide__ref_file* const x2, int64_t _ln, c_string _fn);
+static void wrapon_fn38(_class_localson_fn38 c);
+static void chpl___ASSIGN_3(_ref_file ret, file* const x2, int64_t _ln, c_string _fn);
+static void on_fn39(chpl____wide__ref_file* const x2, int64_t _ln, c_string _fn);
+static void wrapon_fn39(_class_localson_fn39 c);
+static void on_fn40(chpl____wide__ref_file* const ret, int64_t _ln, c_string _fn);
+static void wrapon_fn40(_class_localson_fn40 c);
+static void check(_ref_file this6, int64_t _ln, c_string _fn);
+static void chpl___TILDE_file(_ref_file this6, int64_t _ln, c_string _fn);
+static void on_fn41(chpl____wide__ref_file* const this6, int64_t _ln, c_string _fn);
+static void wrapon_fn41(_class_localson_fn41 c);
+static void _style(_ref_file this6, _ref_iostyle _retArg, int64_t _ln, c_string _fn);
+static void on_fn42(chpl____wide__ref_file* const this6, chpl____wide__ref_iostyle* const ret, int64_t _ln, c_string _fn);
+static void wrapon_fn42(_class_localson_fn42 c);
+static chpl____wide_chpl_string getPath(_ref_file this6, chpl____wide__ref_syserr* const error, int64_t _ln, c_string _fn);
+static void on_fn43(chpl____wide__ref_file* const this6, chpl____wide__ref_syserr* const _formal_tmp_error, chpl____wide__ref_chpl_string* const ret, int64_t _ln, c_string _fn);
+static void wrapon_fn43(_class_localson_fn43 c);
+static chpl____wide_chpl_string tryGetPath(_ref_file this6, int64_t _ln, c_string _fn);
+static void openfd(int32_t fd, chpl____wide__ref_syserr* const error, int32_t hints, iostyle* const style, _ref_file _retArg, int64_t _ln, c_string _fn);
+static void openfd2(int32_t fd, int32_t hints, iostyle* const style, _ref_file _retArg, int64_t _ln, c_string _fn);
+static void openfp(_cfile fp, chpl____wide__ref_syserr* const error, int32_t hints, iostyle* const style, _ref_file _retArg, int64_t _ln, c_string _fn);
+static void openfp2(_cfile fp, int32_t hints, iostyle* const style, _ref_file _retArg, int64_t _ln, c_string _fn);
+static channel_F_dynamic_T _construct_channel(locale home, qio_channel_ptr_t _channel_internal, channel_F_dynamic_T* const meme, int64_t _ln, c_string _fn);
+static channel_T_dynamic_T _construct_channel2(locale home, qio_channel_ptr_t _channel_internal, channel_T_dynamic_T* const meme, int64_t _ln, c_string _fn);
+static channel_F_dynamic_T chpl__initCopy4(channel_F_dynamic_T* const x2, int64_t _ln, c_string _fn);
+static channel_T_dynamic_T chpl__initCopy5(channel_T_dynamic_T* const x2, int64_t _ln, c_string _fn);
+static void on_fn44(chpl____wide__ref_channel_F_dynamic_T* const x2, int64_t _ln, c_string _fn);
+static void on_fn45(chpl____wide__ref_channel_T_dynamic_T* const x2, int64_t _ln, c_string _fn);
+static void wrapon_fn44(_class_localson_fn44 c);
+static void wrapon_fn45(_class_localson_fn45 c);
+static void chpl___ASSIGN_4(chpl____wide__ref_channel_F_dynamic_T* const ret, channel_F_dynamic_T* const x2, int64_t _ln, c_string _fn);
+static void chpl___ASSIGN_5(chpl____wide__ref_channel_T_dynamic_T* const ret, channel_T_dynamic_T* const x2, int64_t _ln, c_string _fn);
+static void on_fn46(chpl____wide__ref_channel_F_dynamic_T* const x2, int64_t _ln, c_string _fn);
+static void on_fn47(chpl____wide__ref_channel_T_dynamic_T* const x2, int64_t _ln, c_string _fn);
+static void wrapon_fn46(_class_localson_fn46 c);
+static void wrapon_fn47(_class_localson_fn47 c);
+static void on_fn48(chpl____wide__ref_channel_F_dynamic_T* const ret, int64_t _ln, c_string _fn);
+static void on_fn49(chpl____wide__ref_channel_T_dynamic_T* const ret, int64_t _ln, c_string _fn);
+static void wrapon_fn48(_class_localson_fn48 c);
+static void wrapon_fn49(_class_localson_fn49 c);
+static channel_F_dynamic_T channel(file* const f, chpl____wide__ref_syserr* const error, int32_t hints, int64_t start, int64_t end, iostyle* const local_style, int64_t _ln, c_string _fn);
+static channel_T_dynamic_T channel2(file* const f, chpl____wide__ref_syserr* const error, int32_t hints, int64_t start, int64_t end, iostyle* const local_style, int64_t _ln, c_string _fn);
+static void on_fn50(chpl____wide__ref_channel_F_dynamic_T* const this6, int32_t hints, iostyle* const _formal_tmp_local_style, int64_t end, int64_t start, chpl____wide__ref_syserr* const _formal_tmp_error, chpl____wide__ref_file* const f, int64_t _ln, c_string _fn);
+static void on_fn51(iostyle* const _formal_tmp_local_style, int64_t start, chpl____wide__ref_file* const f, chpl____wide__ref_syserr* const _formal_tmp_error, int32_t hints, chpl____wide__ref_channel_T_dynamic_T* const this6, int64_t end, int64_t _ln, c_string _fn);
+static void wrapon_fn50(_class_localson_fn50 c);
+static void wrapon_fn51(_class_localson_fn51 c);
+static void chpl___TILDE_channel(_ref_channel_F_dynamic_T this6, int64_t _ln, c_string _fn);
+static void chpl___TILDE_channel2(_ref_channel_T_dynamic_T this6, int64_t _ln, c_string _fn);
+static void on_fn52(chpl____wide__ref_channel_F_dynamic_T* const this6, int64_t _ln, c_string _fn);
+static void on_fn53(chpl____wide__ref_channel_T_dynamic_T* const this6, int64_t _ln, c_string _fn);
+static void wrapon_fn52(_class_localson_fn52 c);
+static void wrapon_fn53(_class_localson_fn53 c);
+static ioNewline _construct_ioNewline(chpl_bool skipWhitespaceOnly, ioNewline* const meme, int64_t _ln, c_string _fn);
+static ioLiteral _construct_ioLiteral(c_string val, chpl_bool ignoreWhiteSpace, ioLiteral* const meme, int64_t _ln, c_string _fn);
+static void chpl___ASSIGN_6(_ref_ioLiteral _arg1, ioLiteral* const _arg2, int64_t _ln, c_string _fn);
+static void _ch_ioerror(chpl____wide__ref_channel_T_dynamic_T* const this6, syserr error, chpl____wide_chpl_string msg, int64_t _ln, c_string _fn);
+static void on_fn54(chpl____wide__ref_channel_T_dynamic_T* const this6, chpl____wide__ref_chpl_string* const path, chpl____wide__ref_int64_t* const offset, int64_t _ln, c_string _fn);
+static void wrapon_fn54(_class_localson_fn54 c);
+static void on_fn55(chpl____wide__ref_channel_T_dynamic_T* const this6, chpl____wide__ref_syserr* const _formal_tmp_error, int64_t _ln, c_string _fn);
+static void wrapon_fn55(_class_localson_fn55 c);
+static void on_fn56(chpl____wide__ref_channel_T_dynamic_T* const this6, int64_t _ln, c_string _fn);
+static void wrapon_fn56(_class_localson_fn56 c);
+static void reader(_ref_file this6, chpl____wide__ref_syserr* const error, int64_t start, int64_t end, int32_t hints, iostyle* const style, _ref_channel_F_dynamic_T _retArg, int64_t _ln, c_string _fn);
+static void on_fn57(chpl____wide__ref_syserr* const _formal_tmp_error, int64_t end, chpl____wide__ref_channel_F_dynamic_T* const ret, file* const this6, int64_t start, int32_t hints, iostyle* const style, int64_t _ln, c_string _fn);
+static void wrapon_fn57(_class_localson_fn57 c);
+static void reader2(_ref_file this6, int64_t start, int64_t end, int32_t hints, iostyle* const style, _ref_channel_F_dynamic_T _retArg, int64_t _ln, c_string _fn);
+static void writer(_ref_file this6, chpl____wide__ref_syserr* const error, int64_t start, int64_t end, int32_t hints, iostyle* const style, _ref_channel_T_dynamic_T _retArg, int64_t _ln, c_string _fn);
+static void on_fn58(file* const this6, int64_t start, int32_t hints, iostyle* const style, chpl____wide__ref_syserr* const _formal_tmp_error, int64_t end, chpl____wide__ref_channel_T_dynamic_T* const ret, int64_t _ln, c_string _fn);
+static void wrapon_fn58(_class_localson_fn58 c);
+static void writer2(_ref_file this6, int64_t start, int64_t end, int32_t hints, iostyle* const style, _ref_channel_T_dynamic_T _retArg, int64_t _ln, c_string _fn);
+static syserr _write_text_internal(qio_channel_ptr_t _channel_internal, chpl____wide_chpl_string x2, int64_t _ln, c_string _fn);
+static syserr _write_text_internal2(qio_channel_ptr_t _channel_internal, int64_t x2, int64_t _ln, c_string _fn);
+static chpl____wide_chpl_string _args_to_proto(chpl____wide_chpl_string _e0_args, int64_t _e1_args, ioNewline* const _e2_args, chpl____wide_chpl_string preArg, int64_t _ln, c_string _fn);
+static void on_fn59(chpl____wide__ref_channel_T_dynamic_T* const this6, chpl____wide__ref_syserr* const _formal_tmp_error, chpl____wide__ref__tuple_3_chpl_string_int64_t_ioNewline* const args, int64_t _ln, c_string _fn);
+static void wrapon_fn59(_class_localson_fn59 c);
+static chpl_bool writeln(chpl____wide__ref_channel_T_dynamic_T* const this6, chpl____wide_chpl_string _e0_args, int64_t _e1_args, int64_t _ln, c_string _fn);
+static void writeln2(chpl____wide_chpl_string _e0_args, int64_t _e1_args, int64_t _ln, c_string _fn);
+static void chpl__init_List(int64_t _ln, c_string _fn);
+static listNode_BaseArr _construct_listNode(chpl____wide_BaseArr* const data, listNode_BaseArr next, listNode_BaseArr meme, int64_t _ln, c_string _fn);
+static void chpl__auto_destroy_listNode(listNode_BaseArr this6, int64_t _ln, c_string _fn);
+static void chpl__auto_destroy_listNode2(listNode_BaseDom this6, int64_t _ln, c_string _fn);
+static list_BaseArr _construct_list(listNode_BaseArr first, listNode_BaseArr last, int64_t length2, list_BaseArr* const meme, int64_t _ln, c_string _fn);
+static list_BaseDom _construct_list2(listNode_BaseDom first, listNode_BaseDom last, int64_t length2, list_BaseDom* const meme, int64_t _ln, c_string _fn);
+static void _local_remove(_ref_list_BaseDom this6, chpl____wide_BaseDom* const x2, int64_t _ln, c_string _fn);
+static void _local_remove2(_ref_list_BaseArr this6, chpl____wide_BaseArr* const x2, int64_t _ln, c_string _fn);
+static void remove2(chpl____wide__ref_list_BaseDom* const this6, chpl____wide_BaseDom* const x2, int64_t _ln, c_string _fn);
+static void remove3(chpl____wide__ref_list_BaseArr* const this6, chpl____wide_BaseArr* const x2, int64_t _ln, c_string _fn);
+static void _local_on_fn5(chpl____wide_listNode_BaseDom* const delete_tmp, int64_t _ln, c_string _fn);
+static void _local_on_fn6(chpl____wide_listNode_BaseArr* const delete_tmp, int64_t _ln, c_string _fn);
+static void _local_wrapon_fn5(_class_localson_fn60 c);
+static void _local_wrapon_fn6(_class_localson_fn61 c);
+static void on_fn60(chpl____wide_listNode_BaseDom* const delete_tmp, int64_t _ln, c_string _fn);
+static void on_fn61(chpl____wide_listNode_BaseArr* const delete_tmp, int64_t _ln, c_string _fn);
+static void wrapon_fn60(_class_localson_fn60 c);
+static void wrapon_fn61(_class_localson_fn61 c);
+static void append(chpl____wide__ref_list_BaseArr* const this6, chpl____wide_BaseArr* const e, int64_t _ln, c_string _fn);
+static void chpl__init_NewString(int64_t _ln, c_string _fn);
+static string_refcnt _construct_string_refcnt(atomic_refcnt* const val, string_refcnt meme, int64_t _ln, c_string _fn);
+static void chpl__auto_destroy_string_refcnt(string_refcnt this6, int64_t _ln, c_string _fn);
+static string_rec _construct_string_rec(c_string base, int64_t len, locale home, string_refcnt refCnt, string_refcnt aliasRefCnt, string_rec* const meme, int64_t _ln, c_string _fn);
+static string_rec string_rec2(int64_t _ln, c_string _fn);
+static void chpl___TILDE_string_rec(chpl____wide__ref_string_rec* const this6, int64_t _ln, c_string _fn);
+static void on_fn62(chpl____wide_string_refcnt* const delete_tmp, int64_t _ln, c_string _fn);
+static void wrapon_fn62(_class_localson_fn62 c);
+static void on_fn63(chpl____wide__ref_string_rec* const this6, int64_t _ln, c_string _fn);
+static void wrapon_fn63(_class_localson_fn63 c);
+static void on_fn64(chpl____wide_string_refcnt* const delete_tmp, int64_t _ln, c_string _fn);
+static void wrapon_fn64(_class_localson_fn64 c);
+static void reinitString(chpl____wide__ref_string_rec* const this6, c_string s, int64_t slen, int64_t _ln, c_string _fn);
+static void on_fn65(chpl____wide__ref_string_rec* const this6, int64_t _ln, c_string _fn);
+static void wrapon_fn65(_class_localson_fn65 c);
+static void on_fn66(chpl____wide_string_refcnt* const delete_tmp, int64_t _ln, c_string _fn);
+static void wrapon_fn66(_class_localson_fn66 c);
+static void on_fn67(chpl____wide_string_refcnt* const delete_tmp, int64_t _ln, c_string _fn);
+static void wrapon_fn67(_class_localson_fn67 c);
+static void chpl___ASSIGN_7(chpl____wide__ref_string_rec* const lhs, c_string rhs_c, int64_t _ln, c_string _fn);
+static void chpl__init_Regexp(int64_t _ln, c_string _fn);
+static void chpl__init_Sys(int64_t _ln, c_string _fn);
+static void chpl__init_SysBasic(int64_t _ln, c_string _fn);
+static void chpl__init_SysCTypes(int64_t _ln, c_string _fn);
+static void chpl__init_Types(int64_t _ln, c_string _fn);
+static int64_t min2(int64_t _ln, c_string _fn);
+static int64_t max2(int64_t _ln, c_string _fn);
+static void chpl__init_refArgIsWide(int64_t _ln, c_string _fn);
+int64_t chpl_gen_main(chpl_main_argument* const _arg);
+static void chpl_user_main(void);
+static void foo(chpl____wide__ref_int64_t* const x2);
+static void chpl__autoDestroyGlobals(void);
+/*** Function Pointer Table ***/
+
+chpl_fn_p chpl_ftable[] = {
+  (chpl_fn_p)_local_wrapon_fn,
+  (chpl_fn_p)wrapon_fn,
+  (chpl_fn_p)_local_wrapon_fn2,
+  (chpl_fn_p)wrapon_fn2,
+  (chpl_fn_p)wrapon_fn3,
+  (chpl_fn_p)wrapon_fn4,
+  (chpl_fn_p)wrapon_fn5,
+  (chpl_fn_p)wrapon_fn6,
+  (chpl_fn_p)wrapon_fn7,
+  (chpl_fn_p)wrapon_fn8,
+  (chpl_fn_p)wrapon_fn9,
+  (chpl_fn_p)wrapon_fn10,
+  (chpl_fn_p)wrapon_fn11,
+  (chpl_fn_p)wrapon_fn12,
+  (chpl_fn_p)wrapon_fn13,
+  (chpl_fn_p)wrapon_fn14,
+  (chpl_fn_p)wrapon_fn15,
+  (chpl_fn_p)wrapon_fn16,
+  (chpl_fn_p)wrapon_fn17,
+  (chpl_fn_p)wrapon_fn18,
+  (chpl_fn_p)wrapon_fn19,
+  (chpl_fn_p)wrapon_fn20,
+  (chpl_fn_p)_local_wrapon_fn3,
+  (chpl_fn_p)wrapon_fn21,
+  (chpl_fn_p)wrapon_fn22,
+  (chpl_fn_p)wrapon_fn23,
+  (chpl_fn_p)_local_wrapon_fn4,
+  (chpl_fn_p)wrapon_fn24,
+  (chpl_fn_p)wrapon_fn25,
+  (chpl_fn_p)wrapon_fn26,
+  (chpl_fn_p)wrapon_fn27,
+  (chpl_fn_p)wrapon_fn28,
+  (chpl_fn_p)wrapon_fn29,
+  (chpl_fn_p)wrapon_fn30,
+  (chpl_fn_p)wrapon_fn31,
+  (chpl_fn_p)wrapon_fn32,
+  (chpl_fn_p)wrapon_fn33,
+  (chpl_fn_p)wrapon_fn34,
+  (chpl_fn_p)wrapon_fn35,
+  (chpl_fn_p)wrapon_fn36,
+  (chpl_fn_p)wrapon_fn37,
+  (chpl_fn_p)wrapon_fn38,
+  (chpl_fn_p)wrapon_fn39,
+  (chpl_fn_p)wrapon_fn40,
+  (chpl_fn_p)wrapon_fn41,
+  (chpl_fn_p)wrapon_fn42,
+  (chpl_fn_p)wrapon_fn43,
+  (chpl_fn_p)wrapon_fn44,
+  (chpl_fn_p)wrapon_fn45,
+  (chpl_fn_p)wrapon_fn46,
+  (chpl_fn_p)wrapon_fn47,
+  (chpl_fn_p)wrapon_fn48,
+  (chpl_fn_p)wrapon_fn49,
+  (chpl_fn_p)wrapon_fn50,
+  (chpl_fn_p)wrapon_fn51,
+  (chpl_fn_p)wrapon_fn52,
+  (chpl_fn_p)wrapon_fn53,
+  (chpl_fn_p)wrapon_fn54,
+  (chpl_fn_p)wrapon_fn55,
+  (chpl_fn_p)wrapon_fn56,
+  (chpl_fn_p)wrapon_fn57,
+  (chpl_fn_p)wrapon_fn58,
+  (chpl_fn_p)wrapon_fn59,
+  (chpl_fn_p)_local_wrapon_fn5,
+  (chpl_fn_p)_local_wrapon_fn6,
+  (chpl_fn_p)wrapon_fn60,
+  (chpl_fn_p)wrapon_fn61,
+  (chpl_fn_p)wrapon_fn62,
+  (chpl_fn_p)wrapon_fn63,
+  (chpl_fn_p)wrapon_fn64,
+  (chpl_fn_p)wrapon_fn65,
+  (chpl_fn_p)wrapon_fn66,
+  (chpl_fn_p)wrapon_fn67
+};
+/*** Virtual Method Table ***/
+
+chpl_fn_p chpl_vmtable[] = {
+  /* _class_localson_fn */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn2 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn3 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn4 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn5 */
+  (chpl_fn_p)chpl__auto_destroy_object,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn6 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn7 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn8 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn9 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn10 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn11 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn12 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn13 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn14 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn15 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn16 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn17 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn18 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _ddata_chpl_string */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _ddata_locale */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _ddata_localesSignal */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* chpl___EndCount */
+  (chpl_fn_p)chpl__auto_destroy__EndCount,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn19 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn20 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* BaseDist */
+  (chpl_fn_p)chpl__auto_destroy_BaseDist,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn21 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* BaseDom */
+  (chpl_fn_p)chpl__auto_destroy_BaseDom,
+  (chpl_fn_p)dsiLinksDistribution,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn22 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn23 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn24 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn25 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn26 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* BaseRectangularDom */
+  (chpl_fn_p)chpl__auto_destroy_BaseRectangularDom,
+  (chpl_fn_p)dsiLinksDistribution,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* BaseArr */
+  (chpl_fn_p)chpl__auto_destroy_BaseArr,
+  (chpl_fn_p)dsiGetBaseDom,
+  (chpl_fn_p)dsiDestroyData,
+  (chpl_fn_p)dsiReallocate,
+  /* _class_localson_fn27 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn28 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn29 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn30 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* Writer */
+  (chpl_fn_p)chpl__auto_destroy_Writer,
+  (chpl_fn_p)writePrimitive3,
+  (chpl_fn_p)writePrimitive,
+  (chpl_fn_p)writePrimitive2,
+  /* Reader */
+  (chpl_fn_p)chpl__auto_destroy_Reader,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* StringWriter */
+  (chpl_fn_p)chpl___TILDE_StringWriter,
+  (chpl_fn_p)writePrimitive6,
+  (chpl_fn_p)writePrimitive4,
+  (chpl_fn_p)writePrimitive5,
+  /* _class_localson_fn31 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn32 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* locale */
+  (chpl_fn_p)chpl__auto_destroy_locale,
+  (chpl_fn_p)getChild,
+  (chpl_fn_p)chpl_id,
+  (chpl_fn_p)NULL,
+  /* AbstractLocaleModel */
+  (chpl_fn_p)chpl__auto_destroy_AbstractLocaleModel,
+  (chpl_fn_p)getChild,
+  (chpl_fn_p)chpl_id,
+  (chpl_fn_p)NULL,
+  /* AbstractRootLocale */
+  (chpl_fn_p)chpl__auto_destroy_AbstractRootLocale,
+  (chpl_fn_p)getChild,
+  (chpl_fn_p)chpl_id,
+  (chpl_fn_p)localeIDtoLocale,
+  /* localesSignal */
+  (chpl_fn_p)chpl__auto_destroy_localesSignal,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn33 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* DefaultDist */
+  (chpl_fn_p)chpl__auto_destroy_DefaultDist,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* DefaultRectangularDom_1_int64_t_F */
+  (chpl_fn_p)chpl__auto_destroy_DefaultRectangularDom,
+  (chpl_fn_p)dsiLinksDistribution2,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* DefaultRectangularArr_locale_1_int64_t_F */
+  (chpl_fn_p)chpl__auto_destroy_DefaultRectangularArr,
+  (chpl_fn_p)dsiGetBaseDom2,
+  (chpl_fn_p)dsiDestroyData2,
+  (chpl_fn_p)dsiReallocate2,
+  /* DefaultRectangularArr_localesSignal_1_int64_t_F */
+  (chpl_fn_p)chpl__auto_destroy_DefaultRectangularArr2,
+  (chpl_fn_p)dsiGetBaseDom3,
+  (chpl_fn_p)dsiDestroyData3,
+  (chpl_fn_p)dsiReallocate3,
+  /* _class_localson_fn34 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn35 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* LocaleModel */
+  (chpl_fn_p)chpl__auto_destroy_LocaleModel,
+  (chpl_fn_p)getChild2,
+  (chpl_fn_p)chpl_id2,
+  (chpl_fn_p)NULL,
+  /* RootLocale */
+  (chpl_fn_p)chpl__auto_destroy_RootLocale,
+  (chpl_fn_p)getChild3,
+  (chpl_fn_p)chpl_id3,
+  (chpl_fn_p)localeIDtoLocale2,
+  /* _class_localson_fn36 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn37 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* heap_c_string */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* heap_chpl_bool */
+  (chpl_fn_p)chpl__auto_destroy_object,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* heap_chpl_string */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* heap_int64_t */
+  (chpl_fn_p)chpl__auto_destroy_object,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* object */
+  (chpl_fn_p)chpl__auto_destroy_object,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* heap__tuple_3_chpl_string_int64_t_ioNewline */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* heap__tuple_6_star_chpl_string */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* heap_locale */
+  (chpl_fn_p)chpl__auto_destroy_object,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* heap_syserr */
+  (chpl_fn_p)chpl__auto_destroy_object,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* heap_string_rec */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* heap_iostyle */
+  (chpl_fn_p)chpl__auto_destroy_object,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* heap_file */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* heap_channel_F_dynamic_T */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* heap_channel_T_dynamic_T */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* heap_atomic_int64 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn38 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn39 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn40 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn41 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn42 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn43 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn44 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn45 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn46 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn47 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn48 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn49 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn50 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn51 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn52 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn53 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn54 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn55 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn56 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn57 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn58 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn59 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* listNode_BaseArr */
+  (chpl_fn_p)chpl__auto_destroy_listNode,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* listNode_BaseDom */
+  (chpl_fn_p)chpl__auto_destroy_listNode2,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn60 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn61 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* string_refcnt */
+  (chpl_fn_p)chpl__auto_destroy_string_refcnt,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn62 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn63 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn64 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn65 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn66 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  /* _class_localson_fn67 */
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL,
+  (chpl_fn_p)NULL
+};
+/*** Global Variables ***/
+
+static chpl____wide_heap_atomic_int64 numPrivateObjects;
+static chpl____wide_heap_int64_t taskCntType;
+static chpl____wide_heap_chpl_bool chpl__testParOn;
+static chpl____wide_locale rootLocale;
+static chpl____wide_heap_locale origRootLocale;
+static chpl____wide_heap_locale dummyLocale;
+static int64_t numLocales;
+static int64_t numThreadsPerLocale;
+static chpl____wide_heap_int64_t chpl_table_index_type;
+static int64_t dataParTasksPerLocale;
+static chpl_bool dataParIgnoreRunningTasks;
+static int64_t dataParMinGranularity;
+static chpl____wide_DefaultDist defaultDist;
+static chpl____wide_heap_chpl_bool doneCreatingLocales;
+static chpl____wide_DefaultRectangularDom_1_int64_t_F chpl_emptyLocaleSpace;
+static chpl____wide_DefaultRectangularArr_locale_1_int64_t_F chpl_emptyLocales;
+static chpl_localeTreeRecord chpl_localeTree;
+static chpl____wide_DefaultRectangularArr_locale_1_int64_t_F Locales;
+static chpl____wide_DefaultRectangularDom_1_int64_t_F LocaleSpace;
+static chpl_bool memTrack;
+static chpl_bool memStats;
+static chpl_bool memLeaks;
+static chpl_bool memLeaksTable;
+static uint64_t memMax;
+static uint64_t memThreshold;
+static chpl____wide_heap_c_string memLog;
+static chpl____wide_heap_c_string memLeaksLog;
+static string_rec s_memLog;
+static string_rec s_memLeaksLog;
+static int32_t LINENO;
+static chpl_bool printModuleInitOrder;
+static int32_t moduleInitLevel;
+static chpl_bool chpl__init_DSIUtil_p;
+static chpl_bool chpl__init_Error_p;
+static chpl_bool chpl__init_IO_p;
+static chpl_bool chpl__init_List_p;
+static chpl_bool chpl__init_Regexp_p;
+static chpl_bool chpl__init_SysBasic_p;
+static chpl_bool chpl__init_SysCTypes_p;
+static chpl_bool chpl__init_Types_p;
+static chpl_bool chpl__init_refArgIsWide_p;
+static chpl_bool chpl__init_AtomicsCommon_p;
+static chpl_bool chpl__init_ChapelDistribution_p;
+static chpl_bool chpl__init_ChapelDynDispHack_p;
+static chpl_bool chpl__init_MemConsistency_p;
+static chpl_bool chpl__init_Sys_p;
+static chpl_bool chpl__init_NetworkAtomics_p;
+static chpl_bool chpl__init_ChapelArray_p;
+static chpl_bool chpl__init_ChapelIO_p;
+static chpl_bool chpl__init_ChapelLocale_p;
+static chpl_bool chpl__init_ChapelNumLocales_p;
+static chpl_bool chpl__init_ChapelRange_p;
+static chpl_bool chpl__init_ChapelTaskTable_p;
+static chpl_bool chpl__init_CommDiagnostics_p;
+static chpl_bool chpl__init_DefaultAssociative_p;
+static chpl_bool chpl__init_DefaultRectangular_p;
+static chpl_bool chpl__init_MemTracking_p;
+static chpl_bool chpl__init_String_p;
+static chpl_bool chpl__init_ChapelBase_p;
+static chpl_bool chpl__init_ChapelStandard_p;
+static chpl_bool chpl__init_ChapelTuple_p;
+static chpl_bool chpl__init_ChapelUtil_p;
+static chpl_bool chpl__init_LocaleTree_p;
+static chpl_bool chpl__init_ChapelThreads_p;
+static chpl_bool chpl__init_LocaleModel_p;
+static chpl_bool chpl__init_PrintModuleInitOrder_p;
+static chpl_bool chpl__init_LocalesArray_p;
+static chpl_bool chpl__init_Atomics_p;
+static chpl_bool chpl__init_BaseStringType_p;
+static chpl_bool chpl__init_NewString_p;
+static chpl_bool chpl__init_CString_p;
+static chpl____wide_heap_c_string baseType;
+static int32_t IOHINT_NONE;
+static int32_t IOHINT_RANDOM;
+static int32_t IOHINT_SEQUENTIAL;
+static int32_t IOHINT_CACHED;
+static int32_t IOHINT_PARALLEL;
+static chpl____wide_heap_chpl_string _r;
+static chpl____wide_heap_chpl_string _rw;
+static chpl____wide_heap_chpl_string _cw;
+static chpl____wide_heap_chpl_string _cwr;
+static _tuple_1_star_c_string _trues;
+static _tuple_1_star_c_string _falses;
+static chpl____wide_heap_chpl_string _i;
+static chpl____wide_heap__tuple_6_star_chpl_string _arg_to_proto_names;
+static channel_F_dynamic_T stdin2;
+static chpl____wide_heap_channel_T_dynamic_T stdout2;
+static channel_T_dynamic_T stderr2;
+static chpl____wide_heap_int64_t x;
+const int chpl_numGlobalsOnHeap = 18;
+
+ptr_wide_ptr_t chpl_globals_registry[18];
+const int chpl_heterogeneous = 0;
+
+const char* chpl_mem_descs[] = {
+  "this",
+  "locale",
+  "listNode(BaseArr)",
+  "listNode(BaseDom)",
+  "DefaultDist",
+  "domain(1,int(64),false)",
+  "_ic_these__ref_list_BaseArr",
+  "_ddata(locale)",
+  "[domain(1,int(64),false)] locale",
+  "_ic_these__ref_range_int64_t_bounded_F",
+  "RootLocale",
+  "_ic_these_DefaultRectangularDom_1_int64_t_F",
+  "_ic_initOnLocales_AbstractRootLocale",
+  "_ddata(localesSignal)",
+  "[domain(1,int(64),false)] localesSignal",
+  "_EndCount",
+  "_ic_these_DefaultRectangularArr_localesSignal_1_int64_t_F",
+  "localesSignal",
+  "StringWriter",
+  "LocaleModel",
+  "string_refcnt",
+  "_ddata(string)",
+  "local heap-converted data",
+  "bundled args",
+  "global heap-converted data"
+};
+const int chpl_mem_numDescs = 25;
+
+void* const chpl_private_broadcast_table[] = {
+  &chpl_verbose_comm,
+  &chpl_comm_diagnostics,
+  &chpl_verbose_mem,
+  &printModuleInitOrder,
+  &LINENO,
+  &numThreadsPerLocale,
+  &chpl_emptyLocaleSpace,
+  &chpl_emptyLocales,
+  &dataParTasksPerLocale,
+  &dataParIgnoreRunningTasks,
+  &dataParMinGranularity,
+  &LocaleSpace,
+  &memTrack,
+  &memStats,
+  &memLeaks,
+  &memLeaksTable,
+  &memMax,
+  &memThreshold,
+  &s_memLog,
+  &s_memLeaksLog,
+  &numLocales,
+  &IOHINT_NONE,
+  &IOHINT_RANDOM,
+  &IOHINT_SEQUENTIAL,
+  &IOHINT_CACHED,
+  &IOHINT_PARALLEL,
+  &_trues,
+  &_falses,
+  &stdin2,
+  &stdout2,
+  &stderr2
+};
+#include "chpl-gen-includes.h"
+typedef chpl____wide_heap_int64_t *_ref_chpl____wide_heap_int64_t;
+typedef struct chpl_chpl____wide__ref_chpl____wide_heap_int64_t_s {
+  chpl_localeID_t locale;
+  _ref_chpl____wide_heap_int64_t addr;
+} chpl____wide__ref_chpl____wide_heap_int64_t;
+
+typedef chpl____wide_heap_chpl_bool *_ref_chpl____wide_heap_chpl_bool;
+typedef struct chpl_chpl____wide__ref_chpl____wide_heap_chpl_bool_s {
+  chpl_localeID_t locale;
+  _ref_chpl____wide_heap_chpl_bool addr;
+} chpl____wide__ref_chpl____wide_heap_chpl_bool;
+
+typedef chpl____wide_heap_locale *_ref_chpl____wide_heap_locale;
+typedef struct chpl_chpl____wide__ref_chpl____wide_heap_locale_s {
+  chpl_localeID_t locale;
+  _ref_chpl____wide_heap_locale addr;
+} chpl____wide__ref_chpl____wide_heap_locale;
+
+typedef chpl____wide_heap_atomic_int64 *_ref_chpl____wide_heap_atomic_int64;
+typedef struct chpl_chpl____wide__ref_chpl____wide_heap_atomic_int64_s {
+  chpl_localeID_t locale;
+  _ref_chpl____wide_heap_atomic_int64 addr;
+} chpl____wide__ref_chpl____wide_heap_atomic_int64;
+
+typedef chpl____wide_heap_c_string *_ref_chpl____wide_heap_c_string;
+typedef struct chpl_chpl____wide__ref_chpl____wide_heap_c_string_s {
+  chpl_localeID_t locale;
+  _ref_chpl____wide_heap_c_string addr;
+} chpl____wide__ref_chpl____wide_heap_c_string;
+
+typedef chpl____wide_heap_chpl_string *_ref_chpl____wide_heap_chpl_string;
+typedef struct chpl_chpl____wide__ref_chpl____wide_heap_chpl_string_s {
+  chpl_localeID_t locale;
+  _ref_chpl____wide_heap_chpl_string addr;
+} chpl____wide__ref_chpl____wide_heap_chpl_string;
+
+typedef chpl____wide_heap__tuple_6_star_chpl_string *_ref_chpl____wide_heap__tuple_6_star_chpl_string;
+typedef struct chpl_chpl____wide__ref_chpl____wide_heap__tuple_6_star_chpl_string_s {
+  chpl_localeID_t locale;
+  _ref_chpl____wide_heap__tuple_6_star_chpl_string addr;
+} chpl____wide__ref_chpl____wide_heap__tuple_6_star_chpl_string;
+
+typedef chpl____wide_heap_channel_T_dynamic_T *_ref_chpl____wide_heap_channel_T_dynamic_T;
+typedef struct chpl_chpl____wide__ref_chpl____wide_heap_channel_T_dynamic_T_s {
+  chpl_localeID_t locale;
+  _ref_chpl____wide_heap_channel_T_dynamic_T addr;
+} chpl____wide__ref_chpl____wide_heap_channel_T_dynamic_T;
+
+typedef struct chpl_chpl____wide__nilType_s {
+  chpl_localeID_t locale;
+  _nilType addr;
+} chpl____wide__nilType;
+
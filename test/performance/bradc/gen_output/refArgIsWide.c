@@ -0,0 +1,223 @@
+/* refArgIsWide.chpl:1 */
+static void chpl__init_refArgIsWide(int64_t _ln, c_string _fn) {
+  c_string modFormatStr;
+  c_string modStr;
+  _ref_int32_t refIndentLevel = NULL;
+  chpl____wide__ref_int64_t _ref_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_chpl_string call_tmp = {CHPL_LOCALEID_T_INIT, NULL};
+  int64_t T;
+  chpl____wide__ref_int64_t chpl_macro_tmp_658;
+  int64_t chpl_macro_tmp_659;
+  chpl____wide__ref_int64_t chpl_macro_tmp_660;
+  chpl____wide__ref_int64_t chpl_macro_tmp_661;
+  if (chpl__init_refArgIsWide_p) {
+    goto _exit_chpl__init_refArgIsWide;
+  }
+  modFormatStr = "%*s\n";
+  modStr = "refArgIsWide";
+  printModuleInit(modFormatStr, modStr, INT64(12), INT64(1), "refArgIsWide.chpl");
+  refIndentLevel = &moduleInitLevel;
+  *(refIndentLevel) += INT64(1);
+  chpl__init_refArgIsWide_p = true;
+  chpl_check_nil((&x)->addr, INT64(5), "refArgIsWide.chpl");
+  chpl_macro_tmp_658.locale = (&x)->locale;
+  chpl_macro_tmp_658.addr = &(((&x)->addr)->value);
+  chpl_macro_tmp_659 = INT64(23);
+  chpl_gen_comm_put(((void*)(&chpl_macro_tmp_659)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_658).locale), INT64(0), NULL), (chpl_macro_tmp_658).addr, sizeof(int64_t), -1, INT64(1), INT64(5), "refArgIsWide.chpl");
+  chpl_check_nil((&x)->addr, INT64(7), "refArgIsWide.chpl");
+  chpl_macro_tmp_660.locale = (&x)->locale;
+  chpl_macro_tmp_660.addr = &(((&x)->addr)->value);
+  _ref_tmp_ = chpl_macro_tmp_660;
+  foo(&_ref_tmp_);
+  wide_string_from_c_string(&call_tmp, "x is: ", INT64(0), INT64(0), INT64(8), "refArgIsWide.chpl");
+  chpl_check_nil((&x)->addr, INT64(5), "refArgIsWide.chpl");
+  chpl_macro_tmp_661.locale = (&x)->locale;
+  chpl_macro_tmp_661.addr = &(((&x)->addr)->value);
+  chpl_gen_comm_get(((void*)(&T)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_661).locale), INT64(0), NULL), (chpl_macro_tmp_661).addr, sizeof(int64_t), -1, INT64(1), INT64(5), "refArgIsWide.chpl");
+  writeln2(call_tmp, T, INT64(8), "refArgIsWide.chpl");
+  *(refIndentLevel) -= INT64(1);
+  _exit_chpl__init_refArgIsWide:;
+  return;
+}
+
+/* refArgIsWide.chpl:1 */
+static void foo(chpl____wide__ref_int64_t* const x2) {
+  int64_t chpl_macro_tmp_662;
+  chpl_gen_comm_get(((void*)(&chpl_macro_tmp_662)), chpl_nodeFromLocaleID(&((*(x2)).locale), INT64(0), NULL), (*(x2)).addr, sizeof(int64_t), -1, INT64(1), INT64(2), "refArgIsWide.chpl");
+  chpl_macro_tmp_662 += INT64(1);
+  chpl_gen_comm_put(((void*)(&chpl_macro_tmp_662)), chpl_nodeFromLocaleID(&((*(x2)).locale), INT64(0), NULL), (*(x2)).addr, sizeof(int64_t), -1, INT64(1), INT64(2), "refArgIsWide.chpl");
+  return;
+}
+
+/* refArgIsWide.chpl:1 */
+static void chpl_user_main(void) {
+  return;
+}
+
+/* refArgIsWide.chpl:1 */
+int64_t chpl_gen_main(chpl_main_argument* const _arg) {
+  chpl___EndCount this6 = NULL;
+  int64_t call_tmp;
+  chpl_opaque cast_tmp;
+  chpl___EndCount T = NULL;
+  atomic_int64 _init_class_tmp_;
+  atomic_int64 this7;
+  atomic_int_least64_t ret;
+  atomic_int_least64_t type_tmp;
+  _ref_atomic_int_least64_t _ref_tmp_ = NULL;
+  _ref_atomic_int_least64_t T2 = NULL;
+  atomic_int64 wrap_call_tmp;
+  chpl_task_list_p ret2;
+  chpl___EndCount wrap_call_tmp2 = NULL;
+  call_tmp = sizeof(chpl_chpl___EndCount_object);
+  cast_tmp = chpl_here_alloc(call_tmp, INT16(15), INT64(1), "refArgIsWide.chpl");
+  T = ((chpl___EndCount)(cast_tmp));
+  this6 = T;
+  ((object)(this6))->chpl__cid = chpl__cid_chpl___EndCount;
+  chpl_check_nil(this6, INT64(1), "refArgIsWide.chpl");
+  (this6)->i = _init_class_tmp_;
+  chpl_check_nil(this6, INT64(1), "refArgIsWide.chpl");
+  (this6)->taskCnt = INT64(0);
+  chpl_check_nil(this6, INT64(1), "refArgIsWide.chpl");
+  (this6)->taskList = NULL;
+  chpl_check_nil(this6, INT64(1), "refArgIsWide.chpl");
+  (this6)->numDeferred = INT64(0);
+  ret = type_tmp;
+  _ref_tmp_ = &ret;
+  T2 = _ref_tmp_;
+  atomic_init_int_least64_t(T2, INT64(0));
+  _ref_tmp_ = T2;
+  (&this7)->_v = ret;
+  wrap_call_tmp = _construct_atomic_int64(ret, &this7, INT64(1), "refArgIsWide.chpl");
+  chpl_check_nil(this6, INT64(1), "refArgIsWide.chpl");
+  (this6)->i = wrap_call_tmp;
+  chpl_check_nil(this6, INT64(1), "refArgIsWide.chpl");
+  (this6)->taskCnt = INT64(0);
+  ret2 = NULL;
+  chpl_check_nil(this6, INT64(1), "refArgIsWide.chpl");
+  (this6)->taskList = ret2;
+  chpl_check_nil(this6, INT64(1), "refArgIsWide.chpl");
+  (this6)->numDeferred = INT64(0);
+  wrap_call_tmp2 = _construct__EndCount(&wrap_call_tmp, INT64(0), ret2, INT64(0), this6, INT64(1), "refArgIsWide.chpl");
+  chpl_rt_preUserCodeHook();
+  chpl__init_refArgIsWide(INT64(1), "refArgIsWide.chpl");
+  chpl_user_main();
+  chpl_rt_postUserCodeHook();
+  _waitEndCount2(wrap_call_tmp2, INT64(1), "refArgIsWide.chpl");
+  chpl__autoDestroyGlobals();
+  return INT64(0);
+}
+
+/* ChapelBase.chpl:24 */
+static void chpl__autoDestroyGlobals(void) {
+  channel_T_dynamic_T local_stderr;
+  chpl____wide_heap_channel_T_dynamic_T local_stdout = {CHPL_LOCALEID_T_INIT, NULL};
+  channel_F_dynamic_T local_stdin;
+  string_rec local_s_memLeaksLog;
+  string_rec local_s_memLog;
+  chpl____wide_DefaultRectangularDom_1_int64_t_F local_LocaleSpace = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularArr_locale_1_int64_t_F local_chpl_emptyLocales = {CHPL_LOCALEID_T_INIT, NULL};
+  chpl____wide_DefaultRectangularDom_1_int64_t_F local_chpl_emptyLocaleSpace = {CHPL_LOCALEID_T_INIT, NULL};
+  heap_string_rec T = NULL;
+  int64_t chpl_here_alloc_size;
+  chpl_opaque chpl_here_alloc_tmp;
+  heap_string_rec T2 = NULL;
+  chpl____wide__ref_string_rec _ref_tmp_ = {CHPL_LOCALEID_T_INIT, NULL};
+  heap_string_rec T3 = NULL;
+  int64_t chpl_here_alloc_size2;
+  chpl_opaque chpl_here_alloc_tmp2;
+  heap_string_rec T4 = NULL;
+  chpl____wide__ref_string_rec _ref_tmp_2 = {CHPL_LOCALEID_T_INIT, NULL};
+  heap_channel_F_dynamic_T T5 = NULL;
+  int64_t chpl_here_alloc_size3;
+  chpl_opaque chpl_here_alloc_tmp3;
+  heap_channel_F_dynamic_T T6 = NULL;
+  _ref_channel_F_dynamic_T _ref_tmp_3 = NULL;
+  channel_T_dynamic_T T7;
+  heap_channel_T_dynamic_T T8 = NULL;
+  int64_t chpl_here_alloc_size4;
+  chpl_opaque chpl_here_alloc_tmp4;
+  heap_channel_T_dynamic_T T9 = NULL;
+  _ref_channel_T_dynamic_T _ref_tmp_4 = NULL;
+  heap_channel_T_dynamic_T T10 = NULL;
+  int64_t chpl_here_alloc_size5;
+  chpl_opaque chpl_here_alloc_tmp5;
+  heap_channel_T_dynamic_T T11 = NULL;
+  _ref_channel_T_dynamic_T _ref_tmp_5 = NULL;
+  chpl____wide__ref_string_rec chpl_macro_tmp_663;
+  chpl____wide__ref_string_rec chpl_macro_tmp_664;
+  chpl____wide__ref_channel_T_dynamic_T chpl_macro_tmp_665;
+  local_stderr = stderr2;
+  local_stdout = stdout2;
+  local_stdin = stdin2;
+  local_s_memLeaksLog = s_memLeaksLog;
+  local_s_memLog = s_memLog;
+  local_LocaleSpace = LocaleSpace;
+  local_chpl_emptyLocales = chpl_emptyLocales;
+  local_chpl_emptyLocaleSpace = chpl_emptyLocaleSpace;
+  chpl__autoDestroy2(&local_chpl_emptyLocaleSpace, INT64(93), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl__autoDestroy3(&local_chpl_emptyLocales, INT64(94), "/root/repo/modules/internal/localeModels/flat/LocaleModel.chpl");
+  chpl__autoDestroy(&defaultDist, INT64(135), "/root/repo/modules/internal/DefaultRectangular.chpl");
+  chpl__autoDestroy3(&Locales, INT64(51), "/root/repo/modules/internal/LocalesArray.chpl");
+  chpl__autoDestroy2(&local_LocaleSpace, INT64(55), "/root/repo/modules/internal/LocalesArray.chpl");
+  chpl_here_alloc_size = sizeof(chpl_heap_string_rec_object);
+  chpl_here_alloc_tmp = chpl_here_alloc(chpl_here_alloc_size, INT16(22), INT64(40), "/root/repo/modules/internal/MemTracking.chpl");
+  T2 = ((heap_string_rec)(chpl_here_alloc_tmp));
+  T = T2;
+  chpl_check_nil(T, INT64(40), "/root/repo/modules/internal/MemTracking.chpl");
+  (T)->value = local_s_memLog;
+  chpl_check_nil(T, INT64(40), "/root/repo/modules/internal/MemTracking.chpl");
+  chpl_macro_tmp_663.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_663.addr = &((T)->value);
+  _ref_tmp_ = chpl_macro_tmp_663;
+  chpl___TILDE_string_rec(&_ref_tmp_, INT64(40), "/root/repo/modules/internal/MemTracking.chpl");
+  chpl_here_free(((void*)(T)), INT64(40), "/root/repo/modules/internal/MemTracking.chpl");
+  chpl_here_alloc_size2 = sizeof(chpl_heap_string_rec_object);
+  chpl_here_alloc_tmp2 = chpl_here_alloc(chpl_here_alloc_size2, INT16(22), INT64(41), "/root/repo/modules/internal/MemTracking.chpl");
+  T4 = ((heap_string_rec)(chpl_here_alloc_tmp2));
+  T3 = T4;
+  chpl_check_nil(T3, INT64(41), "/root/repo/modules/internal/MemTracking.chpl");
+  (T3)->value = local_s_memLeaksLog;
+  chpl_check_nil(T3, INT64(41), "/root/repo/modules/internal/MemTracking.chpl");
+  chpl_macro_tmp_664.locale = chpl_gen_getLocaleID();
+  chpl_macro_tmp_664.addr = &((T3)->value);
+  _ref_tmp_2 = chpl_macro_tmp_664;
+  chpl___TILDE_string_rec(&_ref_tmp_2, INT64(41), "/root/repo/modules/internal/MemTracking.chpl");
+  chpl_here_free(((void*)(T3)), INT64(41), "/root/repo/modules/internal/MemTracking.chpl");
+  chpl_here_alloc_size3 = sizeof(chpl_heap_channel_F_dynamic_T_object);
+  chpl_here_alloc_tmp3 = chpl_here_alloc(chpl_here_alloc_size3, INT16(22), INT64(2024), "/root/repo/modules/standard/IO.chpl");
+  T6 = ((heap_channel_F_dynamic_T)(chpl_here_alloc_tmp3));
+  T5 = T6;
+  chpl_check_nil(T5, INT64(2024), "/root/repo/modules/standard/IO.chpl");
+  (T5)->value = local_stdin;
+  chpl_check_nil(T5, INT64(2024), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_3 = &((T5)->value);
+  chpl___TILDE_channel(_ref_tmp_3, INT64(2024), "/root/repo/modules/standard/IO.chpl");
+  chpl_here_free(((void*)(T5)), INT64(2024), "/root/repo/modules/standard/IO.chpl");
+  chpl_check_nil((&local_stdout)->addr, INT64(2025), "/root/repo/modules/standard/IO.chpl");
+  chpl_macro_tmp_665.locale = (&local_stdout)->locale;
+  chpl_macro_tmp_665.addr = &(((&local_stdout)->addr)->value);
+  chpl_gen_comm_get(((void*)(&T7)), chpl_nodeFromLocaleID(&((chpl_macro_tmp_665).locale), INT64(0), NULL), (chpl_macro_tmp_665).addr, sizeof(channel_T_dynamic_T), -1, INT64(1), INT64(2025), "/root/repo/modules/standard/IO.chpl");
+  chpl_here_alloc_size4 = sizeof(chpl_heap_channel_T_dynamic_T_object);
+  chpl_here_alloc_tmp4 = chpl_here_alloc(chpl_here_alloc_size4, INT16(22), INT64(2025), "/root/repo/modules/standard/IO.chpl");
+  T9 = ((heap_channel_T_dynamic_T)(chpl_here_alloc_tmp4));
+  T8 = T9;
+  chpl_check_nil(T8, INT64(2025), "/root/repo/modules/standard/IO.chpl");
+  (T8)->value = T7;
+  chpl_check_nil(T8, INT64(2025), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_4 = &((T8)->value);
+  chpl___TILDE_channel2(_ref_tmp_4, INT64(2025), "/root/repo/modules/standard/IO.chpl");
+  chpl_here_free(((void*)(T8)), INT64(2025), "/root/repo/modules/standard/IO.chpl");
+  chpl_here_alloc_size5 = sizeof(chpl_heap_channel_T_dynamic_T_object);
+  chpl_here_alloc_tmp5 = chpl_here_alloc(chpl_here_alloc_size5, INT16(22), INT64(2026), "/root/repo/modules/standard/IO.chpl");
+  T11 = ((heap_channel_T_dynamic_T)(chpl_here_alloc_tmp5));
+  T10 = T11;
+  chpl_check_nil(T10, INT64(2026), "/root/repo/modules/standard/IO.chpl");
+  (T10)->value = local_stderr;
+  chpl_check_nil(T10, INT64(2026), "/root/repo/modules/standard/IO.chpl");
+  _ref_tmp_5 = &((T10)->value);
+  chpl___TILDE_channel2(_ref_tmp_5, INT64(2026), "/root/repo/modules/standard/IO.chpl");
+  chpl_here_free(((void*)(T10)), INT64(2026), "/root/repo/modules/standard/IO.chpl");
+  return;
+}
+
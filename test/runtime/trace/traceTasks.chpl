@@ -0,0 +1,13 @@
+// Run with CHPL_RT_TRACE set (see traceTasks.execenv); traceTasks.prediff
+// converts the trace with util/devel/chplTraceToJSON and checks it.
+
+config const numTasks = 4;
+
+var total: atomic int;
+
+coforall t in 1..numTasks do
+  total.add(t);
+
+sync begin total.add(100);
+
+writeln(total.read());
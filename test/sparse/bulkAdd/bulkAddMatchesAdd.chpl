@@ -0,0 +1,48 @@
+//
+// Check that bulkAdd() builds the same domain and preserves the same
+// array values as adding the indices one at a time, for both the
+// default sparse layout and CSR.
+//
+use LayoutCSR, Random;
+
+config const n = 50,
+             numInds = 400;
+
+const D = {1..n, 1..n};
+
+var rows, cols: [1..numInds] real;
+fillRandom(rows, 31415);
+fillRandom(cols, 92653);
+const inds = [(r, c) in zip(rows, cols)] (1 + (r*n): int, 1 + (c*n): int);
+
+proc test(type sparseDom) {
+  var SD1, SD2: sparseDom;
+  var A1: [SD1] int, A2: [SD2] int;
+
+  // seed both with the first quarter, one at a time
+  for i in 1..numInds/4 {
+    SD1 += inds(i);
+    SD2 += inds(i);
+  }
+  for i in SD1 {
+    A1(i) = i(1)*1000 + i(2);
+    A2(i) = i(1)*1000 + i(2);
+  }
+
+  for i in numInds/4+1..numInds do
+    SD1 += inds(i);
+  SD2.bulkAdd(inds[numInds/4+1..numInds]);
+
+  // sparse domains can't be zippered in parallel with one another
+  var sameInds, sameVals = true;
+  for (i1, i2) in zip(SD1, SD2) do
+    sameInds &&= i1 == i2;
+  for (a1, a2) in zip(A1, A2) do
+    sameVals &&= a1 == a2;
+  writeln(SD1.numIndices == SD2.numIndices);
+  writeln(sameInds);
+  writeln(sameVals);
+}
+
+test(sparse subdomain(D));
+test(sparse subdomain(D) dmapped new dmap(new CSR()));
@@ -0,0 +1,22 @@
+use LayoutCSR;
+
+config const n = 10;
+
+const D = {1..n, 1..n};
+var SD: sparse subdomain(D) dmapped new dmap(new CSR());
+var A: [SD] real;
+
+SD += (2, 2);
+SD += (5, 5);
+A(2, 2) = 2.2;
+A(5, 5) = 5.5;
+
+var inds: [1..2*n] 2*int;
+for i in 1..n {
+  inds(i) = (n+1-i, i);
+  inds(n+i) = (i, i);
+}
+SD.bulkAdd(inds);
+writeln(SD);
+writeln(A);
+writeln(SD.numIndices);
@@ -0,0 +1,26 @@
+// bulkAdd() on a CSR domain whose idxType is narrower than int.
+use LayoutCSR;
+
+type idxType = int(8);
+config const n = 10: idxType;
+
+const D = {1..n, 1..n};
+var SD: sparse subdomain(D) dmapped new dmap(new CSR());
+var A: [SD] int;
+
+SD += (n, n);
+A(n, n) = 1;
+
+var inds: [1..n*n] 2*idxType;
+for (i, j) in D do
+  inds((i-1)*n + j) = (i, j);
+SD.bulkAdd(inds);
+
+var sum = 0;
+for (i, j) in SD {
+  A(i, j) += i * j;
+  sum += A(i, j);
+}
+writeln(SD.numIndices);
+writeln(sum);
+writeln(A(n, n));
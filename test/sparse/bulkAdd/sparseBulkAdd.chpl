@@ -0,0 +1,34 @@
+config const n = 10;
+
+const D1 = {1..n};
+var SD1: sparse subdomain(D1);
+var A1: [SD1] int;
+
+SD1 += 5;
+A1(5) = 50;
+A1.IRV = -1;
+
+var inds1 = [9, 2, 5, 7, 2, 9, 1];
+SD1.bulkAdd(inds1);
+writeln(SD1);
+writeln(A1);
+writeln(SD1.numIndices);
+
+const D2 = {1..n, 1..n};
+var SD2: sparse subdomain(D2);
+var A2: [SD2] real;
+
+SD2 += (2, 2);
+SD2 += (5, 5);
+A2(2, 2) = 2.2;
+A2(5, 5) = 5.5;
+
+var inds2: [1..2*n] 2*int;
+for i in 1..n {
+  inds2(i) = (n+1-i, i);
+  inds2(n+i) = (i, i);
+}
+SD2.bulkAdd(inds2);
+writeln(SD2);
+writeln(A2);
+writeln(SD2.numIndices);
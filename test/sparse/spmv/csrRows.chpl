@@ -0,0 +1,55 @@
+// Exercise the row iterators of CSR domains and arrays, including
+// skewed rows and empty rows, and check that the nnz-balanced leader
+// still visits every index exactly once.
+use LayoutCSR;
+
+config const n = 40;
+
+const D = {1..n, 1..n};
+var SD: sparse subdomain(D) dmapped new dmap(new CSR());
+
+// Row 1 is dense, every third row is empty, the rest hold a few entries.
+for j in 1..n do SD += (1, j);
+for i in 2..n do
+  if i % 3 != 0 then
+    for j in 1..n by i do SD += (i, j);
+
+var A: [SD] int;
+forall (i,j) in SD do A(i,j) = i*1000 + j;
+
+// every nonzero is visited once by the parallel domain iterator
+var visited: [SD] int;
+forall ij in SD do visited(ij) += 1;
+writeln("all visited once: ", && reduce [v in visited] (v == 1));
+
+// zippering the domain with its array still lines up
+var mismatches: atomic int;
+forall ((i,j), a) in zip(SD, A) do
+  if a != i*1000 + j then mismatches.add(1);
+writeln("zipper mismatches: ", mismatches.read());
+
+// serial and parallel row iteration
+var rowCount: [1..n] int;
+for r in SD.rows() do rowCount(r) += 1;
+writeln("serial rows once: ", && reduce [c in rowCount] (c == 1));
+rowCount = 0;
+forall r in SD.rows() do rowCount(r) += 1;
+writeln("parallel rows once: ", && reduce [c in rowCount] (c == 1));
+
+// rows zippered with a dense vector over the rows
+var rowSum: [1..n] int;
+forall (r, s) in zip(SD.rows(), rowSum) do
+  for (c, v) in A.rowNonzeros(r) do
+    s += v - r*1000;
+
+var ok = true;
+for r in 1..n {
+  var expect = 0;
+  for c in SD.dimIter(2, r) do expect += c;
+  if rowSum(r) != expect then ok = false;
+}
+writeln("rowNonzeros matches dimIter: ", ok);
+writeln("row 2: ", [(c, v) in A.rowNonzeros(2)] c);
+var row3 = 0;
+for nz in A.rowNonzeros(3) do row3 += 1;
+writeln("row 3 count: ", row3);
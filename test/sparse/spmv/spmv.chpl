@@ -0,0 +1,95 @@
+// Sparse matrix-vector product y = A*x over a CSR matrix.
+//
+// The matrix is a banded matrix with a few dense rows, so a split over
+// rows by count alone would be badly imbalanced.  Each variant below
+// computes the same product; the row-parallel one relies on the
+// nnz-balanced 'rows()' leader and the search-free 'rowNonzeros()'.
+
+use LayoutCSR, Time;
+
+config const n = 1000;           // matrix order
+config const band = 5;           // half-bandwidth
+config const denseEvery = 100;   // every denseEvery-th row is dense
+config const numTrials = 10;
+config const printTiming = false;
+config const printChecksum = true;
+
+const D = {1..n, 1..n};
+var SD: sparse subdomain(D) dmapped new dmap(new CSR());
+
+proc rowCols(i) return if i % denseEvery == 0 then 1..n
+                       else max(1, i-band)..min(n, i+band);
+var numInds = 0;
+for i in 1..n do numInds += rowCols(i).length;
+var inds: [1..numInds] 2*int;
+var k = 0;
+for i in 1..n do
+  for j in rowCols(i) {
+    k += 1;
+    inds(k) = (i, j);
+  }
+SD.bulkAdd(inds);
+
+var A: [SD] real;
+forall (i,j) in SD do A(i,j) = 1.0 / (i + j);
+
+var x: [1..n] real;
+forall i in 1..n do x(i) = i % 7 + 1;
+
+var y, yRef: [1..n] real;
+
+// serial reference
+for r in SD.rows() {
+  var sum = 0.0;
+  for (c, v) in A.rowNonzeros(r) do sum += v * x(c);
+  yRef(r) = sum;
+}
+
+var t: Timer;
+
+proc report(name, y) {
+  var maxErr = 0.0;
+  for (a, b) in zip(y, yRef) do maxErr = max(maxErr, abs(a - b));
+  writeln(name, ": ", if maxErr < 1e-10 then "ok" else "MISMATCH");
+  if printTiming then
+    writeln(name, " time: ", t.elapsed() / numTrials);
+  t.clear();
+}
+
+// row-parallel, nnz-balanced
+t.start();
+for trial in 1..numTrials do
+  forall (r, yr) in zip(SD.rows(), y) {
+    var sum = 0.0;
+    for (c, v) in A.rowNonzeros(r) do sum += v * x(c);
+    yr = sum;
+  }
+t.stop();
+report("rows", y);
+
+// row-parallel using dimIter over the columns and indexing A
+y = 0.0;
+t.start();
+for trial in 1..numTrials do
+  forall r in SD.rows() {
+    var sum = 0.0;
+    for c in SD.dimIter(2, r) do sum += A(r, c) * x(c);
+    y(r) = sum;
+  }
+t.stop();
+report("dimIter", y);
+
+// parallel over the rows of the dense bounding box
+y = 0.0;
+t.start();
+for trial in 1..numTrials do
+  forall r in D.dim(1) {
+    var sum = 0.0;
+    for (c, v) in A.rowNonzeros(r) do sum += v * x(c);
+    y(r) = sum;
+  }
+t.stop();
+report("dense rows", y);
+
+if printChecksum then
+  writeln("checksum: ", + reduce y);
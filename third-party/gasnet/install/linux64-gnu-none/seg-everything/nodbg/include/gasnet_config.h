@@ -0,0 +1,669 @@
+/* gasnet_config.h.  Generated from gasnet_config.h.in by configure.  */
+/* gasnet_config.h.in.  Generated from configure.in by autoheader.  */
+/*    $Source: /var/local/cvs/gasnet/acconfig.h,v $ */
+/*      $Date: 2013/09/15 20:03:49 $ */
+/*  $Revision: 1.196 $ */
+/*  Description: GASNet acconfig.h (or config.h)                             */
+/*  Copyright 2002, Dan Bonachea <bonachea@cs.berkeley.edu>                  */
+/* Terms of use are as specified in license.txt */
+
+#ifndef _INCLUDE_GASNET_CONFIG_H_
+#define _INCLUDE_GASNET_CONFIG_H_
+#if !defined(_IN_GASNET_H) && !defined(_IN_GASNET_TOOLS_H)
+  #error This file is not meant to be included directly- clients should include gasnet.h or gasnet_tools.h
+#endif
+
+
+#define GASNETI_BUILD_ID "Mon Oct 19 09:45:01 UTC 2026 root"
+#define GASNETI_CONFIGURE_ARGS " '--prefix=/root/repo/third-party/gasnet/install/linux64-gnu-none/seg-everything/nodbg' '--enable-segment-everything' '--enable-allow-gcc4' '--disable-pshm' '--disable-seq' '--enable-par' '--disable-parsync' '--enable-udp' '--disable-mpi' '--disable-ibv' '--disable-smp' 'CC=gcc' 'CFLAGS=-fcommon' 'CXX=g++'"
+#define GASNETI_SYSTEM_TUPLE "x86_64-unknown-linux-gnu"
+#define GASNETI_SYSTEM_NAME "vm"
+/* #undef GASNETI_CROSS_COMPILING */
+
+/* version identifiers */
+#define GASNET_RELEASE_VERSION_MAJOR 1
+#define GASNET_RELEASE_VERSION_MINOR 22
+#define GASNET_RELEASE_VERSION_PATCH 0
+#define GASNETI_RELEASE_VERSION 1.22.0
+#define GASNETI_SPEC_VERSION_MAJOR 1
+#define GASNETI_SPEC_VERSION_MINOR 8
+#define GASNETIT_SPEC_VERSION_MAJOR 1
+#define GASNETIT_SPEC_VERSION_MINOR 7
+
+/* configure-detected conduits */
+#define GASNETI_CONDUITS " udp"
+
+/* CC attributes support */
+#define GASNETI_HAVE_CC_ATTRIBUTE 1
+#define GASNETI_HAVE_CC_ATTRIBUTE_ALWAYSINLINE 1
+#define GASNETI_HAVE_CC_ATTRIBUTE_NOINLINE 1
+#define GASNETI_HAVE_CC_ATTRIBUTE_MALLOC 1
+#define GASNETI_HAVE_CC_ATTRIBUTE_WARNUNUSEDRESULT 1
+#define GASNETI_HAVE_CC_ATTRIBUTE_USED 1
+#define GASNETI_HAVE_CC_ATTRIBUTE_UNUSED 1
+#define GASNETI_HAVE_CC_ATTRIBUTE_UNUSED_TYPEDEF 1
+#define GASNETI_HAVE_CC_ATTRIBUTE_MAYALIAS 1
+#define GASNETI_HAVE_CC_ATTRIBUTE_NORETURN 1
+#define GASNETI_HAVE_CC_ATTRIBUTE_PURE 1
+#define GASNETI_HAVE_CC_ATTRIBUTE_CONST 1
+#define GASNETI_HAVE_CC_ATTRIBUTE_FORMAT 1
+#define GASNETI_HAVE_CC_ATTRIBUTE_FORMAT_FUNCPTR 1
+#define GASNETI_HAVE_CC_ATTRIBUTE_FORMAT_FUNCPTR_ARG 1
+
+/* CXX attributes support */
+#define GASNETI_HAVE_CXX_ATTRIBUTE 1
+#define GASNETI_HAVE_CXX_ATTRIBUTE_ALWAYSINLINE 1
+#define GASNETI_HAVE_CXX_ATTRIBUTE_NOINLINE 1
+#define GASNETI_HAVE_CXX_ATTRIBUTE_MALLOC 1
+#define GASNETI_HAVE_CXX_ATTRIBUTE_WARNUNUSEDRESULT 1
+#define GASNETI_HAVE_CXX_ATTRIBUTE_USED 1
+#define GASNETI_HAVE_CXX_ATTRIBUTE_UNUSED 1
+#define GASNETI_HAVE_CXX_ATTRIBUTE_UNUSED_TYPEDEF 1
+#define GASNETI_HAVE_CXX_ATTRIBUTE_MAYALIAS 1
+#define GASNETI_HAVE_CXX_ATTRIBUTE_NORETURN 1
+#define GASNETI_HAVE_CXX_ATTRIBUTE_PURE 1
+#define GASNETI_HAVE_CXX_ATTRIBUTE_CONST 1
+#define GASNETI_HAVE_CXX_ATTRIBUTE_FORMAT 1
+#define GASNETI_HAVE_CXX_ATTRIBUTE_FORMAT_FUNCPTR 1
+#define GASNETI_HAVE_CXX_ATTRIBUTE_FORMAT_FUNCPTR_ARG 1
+
+/* MPI_CC attributes support */
+#define GASNETI_HAVE_MPI_CC_ATTRIBUTE 1
+#define GASNETI_HAVE_MPI_CC_ATTRIBUTE_ALWAYSINLINE 0
+#define GASNETI_HAVE_MPI_CC_ATTRIBUTE_NOINLINE 1
+#define GASNETI_HAVE_MPI_CC_ATTRIBUTE_MALLOC 1
+#define GASNETI_HAVE_MPI_CC_ATTRIBUTE_WARNUNUSEDRESULT 1
+#define GASNETI_HAVE_MPI_CC_ATTRIBUTE_USED 1
+#define GASNETI_HAVE_MPI_CC_ATTRIBUTE_UNUSED 1
+#define GASNETI_HAVE_MPI_CC_ATTRIBUTE_UNUSED_TYPEDEF 1
+#define GASNETI_HAVE_MPI_CC_ATTRIBUTE_MAYALIAS 1
+#define GASNETI_HAVE_MPI_CC_ATTRIBUTE_NORETURN 1
+#define GASNETI_HAVE_MPI_CC_ATTRIBUTE_PURE 1
+#define GASNETI_HAVE_MPI_CC_ATTRIBUTE_CONST 1
+#define GASNETI_HAVE_MPI_CC_ATTRIBUTE_FORMAT 1
+#define GASNETI_HAVE_MPI_CC_ATTRIBUTE_FORMAT_FUNCPTR 1
+#define GASNETI_HAVE_MPI_CC_ATTRIBUTE_FORMAT_FUNCPTR_ARG 1
+
+/* identification of the C compiler used at configure time */
+#define GASNETI_PLATFORM_COMPILER_IDSTR "|COMPILER_FAMILY:GNU|COMPILER_VERSION:12.2.0|COMPILER_FAMILYID:1|STD: __STDC__,__STDC_VERSION__=201710L|misc:12.2.0|"
+#define GASNETI_PLATFORM_COMPILER_FAMILYID 1
+#define GASNETI_PLATFORM_COMPILER_ID 1
+#define GASNETI_PLATFORM_COMPILER_VERSION 786944
+
+/* identification of the C++ compiler used at configure time */
+#define GASNETI_PLATFORM_CXX_IDSTR "|COMPILER_FAMILY:GNU|COMPILER_VERSION:12.2.0|COMPILER_FAMILYID:1|STD: __STDC__,__cplusplus=201703L|misc:12.2.0|"
+#define GASNETI_PLATFORM_CXX_FAMILYID 1
+#define GASNETI_PLATFORM_CXX_ID 10001
+#define GASNETI_PLATFORM_CXX_VERSION 786944
+
+/* identification of the MPI C compiler used at configure time */
+#define GASNETI_PLATFORM_MPI_CC_IDSTR "|COMPILER_FAMILY:GNU|COMPILER_VERSION:12.2.0|COMPILER_FAMILYID:1|STD: __STDC__,__STDC_VERSION__=201710L|misc:12.2.0|"
+#define GASNETI_PLATFORM_MPI_CC_FAMILYID 1
+#define GASNETI_PLATFORM_MPI_CC_ID 1
+#define GASNETI_PLATFORM_MPI_CC_VERSION 786944
+
+/* Defined to be the inline function modifier supported by the C
+   compilers (if supported), prefixed by 'static' (if permitted) */
+#define GASNET_CC_INLINE_MODIFIER static inline
+#define GASNET_MPI_CC_INLINE_MODIFIER static inline
+
+/* C, C++ and MPI_CC compilers 'restrict' keywords (or empty) */
+#define GASNETI_CC_RESTRICT __restrict__
+#define GASNETI_CXX_RESTRICT __restrict__
+#define GASNETI_MPI_CC_RESTRICT __restrict__
+
+/* Does CC support C99-type non-constant initializers for structs? */
+#define HAVE_NONCONST_STRUCT_INIT 1
+/* Does CC support C99-type constructor expressions? */
+#define HAVE_CONSTRUCTOR_EXPR 1
+
+/* true iff GASNETI_RESTRICT may be applied to types which are not pointer types until after typedef expansion */
+#define GASNETI_CC_RESTRICT_MAY_QUALIFY_TYPEDEFS 1
+#define GASNETI_CXX_RESTRICT_MAY_QUALIFY_TYPEDEFS 1
+#define GASNETI_MPI_CC_RESTRICT_MAY_QUALIFY_TYPEDEFS 1
+
+/* have mmap() */
+#define HAVE_MMAP 1
+
+/* mmap supporting flags */
+#define HAVE_MAP_NORESERVE 1
+#define HAVE_MAP_ANON 1
+#define HAVE_MAP_ANONYMOUS 1
+
+/* --with-segment-mmap-max value (if given) */
+/* #undef GASNETI_MMAP_MAX_SIZE */
+
+/* --with-max-threads value (if given) */
+/* #undef GASNETI_MAX_THREADS_CONFIGURE */
+
+/* has usleep() */
+#define HAVE_USLEEP 1
+
+/* has nanosleep() */
+#define HAVE_NANOSLEEP 1
+
+/* has nsleep() */
+/* #undef HAVE_NSLEEP */
+
+/* has sched_yield() */
+#define HAVE_SCHED_YIELD 1
+
+/* have sysctl machdep.tsc_freq */
+/* #undef GASNETI_HAVE_SYSCTL_MACHDEP_TSC_FREQ */
+
+/* has Portable Linux Processor Affinity */
+#define HAVE_PLPA 1
+
+/* have ptmalloc's mallopt() options */
+#define HAVE_PTMALLOC 1
+
+/* have declarations/definitions */
+#define HAVE_SETENV_DECL 1
+#define HAVE_UNSETENV_DECL 1
+#define HAVE_SNPRINTF_DECL 1
+#define HAVE_VSNPRINTF_DECL 1
+#define HAVE_ISBLANK_DECL 1
+#define HAVE_ISASCII_DECL 1
+#define HAVE_TOASCII_DECL 1
+
+/* ctype.h needs wrappers */
+/* #undef GASNETI_NEED_CTYPE_WRAPPERS */
+
+/* Forbidden to use fork(), popen() and system()? */
+/* #undef GASNETI_NO_FORK */
+
+/* building Process SHared Memory support?  For which API? */
+/* #undef GASNETI_PSHM_ENABLED */
+/* #undef GASNETI_PSHM_POSIX */
+/* #undef GASNETI_PSHM_SYSV */
+/* #undef GASNETI_PSHM_FILE */
+/* #undef GASNETI_PSHM_XPMEM */
+
+/* How many cores/node must we support (255 is default) */
+/* #undef GASNETI_CONFIG_PSHM_MAX_NODES */
+
+/* hugetlbfs support available */
+/* #undef HAVE_HUGETLBFS */
+
+/* hugetlbfs support enabled */
+/* #undef GASNETI_USE_HUGETLBFS */
+
+/* Have Mellanox FCA support?  Where? */
+/* #undef GASNET_FCA_ENABLED */
+/* #undef GASNETI_FCA_HOME */
+
+/* support for backtracing */
+#define HAVE_EXECINFO_H 1
+#define HAVE_BACKTRACE 1
+#define HAVE_BACKTRACE_SYMBOLS 1
+/* #undef HAVE_PRINTSTACK */
+#define ADDR2LINE_PATH "/usr/bin/addr2line"
+/* #undef GDB_PATH */
+/* #undef GSTACK_PATH */
+/* #undef PGDBG_PATH */
+/* #undef IDB_PATH */
+/* #undef LADEBUG_PATH */
+/* #undef DBX_PATH */
+
+/* have pthread_setconcurrency */
+#define HAVE_PTHREAD_SETCONCURRENCY 1
+
+/* has pthread_kill() */
+#define HAVE_PTHREAD_KILL 1
+
+/* has pthread_kill_other_threads_np() */
+/* #undef HAVE_PTHREAD_KILL_OTHER_THREADS_NP */
+
+/* has __thread thread-local-storage support */
+#define GASNETI_HAVE_TLS_SUPPORT 1
+
+/* pause instruction, if any */
+#define GASNETI_PAUSE_INSTRUCTION "pause"
+
+/* How to name MIPS assembler temporary register in inline asm, if at all */
+/* #undef GASNETI_HAVE_MIPS_REG_1 */
+/* #undef GASNETI_HAVE_MIPS_REG_AT */
+
+/* has ARM kernel-level support for cmpxchg */
+/* #undef GASNETI_HAVE_ARM_CMPXCHG */
+
+/* has ARM kernel-level support for membar */
+/* #undef GASNETI_HAVE_ARM_MEMBAR */
+
+/* has x86 EBX register (not reserved for GOT) */
+/* #undef GASNETI_HAVE_X86_EBX */
+
+/* has support (toolchain and cpu) for ia64 cmp8xchg16 instruction */
+/* #undef GASNETI_HAVE_IA64_CMP8XCHG16 */
+
+/* has support (toolchain and cpu) for x86_64 cmpxchg16b instruction */
+#define GASNETI_HAVE_X86_CMPXCHG16B 1
+
+/* gcc/gas support "LDCW,CO" psuedo-op on PA-RISC */
+/* #undef GASNETI_HAVE_PARISC_LDCW_CO */
+
+/* gcc support for "U" and "h" register classes on SPARC32 */
+/* #undef GASNETI_HAVE_SPARC32_64BIT_ASM */
+
+/* has __builtin_expect */
+#define HAVE_BUILTIN_EXPECT 1
+
+/* has __builtin_constant_p */
+#define HAVE_BUILTIN_CONSTANT_P 1
+
+/* has __builtin_prefetch */
+#define HAVE_BUILTIN_PREFETCH 1
+
+/* has __func__ function name defined */
+#define HAVE_FUNC 1
+
+/* portable inttypes support */
+#define HAVE_INTTYPES_H 1
+#define HAVE_STDINT_H 1
+#define HAVE_SYS_TYPES_H 1
+#define COMPLETE_INTTYPES_H 1
+#define COMPLETE_STDINT_H 1
+/* #undef COMPLETE_SYS_TYPES_H */
+
+/* Linux PR_SET_PDEATHSIG support */
+#define HAVE_PR_SET_PDEATHSIG 1
+
+/* forcing use of "non-native" implementations: */
+/* #undef GASNETI_FORCE_GENERIC_ATOMICOPS */
+/* #undef GASNETI_FORCE_OS_ATOMICOPS */
+/* #undef GASNETI_FORCE_COMPILER_ATOMICOPS */
+/* #undef GASNETI_FORCE_TRUE_WEAKATOMICS */
+/* #undef GASNETI_FORCE_GENERIC_SEMAPHORES */
+/* #undef GASNETI_FORCE_YIELD_MEMBARS */
+/* #undef GASNETI_FORCE_SLOW_MEMBARS */
+/* #undef GASNETI_FORCE_GETTIMEOFDAY */
+/* #undef GASNETI_FORCE_POSIX_REALTIME */
+
+/* forcing UP build, even if build platform is a multi-processor */
+/* #undef GASNETI_UNI_BUILD */
+
+/* force memory barriers on GASNet local (loopback) puts and gets */
+/* #undef GASNETI_MEMSYNC_ON_LOOPBACK */
+
+/* throttle polling threads in multi-threaded configurations to reduce contention */
+/* #undef GASNETI_THROTTLE_FEATURE_ENABLED */
+
+/* auto-detected mmap data page size */
+#define GASNETI_PAGESIZE 4096
+#define GASNETI_PAGESHIFT 12
+
+/* auto-detected shared data cache line size */
+#define GASNETI_CACHE_LINE_BYTES 128
+#define GASNETI_CACHE_LINE_SHIFT 7
+
+/* udp-conduit default custom spawn command */
+/* #undef GASNET_CSPAWN_CMD */
+
+/* compiler is Sun's "gccfss" variant of GCC */
+/* #undef GASNETI_GCC_GCCFSS */
+
+/* compiler is Apple's variant of GCC */
+/* #undef GASNETI_GCC_APPLE */
+
+/* platform is an SGI Altix multiprocessor */
+/* #undef GASNETI_ARCH_ALTIX */
+/* #undef GASNETI_USE_MMTIMER */
+
+/* platform is a Linux cluster running IBM PE software */
+/* #undef GASNETI_ARCH_IBMPE */
+
+/* platform is an IBM BlueGene/P multiprocessor */
+/* #undef GASNETI_ARCH_BGP */
+
+/* platform is an IBM BlueGene/Q multiprocessor */
+/* #undef GASNETI_ARCH_BGQ */
+
+/* platform is a SiCortex multiprocessor */
+/* #undef GASNETI_ARCH_SICORTEX */
+
+/* have (potentially buggy) SiCortex ICE9A CPU */
+/* #undef GASNETI_ARCH_ICE9A */
+
+/* have (potentially buggy) MIPS R10000 multiprocessor */
+/* #undef GASNETI_ARCH_SGI_IP27 */
+
+/* have working UltraSPARC ISA (lacks an associated builtin preprocessor macro) */
+/* #undef GASNETI_ARCH_ULTRASPARC */
+
+/* Have working PPC64 ISA (lacks an associated builtin preprocessor macro) */
+/* #undef GASNETI_ARCH_PPC64 */
+/* Tune for a PPC970 cpu (should not crash other PPCs) */
+/* #undef GASNETI_TUNE_PPC970 */
+
+/* Type to use as socklen_t */
+#define GASNET_SOCKLEN_T socklen_t
+
+/* GASNet build configuration */
+/* #undef GASNET_DEBUG */
+#define GASNET_NDEBUG 1
+/* #undef GASNET_TRACE */
+/* #undef GASNET_STATS */
+/* #undef GASNET_DEBUGMALLOC */
+/* #undef GASNET_SRCLINES */
+/* #undef GASNET_DEBUG_VERBOSE */
+/* #undef GASNET_USE_STRICT_PROTOTYPES */
+
+/* GASNet segment definition */
+/* #undef GASNET_SEGMENT_FAST */
+/* #undef GASNET_SEGMENT_LARGE */
+#define GASNET_SEGMENT_EVERYTHING 1
+
+/* Override to disable default segment alignment */
+/* #undef GASNETI_DISABLE_ALIGNED_SEGMENTS */
+
+/* GASNet smp-conduit */
+/* #undef GASNETC_HAVE_O_ASYNC */
+/* #undef GASNETC_USE_SOCKETPAIR */
+
+/* GASNet {gemini,aries}-conduit settings */
+/* #undef GASNETC_GNI_MAX_MEDIUM */
+/* #undef GASNETC_GNI_MULTI_DOMAIN */
+
+/* GASNet ibv-conduit features and bug work-arounds */
+/* #undef HAVE_IBV_SRQ */
+/* #undef HAVE_IBV_XRC */
+/* #undef HAVE_IBV_TRANSPORT_TYPE */
+/* #undef GASNETC_IBV_RCV_THREAD */
+/* #undef GASNETC_IBV_CONN_THREAD */
+/* #undef GASNETC_IBV_MAX_HCAS */
+
+/* GASNet bug1389 detection/work-around */
+/* #undef GASNETI_BUG1389_WORKAROUND */
+
+/* Defaults for GASNET_SSH_* env vars */
+#define GASNETI_DEFAULT_SSH_CMD "ssh"
+#define GASNETI_DEFAULT_SSH_OPTIONS ""
+#define GASNETI_DEFAULT_SSH_NODEFILE ""
+#define GASNETI_DEFAULT_SSH_RATE "0"
+
+/* Settings for ssh-spawner */
+#define GASNETI_SSH_TOPO_FLAT 1
+/* #undef GASNETI_SSH_TOPO_NARY */
+/* #undef GASNETI_SSH_NARY_DEGREE */
+
+/* Support for pmi-spawner */
+/* #undef HAVE_PMI_H */
+
+
+/* Define to 1 if using 'alloca.c'. */
+/* #undef C_ALLOCA */
+
+/* Log base 2 of the maximum size in bytes of a memory descriptor. Set to 0 if
+   MD can bind all of memory. */
+#define GASNETC_PORTALS4_MAX_MD_SIZE 0
+
+/* Log base 2 of the maximum size in bytes of the user virtual address space.
+   Set to 0 if MD can bind all of memory. */
+#define GASNETC_PORTALS4_MAX_VA_SIZE 0
+
+/* Define to 1 if you have 'alloca', as a function or macro. */
+#define HAVE_ALLOCA 1
+
+/* Define to 1 if <alloca.h> works. */
+#define HAVE_ALLOCA_H 1
+
+/* Define to 1 if you have the `backtrace' function. */
+#define HAVE_BACKTRACE 1
+
+/* Define to 1 if you have the `backtrace_symbols' function. */
+#define HAVE_BACKTRACE_SYMBOLS 1
+
+/* Define to 1 if you have the <execinfo.h> header file. */
+#define HAVE_EXECINFO_H 1
+
+/* Define to 1 if you have the <fca/fca_api.h> header file. */
+/* #undef HAVE_FCA_FCA_API_H */
+
+/* Define to 1 if you have the <features.h> header file. */
+#define HAVE_FEATURES_H 1
+
+/* Define to 1 if you have the `fopen64' function. */
+#define HAVE_FOPEN64 1
+
+/* Define to 1 if you have the `fork' function. */
+#define HAVE_FORK 1
+
+/* Define to 1 if you have the `gethostid' function. */
+#define HAVE_GETHOSTID 1
+
+/* Define to 1 if you have the `getifaddrs' function. */
+#define HAVE_GETIFADDRS 1
+
+/* Define to 1 if you have the `getrlimit' function. */
+#define HAVE_GETRLIMIT 1
+
+/* Define to 1 if you have the `getrlimit64' function. */
+#define HAVE_GETRLIMIT64 1
+
+/* Define to 1 if you have the <gni_pub.h> header file. */
+/* #undef HAVE_GNI_PUB_H */
+
+/* Define to 1 if you have the <hugetlbfs.h> header file. */
+/* #undef HAVE_HUGETLBFS_H */
+
+/* Define to 1 if you have the `hugetlbfs_unlinked_fd' function. */
+/* #undef HAVE_HUGETLBFS_UNLINKED_FD */
+
+/* Define to 1 if you have the `hugetlbfs_unlinked_fd_for_size' function. */
+/* #undef HAVE_HUGETLBFS_UNLINKED_FD_FOR_SIZE */
+
+/* Define to 1 if you have the `ibv_create_xrc_rcv_qp' function. */
+/* #undef HAVE_IBV_CREATE_XRC_RCV_QP */
+
+/* Define to 1 if you have the <ifaddrs.h> header file. */
+#define HAVE_IFADDRS_H 1
+
+/* Define to 1 if you have the <inttypes.h> header file. */
+#define HAVE_INTTYPES_H 1
+
+/* Define to 1 if you have the `isascii' function. */
+#define HAVE_ISASCII 1
+
+/* Define to 1 if you have the `isblank' function. */
+#define HAVE_ISBLANK 1
+
+/* Define to 1 if you have the <linux/mmtimer.h> header file. */
+#define HAVE_LINUX_MMTIMER_H 1
+
+/* Define to 1 if you have the <malloc.h> header file. */
+#define HAVE_MALLOC_H 1
+
+/* Define to 1 if you have the <mxm/api/mxm_api.h> header file. */
+/* #undef HAVE_MXM_API_MXM_API_H */
+
+/* Define to 1 if you have the <netinet/tcp.h> header file. */
+#define HAVE_NETINET_TCP_H 1
+
+/* Define to 1 if you have the `on_exit' function. */
+#define HAVE_ON_EXIT 1
+
+/* Define to 1 if you have the `PMI_Allgather' function. */
+/* #undef HAVE_PMI_ALLGATHER */
+
+/* Define to 1 if you have the `PMI_Bcast' function. */
+/* #undef HAVE_PMI_BCAST */
+
+/* Define to 1 if you have the <pmi_cray.h> header file. */
+/* #undef HAVE_PMI_CRAY_H */
+
+/* Define to 1 if you have the `popen' function. */
+#define HAVE_POPEN 1
+
+/* Define to 1 if you have the <pthread.h> header file. */
+#define HAVE_PTHREAD_H 1
+
+/* Define to 1 if you have the `putenv' function. */
+#define HAVE_PUTENV 1
+
+/* Define to 1 if you have the `setenv' function. */
+#define HAVE_SETENV 1
+
+/* Define to 1 if you have the `setrlimit' function. */
+#define HAVE_SETRLIMIT 1
+
+/* Define to 1 if you have the `setrlimit64' function. */
+#define HAVE_SETRLIMIT64 1
+
+/* Define to 1 if you have the <sgidefs.h> header file. */
+/* #undef HAVE_SGIDEFS_H */
+
+/* Define to 1 if you have the `shmem_longlong_cswap' function. */
+/* #undef HAVE_SHMEM_LONGLONG_CSWAP */
+
+/* Define to 1 if you have the `shmem_long_cswap' function. */
+/* #undef HAVE_SHMEM_LONG_CSWAP */
+
+/* Define to 1 if you have the `shmem_long_finc' function. */
+/* #undef HAVE_SHMEM_LONG_FINC */
+
+/* Define to 1 if you have the `sigprocmask' function. */
+#define HAVE_SIGPROCMASK 1
+
+/* Define to 1 if you have the <sn/mmtimer.h> header file. */
+/* #undef HAVE_SN_MMTIMER_H */
+
+/* Define to 1 if you have the <sn/xpmem.h> header file. */
+/* #undef HAVE_SN_XPMEM_H */
+
+/* Define to 1 if you have the <stdint.h> header file. */
+#define HAVE_STDINT_H 1
+
+/* Define to 1 if you have the <stdio.h> header file. */
+#define HAVE_STDIO_H 1
+
+/* Define to 1 if you have the <stdlib.h> header file. */
+#define HAVE_STDLIB_H 1
+
+/* Define to 1 if you have the <strings.h> header file. */
+#define HAVE_STRINGS_H 1
+
+/* Define to 1 if you have the <string.h> header file. */
+#define HAVE_STRING_H 1
+
+/* Define to 1 if you have the `system' function. */
+#define HAVE_SYSTEM 1
+
+/* Define to 1 if you have the <sys/param.h> header file. */
+#define HAVE_SYS_PARAM_H 1
+
+/* Define to 1 if you have the <sys/resource.h> header file. */
+#define HAVE_SYS_RESOURCE_H 1
+
+/* Define to 1 if you have the <sys/socket.h> header file. */
+#define HAVE_SYS_SOCKET_H 1
+
+/* Define to 1 if you have the <sys/sockio.h> header file. */
+/* #undef HAVE_SYS_SOCKIO_H */
+
+/* Define to 1 if you have the <sys/stat.h> header file. */
+#define HAVE_SYS_STAT_H 1
+
+/* Define to 1 if you have the <sys/table.h> header file. */
+/* #undef HAVE_SYS_TABLE_H */
+
+/* Define to 1 if you have the <sys/types.h> header file. */
+#define HAVE_SYS_TYPES_H 1
+
+/* Define to 1 if you have the <sys/uio.h> header file. */
+#define HAVE_SYS_UIO_H 1
+
+/* Define to 1 if you have the `toascii' function. */
+#define HAVE_TOASCII 1
+
+/* Define to 1 if you have the <ucontext.h> header file. */
+#define HAVE_UCONTEXT_H 1
+
+/* Define to 1 if you have the <unistd.h> header file. */
+#define HAVE_UNISTD_H 1
+
+/* Define to 1 if you have the `unsetenv' function. */
+#define HAVE_UNSETENV 1
+
+/* Define to 1 if you have the <xpmem.h> header file. */
+/* #undef HAVE_XPMEM_H */
+
+/* Define to 1 if you have the </boot/kernel.h> header file. */
+/* #undef HAVE__BOOT_KERNEL_H */
+
+/* Define to the address where bug reports for this package should be sent. */
+
+/* Define to the full name of this package. */
+
+/* Define to the full name and version of this package. */
+
+/* Define to the one symbol short name of this package. */
+
+/* Define to the home page for this package. */
+
+/* Define to the version of this package. */
+
+/* The PLPA symbol prefix */
+#define PLPA_SYM_PREFIX gasneti_plpa_
+
+/* The size of `char', as computed by sizeof. */
+#define SIZEOF_CHAR 1
+
+/* The size of `double', as computed by sizeof. */
+#define SIZEOF_DOUBLE 8
+
+/* The size of `float', as computed by sizeof. */
+#define SIZEOF_FLOAT 4
+
+/* The size of `float _Complex', as computed by sizeof. */
+#define SIZEOF_FLOAT__COMPLEX 8
+
+/* The size of `int', as computed by sizeof. */
+#define SIZEOF_INT 4
+
+/* The size of `long', as computed by sizeof. */
+#define SIZEOF_LONG 8
+
+/* The size of `long double', as computed by sizeof. */
+#define SIZEOF_LONG_DOUBLE 16
+
+/* The size of `long long', as computed by sizeof. */
+#define SIZEOF_LONG_LONG 8
+
+/* The size of `short', as computed by sizeof. */
+#define SIZEOF_SHORT 2
+
+/* The size of `void *', as computed by sizeof. */
+#define SIZEOF_VOID_P 8
+
+/* The size of `_Bool', as computed by sizeof. */
+#define SIZEOF__BOOL 1
+
+/* If using the C implementation of alloca, define if you know the
+   direction of stack growth for your system; otherwise it will be
+   automatically deduced at runtime.
+	STACK_DIRECTION > 0 => grows toward higher addresses
+	STACK_DIRECTION < 0 => grows toward lower addresses
+	STACK_DIRECTION = 0 => direction of growth unknown */
+/* #undef STACK_DIRECTION */
+
+/* Define to 1 if all of the C90 standard headers exist (not just the ones
+   required in a freestanding environment). This macro is provided for
+   backward compatibility; new code need not use it. */
+#define STDC_HEADERS 1
+
+/* whether byteorder is bigendian */
+/* #undef WORDS_BIGENDIAN */
+
+/* Define to `unsigned int' if <sys/types.h> does not define. */
+/* #undef size_t */
+
+/* these get us 64-bit file declarations under several Unixen */
+/* they must come before the first include of features.h (included by many system headers) */
+/* define them even on platforms lacking features.h */
+#define _LARGEFILE64_SOURCE 1
+#define _LARGEFILE_SOURCE 1
+#ifdef HAVE_FEATURES_H
+# include <features.h>
+#endif
+
+#endif